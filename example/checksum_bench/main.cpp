@@ -0,0 +1,117 @@
+//
+// Copyright 2018 (C). Alex Robenko. All rights reserved.
+//
+
+// This file is free software: you can redistribute it and/or modify
+// it under the terms of the GNU General Public License as published by
+// the Free Software Foundation, either version 3 of the License, or
+// (at your option) any later version.
+//
+// This program is distributed in the hope that it will be useful,
+// but WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+// GNU General Public License for more details.
+//
+// You should have received a copy of the GNU General Public License
+// along with this program.  If not, see <http://www.gnu.org/licenses/>.
+
+// Measures the throughput of the UBX checksum calculation performed
+// byte by byte through generic iterator, using the portable block-wise
+// path and using the SIMD path selected for the contiguous buffers.
+//
+// Usage: cc_ublox_checksum_bench_example [size_MiB] [repeat]
+
+#include <cstdint>
+#include <cstdlib>
+#include <chrono>
+#include <iostream>
+#include <iomanip>
+#include <vector>
+
+#include "ublox/protocol/ChecksumCalc.h"
+
+namespace
+{
+
+namespace details = ublox::protocol::details;
+
+using Buffer = std::vector<std::uint8_t>;
+
+std::uint16_t iteratorChecksum(const Buffer& data)
+{
+    auto iter = data.begin();
+    return ublox::protocol::ChecksumCalc()(iter, data.size());
+}
+
+std::uint16_t portableChecksum(const Buffer& data)
+{
+    details::ChecksumState state;
+    auto consumed = details::checksumUpdateBlocksPortable(state, &data[0], data.size());
+    details::checksumUpdateScalar(state, &data[0] + consumed, data.size() - consumed);
+    return details::checksumValue(state);
+}
+
+std::uint16_t pointerChecksum(const Buffer& data)
+{
+    const std::uint8_t* iter = &data[0];
+    return ublox::protocol::ChecksumCalc()(iter, data.size());
+}
+
+template <typename TFunc>
+std::uint16_t measure(const char* name, const Buffer& data, unsigned repeat, TFunc&& func)
+{
+    std::uint16_t result = 0U;
+    volatile std::uint32_t total = 0U; // Prevents the loop from being optimised away
+    auto start = std::chrono::steady_clock::now();
+    for (auto idx = 0U; idx < repeat; ++idx) {
+        result = func(data);
+        total = total + result;
+    }
+    auto duration = std::chrono::duration<double>(std::chrono::steady_clock::now() - start).count();
+    auto bytes = static_cast<double>(data.size()) * repeat;
+
+    std::cout << std::setw(10) << name << ": "
+              << std::fixed << std::setprecision(2) << (bytes / duration / 1e9) << " GB/s"
+              << " (checksum 0x" << std::hex << result << std::dec << ")" << std::endl;
+    return result;
+}
+
+} // namespace
+
+int main(int argc, char* argv[])
+{
+    std::size_t sizeMiB = 64U;
+    unsigned repeat = 10U;
+    if (1 < argc) {
+        sizeMiB = static_cast<std::size_t>(std::strtoul(argv[1], nullptr, 10));
+    }
+
+    if (2 < argc) {
+        repeat = static_cast<unsigned>(std::strtoul(argv[2], nullptr, 10));
+    }
+
+    if ((sizeMiB == 0U) || (repeat == 0U)) {
+        std::cerr << "Usage: " << argv[0] << " [size_MiB] [repeat]" << std::endl;
+        return -1;
+    }
+
+    Buffer data(sizeMiB * 1024U * 1024U);
+    std::uint32_t seed = 0x12345678U;
+    for (auto& byte : data) {
+        seed ^= seed << 13;
+        seed ^= seed >> 17;
+        seed ^= seed << 5;
+        byte = static_cast<std::uint8_t>(seed);
+    }
+
+    auto expected = measure("iterator", data, repeat, iteratorChecksum);
+    auto portable = measure("portable", data, repeat, portableChecksum);
+    auto simd = measure("pointer", data, repeat, pointerChecksum);
+    if ((portable != expected) || (simd != expected)) {
+        std::cerr << "ERROR: Checksum mismatch" << std::endl;
+        return -1;
+    }
+
+    return 0;
+}
+
@@ -0,0 +1,217 @@
+//
+// Copyright 2018 (C). Alex Robenko. All rights reserved.
+//
+
+// This file is free software: you can redistribute it and/or modify
+// it under the terms of the GNU General Public License as published by
+// the Free Software Foundation, either version 3 of the License, or
+// (at your option) any later version.
+//
+// This program is distributed in the hope that it will be useful,
+// but WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+// GNU General Public License for more details.
+//
+// You should have received a copy of the GNU General Public License
+// along with this program.  If not, see <http://www.gnu.org/licenses/>.
+
+// Compares the time spent serialising MGA-GPS-EPH and CFG-GNSS frames
+// using write() + update() of ublox::Stack into std::vector (as
+// previously done by the simple_pos example) and using ublox::writeFrame()
+// into the buffer on the stack, both with the actual message class and
+// through the interface class.
+//
+// Usage: cc_ublox_frame_writer_bench_example [count_K]
+
+#include <cstdint>
+#include <cstdlib>
+#include <array>
+#include <chrono>
+#include <iostream>
+#include <iomanip>
+#include <iterator>
+#include <tuple>
+#include <vector>
+
+#include "ublox/Message.h"
+#include "ublox/Stack.h"
+#include "ublox/FrameWriter.h"
+#include "ublox/message/CfgGnss.h"
+#include "ublox/message/MgaGpsEph.h"
+#include "ublox/message/NavPosllh.h"
+
+namespace
+{
+
+using Buffer = std::vector<std::uint8_t>;
+using OutBuffer = std::array<std::uint8_t, 1024>;
+
+using InMessage =
+    ublox::MessageT<
+        comms::option::ReadIterator<const std::uint8_t*>
+    >;
+
+using ProtStack = ublox::Stack<InMessage, std::tuple<ublox::message::NavPosllh<InMessage> > >;
+
+using OutMessage =
+    ublox::MessageT<
+        comms::option::IdInfoInterface,
+        comms::option::WriteIterator<std::uint8_t*>
+    >;
+
+using StackOutMessage =
+    ublox::MessageT<
+        comms::option::IdInfoInterface,
+        comms::option::WriteIterator<std::back_insert_iterator<Buffer> >,
+        comms::option::LengthInfoInterface
+    >;
+
+struct FillMgaGpsEph
+{
+    template <typename TMsg>
+    void operator()(TMsg& msg) const
+    {
+        msg.field_svId().value() = 17;
+        msg.field_fitInterval().value() = 1;
+        msg.field_uraIndex().value() = 2;
+    }
+};
+
+// GPS, SBAS, Galileo, BeiDou, IMES, QZSS and GLONASS blocks
+struct FillCfgGnss
+{
+    template <typename TMsg>
+    void operator()(TMsg& msg) const
+    {
+        static const std::uint8_t BlocksCount = 7U;
+        msg.field_numTrkChHw().value() = 32;
+        msg.field_numTrkChUse().value() = 32;
+        msg.field_numConfigBlocks().value() = BlocksCount;
+        auto& blocks = msg.field_blocksList().value();
+        blocks.resize(BlocksCount);
+        for (std::uint8_t idx = 0U; idx < BlocksCount; ++idx) {
+            blocks[idx].field_maxTrkCh().value() = static_cast<std::uint8_t>(idx + 8U);
+        }
+    }
+};
+
+struct StackWriter
+{
+    template <typename TMsg>
+    Buffer operator()(const TMsg& msg)
+    {
+        Buffer buf;
+        buf.reserve(m_stack.length(msg));
+        auto iter = std::back_inserter(buf);
+        auto es = m_stack.write(msg, iter, buf.max_size());
+        if (es == comms::ErrorStatus::UpdateRequired) {
+            auto* updateIter = &buf[0];
+            es = m_stack.update(updateIter, buf.size());
+        }
+        static_cast<void>(es);
+        return buf;
+    }
+
+    ProtStack m_stack;
+};
+
+template <typename TMsg>
+Buffer frameOf(const TMsg& msg)
+{
+    OutBuffer buf;
+    auto* iter = &buf[0];
+    auto es = ublox::writeFrame(msg, iter, buf.size());
+    static_cast<void>(es);
+    return Buffer(&buf[0], iter);
+}
+
+template <typename TFunc>
+void measure(const char* name, std::size_t count, TFunc&& func)
+{
+    volatile std::uint32_t total = 0U; // Prevents the loop from being optimised away
+    auto start = std::chrono::steady_clock::now();
+    for (std::size_t idx = 0U; idx < count; ++idx) {
+        total = total + func();
+    }
+    auto duration = std::chrono::duration<double>(std::chrono::steady_clock::now() - start).count();
+
+    std::cout << std::setw(20) << name << ": "
+              << std::fixed << std::setprecision(1) << (duration / static_cast<double>(count) * 1e9)
+              << " ns/frame" << std::endl;
+}
+
+template <typename TStackMsg, typename TMsg, typename TFill>
+bool compare(const char* name, std::size_t count, TFill&& fill)
+{
+    TStackMsg stackMsg;
+    fill(stackMsg);
+    TMsg msg;
+    fill(msg);
+    const OutMessage& msgInterface = msg;
+
+    std::cout << name << ":" << std::endl;
+    StackWriter stackWriter;
+    measure("write + update", count,
+        [&stackWriter, &stackMsg]() -> std::uint32_t
+        {
+            auto buf = stackWriter(stackMsg);
+            return buf.back();
+        });
+
+    measure("writeFrame", count,
+        [&msg]() -> std::uint32_t
+        {
+            OutBuffer buf;
+            auto* iter = &buf[0];
+            ublox::writeFrame(msg, iter, buf.size());
+            return *(iter - 1);
+        });
+
+    measure("writeFrame (virtual)", count,
+        [&msgInterface]() -> std::uint32_t
+        {
+            OutBuffer buf;
+            auto* iter = &buf[0];
+            ublox::writeFrame(msgInterface, iter, buf.size());
+            return *(iter - 1);
+        });
+
+    auto expected = stackWriter(stackMsg);
+    return (frameOf(msg) == expected) && (frameOf(msgInterface) == expected);
+}
+
+} // namespace
+
+int main(int argc, char* argv[])
+{
+    std::size_t countK = 1000U;
+    if (1 < argc) {
+        countK = static_cast<std::size_t>(std::strtoul(argv[1], nullptr, 10));
+    }
+
+    if (countK == 0U) {
+        std::cerr << "Usage: " << argv[0] << " [count_K]" << std::endl;
+        return -1;
+    }
+
+    auto count = countK * 1000U;
+    bool eph =
+        compare<
+            ublox::message::MgaGpsEph<StackOutMessage>,
+            ublox::message::MgaGpsEph<OutMessage>
+        >("MGA-GPS-EPH", count, FillMgaGpsEph());
+
+    bool gnss =
+        compare<
+            ublox::message::CfgGnss<StackOutMessage>,
+            ublox::message::CfgGnss<OutMessage>
+        >("CFG-GNSS", count, FillCfgGnss());
+
+    if ((!eph) || (!gnss)) {
+        std::cerr << "ERROR: Frames mismatch" << std::endl;
+        return -1;
+    }
+
+    return 0;
+}
+
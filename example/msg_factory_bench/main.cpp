@@ -0,0 +1,187 @@
+//
+// Copyright 2018 (C). Alex Robenko. All rights reserved.
+//
+
+// This file is free software: you can redistribute it and/or modify
+// it under the terms of the GNU General Public License as published by
+// the Free Software Foundation, either version 3 of the License, or
+// (at your option) any later version.
+//
+// This program is distributed in the hope that it will be useful,
+// but WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+// GNU General Public License for more details.
+//
+// You should have received a copy of the GNU General Public License
+// along with this program.  If not, see <http://www.gnu.org/licenses/>.
+
+// Compares the time spent reading the input messages using ublox::Stack
+// (sorted search over all ublox::InputMessages performed by
+// comms::protocol::MsgIdLayer) and ublox::TableStack (direct dispatch
+// through ublox::MsgFactoryTable).
+//
+// The frames are either taken from the recorded raw UBX stream or
+// synthesised out of the default constructed objects of every input message.
+//
+// Usage: cc_ublox_msg_factory_bench_example [file] [repeat]
+
+#include <cstdint>
+#include <cstdlib>
+#include <cstring>
+#include <cerrno>
+#include <chrono>
+#include <iostream>
+#include <iomanip>
+#include <limits>
+#include <vector>
+
+#include "ublox/ublox.h"
+#include "ublox/InputMessages.h"
+#include "ublox/TableStack.h"
+#include "ublox/FrameSpan.h"
+#include "ublox/protocol/FrameScanner.h"
+#include "ublox/io/MappedFile.h"
+
+namespace
+{
+
+using InMessage =
+    ublox::MessageT<
+        comms::option::ReadIterator<const std::uint8_t*>,
+        comms::option::WriteIterator<std::uint8_t*>,
+        comms::option::LengthInfoInterface
+    >;
+
+using AllMessages = ublox::InputMessages<InMessage>;
+using ProtStack = ublox::Stack<InMessage, AllMessages>;
+using InTableStack = ublox::TableStack<InMessage, AllMessages>;
+using Scanner = ublox::protocol::FrameScanner<>;
+
+using Buffer = std::vector<std::uint8_t>;
+using Frames = std::vector<ublox::FrameSpan>;
+
+void appendFrame(Buffer& buf, ublox::MsgId id, InMessage& msg)
+{
+    auto start = buf.size();
+    auto payloadLen = msg.length();
+    buf.resize(start + Scanner::MinFrameLen + payloadLen);
+
+    auto* frame = &buf[start];
+    auto idValue = static_cast<unsigned>(id);
+    frame[0] = Scanner::SyncChar1;
+    frame[1] = Scanner::SyncChar2;
+    frame[2] = static_cast<std::uint8_t>(idValue >> std::numeric_limits<std::uint8_t>::digits);
+    frame[3] = static_cast<std::uint8_t>(idValue);
+    frame[4] = static_cast<std::uint8_t>(payloadLen);
+    frame[5] = static_cast<std::uint8_t>(payloadLen >> std::numeric_limits<std::uint8_t>::digits);
+
+    InMessage::WriteIterator writeIter = frame + Scanner::HeaderLen;
+    msg.write(writeIter, payloadLen);
+
+    const std::uint8_t* checksumIter = frame + 2U;
+    auto checksum = ublox::protocol::ChecksumCalc()(checksumIter, (Scanner::HeaderLen - 2U) + payloadLen);
+    auto* checksumPos = frame + Scanner::HeaderLen + payloadLen;
+    checksumPos[0] = static_cast<std::uint8_t>(checksum);
+    checksumPos[1] = static_cast<std::uint8_t>(checksum >> std::numeric_limits<std::uint8_t>::digits);
+}
+
+// Default constructed object of every input message
+void synthesise(Buffer& buf)
+{
+    InTableStack stack;
+    for (auto id : ublox::details::MsgIdTableData<>::KnownIds) {
+        for (auto idx = 0U; ; ++idx) {
+            auto msg = stack.createMsg(id, idx);
+            if (!msg) {
+                break;
+            }
+
+            appendFrame(buf, id, *msg);
+        }
+    }
+}
+
+Frames split(const Buffer& buf)
+{
+    Frames frames;
+    Scanner scanner;
+    std::size_t offset = 0U;
+    while (offset < buf.size()) {
+        auto result = scanner.scan(&buf[offset], buf.size() - offset);
+        if (result.m_status != comms::ErrorStatus::Success) {
+            break;
+        }
+
+        ublox::FrameSpan frame;
+        frame.m_data = result.m_frame;
+        frame.m_size = result.m_frameLen;
+        frames.push_back(frame);
+        offset = static_cast<std::size_t>(result.m_frame - &buf[0]) + result.m_frameLen;
+    }
+    return frames;
+}
+
+template <typename TStack>
+void measure(const char* name, const Frames& frames, unsigned repeat)
+{
+    TStack stack;
+    std::size_t messages = 0U;
+    std::size_t errors = 0U;
+    auto start = std::chrono::steady_clock::now();
+    for (auto round = 0U; round < repeat; ++round) {
+        for (auto& frame : frames) {
+            typename TStack::MsgPtr msg;
+            const std::uint8_t* iter = frame.m_data;
+            auto es = stack.read(msg, iter, frame.m_size);
+            if (es == comms::ErrorStatus::Success) {
+                ++messages;
+            }
+            else {
+                ++errors;
+            }
+        }
+    }
+    auto sec = std::chrono::duration<double>(std::chrono::steady_clock::now() - start).count();
+    auto count = static_cast<double>(frames.size()) * repeat;
+
+    std::cout << std::setw(12) << name << ": "
+              << std::fixed << std::setprecision(1) << (sec * 1e9 / count) << " ns/frame, "
+              << std::setprecision(2) << (count / sec / 1e6) << " Mframes/s"
+              << " (messages " << messages << ", errors " << errors << ")" << std::endl;
+}
+
+} // namespace
+
+int main(int argc, char* argv[])
+{
+    Buffer buf;
+    if (1 < argc) {
+        ublox::io::MappedFile file;
+        if (!file.open(argv[1])) {
+            std::cerr << "ERROR: Failed to open " << argv[1] << ": " << std::strerror(errno) << std::endl;
+            return -1;
+        }
+
+        buf.assign(file.data(), file.data() + file.size());
+    }
+    else {
+        synthesise(buf);
+    }
+
+    unsigned repeat = 1000U;
+    if (2 < argc) {
+        repeat = static_cast<unsigned>(std::strtoul(argv[2], nullptr, 10));
+    }
+
+    auto frames = split(buf);
+    if (frames.empty() || (repeat == 0U)) {
+        std::cerr << "ERROR: No frames to decode" << std::endl;
+        return -1;
+    }
+
+    std::cout << frames.size() << " frames, " << repeat << " rounds" << std::endl;
+    measure<ProtStack>("Stack", frames, repeat);
+    measure<InTableStack>("TableStack", frames, repeat);
+    return 0;
+}
+
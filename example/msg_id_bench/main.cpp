@@ -0,0 +1,183 @@
+//
+// Copyright 2018 (C). Alex Robenko. All rights reserved.
+//
+
+// This file is free software: you can redistribute it and/or modify
+// it under the terms of the GNU General Public License as published by
+// the Free Software Foundation, either version 3 of the License, or
+// (at your option) any later version.
+//
+// This program is distributed in the hope that it will be useful,
+// but WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+// GNU General Public License for more details.
+//
+// You should have received a copy of the GNU General Public License
+// along with this program.  If not, see <http://www.gnu.org/licenses/>.
+
+// Measures the time of the message ID validation performed by
+// ublox::details::isKnownMsgId() (two level lookup table) and by the
+// binary search of the class followed by the binary search of the ID
+// within the class, as previously done by the validator of
+// ublox::field::MsgId.
+//
+// Usage: cc_ublox_msg_id_bench_example [count_M] [repeat]
+
+#include <cstdint>
+#include <cstdlib>
+#include <algorithm>
+#include <chrono>
+#include <iostream>
+#include <iomanip>
+#include <iterator>
+#include <vector>
+
+#include "ublox/MsgId.h"
+#include "ublox/details/MsgIdTable.h"
+
+namespace
+{
+
+using Ids = std::vector<ublox::MsgId>;
+using TableData = ublox::details::MsgIdTableData<>;
+
+std::uint8_t classId(ublox::MsgId id)
+{
+    return static_cast<std::uint8_t>(static_cast<unsigned>(id) >> 8);
+}
+
+class SearchValidator
+{
+public:
+    SearchValidator()
+      : m_ids(std::begin(TableData::KnownIds), std::end(TableData::KnownIds))
+    {
+        std::sort(m_ids.begin(), m_ids.end());
+        for (std::size_t idx = 0U; idx < m_ids.size(); ++idx) {
+            auto cId = classId(m_ids[idx]);
+            if (m_classes.empty() || (m_classes.back().m_classId != cId)) {
+                m_classes.push_back(ClassInfo{cId, idx, idx});
+            }
+            m_classes.back().m_end = idx + 1U;
+        }
+    }
+
+    bool operator()(ublox::MsgId id) const
+    {
+        auto cId = classId(id);
+        auto classIter =
+            std::lower_bound(
+                m_classes.begin(), m_classes.end(), cId,
+                [](const ClassInfo& info, std::uint8_t cIdParam) -> bool
+                {
+                    return info.m_classId < cIdParam;
+                });
+
+        if ((classIter == m_classes.end()) || (classIter->m_classId != cId)) {
+            return false;
+        }
+
+        auto begin = m_ids.begin() + static_cast<std::ptrdiff_t>(classIter->m_begin);
+        auto end = m_ids.begin() + static_cast<std::ptrdiff_t>(classIter->m_end);
+        auto iter = std::lower_bound(begin, end, id);
+        return (iter != end) && (*iter == id);
+    }
+
+private:
+    struct ClassInfo
+    {
+        std::uint8_t m_classId;
+        std::size_t m_begin;
+        std::size_t m_end;
+    };
+
+    Ids m_ids;
+    std::vector<ClassInfo> m_classes;
+};
+
+bool tableValidator(ublox::MsgId id)
+{
+    return ublox::details::isKnownMsgId(id);
+}
+
+// Mostly known IDs, as received from the device, with some random ones
+Ids makeIds(std::size_t count)
+{
+    Ids ids;
+    ids.reserve(count);
+    std::uint32_t seed = 0x12345678U;
+    for (std::size_t idx = 0U; idx < count; ++idx) {
+        seed ^= seed << 13;
+        seed ^= seed >> 17;
+        seed ^= seed << 5;
+        if ((seed % 10U) == 0U) {
+            ids.push_back(static_cast<ublox::MsgId>(seed >> 16));
+            continue;
+        }
+
+        ids.push_back(TableData::KnownIds[(seed >> 8) % ublox::details::KnownMsgIdsCount]);
+    }
+    return ids;
+}
+
+template <typename TFunc>
+std::size_t measure(const char* name, const Ids& ids, unsigned repeat, TFunc&& func)
+{
+    std::size_t known = 0U;
+    auto start = std::chrono::steady_clock::now();
+    for (auto idx = 0U; idx < repeat; ++idx) {
+        known = 0U;
+        for (auto id : ids) {
+            if (func(id)) {
+                ++known;
+            }
+        }
+    }
+    auto duration = std::chrono::duration<double>(std::chrono::steady_clock::now() - start).count();
+    auto lookups = static_cast<double>(ids.size()) * repeat;
+
+    std::cout << std::setw(8) << name << ": "
+              << std::fixed << std::setprecision(2) << (duration / lookups * 1e9) << " ns/lookup"
+              << " (" << known << " known)" << std::endl;
+    return known;
+}
+
+} // namespace
+
+int main(int argc, char* argv[])
+{
+    std::size_t countM = 16U;
+    unsigned repeat = 5U;
+    if (1 < argc) {
+        countM = static_cast<std::size_t>(std::strtoul(argv[1], nullptr, 10));
+    }
+
+    if (2 < argc) {
+        repeat = static_cast<unsigned>(std::strtoul(argv[2], nullptr, 10));
+    }
+
+    if ((countM == 0U) || (repeat == 0U)) {
+        std::cerr << "Usage: " << argv[0] << " [count_M] [repeat]" << std::endl;
+        return -1;
+    }
+
+    SearchValidator searchValidator;
+    for (unsigned value = 0U; value <= 0xffffU; ++value) {
+        auto id = static_cast<ublox::MsgId>(value);
+        if (searchValidator(id) != tableValidator(id)) {
+            std::cerr << "ERROR: Validation mismatch for ID 0x" << std::hex << value << std::endl;
+            return -1;
+        }
+    }
+
+    auto ids = makeIds(countM * 1000U * 1000U);
+    auto expected = measure("search", ids, repeat, searchValidator);
+    auto known = measure("table", ids, repeat, tableValidator);
+    if (known != expected) {
+        std::cerr << "ERROR: Validation mismatch" << std::endl;
+        return -1;
+    }
+
+    return 0;
+}
+
@@ -0,0 +1,116 @@
+//
+// Copyright 2018 (C). Alex Robenko. All rights reserved.
+//
+
+// This file is free software: you can redistribute it and/or modify
+// it under the terms of the GNU General Public License as published by
+// the Free Software Foundation, either version 3 of the License, or
+// (at your option) any later version.
+//
+// This program is distributed in the hope that it will be useful,
+// but WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+// GNU General Public License for more details.
+//
+// You should have received a copy of the GNU General Public License
+// along with this program.  If not, see <http://www.gnu.org/licenses/>.
+
+// Decodes the recorded raw UBX stream using ublox::io::ParallelDecoder with
+// increasing number of worker threads and reports the decoding throughput
+// and scaling relative to single worker.
+//
+// Usage: cc_ublox_parallel_decode_example <file> [max_workers]
+
+#include <cstdint>
+#include <cstdlib>
+#include <cstring>
+#include <cerrno>
+#include <chrono>
+#include <iostream>
+#include <iomanip>
+#include <thread>
+#include <vector>
+
+#include "ublox/ublox.h"
+#include "ublox/InputMessages.h"
+#include "ublox/io/ParallelDecoder.h"
+
+namespace
+{
+
+using InMessage =
+    ublox::MessageT<
+        comms::option::ReadIterator<const std::uint8_t*>,
+        comms::option::IdInfoInterface
+    >;
+
+using ProtStack = ublox::Stack<InMessage, ublox::InputMessages<InMessage> >;
+
+using Decoder = ublox::io::ParallelDecoder<ProtStack>;
+
+} // namespace
+
+int main(int argc, char* argv[])
+{
+    if (argc < 2) {
+        std::cerr << "Usage: " << argv[0] << " <file> [max_workers]" << std::endl;
+        return -1;
+    }
+
+    std::size_t maxWorkers = std::thread::hardware_concurrency();
+    if (2 < argc) {
+        maxWorkers = static_cast<std::size_t>(std::strtoul(argv[2], nullptr, 10));
+    }
+
+    if (maxWorkers == 0U) {
+        maxWorkers = 1U;
+    }
+
+    ublox::io::MappedFile file;
+    if (!file.open(argv[1])) {
+        std::cerr << "ERROR: Failed to open " << argv[1] << ": " << std::strerror(errno) << std::endl;
+        return -1;
+    }
+
+    auto convert =
+        [](InMessage& msg, std::vector<ublox::MsgId>& out)
+        {
+            out.push_back(msg.getId());
+        };
+
+    double baseSec = 0.0;
+    std::cout << "workers  messages    errors     MB/s  speedup" << std::endl;
+    std::size_t workers = 1U;
+    while (true) {
+        Decoder decoder(workers);
+        auto start = std::chrono::steady_clock::now();
+        auto ids = decoder.decode<ublox::MsgId>(file.data(), file.size(), convert);
+        auto sec =
+            std::chrono::duration_cast<std::chrono::duration<double> >(
+                std::chrono::steady_clock::now() - start).count();
+
+        if (workers == 1U) {
+            baseSec = sec;
+        }
+
+        auto& stats = decoder.stats();
+        std::cout <<
+            std::setw(7) << workers <<
+            std::setw(10) << ids.size() <<
+            std::setw(10) << stats.m_errors <<
+            std::setw(9) << std::fixed << std::setprecision(1) <<
+                (static_cast<double>(file.size()) / (1024.0 * 1024.0) / sec) <<
+            std::setw(9) << std::setprecision(2) << (baseSec / sec) << std::endl;
+
+        if (maxWorkers <= workers) {
+            break;
+        }
+
+        workers *= 2U;
+        if (maxWorkers < workers) {
+            workers = maxWorkers;
+        }
+    }
+
+    return 0;
+}
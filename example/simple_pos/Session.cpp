@@ -19,6 +19,7 @@
 
 #include <iostream>
 #include <cassert>
+#include <iterator>
 
 #include "comms/CompileControl.h"
 
@@ -27,7 +28,8 @@ CC_DISABLE_WARNINGS()
 CC_ENABLE_WARNINGS()
 
 #include "ublox/message/CfgPrtUsb.h"
-#include "ublox/message/NavPosllhPoll.h"
+#include "ublox/PollFrame.h"
+#include "ublox/FrameWriter.h"
 
 Session::Session(const QString &dev)
   : m_serial(dev)
@@ -82,41 +84,43 @@ void Session::handle(InMessage& msg)
 
 void Session::performRead()
 {
-    auto data = m_serial.readAll();
-    auto dataBegIter = data.constData();
-    auto dataEndIter = dataBegIter + data.size();
-    m_inData.insert(m_inData.end(), dataBegIter, dataEndIter);
-
-    std::size_t consumed = 0U;
-    while (consumed < m_inData.size()) {
-        // Smart pointer to the message object.
-        ProtStack::MsgPtr msgPtr;
-        // Type of the message interface class
-        using MsgType = ProtStack::MsgPtr::element_type;
-
-        // Get the iterator for reading
-        auto begIter = comms::readIteratorFor<MsgType>(&m_inData[0] + consumed);
-        auto iter = begIter;
-        // Do the read
-        auto es = m_stack.read(msgPtr, iter, m_inData.size() - consumed);
-        if (es == comms::ErrorStatus::NotEnoughData) {
-            break; // Not enough data in the buffer, stop processing
+    auto discardedCount = m_inData.discardedCount();
+    while (0 < m_serial.bytesAvailable()) {
+        // Read directly into the free area of the input buffer
+        auto readLen =
+            m_serial.read(
+                reinterpret_cast<char*>(m_inData.writeBuf()),
+                static_cast<qint64>(m_inData.writeBufSize()));
+
+        if (readLen <= 0) {
+            break;
         }
 
-        if (es == comms::ErrorStatus::ProtocolError) {
-            // Something is not right with the data, remove one character and try again
-           ++consumed;
-            continue;
+        m_inData.commit(static_cast<std::size_t>(readLen));
+
+        // Process all the complete frames, the garbage between them is skipped
+        ublox::FrameSpan frame;
+        while (m_inData.nextFrame(frame)) {
+            // Smart pointer to the message object.
+            ProtStack::MsgPtr msgPtr;
+            // Type of the message interface class
+            using MsgType = ProtStack::MsgPtr::element_type;
+
+            // Get the iterator for reading
+            auto iter = comms::readIteratorFor<MsgType>(frame.data());
+            // Do the read of the whole frame, it is dropped even if its
+            // contents are not recognised.
+            auto es = m_stack.read(msgPtr, iter, frame.size());
+            if (es == comms::ErrorStatus::Success) {
+                assert(msgPtr); // If read is successful, msgPtr is expected to hold a valid pointer
+                msgPtr->dispatch(*this); // Dispatch message for handling
+            }
         }
-        if (es == comms::ErrorStatus::Success) {
-            assert(msgPtr); // If read is successful, msgPtr is expected to hold a valid pointer
-            msgPtr->dispatch(*this); // Dispatch message for handling
-        }
-        // The iterator for reading has been advanced, update the difference
-        consumed += std::distance(begIter, iter);
     }
 
-    m_inData.erase(m_inData.begin(), m_inData.begin() + consumed);
+    if (discardedCount != m_inData.discardedCount()) {
+        std::cerr << "WARNING: Discarded " << (m_inData.discardedCount() - discardedCount) << " bytes" << std::endl;
+    }
 }
 
 void Session::errorOccurred(QSerialPort::SerialPortError err)
@@ -133,23 +137,21 @@ void Session::errorOccurred(QSerialPort::SerialPortError err)
 
 void Session::sendPosPoll()
 {
-    using OutNavPosllhPoll = ublox::message::NavPosllhPoll<OutMessage>;
-    sendMessage(OutNavPosllhPoll());
+    // The poll frame is constant, write the precomputed bytes as is
+    auto frame = ublox::poll::NavPosllhPoll::span();
+    m_serial.write(reinterpret_cast<const char*>(frame.data()), static_cast<qint64>(frame.size()));
+    m_serial.flush();
 }
 
 void Session::sendMessage(const OutMessage& msg)
 {
     OutBuffer buf;
-    buf.reserve(m_stack.length(msg)); // Reserve enough space
-    auto iter = std::back_inserter(buf);
-    auto es = m_stack.write(msg, iter, buf.max_size());
-    if (es == comms::ErrorStatus::UpdateRequired) {
-        auto* updateIter = &buf[0];
-        es = m_stack.update(updateIter, buf.size());
-    }
+    auto* iter = &buf[0];
+    auto es = ublox::writeFrame(msg, iter, buf.size());
     static_cast<void>(es);
     assert(es == comms::ErrorStatus::Success); // do not expect any error
-    m_serial.write(reinterpret_cast<const char*>(&buf[0]), buf.size());
+    auto len = static_cast<qint64>(std::distance(&buf[0], iter));
+    m_serial.write(reinterpret_cast<const char*>(&buf[0]), len);
     m_serial.flush();
 }
 
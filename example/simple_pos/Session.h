@@ -18,7 +18,7 @@
 #pragma once
 
 #include <cstdint>
-#include <vector>
+#include <array>
 
 #include "comms/CompileControl.h"
 
@@ -30,6 +30,7 @@ CC_DISABLE_WARNINGS()
 CC_ENABLE_WARNINGS()
 
 #include "ublox/ublox.h"
+#include "ublox/StreamFramer.h"
 #include "ublox/message/NavPosllh.h"
 
 class Session : public QObject
@@ -43,16 +44,19 @@ class Session : public QObject
             comms::option::Handler<Session> // Dispatch to this object
         >;
 
-    using OutBuffer = std::vector<std::uint8_t>;
+    // Output messages are small, serialise them on the stack
+    using OutBuffer = std::array<std::uint8_t, 1024>;
     using OutMessage =
         ublox::MessageT<
             comms::option::IdInfoInterface,
-            comms::option::WriteIterator<std::back_insert_iterator<OutBuffer> >,
-            comms::option::LengthInfoInterface
+            comms::option::WriteIterator<std::uint8_t*>
         >;
 
     using InNavPosllh = ublox::message::NavPosllh<InMessage>;
 
+    // Frames longer than 8K are not expected
+    using InBuffer = ublox::StreamFramer<32 * 1024, 8 * 1024>;
+
 public:
     explicit Session(const QString& dev);
     ~Session();
@@ -82,6 +86,6 @@ private:
 
     QSerialPort m_serial;
     QTimer m_pollTimer;
-    std::vector<std::uint8_t> m_inData;
+    InBuffer m_inData;
     ProtStack m_stack;
 };
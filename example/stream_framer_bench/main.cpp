@@ -0,0 +1,212 @@
+//
+// Copyright 2018 (C). Alex Robenko. All rights reserved.
+//
+
+// This file is free software: you can redistribute it and/or modify
+// it under the terms of the GNU General Public License as published by
+// the Free Software Foundation, either version 3 of the License, or
+// (at your option) any later version.
+//
+// This program is distributed in the hope that it will be useful,
+// but WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+// GNU General Public License for more details.
+//
+// You should have received a copy of the GNU General Public License
+// along with this program.  If not, see <http://www.gnu.org/licenses/>.
+
+// Compares the time spent splitting the input stream into frames using
+// std::vector with erase of the consumed prefix (as previously done by
+// the simple_pos example) and using ublox::StreamFramer. The stream is fed
+// in small reads (~1 ms of data at 921600 baud) and in large reads
+// (replay of recorded file).
+//
+// Usage: cc_ublox_stream_framer_bench_example [size_MiB] [repeat]
+
+#include <cstdint>
+#include <cstdlib>
+#include <algorithm>
+#include <chrono>
+#include <iostream>
+#include <iomanip>
+#include <memory>
+#include <vector>
+
+#include "ublox/StreamFramer.h"
+#include "ublox/protocol/ChecksumCalc.h"
+#include "ublox/protocol/FrameScanner.h"
+
+namespace
+{
+
+using Buffer = std::vector<std::uint8_t>;
+
+// 921600 baud, 8N1, 1 ms
+const std::size_t SerialReadLen = 92U;
+const std::size_t FileReadLen = 64U * 1024U;
+
+struct Result
+{
+    std::size_t m_frames = 0U;
+    std::size_t m_frameBytes = 0U;
+    unsigned m_checksums = 0U;
+
+    void add(const std::uint8_t* frame, std::size_t len)
+    {
+        ++m_frames;
+        m_frameBytes += len;
+        m_checksums += frame[len - 1U];
+    }
+
+    bool operator==(const Result& other) const
+    {
+        return
+            (m_frames == other.m_frames) &&
+            (m_frameBytes == other.m_frameBytes) &&
+            (m_checksums == other.m_checksums);
+    }
+};
+
+class VectorFramer
+{
+public:
+    void process(const std::uint8_t* data, std::size_t len, Result& result)
+    {
+        m_inData.insert(m_inData.end(), data, data + len);
+        std::size_t consumed = 0U;
+        while (consumed < m_inData.size()) {
+            auto scanResult = m_scanner.scan(&m_inData[0] + consumed, m_inData.size() - consumed);
+            consumed += scanResult.m_discarded;
+            if (scanResult.m_status != comms::ErrorStatus::Success) {
+                break;
+            }
+
+            result.add(scanResult.m_frame, scanResult.m_frameLen);
+            consumed += scanResult.m_frameLen;
+        }
+
+        m_inData.erase(m_inData.begin(), m_inData.begin() + consumed);
+    }
+
+private:
+    Buffer m_inData;
+    ublox::protocol::FrameScanner<> m_scanner;
+};
+
+class RingFramer
+{
+public:
+    void process(const std::uint8_t* data, std::size_t len, Result& result)
+    {
+        std::size_t pushed = 0U;
+        while (pushed < len) {
+            pushed += m_framer->push(data + pushed, len - pushed);
+            ublox::FrameSpan frame;
+            while (m_framer->nextFrame(frame)) {
+                result.add(frame.data(), frame.size());
+            }
+        }
+    }
+
+private:
+    using Framer = ublox::StreamFramer<256U * 1024U>;
+    std::unique_ptr<Framer> m_framer{new Framer};
+};
+
+void appendFrame(Buffer& data, std::uint8_t cls, std::uint8_t id, std::size_t payloadLen, std::uint32_t& seed)
+{
+    auto begin = data.size();
+    data.push_back(0xb5);
+    data.push_back(0x62);
+    data.push_back(cls);
+    data.push_back(id);
+    data.push_back(static_cast<std::uint8_t>(payloadLen));
+    data.push_back(static_cast<std::uint8_t>(payloadLen >> 8));
+    for (std::size_t idx = 0U; idx < payloadLen; ++idx) {
+        seed ^= seed << 13;
+        seed ^= seed >> 17;
+        seed ^= seed << 5;
+        data.push_back(static_cast<std::uint8_t>(seed));
+    }
+
+    const std::uint8_t* iter = &data[begin + 2U];
+    auto checksum = ublox::protocol::ChecksumCalc()(iter, data.size() - (begin + 2U));
+    data.push_back(static_cast<std::uint8_t>(checksum));
+    data.push_back(static_cast<std::uint8_t>(checksum >> 8));
+}
+
+// Typical output of the receiver: NAV-PVT, RXM-RAWX with 30 measurements,
+// NAV-SAT with 30 satellites and NMEA sentence every epoch
+Buffer makeStream(std::size_t size)
+{
+    static const char Nmea[] =
+        "$GNGGA,092725.00,4717.11399,N,00833.91590,E,1,08,1.01,499.6,M,48.0,M,,*5B\r\n";
+
+    Buffer data;
+    data.reserve(size + 4096U);
+    std::uint32_t seed = 0x12345678U;
+    while (data.size() < size) {
+        appendFrame(data, 0x01, 0x07, 92U, seed);
+        appendFrame(data, 0x02, 0x15, 16U + (30U * 32U), seed);
+        appendFrame(data, 0x01, 0x35, 8U + (30U * 12U), seed);
+        data.insert(data.end(), std::begin(Nmea), std::end(Nmea) - 1);
+    }
+    return data;
+}
+
+template <typename TFramer>
+Result measure(const char* name, const Buffer& data, std::size_t readLen, unsigned repeat)
+{
+    Result result;
+    auto start = std::chrono::steady_clock::now();
+    for (auto idx = 0U; idx < repeat; ++idx) {
+        TFramer framer;
+        result = Result();
+        for (std::size_t pos = 0U; pos < data.size(); pos += readLen) {
+            auto len = std::min(readLen, data.size() - pos);
+            framer.process(&data[pos], len, result);
+        }
+    }
+    auto duration = std::chrono::duration<double>(std::chrono::steady_clock::now() - start).count();
+    auto bytes = static_cast<double>(data.size()) * repeat;
+    auto frames = static_cast<double>(result.m_frames) * repeat;
+
+    std::cout << std::setw(8) << name << " (read " << std::setw(5) << readLen << " bytes): "
+              << std::fixed << std::setprecision(2) << (bytes / duration / 1e6) << " MB/s, "
+              << std::setprecision(1) << (duration / frames * 1e9) << " ns/frame"
+              << " (" << result.m_frames << " frames)" << std::endl;
+    return result;
+}
+
+} // namespace
+
+int main(int argc, char* argv[])
+{
+    std::size_t sizeMiB = 64U;
+    unsigned repeat = 5U;
+    if (1 < argc) {
+        sizeMiB = static_cast<std::size_t>(std::strtoul(argv[1], nullptr, 10));
+    }
+
+    if (2 < argc) {
+        repeat = static_cast<unsigned>(std::strtoul(argv[2], nullptr, 10));
+    }
+
+    if ((sizeMiB == 0U) || (repeat == 0U)) {
+        std::cerr << "Usage: " << argv[0] << " [size_MiB] [repeat]" << std::endl;
+        return -1;
+    }
+
+    auto data = makeStream(sizeMiB * 1024U * 1024U);
+    for (auto readLen : {SerialReadLen, FileReadLen}) {
+        auto expected = measure<VectorFramer>("vector", data, readLen, repeat);
+        auto result = measure<RingFramer>("framer", data, readLen, repeat);
+        if (!(result == expected)) {
+            std::cerr << "ERROR: Frames mismatch" << std::endl;
+            return -1;
+        }
+    }
+
+    return 0;
+}
+
@@ -0,0 +1,53 @@
+//
+// Copyright 2018 (C). Alex Robenko. All rights reserved.
+//
+
+// This file is free software: you can redistribute it and/or modify
+// it under the terms of the GNU General Public License as published by
+// the Free Software Foundation, either version 3 of the License, or
+// (at your option) any later version.
+//
+// This program is distributed in the hope that it will be useful,
+// but WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+// GNU General Public License for more details.
+//
+// You should have received a copy of the GNU General Public License
+// along with this program.  If not, see <http://www.gnu.org/licenses/>.
+
+/// @file
+/// @brief Contains definition of ublox::FrameSpan structure.
+
+#pragma once
+
+#include <cstdint>
+#include <cstddef>
+
+namespace ublox
+{
+
+/// @brief Contiguous view of the single complete UBX frame.
+struct FrameSpan
+{
+    /// @brief Pointer to the first sync character of the frame.
+    const std::uint8_t* m_data = nullptr;
+
+    /// @brief Full length of the frame, including sync characters and checksum.
+    std::size_t m_size = 0U;
+
+    /// @brief Pointer to the first sync character of the frame.
+    const std::uint8_t* data() const
+    {
+        return m_data;
+    }
+
+    /// @brief Full length of the frame.
+    std::size_t size() const
+    {
+        return m_size;
+    }
+};
+
+}  // namespace ublox
+
+
@@ -0,0 +1,154 @@
+//
+// Copyright 2018 (C). Alex Robenko. All rights reserved.
+//
+
+// This file is free software: you can redistribute it and/or modify
+// it under the terms of the GNU General Public License as published by
+// the Free Software Foundation, either version 3 of the License, or
+// (at your option) any later version.
+//
+// This program is distributed in the hope that it will be useful,
+// but WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+// GNU General Public License for more details.
+//
+// You should have received a copy of the GNU General Public License
+// along with this program.  If not, see <http://www.gnu.org/licenses/>.
+
+/// @file
+/// @brief Contains definition of ublox::writeFrame() function.
+
+#pragma once
+
+#include <cstdint>
+#include <cstddef>
+#include <limits>
+#include <type_traits>
+#include <utility>
+
+#include "comms/ErrorStatus.h"
+
+#include "MsgId.h"
+#include "protocol/ChecksumCalc.h"
+
+namespace ublox
+{
+
+namespace details
+{
+
+template <typename TMsg>
+struct FrameWriterIsStatic
+{
+    template <typename U>
+    static auto test(int) -> decltype(std::declval<const U&>().doGetId(), std::true_type());
+
+    template <typename>
+    static std::false_type test(...);
+
+    static const bool Value = decltype(test<TMsg>(0))::value;
+};
+
+template <bool TStatic>
+struct FrameWriterHelper;
+
+template <>
+struct FrameWriterHelper<true>
+{
+    template <typename TMsg>
+    static MsgId getId(const TMsg& msg)
+    {
+        return static_cast<MsgId>(msg.doGetId());
+    }
+
+    template <typename TMsg>
+    static comms::ErrorStatus writePayload(const TMsg& msg, std::uint8_t*& iter, std::size_t len)
+    {
+        return msg.doWrite(iter, len);
+    }
+};
+
+template <>
+struct FrameWriterHelper<false>
+{
+    template <typename TMsg>
+    static MsgId getId(const TMsg& msg)
+    {
+        return static_cast<MsgId>(msg.getId());
+    }
+
+    template <typename TMsg>
+    static comms::ErrorStatus writePayload(const TMsg& msg, std::uint8_t*& iter, std::size_t len)
+    {
+        return msg.write(iter, len);
+    }
+};
+
+} // namespace details
+
+/// @brief Serialise complete UBX frame of the message into contiguous buffer.
+/// @details Alternative to @b write() of @ref ublox::Stack, which doesn't
+///     require @b update() round trip. The header is written directly,
+///     the payload is serialised right after it, then the length is patched
+///     and the checksum is calculated over the bytes which are still
+///     hot in the cache and appended to the frame, i.e. no intermediate
+///     buffer and no second traversal of the protocol layers are required.@n
+///     When @b TMsg is the actual message class (defined using
+///     @b comms::MessageBase), its ID and fields are accessed directly
+///     without any virtual function call. When @b TMsg is the interface
+///     class, it is expected to be defined with @b comms::option::IdInfoInterface
+///     and <b>comms::option::WriteIterator&lt;std::uint8_t*&gt;</b> options.
+/// @param[in] msg Message to serialise.
+/// @param[in, out] iter Iterator used for writing, advanced past the
+///     written frame on success.
+/// @param[in] size Number of bytes available for writing.
+/// @return @b comms::ErrorStatus::Success in case of success,
+///     @b comms::ErrorStatus::BufferOverflow in case the buffer is
+///     too small, or any other error reported by the message itself.
+template <typename TMsg>
+comms::ErrorStatus writeFrame(const TMsg& msg, std::uint8_t*& iter, std::size_t size)
+{
+    static const std::size_t HeaderLen = 6U;
+    static const std::size_t ChecksumLen = 2U;
+    static const std::size_t MaxPayloadLen = std::numeric_limits<std::uint16_t>::max();
+
+    if (size < (HeaderLen + ChecksumLen)) {
+        return comms::ErrorStatus::BufferOverflow;
+    }
+
+    using Helper = details::FrameWriterHelper<details::FrameWriterIsStatic<TMsg>::Value>;
+
+    auto* frame = iter;
+    auto id = static_cast<unsigned>(Helper::getId(msg));
+    frame[0] = 0xb5;
+    frame[1] = 0x62;
+    frame[2] = static_cast<std::uint8_t>(id >> std::numeric_limits<std::uint8_t>::digits);
+    frame[3] = static_cast<std::uint8_t>(id);
+
+    auto payloadCapacity = size - (HeaderLen + ChecksumLen);
+    if (MaxPayloadLen < payloadCapacity) {
+        payloadCapacity = MaxPayloadLen;
+    }
+
+    auto* payloadIter = frame + HeaderLen;
+    auto es = Helper::writePayload(msg, payloadIter, payloadCapacity);
+    if (es != comms::ErrorStatus::Success) {
+        return es;
+    }
+
+    auto payloadLen = static_cast<std::size_t>(payloadIter - (frame + HeaderLen));
+    frame[4] = static_cast<std::uint8_t>(payloadLen);
+    frame[5] = static_cast<std::uint8_t>(payloadLen >> std::numeric_limits<std::uint8_t>::digits);
+
+    const std::uint8_t* checksumIter = frame + 2U;
+    auto checksum = protocol::ChecksumCalc()(checksumIter, (HeaderLen - 2U) + payloadLen);
+    payloadIter[0] = static_cast<std::uint8_t>(checksum);
+    payloadIter[1] = static_cast<std::uint8_t>(checksum >> std::numeric_limits<std::uint8_t>::digits);
+
+    iter = payloadIter + ChecksumLen;
+    return comms::ErrorStatus::Success;
+}
+
+}  // namespace ublox
+
+
@@ -20,9 +20,13 @@
 
 #pragma once
 
+#include <cstddef>
 #include <tuple>
+#include <type_traits>
 
 #include "Message.h"
+#include "option/DefaultOptions.h"
+#include "option/StaticStorage.h"
 
 #include "message/NavPosecef.h"
 #include "message/NavPosllh.h"
@@ -180,7 +184,9 @@ namespace ublox
 /// @brief All input messages (the ones that can be sent out from u-blox receiver)
 ///     are bundled in std::tuple.
 /// @tparam TMessage Common message interface class
-template <typename TMessage = Message>
+/// @tparam TOptions Extra options of the messages with list and/or string
+///     fields, see ublox::option::DefaultOptions.
+template <typename TMessage = Message, typename TOptions = option::DefaultOptions>
 using InputMessages =
     std::tuple<
         message::NavPosecef<TMessage>,
@@ -202,44 +208,44 @@ using InputMessages =
         message::NavTimebds<TMessage>,
         message::NavTimegal<TMessage>,
         message::NavTimels<TMessage>,
-        message::NavSvinfo<TMessage>,
-        message::NavDgps<TMessage>,
-        message::NavSbas<TMessage>,
-        message::NavOrb<TMessage>,
-        message::NavSat<TMessage>,
-        message::NavGeofence<TMessage>,
+        message::NavSvinfo<TMessage, typename TOptions::NavSvinfoData>,
+        message::NavDgps<TMessage, typename TOptions::NavDgpsData>,
+        message::NavSbas<TMessage, typename TOptions::NavSbasData>,
+        message::NavOrb<TMessage, typename TOptions::NavOrbData>,
+        message::NavSat<TMessage, typename TOptions::NavSatData>,
+        message::NavGeofence<TMessage, typename TOptions::NavGeofenceData>,
         message::NavSvin<TMessage>,
         message::NavRelposned<TMessage>,
         message::NavEkfstatus<TMessage>,
         message::NavAopstatus<TMessage>,
         message::NavAopstatusU8<TMessage>,
-        message::RxmRaw<TMessage>,
-        message::RxmSfrb<TMessage>,
-        message::RxmSfrbx<TMessage>,
-        message::RxmMeasx<TMessage>,
-        message::RxmRawx<TMessage>,
-        message::RxmSvsi<TMessage>,
-        message::RxmAlm<TMessage>,
-        message::RxmEph<TMessage>,
+        message::RxmRaw<TMessage, typename TOptions::RxmRawData>,
+        message::RxmSfrb<TMessage, typename TOptions::RxmSfrbDwrd>,
+        message::RxmSfrbx<TMessage, typename TOptions::RxmSfrbxDwrd>,
+        message::RxmMeasx<TMessage, typename TOptions::RxmMeasxData>,
+        message::RxmRawx<TMessage, typename TOptions::RxmRawxData>,
+        message::RxmSvsi<TMessage, typename TOptions::RxmSvsiData>,
+        message::RxmAlm<TMessage, typename TOptions::RxmAlmDwrd>,
+        message::RxmEph<TMessage, typename TOptions::RxmEphSf>,
         message::RxmRtcm<TMessage>,
         message::RxmRlmShort<TMessage>,
         message::RxmRlmLong<TMessage>,
-        message::RxmImes<TMessage>,
-        message::InfError<TMessage>,
-        message::InfWarning<TMessage>,
-        message::InfNotice<TMessage>,
-        message::InfTest<TMessage>,
-        message::InfDebug<TMessage>,
+        message::RxmImes<TMessage, typename TOptions::RxmImesData>,
+        message::InfError<TMessage, typename TOptions::InfErrorStr>,
+        message::InfWarning<TMessage, typename TOptions::InfWarningStr>,
+        message::InfNotice<TMessage, typename TOptions::InfNoticeStr>,
+        message::InfTest<TMessage, typename TOptions::InfTestStr>,
+        message::InfDebug<TMessage, typename TOptions::InfDebugStr>,
         message::AckNak<TMessage>,
         message::AckAck<TMessage>,
         message::CfgPrtUart<TMessage>,
         message::CfgPrtUsb<TMessage>,
         message::CfgPrtSpi<TMessage>,
         message::CfgPrtDdc<TMessage>,
-        message::CfgMsg<TMessage>,
+        message::CfgMsg<TMessage, typename TOptions::CfgMsgRate>,
         message::CfgMsgCurrent<TMessage>,
-        message::CfgInf<TMessage>,
-        message::CfgDat<TMessage>,
+        message::CfgInf<TMessage, typename TOptions::CfgInfList, typename TOptions::CfgInfInfMsgMask>,
+        message::CfgDat<TMessage, typename TOptions::CfgDatDatumName>,
         message::CfgTp<TMessage>,
         message::CfgRate<TMessage>,
         message::CfgFxn<TMessage>,
@@ -249,7 +255,7 @@ using InputMessages =
         message::CfgSbas<TMessage>,
         message::CfgNmeaExt<TMessage>,
         message::CfgNmea<TMessage>,
-        message::CfgUsb<TMessage>,
+        message::CfgUsb<TMessage, typename TOptions::CfgUsbStrs>,
         message::CfgTmode<TMessage>,
         message::CfgOdo<TMessage>,
         message::CfgNavx5<TMessage>,
@@ -257,41 +263,41 @@ using InputMessages =
         message::CfgEsfgwt<TMessage>,
         message::CfgTp5<TMessage>,
         message::CfgPm<TMessage>,
-        message::CfgRinv<TMessage>,
+        message::CfgRinv<TMessage, typename TOptions::CfgRinvData>,
         message::CfgItfm<TMessage>,
         message::CfgPm2<TMessage>,
         message::CfgTmode2<TMessage>,
-        message::CfgGnss<TMessage>,
+        message::CfgGnss<TMessage, typename TOptions::CfgGnssBlocksList>,
         message::CfgLogfilter<TMessage>,
         message::CfgHnr<TMessage>,
-        message::CfgEsrc<TMessage>,
-        message::CfgDosc<TMessage>,
+        message::CfgEsrc<TMessage, typename TOptions::CfgEsrcData>,
+        message::CfgDosc<TMessage, typename TOptions::CfgDoscData>,
         message::CfgSmgr<TMessage>,
-        message::CfgGeofence<TMessage>,
+        message::CfgGeofence<TMessage, typename TOptions::CfgGeofenceData>,
         message::CfgDgnss<TMessage>,
         message::CfgTmode3<TMessage>,
         message::CfgPms<TMessage>,
         message::UpdSosRestored<TMessage>,
         message::UpdSosAck<TMessage>,
-        message::MonIo<TMessage>,
-        message::MonVer<TMessage>,
-        message::MonMsgpp<TMessage>,
-        message::MonRxbuf<TMessage>,
-        message::MonTxbuf<TMessage>,
-        message::MonHw<TMessage>,
+        message::MonIo<TMessage, typename TOptions::MonIoData>,
+        message::MonVer<TMessage, typename TOptions::MonVerSwVer, typename TOptions::MonVerHwVer, typename TOptions::MonVerExtStr, typename TOptions::MonVerExtList>,
+        message::MonMsgpp<TMessage, typename TOptions::MonMsgppMsg, typename TOptions::MonMsgppSkipped>,
+        message::MonRxbuf<TMessage, typename TOptions::MonRxbufLists>,
+        message::MonTxbuf<TMessage, typename TOptions::MonTxbufLists>,
+        message::MonHw<TMessage, typename TOptions::MonHwVp>,
         message::MonHw2<TMessage>,
         message::MonRxr<TMessage>,
-        message::MonPatch<TMessage>,
+        message::MonPatch<TMessage, typename TOptions::MonPatchData>,
         message::MonGnss<TMessage>,
         message::MonSmgr<TMessage>,
         message::AidIni<TMessage>,
         message::AidHui<TMessage>,
-        message::AidAlm<TMessage>,
-        message::AidEph<TMessage>,
-        message::AidAlpsrv<TMessage>,
-        message::AidAlpsrvUpdate<TMessage>,
-        message::AidAopU8<TMessage>,
-        message::AidAop<TMessage>,
+        message::AidAlm<TMessage, typename TOptions::AidAlmDwrd>,
+        message::AidEph<TMessage, typename TOptions::AidEphSf>,
+        message::AidAlpsrv<TMessage, typename TOptions::AidAlpsrvData>,
+        message::AidAlpsrvUpdate<TMessage, typename TOptions::AidAlpsrvUpdateData>,
+        message::AidAopU8<TMessage, typename TOptions::AidAopU8Data>,
+        message::AidAop<TMessage, typename TOptions::AidAopData, typename TOptions::AidAopOptional>,
         message::AidAlp<TMessage>,
         message::AidAlpStatus<TMessage>,
         message::TimTp<TMessage>,
@@ -300,24 +306,105 @@ using InputMessages =
         message::TimVrfy<TMessage>,
         message::TimDosc<TMessage>,
         message::TimTos<TMessage>,
-        message::TimSmeas<TMessage>,
+        message::TimSmeas<TMessage, typename TOptions::TimSmeasData>,
         message::TimVcocal<TMessage>,
         message::TimFchg<TMessage>,
-        message::EsfMeas<TMessage>,
-        message::EsfRaw<TMessage>,
-        message::EsfStatus<TMessage>,
+        message::EsfMeas<TMessage, typename TOptions::EsfMeasData>,
+        message::EsfRaw<TMessage, typename TOptions::EsfRawList>,
+        message::EsfStatus<TMessage, typename TOptions::EsfStatusData>,
         message::EsfIns<TMessage>,
         message::MgaFlashAck<TMessage>,
         message::MgaAck<TMessage>,
-        message::MgaDbd<TMessage>,
+        message::MgaDbd<TMessage, typename TOptions::MgaDbdData>,
         message::LogInfo<TMessage>,
         message::LogRetrievepos<TMessage>,
-        message::LogRetrievestring<TMessage>,
+        message::LogRetrievestring<TMessage, typename TOptions::LogRetrievestringBytes>,
         message::LogFindtime<TMessage>,
         message::LogRetrieveposextra<TMessage>,
-        message::SecSign<TMessage>,
-        message::SecUniqid<TMessage>,
+        message::SecSign<TMessage, typename TOptions::SecSignHash>,
+        message::SecUniqid<TMessage, typename TOptions::SecUniqidUniqueId>,
         message::HnrPvt<TMessage>
     >;
 
+/// @brief Same as ublox::InputMessages, but all the list and string
+///     fields use fixed size storage (see ublox::option::StaticStorage),
+///     i.e. the read of the message doesn't involve any dynamic memory
+///     allocation.
+/// @tparam TMessage Common message interface class
+template <typename TMessage = Message>
+using StaticInputMessages = InputMessages<TMessage, option::StaticStorage>;
+
+namespace details
+{
+
+template <typename T>
+struct MsgTypeTag
+{
+};
+
+template <typename TMessages>
+struct MsgTypeSet;
+
+template <typename... TMessages>
+struct MsgTypeSet<std::tuple<TMessages...> > : public MsgTypeTag<TMessages>...
+{
+};
+
+template <std::size_t... TValues>
+struct MaxValueOf;
+
+template <>
+struct MaxValueOf<>
+{
+    static const std::size_t Value = 0U;
+};
+
+template <std::size_t TFirst, std::size_t... TRest>
+struct MaxValueOf<TFirst, TRest...>
+{
+    static const std::size_t Value =
+        (MaxValueOf<TRest...>::Value < TFirst) ? TFirst : MaxValueOf<TRest...>::Value;
+};
+
+template <typename TMessage, typename TMsg>
+struct MsgMaxPayloadLen
+{
+    // The message types of ublox::StaticInputMessages bundle (including
+    // the fixed length ones, shared with any other bundle) use
+    // fixed size storage.
+    static const std::size_t Value =
+        std::is_base_of<MsgTypeTag<TMsg>, MsgTypeSet<StaticInputMessages<TMessage> > >::value ?
+            option::StaticStorage::MaxPayloadLen :
+            option::DefaultOptions::MaxPayloadLen;
+};
+
+template <typename TMessage, typename TMessages>
+struct MaxPayloadLenOfTuple;
+
+template <typename TMessage, typename... TMessages>
+struct MaxPayloadLenOfTuple<TMessage, std::tuple<TMessages...> >
+{
+    static const std::size_t Value =
+        MaxValueOf<MsgMaxPayloadLen<TMessage, TMessages>::Value...>::Value;
+};
+
+} // namespace details
+
+/// @brief Maximal payload length the message objects of the bundle can hold.
+/// @details The @b Value is the maximum over all the message types of the
+///     bundle: ublox::option::StaticStorage::MaxPayloadLen for the types
+///     of the ublox::StaticInputMessages bundle, and
+///     ublox::option::DefaultOptions::MaxPayloadLen for any other one.
+///     Hence any subset of ublox::StaticInputMessages is limited
+///     the same way as the whole bundle.
+/// @tparam TMessage Common message interface class
+/// @tparam TMessages Messages bundled in @b std::tuple
+template <typename TMessage, typename TMessages>
+struct MaxPayloadLenOf
+{
+    /// @brief Maximal payload length
+    static const std::size_t Value =
+        details::MaxPayloadLenOfTuple<TMessage, TMessages>::Value;
+};
+
 }  // namespace ublox
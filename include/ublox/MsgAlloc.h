@@ -0,0 +1,278 @@
+//
+// Copyright 2018 (C). Alex Robenko. All rights reserved.
+//
+
+// This file is free software: you can redistribute it and/or modify
+// it under the terms of the GNU General Public License as published by
+// the Free Software Foundation, either version 3 of the License, or
+// (at your option) any later version.
+//
+// This program is distributed in the hope that it will be useful,
+// but WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+// GNU General Public License for more details.
+//
+// You should have received a copy of the GNU General Public License
+// along with this program.  If not, see <http://www.gnu.org/licenses/>.
+
+/// @file
+/// @brief Contains definition of message allocators used by ublox::MsgFactoryTable.
+
+#pragma once
+
+#include <cstdint>
+#include <cstddef>
+#include <array>
+#include <memory>
+#include <new>
+#include <tuple>
+#include <type_traits>
+
+namespace ublox
+{
+
+/// @brief Statistics of the message allocator.
+/// @details The allocator is aware of the message objects only. The fields
+///     of the allocated messages may still use dynamic memory allocation
+///     internally (for example lists and strings with default storage
+///     options), and such allocations are not reflected in any of the
+///     counters. Use ublox::StaticInputMessages bundle to make sure the
+///     fields don't allocate.
+struct MsgAllocStats
+{
+    std::size_t m_allocCount = 0U; ///< Number of successful allocations
+    std::size_t m_releaseCount = 0U; ///< Number of released messages
+    std::size_t m_failCount = 0U; ///< Number of failed allocations
+    std::size_t m_heapAllocCount = 0U; ///< Number of message objects allocated on the heap (field storage is not counted)
+    std::size_t m_inUse = 0U; ///< Number of currently allocated messages
+    std::size_t m_peakInUse = 0U; ///< Maximal number of simultaneously allocated messages
+};
+
+namespace details
+{
+
+template <typename TMessages>
+struct MsgAllocMaxSize;
+
+template <>
+struct MsgAllocMaxSize<std::tuple<> >
+{
+    static const std::size_t Size = 1U;
+    static const std::size_t Align = 1U;
+};
+
+template <typename TFirst, typename... TRest>
+struct MsgAllocMaxSize<std::tuple<TFirst, TRest...> >
+{
+    using RestMax = MsgAllocMaxSize<std::tuple<TRest...> >;
+
+    static const std::size_t Size =
+        (RestMax::Size < sizeof(TFirst)) ? sizeof(TFirst) : RestMax::Size;
+
+    static const std::size_t Align =
+        (RestMax::Align < alignof(TFirst)) ? alignof(TFirst) : RestMax::Align;
+};
+
+inline void msgAllocRecord(MsgAllocStats& stats)
+{
+    ++stats.m_allocCount;
+    ++stats.m_inUse;
+    if (stats.m_peakInUse < stats.m_inUse) {
+        stats.m_peakInUse = stats.m_inUse;
+    }
+}
+
+inline void msgReleaseRecord(MsgAllocStats& stats)
+{
+    ++stats.m_releaseCount;
+    --stats.m_inUse;
+}
+
+} // namespace details
+
+/// @brief Message allocator using dynamic memory allocation.
+/// @details Every message object is allocated using @b new operator and
+///     deleted when released. Only the allocation of the message object
+///     itself is recorded in @ref MsgAllocStats::m_heapAllocCount.
+///     The allocator must outlive all the messages it has allocated.
+/// @tparam TMsgBase Common interface class for all the messages.
+template <typename TMsgBase>
+class HeapMsgAlloc
+{
+public:
+    /// @brief Deleter of the message objects.
+    class Deleter
+    {
+    public:
+        /// @brief Constructor
+        explicit Deleter(MsgAllocStats* stats = nullptr)
+          : m_stats(stats)
+        {
+        }
+
+        /// @brief Delete the message object.
+        void operator()(TMsgBase* msg) const
+        {
+            if (m_stats != nullptr) {
+                details::msgReleaseRecord(*m_stats);
+            }
+            delete msg;
+        }
+
+    private:
+        MsgAllocStats* m_stats = nullptr;
+    };
+
+    /// @brief Smart pointer to the allocated message object.
+    using MsgPtr = std::unique_ptr<TMsgBase, Deleter>;
+
+    /// @brief Default constructor
+    HeapMsgAlloc() = default;
+
+    /// @brief Copy constructor is deleted
+    HeapMsgAlloc(const HeapMsgAlloc&) = delete;
+
+    /// @brief Copy assignment is deleted
+    HeapMsgAlloc& operator=(const HeapMsgAlloc&) = delete;
+
+    /// @brief Allocate message object.
+    template <typename TMsg>
+    MsgPtr alloc()
+    {
+        details::msgAllocRecord(m_stats);
+        ++m_stats.m_heapAllocCount;
+        return MsgPtr(new TMsg(), Deleter(&m_stats));
+    }
+
+    /// @brief Get allocation statistics.
+    const MsgAllocStats& stats() const
+    {
+        return m_stats;
+    }
+
+private:
+    MsgAllocStats m_stats;
+};
+
+/// @brief Message allocator using preallocated pool of memory slots.
+/// @details Every slot is big enough to contain the largest message in
+///     @b TMessages. The message object is constructed in the free slot
+///     and the slot is returned to the pool when the smart pointer to the
+///     message is reset or destructed, i.e. when @b TSize is @b 1 the same
+///     memory is reused for every frame, as long as the previous message
+///     has been released. When all the slots are in use, the allocation
+///     fails (empty pointer is returned).
+///     No dynamic memory allocation is performed.
+///     The pool must outlive all the messages it has allocated.
+/// @tparam TMsgBase Common interface class for all the messages.
+/// @tparam TMessages All the message types that can be allocated, bundled
+///     in @b std::tuple.
+/// @tparam TSize Number of slots, i.e. maximal number of simultaneously
+///     allocated messages.
+template <typename TMsgBase, typename TMessages, std::size_t TSize = 1U>
+class MsgPool
+{
+    using MaxSize = details::MsgAllocMaxSize<TMessages>;
+
+public:
+    /// @brief Number of slots.
+    static const std::size_t Size = TSize;
+
+    /// @brief Size of a single slot.
+    static const std::size_t SlotSize = MaxSize::Size;
+
+    static_assert(0U < TSize, "The pool must contain at least one slot");
+
+    /// @brief Deleter of the message objects.
+    class Deleter
+    {
+    public:
+        /// @brief Constructor
+        explicit Deleter(MsgPool* pool = nullptr, std::size_t slot = 0U)
+          : m_pool(pool),
+            m_slot(slot)
+        {
+        }
+
+        /// @brief Destruct the message object and return its slot to the pool.
+        void operator()(TMsgBase* msg) const
+        {
+            if (m_pool != nullptr) {
+                m_pool->release(msg, m_slot);
+            }
+        }
+
+    private:
+        MsgPool* m_pool = nullptr;
+        std::size_t m_slot = 0U;
+    };
+
+    /// @brief Smart pointer to the allocated message object.
+    using MsgPtr = std::unique_ptr<TMsgBase, Deleter>;
+
+    /// @brief Default constructor
+    MsgPool()
+    {
+        for (std::size_t idx = 0U; idx < TSize; ++idx) {
+            m_free[idx] = TSize - idx - 1U;
+        }
+    }
+
+    /// @brief Copy constructor is deleted
+    MsgPool(const MsgPool&) = delete;
+
+    /// @brief Copy assignment is deleted
+    MsgPool& operator=(const MsgPool&) = delete;
+
+    /// @brief Allocate message object.
+    /// @return Pointer to allocated message, empty one if all the slots are in use.
+    template <typename TMsg>
+    MsgPtr alloc()
+    {
+        static_assert(sizeof(TMsg) <= SlotSize, "The message type is not in TMessages");
+        static_assert(alignof(TMsg) <= MaxSize::Align, "The message type is not in TMessages");
+
+        if (m_freeCount == 0U) {
+            ++m_stats.m_failCount;
+            return MsgPtr();
+        }
+
+        --m_freeCount;
+        auto slot = m_free[m_freeCount];
+        auto* msg = new (&m_slots[slot]) TMsg();
+        details::msgAllocRecord(m_stats);
+        return MsgPtr(msg, Deleter(this, slot));
+    }
+
+    /// @brief Number of free slots.
+    std::size_t freeCount() const
+    {
+        return m_freeCount;
+    }
+
+    /// @brief Get allocation statistics.
+    const MsgAllocStats& stats() const
+    {
+        return m_stats;
+    }
+
+private:
+    using Slot = typename std::aligned_storage<SlotSize, MaxSize::Align>::type;
+
+    void release(TMsgBase* msg, std::size_t slot)
+    {
+        msg->~TMsgBase();
+        m_free[m_freeCount] = slot;
+        ++m_freeCount;
+        details::msgReleaseRecord(m_stats);
+    }
+
+    std::array<Slot, TSize> m_slots;
+    std::array<std::size_t, TSize> m_free;
+    std::size_t m_freeCount = TSize;
+    MsgAllocStats m_stats;
+};
+
+}  // namespace ublox
+
+
@@ -0,0 +1,185 @@
+//
+// Copyright 2018 (C). Alex Robenko. All rights reserved.
+//
+
+// This file is free software: you can redistribute it and/or modify
+// it under the terms of the GNU General Public License as published by
+// the Free Software Foundation, either version 3 of the License, or
+// (at your option) any later version.
+//
+// This program is distributed in the hope that it will be useful,
+// but WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+// GNU General Public License for more details.
+//
+// You should have received a copy of the GNU General Public License
+// along with this program.  If not, see <http://www.gnu.org/licenses/>.
+
+/// @file
+/// @brief Contains definition of discriminators between the messages sharing
+///     the same ID.
+
+#pragma once
+
+#include <cstdint>
+#include <cstddef>
+#include <limits>
+#include <type_traits>
+
+namespace ublox
+{
+
+/// @brief Discriminators between the messages sharing the same ID.
+/// @details Every discriminator defines the following static member function,
+///     which checks the raw payload before any field is read:
+///     @code
+///     static bool match(const std::uint8_t* payload, std::size_t len);
+///     @endcode
+namespace discriminator
+{
+
+/// @brief Payload length used as "unlimited" upper boundary.
+static const std::size_t UnlimitedLen = std::numeric_limits<std::size_t>::max();
+
+/// @brief Matches any payload.
+struct Any
+{
+    /// @brief Check the payload.
+    static bool match(const std::uint8_t* payload, std::size_t len)
+    {
+        static_cast<void>(payload);
+        static_cast<void>(len);
+        return true;
+    }
+};
+
+/// @brief Matches payload of the length within the provided range.
+/// @tparam TMinLen Minimal payload length.
+/// @tparam TMaxLen Maximal payload length.
+template <std::size_t TMinLen, std::size_t TMaxLen = TMinLen>
+struct PayloadLen
+{
+    /// @brief Check the payload.
+    static bool match(const std::uint8_t* payload, std::size_t len)
+    {
+        static_cast<void>(payload);
+        return (len - TMinLen) <= (TMaxLen - TMinLen);
+    }
+};
+
+/// @brief Matches payload which has a byte with value within the provided
+///     range at the specified offset.
+/// @tparam TOffset Offset of the byte in the payload.
+/// @tparam TMinValue Minimal value of the byte.
+/// @tparam TMaxValue Maximal value of the byte.
+template <std::size_t TOffset, std::uint8_t TMinValue, std::uint8_t TMaxValue = TMinValue>
+struct ByteValue
+{
+    /// @brief Check the payload.
+    static bool match(const std::uint8_t* payload, std::size_t len)
+    {
+        return
+            (TOffset < len) &&
+            ((static_cast<unsigned>(payload[TOffset]) - TMinValue) <=
+                static_cast<unsigned>(TMaxValue - TMinValue));
+    }
+};
+
+/// @brief Matches payload when all the provided discriminators match it.
+template <typename... TDiscriminators>
+struct AllOf;
+
+/// @cond SKIP_DOC
+template <>
+struct AllOf<>
+{
+    static bool match(const std::uint8_t* payload, std::size_t len)
+    {
+        return Any::match(payload, len);
+    }
+};
+
+template <typename TFirst, typename... TRest>
+struct AllOf<TFirst, TRest...>
+{
+    static bool match(const std::uint8_t* payload, std::size_t len)
+    {
+        return TFirst::match(payload, len) && AllOf<TRest...>::match(payload, len);
+    }
+};
+/// @endcond
+
+} // namespace discriminator
+
+namespace details
+{
+
+template <typename TMsg>
+struct HasDeclaredDiscriminator
+{
+    template <typename U>
+    static std::true_type test(typename U::Discriminator*);
+
+    template <typename U>
+    static std::false_type test(...);
+
+    static const bool Value = decltype(test<TMsg>(nullptr))::value;
+};
+
+template <typename TMsg, bool THasDeclared>
+struct DeclaredDiscriminator
+{
+    using Type = discriminator::Any;
+};
+
+template <typename TMsg>
+struct DeclaredDiscriminator<TMsg, true>
+{
+    using Type = typename TMsg::Discriminator;
+};
+
+template <typename TMsg>
+struct LengthDiscriminator
+{
+    static const std::size_t MinLen = TMsg::doMinLength();
+    static const std::size_t MaxLen = TMsg::doMaxLength();
+
+    // Variable length fields may report huge maximal length, rely on
+    // the maximal length only when the message has fixed length.
+    using Type =
+        discriminator::PayloadLen<
+            MinLen,
+            (MinLen == MaxLen) ? MaxLen : discriminator::UnlimitedLen
+        >;
+};
+
+} // namespace details
+
+/// @brief Discriminator of the message type among the ones sharing the same ID.
+/// @details Combines the payload length check, derived from the minimal and
+///     maximal serialisation length of the message fields, with the
+///     discriminator declared by the message class itself as the internal
+///     @b Discriminator type (if such exists). For example
+///     @code
+///     using Discriminator = ublox::discriminator::ByteValue<0, 1>;
+///     @endcode
+///     declares that the first byte of the payload is always @b 1.
+/// @tparam TMsg Message type, expected to be defined using @b comms::MessageBase
+///     with @b comms::option::FieldsImpl option.
+template <typename TMsg>
+struct MsgDiscriminator
+{
+    /// @brief Type of the discriminator
+    using Type =
+        discriminator::AllOf<
+            typename details::LengthDiscriminator<TMsg>::Type,
+            typename details::DeclaredDiscriminator<
+                TMsg,
+                details::HasDeclaredDiscriminator<TMsg>::Value
+            >::Type
+        >;
+};
+
+}  // namespace ublox
+
+
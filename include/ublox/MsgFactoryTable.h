@@ -0,0 +1,310 @@
+//
+// Copyright 2018 (C). Alex Robenko. All rights reserved.
+//
+
+// This file is free software: you can redistribute it and/or modify
+// it under the terms of the GNU General Public License as published by
+// the Free Software Foundation, either version 3 of the License, or
+// (at your option) any later version.
+//
+// This program is distributed in the hope that it will be useful,
+// but WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+// GNU General Public License for more details.
+//
+// You should have received a copy of the GNU General Public License
+// along with this program.  If not, see <http://www.gnu.org/licenses/>.
+
+/// @file
+/// @brief Contains definition of ublox::MsgFactoryTable class.
+
+#pragma once
+
+#include <cstdint>
+#include <cstddef>
+#include <tuple>
+#include <utility>
+#include <memory>
+#include <type_traits>
+
+#include "comms/comms.h"
+
+#include "MsgId.h"
+#include "details/MsgIdTable.h"
+#include "MsgDiscriminator.h"
+#include "MsgAlloc.h"
+
+namespace ublox
+{
+
+namespace details
+{
+
+/// @brief Retrieve numeric ID of the message type at compile time.
+template <typename TMsg>
+struct MsgIdOf
+{
+    static constexpr ublox::MsgId Value = static_cast<ublox::MsgId>(TMsg::ImplOptions::MsgId);
+};
+
+/// @brief Range of the message types sharing the same ID.
+struct MsgFactoryEntry
+{
+    std::uint16_t m_first; ///< Index of the first type in the messages tuple
+    std::uint16_t m_count; ///< Number of types
+};
+
+template <std::size_t... TIndices>
+struct MsgFactoryIndices
+{
+};
+
+template <std::size_t TCount, std::size_t... TIndices>
+struct MakeMsgFactoryIndices : public MakeMsgFactoryIndices<TCount - 1U, TCount - 1U, TIndices...>
+{
+};
+
+template <std::size_t... TIndices>
+struct MakeMsgFactoryIndices<0U, TIndices...>
+{
+    using Type = MsgFactoryIndices<TIndices...>;
+};
+
+template <typename TAlloc, typename TMessages>
+struct MsgFactoryTableHelper;
+
+template <typename TAlloc, typename... TMessages>
+struct MsgFactoryTableHelper<TAlloc, std::tuple<TMessages...> >
+{
+    using MsgPtr = typename TAlloc::MsgPtr;
+    using CreateFunc = MsgPtr (*)(TAlloc&);
+    using MatchFunc = bool (*)(const std::uint8_t*, std::size_t);
+
+    static const std::size_t Count = sizeof...(TMessages);
+
+    template <typename TMsg>
+    static MsgPtr create(TAlloc& alloc)
+    {
+        return alloc.template alloc<TMsg>();
+    }
+
+    static constexpr ublox::MsgId Ids[Count] = {MsgIdOf<TMessages>::Value...};
+    static constexpr CreateFunc Funcs[Count] = {&MsgFactoryTableHelper::template create<TMessages>...};
+    static constexpr MatchFunc MatchFuncs[Count] = {&MsgDiscriminator<TMessages>::Type::match...};
+
+    // Index of the first type with the ID starting from the provided one, Count if none
+    static constexpr std::size_t find(ublox::MsgId id, std::size_t from)
+    {
+        return
+            (Count <= from) ? Count :
+            (Ids[from] == id) ? from :
+            find(id, from + 1U);
+    }
+
+    static constexpr std::size_t count(ublox::MsgId id, std::size_t from)
+    {
+        return
+            (Count <= from) ? 0U :
+            (((Ids[from] == id) ? 1U : 0U) + count(id, from + 1U));
+    }
+
+    static constexpr bool allKnown(std::size_t from)
+    {
+        return (Count <= from) || ((knownMsgIdIndex(Ids[from]) != 0U) && allKnown(from + 1U));
+    }
+
+    // Entry 0 is used for unknown IDs
+    static constexpr MsgFactoryEntry entry(std::size_t knownIdx)
+    {
+        return
+            (knownIdx == 0U) ? MsgFactoryEntry{0U, 0U} :
+            MsgFactoryEntry{
+                static_cast<std::uint16_t>(find(MsgIdTableData<>::KnownIds[knownIdx - 1U], 0U)),
+                static_cast<std::uint16_t>(count(MsgIdTableData<>::KnownIds[knownIdx - 1U], 0U))};
+    }
+
+    template <typename TIndices>
+    struct Tables;
+
+    template <std::size_t... TKnownIndices, std::size_t... TMsgIndices>
+    struct Tables<std::pair<MsgFactoryIndices<TKnownIndices...>, MsgFactoryIndices<TMsgIndices...> > >
+    {
+        // Indexed by the known ID index (see ublox::details::knownMsgIdIndex())
+        static constexpr MsgFactoryEntry Entries[sizeof...(TKnownIndices)] = {entry(TKnownIndices)...};
+
+        // Index of the next type with the same ID
+        static constexpr std::uint16_t Next[Count] = {
+            static_cast<std::uint16_t>(find(Ids[TMsgIndices], TMsgIndices + 1U))...
+        };
+    };
+
+    using AllTables =
+        Tables<
+            std::pair<
+                typename MakeMsgFactoryIndices<KnownMsgIdsCount + 1U>::Type,
+                typename MakeMsgFactoryIndices<Count>::Type
+            >
+        >;
+};
+
+template <typename TMsg>
+constexpr ublox::MsgId MsgIdOf<TMsg>::Value;
+
+template <typename TAlloc, typename... TMessages>
+constexpr ublox::MsgId MsgFactoryTableHelper<TAlloc, std::tuple<TMessages...> >::Ids[];
+
+template <typename TAlloc, typename... TMessages>
+constexpr typename MsgFactoryTableHelper<TAlloc, std::tuple<TMessages...> >::CreateFunc
+MsgFactoryTableHelper<TAlloc, std::tuple<TMessages...> >::Funcs[];
+
+template <typename TAlloc, typename... TMessages>
+constexpr typename MsgFactoryTableHelper<TAlloc, std::tuple<TMessages...> >::MatchFunc
+MsgFactoryTableHelper<TAlloc, std::tuple<TMessages...> >::MatchFuncs[];
+
+template <typename TAlloc, typename... TMessages>
+template <std::size_t... TKnownIndices, std::size_t... TMsgIndices>
+constexpr MsgFactoryEntry
+MsgFactoryTableHelper<TAlloc, std::tuple<TMessages...> >::Tables<
+    std::pair<MsgFactoryIndices<TKnownIndices...>, MsgFactoryIndices<TMsgIndices...> > >::Entries[];
+
+template <typename TAlloc, typename... TMessages>
+template <std::size_t... TKnownIndices, std::size_t... TMsgIndices>
+constexpr std::uint16_t
+MsgFactoryTableHelper<TAlloc, std::tuple<TMessages...> >::Tables<
+    std::pair<MsgFactoryIndices<TKnownIndices...>, MsgFactoryIndices<TMsgIndices...> > >::Next[];
+
+} // namespace details
+
+/// @brief Direct dispatch table used to create message objects by their ID.
+/// @details Serves as alternative to the sorted search performed by
+///     @b comms::protocol::MsgIdLayer. The factory functions for all the
+///     message types are generated at compile time. The ID is resolved
+///     using the two level table of all the known message IDs (class ID
+///     selects the row, message ID within the class selects the entry, see
+///     @b ublox/details/MsgIdTable.h), and the range of the message types
+///     with such ID is computed at compile time as well. All the tables
+///     are constant initialised, nothing is built at run time,
+///     so the message creation is O(1) regardless of amount of message
+///     types. Every message type is expected to have one of the IDs listed
+///     in ublox::MsgId.@n
+///     The messages sharing the same ID are kept in the order of their
+///     appearance in @b TMessages tuple. The raw payload can be checked
+///     against the discriminator of each such message type
+///     (see @ref ublox::MsgDiscriminator) before the message object is
+///     created.@n
+///     The message objects are allocated by the @b TAlloc allocator
+///     owned by the factory, so the factory must outlive all the messages it
+///     has created.
+/// @tparam TMsgBase Common interface class for all the messages.
+/// @tparam TMessages All the message types bundled in @b std::tuple. Every type
+///     is expected to be defined using @b comms::option::StaticNumIdImpl option.
+/// @tparam TAlloc Message allocator, either @ref ublox::HeapMsgAlloc (default)
+///     or @ref ublox::MsgPool.
+template <
+    typename TMsgBase,
+    typename TMessages,
+    typename TAlloc = HeapMsgAlloc<TMsgBase> >
+class MsgFactoryTable
+{
+    using Helper = details::MsgFactoryTableHelper<TAlloc, TMessages>;
+
+public:
+    /// @brief Type of the message allocator.
+    using Allocator = TAlloc;
+
+    /// @brief Smart pointer to the allocated message object.
+    using MsgPtr = typename Helper::MsgPtr;
+
+    /// @brief Number of supported message types.
+    static const std::size_t NumOfMessages = std::tuple_size<TMessages>::value;
+
+    static_assert(NumOfMessages <= 0xffff, "Too many messages");
+
+    /// @brief Create message object.
+    /// @param[in] id ID of the message.
+    /// @param[in] idx Index of the message type among the ones sharing the same ID.
+    /// @return Allocated message object, empty pointer if such message
+    ///     is not supported or the allocation has failed.
+    MsgPtr createMsg(ublox::MsgId id, unsigned idx = 0U)
+    {
+        auto msgIdx = typeIdx(id, idx);
+        if (NumOfMessages <= msgIdx) {
+            return MsgPtr();
+        }
+
+        return Helper::Funcs[msgIdx](m_alloc);
+    }
+
+    /// @brief Access the message allocator.
+    Allocator& allocator()
+    {
+        return m_alloc;
+    }
+
+    /// @brief Access the message allocator (const version).
+    const Allocator& allocator() const
+    {
+        return m_alloc;
+    }
+
+    /// @brief Get allocation statistics.
+    const MsgAllocStats& allocStats() const
+    {
+        return m_alloc.stats();
+    }
+
+    /// @brief Number of message types sharing the same ID.
+    std::size_t msgCount(ublox::MsgId id) const
+    {
+        return entry(id).m_count;
+    }
+
+    /// @brief Check whether the raw payload matches the discriminator
+    ///     of the message type.
+    /// @param[in] id ID of the message.
+    /// @param[in] idx Index of the message type among the ones sharing the same ID.
+    /// @param[in] payload Pointer to the payload.
+    /// @param[in] len Length of the payload.
+    bool msgMatches(ublox::MsgId id, unsigned idx, const std::uint8_t* payload, std::size_t len) const
+    {
+        auto msgIdx = typeIdx(id, idx);
+        if (NumOfMessages <= msgIdx) {
+            return false;
+        }
+
+        return Helper::MatchFuncs[msgIdx](payload, len);
+    }
+
+private:
+    using Tables = typename Helper::AllTables;
+
+    static_assert(Helper::allKnown(0U),
+        "All the message IDs are expected to be listed in ublox::MsgId, "
+        "see script/gen_msg_id_table.py");
+
+    static const details::MsgFactoryEntry& entry(ublox::MsgId id)
+    {
+        return Tables::Entries[details::knownMsgIdIndex(id)];
+    }
+
+    // Index of the type in the messages tuple, NumOfMessages if not supported
+    static std::size_t typeIdx(ublox::MsgId id, unsigned idx)
+    {
+        auto& msgEntry = entry(id);
+        if (msgEntry.m_count <= idx) {
+            return NumOfMessages;
+        }
+
+        std::size_t msgIdx = msgEntry.m_first;
+        for (auto count = 0U; count < idx; ++count) {
+            msgIdx = Tables::Next[msgIdx];
+        }
+        return msgIdx;
+    }
+
+    Allocator m_alloc;
+};
+
+}  // namespace ublox
+
+
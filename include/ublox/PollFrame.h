@@ -0,0 +1,584 @@
+//
+// Copyright 2018 (C). Alex Robenko. All rights reserved.
+//
+
+// This file is free software: you can redistribute it and/or modify
+// it under the terms of the GNU General Public License as published by
+// the Free Software Foundation, either version 3 of the License, or
+// (at your option) any later version.
+//
+// This program is distributed in the hope that it will be useful,
+// but WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+// GNU General Public License for more details.
+//
+// You should have received a copy of the GNU General Public License
+// along with this program.  If not, see <http://www.gnu.org/licenses/>.
+
+/// @file
+/// @brief Contains definition of precomputed frames of the @b poll messages.
+
+#pragma once
+
+#include <cstdint>
+#include <cstddef>
+
+#include "MsgId.h"
+#include "FrameSpan.h"
+#include "details/MsgIdTable.h"
+
+namespace ublox
+{
+
+namespace details
+{
+
+template <unsigned TA, unsigned TB, std::uint8_t... TBytes>
+struct PollFrameChecksum
+{
+    static const std::uint8_t A = static_cast<std::uint8_t>(TA);
+    static const std::uint8_t B = static_cast<std::uint8_t>(TB);
+};
+
+template <unsigned TA, unsigned TB, std::uint8_t TFirst, std::uint8_t... TRest>
+struct PollFrameChecksum<TA, TB, TFirst, TRest...> :
+    public PollFrameChecksum<(TA + TFirst) & 0xffU, (TB + TA + TFirst) & 0xffU, TRest...>
+{
+};
+
+// Position of the frame (plus one) for every known message ID (see
+// knownMsgIdIndex()), 0 when there is no zero-length poll with such ID.
+template <std::size_t TCount>
+struct PollFrameIndex
+{
+    static_assert(TCount < 0xffU, "Too many frames");
+
+    explicit PollFrameIndex(const FrameSpan (&frames)[TCount])
+    {
+        for (std::size_t idx = 0U; idx < TCount; ++idx) {
+            auto id =
+                static_cast<MsgId>(
+                    (static_cast<unsigned>(frames[idx].data()[2]) << 8) |
+                    frames[idx].data()[3]);
+
+            auto knownIdx = knownMsgIdIndex(id);
+            if (knownIdx != 0U) {
+                m_positions[knownIdx] = static_cast<std::uint8_t>(idx + 1U);
+            }
+        }
+    }
+
+    std::uint8_t m_positions[KnownMsgIdsCount + 1U] = {};
+};
+
+} // namespace details
+
+/// @brief Complete UBX frame of the @b poll message, computed at compile time.
+/// @details Contains sync characters, class and message IDs, payload
+///     length, payload bytes and the checksum, ready to be written to the
+///     device as is. No serialisation and no memory allocation is required
+///     at runtime, the frame is a static constant array.
+/// @tparam TId ID of the message.
+/// @tparam TPayload Payload bytes, empty for zero-length polls.
+template <MsgId TId, std::uint8_t... TPayload>
+struct PollFrame
+{
+private:
+    using Checksum =
+        details::PollFrameChecksum<
+            0U,
+            0U,
+            static_cast<std::uint8_t>(static_cast<unsigned>(TId) >> 8),
+            static_cast<std::uint8_t>(TId),
+            static_cast<std::uint8_t>(sizeof...(TPayload)),
+            static_cast<std::uint8_t>(sizeof...(TPayload) >> 8),
+            TPayload...
+        >;
+
+public:
+    /// @brief Full length of the frame.
+    static const std::size_t Length = 8U + sizeof...(TPayload);
+
+    /// @brief Bytes of the frame.
+    static constexpr std::uint8_t Data[Length] = {
+        0xb5, 0x62,
+        static_cast<std::uint8_t>(static_cast<unsigned>(TId) >> 8),
+        static_cast<std::uint8_t>(TId),
+        static_cast<std::uint8_t>(sizeof...(TPayload)),
+        static_cast<std::uint8_t>(sizeof...(TPayload) >> 8),
+        TPayload...,
+        Checksum::A,
+        Checksum::B
+    };
+
+    /// @brief Get the frame as contiguous span of bytes.
+    static FrameSpan span()
+    {
+        FrameSpan result;
+        result.m_data = &Data[0];
+        result.m_size = Length;
+        return result;
+    }
+};
+
+template <MsgId TId, std::uint8_t... TPayload>
+constexpr std::uint8_t PollFrame<TId, TPayload...>::Data[PollFrame<TId, TPayload...>::Length];
+
+namespace poll
+{
+
+/// @brief Frame of AID-ALM (@b poll) message (see @ref ublox::message::AidAlmPoll).
+using AidAlmPoll = PollFrame<MsgId_AID_ALM>;
+
+/// @brief Frame of AID-AOP (@b poll) message (see @ref ublox::message::AidAopPoll).
+using AidAopPoll = PollFrame<MsgId_AID_AOP>;
+
+/// @brief Frame of AID-EPH (@b poll) message (see @ref ublox::message::AidEphPoll).
+using AidEphPoll = PollFrame<MsgId_AID_EPH>;
+
+/// @brief Frame of AID-HUI (@b poll) message (see @ref ublox::message::AidHuiPoll).
+using AidHuiPoll = PollFrame<MsgId_AID_HUI>;
+
+/// @brief Frame of AID-INI (@b poll) message (see @ref ublox::message::AidIniPoll).
+using AidIniPoll = PollFrame<MsgId_AID_INI>;
+
+/// @brief Frame of CFG-ANT (@b poll) message (see @ref ublox::message::CfgAntPoll).
+using CfgAntPoll = PollFrame<MsgId_CFG_ANT>;
+
+/// @brief Frame of CFG-DAT (@b poll) message (see @ref ublox::message::CfgDatPoll).
+using CfgDatPoll = PollFrame<MsgId_CFG_DAT>;
+
+/// @brief Frame of CFG-DGNSS (@b poll) message (see @ref ublox::message::CfgDgnssPoll).
+using CfgDgnssPoll = PollFrame<MsgId_CFG_DGNSS>;
+
+/// @brief Frame of CFG-DOSC (@b poll) message (see @ref ublox::message::CfgDoscPoll).
+using CfgDoscPoll = PollFrame<MsgId_CFG_DOSC>;
+
+/// @brief Frame of CFG-EKF (@b poll) message (see @ref ublox::message::CfgEkfPoll).
+using CfgEkfPoll = PollFrame<MsgId_CFG_EKF>;
+
+/// @brief Frame of CFG-ESFGWT (@b poll) message (see @ref ublox::message::CfgEsfgwtPoll).
+using CfgEsfgwtPoll = PollFrame<MsgId_CFG_ESFGWT>;
+
+/// @brief Frame of CFG-ESRC (@b poll) message (see @ref ublox::message::CfgEsrcPoll).
+using CfgEsrcPoll = PollFrame<MsgId_CFG_ESRC>;
+
+/// @brief Frame of CFG-FXN (@b poll) message (see @ref ublox::message::CfgFxnPoll).
+using CfgFxnPoll = PollFrame<MsgId_CFG_FXN>;
+
+/// @brief Frame of CFG-GEOFENCE (@b poll) message (see @ref ublox::message::CfgGeofencePoll).
+using CfgGeofencePoll = PollFrame<MsgId_CFG_GEOFENCE>;
+
+/// @brief Frame of CFG-GNSS (@b poll) message (see @ref ublox::message::CfgGnssPoll).
+using CfgGnssPoll = PollFrame<MsgId_CFG_GNSS>;
+
+/// @brief Frame of CFG-HNR (@b poll) message (see @ref ublox::message::CfgHnrPoll).
+using CfgHnrPoll = PollFrame<MsgId_CFG_HNR>;
+
+/// @brief Frame of CFG-ITFM (@b poll) message (see @ref ublox::message::CfgItfmPoll).
+using CfgItfmPoll = PollFrame<MsgId_CFG_ITFM>;
+
+/// @brief Frame of CFG-LOGFILTER (@b poll) message (see @ref ublox::message::CfgLogfilterPoll).
+using CfgLogfilterPoll = PollFrame<MsgId_CFG_LOGFILTER>;
+
+/// @brief Frame of CFG-NAV5 (@b poll) message (see @ref ublox::message::CfgNav5Poll).
+using CfgNav5Poll = PollFrame<MsgId_CFG_NAV5>;
+
+/// @brief Frame of CFG-NAVX5 (@b poll) message (see @ref ublox::message::CfgNavx5Poll).
+using CfgNavx5Poll = PollFrame<MsgId_CFG_NAVX5>;
+
+/// @brief Frame of CFG-NMEA (@b poll) message (see @ref ublox::message::CfgNmeaPoll).
+using CfgNmeaPoll = PollFrame<MsgId_CFG_NMEA>;
+
+/// @brief Frame of CFG-ODO (@b poll) message (see @ref ublox::message::CfgOdoPoll).
+using CfgOdoPoll = PollFrame<MsgId_CFG_ODO>;
+
+/// @brief Frame of CFG-PM2 (@b poll) message (see @ref ublox::message::CfgPm2Poll).
+using CfgPm2Poll = PollFrame<MsgId_CFG_PM2>;
+
+/// @brief Frame of CFG-PM (@b poll) message (see @ref ublox::message::CfgPmPoll).
+using CfgPmPoll = PollFrame<MsgId_CFG_PM>;
+
+/// @brief Frame of CFG-PMS (@b poll) message (see @ref ublox::message::CfgPmsPoll).
+using CfgPmsPoll = PollFrame<MsgId_CFG_PMS>;
+
+/// @brief Frame of CFG-PRT (@b poll) message (see @ref ublox::message::CfgPrtPoll).
+using CfgPrtPoll = PollFrame<MsgId_CFG_PRT>;
+
+/// @brief Frame of CFG-RATE (@b poll) message (see @ref ublox::message::CfgRatePoll).
+using CfgRatePoll = PollFrame<MsgId_CFG_RATE>;
+
+/// @brief Frame of CFG-RINV (@b poll) message (see @ref ublox::message::CfgRinvPoll).
+using CfgRinvPoll = PollFrame<MsgId_CFG_RINV>;
+
+/// @brief Frame of CFG-RXM (@b poll) message (see @ref ublox::message::CfgRxmPoll).
+using CfgRxmPoll = PollFrame<MsgId_CFG_RXM>;
+
+/// @brief Frame of CFG-SBAS (@b poll) message (see @ref ublox::message::CfgSbasPoll).
+using CfgSbasPoll = PollFrame<MsgId_CFG_SBAS>;
+
+/// @brief Frame of CFG-SMGR (@b poll) message (see @ref ublox::message::CfgSmgrPoll).
+using CfgSmgrPoll = PollFrame<MsgId_CFG_SMGR>;
+
+/// @brief Frame of CFG-TMODE2 (@b poll) message (see @ref ublox::message::CfgTmode2Poll).
+using CfgTmode2Poll = PollFrame<MsgId_CFG_TMODE2>;
+
+/// @brief Frame of CFG-TMODE3 (@b poll) message (see @ref ublox::message::CfgTmode3Poll).
+using CfgTmode3Poll = PollFrame<MsgId_CFG_TMODE3>;
+
+/// @brief Frame of CFG-TMODE (@b poll) message (see @ref ublox::message::CfgTmodePoll).
+using CfgTmodePoll = PollFrame<MsgId_CFG_TMODE>;
+
+/// @brief Frame of CFG-TP5 (@b poll) message (see @ref ublox::message::CfgTp5Poll).
+using CfgTp5Poll = PollFrame<MsgId_CFG_TP5>;
+
+/// @brief Frame of CFG-TP (@b poll) message (see @ref ublox::message::CfgTpPoll).
+using CfgTpPoll = PollFrame<MsgId_CFG_TP>;
+
+/// @brief Frame of CFG-USB (@b poll) message (see @ref ublox::message::CfgUsbPoll).
+using CfgUsbPoll = PollFrame<MsgId_CFG_USB>;
+
+/// @brief Frame of ESF-INS (@b poll) message (see @ref ublox::message::EsfInsPoll).
+using EsfInsPoll = PollFrame<MsgId_ESF_INS>;
+
+/// @brief Frame of ESF-MEAS (@b poll) message (see @ref ublox::message::EsfMeasPoll).
+using EsfMeasPoll = PollFrame<MsgId_ESF_MEAS>;
+
+/// @brief Frame of ESF-STATUS (@b poll) message (see @ref ublox::message::EsfStatusPoll).
+using EsfStatusPoll = PollFrame<MsgId_ESF_STATUS>;
+
+/// @brief Frame of HNR-PVT (@b poll) message (see @ref ublox::message::HnrPvtPoll).
+using HnrPvtPoll = PollFrame<MsgId_HNR_PVT>;
+
+/// @brief Frame of LOG-INFO (@b poll) message (see @ref ublox::message::LogInfoPoll).
+using LogInfoPoll = PollFrame<MsgId_LOG_INFO>;
+
+/// @brief Frame of MGA-DBD (@b poll) message (see @ref ublox::message::MgaDbdPoll).
+using MgaDbdPoll = PollFrame<MsgId_MGA_DBD>;
+
+/// @brief Frame of MON-GNSS (@b poll) message (see @ref ublox::message::MonGnssPoll).
+using MonGnssPoll = PollFrame<MsgId_MON_GNSS>;
+
+/// @brief Frame of MON-HW2 (@b poll) message (see @ref ublox::message::MonHw2Poll).
+using MonHw2Poll = PollFrame<MsgId_MON_HW2>;
+
+/// @brief Frame of MON-HW (@b poll) message (see @ref ublox::message::MonHwPoll).
+using MonHwPoll = PollFrame<MsgId_MON_HW>;
+
+/// @brief Frame of MON-IO (@b poll) message (see @ref ublox::message::MonIoPoll).
+using MonIoPoll = PollFrame<MsgId_MON_IO>;
+
+/// @brief Frame of MON-MSGPP (@b poll) message (see @ref ublox::message::MonMsgppPoll).
+using MonMsgppPoll = PollFrame<MsgId_MON_MSGPP>;
+
+/// @brief Frame of MON-PATCH (@b poll) message (see @ref ublox::message::MonPatchPoll).
+using MonPatchPoll = PollFrame<MsgId_MON_PATCH>;
+
+/// @brief Frame of MON-RXBUF (@b poll) message (see @ref ublox::message::MonRxbufPoll).
+using MonRxbufPoll = PollFrame<MsgId_MON_RXBUF>;
+
+/// @brief Frame of MON-SMGR (@b poll) message (see @ref ublox::message::MonSmgrPoll).
+using MonSmgrPoll = PollFrame<MsgId_MON_SMGR>;
+
+/// @brief Frame of MON-TXBUF (@b poll) message (see @ref ublox::message::MonTxbufPoll).
+using MonTxbufPoll = PollFrame<MsgId_MON_TXBUF>;
+
+/// @brief Frame of MON-VER (@b poll) message (see @ref ublox::message::MonVerPoll).
+using MonVerPoll = PollFrame<MsgId_MON_VER>;
+
+/// @brief Frame of NAV-AOPSTATUS (@b poll) message (see @ref ublox::message::NavAopstatusPoll).
+using NavAopstatusPoll = PollFrame<MsgId_NAV_AOPSTATUS>;
+
+/// @brief Frame of NAV-ATT (@b poll) message (see @ref ublox::message::NavAttPoll).
+using NavAttPoll = PollFrame<MsgId_NAV_ATT>;
+
+/// @brief Frame of NAV-CLOCK (@b poll) message (see @ref ublox::message::NavClockPoll).
+using NavClockPoll = PollFrame<MsgId_NAV_CLOCK>;
+
+/// @brief Frame of NAV-DGPS (@b poll) message (see @ref ublox::message::NavDgpsPoll).
+using NavDgpsPoll = PollFrame<MsgId_NAV_DGPS>;
+
+/// @brief Frame of NAV-DOP (@b poll) message (see @ref ublox::message::NavDopPoll).
+using NavDopPoll = PollFrame<MsgId_NAV_DOP>;
+
+/// @brief Frame of NAV-EKFSTATUS (@b poll) message (see @ref ublox::message::NavEkfstatusPoll).
+using NavEkfstatusPoll = PollFrame<MsgId_NAV_EKFSTATUS>;
+
+/// @brief Frame of NAV-GEOFENCE (@b poll) message (see @ref ublox::message::NavGeofencePoll).
+using NavGeofencePoll = PollFrame<MsgId_NAV_GEOFENCE>;
+
+/// @brief Frame of NAV-HPPOSECEF (@b poll) message (see @ref ublox::message::NavHpposecefPoll).
+using NavHpposecefPoll = PollFrame<MsgId_NAV_HPPOSECEF>;
+
+/// @brief Frame of NAV-HPPOSLLH (@b poll) message (see @ref ublox::message::NavHpposllhPoll).
+using NavHpposllhPoll = PollFrame<MsgId_NAV_HPPOSLLH>;
+
+/// @brief Frame of NAV-ODO (@b poll) message (see @ref ublox::message::NavOdoPoll).
+using NavOdoPoll = PollFrame<MsgId_NAV_ODO>;
+
+/// @brief Frame of NAV-ORB (@b poll) message (see @ref ublox::message::NavOrbPoll).
+using NavOrbPoll = PollFrame<MsgId_NAV_ORB>;
+
+/// @brief Frame of NAV-POSECEF (@b poll) message (see @ref ublox::message::NavPosecefPoll).
+using NavPosecefPoll = PollFrame<MsgId_NAV_POSECEF>;
+
+/// @brief Frame of NAV-POSLLH (@b poll) message (see @ref ublox::message::NavPosllhPoll).
+using NavPosllhPoll = PollFrame<MsgId_NAV_POSLLH>;
+
+/// @brief Frame of NAV-PVT (@b poll) message (see @ref ublox::message::NavPvtPoll).
+using NavPvtPoll = PollFrame<MsgId_NAV_PVT>;
+
+/// @brief Frame of NAV-RELPOSNED (@b poll) message (see @ref ublox::message::NavRelposnedPoll).
+using NavRelposnedPoll = PollFrame<MsgId_NAV_RELPOSNED>;
+
+/// @brief Frame of NAV-SAT (@b poll) message (see @ref ublox::message::NavSatPoll).
+using NavSatPoll = PollFrame<MsgId_NAV_SAT>;
+
+/// @brief Frame of NAV-SBAS (@b poll) message (see @ref ublox::message::NavSbasPoll).
+using NavSbasPoll = PollFrame<MsgId_NAV_SBAS>;
+
+/// @brief Frame of NAV-SOL (@b poll) message (see @ref ublox::message::NavSolPoll).
+using NavSolPoll = PollFrame<MsgId_NAV_SOL>;
+
+/// @brief Frame of NAV-STATUS (@b poll) message (see @ref ublox::message::NavStatusPoll).
+using NavStatusPoll = PollFrame<MsgId_NAV_STATUS>;
+
+/// @brief Frame of NAV-SVIN (@b poll) message (see @ref ublox::message::NavSvinPoll).
+using NavSvinPoll = PollFrame<MsgId_NAV_SVIN>;
+
+/// @brief Frame of NAV-SVINFO (@b poll) message (see @ref ublox::message::NavSvinfoPoll).
+using NavSvinfoPoll = PollFrame<MsgId_NAV_SVINFO>;
+
+/// @brief Frame of NAV-TIMEBDS (@b poll) message (see @ref ublox::message::NavTimebdsPoll).
+using NavTimebdsPoll = PollFrame<MsgId_NAV_TIMEBDS>;
+
+/// @brief Frame of NAV-TIMEGAL (@b poll) message (see @ref ublox::message::NavTimegalPoll).
+using NavTimegalPoll = PollFrame<MsgId_NAV_TIMEGAL>;
+
+/// @brief Frame of NAV-TIMEGLO (@b poll) message (see @ref ublox::message::NavTimegloPoll).
+using NavTimegloPoll = PollFrame<MsgId_NAV_TIMEGLO>;
+
+/// @brief Frame of NAV-TIMEGPS (@b poll) message (see @ref ublox::message::NavTimegpsPoll).
+using NavTimegpsPoll = PollFrame<MsgId_NAV_TIMEGPS>;
+
+/// @brief Frame of NAV-TIMELS (@b poll) message (see @ref ublox::message::NavTimelsPoll).
+using NavTimelsPoll = PollFrame<MsgId_NAV_TIMELS>;
+
+/// @brief Frame of NAV-TIMEUTC (@b poll) message (see @ref ublox::message::NavTimeutcPoll).
+using NavTimeutcPoll = PollFrame<MsgId_NAV_TIMEUTC>;
+
+/// @brief Frame of NAV-VELECEF (@b poll) message (see @ref ublox::message::NavVelecefPoll).
+using NavVelecefPoll = PollFrame<MsgId_NAV_VELECEF>;
+
+/// @brief Frame of NAV-VELNED (@b poll) message (see @ref ublox::message::NavVelnedPoll).
+using NavVelnedPoll = PollFrame<MsgId_NAV_VELNED>;
+
+/// @brief Frame of RXM-ALM (@b poll) message (see @ref ublox::message::RxmAlmPoll).
+using RxmAlmPoll = PollFrame<MsgId_RXM_ALM>;
+
+/// @brief Frame of RXM-EPH (@b poll) message (see @ref ublox::message::RxmEphPoll).
+using RxmEphPoll = PollFrame<MsgId_RXM_EPH>;
+
+/// @brief Frame of RXM-IMES (@b poll) message (see @ref ublox::message::RxmImesPoll).
+using RxmImesPoll = PollFrame<MsgId_RXM_IMES>;
+
+/// @brief Frame of RXM-RAW (@b poll) message (see @ref ublox::message::RxmRawPoll).
+using RxmRawPoll = PollFrame<MsgId_RXM_RAW>;
+
+/// @brief Frame of RXM-RAWX (@b poll) message (see @ref ublox::message::RxmRawxPoll).
+using RxmRawxPoll = PollFrame<MsgId_RXM_RAWX>;
+
+/// @brief Frame of RXM-SVSI (@b poll) message (see @ref ublox::message::RxmSvsiPoll).
+using RxmSvsiPoll = PollFrame<MsgId_RXM_SVSI>;
+
+/// @brief Frame of TIM-FCHG (@b poll) message (see @ref ublox::message::TimFchgPoll).
+using TimFchgPoll = PollFrame<MsgId_TIM_FCHG>;
+
+/// @brief Frame of TIM-SVIN (@b poll) message (see @ref ublox::message::TimSvinPoll).
+using TimSvinPoll = PollFrame<MsgId_TIM_SVIN>;
+
+/// @brief Frame of TIM-TM2 (@b poll) message (see @ref ublox::message::TimTm2Poll).
+using TimTm2Poll = PollFrame<MsgId_TIM_TM2>;
+
+/// @brief Frame of TIM-TP (@b poll) message (see @ref ublox::message::TimTpPoll).
+using TimTpPoll = PollFrame<MsgId_TIM_TP>;
+
+/// @brief Frame of TIM-VCOCAL (@b poll) message (see @ref ublox::message::TimVcocalPoll).
+using TimVcocalPoll = PollFrame<MsgId_TIM_VCOCAL>;
+
+/// @brief Frame of TIM-VRFY (@b poll) message (see @ref ublox::message::TimVrfyPoll).
+using TimVrfyPoll = PollFrame<MsgId_TIM_VRFY>;
+
+/// @brief Frame of UPD-SOS (@b poll) message (see @ref ublox::message::UpdSosPoll).
+using UpdSosPoll = PollFrame<MsgId_UPD_SOS>;
+
+/// @brief Frame of AID-ALM (<b>poll SV</b>) message (see @ref ublox::message::AidAlmPollSv).
+/// @tparam TSvid ID of the requested SV.
+template <std::uint8_t TSvid>
+using AidAlmPollSv = PollFrame<MsgId_AID_ALM, TSvid>;
+
+/// @brief Frame of AID-AOP (<b>poll SV</b>) message (see @ref ublox::message::AidAopPollSv).
+/// @tparam TSvid ID of the requested SV.
+template <std::uint8_t TSvid>
+using AidAopPollSv = PollFrame<MsgId_AID_AOP, TSvid>;
+
+/// @brief Frame of AID-EPH (<b>poll SV</b>) message (see @ref ublox::message::AidEphPollSv).
+/// @tparam TSvid ID of the requested SV.
+template <std::uint8_t TSvid>
+using AidEphPollSv = PollFrame<MsgId_AID_EPH, TSvid>;
+
+/// @brief Frame of CFG-INF (@b poll) message (see @ref ublox::message::CfgInfPoll).
+/// @tparam TProtocolId Numeric value of the protocol (see @ref ublox::field::cfg::ProtocolId).
+template <std::uint8_t TProtocolId>
+using CfgInfPoll = PollFrame<MsgId_CFG_INF, TProtocolId>;
+
+/// @brief Frame of CFG-MSG (@b poll) message (see @ref ublox::message::CfgMsgPoll).
+/// @tparam TMsgId ID of the message which configuration is requested.
+template <MsgId TMsgId>
+using CfgMsgPoll =
+    PollFrame<
+        MsgId_CFG_MSG,
+        static_cast<std::uint8_t>(static_cast<unsigned>(TMsgId) >> 8),
+        static_cast<std::uint8_t>(TMsgId)
+    >;
+
+/// @brief Frame of CFG-PRT (<b>poll port</b>) message (see @ref ublox::message::CfgPrtPollPort).
+/// @tparam TPortId Numeric value of the port ID (see @ref ublox::message::CfgPrtFields::PortId).
+template <std::uint8_t TPortId>
+using CfgPrtPollPort = PollFrame<MsgId_CFG_PRT, TPortId>;
+
+/// @brief Frame of CFG-TP5 (<b>poll select</b>) message (see @ref ublox::message::CfgTp5PollSelect).
+/// @tparam TTpIdx Numeric value of the time pulse selection (see @ref ublox::field::cfg::TpIdx).
+template <std::uint8_t TTpIdx>
+using CfgTp5PollSelect = PollFrame<MsgId_CFG_TP5, TTpIdx>;
+
+/// @brief Frame of RXM-ALM (<b>poll SV</b>) message (see @ref ublox::message::RxmAlmPollSv).
+/// @tparam TSvid ID of the requested SV.
+template <std::uint8_t TSvid>
+using RxmAlmPollSv = PollFrame<MsgId_RXM_ALM, TSvid>;
+
+/// @brief Frame of RXM-EPH (<b>poll SV</b>) message (see @ref ublox::message::RxmEphPollSv).
+/// @tparam TSvid ID of the requested SV.
+template <std::uint8_t TSvid>
+using RxmEphPollSv = PollFrame<MsgId_RXM_EPH, TSvid>;
+
+/// @brief Find precomputed frame of zero-length @b poll message by its ID.
+/// @details The frame is looked up in O(1) using the table of the known
+///     message IDs (see @b ublox/details/MsgIdTable.h).
+/// @param[in] id ID of the message.
+/// @return Span of the frame, empty one if the message doesn't have
+///     zero-length poll variant.
+inline FrameSpan frame(MsgId id)
+{
+    static const FrameSpan Frames[] = {
+        AidAlmPoll::span(),
+        AidAopPoll::span(),
+        AidEphPoll::span(),
+        AidHuiPoll::span(),
+        AidIniPoll::span(),
+        CfgAntPoll::span(),
+        CfgDatPoll::span(),
+        CfgDgnssPoll::span(),
+        CfgDoscPoll::span(),
+        CfgEkfPoll::span(),
+        CfgEsfgwtPoll::span(),
+        CfgEsrcPoll::span(),
+        CfgFxnPoll::span(),
+        CfgGeofencePoll::span(),
+        CfgGnssPoll::span(),
+        CfgHnrPoll::span(),
+        CfgItfmPoll::span(),
+        CfgLogfilterPoll::span(),
+        CfgNav5Poll::span(),
+        CfgNavx5Poll::span(),
+        CfgNmeaPoll::span(),
+        CfgOdoPoll::span(),
+        CfgPm2Poll::span(),
+        CfgPmPoll::span(),
+        CfgPmsPoll::span(),
+        CfgPrtPoll::span(),
+        CfgRatePoll::span(),
+        CfgRinvPoll::span(),
+        CfgRxmPoll::span(),
+        CfgSbasPoll::span(),
+        CfgSmgrPoll::span(),
+        CfgTmode2Poll::span(),
+        CfgTmode3Poll::span(),
+        CfgTmodePoll::span(),
+        CfgTp5Poll::span(),
+        CfgTpPoll::span(),
+        CfgUsbPoll::span(),
+        EsfInsPoll::span(),
+        EsfMeasPoll::span(),
+        EsfStatusPoll::span(),
+        HnrPvtPoll::span(),
+        LogInfoPoll::span(),
+        MgaDbdPoll::span(),
+        MonGnssPoll::span(),
+        MonHw2Poll::span(),
+        MonHwPoll::span(),
+        MonIoPoll::span(),
+        MonMsgppPoll::span(),
+        MonPatchPoll::span(),
+        MonRxbufPoll::span(),
+        MonSmgrPoll::span(),
+        MonTxbufPoll::span(),
+        MonVerPoll::span(),
+        NavAopstatusPoll::span(),
+        NavAttPoll::span(),
+        NavClockPoll::span(),
+        NavDgpsPoll::span(),
+        NavDopPoll::span(),
+        NavEkfstatusPoll::span(),
+        NavGeofencePoll::span(),
+        NavHpposecefPoll::span(),
+        NavHpposllhPoll::span(),
+        NavOdoPoll::span(),
+        NavOrbPoll::span(),
+        NavPosecefPoll::span(),
+        NavPosllhPoll::span(),
+        NavPvtPoll::span(),
+        NavRelposnedPoll::span(),
+        NavSatPoll::span(),
+        NavSbasPoll::span(),
+        NavSolPoll::span(),
+        NavStatusPoll::span(),
+        NavSvinPoll::span(),
+        NavSvinfoPoll::span(),
+        NavTimebdsPoll::span(),
+        NavTimegalPoll::span(),
+        NavTimegloPoll::span(),
+        NavTimegpsPoll::span(),
+        NavTimelsPoll::span(),
+        NavTimeutcPoll::span(),
+        NavVelecefPoll::span(),
+        NavVelnedPoll::span(),
+        RxmAlmPoll::span(),
+        RxmEphPoll::span(),
+        RxmImesPoll::span(),
+        RxmRawPoll::span(),
+        RxmRawxPoll::span(),
+        RxmSvsiPoll::span(),
+        TimFchgPoll::span(),
+        TimSvinPoll::span(),
+        TimTm2Poll::span(),
+        TimTpPoll::span(),
+        TimVcocalPoll::span(),
+        TimVrfyPoll::span(),
+        UpdSosPoll::span()
+    };
+
+    static const details::PollFrameIndex<sizeof(Frames) / sizeof(Frames[0])> Index(Frames);
+    auto pos = Index.m_positions[details::knownMsgIdIndex(id)];
+    if (pos == 0U) {
+        return FrameSpan();
+    }
+
+    return Frames[pos - 1U];
+}
+
+} // namespace poll
+
+}  // namespace ublox
+
+
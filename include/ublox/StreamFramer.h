@@ -0,0 +1,207 @@
+//
+// Copyright 2018 (C). Alex Robenko. All rights reserved.
+//
+
+// This file is free software: you can redistribute it and/or modify
+// it under the terms of the GNU General Public License as published by
+// the Free Software Foundation, either version 3 of the License, or
+// (at your option) any later version.
+//
+// This program is distributed in the hope that it will be useful,
+// but WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+// GNU General Public License for more details.
+//
+// You should have received a copy of the GNU General Public License
+// along with this program.  If not, see <http://www.gnu.org/licenses/>.
+
+/// @file
+/// @brief Contains definition of ublox::StreamFramer class.
+
+#pragma once
+
+#include <cstdint>
+#include <cstddef>
+#include <cstring>
+#include <array>
+#include <algorithm>
+#include <limits>
+
+#include "comms/ErrorStatus.h"
+
+#include "FrameSpan.h"
+#include "protocol/FrameScanner.h"
+
+namespace ublox
+{
+
+/// @brief Fixed capacity input buffer yielding complete UBX frames.
+/// @details The incoming data is stored in the ring buffer of @b TCapacity
+///     bytes, which is followed by the "mirror" area of maximal frame length.
+///     When the frame wraps around the end of the ring, its beginning is
+///     copied into the mirror area, so every frame is reported as a contiguous
+///     span of bytes (see @ref FrameSpan) which can be passed directly to
+///     @b read() member function of @ref ublox::Stack. The data is
+///     never moved inside the buffer, only the wrapped part of the
+///     frame is copied.@n
+///     The frames are located using ublox::protocol::FrameScanner, all the
+///     garbage between them is silently dropped.@n
+///     The data may be written directly into the internal buffer (see writeBuf()
+///     and commit()) or copied from external one (see push()).
+///     The reported frame remains valid until the next call to any of the
+///     write member functions.
+/// @tparam TCapacity Capacity of the ring buffer, must be able to
+///     contain at least one frame of maximal length.
+/// @tparam TMaxPayloadLen Maximal expected payload length of the frame,
+///     see ublox::protocol::FrameScanner.
+template <
+    std::size_t TCapacity,
+    std::size_t TMaxPayloadLen = std::numeric_limits<std::uint16_t>::max()>
+class StreamFramer
+{
+    using Scanner = protocol::FrameScanner<TMaxPayloadLen>;
+
+public:
+    /// @brief Capacity of the ring buffer.
+    static const std::size_t Capacity = TCapacity;
+
+    /// @brief Maximal length of the reported frame.
+    static const std::size_t MaxFrameLen = Scanner::MaxFrameLen;
+
+    static_assert(MaxFrameLen <= TCapacity, "The capacity is too small");
+
+    /// @brief Get pointer to the contiguous free area of the buffer.
+    /// @details The size of the area is reported by writeBufSize().
+    ///     After the data is written, the commit() member function must be called.
+    std::uint8_t* writeBuf()
+    {
+        return &m_buf[tailPos()];
+    }
+
+    /// @brief Size of the contiguous free area of the buffer returned by writeBuf().
+    std::size_t writeBufSize() const
+    {
+        auto tail = tailPos();
+        if (tail < m_head) {
+            return m_head - tail;
+        }
+
+        if ((tail == m_head) && (m_size != 0U)) {
+            return 0U;
+        }
+
+        return TCapacity - tail;
+    }
+
+    /// @brief Report amount of bytes written into the area returned by writeBuf().
+    void commit(std::size_t len)
+    {
+        m_size += std::min(len, writeBufSize());
+    }
+
+    /// @brief Copy the data from external buffer.
+    /// @return Number of bytes that have been copied, may be less than
+    ///     @b len when the buffer is full.
+    std::size_t push(const std::uint8_t* data, std::size_t len)
+    {
+        std::size_t pushed = 0U;
+        while (pushed < len) {
+            auto count = std::min(len - pushed, writeBufSize());
+            if (count == 0U) {
+                break;
+            }
+
+            std::memcpy(writeBuf(), data + pushed, count);
+            commit(count);
+            pushed += count;
+        }
+        return pushed;
+    }
+
+    /// @brief Retrieve next complete frame.
+    /// @details The data preceding the frame as well as the frame itself
+    ///     are removed from the buffer.
+    /// @param[out] frame Contiguous view of the frame.
+    /// @return @b true in case the frame has been found, @b false
+    ///     in case more data is required.
+    bool nextFrame(FrameSpan& frame)
+    {
+        while (m_size != 0U) {
+            auto contLen = std::min(m_size, TCapacity - m_head);
+            auto wrappedLen = std::min(m_size - contLen, MaxFrameLen - 1U);
+            if (m_mirrored < wrappedLen) {
+                std::memcpy(&m_buf[TCapacity + m_mirrored], &m_buf[m_mirrored], wrappedLen - m_mirrored);
+                m_mirrored = wrappedLen;
+            }
+
+            auto result = m_scanner.scan(&m_buf[m_head], contLen + wrappedLen);
+            if (result.m_status == comms::ErrorStatus::Success) {
+                frame.m_data = result.m_frame;
+                frame.m_size = result.m_frameLen;
+                consume(result.m_discarded + result.m_frameLen);
+                return true;
+            }
+
+            consume(result.m_discarded);
+            if ((result.m_discarded == 0U) || (contLen == m_size)) {
+                break;
+            }
+        }
+        return false;
+    }
+
+    /// @brief Number of bytes currently stored in the buffer.
+    std::size_t size() const
+    {
+        return m_size;
+    }
+
+    /// @brief Total number of garbage bytes dropped so far.
+    std::size_t discardedCount() const
+    {
+        return m_scanner.discardedCount();
+    }
+
+    /// @brief Drop all the stored data.
+    void clear()
+    {
+        m_head = 0U;
+        m_size = 0U;
+        m_mirrored = 0U;
+    }
+
+private:
+    std::size_t tailPos() const
+    {
+        auto tail = m_head + m_size;
+        if (TCapacity <= tail) {
+            tail -= TCapacity;
+        }
+        return tail;
+    }
+
+    void consume(std::size_t len)
+    {
+        m_head += len;
+        m_size -= len;
+        if (TCapacity <= m_head) {
+            m_head -= TCapacity;
+            m_mirrored = 0U;
+        }
+
+        if (m_size == 0U) {
+            m_head = 0U;
+            m_mirrored = 0U;
+        }
+    }
+
+    std::array<std::uint8_t, TCapacity + MaxFrameLen> m_buf;
+    Scanner m_scanner;
+    std::size_t m_head = 0U;
+    std::size_t m_size = 0U;
+    std::size_t m_mirrored = 0U;
+};
+
+}  // namespace ublox
+
+
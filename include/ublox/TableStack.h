@@ -0,0 +1,228 @@
+//
+// Copyright 2018 (C). Alex Robenko. All rights reserved.
+//
+
+// This file is free software: you can redistribute it and/or modify
+// it under the terms of the GNU General Public License as published by
+// the Free Software Foundation, either version 3 of the License, or
+// (at your option) any later version.
+//
+// This program is distributed in the hope that it will be useful,
+// but WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+// GNU General Public License for more details.
+//
+// You should have received a copy of the GNU General Public License
+// along with this program.  If not, see <http://www.gnu.org/licenses/>.
+
+/// @file
+/// @brief Contains definition of ublox::TableStack class.
+
+#pragma once
+
+#include <cstdint>
+#include <cstddef>
+#include <limits>
+#include <type_traits>
+
+#include "comms/comms.h"
+
+#include "MsgId.h"
+#include "MsgFactoryTable.h"
+#include "InputMessages.h"
+#include "protocol/ChecksumCalc.h"
+#include "protocol/FrameScanner.h"
+
+namespace ublox
+{
+
+/// @brief Input only protocol stack with direct message dispatch.
+/// @details Alternative to @ref ublox::Stack for the input messages.
+///     Processes the same framing (sync characters, class / id, length,
+///     payload, checksum), but uses @ref ublox::MsgFactoryTable to create
+///     the message object, i.e. the message creation is O(1) regardless
+///     of the number of messages in @b TMessages. When several messages
+///     share the same ID, the correct type is selected using
+///     the discriminators (see @ref ublox::MsgDiscriminator) before any
+///     field is read, the read of the message is attempted only
+///     for the types whose discriminator matches the payload. The @b read() member
+///     function has the same signature and return values as the one of
+///     @ref ublox::Stack, so both can be used interchangeably in the
+///     read loop. Outgoing messages are still expected to be serialised
+///     using @ref ublox::Stack.@n
+///     The message creation in @ref ublox::Stack is performed by
+///     @b comms::protocol::MsgIdLayer of the @b COMMS library, which
+///     doesn't provide a way to replace its lookup, hence the separate class
+///     rather than an option of @ref ublox::Stack.
+/// @tparam TMsgBase Interface class for all the @b input messages, expected
+///     to be some variant of ublox::MessageT class with
+///     <b>comms::option::ReadIterator&lt;const std::uint8_t*&gt;</b> option.
+/// @tparam TMessages Types of all messages that this protocol stack must
+///     identify during read, bundled in
+///     <a href="http://en.cppreference.com/w/cpp/utility/tuple">std::tuple</a>.
+/// @tparam TMaxPayloadLen Maximal allowed payload length, the frames reporting
+///     bigger payload are rejected with @b comms::ErrorStatus::ProtocolError.
+///     Defaults to the length the message objects can hold (see
+///     @ref ublox::MaxPayloadLenOf), bigger value is rejected at compile time.
+/// @tparam TAlloc Message allocator, either @ref ublox::HeapMsgAlloc (default)
+///     or @ref ublox::MsgPool. The latter allows operation without any
+///     dynamic memory allocation.
+template <
+    typename TMsgBase,
+    typename TMessages,
+    std::size_t TMaxPayloadLen = MaxPayloadLenOf<TMsgBase, TMessages>::Value,
+    typename TAlloc = HeapMsgAlloc<TMsgBase> >
+class TableStack
+{
+    using Factory = MsgFactoryTable<TMsgBase, TMessages, TAlloc>;
+    using Scanner = protocol::FrameScanner<TMaxPayloadLen>;
+
+    static_assert(TMaxPayloadLen <= MaxPayloadLenOf<TMsgBase, TMessages>::Value,
+        "The message objects can't hold payload of the maximal length, "
+        "see ublox::option::StaticStorage::MaxPayloadLen");
+
+public:
+    /// @brief Interface class of the input messages.
+    using Message = TMsgBase;
+
+    /// @brief Maximal allowed payload length.
+    static const std::size_t MaxPayloadLen = TMaxPayloadLen;
+
+    /// @brief All supported message types bundled in @b std::tuple.
+    using AllMessages = TMessages;
+
+    /// @brief Type of the message allocator.
+    using Allocator = TAlloc;
+
+    /// @brief Smart pointer to the allocated message object.
+    /// @details Resetting the pointer returns the message to the allocator.
+    using MsgPtr = typename Factory::MsgPtr;
+
+    /// @brief Type of the read iterator.
+    using ReadIterator = typename TMsgBase::ReadIterator;
+
+    static_assert(std::is_same<ReadIterator, const std::uint8_t*>::value,
+        "The interface is expected to read from contiguous buffer");
+
+    /// @brief Deserialise message from the input data sequence.
+    /// @param[out] msg Smart pointer to the created message object. The
+    ///     message it previously held is released before the new one is allocated,
+    ///     so a single slot @ref ublox::MsgPool is reused for every frame.
+    /// @param[in, out] iter Iterator used for reading. Advanced past the
+    ///     frame on success as well as when the frame is properly wrapped, but
+    ///     its contents are not recognised (@b comms::ErrorStatus::InvalidMsgId,
+    ///     @b comms::ErrorStatus::InvalidMsgData).
+    /// @param[in] size Number of bytes available for reading.
+    /// @return Status of the operation.
+    comms::ErrorStatus read(MsgPtr& msg, ReadIterator& iter, std::size_t size)
+    {
+        auto* frame = iter;
+        if (size < 1U) {
+            return comms::ErrorStatus::NotEnoughData;
+        }
+
+        if (frame[0] != Scanner::SyncChar1) {
+            return comms::ErrorStatus::ProtocolError;
+        }
+
+        if (size < 2U) {
+            return comms::ErrorStatus::NotEnoughData;
+        }
+
+        if (frame[1] != Scanner::SyncChar2) {
+            return comms::ErrorStatus::ProtocolError;
+        }
+
+        if (size < Scanner::HeaderLen) {
+            return comms::ErrorStatus::NotEnoughData;
+        }
+
+        auto payloadLen =
+            static_cast<std::size_t>(frame[4]) |
+            (static_cast<std::size_t>(frame[5]) << std::numeric_limits<std::uint8_t>::digits);
+
+        if (TMaxPayloadLen < payloadLen) {
+            return comms::ErrorStatus::ProtocolError;
+        }
+
+        auto frameLen = Scanner::MinFrameLen + payloadLen;
+        if (size < frameLen) {
+            return comms::ErrorStatus::NotEnoughData;
+        }
+
+        const std::uint8_t* checksumIter = frame + 2U;
+        auto expected = protocol::ChecksumCalc()(checksumIter, (Scanner::HeaderLen - 2U) + payloadLen);
+        auto actual =
+            static_cast<std::uint16_t>(
+                checksumIter[0] |
+                (static_cast<unsigned>(checksumIter[1]) << std::numeric_limits<std::uint8_t>::digits));
+
+        if (expected != actual) {
+            return comms::ErrorStatus::ProtocolError;
+        }
+
+        iter += frameLen;
+        auto id =
+            static_cast<ublox::MsgId>(
+                (static_cast<unsigned>(frame[2]) << std::numeric_limits<std::uint8_t>::digits) |
+                frame[3]);
+
+        auto count = m_factory.msgCount(id);
+        if (count == 0U) {
+            return comms::ErrorStatus::InvalidMsgId;
+        }
+
+        msg.reset();
+        auto* payload = frame + Scanner::HeaderLen;
+        auto es = comms::ErrorStatus::InvalidMsgData;
+        for (auto idx = 0U; idx < count; ++idx) {
+            if (!m_factory.msgMatches(id, idx, payload, payloadLen)) {
+                continue;
+            }
+
+            auto msgTmp = m_factory.createMsg(id, idx);
+            if (!msgTmp) {
+                return comms::ErrorStatus::MsgAllocFailure;
+            }
+
+            ReadIterator payloadIter = payload;
+            es = msgTmp->read(payloadIter, payloadLen);
+            if (es == comms::ErrorStatus::Success) {
+                msg = std::move(msgTmp);
+                break;
+            }
+        }
+
+        return es;
+    }
+
+    /// @brief Create message object given the ID of the message.
+    /// @see @ref ublox::MsgFactoryTable::createMsg()
+    MsgPtr createMsg(ublox::MsgId id, unsigned idx = 0U)
+    {
+        return m_factory.createMsg(id, idx);
+    }
+
+    /// @brief Access the message allocator.
+    Allocator& allocator()
+    {
+        return m_factory.allocator();
+    }
+
+    /// @brief Get allocation statistics.
+    /// @details Can be used to verify the message objects are not allocated
+    ///     on the heap (@ref ublox::MsgAllocStats::m_heapAllocCount) in the
+    ///     steady state. Allocations performed by the fields of the messages
+    ///     are not counted, see @ref ublox::MsgAllocStats.
+    const MsgAllocStats& allocStats() const
+    {
+        return m_factory.allocStats();
+    }
+
+private:
+    Factory m_factory;
+};
+
+}  // namespace ublox
+
+
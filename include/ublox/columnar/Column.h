@@ -0,0 +1,361 @@
+//
+// Copyright 2018 (C). Alex Robenko. All rights reserved.
+//
+
+// This file is free software: you can redistribute it and/or modify
+// it under the terms of the GNU General Public License as published by
+// the Free Software Foundation, either version 3 of the License, or
+// (at your option) any later version.
+//
+// This program is distributed in the hope that it will be useful,
+// but WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+// GNU General Public License for more details.
+//
+// You should have received a copy of the GNU General Public License
+// along with this program.  If not, see <http://www.gnu.org/licenses/>.
+
+/// @file
+/// @brief Contains definition of ublox::columnar::Column and
+///     ublox::columnar::ColumnTable classes.
+
+#pragma once
+
+#include <cstdint>
+#include <cstddef>
+#include <cstdio>
+#include <cstring>
+#include <cinttypes>
+#include <string>
+#include <type_traits>
+#include <utility>
+#include <vector>
+
+namespace ublox
+{
+
+/// @brief Columnar export of the decoded messages.
+namespace columnar
+{
+
+/// @brief Type of the column values.
+/// @details The numeric value is used as type code in the columnar file,
+///     see @ref ColumnarFileSink.
+enum class ColumnType : std::uint8_t
+{
+    Int8, ///< @b std::int8_t
+    UInt8, ///< @b std::uint8_t
+    Int16, ///< @b std::int16_t
+    UInt16, ///< @b std::uint16_t
+    Int32, ///< @b std::int32_t
+    UInt32, ///< @b std::uint32_t
+    Int64, ///< @b std::int64_t
+    UInt64, ///< @b std::uint64_t
+    Float, ///< IEEE 754 single precision
+    Double, ///< IEEE 754 double precision
+    NumOfValues ///< Number of available values, must be last
+};
+
+namespace details
+{
+
+template <std::size_t TSize, bool TSigned, bool TFloat>
+struct ColumnTypeHelper;
+
+template <> struct ColumnTypeHelper<1U, true, false> { static const ColumnType Value = ColumnType::Int8; };
+template <> struct ColumnTypeHelper<1U, false, false> { static const ColumnType Value = ColumnType::UInt8; };
+template <> struct ColumnTypeHelper<2U, true, false> { static const ColumnType Value = ColumnType::Int16; };
+template <> struct ColumnTypeHelper<2U, false, false> { static const ColumnType Value = ColumnType::UInt16; };
+template <> struct ColumnTypeHelper<4U, true, false> { static const ColumnType Value = ColumnType::Int32; };
+template <> struct ColumnTypeHelper<4U, false, false> { static const ColumnType Value = ColumnType::UInt32; };
+template <> struct ColumnTypeHelper<8U, true, false> { static const ColumnType Value = ColumnType::Int64; };
+template <> struct ColumnTypeHelper<8U, false, false> { static const ColumnType Value = ColumnType::UInt64; };
+template <> struct ColumnTypeHelper<4U, true, true> { static const ColumnType Value = ColumnType::Float; };
+template <> struct ColumnTypeHelper<8U, true, true> { static const ColumnType Value = ColumnType::Double; };
+
+template <typename T, bool TEnum>
+struct ColumnValueTypeHelper
+{
+    using Type = T;
+};
+
+template <typename T>
+struct ColumnValueTypeHelper<T, true>
+{
+    using Type = typename std::underlying_type<T>::type;
+};
+
+} // namespace details
+
+/// @brief Numeric type stored in the column for the provided value type,
+///     the enums are stored as their underlying type, @b bool as @b std::uint8_t.
+template <typename T>
+using ColumnValueType =
+    typename std::conditional<
+        std::is_same<T, bool>::value,
+        std::uint8_t,
+        typename details::ColumnValueTypeHelper<T, std::is_enum<T>::value>::Type
+    >::type;
+
+/// @brief Column type code of the provided value type.
+template <typename T>
+struct ColumnTypeOf
+{
+    static_assert(std::is_arithmetic<ColumnValueType<T> >::value, "The column value must be numeric");
+
+    /// @brief Type code.
+    static const ColumnType Value =
+        details::ColumnTypeHelper<
+            sizeof(ColumnValueType<T>),
+            std::is_signed<ColumnValueType<T> >::value,
+            std::is_floating_point<ColumnValueType<T> >::value
+        >::Value;
+};
+
+/// @brief Size of the single value of the column type in bytes.
+inline std::size_t columnTypeSize(ColumnType type)
+{
+    static const std::uint8_t Sizes[] = {1, 1, 2, 2, 4, 4, 8, 8, 4, 8};
+    static_assert(sizeof(Sizes) == static_cast<std::size_t>(ColumnType::NumOfValues), "Invalid map");
+    auto idx = static_cast<std::size_t>(type);
+    if (sizeof(Sizes) <= idx) {
+        return 0U;
+    }
+    return Sizes[idx];
+}
+
+/// @brief Typed buffer of the values of the single column.
+/// @details The values are stored in little endian format, exactly as they
+///     are written into the columnar file.
+class Column
+{
+public:
+    /// @brief Constructor
+    /// @param[in] name Name of the column.
+    /// @param[in] type Type of the values.
+    Column(std::string name, ColumnType type)
+      : m_name(std::move(name)),
+        m_type(type),
+        m_valueSize(columnTypeSize(type))
+    {
+    }
+
+    /// @brief Name of the column.
+    const std::string& name() const
+    {
+        return m_name;
+    }
+
+    /// @brief Type of the values.
+    ColumnType type() const
+    {
+        return m_type;
+    }
+
+    /// @brief Append the value.
+    /// @details The value is converted to the type of the column.
+    template <typename T>
+    void append(T value)
+    {
+        switch (m_type) {
+        case ColumnType::Int8: appendInt(static_cast<std::int8_t>(value)); break;
+        case ColumnType::UInt8: appendInt(static_cast<std::uint8_t>(value)); break;
+        case ColumnType::Int16: appendInt(static_cast<std::int16_t>(value)); break;
+        case ColumnType::UInt16: appendInt(static_cast<std::uint16_t>(value)); break;
+        case ColumnType::Int32: appendInt(static_cast<std::int32_t>(value)); break;
+        case ColumnType::UInt32: appendInt(static_cast<std::uint32_t>(value)); break;
+        case ColumnType::Int64: appendInt(static_cast<std::int64_t>(value)); break;
+        case ColumnType::UInt64: appendInt(static_cast<std::uint64_t>(value)); break;
+        case ColumnType::Float: appendFloat(static_cast<float>(value)); break;
+        case ColumnType::Double: appendFloat(static_cast<double>(value)); break;
+        default: break;
+        }
+    }
+
+    /// @brief Number of stored values.
+    std::size_t size() const
+    {
+        if (m_valueSize == 0U) {
+            return 0U;
+        }
+        return m_data.size() / m_valueSize;
+    }
+
+    /// @brief Pointer to the stored little endian values.
+    const std::uint8_t* data() const
+    {
+        return m_data.data();
+    }
+
+    /// @brief Length of the stored values in bytes.
+    std::size_t dataLen() const
+    {
+        return m_data.size();
+    }
+
+    /// @brief Format the value as text.
+    /// @param[in] idx Index of the value.
+    /// @param[out] buf Output buffer.
+    /// @param[in] bufLen Length of the output buffer.
+    /// @return Number of characters written (excluding terminating zero).
+    std::size_t format(std::size_t idx, char* buf, std::size_t bufLen) const
+    {
+        auto* ptr = &m_data[idx * m_valueSize];
+        int result = 0;
+        switch (m_type) {
+        case ColumnType::Int8: result = std::snprintf(buf, bufLen, "%d", static_cast<int>(static_cast<std::int8_t>(readLe(ptr)))); break;
+        case ColumnType::UInt8: result = std::snprintf(buf, bufLen, "%u", static_cast<unsigned>(readLe(ptr))); break;
+        case ColumnType::Int16: result = std::snprintf(buf, bufLen, "%d", static_cast<int>(static_cast<std::int16_t>(readLe(ptr)))); break;
+        case ColumnType::UInt16: result = std::snprintf(buf, bufLen, "%u", static_cast<unsigned>(readLe(ptr))); break;
+        case ColumnType::Int32: result = std::snprintf(buf, bufLen, "%" PRId32, static_cast<std::int32_t>(readLe(ptr))); break;
+        case ColumnType::UInt32: result = std::snprintf(buf, bufLen, "%" PRIu32, static_cast<std::uint32_t>(readLe(ptr))); break;
+        case ColumnType::Int64: result = std::snprintf(buf, bufLen, "%" PRId64, static_cast<std::int64_t>(readLe(ptr))); break;
+        case ColumnType::UInt64: result = std::snprintf(buf, bufLen, "%" PRIu64, readLe(ptr)); break;
+        case ColumnType::Float:
+        {
+            auto bits = static_cast<std::uint32_t>(readLe(ptr));
+            float value = 0.0f;
+            std::memcpy(&value, &bits, sizeof(value));
+            result = std::snprintf(buf, bufLen, "%.9g", static_cast<double>(value));
+            break;
+        }
+        case ColumnType::Double:
+        {
+            auto bits = readLe(ptr);
+            double value = 0.0;
+            std::memcpy(&value, &bits, sizeof(value));
+            result = std::snprintf(buf, bufLen, "%.17g", value);
+            break;
+        }
+        default: break;
+        }
+
+        if ((result < 0) || (bufLen == 0U)) {
+            return 0U;
+        }
+
+        auto len = static_cast<std::size_t>(result);
+        return (len < bufLen) ? len : (bufLen - 1U);
+    }
+
+    /// @brief Remove all the values, keeps the allocated memory.
+    void clear()
+    {
+        m_data.clear();
+    }
+
+    /// @brief Reserve memory for the values.
+    void reserve(std::size_t count)
+    {
+        m_data.reserve(count * m_valueSize);
+    }
+
+private:
+    template <typename T>
+    void appendInt(T value)
+    {
+        auto bits = static_cast<std::uint64_t>(value);
+        for (std::size_t idx = 0U; idx < sizeof(T); ++idx) {
+            m_data.push_back(static_cast<std::uint8_t>(bits >> (idx * 8U)));
+        }
+    }
+
+    void appendFloat(float value)
+    {
+        std::uint32_t bits = 0U;
+        std::memcpy(&bits, &value, sizeof(bits));
+        appendInt(bits);
+    }
+
+    void appendFloat(double value)
+    {
+        std::uint64_t bits = 0U;
+        std::memcpy(&bits, &value, sizeof(bits));
+        appendInt(bits);
+    }
+
+    std::uint64_t readLe(const std::uint8_t* ptr) const
+    {
+        std::uint64_t value = 0U;
+        for (std::size_t idx = 0U; idx < m_valueSize; ++idx) {
+            value |= static_cast<std::uint64_t>(ptr[idx]) << (idx * 8U);
+        }
+        return value;
+    }
+
+    std::string m_name;
+    ColumnType m_type = ColumnType::Double;
+    std::size_t m_valueSize = 0U;
+    std::vector<std::uint8_t> m_data;
+};
+
+/// @brief Batch of rows stored as columns.
+class ColumnTable
+{
+public:
+    /// @brief Add the column.
+    /// @return Index of the added column.
+    std::size_t addColumn(const std::string& name, ColumnType type)
+    {
+        m_columns.emplace_back(name, type);
+        return m_columns.size() - 1U;
+    }
+
+    /// @brief Number of columns.
+    std::size_t columnsCount() const
+    {
+        return m_columns.size();
+    }
+
+    /// @brief Access the column.
+    Column& column(std::size_t idx)
+    {
+        return m_columns[idx];
+    }
+
+    /// @brief Access the column.
+    const Column& column(std::size_t idx) const
+    {
+        return m_columns[idx];
+    }
+
+    /// @brief Number of complete rows.
+    std::size_t rows() const
+    {
+        return m_rows;
+    }
+
+    /// @brief Report that the values of all the columns have been
+    ///     appended for the new row.
+    void commitRow()
+    {
+        ++m_rows;
+    }
+
+    /// @brief Remove all the rows, keeps the columns and allocated memory.
+    void clear()
+    {
+        for (auto& col : m_columns) {
+            col.clear();
+        }
+        m_rows = 0U;
+    }
+
+    /// @brief Reserve memory for the rows.
+    void reserve(std::size_t rowsCount)
+    {
+        for (auto& col : m_columns) {
+            col.reserve(rowsCount);
+        }
+    }
+
+private:
+    std::vector<Column> m_columns;
+    std::size_t m_rows = 0U;
+};
+
+} // namespace columnar
+
+}  // namespace ublox
+
+
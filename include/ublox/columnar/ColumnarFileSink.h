@@ -0,0 +1,172 @@
+//
+// Copyright 2018 (C). Alex Robenko. All rights reserved.
+//
+
+// This file is free software: you can redistribute it and/or modify
+// it under the terms of the GNU General Public License as published by
+// the Free Software Foundation, either version 3 of the License, or
+// (at your option) any later version.
+//
+// This program is distributed in the hope that it will be useful,
+// but WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+// GNU General Public License for more details.
+//
+// You should have received a copy of the GNU General Public License
+// along with this program.  If not, see <http://www.gnu.org/licenses/>.
+
+/// @file
+/// @brief Contains definition of ublox::columnar::ColumnarFileSink class.
+
+#pragma once
+
+#include <cstdint>
+#include <cstddef>
+#include <cstdio>
+
+#include "Column.h"
+
+namespace ublox
+{
+
+namespace columnar
+{
+
+/// @brief Writer of the binary columnar file.
+/// @details The file consists of:
+///     @li header: magic "UCOL", format version (2 bytes), number of
+///         columns (2 bytes), followed by the description of every column:
+///         type code (1 byte, see @ref ColumnType), length of the name
+///         (1 byte) and the name itself (without terminating zero);
+///     @li batches: number of rows in the batch (4 bytes, non-zero),
+///         followed by the values of every column in order of the columns,
+///         i.e. the values of the single column within the batch are
+///         contiguous and can be loaded without any parsing;
+///     @li terminator: number of rows equal to zero.
+///
+///     All the numeric values are little endian, the floating point values
+///     are IEEE 754. The file is closed on destruction.
+class ColumnarFileSink
+{
+public:
+    /// @brief Version of the format.
+    static const std::uint16_t FormatVersion = 1U;
+
+    /// @brief Default constructor
+    ColumnarFileSink() = default;
+
+    /// @brief Copy constructor is deleted
+    ColumnarFileSink(const ColumnarFileSink&) = delete;
+
+    /// @brief Destructor
+    ~ColumnarFileSink()
+    {
+        close();
+    }
+
+    /// @brief Copy assignment is deleted
+    ColumnarFileSink& operator=(const ColumnarFileSink&) = delete;
+
+    /// @brief Create the file, truncates the existing one.
+    /// @return @b true on success.
+    bool open(const char* path)
+    {
+        close();
+        m_file = std::fopen(path, "wb");
+        return m_file != nullptr;
+    }
+
+    /// @brief Write the terminator and close the file.
+    /// @return @b true on success.
+    bool close()
+    {
+        if (m_file == nullptr) {
+            return true;
+        }
+
+        bool result = true;
+        if (m_headerWritten) {
+            result = writeLe(0U, 4U);
+        }
+
+        result = (std::fclose(m_file) == 0) && result;
+        m_file = nullptr;
+        m_headerWritten = false;
+        return result;
+    }
+
+    /// @brief Check whether the file is open.
+    bool isOpen() const
+    {
+        return m_file != nullptr;
+    }
+
+    /// @brief Write description of the columns.
+    /// @return @b true on success.
+    bool writeHeader(const ColumnTable& table)
+    {
+        if ((m_file == nullptr) || (0xffffU < table.columnsCount())) {
+            return false;
+        }
+
+        bool result =
+            (std::fwrite("UCOL", 1U, 4U, m_file) == 4U) &&
+            writeLe(FormatVersion, 2U) &&
+            writeLe(table.columnsCount(), 2U);
+
+        for (std::size_t idx = 0U; result && (idx < table.columnsCount()); ++idx) {
+            auto& col = table.column(idx);
+            auto nameLen = col.name().size();
+            if (0xffU < nameLen) {
+                nameLen = 0xffU;
+            }
+
+            result =
+                writeLe(static_cast<std::uint8_t>(col.type()), 1U) &&
+                writeLe(nameLen, 1U) &&
+                (std::fwrite(col.name().data(), 1U, nameLen, m_file) == nameLen);
+        }
+
+        m_headerWritten = result;
+        return result;
+    }
+
+    /// @brief Write the rows stored in the table as a single batch.
+    /// @return @b true on success.
+    bool writeBatch(const ColumnTable& table)
+    {
+        if ((m_file == nullptr) || (!m_headerWritten)) {
+            return false;
+        }
+
+        if (table.rows() == 0U) {
+            return true;
+        }
+
+        bool result = writeLe(table.rows(), 4U);
+        for (std::size_t idx = 0U; result && (idx < table.columnsCount()); ++idx) {
+            auto& col = table.column(idx);
+            result = (std::fwrite(col.data(), 1U, col.dataLen(), m_file) == col.dataLen());
+        }
+        return result;
+    }
+
+private:
+    bool writeLe(std::uint64_t value, std::size_t len)
+    {
+        std::uint8_t buf[8];
+        for (std::size_t idx = 0U; idx < len; ++idx) {
+            buf[idx] = static_cast<std::uint8_t>(value >> (idx * 8U));
+        }
+        return std::fwrite(&buf[0], 1U, len, m_file) == len;
+    }
+
+    std::FILE* m_file = nullptr;
+    bool m_headerWritten = false;
+};
+
+} // namespace columnar
+
+}  // namespace ublox
+
+
@@ -0,0 +1,146 @@
+//
+// Copyright 2018 (C). Alex Robenko. All rights reserved.
+//
+
+// This file is free software: you can redistribute it and/or modify
+// it under the terms of the GNU General Public License as published by
+// the Free Software Foundation, either version 3 of the License, or
+// (at your option) any later version.
+//
+// This program is distributed in the hope that it will be useful,
+// but WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+// GNU General Public License for more details.
+//
+// You should have received a copy of the GNU General Public License
+// along with this program.  If not, see <http://www.gnu.org/licenses/>.
+
+/// @file
+/// @brief Contains definition of ublox::columnar::CsvSink class.
+
+#pragma once
+
+#include <cstdint>
+#include <cstddef>
+#include <cstdio>
+#include <vector>
+
+#include "Column.h"
+
+namespace ublox
+{
+
+namespace columnar
+{
+
+/// @brief Writer of the CSV file.
+/// @details The first line contains the names of the columns, every
+///     following line contains a single row. The integer values are
+///     written as is, the floating point ones with the precision required
+///     for exact round trip. The file is closed on destruction.
+class CsvSink
+{
+public:
+    /// @brief Default constructor
+    CsvSink() = default;
+
+    /// @brief Copy constructor is deleted
+    CsvSink(const CsvSink&) = delete;
+
+    /// @brief Destructor
+    ~CsvSink()
+    {
+        close();
+    }
+
+    /// @brief Copy assignment is deleted
+    CsvSink& operator=(const CsvSink&) = delete;
+
+    /// @brief Create the file, truncates the existing one.
+    /// @return @b true on success.
+    bool open(const char* path)
+    {
+        close();
+        m_file = std::fopen(path, "w");
+        return m_file != nullptr;
+    }
+
+    /// @brief Close the file.
+    /// @return @b true on success.
+    bool close()
+    {
+        if (m_file == nullptr) {
+            return true;
+        }
+
+        auto result = (std::fclose(m_file) == 0);
+        m_file = nullptr;
+        return result;
+    }
+
+    /// @brief Check whether the file is open.
+    bool isOpen() const
+    {
+        return m_file != nullptr;
+    }
+
+    /// @brief Write the line with names of the columns.
+    /// @return @b true on success.
+    bool writeHeader(const ColumnTable& table)
+    {
+        if (m_file == nullptr) {
+            return false;
+        }
+
+        m_line.clear();
+        for (std::size_t idx = 0U; idx < table.columnsCount(); ++idx) {
+            if (idx != 0U) {
+                m_line.push_back(',');
+            }
+
+            auto& name = table.column(idx).name();
+            m_line.insert(m_line.end(), name.begin(), name.end());
+        }
+
+        m_line.push_back('\n');
+        return std::fwrite(m_line.data(), 1U, m_line.size(), m_file) == m_line.size();
+    }
+
+    /// @brief Write the rows stored in the table.
+    /// @return @b true on success.
+    bool writeBatch(const ColumnTable& table)
+    {
+        if (m_file == nullptr) {
+            return false;
+        }
+
+        for (std::size_t row = 0U; row < table.rows(); ++row) {
+            m_line.clear();
+            for (std::size_t idx = 0U; idx < table.columnsCount(); ++idx) {
+                if (idx != 0U) {
+                    m_line.push_back(',');
+                }
+
+                char buf[32];
+                auto len = table.column(idx).format(row, &buf[0], sizeof(buf));
+                m_line.insert(m_line.end(), &buf[0], &buf[0] + len);
+            }
+
+            m_line.push_back('\n');
+            if (std::fwrite(m_line.data(), 1U, m_line.size(), m_file) != m_line.size()) {
+                return false;
+            }
+        }
+        return true;
+    }
+
+private:
+    std::FILE* m_file = nullptr;
+    std::vector<char> m_line;
+};
+
+} // namespace columnar
+
+}  // namespace ublox
+
+
@@ -0,0 +1,336 @@
+//
+// Copyright 2018 (C). Alex Robenko. All rights reserved.
+//
+
+// This file is free software: you can redistribute it and/or modify
+// it under the terms of the GNU General Public License as published by
+// the Free Software Foundation, either version 3 of the License, or
+// (at your option) any later version.
+//
+// This program is distributed in the hope that it will be useful,
+// but WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+// GNU General Public License for more details.
+//
+// You should have received a copy of the GNU General Public License
+// along with this program.  If not, see <http://www.gnu.org/licenses/>.
+
+/// @file
+/// @brief Contains definition of ublox::columnar::MsgExporter class.
+
+#pragma once
+
+#include <cstdint>
+#include <cstddef>
+#include <functional>
+#include <limits>
+#include <string>
+#include <tuple>
+#include <type_traits>
+#include <vector>
+
+#include "Column.h"
+
+/// @brief Add column with the value of the message field.
+/// @details The field is referenced by the name used in
+///     @b COMMS_MSG_FIELDS_ACCESS() in the message definition, which is also
+///     used as the name of the column.
+/// @param[in] exporter_ Object of @ref ublox::columnar::MsgExporter type.
+/// @param[in] name_ Name of the field.
+#define UBLOX_COLUMNAR_FIELD(exporter_, name_) \
+    (exporter_).template addField<std::decay<decltype(exporter_)>::type::Message::FieldIdx_ ## name_>(#name_)
+
+/// @brief Same as @ref UBLOX_COLUMNAR_FIELD(), but the scaled value
+///     (see @b getScaled()) of the field is stored as @b double.
+#define UBLOX_COLUMNAR_SCALED_FIELD(exporter_, name_) \
+    (exporter_).template addScaledField<std::decay<decltype(exporter_)>::type::Message::FieldIdx_ ## name_>(#name_)
+
+/// @brief Add column with the value of the member field of the list element.
+/// @details The member is referenced by the name used in
+///     @b COMMS_FIELD_MEMBERS_ACCESS() in the definition of the list element,
+///     which is also used as the name of the column.
+/// @param[in] exporter_ Object of @ref ublox::columnar::MsgExporter type.
+/// @param[in] name_ Name of the member field.
+#define UBLOX_COLUMNAR_ELEMENT_FIELD(exporter_, name_) \
+    (exporter_).template addElementField<std::decay<decltype(exporter_)>::type::Element::FieldIdx_ ## name_>(#name_)
+
+/// @brief Same as @ref UBLOX_COLUMNAR_ELEMENT_FIELD(), but the scaled value
+///     (see @b getScaled()) of the member field is stored as @b double.
+#define UBLOX_COLUMNAR_SCALED_ELEMENT_FIELD(exporter_, name_) \
+    (exporter_).template addScaledElementField<std::decay<decltype(exporter_)>::type::Element::FieldIdx_ ## name_>(#name_)
+
+namespace ublox
+{
+
+namespace columnar
+{
+
+/// @brief Value of the list index parameter of @ref MsgExporter meaning
+///     "single row per message".
+static const std::size_t NoList = std::numeric_limits<std::size_t>::max();
+
+namespace details
+{
+
+template <typename TMsg, std::size_t TListIdx, bool THasList>
+struct MsgExporterElement
+{
+    struct Type {};
+
+    template <typename TFunc>
+    static void forEach(const TMsg& msg, TFunc&& func)
+    {
+        static_cast<void>(msg);
+        func(nullptr);
+    }
+};
+
+template <typename TMsg, std::size_t TListIdx>
+struct MsgExporterElement<TMsg, TListIdx, true>
+{
+    using ListField = typename std::tuple_element<TListIdx, typename TMsg::AllFields>::type;
+    using Type = typename ListField::ValueType::value_type;
+
+    template <typename TFunc>
+    static void forEach(const TMsg& msg, TFunc&& func)
+    {
+        for (auto& elem : std::get<TListIdx>(msg.fields()).value()) {
+            func(&elem);
+        }
+    }
+};
+
+} // namespace details
+
+/// @brief Accumulator of the message fields in the typed column buffers.
+/// @details Every handled message appends a row (or a row per element of
+///     the list field when @b TListIdx is provided) to the columns. When the
+///     number of accumulated rows reaches the batch size, the batch is
+///     written to the sink and the columns are cleared, i.e. the memory
+///     consumption is bounded regardless of the amount of exported
+///     messages.@n
+///     The columns are selected by the names of the fields (see
+///     @ref UBLOX_COLUMNAR_FIELD() and @ref UBLOX_COLUMNAR_ELEMENT_FIELD())
+///     or computed by custom functions (see addColumn() and addElementColumn()).
+///     All the columns must be added before the first message is handled.
+///     The message level columns are repeated for every element of the list.
+/// @tparam TMsg Type of the exported message.
+/// @tparam TSink Type of the sink, @ref ColumnarFileSink or @ref CsvSink.
+/// @tparam TListIdx Index of the list field (@b FieldIdx_* value
+///     of the message), every element of which is exported as separate row.
+template <typename TMsg, typename TSink, std::size_t TListIdx = NoList>
+class MsgExporter
+{
+    using ElementHelper = details::MsgExporterElement<TMsg, TListIdx, TListIdx != NoList>;
+
+public:
+    /// @brief Type of the exported message.
+    using Message = TMsg;
+
+    /// @brief Type of the list element (when @b TListIdx is provided).
+    using Element = typename ElementHelper::Type;
+
+    /// @brief Default number of rows in the batch.
+    static const std::size_t DefaultBatchSize = 64U * 1024U;
+
+    /// @brief Constructor
+    /// @param[in] sink Sink of the batches, must outlive the exporter.
+    /// @param[in] batchSize Number of rows in the batch.
+    explicit MsgExporter(TSink& sink, std::size_t batchSize = DefaultBatchSize)
+      : m_sink(sink),
+        m_batchSize((batchSize == 0U) ? 1U : batchSize)
+    {
+    }
+
+    /// @brief Add column with the value of the message field.
+    /// @details Prefer using @ref UBLOX_COLUMNAR_FIELD() macro.
+    /// @tparam TFieldIdx Index of the field.
+    /// @return @b false in case the export has already started.
+    template <std::size_t TFieldIdx>
+    bool addField(const std::string& name)
+    {
+        using Field = typename std::tuple_element<TFieldIdx, typename TMsg::AllFields>::type;
+        using Value = ColumnValueType<typename Field::ValueType>;
+        return addColumn(
+            name,
+            [](const TMsg& msg) -> Value
+            {
+                return static_cast<Value>(std::get<TFieldIdx>(msg.fields()).value());
+            });
+    }
+
+    /// @brief Add column with the scaled value of the message field.
+    /// @details Prefer using @ref UBLOX_COLUMNAR_SCALED_FIELD() macro.
+    /// @tparam TFieldIdx Index of the field.
+    /// @return @b false in case the export has already started.
+    template <std::size_t TFieldIdx>
+    bool addScaledField(const std::string& name)
+    {
+        return addColumn(
+            name,
+            [](const TMsg& msg) -> double
+            {
+                return std::get<TFieldIdx>(msg.fields()).template getScaled<double>();
+            });
+    }
+
+    /// @brief Add column with the value of the member field of the list element.
+    /// @details Prefer using @ref UBLOX_COLUMNAR_ELEMENT_FIELD() macro.
+    /// @tparam TMemberIdx Index of the member field.
+    /// @return @b false in case the export has already started.
+    template <std::size_t TMemberIdx>
+    bool addElementField(const std::string& name)
+    {
+        using Field = typename std::tuple_element<TMemberIdx, typename Element::ValueType>::type;
+        using Value = ColumnValueType<typename Field::ValueType>;
+        return addElementColumn(
+            name,
+            [](const Element& elem) -> Value
+            {
+                return static_cast<Value>(std::get<TMemberIdx>(elem.value()).value());
+            });
+    }
+
+    /// @brief Add column with the scaled value of the member field of the list element.
+    /// @details Prefer using @ref UBLOX_COLUMNAR_SCALED_ELEMENT_FIELD() macro.
+    /// @tparam TMemberIdx Index of the member field.
+    /// @return @b false in case the export has already started.
+    template <std::size_t TMemberIdx>
+    bool addScaledElementField(const std::string& name)
+    {
+        return addElementColumn(
+            name,
+            [](const Element& elem) -> double
+            {
+                return std::get<TMemberIdx>(elem.value()).template getScaled<double>();
+            });
+    }
+
+    /// @brief Add column with the value computed out of the message.
+    /// @details The function is expected to have the following signature:
+    ///     @code
+    ///     T func(const Message& msg);
+    ///     @endcode
+    ///     where @b T is numeric type (or enum) determining type of the column.
+    /// @return @b false in case the export has already started.
+    template <typename TFunc>
+    bool addColumn(const std::string& name, TFunc&& func)
+    {
+        using Value = ColumnValueType<typename std::decay<decltype(func(std::declval<const TMsg&>()))>::type>;
+        if (m_started) {
+            return false;
+        }
+
+        auto idx = m_table.addColumn(name, ColumnTypeOf<Value>::Value);
+        typename std::decay<TFunc>::type funcCopy(std::forward<TFunc>(func));
+        m_appenders.push_back(
+            [idx, funcCopy](const TMsg& msg, const Element* elem, ColumnTable& table)
+            {
+                static_cast<void>(elem);
+                table.column(idx).append(static_cast<Value>(funcCopy(msg)));
+            });
+        return true;
+    }
+
+    /// @brief Add column with the value computed out of the list element.
+    /// @details The function is expected to have the following signature:
+    ///     @code
+    ///     T func(const Element& elem);
+    ///     @endcode
+    ///     where @b T is numeric type (or enum) determining type of the column.
+    /// @return @b false in case the export has already started.
+    template <typename TFunc>
+    bool addElementColumn(const std::string& name, TFunc&& func)
+    {
+        static_assert(TListIdx != NoList, "The list field index must be provided");
+        using Value = ColumnValueType<typename std::decay<decltype(func(std::declval<const Element&>()))>::type>;
+        if (m_started) {
+            return false;
+        }
+
+        auto idx = m_table.addColumn(name, ColumnTypeOf<Value>::Value);
+        typename std::decay<TFunc>::type funcCopy(std::forward<TFunc>(func));
+        m_appenders.push_back(
+            [idx, funcCopy](const TMsg& msg, const Element* elem, ColumnTable& table)
+            {
+                static_cast<void>(msg);
+                table.column(idx).append(static_cast<Value>(funcCopy(*elem)));
+            });
+        return true;
+    }
+
+    /// @brief Append the row(s) of the message.
+    /// @return @b false in case writing of the batch has failed.
+    bool handle(const TMsg& msg)
+    {
+        if (!m_started) {
+            m_started = true;
+            m_table.reserve(m_batchSize);
+        }
+
+        ElementHelper::forEach(
+            msg,
+            [this, &msg](const Element* elem)
+            {
+                for (auto& appender : m_appenders) {
+                    appender(msg, elem, m_table);
+                }
+                m_table.commitRow();
+            });
+
+        if (m_table.rows() < m_batchSize) {
+            return m_good;
+        }
+
+        return flush();
+    }
+
+    /// @brief Write the accumulated rows to the sink.
+    /// @return @b false in case writing has failed (now or previously).
+    bool flush()
+    {
+        if (!m_headerWritten) {
+            m_headerWritten = true;
+            m_good = m_sink.writeHeader(m_table) && m_good;
+        }
+
+        if (m_table.rows() == 0U) {
+            return m_good;
+        }
+
+        m_good = m_sink.writeBatch(m_table) && m_good;
+        m_rowsCount += m_table.rows();
+        m_table.clear();
+        return m_good;
+    }
+
+    /// @brief Total number of rows written to the sink.
+    std::size_t rowsCount() const
+    {
+        return m_rowsCount;
+    }
+
+    /// @brief Access the accumulated rows.
+    const ColumnTable& table() const
+    {
+        return m_table;
+    }
+
+private:
+    using Appender = std::function<void (const TMsg&, const Element*, ColumnTable&)>;
+
+    TSink& m_sink;
+    std::size_t m_batchSize = DefaultBatchSize;
+    ColumnTable m_table;
+    std::vector<Appender> m_appenders;
+    std::size_t m_rowsCount = 0U;
+    bool m_started = false;
+    bool m_headerWritten = false;
+    bool m_good = true;
+};
+
+} // namespace columnar
+
+}  // namespace ublox
+
+
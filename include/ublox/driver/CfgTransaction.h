@@ -0,0 +1,374 @@
+//
+// Copyright 2018 (C). Alex Robenko. All rights reserved.
+//
+
+// This file is free software: you can redistribute it and/or modify
+// it under the terms of the GNU General Public License as published by
+// the Free Software Foundation, either version 3 of the License, or
+// (at your option) any later version.
+//
+// This program is distributed in the hope that it will be useful,
+// but WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+// GNU General Public License for more details.
+//
+// You should have received a copy of the GNU General Public License
+// along with this program.  If not, see <http://www.gnu.org/licenses/>.
+
+/// @file
+/// @brief Contains definition of ublox::driver::CfgTransaction class.
+
+#pragma once
+
+#include <cstdint>
+#include <cstddef>
+#include <chrono>
+#include <limits>
+#include <vector>
+
+#include "comms/ErrorStatus.h"
+
+#include "ublox/MsgId.h"
+#include "ublox/FrameWriter.h"
+#include "ublox/protocol/ChecksumCalc.h"
+
+namespace ublox
+{
+
+namespace driver
+{
+
+/// @brief Status of the single configuration message in @ref CfgTransaction.
+enum class CfgStatus : std::uint8_t
+{
+    Queued, ///< Waiting to be sent (or re-sent)
+    InFlight, ///< Sent, waiting for acknowledgement
+    Acked, ///< Acknowledged with ACK-ACK
+    Nacked, ///< Rejected with ACK-NAK
+    TimedOut, ///< Not acknowledged after all the attempts
+    NumOfValues ///< Number of available values, must be last
+};
+
+/// @brief Pipelined transaction of multiple configuration messages.
+/// @details Keeps up to the configured number of CFG messages outstanding at
+///     the same time, instead of waiting for ACK-ACK / ACK-NAK after every
+///     one of them. The acknowledgements carry only class and ID of
+///     the acknowledged message, but the receiver acknowledges the messages
+///     in order of their reception. Hence several messages with the same
+///     class and ID (such as multiple CFG-MSG) may be outstanding at the
+///     same time, and every acknowledgement is attributed to the one which
+///     was sent first. The messages which are not acknowledged within
+///     the timeout are re-sent until the maximal number of attempts is
+///     exhausted. The messages are sent in order of addition, the message
+///     being re-sent keeps its position, i.e. it is sent before any
+///     following message which hasn't been sent yet.@n
+///     The object doesn't perform any I/O and doesn't measure time on its
+///     own: the frames are handed to the provided send functor in
+///     process(), the acknowledgements are reported using ackReceived()
+///     and nakReceived(). Therefore one object per receiver allows
+///     configuration of many receivers in parallel from a single thread.
+class CfgTransaction
+{
+public:
+    /// @brief Clock used for timeouts.
+    using Clock = std::chrono::steady_clock;
+
+    /// @brief Time point type.
+    using TimePoint = Clock::time_point;
+
+    /// @brief Duration type.
+    using Duration = Clock::duration;
+
+    /// @brief Default number of messages waiting for acknowledgement at the same time.
+    static const std::size_t DefaultWindow = 8U;
+
+    /// @brief Constructor
+    /// @param[in] window Maximal number of messages waiting for acknowledgement
+    ///     at the same time.
+    explicit CfgTransaction(std::size_t window = DefaultWindow)
+      : m_window(window == 0U ? 1U : window)
+    {
+    }
+
+    /// @brief Set acknowledgement timeout, default is 1 second.
+    void setTimeout(Duration value)
+    {
+        m_timeout = value;
+    }
+
+    /// @brief Set maximal number of send attempts for every message, default is 3.
+    void setMaxAttempts(unsigned value)
+    {
+        m_maxAttempts = (value == 0U) ? 1U : value;
+    }
+
+    /// @brief Add configuration message to the transaction.
+    /// @details The message is serialised immediately using @ref ublox::writeFrame().
+    /// @return Status of the serialisation.
+    template <typename TMsg>
+    comms::ErrorStatus add(const TMsg& msg)
+    {
+        static const std::size_t MaxFrameLen = std::numeric_limits<std::uint16_t>::max() + 8U;
+        auto offset = m_data.size();
+        std::size_t capacity = 256U;
+        while (true) {
+            m_data.resize(offset + capacity);
+            auto* iter = &m_data[offset];
+            auto es = writeFrame(msg, iter, capacity);
+            if (es == comms::ErrorStatus::Success) {
+                auto len = static_cast<std::size_t>(iter - &m_data[offset]);
+                m_data.resize(offset + len);
+                addEntry(offset, len);
+                return es;
+            }
+
+            if ((es != comms::ErrorStatus::BufferOverflow) || (MaxFrameLen <= capacity)) {
+                m_data.resize(offset);
+                return es;
+            }
+
+            capacity *= 2U;
+        }
+    }
+
+    /// @brief Add already serialised configuration frame to the transaction.
+    /// @param[in] frame Pointer to the complete frame.
+    /// @param[in] len Length of the frame.
+    /// @return @b comms::ErrorStatus::Success on success,
+    ///     @b comms::ErrorStatus::ProtocolError if the frame is not properly
+    ///     wrapped, i.e. wrong sync characters, length field not matching
+    ///     @b len or invalid checksum.
+    comms::ErrorStatus addFrame(const std::uint8_t* frame, std::size_t len)
+    {
+        static const std::size_t MinFrameLen = 8U;
+        if ((len < MinFrameLen) || (frame[0] != 0xb5) || (frame[1] != 0x62)) {
+            return comms::ErrorStatus::ProtocolError;
+        }
+
+        auto payloadLen =
+            static_cast<std::size_t>(frame[4]) |
+            (static_cast<std::size_t>(frame[5]) << std::numeric_limits<std::uint8_t>::digits);
+
+        if ((len - MinFrameLen) != payloadLen) {
+            return comms::ErrorStatus::ProtocolError;
+        }
+
+        const std::uint8_t* checksumIter = frame + 2U;
+        auto expected = protocol::ChecksumCalc()(checksumIter, len - 4U);
+        auto actual =
+            static_cast<std::uint16_t>(
+                checksumIter[0] |
+                (static_cast<unsigned>(checksumIter[1]) << std::numeric_limits<std::uint8_t>::digits));
+
+        if (expected != actual) {
+            return comms::ErrorStatus::ProtocolError;
+        }
+
+        auto offset = m_data.size();
+        m_data.insert(m_data.end(), frame, frame + len);
+        addEntry(offset, len);
+        return comms::ErrorStatus::Success;
+    }
+
+    /// @brief Send pending messages and handle timeouts.
+    /// @details Expected to be called periodically as well as after
+    ///     every reported acknowledgement.
+    /// @param[in] now Current time.
+    /// @param[in] sendFunc Functor with <b>void (const std::uint8_t* frame, std::size_t len)</b>
+    ///     signature used to write the frame to the receiver.
+    /// @return Number of sent frames.
+    template <typename TSendFunc>
+    std::size_t process(TimePoint now, TSendFunc&& sendFunc)
+    {
+        for (auto& entry : m_entries) {
+            if ((entry.m_status != CfgStatus::InFlight) ||
+                ((now - entry.m_sentTime) < m_timeout)) {
+                continue;
+            }
+
+            --m_inFlight;
+            if (m_maxAttempts <= entry.m_attempts) {
+                entry.m_status = CfgStatus::TimedOut;
+                ++m_completed;
+                continue;
+            }
+
+            entry.m_status = CfgStatus::Queued;
+        }
+
+        std::size_t sent = 0U;
+        for (auto& entry : m_entries) {
+            if (m_window <= m_inFlight) {
+                break;
+            }
+
+            if (entry.m_status != CfgStatus::Queued) {
+                continue;
+            }
+
+            sendFunc(&m_data[entry.m_offset], entry.m_length);
+            entry.m_status = CfgStatus::InFlight;
+            entry.m_sentTime = now;
+            entry.m_sendSeq = m_sendSeq;
+            ++m_sendSeq;
+            ++entry.m_attempts;
+            ++m_inFlight;
+            ++sent;
+        }
+
+        return sent;
+    }
+
+    /// @brief Report reception of ACK-ACK message.
+    /// @param[in] id Value of the "id" field of the ACK-ACK message.
+    /// @return @b true in case the acknowledgement has been attributed
+    ///     to one of the outstanding messages, @b false otherwise.
+    bool ackReceived(MsgId id)
+    {
+        return acknowledge(id, CfgStatus::Acked);
+    }
+
+    /// @brief Report reception of ACK-NAK message.
+    /// @param[in] id Value of the "id" field of the ACK-NAK message.
+    /// @return @b true in case the acknowledgement has been attributed
+    ///     to one of the outstanding messages, @b false otherwise.
+    bool nakReceived(MsgId id)
+    {
+        return acknowledge(id, CfgStatus::Nacked);
+    }
+
+    /// @brief Check whether all the messages have been either acknowledged,
+    ///     rejected or timed out.
+    bool done() const
+    {
+        return m_completed == m_entries.size();
+    }
+
+    /// @brief Check whether all the messages have been acknowledged with ACK-ACK.
+    bool succeeded() const
+    {
+        return done() && (count(CfgStatus::Acked) == m_entries.size());
+    }
+
+    /// @brief Total number of messages in the transaction.
+    std::size_t size() const
+    {
+        return m_entries.size();
+    }
+
+    /// @brief Number of messages with the specified status.
+    std::size_t count(CfgStatus status) const
+    {
+        std::size_t result = 0U;
+        for (auto& entry : m_entries) {
+            if (entry.m_status == status) {
+                ++result;
+            }
+        }
+        return result;
+    }
+
+    /// @brief Number of messages waiting for acknowledgement.
+    std::size_t inFlight() const
+    {
+        return m_inFlight;
+    }
+
+    /// @brief Status of the message.
+    /// @param[in] idx Index of the message in order of addition.
+    CfgStatus status(std::size_t idx) const
+    {
+        return m_entries[idx].m_status;
+    }
+
+    /// @brief ID of the message.
+    /// @param[in] idx Index of the message in order of addition.
+    MsgId msgId(std::size_t idx) const
+    {
+        return m_entries[idx].m_id;
+    }
+
+    /// @brief Number of times the message has been sent.
+    /// @param[in] idx Index of the message in order of addition.
+    unsigned attempts(std::size_t idx) const
+    {
+        return m_entries[idx].m_attempts;
+    }
+
+    /// @brief Remove all the messages.
+    void clear()
+    {
+        m_data.clear();
+        m_entries.clear();
+        m_inFlight = 0U;
+        m_completed = 0U;
+        m_sendSeq = 0U;
+    }
+
+private:
+    struct Entry
+    {
+        std::size_t m_offset = 0U;
+        std::size_t m_length = 0U;
+        TimePoint m_sentTime;
+        std::size_t m_sendSeq = 0U;
+        MsgId m_id = MsgId();
+        unsigned m_attempts = 0U;
+        CfgStatus m_status = CfgStatus::Queued;
+    };
+
+    void addEntry(std::size_t offset, std::size_t len)
+    {
+        Entry entry;
+        entry.m_offset = offset;
+        entry.m_length = len;
+        entry.m_id =
+            static_cast<MsgId>(
+                (static_cast<unsigned>(m_data[offset + 2U]) << std::numeric_limits<std::uint8_t>::digits) |
+                m_data[offset + 3U]);
+        m_entries.push_back(entry);
+    }
+
+    Entry* findOldestInFlight(MsgId id)
+    {
+        Entry* result = nullptr;
+        for (auto& entry : m_entries) {
+            if ((entry.m_status != CfgStatus::InFlight) || (entry.m_id != id)) {
+                continue;
+            }
+
+            if ((result == nullptr) || (entry.m_sendSeq < result->m_sendSeq)) {
+                result = &entry;
+            }
+        }
+        return result;
+    }
+
+    bool acknowledge(MsgId id, CfgStatus status)
+    {
+        auto* entry = findOldestInFlight(id);
+        if (entry == nullptr) {
+            return false;
+        }
+
+        entry->m_status = status;
+        --m_inFlight;
+        ++m_completed;
+        return true;
+    }
+
+    std::vector<std::uint8_t> m_data;
+    std::vector<Entry> m_entries;
+    Duration m_timeout = std::chrono::seconds(1);
+    std::size_t m_window = DefaultWindow;
+    std::size_t m_inFlight = 0U;
+    std::size_t m_completed = 0U;
+    std::size_t m_sendSeq = 0U;
+    unsigned m_maxAttempts = 3U;
+};
+
+} // namespace driver
+
+}  // namespace ublox
+
+
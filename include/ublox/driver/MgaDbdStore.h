@@ -0,0 +1,375 @@
+//
+// Copyright 2018 (C). Alex Robenko. All rights reserved.
+//
+
+// This file is free software: you can redistribute it and/or modify
+// it under the terms of the GNU General Public License as published by
+// the Free Software Foundation, either version 3 of the License, or
+// (at your option) any later version.
+//
+// This program is distributed in the hope that it will be useful,
+// but WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+// GNU General Public License for more details.
+//
+// You should have received a copy of the GNU General Public License
+// along with this program.  If not, see <http://www.gnu.org/licenses/>.
+
+/// @file
+/// @brief Contains definition of ublox::driver::MgaDbdStore class.
+
+#pragma once
+
+#include <cstdint>
+#include <cstddef>
+#include <array>
+#include <chrono>
+#include <limits>
+#include <vector>
+#include <utility>
+
+#include "comms/ErrorStatus.h"
+
+#include "ublox/MsgId.h"
+#include "ublox/FrameSpan.h"
+#include "ublox/PollFrame.h"
+#include "ublox/protocol/FrameScanner.h"
+#include "MgaUploader.h"
+
+namespace ublox
+{
+
+namespace driver
+{
+
+namespace details
+{
+
+inline std::uint32_t mgaDbdCrc32(const std::uint8_t* data, std::size_t len)
+{
+    struct Table
+    {
+        Table()
+        {
+            for (std::uint32_t idx = 0U; idx < m_values.size(); ++idx) {
+                auto value = idx;
+                for (auto bit = 0; bit < 8; ++bit) {
+                    value = (value >> 1) ^ ((value & 1U) != 0U ? 0xedb88320U : 0U);
+                }
+                m_values[idx] = value;
+            }
+        }
+
+        std::array<std::uint32_t, 256> m_values;
+    };
+
+    static const Table CrcTable;
+    std::uint32_t crc = 0xffffffffU;
+    for (std::size_t idx = 0U; idx < len; ++idx) {
+        crc = CrcTable.m_values[(crc ^ data[idx]) & 0xffU] ^ (crc >> 8);
+    }
+    return crc ^ 0xffffffffU;
+}
+
+} // namespace details
+
+/// @brief Status of the navigation database dump in @ref MgaDbdStore.
+enum class MgaDbdDumpStatus : std::uint8_t
+{
+    InProgress, ///< Waiting for more MGA-DBD messages
+    Complete, ///< Idle timeout expired after receiving MGA-DBD messages
+    Empty, ///< Idle timeout expired without receiving any MGA-DBD message
+    NumOfValues ///< Number of available values, must be last
+};
+
+/// @brief Storage of the receiver's navigation database for hot start.
+/// @details Collects all the MGA-DBD messages the receiver sends in
+///     response to MGA-DBD poll, serialises them into a compact blob to
+///     be saved on disk, and restores the database by streaming the loaded
+///     frames back to the receiver using @ref MgaUploader (with MGA-ACK
+///     credit window or pacing).@n
+///     The blob contains a 20 bytes header (magic "UDBD", format version,
+///     number of frames, length of the frames data and CRC-32 of the latter,
+///     all little endian), followed by the received frames as is, so
+///     they don't require any re-encoding on restore. The blob is validated
+///     on load: the header, the CRC-32 and the UBX checksum of every
+///     frame.@n
+///     The receiver doesn't mark the end of the dump, hence the dump is
+///     considered complete when no MGA-DBD message has been received within
+///     the configured idle timeout. The dump without any MGA-DBD message
+///     (for example the receiver didn't respond to the poll) is reported
+///     as empty.@n
+///     The object doesn't perform any I/O and doesn't measure time on its
+///     own.
+class MgaDbdStore
+{
+public:
+    /// @brief Clock used for timeouts and timing.
+    using Clock = std::chrono::steady_clock;
+
+    /// @brief Time point type.
+    using TimePoint = Clock::time_point;
+
+    /// @brief Duration type.
+    using Duration = Clock::duration;
+
+    /// @brief Length of the blob header.
+    static const std::size_t HeaderLen = 20U;
+
+    /// @brief Version of the blob format.
+    static const std::uint16_t FormatVersion = 1U;
+
+    /// @brief Constructor
+    /// @param[in] window Number of messages allowed to be sent without
+    ///     acknowledgement on restore, see @ref MgaUploader.
+    explicit MgaDbdStore(std::size_t window = MgaUploader::DefaultWindow)
+      : m_uploader(window)
+    {
+    }
+
+    /// @brief Set the time without MGA-DBD messages after which the dump is
+    ///     considered complete, default is 1 second.
+    void setIdleTimeout(Duration value)
+    {
+        m_idleTimeout = value;
+    }
+
+    /// @brief Start collection of the database dump.
+    /// @details Discards previously collected or loaded data.
+    /// @param[in] now Current time.
+    /// @return Frame of MGA-DBD poll message to be sent to the receiver.
+    FrameSpan startDump(TimePoint now)
+    {
+        m_frames.clear();
+        m_frameCount = 0U;
+        m_dumping = true;
+        m_dumpStart = now;
+        m_lastFrame = now;
+        m_dumpDuration = Duration::zero();
+        return poll::MgaDbdPoll::span();
+    }
+
+    /// @brief Report received frame.
+    /// @details Expected to be called for every received frame while the
+    ///     dump is in progress, the frames other than MGA-DBD are ignored.
+    /// @param[in] frame Pointer to the complete valid frame.
+    /// @param[in] len Length of the frame.
+    /// @param[in] now Current time.
+    /// @return @b true in case the frame has been stored.
+    bool frameReceived(const std::uint8_t* frame, std::size_t len, TimePoint now)
+    {
+        if ((!m_dumping) ||
+            (len <= Scanner::MinFrameLen) ||
+            (frame[2] != DbdClassId) ||
+            (frame[3] != DbdMsgId)) {
+            return false;
+        }
+
+        m_frames.insert(m_frames.end(), frame, frame + len);
+        ++m_frameCount;
+        m_lastFrame = now;
+        return true;
+    }
+
+    /// @brief Get status of the dump, finishes it if the idle timeout has expired.
+    /// @param[in] now Current time.
+    MgaDbdDumpStatus dumpStatus(TimePoint now)
+    {
+        if (m_dumping && (m_idleTimeout <= (now - m_lastFrame))) {
+            m_dumping = false;
+            m_dumpDuration = m_lastFrame - m_dumpStart;
+        }
+
+        if (m_dumping) {
+            return MgaDbdDumpStatus::InProgress;
+        }
+
+        if (m_frameCount == 0U) {
+            return MgaDbdDumpStatus::Empty;
+        }
+
+        return MgaDbdDumpStatus::Complete;
+    }
+
+    /// @brief Time between the start of the dump and the last received MGA-DBD message.
+    Duration dumpDuration() const
+    {
+        return m_dumpDuration;
+    }
+
+    /// @brief Number of stored MGA-DBD frames.
+    std::size_t frameCount() const
+    {
+        return m_frameCount;
+    }
+
+    /// @brief Serialise the collected database into the blob.
+    std::vector<std::uint8_t> serialise() const
+    {
+        std::vector<std::uint8_t> blob(HeaderLen);
+        blob[0] = 'U';
+        blob[1] = 'D';
+        blob[2] = 'B';
+        blob[3] = 'D';
+        writeLe(&blob[4], FormatVersion, 2U);
+        writeLe(&blob[6], 0U, 2U);
+        writeLe(&blob[8], static_cast<std::uint32_t>(m_frameCount), 4U);
+        writeLe(&blob[12], static_cast<std::uint32_t>(m_frames.size()), 4U);
+        auto crc = m_frames.empty() ? 0U : details::mgaDbdCrc32(&m_frames[0], m_frames.size());
+        writeLe(&blob[16], crc, 4U);
+        blob.insert(blob.end(), m_frames.begin(), m_frames.end());
+        return blob;
+    }
+
+    /// @brief Load the blob previously created by serialise().
+    /// @param[in] blob Pointer to the blob.
+    /// @param[in] len Length of the blob.
+    /// @return @b comms::ErrorStatus::Success on success,
+    ///     @b comms::ErrorStatus::NotEnoughData if the blob is truncated,
+    ///     @b comms::ErrorStatus::ProtocolError if the header or CRC-32 is
+    ///     invalid, @b comms::ErrorStatus::InvalidMsgData if any of the
+    ///     frames is invalid.
+    comms::ErrorStatus load(const std::uint8_t* blob, std::size_t len)
+    {
+        if (len < HeaderLen) {
+            return comms::ErrorStatus::NotEnoughData;
+        }
+
+        if ((blob[0] != 'U') || (blob[1] != 'D') || (blob[2] != 'B') || (blob[3] != 'D') ||
+            (readLe(&blob[4], 2U) != FormatVersion)) {
+            return comms::ErrorStatus::ProtocolError;
+        }
+
+        auto frameCount = static_cast<std::size_t>(readLe(&blob[8], 4U));
+        auto dataLen = static_cast<std::size_t>(readLe(&blob[12], 4U));
+        if ((len - HeaderLen) < dataLen) {
+            return comms::ErrorStatus::NotEnoughData;
+        }
+
+        auto* data = blob + HeaderLen;
+        if ((0U < dataLen) && (details::mgaDbdCrc32(data, dataLen) != readLe(&blob[16], 4U))) {
+            return comms::ErrorStatus::ProtocolError;
+        }
+
+        Scanner scanner;
+        std::size_t offset = 0U;
+        std::size_t count = 0U;
+        while (offset < dataLen) {
+            auto result = scanner.scan(data + offset, dataLen - offset);
+            if ((result.m_status != comms::ErrorStatus::Success) ||
+                (result.m_discarded != 0U) ||
+                (result.m_frame[2] != DbdClassId) ||
+                (result.m_frame[3] != DbdMsgId)) {
+                return comms::ErrorStatus::InvalidMsgData;
+            }
+
+            offset += result.m_frameLen;
+            ++count;
+        }
+
+        if (count != frameCount) {
+            return comms::ErrorStatus::InvalidMsgData;
+        }
+
+        m_frames.assign(data, data + dataLen);
+        m_frameCount = frameCount;
+        m_dumping = false;
+        return comms::ErrorStatus::Success;
+    }
+
+    /// @brief Access the uploader used for restore.
+    /// @details Can be used to select the flow control mode.
+    MgaUploader& uploader()
+    {
+        return m_uploader;
+    }
+
+    /// @brief Start restoring the stored database.
+    /// @param[in] now Current time.
+    /// @return Number of frames to send.
+    std::size_t startRestore(TimePoint now)
+    {
+        m_restoreStart = now;
+        m_restoreDuration = Duration::zero();
+        m_restoring = true;
+        if (m_frames.empty()) {
+            return m_uploader.setData(nullptr, 0U);
+        }
+
+        return m_uploader.setData(&m_frames[0], m_frames.size());
+    }
+
+    /// @brief Send next frames of the database, see @ref MgaUploader::process().
+    /// @return Number of sent frames.
+    template <typename TSendFunc>
+    std::size_t processRestore(TimePoint now, TSendFunc&& sendFunc)
+    {
+        auto sent = m_uploader.process(now, std::forward<TSendFunc>(sendFunc));
+        if (m_restoring && m_uploader.done()) {
+            m_restoring = false;
+            m_restoreDuration = now - m_restoreStart;
+        }
+        return sent;
+    }
+
+    /// @brief Report reception of MGA-ACK message, see @ref MgaUploader::ackReceived().
+    bool ackReceived(bool accepted, std::uint8_t msgId, std::uint32_t payloadStart)
+    {
+        return m_uploader.ackReceived(accepted, msgId, payloadStart);
+    }
+
+    /// @brief Check whether the restore is complete.
+    bool restoreComplete() const
+    {
+        return !m_restoring;
+    }
+
+    /// @brief Duration of the last complete restore.
+    Duration restoreDuration() const
+    {
+        return m_restoreDuration;
+    }
+
+private:
+    using Scanner = protocol::FrameScanner<>;
+
+    static const std::uint8_t DbdClassId =
+        static_cast<std::uint8_t>(static_cast<unsigned>(MsgId_MGA_DBD) >> 8);
+
+    static const std::uint8_t DbdMsgId =
+        static_cast<std::uint8_t>(static_cast<unsigned>(MsgId_MGA_DBD) & 0xffU);
+
+    static void writeLe(std::uint8_t* buf, std::uint32_t value, std::size_t len)
+    {
+        for (std::size_t idx = 0U; idx < len; ++idx) {
+            buf[idx] = static_cast<std::uint8_t>(value >> (idx * std::numeric_limits<std::uint8_t>::digits));
+        }
+    }
+
+    static std::uint32_t readLe(const std::uint8_t* buf, std::size_t len)
+    {
+        std::uint32_t value = 0U;
+        for (std::size_t idx = 0U; idx < len; ++idx) {
+            value |= static_cast<std::uint32_t>(buf[idx]) << (idx * std::numeric_limits<std::uint8_t>::digits);
+        }
+        return value;
+    }
+
+    std::vector<std::uint8_t> m_frames;
+    MgaUploader m_uploader;
+    TimePoint m_dumpStart;
+    TimePoint m_lastFrame;
+    TimePoint m_restoreStart;
+    Duration m_idleTimeout = std::chrono::seconds(1);
+    Duration m_dumpDuration = Duration::zero();
+    Duration m_restoreDuration = Duration::zero();
+    std::size_t m_frameCount = 0U;
+    bool m_dumping = false;
+    bool m_restoring = false;
+};
+
+} // namespace driver
+
+}  // namespace ublox
+
+
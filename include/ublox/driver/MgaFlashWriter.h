@@ -0,0 +1,355 @@
+//
+// Copyright 2018 (C). Alex Robenko. All rights reserved.
+//
+
+// This file is free software: you can redistribute it and/or modify
+// it under the terms of the GNU General Public License as published by
+// the Free Software Foundation, either version 3 of the License, or
+// (at your option) any later version.
+//
+// This program is distributed in the hope that it will be useful,
+// but WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+// GNU General Public License for more details.
+//
+// You should have received a copy of the GNU General Public License
+// along with this program.  If not, see <http://www.gnu.org/licenses/>.
+
+/// @file
+/// @brief Contains definition of ublox::driver::MgaFlashWriter class.
+
+#pragma once
+
+#include <cstdint>
+#include <cstddef>
+#include <cstring>
+#include <array>
+#include <chrono>
+#include <limits>
+
+#include "ublox/MsgId.h"
+#include "ublox/protocol/ChecksumCalc.h"
+
+namespace ublox
+{
+
+namespace driver
+{
+
+/// @brief State of the @ref MgaFlashWriter.
+enum class MgaFlashState : std::uint8_t
+{
+    Idle, ///< No data to write
+    Writing, ///< Sending MGA-FLASH-DATA messages
+    Done, ///< All the data acknowledged, MGA-FLASH-STOP sent
+    Failed, ///< The receiver has given up or maximal number of retries exceeded
+    NumOfValues ///< Number of available values, must be last
+};
+
+/// @brief Statistics of the @ref MgaFlashWriter.
+struct MgaFlashStats
+{
+    std::size_t m_sentChunks = 0U; ///< Number of sent MGA-FLASH-DATA messages
+    std::size_t m_sentBytes = 0U; ///< Number of sent bytes, including framing
+    std::size_t m_ackedBytes = 0U; ///< Number of acknowledged data bytes
+    std::size_t m_retransmitCount = 0U; ///< Total number of retransmission rounds
+};
+
+/// @brief Writer of the offline assistance database into receiver's flash.
+/// @details Splits the data into MGA-FLASH-DATA messages with maximal
+///     allowed chunk size and consecutive sequence numbers and keeps up to
+///     the configured number of them waiting for MGA-FLASH-ACK, so the link
+///     is not idle waiting for every round trip. The acknowledgements are
+///     expected in order, the acknowledgement of the chunk also acknowledges
+///     all the preceding ones. The retransmission request (or timeout)
+///     causes all the unacknowledged chunks to be re-sent starting from the
+///     requested one. The write fails when the same chunk needs to be
+///     retransmitted more times than allowed (see setMaxRetransmits()), the
+///     limit is applied to every chunk separately, so long database
+///     written over noisy link doesn't fail just because of accumulated
+///     occasional retransmissions. When all the chunks are acknowledged
+///     MGA-FLASH-STOP is sent.@n
+///     The object doesn't perform any I/O and doesn't measure time on its
+///     own, the data is not copied and must outlive the writer.
+class MgaFlashWriter
+{
+public:
+    /// @brief Clock used for timeouts and throughput.
+    using Clock = std::chrono::steady_clock;
+
+    /// @brief Time point type.
+    using TimePoint = Clock::time_point;
+
+    /// @brief Duration type.
+    using Duration = Clock::duration;
+
+    /// @brief Maximal number of data bytes in single MGA-FLASH-DATA message.
+    static const std::size_t MaxChunkSize = 512U;
+
+    /// @brief Maximal length of the MGA-FLASH-DATA frame.
+    static const std::size_t MaxFrameLen = 8U + 6U + MaxChunkSize;
+
+    /// @brief Values of the "ack" field of MGA-FLASH-ACK message,
+    ///     same as @ref ublox::message::MgaFlashAckFields::Ack.
+    enum AckType : std::uint8_t
+    {
+        AckType_Ack, ///< Chunk written to flash
+        AckType_NackRetransmit, ///< Retransmission required
+        AckType_NackGiveUp ///< Receiver has given up
+    };
+
+    /// @brief Constructor
+    /// @param[in] window Number of chunks allowed to be sent without acknowledgement.
+    explicit MgaFlashWriter(std::size_t window = 4U)
+      : m_window(window == 0U ? 1U : window)
+    {
+    }
+
+    /// @brief Set acknowledgement timeout, default is 2 seconds.
+    void setTimeout(Duration value)
+    {
+        m_timeout = value;
+    }
+
+    /// @brief Set maximal number of retransmission rounds starting from
+    ///     the same chunk, default is 10.
+    void setMaxRetransmits(std::size_t value)
+    {
+        m_maxRetransmits = value;
+    }
+
+    /// @brief Set the data to write.
+    /// @param[in] data Pointer to the database, must remain valid until the write is complete.
+    /// @param[in] len Length of the data, at most 65536 chunks of @ref MaxChunkSize bytes.
+    /// @return @b true on success, @b false if the data is too long.
+    bool setData(const std::uint8_t* data, std::size_t len)
+    {
+        auto chunks = (len + MaxChunkSize - 1U) / MaxChunkSize;
+        if ((static_cast<std::size_t>(std::numeric_limits<std::uint16_t>::max()) + 1U) < chunks) {
+            return false;
+        }
+
+        m_data = data;
+        m_len = len;
+        m_chunks = chunks;
+        m_base = 0U;
+        m_next = 0U;
+        m_baseRetransmits = 0U;
+        m_stats = MgaFlashStats();
+        m_state = (chunks == 0U) ? MgaFlashState::Idle : MgaFlashState::Writing;
+        m_started = false;
+        return true;
+    }
+
+    /// @brief Send next chunks allowed by the window and handle timeouts.
+    /// @details Expected to be called periodically as well as after
+    ///     every reported MGA-FLASH-ACK.
+    /// @param[in] now Current time.
+    /// @param[in] sendFunc Functor with <b>void (const std::uint8_t* frame, std::size_t len)</b>
+    ///     signature used to write the frame to the receiver.
+    /// @return Number of sent frames.
+    template <typename TSendFunc>
+    std::size_t process(TimePoint now, TSendFunc&& sendFunc)
+    {
+        if (m_state != MgaFlashState::Writing) {
+            return 0U;
+        }
+
+        if (!m_started) {
+            m_started = true;
+            m_startTime = now;
+        }
+
+        if ((m_base < m_next) && (m_timeout <= (now - m_lastProgress))) {
+            if (!retransmit()) {
+                return 0U;
+            }
+        }
+
+        std::size_t sent = 0U;
+        if (m_base == m_chunks) {
+            static const std::uint8_t StopPayload[] = {0x02, 0x00};
+            auto len = makeFrame(StopPayload, sizeof(StopPayload), nullptr, 0U);
+            sendFunc(&m_frame[0], len);
+            m_stats.m_sentBytes += len;
+            m_state = MgaFlashState::Done;
+            m_finishTime = now;
+            return 1U;
+        }
+
+        if (m_base == m_next) {
+            m_lastProgress = now;
+        }
+
+        while ((m_next < m_chunks) && ((m_next - m_base) < m_window)) {
+            auto offset = m_next * MaxChunkSize;
+            auto chunkLen = m_len - offset;
+            if (MaxChunkSize < chunkLen) {
+                chunkLen = MaxChunkSize;
+            }
+
+            std::uint8_t header[] = {
+                0x01, 0x00,
+                static_cast<std::uint8_t>(m_next),
+                static_cast<std::uint8_t>(m_next >> 8),
+                static_cast<std::uint8_t>(chunkLen),
+                static_cast<std::uint8_t>(chunkLen >> 8)
+            };
+
+            auto len = makeFrame(header, sizeof(header), m_data + offset, chunkLen);
+            sendFunc(&m_frame[0], len);
+            ++m_stats.m_sentChunks;
+            m_stats.m_sentBytes += len;
+            ++m_next;
+            ++sent;
+        }
+
+        return sent;
+    }
+
+    /// @brief Report reception of MGA-FLASH-ACK message.
+    /// @param[in] ack Value of the "ack" field, see @ref AckType.
+    /// @param[in] sequence Value of the "sequence" field.
+    /// @param[in] now Current time.
+    /// @return @b true in case the acknowledgement refers to outstanding chunk.
+    bool ackReceived(unsigned ack, std::uint16_t sequence, TimePoint now)
+    {
+        if ((m_state != MgaFlashState::Writing) ||
+            (sequence < m_base) ||
+            (m_next <= sequence)) {
+            return false;
+        }
+
+        if (ack == AckType_NackGiveUp) {
+            m_state = MgaFlashState::Failed;
+            return true;
+        }
+
+        if (ack == AckType_NackRetransmit) {
+            advanceBase(sequence);
+            m_lastProgress = now;
+            retransmit();
+            return true;
+        }
+
+        advanceBase(static_cast<std::size_t>(sequence) + 1U);
+        m_stats.m_ackedBytes = m_base * MaxChunkSize;
+        if (m_len < m_stats.m_ackedBytes) {
+            m_stats.m_ackedBytes = m_len;
+        }
+        m_lastProgress = now;
+        return true;
+    }
+
+    /// @brief Current state.
+    MgaFlashState state() const
+    {
+        return m_state;
+    }
+
+    /// @brief Total number of chunks.
+    std::size_t chunks() const
+    {
+        return m_chunks;
+    }
+
+    /// @brief Number of acknowledged chunks.
+    std::size_t ackedChunks() const
+    {
+        return m_base;
+    }
+
+    /// @brief Get write statistics.
+    const MgaFlashStats& stats() const
+    {
+        return m_stats;
+    }
+
+    /// @brief Average throughput of acknowledged data in bytes per second.
+    /// @param[in] now Current time, ignored when the write is complete.
+    double throughput(TimePoint now) const
+    {
+        if (!m_started) {
+            return 0.0;
+        }
+
+        auto endTime = (m_state == MgaFlashState::Done) ? m_finishTime : now;
+        auto elapsed = std::chrono::duration_cast<std::chrono::duration<double> >(endTime - m_startTime).count();
+        if (elapsed <= 0.0) {
+            return 0.0;
+        }
+
+        return static_cast<double>(m_stats.m_ackedBytes) / elapsed;
+    }
+
+private:
+    void advanceBase(std::size_t base)
+    {
+        if (m_base < base) {
+            m_baseRetransmits = 0U;
+        }
+        m_base = base;
+    }
+
+    bool retransmit()
+    {
+        if (m_maxRetransmits <= m_baseRetransmits) {
+            m_state = MgaFlashState::Failed;
+            return false;
+        }
+
+        ++m_baseRetransmits;
+        ++m_stats.m_retransmitCount;
+        m_next = m_base;
+        return true;
+    }
+
+    std::size_t makeFrame(
+        const std::uint8_t* header,
+        std::size_t headerLen,
+        const std::uint8_t* data,
+        std::size_t dataLen)
+    {
+        auto payloadLen = headerLen + dataLen;
+        auto id = static_cast<unsigned>(MsgId_MGA_FLASH);
+        m_frame[0] = 0xb5;
+        m_frame[1] = 0x62;
+        m_frame[2] = static_cast<std::uint8_t>(id >> 8);
+        m_frame[3] = static_cast<std::uint8_t>(id);
+        m_frame[4] = static_cast<std::uint8_t>(payloadLen);
+        m_frame[5] = static_cast<std::uint8_t>(payloadLen >> 8);
+        std::memcpy(&m_frame[6], header, headerLen);
+        if (0U < dataLen) {
+            std::memcpy(&m_frame[6 + headerLen], data, dataLen);
+        }
+
+        const std::uint8_t* checksumIter = &m_frame[2];
+        auto checksum = protocol::ChecksumCalc()(checksumIter, 4U + payloadLen);
+        m_frame[6 + payloadLen] = static_cast<std::uint8_t>(checksum);
+        m_frame[7 + payloadLen] = static_cast<std::uint8_t>(checksum >> 8);
+        return 8U + payloadLen;
+    }
+
+    std::array<std::uint8_t, MaxFrameLen> m_frame;
+    const std::uint8_t* m_data = nullptr;
+    std::size_t m_len = 0U;
+    std::size_t m_chunks = 0U;
+    std::size_t m_base = 0U;
+    std::size_t m_next = 0U;
+    std::size_t m_window = 4U;
+    std::size_t m_maxRetransmits = 10U;
+    std::size_t m_baseRetransmits = 0U; // Retransmission rounds starting from m_base
+    Duration m_timeout = std::chrono::seconds(2);
+    TimePoint m_startTime;
+    TimePoint m_finishTime;
+    TimePoint m_lastProgress;
+    MgaFlashStats m_stats;
+    MgaFlashState m_state = MgaFlashState::Idle;
+    bool m_started = false;
+};
+
+} // namespace driver
+
+}  // namespace ublox
+
+
@@ -0,0 +1,339 @@
+//
+// Copyright 2018 (C). Alex Robenko. All rights reserved.
+//
+
+// This file is free software: you can redistribute it and/or modify
+// it under the terms of the GNU General Public License as published by
+// the Free Software Foundation, either version 3 of the License, or
+// (at your option) any later version.
+//
+// This program is distributed in the hope that it will be useful,
+// but WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+// GNU General Public License for more details.
+//
+// You should have received a copy of the GNU General Public License
+// along with this program.  If not, see <http://www.gnu.org/licenses/>.
+
+/// @file
+/// @brief Contains definition of ublox::driver::MgaUploader class.
+
+#pragma once
+
+#include <cstdint>
+#include <cstddef>
+#include <algorithm>
+#include <chrono>
+#include <limits>
+#include <vector>
+
+#include "ublox/MsgId.h"
+#include "ublox/protocol/FrameScanner.h"
+
+namespace ublox
+{
+
+namespace driver
+{
+
+/// @brief Statistics of the @ref MgaUploader.
+struct MgaUploadStats
+{
+    std::size_t m_sentCount = 0U; ///< Number of sent frames
+    std::size_t m_sentBytes = 0U; ///< Number of sent bytes
+    std::size_t m_acceptedCount = 0U; ///< Number of frames acknowledged as accepted
+    std::size_t m_rejectedCount = 0U; ///< Number of frames acknowledged as not used
+    std::size_t m_timedOutCount = 0U; ///< Number of frames without acknowledgement
+    std::size_t m_unexpectedAckCount = 0U; ///< Number of MGA-ACK messages not matching any sent frame
+    std::size_t m_skippedBytes = 0U; ///< Number of bytes in the blob not belonging to any valid frame
+};
+
+/// @brief Streaming uploader of AssistNow (MGA) assistance data.
+/// @details Receives a blob of already framed MGA messages (for example the
+///     contents of AssistNow Online / Offline file), and streams them to
+///     the receiver. Two modes of flow control are supported:
+///     @li Acknowledged (default) - expects MGA-ACK for every message
+///         (enabled by "ackAiding" of CFG-NAVX5). Up to the configured
+///         number of messages (credits) are sent without acknowledgement,
+///         every MGA-ACK returns the credit. The message without
+///         acknowledgement returns its credit after timeout.
+///     @li Paced - used when MGA-ACK messages are disabled, the messages
+///         are sent with the configured interval between them. The send
+///         times are kept on the fixed grid starting at the first message,
+///         so the slightly late call to process() doesn't shift the
+///         following ones. When process() is called more than one interval
+///         late, the grid is restarted at the time of the call instead of
+///         sending all the overdue messages in a burst, which could
+///         overflow the input buffer of the receiver.
+///
+///     The MGA-ACK is matched to the sent message by the message ID and
+///     first four bytes of its payload, as described in the UBX protocol
+///     specification.@n
+///     The object doesn't perform any I/O and doesn't measure time on its
+///     own, the blob is not copied and must outlive the uploader.
+class MgaUploader
+{
+public:
+    /// @brief Clock used for timeouts and pacing.
+    using Clock = std::chrono::steady_clock;
+
+    /// @brief Time point type.
+    using TimePoint = Clock::time_point;
+
+    /// @brief Duration type.
+    using Duration = Clock::duration;
+
+    /// @brief Default number of unacknowledged messages.
+    static const std::size_t DefaultWindow = 16U;
+
+    /// @brief Constructor
+    /// @param[in] window Number of messages allowed to be sent without acknowledgement.
+    explicit MgaUploader(std::size_t window = DefaultWindow)
+      : m_window(window == 0U ? 1U : window)
+    {
+    }
+
+    /// @brief Set the data to upload.
+    /// @details Locates all the valid MGA frames in the blob, any other
+    ///     data or frames are ignored. The number of bytes not belonging to
+    ///     any valid frame is reported in @ref MgaUploadStats::m_skippedBytes.
+    ///     Resets the progress and statistics.
+    /// @param[in] data Pointer to the blob, must remain valid until the upload is complete.
+    /// @param[in] len Length of the blob.
+    /// @return Number of MGA frames found.
+    std::size_t setData(const std::uint8_t* data, std::size_t len)
+    {
+        m_data = data;
+        m_entries.clear();
+        m_next = 0U;
+        m_oldest = 0U;
+        m_inFlight = 0U;
+        m_nextSendTime = TimePoint();
+        m_stats = MgaUploadStats();
+
+        Scanner scanner;
+        std::size_t offset = 0U;
+        while (offset < len) {
+            auto remLen = len - offset;
+            auto result = scanner.scan(data + offset, remLen);
+            if (result.m_status != comms::ErrorStatus::Success) {
+                // The blob is complete, the incomplete frame is a false
+                // detection of the sync characters, skip it and continue.
+                auto skip = std::min(result.m_discarded + 1U, remLen);
+                m_stats.m_skippedBytes += skip;
+                offset += skip;
+                continue;
+            }
+
+            auto frameOffset = static_cast<std::size_t>(result.m_frame - data);
+            m_stats.m_skippedBytes += frameOffset - offset;
+            offset = frameOffset + result.m_frameLen;
+            if (result.m_frame[2] != MgaClassId) {
+                continue;
+            }
+
+            Entry entry;
+            entry.m_offset = frameOffset;
+            entry.m_length = result.m_frameLen;
+            m_entries.push_back(entry);
+        }
+
+        return m_entries.size();
+    }
+
+    /// @brief Use acknowledged mode.
+    /// @param[in] timeout Time to wait for MGA-ACK before the credit is returned.
+    void setAckMode(Duration timeout = std::chrono::seconds(1))
+    {
+        m_paced = false;
+        m_timeout = timeout;
+    }
+
+    /// @brief Use paced mode.
+    /// @param[in] interval Interval between the messages.
+    void setPacedMode(Duration interval = std::chrono::milliseconds(5))
+    {
+        m_paced = true;
+        m_interval = interval;
+    }
+
+    /// @brief Send next messages allowed by the flow control.
+    /// @details Expected to be called periodically as well as after
+    ///     every reported MGA-ACK.
+    /// @param[in] now Current time.
+    /// @param[in] sendFunc Functor with <b>void (const std::uint8_t* frame, std::size_t len)</b>
+    ///     signature used to write the frame to the receiver.
+    /// @return Number of sent frames.
+    template <typename TSendFunc>
+    std::size_t process(TimePoint now, TSendFunc&& sendFunc)
+    {
+        if (m_paced) {
+            return processPaced(now, sendFunc);
+        }
+
+        for (std::size_t idx = m_oldest; idx < m_next; ++idx) {
+            auto& entry = m_entries[idx];
+            if ((!entry.m_inFlight) || ((now - entry.m_sentTime) < m_timeout)) {
+                continue;
+            }
+
+            entry.m_inFlight = false;
+            --m_inFlight;
+            ++m_stats.m_timedOutCount;
+        }
+
+        advanceOldest();
+
+        std::size_t sent = 0U;
+        while ((m_next < m_entries.size()) && (m_inFlight < m_window)) {
+            auto& entry = m_entries[m_next];
+            send(entry, sendFunc);
+            entry.m_inFlight = true;
+            entry.m_sentTime = now;
+            ++m_inFlight;
+            ++m_next;
+            ++sent;
+        }
+
+        return sent;
+    }
+
+    /// @brief Report reception of MGA-ACK message.
+    /// @param[in] accepted @b true when "type" field reports the message
+    ///     as accepted, @b false otherwise.
+    /// @param[in] msgId Value of "msgId" field.
+    /// @param[in] payloadStart Value of "msgPayloadStart" field.
+    /// @return @b true in case the acknowledgement matched one of the sent messages.
+    bool ackReceived(bool accepted, std::uint8_t msgId, std::uint32_t payloadStart)
+    {
+        for (std::size_t idx = m_oldest; idx < m_next; ++idx) {
+            auto& entry = m_entries[idx];
+            if ((!entry.m_inFlight) || (!matches(entry, msgId, payloadStart))) {
+                continue;
+            }
+
+            entry.m_inFlight = false;
+            --m_inFlight;
+            if (accepted) {
+                ++m_stats.m_acceptedCount;
+            }
+            else {
+                ++m_stats.m_rejectedCount;
+            }
+
+            advanceOldest();
+            return true;
+        }
+
+        ++m_stats.m_unexpectedAckCount;
+        return false;
+    }
+
+    /// @brief Check whether all the messages have been sent and
+    ///     acknowledged (or timed out) in the acknowledged mode.
+    bool done() const
+    {
+        return (m_next == m_entries.size()) && (m_inFlight == 0U);
+    }
+
+    /// @brief Total number of MGA frames to upload.
+    std::size_t size() const
+    {
+        return m_entries.size();
+    }
+
+    /// @brief Number of messages waiting for acknowledgement.
+    std::size_t inFlight() const
+    {
+        return m_inFlight;
+    }
+
+    /// @brief Get upload statistics.
+    const MgaUploadStats& stats() const
+    {
+        return m_stats;
+    }
+
+private:
+    using Scanner = protocol::FrameScanner<>;
+
+    static const std::uint8_t MgaClassId =
+        static_cast<std::uint8_t>(static_cast<unsigned>(MsgId_MGA_ACK) >> 8);
+
+    struct Entry
+    {
+        std::size_t m_offset = 0U;
+        std::size_t m_length = 0U;
+        TimePoint m_sentTime;
+        bool m_inFlight = false;
+    };
+
+    template <typename TSendFunc>
+    void send(const Entry& entry, TSendFunc& sendFunc)
+    {
+        sendFunc(m_data + entry.m_offset, entry.m_length);
+        ++m_stats.m_sentCount;
+        m_stats.m_sentBytes += entry.m_length;
+    }
+
+    template <typename TSendFunc>
+    std::size_t processPaced(TimePoint now, TSendFunc& sendFunc)
+    {
+        if ((m_next == 0U) || ((m_nextSendTime + m_interval) < now)) {
+            m_nextSendTime = now;
+        }
+
+        std::size_t sent = 0U;
+        while ((m_next < m_entries.size()) && (m_nextSendTime <= now)) {
+            send(m_entries[m_next], sendFunc);
+            ++m_next;
+            ++sent;
+            m_nextSendTime += m_interval;
+        }
+
+        m_oldest = m_next;
+        return sent;
+    }
+
+    bool matches(const Entry& entry, std::uint8_t msgId, std::uint32_t payloadStart) const
+    {
+        auto* frame = m_data + entry.m_offset;
+        if (frame[3] != msgId) {
+            return false;
+        }
+
+        auto payloadLen = entry.m_length - Scanner::MinFrameLen;
+        auto* payload = frame + Scanner::HeaderLen;
+        std::uint32_t value = 0U;
+        for (std::size_t idx = 0U; (idx < sizeof(value)) && (idx < payloadLen); ++idx) {
+            value |= static_cast<std::uint32_t>(payload[idx]) << (idx * std::numeric_limits<std::uint8_t>::digits);
+        }
+
+        return value == payloadStart;
+    }
+
+    void advanceOldest()
+    {
+        while ((m_oldest < m_next) && (!m_entries[m_oldest].m_inFlight)) {
+            ++m_oldest;
+        }
+    }
+
+    const std::uint8_t* m_data = nullptr;
+    std::vector<Entry> m_entries;
+    MgaUploadStats m_stats;
+    TimePoint m_nextSendTime;
+    Duration m_timeout = std::chrono::seconds(1);
+    Duration m_interval = std::chrono::milliseconds(5);
+    std::size_t m_window = DefaultWindow;
+    std::size_t m_next = 0U;
+    std::size_t m_oldest = 0U;
+    std::size_t m_inFlight = 0U;
+    bool m_paced = false;
+};
+
+} // namespace driver
+
+}  // namespace ublox
+
+
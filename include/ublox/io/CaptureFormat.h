@@ -0,0 +1,234 @@
+//
+// Copyright 2018 (C). Alex Robenko. All rights reserved.
+//
+
+// This file is free software: you can redistribute it and/or modify
+// it under the terms of the GNU General Public License as published by
+// the Free Software Foundation, either version 3 of the License, or
+// (at your option) any later version.
+//
+// This program is distributed in the hope that it will be useful,
+// but WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+// GNU General Public License for more details.
+//
+// You should have received a copy of the GNU General Public License
+// along with this program.  If not, see <http://www.gnu.org/licenses/>.
+
+/// @file
+/// @brief Contains definition of the UBX capture file format used by
+///     ublox::io::CaptureWriter and ublox::io::CaptureReader.
+
+#pragma once
+
+#include <cstdint>
+#include <cstddef>
+#include <cstring>
+#include <limits>
+
+#include "ublox/MsgId.h"
+
+namespace ublox
+{
+
+namespace io
+{
+
+/// @brief Constants and helpers of the UBX capture file format.
+/// @details The capture file consists of:
+///     @li 16 bytes file header: magic "UCAP", format version (2 bytes),
+///         2 reserved bytes, capture start time (8 bytes, nanoseconds since
+///         Unix epoch);
+///     @li records, each one containing the host receive timestamp
+///         (8 bytes, nanoseconds since Unix epoch) followed by the complete
+///         UBX frame as received;
+///     @li index, one 16 bytes entry per record: offset of the record from
+///         the beginning of the file (8 bytes), message ID (2 bytes, see
+///         @ref ublox::MsgId), GPS week relative to the first timed frame
+///         (2 bytes), GPS time of week in milliseconds (4 bytes);
+///     @li 16 bytes trailer: offset of the index (8 bytes), number of
+///         index entries (4 bytes), magic "UIDX".
+///
+///     All the numeric values are little endian. The time of week of the
+///     index entry is the one reported by the frame itself (NAV-* messages
+///     and RXM-RAWX) or the latest one reported by any preceding frame,
+///     @ref NoTimeOfWeek in case there was none yet. The relative week
+///     is incremented every time the time of week wraps at the week
+///     boundary (see @ref WeekTracker), so the (week, time of week) pairs
+///     of the index are ordered even when the capture crosses the
+///     boundary. The index and trailer
+///     are appended when the capture is closed, the capture without them
+///     (for example after a crash) is still readable, the index is rebuilt
+///     by scanning the records.
+namespace capture
+{
+
+/// @brief Length of the file header.
+static const std::size_t FileHeaderLen = 16U;
+
+/// @brief Length of the record header (host timestamp).
+static const std::size_t RecordHeaderLen = 8U;
+
+/// @brief Length of the single index entry.
+static const std::size_t IndexEntryLen = 16U;
+
+/// @brief Minimal length of the complete UBX frame (empty payload).
+static const std::size_t MinFrameLen = 8U;
+
+/// @brief Length of the trailer.
+static const std::size_t TrailerLen = 16U;
+
+/// @brief Version of the format.
+static const std::uint16_t FormatVersion = 1U;
+
+/// @brief Time of week value of the entry preceding any timed frame.
+static const std::uint32_t NoTimeOfWeek = std::numeric_limits<std::uint32_t>::max();
+
+/// @brief Number of milliseconds in GPS week.
+static const std::uint32_t MsInWeek = 7U * 24U * 60U * 60U * 1000U;
+
+/// @brief Monotonic time of the index entry in milliseconds since the
+///     beginning of the week of the first timed frame.
+inline std::uint64_t timeKey(std::uint16_t week, std::uint32_t iTOW)
+{
+    return (static_cast<std::uint64_t>(week) * MsInWeek) + iTOW;
+}
+
+/// @brief Tracker of the GPS week of the captured frames.
+/// @details Counts the weeks relative to the first timed frame. The time
+///     of week jumping back by more than half a week is considered to be
+///     a wrap at the week boundary. The frames reporting slightly older
+///     time (for example the delayed frame of the previous week after
+///     the wrap) are attributed to the week closest to the latest time.
+class WeekTracker
+{
+public:
+    /// @brief Report the time of week of the next timed frame.
+    /// @return Relative week of the frame.
+    std::uint16_t update(std::uint32_t iTOW)
+    {
+        static const std::uint32_t HalfWeek = MsInWeek / 2U;
+        if (m_iTOW == NoTimeOfWeek) {
+            m_iTOW = iTOW;
+            return m_week;
+        }
+
+        auto week = m_week;
+        if ((iTOW < m_iTOW) && (HalfWeek < (m_iTOW - iTOW))) {
+            ++week;
+        }
+        else if ((m_iTOW < iTOW) && (HalfWeek < (iTOW - m_iTOW)) && (0U < week)) {
+            --week;
+        }
+
+        if (timeKey(m_week, m_iTOW) < timeKey(week, iTOW)) {
+            m_week = week;
+            m_iTOW = iTOW;
+        }
+        return week;
+    }
+
+    /// @brief Relative week of the latest timed frame.
+    std::uint16_t week() const
+    {
+        return m_week;
+    }
+
+    /// @brief Time of week of the latest timed frame, @ref NoTimeOfWeek
+    ///     in case there was none.
+    std::uint32_t timeOfWeek() const
+    {
+        return m_iTOW;
+    }
+
+private:
+    std::uint16_t m_week = 0U;
+    std::uint32_t m_iTOW = NoTimeOfWeek;
+};
+
+/// @brief Write little endian value.
+inline void writeLe(std::uint8_t* buf, std::uint64_t value, std::size_t len)
+{
+    for (std::size_t idx = 0U; idx < len; ++idx) {
+        buf[idx] = static_cast<std::uint8_t>(value >> (idx * 8U));
+    }
+}
+
+/// @brief Read little endian value.
+inline std::uint64_t readLe(const std::uint8_t* buf, std::size_t len)
+{
+    std::uint64_t value = 0U;
+    for (std::size_t idx = 0U; idx < len; ++idx) {
+        value |= static_cast<std::uint64_t>(buf[idx]) << (idx * 8U);
+    }
+    return value;
+}
+
+/// @brief Get message ID of the complete UBX frame.
+inline MsgId frameMsgId(const std::uint8_t* frame)
+{
+    return static_cast<MsgId>((static_cast<unsigned>(frame[2]) << 8) | frame[3]);
+}
+
+/// @brief Retrieve GPS time of week reported by the complete UBX frame.
+/// @param[in] frame Pointer to the complete valid frame.
+/// @param[in] len Length of the frame.
+/// @param[out] iTOW Time of week in milliseconds.
+/// @return @b true in case the frame reports the time of week.
+inline bool frameTimeOfWeek(const std::uint8_t* frame, std::size_t len, std::uint32_t& iTOW)
+{
+    static const std::size_t PayloadOffset = 6U;
+    static const std::size_t ChecksumLen = 2U;
+    if (len < (PayloadOffset + ChecksumLen)) {
+        return false;
+    }
+
+    auto* payload = frame + PayloadOffset;
+    auto payloadLen = len - PayloadOffset - ChecksumLen;
+    auto id = frameMsgId(frame);
+    if (id == MsgId_RXM_RAWX) {
+        if (payloadLen < sizeof(double)) {
+            return false;
+        }
+
+        auto bits = readLe(payload, sizeof(double));
+        double rcvTow = 0.0;
+        std::memcpy(&rcvTow, &bits, sizeof(rcvTow));
+        if ((rcvTow < 0.0) || (MsInWeek <= (rcvTow * 1000.0))) {
+            return false;
+        }
+
+        iTOW = static_cast<std::uint32_t>(rcvTow * 1000.0 + 0.5) % MsInWeek;
+        return true;
+    }
+
+    if ((frame[2] != (MsgId_NAV_PVT >> 8)) ||
+        (id == MsgId_NAV_RESETODO) ||
+        (id == MsgId_NAV_EKFSTATUS)) {
+        return false;
+    }
+
+    std::size_t offset = 0U;
+    if ((id == MsgId_NAV_ODO) ||
+        (id == MsgId_NAV_HPPOSECEF) ||
+        (id == MsgId_NAV_HPPOSLLH) ||
+        (id == MsgId_NAV_SVIN) ||
+        (id == MsgId_NAV_RELPOSNED)) {
+        offset = 4U; // version and reserved bytes precede iTOW
+    }
+
+    if (payloadLen < (offset + 4U)) {
+        return false;
+    }
+
+    iTOW = static_cast<std::uint32_t>(readLe(payload + offset, 4U));
+    return iTOW < MsInWeek;
+}
+
+} // namespace capture
+
+} // namespace io
+
+}  // namespace ublox
+
+
@@ -0,0 +1,393 @@
+//
+// Copyright 2018 (C). Alex Robenko. All rights reserved.
+//
+
+// This file is free software: you can redistribute it and/or modify
+// it under the terms of the GNU General Public License as published by
+// the Free Software Foundation, either version 3 of the License, or
+// (at your option) any later version.
+//
+// This program is distributed in the hope that it will be useful,
+// but WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+// GNU General Public License for more details.
+//
+// You should have received a copy of the GNU General Public License
+// along with this program.  If not, see <http://www.gnu.org/licenses/>.
+
+/// @file
+/// @brief Contains definition of ublox::io::CaptureReader class.
+/// @details Linux only.
+
+#pragma once
+
+#include <cstdint>
+#include <cstddef>
+#include <cerrno>
+#include <vector>
+
+#include "ublox/MsgId.h"
+#include "ublox/FrameSpan.h"
+#include "CaptureFormat.h"
+#include "MappedFile.h"
+
+namespace ublox
+{
+
+namespace io
+{
+
+/// @brief Single record of the capture file.
+struct CaptureRecord
+{
+    /// @brief Host receive time in nanoseconds since Unix epoch.
+    std::int64_t m_timestampNs = 0;
+
+    /// @brief Complete UBX frame.
+    FrameSpan m_frame;
+
+    /// @brief ID of the message.
+    MsgId m_msgId = MsgId_NAV_POSECEF;
+
+    /// @brief GPS time of week in milliseconds, see @ref capture::NoTimeOfWeek.
+    std::uint32_t m_iTOW = capture::NoTimeOfWeek;
+
+    /// @brief GPS week relative to the first timed record.
+    std::uint16_t m_week = 0U;
+
+    /// @brief Pointer to the payload of the frame, may be passed to the views
+    ///     from ublox::view namespace.
+    const std::uint8_t* payload() const
+    {
+        return m_frame.data() + PayloadOffset;
+    }
+
+    /// @brief Length of the payload of the frame.
+    std::size_t payloadLen() const
+    {
+        return m_frame.size() - PayloadOffset - ChecksumLen;
+    }
+
+private:
+    static const std::size_t PayloadOffset = 6U;
+    static const std::size_t ChecksumLen = 2U;
+};
+
+/// @brief Reader of the indexed UBX capture file written by @ref CaptureWriter.
+/// @details The file is mapped into memory, the frames are reported as the
+///     views of the mapped data, i.e. without any copying, and may be passed
+///     directly to @b read() member function of @ref ublox::Stack or to the
+///     views from ublox::view namespace. The reported data remains valid
+///     until the reader is closed.@n
+///     The index stored at the end of the file allows random access to
+///     any record and binary search of the GPS time, see seek(). The
+///     search works also for the captures crossing the GPS week boundary.
+///     When the index is missing (the capture hasn't been closed properly),
+///     it is rebuilt on open by scanning the records, the truncated tail
+///     is ignored.
+class CaptureReader
+{
+public:
+    /// @brief Default constructor
+    CaptureReader() = default;
+
+    /// @brief Copy constructor is deleted
+    CaptureReader(const CaptureReader&) = delete;
+
+    /// @brief Destructor
+    ~CaptureReader()
+    {
+        close();
+    }
+
+    /// @brief Copy assignment is deleted
+    CaptureReader& operator=(const CaptureReader&) = delete;
+
+    /// @brief Open and map the capture file.
+    /// @param[in] path Path to the file.
+    /// @return @b true on success, @b false otherwise, @b errno reports the
+    ///     error (@b EINVAL in case of invalid format).
+    bool open(const char* path)
+    {
+        close();
+        if (!m_file.open(path)) {
+            return false;
+        }
+
+        m_file.adviseSequential();
+        m_data = m_file.data();
+        m_size = m_file.size();
+        if (m_size < capture::FileHeaderLen) {
+            close();
+            errno = EINVAL;
+            return false;
+        }
+
+        if ((m_data[0] != 'U') || (m_data[1] != 'C') || (m_data[2] != 'A') || (m_data[3] != 'P') ||
+            (capture::readLe(&m_data[4], 2U) != capture::FormatVersion)) {
+            close();
+            errno = EINVAL;
+            return false;
+        }
+
+        if (!readIndex()) {
+            rebuildIndex();
+        }
+
+        m_firstTimed = 0U;
+        while ((m_firstTimed < m_count) && (timeOfWeek(m_firstTimed) == capture::NoTimeOfWeek)) {
+            ++m_firstTimed;
+        }
+        return true;
+    }
+
+    /// @brief Unmap the file.
+    void close()
+    {
+        m_file.close();
+        m_data = nullptr;
+        m_size = 0U;
+        m_index = nullptr;
+        m_count = 0U;
+        m_recordsEnd = 0U;
+        m_firstTimed = 0U;
+        m_indexed = false;
+        m_rebuilt.clear();
+    }
+
+    /// @brief Check whether the file is open.
+    bool isOpen() const
+    {
+        return m_data != nullptr;
+    }
+
+    /// @brief Check whether the index has been read from the file rather
+    ///     than rebuilt.
+    bool isIndexed() const
+    {
+        return m_indexed;
+    }
+
+    /// @brief Number of records.
+    std::size_t size() const
+    {
+        return m_count;
+    }
+
+    /// @brief Capture start time in nanoseconds since Unix epoch.
+    std::int64_t startTimeNs() const
+    {
+        return static_cast<std::int64_t>(capture::readLe(&m_data[8], 8U));
+    }
+
+    /// @brief Retrieve the record.
+    /// @param[in] idx Index of the record.
+    /// @param[out] rec Retrieved record.
+    /// @return @b false in case the index is out of range or the index entry
+    ///     is corrupted.
+    bool record(std::size_t idx, CaptureRecord& rec) const
+    {
+        if (m_count <= idx) {
+            return false;
+        }
+
+        auto* entry = m_index + (idx * capture::IndexEntryLen);
+        auto offset = capture::readLe(&entry[0], 8U);
+        std::size_t frameLen = 0U;
+        if (!frameAt(offset, frameLen)) {
+            return false;
+        }
+
+        auto* recData = m_data + offset;
+        rec.m_timestampNs = static_cast<std::int64_t>(capture::readLe(recData, capture::RecordHeaderLen));
+        rec.m_frame.m_data = recData + capture::RecordHeaderLen;
+        rec.m_frame.m_size = frameLen;
+        rec.m_msgId = static_cast<MsgId>(capture::readLe(&entry[8], 2U));
+        rec.m_iTOW = static_cast<std::uint32_t>(capture::readLe(&entry[12], 4U));
+        rec.m_week = week(idx);
+        return true;
+    }
+
+    /// @brief GPS time of week of the record in milliseconds.
+    std::uint32_t timeOfWeek(std::size_t idx) const
+    {
+        return static_cast<std::uint32_t>(
+            capture::readLe(m_index + (idx * capture::IndexEntryLen) + 12U, 4U));
+    }
+
+    /// @brief GPS week of the record relative to the first timed record.
+    std::uint16_t week(std::size_t idx) const
+    {
+        return static_cast<std::uint16_t>(
+            capture::readLe(m_index + (idx * capture::IndexEntryLen) + 10U, 2U));
+    }
+
+    /// @brief Find the first record with the GPS time not less than
+    ///     specified one.
+    /// @details Binary search over the index. The records preceding
+    ///     the first timed one are skipped.
+    /// @param[in] week GPS week relative to the first timed record.
+    /// @param[in] iTOW GPS time of week in milliseconds.
+    /// @return Index of the found record, size() if not found.
+    std::size_t seek(std::uint16_t week, std::uint32_t iTOW) const
+    {
+        auto key = capture::timeKey(week, iTOW);
+        auto first = m_firstTimed;
+        auto count = m_count - first;
+        while (0U < count) {
+            auto step = count / 2U;
+            auto mid = first + step;
+            if (timeKey(mid) < key) {
+                first = mid + 1U;
+                count -= step + 1U;
+            }
+            else {
+                count = step;
+            }
+        }
+        return first;
+    }
+
+    /// @brief Find the first record with the time of week not less than
+    ///     specified one.
+    /// @details The time of week less than the one of the first timed
+    ///     record is assumed to belong to the following week, i.e. the
+    ///     capture crossing the week boundary is searched as a whole.
+    /// @param[in] iTOW GPS time of week in milliseconds.
+    /// @return Index of the found record, size() if not found.
+    std::size_t seek(std::uint32_t iTOW) const
+    {
+        if (m_count <= m_firstTimed) {
+            return m_count;
+        }
+
+        std::uint16_t relWeek = 0U;
+        if (iTOW < timeOfWeek(m_firstTimed)) {
+            relWeek = 1U;
+        }
+        return seek(relWeek, iTOW);
+    }
+
+    /// @brief Report the records in the range to the handler.
+    /// @details The handler is expected to have the following signature:
+    ///     @code
+    ///     bool handler(const ublox::io::CaptureRecord& rec);
+    ///     @endcode
+    ///     and return @b false to stop the replay.
+    /// @param[in] from Index of the first record.
+    /// @param[in] to Index past the last record, truncated to size().
+    /// @param[in] handler Handler of the records.
+    /// @return Index of the next record to be replayed.
+    template <typename THandler>
+    std::size_t replay(std::size_t from, std::size_t to, THandler&& handler) const
+    {
+        if (m_count < to) {
+            to = m_count;
+        }
+
+        CaptureRecord rec;
+        for (auto idx = from; idx < to; ++idx) {
+            if ((!record(idx, rec)) || (!handler(rec))) {
+                return idx;
+            }
+        }
+        return to;
+    }
+
+private:
+    std::uint64_t timeKey(std::size_t idx) const
+    {
+        return capture::timeKey(week(idx), timeOfWeek(idx));
+    }
+
+    bool frameAt(std::uint64_t offset, std::size_t& frameLen) const
+    {
+        static const std::size_t FrameHeaderLen = 6U;
+        static const std::size_t ChecksumLen = 2U;
+        if ((m_recordsEnd < offset) ||
+            ((m_recordsEnd - offset) < (capture::RecordHeaderLen + FrameHeaderLen + ChecksumLen))) {
+            return false;
+        }
+
+        auto* frame = m_data + offset + capture::RecordHeaderLen;
+        if ((frame[0] != 0xb5) || (frame[1] != 0x62)) {
+            return false;
+        }
+
+        frameLen = static_cast<std::size_t>(capture::readLe(&frame[4], 2U)) + FrameHeaderLen + ChecksumLen;
+        return frameLen <= (m_recordsEnd - offset - capture::RecordHeaderLen);
+    }
+
+    bool readIndex()
+    {
+        if (m_size < (capture::FileHeaderLen + capture::TrailerLen)) {
+            return false;
+        }
+
+        auto* trailer = m_data + m_size - capture::TrailerLen;
+        if ((trailer[12] != 'U') || (trailer[13] != 'I') || (trailer[14] != 'D') || (trailer[15] != 'X')) {
+            return false;
+        }
+
+        auto indexOffset = capture::readLe(&trailer[0], 8U);
+        auto count = capture::readLe(&trailer[8], 4U);
+        auto indexEnd = m_size - capture::TrailerLen;
+        if ((indexOffset < capture::FileHeaderLen) ||
+            (indexEnd < indexOffset) ||
+            ((indexEnd - indexOffset) != (count * capture::IndexEntryLen))) {
+            return false;
+        }
+
+        m_index = m_data + indexOffset;
+        m_count = static_cast<std::size_t>(count);
+        m_recordsEnd = static_cast<std::size_t>(indexOffset);
+        m_indexed = true;
+        return true;
+    }
+
+    void rebuildIndex()
+    {
+        m_recordsEnd = m_size;
+        std::uint64_t offset = capture::FileHeaderLen;
+        capture::WeekTracker weekTracker;
+        std::size_t frameLen = 0U;
+        while (frameAt(offset, frameLen)) {
+            auto* frame = m_data + offset + capture::RecordHeaderLen;
+            std::uint16_t relWeek = weekTracker.week();
+            std::uint32_t iTOW = weekTracker.timeOfWeek();
+            std::uint32_t frameTOW = capture::NoTimeOfWeek;
+            if (capture::frameTimeOfWeek(frame, frameLen, frameTOW)) {
+                relWeek = weekTracker.update(frameTOW);
+                iTOW = frameTOW;
+            }
+
+            std::uint8_t entry[capture::IndexEntryLen] = {0};
+            capture::writeLe(&entry[0], offset, 8U);
+            capture::writeLe(&entry[8], capture::frameMsgId(frame), 2U);
+            capture::writeLe(&entry[10], relWeek, 2U);
+            capture::writeLe(&entry[12], iTOW, 4U);
+            m_rebuilt.insert(m_rebuilt.end(), &entry[0], &entry[0] + sizeof(entry));
+            offset += capture::RecordHeaderLen + frameLen;
+        }
+
+        m_recordsEnd = static_cast<std::size_t>(offset);
+        m_count = m_rebuilt.size() / capture::IndexEntryLen;
+        m_index = m_rebuilt.data();
+    }
+
+    MappedFile m_file;
+    const std::uint8_t* m_data = nullptr;
+    std::size_t m_size = 0U;
+    const std::uint8_t* m_index = nullptr;
+    std::size_t m_count = 0U;
+    std::size_t m_recordsEnd = 0U;
+    std::size_t m_firstTimed = 0U;
+    bool m_indexed = false;
+    std::vector<std::uint8_t> m_rebuilt;
+};
+
+} // namespace io
+
+}  // namespace ublox
+
+
@@ -0,0 +1,259 @@
+//
+// Copyright 2018 (C). Alex Robenko. All rights reserved.
+//
+
+// This file is free software: you can redistribute it and/or modify
+// it under the terms of the GNU General Public License as published by
+// the Free Software Foundation, either version 3 of the License, or
+// (at your option) any later version.
+//
+// This program is distributed in the hope that it will be useful,
+// but WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+// GNU General Public License for more details.
+//
+// You should have received a copy of the GNU General Public License
+// along with this program.  If not, see <http://www.gnu.org/licenses/>.
+
+/// @file
+/// @brief Contains definition of ublox::io::CaptureWriter class.
+/// @details Linux only.
+
+#pragma once
+
+#include <cstdint>
+#include <cstddef>
+#include <cerrno>
+#include <chrono>
+#include <vector>
+
+#include <fcntl.h>
+#include <unistd.h>
+
+#include "ublox/FrameSpan.h"
+#include "CaptureFormat.h"
+
+namespace ublox
+{
+
+namespace io
+{
+
+/// @brief Writer of the indexed UBX capture file.
+/// @details Stores the complete UBX frames (as reported by
+///     ublox::StreamFramer or ublox::io::EpollReactor) together with
+///     their host receive timestamps, and appends the index when
+///     closed, see @ref ublox::io::capture for the format description.
+///     The records are buffered, the buffer is flushed when its
+///     capacity is exceeded, on flush() and on close(). The file is
+///     closed on destruction.
+class CaptureWriter
+{
+public:
+    /// @brief Default capacity of the write buffer.
+    static const std::size_t DefaultBufCapacity = 64U * 1024U;
+
+    /// @brief Constructor
+    /// @param[in] bufCapacity Capacity of the write buffer.
+    explicit CaptureWriter(std::size_t bufCapacity = DefaultBufCapacity)
+      : m_bufCapacity(bufCapacity)
+    {
+        m_buf.reserve(bufCapacity);
+    }
+
+    /// @brief Copy constructor is deleted
+    CaptureWriter(const CaptureWriter&) = delete;
+
+    /// @brief Destructor
+    ~CaptureWriter()
+    {
+        close();
+    }
+
+    /// @brief Copy assignment is deleted
+    CaptureWriter& operator=(const CaptureWriter&) = delete;
+
+    /// @brief Create the capture file, truncates the existing one.
+    /// @param[in] path Path to the file.
+    /// @return @b true on success, @b false otherwise, @b errno reports the error.
+    bool open(const char* path)
+    {
+        close();
+        auto fd = ::open(path, O_WRONLY | O_CREAT | O_TRUNC | O_CLOEXEC, 0644);
+        if (fd < 0) {
+            return false;
+        }
+
+        m_fd = fd;
+        m_offset = 0U;
+        m_weekTracker = capture::WeekTracker();
+        m_index.clear();
+        m_buf.clear();
+        m_buf.resize(capture::FileHeaderLen);
+        m_buf[0] = 'U';
+        m_buf[1] = 'C';
+        m_buf[2] = 'A';
+        m_buf[3] = 'P';
+        capture::writeLe(&m_buf[4], capture::FormatVersion, 2U);
+        capture::writeLe(&m_buf[6], 0U, 2U);
+        capture::writeLe(&m_buf[8], static_cast<std::uint64_t>(nowNs()), 8U);
+        m_offset = m_buf.size();
+        return true;
+    }
+
+    /// @brief Check whether the file is open.
+    bool isOpen() const
+    {
+        return 0 <= m_fd;
+    }
+
+    /// @brief Store the frame timestamped with current system time.
+    /// @param[in] frame Complete valid UBX frame.
+    /// @return @b true on success, @b false otherwise, @b errno reports the error.
+    bool write(const FrameSpan& frame)
+    {
+        return write(frame, nowNs());
+    }
+
+    /// @brief Store the frame.
+    /// @details The record is buffered, the buffer is flushed beforehand
+    ///     when the record doesn't fit into it. In case of failure
+    ///     nothing is stored, neither the record nor its index entry.
+    /// @param[in] frame Complete valid UBX frame.
+    /// @param[in] timestampNs Host receive time in nanoseconds since Unix epoch.
+    /// @return @b true on success, @b false otherwise, @b errno reports the
+    ///     error (@b EINVAL in case the frame is too short).
+    bool write(const FrameSpan& frame, std::int64_t timestampNs)
+    {
+        if (!isOpen()) {
+            errno = EBADF;
+            return false;
+        }
+
+        if ((frame.data() == nullptr) || (frame.size() < capture::MinFrameLen)) {
+            errno = EINVAL;
+            return false;
+        }
+
+        auto recLen = capture::RecordHeaderLen + frame.size();
+        if ((m_bufCapacity < (m_buf.size() + recLen)) && (!flush())) {
+            return false;
+        }
+
+        std::uint16_t week = m_weekTracker.week();
+        std::uint32_t iTOW = m_weekTracker.timeOfWeek();
+        std::uint32_t frameTOW = capture::NoTimeOfWeek;
+        if (capture::frameTimeOfWeek(frame.data(), frame.size(), frameTOW)) {
+            week = m_weekTracker.update(frameTOW);
+            iTOW = frameTOW;
+        }
+
+        std::uint8_t entry[capture::IndexEntryLen] = {0};
+        capture::writeLe(&entry[0], m_offset, 8U);
+        capture::writeLe(&entry[8], capture::frameMsgId(frame.data()), 2U);
+        capture::writeLe(&entry[10], week, 2U);
+        capture::writeLe(&entry[12], iTOW, 4U);
+
+        std::uint8_t header[capture::RecordHeaderLen];
+        capture::writeLe(&header[0], static_cast<std::uint64_t>(timestampNs), 8U);
+        m_buf.insert(m_buf.end(), &header[0], &header[0] + sizeof(header));
+        m_buf.insert(m_buf.end(), frame.data(), frame.data() + frame.size());
+        m_offset += recLen;
+        m_index.insert(m_index.end(), &entry[0], &entry[0] + sizeof(entry));
+        return true;
+    }
+
+    /// @brief Write the buffered records into the file.
+    /// @return @b true on success, @b false otherwise, @b errno reports the error.
+    bool flush()
+    {
+        std::size_t written = 0U;
+        while (written < m_buf.size()) {
+            auto result = ::write(m_fd, &m_buf[written], m_buf.size() - written);
+            if (0 < result) {
+                written += static_cast<std::size_t>(result);
+                continue;
+            }
+
+            if ((result < 0) && (errno == EINTR)) {
+                continue;
+            }
+
+            // Keep only the data that hasn't been written yet
+            auto err = errno;
+            m_buf.erase(m_buf.begin(), m_buf.begin() + static_cast<std::ptrdiff_t>(written));
+            errno = err;
+            return false;
+        }
+
+        m_buf.clear();
+        return true;
+    }
+
+    /// @brief Append the index and close the file.
+    /// @return @b true on success, @b false otherwise, @b errno reports the error.
+    bool close()
+    {
+        if (!isOpen()) {
+            return true;
+        }
+
+        std::uint8_t trailer[capture::TrailerLen];
+        capture::writeLe(&trailer[0], m_offset, 8U);
+        capture::writeLe(&trailer[8], m_index.size() / capture::IndexEntryLen, 4U);
+        trailer[12] = 'U';
+        trailer[13] = 'I';
+        trailer[14] = 'D';
+        trailer[15] = 'X';
+
+        bool result =
+            (m_index.empty() || append(m_index.data(), m_index.size())) &&
+            append(&trailer[0], sizeof(trailer)) &&
+            flush();
+
+        auto err = errno;
+        ::close(m_fd);
+        m_fd = -1;
+        m_index.clear();
+        errno = err;
+        return result;
+    }
+
+    /// @brief Number of stored frames.
+    std::size_t frameCount() const
+    {
+        return m_index.size() / capture::IndexEntryLen;
+    }
+
+private:
+    static std::int64_t nowNs()
+    {
+        return static_cast<std::int64_t>(
+            std::chrono::duration_cast<std::chrono::nanoseconds>(
+                std::chrono::system_clock::now().time_since_epoch()).count());
+    }
+
+    bool append(const std::uint8_t* data, std::size_t len)
+    {
+        m_buf.insert(m_buf.end(), data, data + len);
+        m_offset += len;
+        if (m_buf.size() < m_bufCapacity) {
+            return true;
+        }
+
+        return flush();
+    }
+
+    int m_fd = -1;
+    std::size_t m_bufCapacity = DefaultBufCapacity;
+    std::uint64_t m_offset = 0U;
+    capture::WeekTracker m_weekTracker;
+    std::vector<std::uint8_t> m_buf;
+    std::vector<std::uint8_t> m_index;
+};
+
+} // namespace io
+
+}  // namespace ublox
+
+
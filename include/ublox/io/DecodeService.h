@@ -0,0 +1,445 @@
+//
+// Copyright 2018 (C). Alex Robenko. All rights reserved.
+//
+
+// This file is free software: you can redistribute it and/or modify
+// it under the terms of the GNU General Public License as published by
+// the Free Software Foundation, either version 3 of the License, or
+// (at your option) any later version.
+//
+// This program is distributed in the hope that it will be useful,
+// but WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+// GNU General Public License for more details.
+//
+// You should have received a copy of the GNU General Public License
+// along with this program.  If not, see <http://www.gnu.org/licenses/>.
+
+/// @file
+/// @brief Contains definition of ublox::io::DecodeService class.
+/// @details Linux only.
+
+#pragma once
+
+#include <cstdint>
+#include <cstddef>
+#include <atomic>
+#include <chrono>
+#include <functional>
+#include <memory>
+#include <thread>
+#include <vector>
+
+#include <pthread.h>
+#include <sched.h>
+
+#include "comms/ErrorStatus.h"
+
+#include "ublox/FrameSpan.h"
+#include "ublox/util/FrameBuffer.h"
+#include "ublox/util/SpscQueue.h"
+#include "EpollReactor.h"
+
+namespace ublox
+{
+
+namespace io
+{
+
+/// @brief Aggregated metrics of the @ref DecodeService.
+struct DecodeMetrics
+{
+    std::uint64_t m_bytes = 0U; ///< Number of bytes in the received frames
+    std::uint64_t m_frames = 0U; ///< Number of received frames
+    std::uint64_t m_messages = 0U; ///< Number of successfully decoded messages
+    std::uint64_t m_errors = 0U; ///< Number of frames which failed to decode
+    std::uint64_t m_totalLatencyNs = 0U; ///< Total time spent decoding and publishing the frames
+    std::uint64_t m_maxLatencyNs = 0U; ///< Maximal time spent decoding and publishing single frame
+    std::uint64_t m_dropped = 0U; ///< Number of frames dropped by the dispatch queues (see enableDecoupledDispatch())
+
+    /// @brief Average time spent decoding and publishing single frame.
+    double avgLatencyNs() const
+    {
+        if (m_frames == 0U) {
+            return 0.0;
+        }
+
+        return static_cast<double>(m_totalLatencyNs) / static_cast<double>(m_frames);
+    }
+};
+
+/// @brief Multi-device decoding runtime.
+/// @details Owns a protocol stack per device. The devices are split into
+///     groups, every group is serviced by its own worker thread with its
+///     own @ref EpollReactor, so there is no shared state between the
+///     workers on the decoding path and the decoding scales with the number
+///     of cores. The worker threads (including the dispatch threads, see
+///     enableDecoupledDispatch()) may be pinned to CPU cores.@n
+///     The decoded messages are published to the subscribers on the worker
+///     thread that has decoded them, hence the subscribers servicing
+///     devices of different groups must be thread safe. The devices and
+///     subscribers must be added before start().@n
+///     When the subscribers may be slow, the reading of the devices can be
+///     decoupled from the decoding and publishing, see enableDecoupledDispatch().@n
+///     The file descriptors are not owned by the service.
+/// @tparam TStack Type of the protocol stack, @ref ublox::Stack or @ref ublox::TableStack.
+/// @tparam TFramer Type of the framer used for every device, variant of
+///     @ref ublox::StreamFramer.
+template <typename TStack, typename TFramer = StreamFramer<32 * 1024, 8 * 1024> >
+class DecodeService
+{
+public:
+    /// @brief Type of the protocol stack.
+    using Stack = TStack;
+
+    /// @brief Smart pointer to the decoded message.
+    using MsgPtr = typename TStack::MsgPtr;
+
+    /// @brief Interface class of the decoded messages.
+    using Message = typename MsgPtr::element_type;
+
+    /// @brief Subscriber callback type.
+    using Subscriber = std::function<void (std::size_t deviceIdx, Message& msg)>;
+
+    /// @brief Capacity (in frames) of the dispatch queue of every worker,
+    ///     see enableDecoupledDispatch().
+    static const std::size_t DispatchQueueCapacity = 256U;
+
+    /// @brief Constructor
+    /// @param[in] workers Number of worker threads (device groups).
+    explicit DecodeService(std::size_t workers = 1U)
+    {
+        if (workers == 0U) {
+            workers = 1U;
+        }
+
+        for (std::size_t idx = 0U; idx < workers; ++idx) {
+            m_workers.emplace_back(new Worker);
+        }
+    }
+
+    /// @brief Copy constructor is deleted
+    DecodeService(const DecodeService&) = delete;
+
+    /// @brief Destructor, stops the workers.
+    ~DecodeService()
+    {
+        stop();
+    }
+
+    /// @brief Copy assignment is deleted
+    DecodeService& operator=(const DecodeService&) = delete;
+
+    /// @brief Number of worker threads.
+    std::size_t workerCount() const
+    {
+        return m_workers.size();
+    }
+
+    /// @brief Add device.
+    /// @param[in] fd Non-blocking file descriptor (see @ref SerialPort).
+    /// @param[in] group Index of the worker servicing the device.
+    /// @return Index of the device, negative value on error.
+    int addDevice(int fd, std::size_t group)
+    {
+        if (m_running || (m_workers.size() <= group)) {
+            return -1;
+        }
+
+        auto& worker = *m_workers[group];
+        if (worker.m_reactor.addDevice(fd) < 0) {
+            return -1;
+        }
+
+        auto deviceIdx = m_deviceCount;
+        ++m_deviceCount;
+        worker.m_devices.push_back(deviceIdx);
+        worker.m_stacks.emplace_back(new TStack);
+        return static_cast<int>(deviceIdx);
+    }
+
+    /// @brief Add subscriber for the decoded messages.
+    void subscribe(Subscriber subscriber)
+    {
+        if (!m_running) {
+            m_subscribers.push_back(std::move(subscriber));
+        }
+    }
+
+    /// @brief Decouple the reading of the devices from the decoding and
+    ///     publishing of the messages.
+    /// @details Every worker gets additional dispatch thread. The reading
+    ///     thread only copies the complete frames into the bounded lock-free
+    ///     queue (see @ref ublox::util::SpscQueue), the dispatch thread
+    ///     decodes them and invokes the subscribers, so the slow subscriber
+    ///     doesn't stall the reading of the devices. When the queue is full
+    ///     the frames are handled according to the policy, the dropped ones
+    ///     are reported by DecodeMetrics::m_dropped. The queue of every worker
+    ///     occupies about @ref DispatchQueueCapacity times maximal frame
+    ///     length of memory.@n
+    ///     Must be invoked before start().
+    /// @param[in] policy Behaviour when the dispatch queue is full.
+    /// @return @b false in case the service is already running.
+    bool enableDecoupledDispatch(util::OverflowPolicy policy = util::OverflowPolicy::DropOldest)
+    {
+        if (m_running) {
+            return false;
+        }
+
+        for (auto& worker : m_workers) {
+            worker->m_queue.reset(new DispatchQueue(policy));
+        }
+        return true;
+    }
+
+    /// @brief Start the worker threads.
+    /// @param[in] pinThreads Pin every thread to its own CPU core (modulo
+    ///     number of cores). Without decoupled dispatch the worker with
+    ///     index @b N is pinned to core @b N. With decoupled dispatch
+    ///     the reading thread of the worker @b N is pinned to core @b 2N
+    ///     and its dispatch thread to core @b 2N+1.
+    void start(bool pinThreads = false)
+    {
+        if (m_running) {
+            return;
+        }
+
+        m_stopRequested = false;
+        m_running = true;
+        auto cores = std::thread::hardware_concurrency();
+        if (!pinThreads) {
+            cores = 0U;
+        }
+
+        std::size_t core = 0U;
+        for (auto& workerPtr : m_workers) {
+            auto& worker = *workerPtr;
+            worker.m_readerDone = false;
+            worker.m_thread = std::thread(&DecodeService::run, this, std::ref(worker));
+            pin(worker.m_thread, core, cores);
+            ++core;
+
+            if (worker.m_queue) {
+                worker.m_dispatchThread = std::thread(&DecodeService::dispatch, this, std::ref(worker));
+                pin(worker.m_dispatchThread, core, cores);
+                ++core;
+            }
+        }
+    }
+
+    /// @brief Stop and join the worker threads.
+    void stop()
+    {
+        if (!m_running) {
+            return;
+        }
+
+        m_stopRequested = true;
+        for (auto& worker : m_workers) {
+            if (worker->m_thread.joinable()) {
+                worker->m_thread.join();
+            }
+
+            if (worker->m_dispatchThread.joinable()) {
+                worker->m_dispatchThread.join();
+            }
+        }
+        m_running = false;
+    }
+
+    /// @brief Set the period of checking for the stop request, default is 100 milliseconds.
+    void setPollTimeout(std::chrono::milliseconds value)
+    {
+        m_pollTimeoutMs = static_cast<int>(value.count());
+    }
+
+    /// @brief Get metrics aggregated over all the workers.
+    DecodeMetrics metrics() const
+    {
+        DecodeMetrics result;
+        for (auto& worker : m_workers) {
+            auto workerMetrics = metrics(*worker);
+            result.m_bytes += workerMetrics.m_bytes;
+            result.m_frames += workerMetrics.m_frames;
+            result.m_messages += workerMetrics.m_messages;
+            result.m_errors += workerMetrics.m_errors;
+            result.m_totalLatencyNs += workerMetrics.m_totalLatencyNs;
+            if (result.m_maxLatencyNs < workerMetrics.m_maxLatencyNs) {
+                result.m_maxLatencyNs = workerMetrics.m_maxLatencyNs;
+            }
+            result.m_dropped += workerMetrics.m_dropped;
+        }
+        return result;
+    }
+
+    /// @brief Get metrics of the single worker.
+    DecodeMetrics workerMetrics(std::size_t group) const
+    {
+        return metrics(*m_workers[group]);
+    }
+
+private:
+    struct Counters
+    {
+        std::atomic<std::uint64_t> m_bytes;
+        std::atomic<std::uint64_t> m_frames;
+        std::atomic<std::uint64_t> m_messages;
+        std::atomic<std::uint64_t> m_errors;
+        std::atomic<std::uint64_t> m_totalLatencyNs;
+        std::atomic<std::uint64_t> m_maxLatencyNs;
+
+        Counters()
+          : m_bytes(0U),
+            m_frames(0U),
+            m_messages(0U),
+            m_errors(0U),
+            m_totalLatencyNs(0U),
+            m_maxLatencyNs(0U)
+        {
+        }
+    };
+
+    struct QueuedFrame
+    {
+        util::FrameBuffer<TFramer::MaxFrameLen> m_frame;
+        std::size_t m_idx = 0U;
+
+        void clear()
+        {
+            m_frame.clear();
+        }
+    };
+
+    using DispatchQueue = util::SpscQueue<QueuedFrame, DispatchQueueCapacity>;
+
+    struct Worker
+    {
+        Counters m_counters;
+        std::uint8_t m_padding[64]; // Keep other data off the cache line of the counters
+        EpollReactor<TFramer> m_reactor;
+        std::vector<std::size_t> m_devices;
+        std::vector<std::unique_ptr<TStack> > m_stacks;
+        std::unique_ptr<DispatchQueue> m_queue;
+        std::atomic<bool> m_readerDone{false};
+        std::thread m_thread;
+        std::thread m_dispatchThread;
+    };
+
+    static void add(std::atomic<std::uint64_t>& counter, std::uint64_t value)
+    {
+        counter.store(counter.load(std::memory_order_relaxed) + value, std::memory_order_relaxed);
+    }
+
+    static void pin(std::thread& thread, std::size_t core, unsigned cores)
+    {
+        if (cores == 0U) {
+            return;
+        }
+
+        cpu_set_t cpus;
+        CPU_ZERO(&cpus);
+        CPU_SET(static_cast<int>(core % cores), &cpus);
+        ::pthread_setaffinity_np(thread.native_handle(), sizeof(cpus), &cpus);
+    }
+
+    static DecodeMetrics metrics(const Worker& worker)
+    {
+        auto& counters = worker.m_counters;
+        DecodeMetrics result;
+        result.m_bytes = counters.m_bytes.load(std::memory_order_relaxed);
+        result.m_frames = counters.m_frames.load(std::memory_order_relaxed);
+        result.m_messages = counters.m_messages.load(std::memory_order_relaxed);
+        result.m_errors = counters.m_errors.load(std::memory_order_relaxed);
+        result.m_totalLatencyNs = counters.m_totalLatencyNs.load(std::memory_order_relaxed);
+        result.m_maxLatencyNs = counters.m_maxLatencyNs.load(std::memory_order_relaxed);
+        if (worker.m_queue) {
+            result.m_dropped = worker.m_queue->droppedCount();
+        }
+        return result;
+    }
+
+    void run(Worker& worker)
+    {
+        while (!m_stopRequested.load(std::memory_order_relaxed)) {
+            worker.m_reactor.poll(
+                m_pollTimeoutMs,
+                [this, &worker](std::size_t idx, const FrameSpan& frame)
+                {
+                    if (!worker.m_queue) {
+                        handleFrame(worker, idx, frame);
+                        return;
+                    }
+
+                    worker.m_queue->pushWith(
+                        [idx, &frame](QueuedFrame& elem) -> bool
+                        {
+                            elem.m_idx = idx;
+                            return elem.m_frame.assign(frame);
+                        });
+                });
+        }
+        worker.m_readerDone.store(true, std::memory_order_release);
+    }
+
+    void dispatch(Worker& worker)
+    {
+        // Owned by the dispatch thread, too big for its stack
+        std::unique_ptr<QueuedFrame> elem(new QueuedFrame);
+        while (true) {
+            if (worker.m_queue->pop(*elem)) {
+                handleFrame(worker, elem->m_idx, elem->m_frame.span());
+                continue;
+            }
+
+            // The reading thread doesn't push anymore, queue is drained
+            if (worker.m_readerDone.load(std::memory_order_acquire)) {
+                break;
+            }
+
+            std::this_thread::sleep_for(std::chrono::microseconds(100));
+        }
+    }
+
+    void handleFrame(Worker& worker, std::size_t idx, const FrameSpan& frame)
+    {
+        using Clock = std::chrono::steady_clock;
+        auto& counters = worker.m_counters;
+        auto startTime = Clock::now();
+        MsgPtr msg;
+        typename Message::ReadIterator iter = frame.data();
+        auto es = worker.m_stacks[idx]->read(msg, iter, frame.size());
+        if (es == comms::ErrorStatus::Success) {
+            auto deviceIdx = worker.m_devices[idx];
+            for (auto& subscriber : m_subscribers) {
+                subscriber(deviceIdx, *msg);
+            }
+            add(counters.m_messages, 1U);
+        }
+        else {
+            add(counters.m_errors, 1U);
+        }
+
+        auto latency =
+            static_cast<std::uint64_t>(
+                std::chrono::duration_cast<std::chrono::nanoseconds>(Clock::now() - startTime).count());
+        add(counters.m_frames, 1U);
+        add(counters.m_bytes, frame.size());
+        add(counters.m_totalLatencyNs, latency);
+        if (counters.m_maxLatencyNs.load(std::memory_order_relaxed) < latency) {
+            counters.m_maxLatencyNs.store(latency, std::memory_order_relaxed);
+        }
+    }
+
+    std::vector<std::unique_ptr<Worker> > m_workers;
+    std::vector<Subscriber> m_subscribers;
+    std::atomic<bool> m_stopRequested{false};
+    std::size_t m_deviceCount = 0U;
+    int m_pollTimeoutMs = 100;
+    bool m_running = false;
+};
+
+} // namespace io
+
+}  // namespace ublox
+
+
@@ -0,0 +1,228 @@
+//
+// Copyright 2018 (C). Alex Robenko. All rights reserved.
+//
+
+// This file is free software: you can redistribute it and/or modify
+// it under the terms of the GNU General Public License as published by
+// the Free Software Foundation, either version 3 of the License, or
+// (at your option) any later version.
+//
+// This program is distributed in the hope that it will be useful,
+// but WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+// GNU General Public License for more details.
+//
+// You should have received a copy of the GNU General Public License
+// along with this program.  If not, see <http://www.gnu.org/licenses/>.
+
+/// @file
+/// @brief Contains definition of ublox::io::EpollReactor class.
+/// @details Linux only.
+
+#pragma once
+
+#include <cstdint>
+#include <cstddef>
+#include <cerrno>
+#include <array>
+#include <memory>
+#include <vector>
+#include <utility>
+
+#include <sys/epoll.h>
+#include <unistd.h>
+
+#include "ublox/FrameSpan.h"
+#include "ublox/StreamFramer.h"
+
+namespace ublox
+{
+
+namespace io
+{
+
+/// @brief Single threaded reader of multiple devices using @b epoll.
+/// @details Every added file descriptor (see @ref SerialPort) gets its
+///     own @ref ublox::StreamFramer. When the descriptor becomes readable
+///     the data is read directly into the free area of the framer's buffer
+///     (no intermediate copy) until the descriptor is drained, and every
+///     complete frame is reported to the handler, which usually passes it
+///     to @b read() of @ref ublox::Stack or @ref ublox::TableStack.
+///     The descriptors are not owned by the reactor.
+/// @tparam TFramer Type of the framer used for every device, variant of
+///     @ref ublox::StreamFramer.
+template <typename TFramer = StreamFramer<32 * 1024, 8 * 1024> >
+class EpollReactor
+{
+public:
+    /// @brief Type of the framer.
+    using Framer = TFramer;
+
+    /// @brief Maximal number of events processed by single poll() call.
+    static const std::size_t MaxEvents = 64U;
+
+    /// @brief Constructor
+    EpollReactor()
+      : m_epollFd(::epoll_create1(EPOLL_CLOEXEC))
+    {
+    }
+
+    /// @brief Copy constructor is deleted
+    EpollReactor(const EpollReactor&) = delete;
+
+    /// @brief Destructor
+    ~EpollReactor()
+    {
+        if (0 <= m_epollFd) {
+            ::close(m_epollFd);
+        }
+    }
+
+    /// @brief Copy assignment is deleted
+    EpollReactor& operator=(const EpollReactor&) = delete;
+
+    /// @brief Check whether the @b epoll instance has been successfully created.
+    bool isValid() const
+    {
+        return 0 <= m_epollFd;
+    }
+
+    /// @brief Add device to be serviced.
+    /// @param[in] fd Non-blocking file descriptor.
+    /// @return Index of the device, negative value on error (@b errno reports the error).
+    int addDevice(int fd)
+    {
+        std::unique_ptr<Device> device(new Device);
+        device->m_fd = fd;
+
+        struct epoll_event event;
+        event.events = EPOLLIN | EPOLLRDHUP;
+        event.data.u64 = m_devices.size();
+        if (::epoll_ctl(m_epollFd, EPOLL_CTL_ADD, fd, &event) != 0) {
+            return -1;
+        }
+
+        m_devices.push_back(std::move(device));
+        return static_cast<int>(m_devices.size() - 1U);
+    }
+
+    /// @brief Stop servicing the device.
+    void removeDevice(std::size_t idx)
+    {
+        auto& device = *m_devices[idx];
+        if (device.m_fd < 0) {
+            return;
+        }
+
+        ::epoll_ctl(m_epollFd, EPOLL_CTL_DEL, device.m_fd, nullptr);
+        device.m_fd = -1;
+    }
+
+    /// @brief Number of added devices (including removed ones).
+    std::size_t deviceCount() const
+    {
+        return m_devices.size();
+    }
+
+    /// @brief Check whether the device is still serviced.
+    /// @details The device is removed automatically on hang up or read error.
+    bool isDeviceActive(std::size_t idx) const
+    {
+        return 0 <= m_devices[idx]->m_fd;
+    }
+
+    /// @brief Access the framer of the device.
+    Framer& framer(std::size_t idx)
+    {
+        return m_devices[idx]->m_framer;
+    }
+
+    /// @brief Total number of bytes read from the device.
+    std::size_t bytesRead(std::size_t idx) const
+    {
+        return m_devices[idx]->m_bytesRead;
+    }
+
+    /// @brief Wait for the incoming data and process it.
+    /// @param[in] timeoutMs Timeout in milliseconds, @b -1 to wait indefinitely.
+    /// @param[in] handler Functor with <b>void (std::size_t deviceIdx, const ublox::FrameSpan& frame)</b>
+    ///     signature invoked for every complete frame. The frame remains
+    ///     valid only during the call.
+    /// @return Number of reported frames, negative value on error
+    ///     (@b errno reports the error).
+    template <typename THandler>
+    int poll(int timeoutMs, THandler&& handler)
+    {
+        std::array<struct epoll_event, MaxEvents> events;
+        auto count = ::epoll_wait(m_epollFd, &events[0], static_cast<int>(events.size()), timeoutMs);
+        if (count < 0) {
+            return (errno == EINTR) ? 0 : -1;
+        }
+
+        int frames = 0;
+        for (auto eventIdx = 0; eventIdx < count; ++eventIdx) {
+            auto idx = static_cast<std::size_t>(events[static_cast<std::size_t>(eventIdx)].data.u64);
+            frames += readDevice(idx, handler);
+        }
+
+        return frames;
+    }
+
+private:
+    struct Device
+    {
+        Framer m_framer;
+        std::size_t m_bytesRead = 0U;
+        int m_fd = -1;
+    };
+
+    template <typename THandler>
+    int readDevice(std::size_t idx, THandler& handler)
+    {
+        auto& device = *m_devices[idx];
+        int frames = 0;
+        while (0 <= device.m_fd) {
+            auto& framer = device.m_framer;
+            auto size = framer.writeBufSize();
+            if (size == 0U) {
+                break;
+            }
+
+            auto result = ::read(device.m_fd, framer.writeBuf(), size);
+            if (0 < result) {
+                framer.commit(static_cast<std::size_t>(result));
+                device.m_bytesRead += static_cast<std::size_t>(result);
+
+                FrameSpan frame;
+                while (framer.nextFrame(frame)) {
+                    handler(idx, frame);
+                    ++frames;
+                }
+                continue;
+            }
+
+            if ((result < 0) && (errno == EINTR)) {
+                continue;
+            }
+
+            // EWOULDBLOCK is the same value on Linux
+            if ((result < 0) && (errno == EAGAIN)) {
+                break;
+            }
+
+            // End of file or read error
+            removeDevice(idx);
+        }
+
+        return frames;
+    }
+
+    std::vector<std::unique_ptr<Device> > m_devices;
+    int m_epollFd = -1;
+};
+
+} // namespace io
+
+}  // namespace ublox
+
+
@@ -0,0 +1,146 @@
+//
+// Copyright 2018 (C). Alex Robenko. All rights reserved.
+//
+
+// This file is free software: you can redistribute it and/or modify
+// it under the terms of the GNU General Public License as published by
+// the Free Software Foundation, either version 3 of the License, or
+// (at your option) any later version.
+//
+// This program is distributed in the hope that it will be useful,
+// but WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+// GNU General Public License for more details.
+//
+// You should have received a copy of the GNU General Public License
+// along with this program.  If not, see <http://www.gnu.org/licenses/>.
+
+/// @file
+/// @brief Contains definition of ublox::io::MappedFile class.
+/// @details Linux only.
+
+#pragma once
+
+#include <cstdint>
+#include <cstddef>
+#include <cerrno>
+
+#include <fcntl.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <unistd.h>
+
+namespace ublox
+{
+
+namespace io
+{
+
+/// @brief Read-only memory mapping of the whole file.
+/// @details The file is unmapped on destruction.
+class MappedFile
+{
+public:
+    /// @brief Default constructor
+    MappedFile() = default;
+
+    /// @brief Copy constructor is deleted
+    MappedFile(const MappedFile&) = delete;
+
+    /// @brief Destructor
+    ~MappedFile()
+    {
+        close();
+    }
+
+    /// @brief Copy assignment is deleted
+    MappedFile& operator=(const MappedFile&) = delete;
+
+    /// @brief Open and map the file.
+    /// @param[in] path Path to the file.
+    /// @return @b true on success, @b false otherwise, @b errno reports the
+    ///     error (@b EINVAL in case the file is empty).
+    bool open(const char* path)
+    {
+        close();
+        auto fd = ::open(path, O_RDONLY | O_CLOEXEC);
+        if (fd < 0) {
+            return false;
+        }
+
+        struct stat info;
+        if (::fstat(fd, &info) != 0) {
+            auto err = errno;
+            ::close(fd);
+            errno = err;
+            return false;
+        }
+
+        auto size = static_cast<std::size_t>(info.st_size);
+        if (size == 0U) {
+            ::close(fd);
+            errno = EINVAL;
+            return false;
+        }
+
+        auto* map = ::mmap(nullptr, size, PROT_READ, MAP_PRIVATE, fd, 0);
+        auto err = errno;
+        ::close(fd);
+        if (map == MAP_FAILED) {
+            errno = err;
+            return false;
+        }
+
+        m_map = map;
+        m_size = size;
+        return true;
+    }
+
+    /// @brief Unmap the file.
+    void close()
+    {
+        if (m_map != nullptr) {
+            ::munmap(m_map, m_size);
+        }
+
+        m_map = nullptr;
+        m_size = 0U;
+    }
+
+    /// @brief Check whether the file is mapped.
+    bool isOpen() const
+    {
+        return m_map != nullptr;
+    }
+
+    /// @brief Advise the kernel that the data is going to be accessed
+    ///     sequentially.
+    void adviseSequential() const
+    {
+        if (m_map != nullptr) {
+            ::madvise(m_map, m_size, MADV_SEQUENTIAL);
+        }
+    }
+
+    /// @brief Pointer to the mapped data.
+    const std::uint8_t* data() const
+    {
+        return static_cast<const std::uint8_t*>(m_map);
+    }
+
+    /// @brief Size of the mapped data.
+    std::size_t size() const
+    {
+        return m_size;
+    }
+
+private:
+    void* m_map = nullptr;
+    std::size_t m_size = 0U;
+};
+
+} // namespace io
+
+}  // namespace ublox
+
+
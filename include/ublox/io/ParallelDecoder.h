@@ -0,0 +1,358 @@
+//
+// Copyright 2018 (C). Alex Robenko. All rights reserved.
+//
+
+// This file is free software: you can redistribute it and/or modify
+// it under the terms of the GNU General Public License as published by
+// the Free Software Foundation, either version 3 of the License, or
+// (at your option) any later version.
+//
+// This program is distributed in the hope that it will be useful,
+// but WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+// GNU General Public License for more details.
+//
+// You should have received a copy of the GNU General Public License
+// along with this program.  If not, see <http://www.gnu.org/licenses/>.
+
+/// @file
+/// @brief Contains definition of ublox::io::ParallelDecoder class.
+
+#pragma once
+
+#include <cstdint>
+#include <cstddef>
+#include <atomic>
+#include <limits>
+#include <memory>
+#include <thread>
+#include <utility>
+#include <vector>
+
+#include "comms/ErrorStatus.h"
+
+#include "ublox/FrameSpan.h"
+#include "ublox/protocol/FrameScanner.h"
+#include "MappedFile.h"
+
+namespace ublox
+{
+
+namespace io
+{
+
+/// @brief Statistics of the @ref ParallelDecoder run.
+struct ParallelDecodeStats
+{
+    std::size_t m_chunks = 0U; ///< Number of processed chunks
+    std::size_t m_frames = 0U; ///< Number of found frames
+    std::size_t m_messages = 0U; ///< Number of successfully decoded messages
+    std::size_t m_errors = 0U; ///< Number of frames which failed to decode
+    std::size_t m_discarded = 0U; ///< Number of garbage bytes between the frames
+};
+
+/// @brief Multi-core decoder of the recorded raw UBX stream.
+/// @details The data is split into chunks of approximately equal size. The
+///     beginning of every chunk is moved forward to the safe frame boundary:
+///     the first position where the sync characters, valid length and checksum
+///     are found (see ublox::protocol::FrameScanner), immediately followed by
+///     another valid frame (or the end of data). The chunks are decoded by the
+///     pool of worker threads, every worker has its own protocol stack. The
+///     frame starting inside the chunk belongs to it, even if it ends in the
+///     next one. The boundary is only a guess: it can land on a frame embedded
+///     in the payload of the bigger one. When the last frame of the chunk
+///     ends beyond the beginning of the next chunk, the next chunk is decoded
+///     again from the end of that frame after all the workers are finished,
+///     so the output is the same as with a single chunk.@n
+///     Every decoded message is passed to the converter, which appends the
+///     result(s) to the output of the chunk. The outputs of the chunks are
+///     concatenated in the original order, i.e. the result doesn't depend
+///     on the number of workers. The converter is invoked concurrently
+///     from all the workers and is expected to have the following signature:
+///     @code
+///     void convert(Message& msg, std::vector<TResult>& out);
+///     @endcode
+/// @tparam TStack Type of the protocol stack, @ref ublox::Stack or @ref ublox::TableStack.
+/// @tparam TMaxPayloadLen Maximal expected payload length of the frame,
+///     see ublox::protocol::FrameScanner.
+template <
+    typename TStack,
+    std::size_t TMaxPayloadLen = std::numeric_limits<std::uint16_t>::max()>
+class ParallelDecoder
+{
+    using Scanner = protocol::FrameScanner<TMaxPayloadLen>;
+
+public:
+    /// @brief Type of the protocol stack.
+    using Stack = TStack;
+
+    /// @brief Smart pointer to the decoded message.
+    using MsgPtr = typename TStack::MsgPtr;
+
+    /// @brief Common interface class of the decoded messages.
+    using Message = typename MsgPtr::element_type;
+
+    /// @brief Default size of the chunk.
+    static const std::size_t DefaultChunkSize = 4U * 1024U * 1024U;
+
+    /// @brief Constructor
+    /// @param[in] workers Number of worker threads, @b 0 means number of
+    ///     available hardware threads.
+    explicit ParallelDecoder(std::size_t workers = 0U)
+      : m_workers(workers)
+    {
+        if (m_workers == 0U) {
+            m_workers = std::thread::hardware_concurrency();
+        }
+
+        if (m_workers == 0U) {
+            m_workers = 1U;
+        }
+    }
+
+    /// @brief Number of worker threads.
+    std::size_t workers() const
+    {
+        return m_workers;
+    }
+
+    /// @brief Set size of the single chunk, default is @ref DefaultChunkSize.
+    void setChunkSize(std::size_t value)
+    {
+        m_chunkSize = value;
+        if (m_chunkSize < Scanner::MaxFrameLen) {
+            m_chunkSize = Scanner::MaxFrameLen;
+        }
+    }
+
+    /// @brief Statistics of the last run.
+    const ParallelDecodeStats& stats() const
+    {
+        return m_stats;
+    }
+
+    /// @brief Decode the data.
+    /// @param[in] data Pointer to the recorded raw stream.
+    /// @param[in] len Length of the data.
+    /// @param[in] convert Converter of the decoded messages.
+    /// @return Outputs of the converter in the original order.
+    template <typename TResult, typename TConvert>
+    std::vector<TResult> decode(const std::uint8_t* data, std::size_t len, TConvert&& convert)
+    {
+        m_stats = ParallelDecodeStats();
+        auto bounds = chunkBounds(data, len);
+        auto chunksCount = bounds.size() - 1U;
+        std::vector<std::vector<TResult> > outputs(chunksCount);
+        std::vector<ParallelDecodeStats> stats(chunksCount);
+        std::vector<std::size_t> resumes(chunksCount);
+        std::atomic<std::size_t> nextChunk(0U);
+
+        auto run =
+            [&]()
+            {
+                std::unique_ptr<TStack> stack(new TStack);
+                while (true) {
+                    auto idx = nextChunk.fetch_add(1U, std::memory_order_relaxed);
+                    if (chunksCount <= idx) {
+                        break;
+                    }
+
+                    resumes[idx] =
+                        decodeChunk(*stack, data, len, bounds[idx], bounds[idx + 1], convert, outputs[idx], stats[idx]);
+                }
+            };
+
+        auto threadsCount = (chunksCount < m_workers) ? chunksCount : m_workers;
+        std::vector<std::thread> threads;
+        for (std::size_t idx = 1U; idx < threadsCount; ++idx) {
+            threads.emplace_back(run);
+        }
+
+        run();
+        for (auto& t : threads) {
+            t.join();
+        }
+
+        // The previous chunk consumed the beginning of the next one
+        std::unique_ptr<TStack> stack;
+        for (std::size_t idx = 1U; idx < chunksCount; ++idx) {
+            auto resume = resumes[idx - 1];
+            if (resume <= bounds[idx]) {
+                continue;
+            }
+
+            outputs[idx].clear();
+            stats[idx] = ParallelDecodeStats();
+            if (bounds[idx + 1] <= resume) {
+                resumes[idx] = resume;
+                continue;
+            }
+
+            if (!stack) {
+                stack.reset(new TStack);
+            }
+
+            resumes[idx] =
+                decodeChunk(*stack, data, len, resume, bounds[idx + 1], convert, outputs[idx], stats[idx]);
+        }
+
+        std::size_t total = 0U;
+        for (auto& out : outputs) {
+            total += out.size();
+        }
+
+        std::vector<TResult> result;
+        result.reserve(total);
+        for (std::size_t idx = 0U; idx < chunksCount; ++idx) {
+            for (auto& elem : outputs[idx]) {
+                result.push_back(std::move(elem));
+            }
+
+            ++m_stats.m_chunks;
+            m_stats.m_frames += stats[idx].m_frames;
+            m_stats.m_messages += stats[idx].m_messages;
+            m_stats.m_errors += stats[idx].m_errors;
+            m_stats.m_discarded += stats[idx].m_discarded;
+        }
+        return result;
+    }
+
+    /// @brief Map and decode the file.
+    /// @param[in] path Path to the file with recorded raw stream.
+    /// @param[in] convert Converter of the decoded messages.
+    /// @param[out] result Outputs of the converter in the original order.
+    /// @return @b true on success, @b false if the file cannot be mapped,
+    ///     @b errno reports the error.
+    template <typename TResult, typename TConvert>
+    bool decodeFile(const char* path, TConvert&& convert, std::vector<TResult>& result)
+    {
+        MappedFile file;
+        if (!file.open(path)) {
+            return false;
+        }
+
+        file.adviseSequential();
+        result = decode<TResult>(file.data(), file.size(), std::forward<TConvert>(convert));
+        return true;
+    }
+
+    /// @brief Find the safe frame boundary.
+    /// @param[in] data Pointer to the recorded raw stream.
+    /// @param[in] len Length of the data.
+    /// @param[in] from Position to start search from.
+    /// @return Position of the first frame starting at or after @b from,
+    ///     which is followed by another valid frame, @b len if not found.
+    static std::size_t syncPoint(const std::uint8_t* data, std::size_t len, std::size_t from)
+    {
+        Scanner scanner;
+        auto pos = from;
+        while (pos < len) {
+            auto result = scanner.scan(data + pos, len - pos);
+            if (result.m_status != comms::ErrorStatus::Success) {
+                pos += result.m_discarded + 1U;
+                continue;
+            }
+
+            auto framePos = pos + result.m_discarded;
+            auto nextPos = framePos + result.m_frameLen;
+            if (nextPos == len) {
+                return framePos;
+            }
+
+            auto nextLen = len - nextPos;
+            if (Scanner::MaxFrameLen < nextLen) {
+                nextLen = Scanner::MaxFrameLen;
+            }
+
+            auto next = scanner.scan(data + nextPos, nextLen);
+            if ((next.m_status == comms::ErrorStatus::Success) && (next.m_discarded == 0U)) {
+                return framePos;
+            }
+
+            pos = framePos + 1U;
+        }
+        return len;
+    }
+
+private:
+    std::vector<std::size_t> chunkBounds(const std::uint8_t* data, std::size_t len) const
+    {
+        std::vector<std::size_t> bounds;
+        bounds.push_back(0U);
+        auto nominal = m_chunkSize;
+        while (nominal < len) {
+            auto pos = syncPoint(data, len, nominal);
+            if (len <= pos) {
+                break;
+            }
+
+            bounds.push_back(pos);
+            nominal = pos + m_chunkSize;
+        }
+
+        bounds.push_back(len);
+        return bounds;
+    }
+
+    // Returns end of the last frame if it is beyond the end of the chunk,
+    // the end of the chunk otherwise
+    template <typename TConvert, typename TResult>
+    static std::size_t decodeChunk(
+        TStack& stack,
+        const std::uint8_t* data,
+        std::size_t len,
+        std::size_t begin,
+        std::size_t end,
+        TConvert& convert,
+        std::vector<TResult>& out,
+        ParallelDecodeStats& stats)
+    {
+        Scanner scanner;
+        auto pos = begin;
+        while (pos < end) {
+            auto result = scanner.scan(data + pos, len - pos);
+            if (result.m_status != comms::ErrorStatus::Success) {
+                // The false sync is reported as incomplete frame at the end of data
+                auto skip = result.m_discarded + 1U;
+                stats.m_discarded += (end < (pos + skip)) ? (end - pos) : skip;
+                pos += skip;
+                continue;
+            }
+
+            auto framePos = pos + result.m_discarded;
+            if (end <= framePos) {
+                stats.m_discarded += end - pos;
+                break;
+            }
+
+            stats.m_discarded += result.m_discarded;
+            ++stats.m_frames;
+            MsgPtr msg;
+            typename Message::ReadIterator iter = result.m_frame;
+            auto es = stack.read(msg, iter, result.m_frameLen);
+            if ((es == comms::ErrorStatus::Success) && msg) {
+                ++stats.m_messages;
+                convert(*msg, out);
+            }
+            else {
+                ++stats.m_errors;
+            }
+
+            pos = framePos + result.m_frameLen;
+            if (end < pos) {
+                return pos;
+            }
+        }
+        return end;
+    }
+
+    std::size_t m_workers = 1U;
+    std::size_t m_chunkSize = DefaultChunkSize;
+    ParallelDecodeStats m_stats;
+};
+
+} // namespace io
+
+}  // namespace ublox
+
+
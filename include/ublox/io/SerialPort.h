@@ -0,0 +1,256 @@
+//
+// Copyright 2018 (C). Alex Robenko. All rights reserved.
+//
+
+// This file is free software: you can redistribute it and/or modify
+// it under the terms of the GNU General Public License as published by
+// the Free Software Foundation, either version 3 of the License, or
+// (at your option) any later version.
+//
+// This program is distributed in the hope that it will be useful,
+// but WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+// GNU General Public License for more details.
+//
+// You should have received a copy of the GNU General Public License
+// along with this program.  If not, see <http://www.gnu.org/licenses/>.
+
+/// @file
+/// @brief Contains definition of ublox::io::SerialPort class.
+/// @details Linux only.
+
+#pragma once
+
+#include <cstdint>
+#include <cstddef>
+#include <cerrno>
+
+#include <fcntl.h>
+#include <poll.h>
+#include <termios.h>
+#include <unistd.h>
+
+namespace ublox
+{
+
+namespace io
+{
+
+/// @brief Raw serial port file descriptor.
+/// @details Opens the device in non-blocking mode and configures it for
+///     raw 8N1 communication without flow control, the descriptor is
+///     closed on destruction. The descriptor is intended to be serviced by
+///     @ref EpollReactor. Pseudo-terminals (see @b openpty()) can be
+///     opened the same way as the real devices.
+class SerialPort
+{
+public:
+    /// @brief Default constructor
+    SerialPort() = default;
+
+    /// @brief Copy constructor is deleted
+    SerialPort(const SerialPort&) = delete;
+
+    /// @brief Move constructor
+    SerialPort(SerialPort&& other)
+      : m_fd(other.m_fd)
+    {
+        other.m_fd = -1;
+    }
+
+    /// @brief Destructor
+    ~SerialPort()
+    {
+        close();
+    }
+
+    /// @brief Copy assignment is deleted
+    SerialPort& operator=(const SerialPort&) = delete;
+
+    /// @brief Move assignment
+    SerialPort& operator=(SerialPort&& other)
+    {
+        if (this != &other) {
+            close();
+            m_fd = other.m_fd;
+            other.m_fd = -1;
+        }
+        return *this;
+    }
+
+    /// @brief Open and configure the device.
+    /// @param[in] dev Path to the device.
+    /// @param[in] baud Baud rate.
+    /// @return @b true on success, @b false otherwise, @b errno reports the error.
+    bool open(const char* dev, unsigned baud = 9600U)
+    {
+        close();
+        auto fd = ::open(dev, O_RDWR | O_NOCTTY | O_NONBLOCK | O_CLOEXEC);
+        if (fd < 0) {
+            return false;
+        }
+
+        m_fd = fd;
+        if (!configure(baud)) {
+            auto err = errno;
+            close();
+            errno = err;
+            return false;
+        }
+
+        return true;
+    }
+
+    /// @brief Close the device.
+    void close()
+    {
+        if (m_fd < 0) {
+            return;
+        }
+
+        ::close(m_fd);
+        m_fd = -1;
+    }
+
+    /// @brief Check whether the device is open.
+    bool isOpen() const
+    {
+        return 0 <= m_fd;
+    }
+
+    /// @brief Get the file descriptor.
+    int fd() const
+    {
+        return m_fd;
+    }
+
+    /// @brief Change the baud rate.
+    /// @return @b true on success, @b false if the rate is not supported.
+    bool setBaudRate(unsigned baud)
+    {
+        speed_t speed = B0;
+        if (!toSpeed(baud, speed)) {
+            errno = EINVAL;
+            return false;
+        }
+
+        struct termios tio;
+        if (::tcgetattr(m_fd, &tio) != 0) {
+            return false;
+        }
+
+        ::cfsetispeed(&tio, speed);
+        ::cfsetospeed(&tio, speed);
+        return ::tcsetattr(m_fd, TCSANOW, &tio) == 0;
+    }
+
+    /// @brief Write all the data to the device.
+    /// @details When the output buffer of the device is full, waits (using
+    ///     @b poll()) for it to become writable again. The timeout limits
+    ///     the time of every such wait rather than the whole operation, i.e.
+    ///     it expires only when the device doesn't accept any data at all.
+    /// @param[in] data Data to write.
+    /// @param[in] len Length of the data.
+    /// @param[in] timeoutMs Timeout of waiting for the device to become
+    ///     writable in milliseconds, @b -1 to wait indefinitely.
+    /// @return @b true on success, @b false otherwise, @b errno reports the
+    ///     error (@b ETIMEDOUT on timeout). In case of failure some of the
+    ///     data may have already been written.
+    bool write(const std::uint8_t* data, std::size_t len, int timeoutMs = 1000)
+    {
+        while (0U < len) {
+            auto result = ::write(m_fd, data, len);
+            if (0 < result) {
+                data += result;
+                len -= static_cast<std::size_t>(result);
+                continue;
+            }
+
+            if ((result < 0) && (errno == EINTR)) {
+                continue;
+            }
+
+            // EWOULDBLOCK is the same value on Linux
+            if ((result < 0) && (errno == EAGAIN)) {
+                if (!waitWritable(timeoutMs)) {
+                    return false;
+                }
+                continue;
+            }
+
+            return false;
+        }
+
+        return true;
+    }
+
+private:
+    static bool toSpeed(unsigned baud, speed_t& speed)
+    {
+        switch (baud) {
+        case 4800U: speed = B4800; return true;
+        case 9600U: speed = B9600; return true;
+        case 19200U: speed = B19200; return true;
+        case 38400U: speed = B38400; return true;
+        case 57600U: speed = B57600; return true;
+        case 115200U: speed = B115200; return true;
+        case 230400U: speed = B230400; return true;
+        case 460800U: speed = B460800; return true;
+        case 921600U: speed = B921600; return true;
+        default: break;
+        }
+        return false;
+    }
+
+    bool waitWritable(int timeoutMs)
+    {
+        struct pollfd pfd;
+        pfd.fd = m_fd;
+        pfd.events = POLLOUT;
+        pfd.revents = 0;
+        while (true) {
+            auto result = ::poll(&pfd, 1, timeoutMs);
+            if (0 < result) {
+                // Errors and hang up are reported by the following write()
+                return true;
+            }
+
+            if (result == 0) {
+                errno = ETIMEDOUT;
+                return false;
+            }
+
+            if (errno != EINTR) {
+                return false;
+            }
+        }
+    }
+
+    bool configure(unsigned baud)
+    {
+        struct termios tio;
+        if (::tcgetattr(m_fd, &tio) != 0) {
+            return false;
+        }
+
+        ::cfmakeraw(&tio);
+        tio.c_cflag |= (CLOCAL | CREAD);
+        tio.c_cflag &= ~(CSTOPB | CRTSCTS);
+        tio.c_iflag &= ~(IXON | IXOFF | IXANY);
+        tio.c_cc[VMIN] = 1; // Non-blocking read reports EAGAIN rather than 0 when no data
+        tio.c_cc[VTIME] = 0;
+        if (::tcsetattr(m_fd, TCSANOW, &tio) != 0) {
+            return false;
+        }
+
+        return setBaudRate(baud);
+    }
+
+    int m_fd = -1;
+};
+
+} // namespace io
+
+}  // namespace ublox
+
+
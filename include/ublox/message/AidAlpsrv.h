@@ -23,6 +23,7 @@
 #include <iterator>
 
 #include "ublox/Message.h"
+#include "ublox/MsgDiscriminator.h"
 
 #include "ublox/field/common.h"
 
@@ -112,6 +113,11 @@ class AidAlpsrv : public
     >
 {
 public:
+
+    /// @brief Discriminator of this message among the ones sharing the same ID.
+    /// @details Checks the value of the second byte of the payload, see @ref ublox::MsgDiscriminator.
+    using Discriminator = ublox::discriminator::ByteValue<1, 0, 0xfe>;
+
     /// @brief Allow access to internal fields.
     /// @details See definition of @b COMMS_MSG_FIELDS_ACCESS macro
     ///     related to @b comms::MessageBase class from COMMS library
@@ -21,6 +21,7 @@
 #pragma once
 
 #include "ublox/Message.h"
+#include "ublox/MsgDiscriminator.h"
 #include "CfgPrt.h"
 
 namespace ublox
@@ -80,6 +81,14 @@ class CfgPrtUsb : public
 {
 public:
 
+    /// @brief Discriminator of this message among the ones sharing the same ID.
+    /// @details Checks the value of the first byte of the payload, see @ref ublox::MsgDiscriminator.
+    using Discriminator =
+        ublox::discriminator::ByteValue<
+            0,
+            (std::uint8_t)CfgPrtFields::PortId::USB
+        >;
+
     /// @brief Allow access to internal fields.
     /// @details See definition of @b COMMS_MSG_FIELDS_ACCESS macro
     ///     related to @b comms::MessageBase class from COMMS library
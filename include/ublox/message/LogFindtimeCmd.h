@@ -21,6 +21,7 @@
 #pragma once
 
 #include "ublox/Message.h"
+#include "ublox/MsgDiscriminator.h"
 #include "ublox/field/log.h"
 
 namespace ublox
@@ -102,6 +103,10 @@ class LogFindtimeCmd : public
 {
 public:
 
+    /// @brief Discriminator of this message among the ones sharing the same ID.
+    /// @details Checks the value of the second byte of the payload, see @ref ublox::MsgDiscriminator.
+    using Discriminator = ublox::discriminator::ByteValue<1, 0>;
+
     /// @brief Allow access to internal fields.
     /// @details See definition of @b COMMS_MSG_FIELDS_ACCESS macro
     ///     related to @b comms::MessageBase class from COMMS library
@@ -0,0 +1,218 @@
+//
+// Copyright 2018 (C). Alex Robenko. All rights reserved.
+//
+
+// This file is free software: you can redistribute it and/or modify
+// it under the terms of the GNU General Public License as published by
+// the Free Software Foundation, either version 3 of the License, or
+// (at your option) any later version.
+//
+// This program is distributed in the hope that it will be useful,
+// but WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+// GNU General Public License for more details.
+//
+// You should have received a copy of the GNU General Public License
+// along with this program.  If not, see <http://www.gnu.org/licenses/>.
+
+/// @file
+/// @brief Contains definition of ublox::option::DefaultOptions.
+
+#pragma once
+
+#include <cstddef>
+
+#include "comms/comms.h"
+
+namespace ublox
+{
+
+/// @brief Extra options for the messages.
+namespace option
+{
+
+/// @brief Default extra options of the messages, which have variable
+///     length list and/or string fields.
+/// @details All the options are empty, i.e. the lists and strings use
+///     @b std::vector and @b std::string as their storage.
+///     It can be used as a base class for the custom options structure, which
+///     needs to override only some of the options.
+struct DefaultOptions
+{
+    /// @brief Maximal payload length the storage of the fields can hold,
+    ///     i.e. not limited.
+    static const std::size_t MaxPayloadLen = 0xffff;
+
+    /// @brief Extra option(s) for @b data field of ublox::message::NavSvinfo message.
+    using NavSvinfoData = comms::option::EmptyOption;
+
+    /// @brief Extra option(s) for @b data field of ublox::message::NavDgps message.
+    using NavDgpsData = comms::option::EmptyOption;
+
+    /// @brief Extra option(s) for @b data field of ublox::message::NavSbas message.
+    using NavSbasData = comms::option::EmptyOption;
+
+    /// @brief Extra option(s) for @b data field of ublox::message::NavOrb message.
+    using NavOrbData = comms::option::EmptyOption;
+
+    /// @brief Extra option(s) for @b data field of ublox::message::NavSat message.
+    using NavSatData = comms::option::EmptyOption;
+
+    /// @brief Extra option(s) for @b data field of ublox::message::NavGeofence message.
+    using NavGeofenceData = comms::option::EmptyOption;
+
+    /// @brief Extra option(s) for @b data field of ublox::message::RxmRaw message.
+    using RxmRawData = comms::option::EmptyOption;
+
+    /// @brief Extra option(s) for @b dwrd field of ublox::message::RxmSfrb message.
+    using RxmSfrbDwrd = comms::option::EmptyOption;
+
+    /// @brief Extra option(s) for @b dwrd field of ublox::message::RxmSfrbx message.
+    using RxmSfrbxDwrd = comms::option::EmptyOption;
+
+    /// @brief Extra option(s) for @b data field of ublox::message::RxmMeasx message.
+    using RxmMeasxData = comms::option::EmptyOption;
+
+    /// @brief Extra option(s) for @b data field of ublox::message::RxmRawx message.
+    using RxmRawxData = comms::option::EmptyOption;
+
+    /// @brief Extra option(s) for @b data field of ublox::message::RxmSvsi message.
+    using RxmSvsiData = comms::option::EmptyOption;
+
+    /// @brief Extra option(s) for @b dwrd field of ublox::message::RxmAlm message.
+    using RxmAlmDwrd = comms::option::EmptyOption;
+
+    /// @brief Extra option(s) for @b sfXd fields of ublox::message::RxmEph message.
+    using RxmEphSf = comms::option::EmptyOption;
+
+    /// @brief Extra option(s) for @b data field of ublox::message::RxmImes message.
+    using RxmImesData = comms::option::EmptyOption;
+
+    /// @brief Extra option(s) for @b str field of ublox::message::InfError message.
+    using InfErrorStr = comms::option::EmptyOption;
+
+    /// @brief Extra option(s) for @b str field of ublox::message::InfWarning message.
+    using InfWarningStr = comms::option::EmptyOption;
+
+    /// @brief Extra option(s) for @b str field of ublox::message::InfNotice message.
+    using InfNoticeStr = comms::option::EmptyOption;
+
+    /// @brief Extra option(s) for @b str field of ublox::message::InfTest message.
+    using InfTestStr = comms::option::EmptyOption;
+
+    /// @brief Extra option(s) for @b str field of ublox::message::InfDebug message.
+    using InfDebugStr = comms::option::EmptyOption;
+
+    /// @brief Extra option(s) for @b rate field of ublox::message::CfgMsg message.
+    using CfgMsgRate = comms::option::EmptyOption;
+
+    /// @brief Extra option(s) for @b list field of ublox::message::CfgInf message.
+    using CfgInfList = comms::option::EmptyOption;
+
+    /// @brief Extra option(s) for @b infMsgMask fields of ublox::message::CfgInf message.
+    using CfgInfInfMsgMask = comms::option::EmptyOption;
+
+    /// @brief Extra option(s) for @b datumName field of ublox::message::CfgDat message.
+    using CfgDatDatumName = comms::option::EmptyOption;
+
+    /// @brief Extra option(s) for string fields of ublox::message::CfgUsb message.
+    using CfgUsbStrs = comms::option::EmptyOption;
+
+    /// @brief Extra option(s) for @b data field of ublox::message::CfgRinv message.
+    using CfgRinvData = comms::option::EmptyOption;
+
+    /// @brief Extra option(s) for @b blocksList field of ublox::message::CfgGnss message.
+    using CfgGnssBlocksList = comms::option::EmptyOption;
+
+    /// @brief Extra option(s) for @b data field of ublox::message::CfgEsrc message.
+    using CfgEsrcData = comms::option::EmptyOption;
+
+    /// @brief Extra option(s) for @b data field of ublox::message::CfgDosc message.
+    using CfgDoscData = comms::option::EmptyOption;
+
+    /// @brief Extra option(s) for @b data field of ublox::message::CfgGeofence message.
+    using CfgGeofenceData = comms::option::EmptyOption;
+
+    /// @brief Extra option(s) for @b data field of ublox::message::MonIo message.
+    using MonIoData = comms::option::EmptyOption;
+
+    /// @brief Extra option(s) for @b swVersion field of ublox::message::MonVer message.
+    using MonVerSwVer = comms::option::EmptyOption;
+
+    /// @brief Extra option(s) for @b hwVersion field of ublox::message::MonVer message.
+    using MonVerHwVer = comms::option::EmptyOption;
+
+    /// @brief Extra option(s) for strings of @b extensions field of ublox::message::MonVer message.
+    using MonVerExtStr = comms::option::EmptyOption;
+
+    /// @brief Extra option(s) for @b extensions field of ublox::message::MonVer message.
+    using MonVerExtList = comms::option::EmptyOption;
+
+    /// @brief Extra option(s) for @b msgX fields of ublox::message::MonMsgpp message.
+    using MonMsgppMsg = comms::option::EmptyOption;
+
+    /// @brief Extra option(s) for @b skipped field of ublox::message::MonMsgpp message.
+    using MonMsgppSkipped = comms::option::EmptyOption;
+
+    /// @brief Extra option(s) for all the list fields of ublox::message::MonRxbuf message.
+    using MonRxbufLists = comms::option::EmptyOption;
+
+    /// @brief Extra option(s) for all the list fields of ublox::message::MonTxbuf message.
+    using MonTxbufLists = comms::option::EmptyOption;
+
+    /// @brief Extra option(s) for @b VP field of ublox::message::MonHw message.
+    using MonHwVp = comms::option::EmptyOption;
+
+    /// @brief Extra option(s) for @b data field of ublox::message::MonPatch message.
+    using MonPatchData = comms::option::EmptyOption;
+
+    /// @brief Extra option(s) for @b dwrd field of ublox::message::AidAlm message.
+    using AidAlmDwrd = comms::option::EmptyOption;
+
+    /// @brief Extra option(s) for @b sfXd fields of ublox::message::AidEph message.
+    using AidEphSf = comms::option::EmptyOption;
+
+    /// @brief Extra option(s) for @b data field of ublox::message::AidAlpsrv message.
+    using AidAlpsrvData = comms::option::EmptyOption;
+
+    /// @brief Extra option(s) for @b data field of ublox::message::AidAlpsrvUpdate message.
+    using AidAlpsrvUpdateData = comms::option::EmptyOption;
+
+    /// @brief Extra option(s) for @b data field of ublox::message::AidAopU8 message.
+    using AidAopU8Data = comms::option::EmptyOption;
+
+    /// @brief Extra option(s) for @b data field of ublox::message::AidAop message.
+    using AidAopData = comms::option::EmptyOption;
+
+    /// @brief Extra option(s) for @b optional field of ublox::message::AidAop message.
+    using AidAopOptional = comms::option::EmptyOption;
+
+    /// @brief Extra option(s) for @b data field of ublox::message::TimSmeas message.
+    using TimSmeasData = comms::option::EmptyOption;
+
+    /// @brief Extra option(s) for @b data field of ublox::message::EsfMeas message.
+    using EsfMeasData = comms::option::EmptyOption;
+
+    /// @brief Extra option(s) for @b list field of ublox::message::EsfRaw message.
+    using EsfRawList = comms::option::EmptyOption;
+
+    /// @brief Extra option(s) for @b data field of ublox::message::EsfStatus message.
+    using EsfStatusData = comms::option::EmptyOption;
+
+    /// @brief Extra option(s) for @b data field of ublox::message::MgaDbd message.
+    using MgaDbdData = comms::option::EmptyOption;
+
+    /// @brief Extra option(s) for @b bytes field of ublox::message::LogRetrievestring message.
+    using LogRetrievestringBytes = comms::option::EmptyOption;
+
+    /// @brief Extra option(s) for @b hash field of ublox::message::SecSign message.
+    using SecSignHash = comms::option::EmptyOption;
+
+    /// @brief Extra option(s) for @b uniqueId field of ublox::message::SecUniqid message.
+    using SecUniqidUniqueId = comms::option::EmptyOption;
+};
+
+} // namespace option
+
+} // namespace ublox
+
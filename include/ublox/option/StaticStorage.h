@@ -0,0 +1,300 @@
+//
+// Copyright 2018 (C). Alex Robenko. All rights reserved.
+//
+
+// This file is free software: you can redistribute it and/or modify
+// it under the terms of the GNU General Public License as published by
+// the Free Software Foundation, either version 3 of the License, or
+// (at your option) any later version.
+//
+// This program is distributed in the hope that it will be useful,
+// but WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+// GNU General Public License for more details.
+//
+// You should have received a copy of the GNU General Public License
+// along with this program.  If not, see <http://www.gnu.org/licenses/>.
+
+/// @file
+/// @brief Contains definition of ublox::option::StaticStorage.
+
+#pragma once
+
+#include <cstdint>
+#include <cstddef>
+#include <limits>
+
+#include "comms/comms.h"
+
+#include "DefaultOptions.h"
+
+namespace ublox
+{
+
+namespace option
+{
+
+/// @brief Extra options of the messages, which replace the dynamic memory
+///     allocation of all the list and string fields with the
+///     fixed size storage.
+/// @details The capacity of every storage is derived from the protocol
+///     definition:
+///     @li The fields with fixed number of elements use exactly this
+///         number (@b comms::option::SequenceFixedSizeUseFixedSizeStorage).
+///     @li The lists, which number of elements is reported by 1 byte
+///         field (@b numSvs, @b numMeas, @b numWords, etc...), can hold
+///         up to @ref MaxCount elements.
+///     @li The remaining fields are limited only by the payload length and
+///         can hold @ref MaxPayloadLen bytes of data.
+///
+///     The frames reporting longer payloads must be rejected before the
+///     message object is read. ublox::TableStack used with
+///     ublox::StaticInputMessages bundle does it by default (see
+///     ublox::MaxPayloadLenOf) and refuses the bigger explicit limit at
+///     compile time. ublox::Stack doesn't limit the payload length, the
+///     frames must be located by ublox::StreamFramer or
+///     ublox::protocol::FrameScanner with @ref MaxPayloadLen passed
+///     as the maximal payload length before they are read by it.
+///     When used together with ublox::StaticInputMessages bundle and
+///     in-place allocation of the message object, the read of the
+///     message doesn't involve any dynamic memory allocation.
+struct StaticStorage : public DefaultOptions
+{
+    /// @brief Maximal number of elements in the list, which size
+    ///     is reported by 1 byte field.
+    static const std::size_t MaxCount = std::numeric_limits<std::uint8_t>::max();
+
+    /// @brief Maximal supported payload length.
+    /// @details Covers the largest counted list (@b RXM-RAWX with 255
+    ///     measurement blocks).
+    static const std::size_t MaxPayloadLen = 8 * 1024;
+
+    /// @brief Storage for @b data field of ublox::message::NavSvinfo message.
+    /// @details Number of elements is reported by 1 byte field.
+    using NavSvinfoData = comms::option::FixedSizeStorage<MaxCount>;
+
+    /// @brief Storage for @b data field of ublox::message::NavDgps message.
+    /// @details Number of elements is reported by 1 byte field.
+    using NavDgpsData = comms::option::FixedSizeStorage<MaxCount>;
+
+    /// @brief Storage for @b data field of ublox::message::NavSbas message.
+    /// @details Number of elements is reported by 1 byte field.
+    using NavSbasData = comms::option::FixedSizeStorage<MaxCount>;
+
+    /// @brief Storage for @b data field of ublox::message::NavOrb message.
+    /// @details Number of elements is reported by 1 byte field.
+    using NavOrbData = comms::option::FixedSizeStorage<MaxCount>;
+
+    /// @brief Storage for @b data field of ublox::message::NavSat message.
+    /// @details Number of elements is reported by 1 byte field.
+    using NavSatData = comms::option::FixedSizeStorage<MaxCount>;
+
+    /// @brief Storage for @b data field of ublox::message::NavGeofence message.
+    /// @details Number of elements is reported by 1 byte field.
+    using NavGeofenceData = comms::option::FixedSizeStorage<MaxCount>;
+
+    /// @brief Storage for @b data field of ublox::message::RxmRaw message.
+    /// @details Number of elements is reported by 1 byte field.
+    using RxmRawData = comms::option::FixedSizeStorage<MaxCount>;
+
+    /// @brief Storage for @b dwrd field of ublox::message::RxmSfrb message.
+    /// @details Fixed number of elements.
+    using RxmSfrbDwrd = comms::option::SequenceFixedSizeUseFixedSizeStorage;
+
+    /// @brief Storage for @b dwrd field of ublox::message::RxmSfrbx message.
+    /// @details Number of elements is reported by 1 byte field.
+    using RxmSfrbxDwrd = comms::option::FixedSizeStorage<MaxCount>;
+
+    /// @brief Storage for @b data field of ublox::message::RxmMeasx message.
+    /// @details Number of elements is reported by 1 byte field.
+    using RxmMeasxData = comms::option::FixedSizeStorage<MaxCount>;
+
+    /// @brief Storage for @b data field of ublox::message::RxmRawx message.
+    /// @details Number of elements is reported by 1 byte field.
+    using RxmRawxData = comms::option::FixedSizeStorage<MaxCount>;
+
+    /// @brief Storage for @b data field of ublox::message::RxmSvsi message.
+    /// @details Number of elements is reported by 1 byte field.
+    using RxmSvsiData = comms::option::FixedSizeStorage<MaxCount>;
+
+    /// @brief Storage for @b dwrd field of ublox::message::RxmAlm message.
+    /// @details Fixed number of elements.
+    using RxmAlmDwrd = comms::option::SequenceFixedSizeUseFixedSizeStorage;
+
+    /// @brief Storage for @b sfXd fields of ublox::message::RxmEph message.
+    /// @details Fixed number of elements.
+    using RxmEphSf = comms::option::SequenceFixedSizeUseFixedSizeStorage;
+
+    /// @brief Storage for @b data field of ublox::message::RxmImes message.
+    /// @details Number of elements is reported by 1 byte field.
+    using RxmImesData = comms::option::FixedSizeStorage<MaxCount>;
+
+    /// @brief Storage for @b str field of ublox::message::InfError message.
+    /// @details Limited by the payload length.
+    using InfErrorStr = comms::option::FixedSizeStorage<MaxPayloadLen>;
+
+    /// @brief Storage for @b str field of ublox::message::InfWarning message.
+    /// @details Limited by the payload length.
+    using InfWarningStr = comms::option::FixedSizeStorage<MaxPayloadLen>;
+
+    /// @brief Storage for @b str field of ublox::message::InfNotice message.
+    /// @details Limited by the payload length.
+    using InfNoticeStr = comms::option::FixedSizeStorage<MaxPayloadLen>;
+
+    /// @brief Storage for @b str field of ublox::message::InfTest message.
+    /// @details Limited by the payload length.
+    using InfTestStr = comms::option::FixedSizeStorage<MaxPayloadLen>;
+
+    /// @brief Storage for @b str field of ublox::message::InfDebug message.
+    /// @details Limited by the payload length.
+    using InfDebugStr = comms::option::FixedSizeStorage<MaxPayloadLen>;
+
+    /// @brief Storage for @b rate field of ublox::message::CfgMsg message.
+    /// @details Fixed number of elements.
+    using CfgMsgRate = comms::option::SequenceFixedSizeUseFixedSizeStorage;
+
+    /// @brief Storage for @b list field of ublox::message::CfgInf message.
+    /// @details Limited by the payload length, 10 bytes per element.
+    using CfgInfList = comms::option::FixedSizeStorage<MaxPayloadLen / 10>;
+
+    /// @brief Storage for @b infMsgMask fields of ublox::message::CfgInf message.
+    /// @details Fixed number of elements.
+    using CfgInfInfMsgMask = comms::option::SequenceFixedSizeUseFixedSizeStorage;
+
+    /// @brief Storage for @b datumName field of ublox::message::CfgDat message.
+    /// @details Fixed number of elements.
+    using CfgDatDatumName = comms::option::SequenceFixedSizeUseFixedSizeStorage;
+
+    /// @brief Storage for string fields of ublox::message::CfgUsb message.
+    /// @details Fixed number of elements.
+    using CfgUsbStrs = comms::option::SequenceFixedSizeUseFixedSizeStorage;
+
+    /// @brief Storage for @b data field of ublox::message::CfgRinv message.
+    /// @details Limited by the payload length.
+    using CfgRinvData = comms::option::FixedSizeStorage<MaxPayloadLen>;
+
+    /// @brief Storage for @b blocksList field of ublox::message::CfgGnss message.
+    /// @details Number of elements is reported by 1 byte field.
+    using CfgGnssBlocksList = comms::option::FixedSizeStorage<MaxCount>;
+
+    /// @brief Storage for @b data field of ublox::message::CfgEsrc message.
+    /// @details Number of elements is reported by 1 byte field.
+    using CfgEsrcData = comms::option::FixedSizeStorage<MaxCount>;
+
+    /// @brief Storage for @b data field of ublox::message::CfgDosc message.
+    /// @details Number of elements is reported by 1 byte field.
+    using CfgDoscData = comms::option::FixedSizeStorage<MaxCount>;
+
+    /// @brief Storage for @b data field of ublox::message::CfgGeofence message.
+    /// @details Number of elements is reported by 1 byte field.
+    using CfgGeofenceData = comms::option::FixedSizeStorage<MaxCount>;
+
+    /// @brief Storage for @b data field of ublox::message::MonIo message.
+    /// @details Limited by the payload length, 20 bytes per element.
+    using MonIoData = comms::option::FixedSizeStorage<MaxPayloadLen / 20>;
+
+    /// @brief Storage for @b swVersion field of ublox::message::MonVer message.
+    /// @details Fixed number of elements.
+    using MonVerSwVer = comms::option::SequenceFixedSizeUseFixedSizeStorage;
+
+    /// @brief Storage for @b hwVersion field of ublox::message::MonVer message.
+    /// @details Fixed number of elements.
+    using MonVerHwVer = comms::option::SequenceFixedSizeUseFixedSizeStorage;
+
+    /// @brief Storage for strings of @b extensions field of ublox::message::MonVer message.
+    /// @details Fixed number of elements.
+    using MonVerExtStr = comms::option::SequenceFixedSizeUseFixedSizeStorage;
+
+    /// @brief Storage for @b extensions field of ublox::message::MonVer message.
+    /// @details Limited by the payload length, 30 bytes per element.
+    using MonVerExtList = comms::option::FixedSizeStorage<MaxPayloadLen / 30>;
+
+    /// @brief Storage for @b msgX fields of ublox::message::MonMsgpp message.
+    /// @details Fixed number of elements.
+    using MonMsgppMsg = comms::option::SequenceFixedSizeUseFixedSizeStorage;
+
+    /// @brief Storage for @b skipped field of ublox::message::MonMsgpp message.
+    /// @details Fixed number of elements.
+    using MonMsgppSkipped = comms::option::SequenceFixedSizeUseFixedSizeStorage;
+
+    /// @brief Storage for all the list fields of ublox::message::MonRxbuf message.
+    /// @details Fixed number of elements.
+    using MonRxbufLists = comms::option::SequenceFixedSizeUseFixedSizeStorage;
+
+    /// @brief Storage for all the list fields of ublox::message::MonTxbuf message.
+    /// @details Fixed number of elements.
+    using MonTxbufLists = comms::option::SequenceFixedSizeUseFixedSizeStorage;
+
+    /// @brief Storage for @b VP field of ublox::message::MonHw message.
+    /// @details Fixed number of elements.
+    using MonHwVp = comms::option::SequenceFixedSizeUseFixedSizeStorage;
+
+    /// @brief Storage for @b data field of ublox::message::MonPatch message.
+    /// @details Limited by the payload length, 16 bytes per element.
+    using MonPatchData = comms::option::FixedSizeStorage<MaxPayloadLen / 16>;
+
+    /// @brief Storage for @b dwrd field of ublox::message::AidAlm message.
+    /// @details Fixed number of elements.
+    using AidAlmDwrd = comms::option::SequenceFixedSizeUseFixedSizeStorage;
+
+    /// @brief Storage for @b sfXd fields of ublox::message::AidEph message.
+    /// @details Fixed number of elements.
+    using AidEphSf = comms::option::SequenceFixedSizeUseFixedSizeStorage;
+
+    /// @brief Storage for @b data field of ublox::message::AidAlpsrv message.
+    /// @details Limited by the payload length.
+    using AidAlpsrvData = comms::option::FixedSizeStorage<MaxPayloadLen>;
+
+    /// @brief Storage for @b data field of ublox::message::AidAlpsrvUpdate message.
+    /// @details Limited by the payload length, 2 bytes per element.
+    using AidAlpsrvUpdateData = comms::option::FixedSizeStorage<MaxPayloadLen / 2>;
+
+    /// @brief Storage for @b data field of ublox::message::AidAopU8 message.
+    /// @details Fixed number of elements.
+    using AidAopU8Data = comms::option::SequenceFixedSizeUseFixedSizeStorage;
+
+    /// @brief Storage for @b data field of ublox::message::AidAop message.
+    /// @details Fixed number of elements.
+    using AidAopData = comms::option::SequenceFixedSizeUseFixedSizeStorage;
+
+    /// @brief Storage for @b optional field of ublox::message::AidAop message.
+    /// @details Fixed number of elements.
+    using AidAopOptional = comms::option::SequenceFixedSizeUseFixedSizeStorage;
+
+    /// @brief Storage for @b data field of ublox::message::TimSmeas message.
+    /// @details Number of elements is reported by 1 byte field.
+    using TimSmeasData = comms::option::FixedSizeStorage<MaxCount>;
+
+    /// @brief Storage for @b data field of ublox::message::EsfMeas message.
+    /// @details Limited by the payload length, 4 bytes per element.
+    using EsfMeasData = comms::option::FixedSizeStorage<MaxPayloadLen / 4>;
+
+    /// @brief Storage for @b list field of ublox::message::EsfRaw message.
+    /// @details Limited by the payload length, 8 bytes per element.
+    using EsfRawList = comms::option::FixedSizeStorage<MaxPayloadLen / 8>;
+
+    /// @brief Storage for @b data field of ublox::message::EsfStatus message.
+    /// @details Number of elements is reported by 1 byte field.
+    using EsfStatusData = comms::option::FixedSizeStorage<MaxCount>;
+
+    /// @brief Storage for @b data field of ublox::message::MgaDbd message.
+    /// @details Limited by the payload length.
+    using MgaDbdData = comms::option::FixedSizeStorage<MaxPayloadLen>;
+
+    /// @brief Storage for @b bytes field of ublox::message::LogRetrievestring message.
+    /// @details Limited by the payload length.
+    using LogRetrievestringBytes = comms::option::FixedSizeStorage<MaxPayloadLen>;
+
+    /// @brief Storage for @b hash field of ublox::message::SecSign message.
+    /// @details Fixed number of elements.
+    using SecSignHash = comms::option::SequenceFixedSizeUseFixedSizeStorage;
+
+    /// @brief Storage for @b uniqueId field of ublox::message::SecUniqid message.
+    /// @details Fixed number of elements.
+    using SecUniqidUniqueId = comms::option::SequenceFixedSizeUseFixedSizeStorage;
+};
+
+} // namespace option
+
+} // namespace ublox
+
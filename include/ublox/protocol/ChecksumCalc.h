@@ -21,19 +21,281 @@
 #pragma once
 
 #include <cstdint>
+#include <cstddef>
 #include <limits>
 
+#if !defined(UBLOX_CHECKSUM_NO_SIMD)
+#if defined(__AVX2__)
+#include <immintrin.h>
+#define UBLOX_CHECKSUM_AVX2
+#elif defined(__SSE2__) || defined(_M_X64) || (defined(_M_IX86_FP) && (_M_IX86_FP >= 2))
+#include <emmintrin.h>
+#define UBLOX_CHECKSUM_SSE2
+#elif defined(__ARM_NEON) || defined(__ARM_NEON__)
+#include <arm_neon.h>
+#define UBLOX_CHECKSUM_NEON
+#endif
+#endif // #if !defined(UBLOX_CHECKSUM_NO_SIMD)
+
 namespace ublox
 {
 
 namespace protocol
 {
 
+namespace details
+{
+
+/// @brief Running state of the 8-bit Fletcher checksum.
+/// @details Both sums are kept in 32 bit unsigned integers. Only the
+///     least significant byte of each one is meaningful, the arithmetic
+///     wraps modulo 2^32 which preserves the value modulo 256.
+struct ChecksumState
+{
+    std::uint32_t m_ckA = 0U;
+    std::uint32_t m_ckB = 0U;
+};
+
+/// @brief Byte by byte update of the checksum state.
+inline void checksumUpdateScalar(ChecksumState& state, const std::uint8_t* data, std::size_t len)
+{
+    auto ckA = state.m_ckA;
+    auto ckB = state.m_ckB;
+    for (std::size_t idx = 0U; idx < len; ++idx) {
+        ckA += data[idx];
+        ckB += ckA;
+    }
+    state.m_ckA = ckA;
+    state.m_ckB = ckB;
+}
+
+/// @brief Portable block-wise update of the checksum state.
+/// @details Uses closed form of the Fletcher sums for a block of @b N bytes:
+///     @code
+///     ckA' = ckA + sum(b[i])
+///     ckB' = ckB + N * ckA + sum((N - i) * b[i])
+///     @endcode
+///     The remainder which doesn't fill the whole block is processed
+///     byte by byte.
+/// @return Number of processed bytes.
+inline std::size_t checksumUpdateBlocksPortable(ChecksumState& state, const std::uint8_t* data, std::size_t len)
+{
+    static const std::size_t BlockSize = 16U;
+    auto ckA = state.m_ckA;
+    auto ckB = state.m_ckB;
+    std::size_t consumed = 0U;
+    for (; (consumed + BlockSize) <= len; consumed += BlockSize) {
+        auto* block = data + consumed;
+        std::uint32_t sum = 0U;
+        std::uint32_t weighted = 0U;
+        for (std::size_t idx = 0U; idx < BlockSize; ++idx) {
+            sum += block[idx];
+            weighted += static_cast<std::uint32_t>(BlockSize - idx) * block[idx];
+        }
+
+        ckB += static_cast<std::uint32_t>(BlockSize) * ckA + weighted;
+        ckA += sum;
+    }
+
+    state.m_ckA = ckA;
+    state.m_ckB = ckB;
+    return consumed;
+}
+
+#if defined(UBLOX_CHECKSUM_AVX2)
+
+/// @brief AVX2 update of the checksum state using 32 byte blocks.
+/// @return Number of processed bytes.
+inline std::size_t checksumUpdateBlocksSimd(ChecksumState& state, const std::uint8_t* data, std::size_t len)
+{
+    static const std::size_t BlockSize = 32U;
+    auto blocksCount = len / BlockSize;
+    if (blocksCount == 0U) {
+        return 0U;
+    }
+
+    auto zero = _mm256_setzero_si256();
+    auto ones = _mm256_set1_epi16(1);
+    auto weights =
+        _mm256_setr_epi8(
+            32, 31, 30, 29, 28, 27, 26, 25, 24, 23, 22, 21, 20, 19, 18, 17,
+            16, 15, 14, 13, 12, 11, 10, 9, 8, 7, 6, 5, 4, 3, 2, 1);
+
+    auto sums = _mm256_setzero_si256();
+    auto prevSums = _mm256_setzero_si256();
+    auto weightedSums = _mm256_setzero_si256();
+    for (std::size_t idx = 0U; idx < blocksCount; ++idx) {
+        auto block =
+            _mm256_loadu_si256(
+                static_cast<const __m256i*>(static_cast<const void*>(data + (idx * BlockSize))));
+        prevSums = _mm256_add_epi32(prevSums, sums);
+        sums = _mm256_add_epi32(sums, _mm256_sad_epu8(block, zero));
+        weightedSums =
+            _mm256_add_epi32(
+                weightedSums,
+                _mm256_madd_epi16(_mm256_maddubs_epi16(block, weights), ones));
+    }
+
+    auto reduce =
+        [](__m256i value) -> std::uint32_t
+        {
+            auto half =
+                _mm_add_epi32(
+                    _mm256_castsi256_si128(value),
+                    _mm256_extracti128_si256(value, 1));
+            half = _mm_add_epi32(half, _mm_shuffle_epi32(half, _MM_SHUFFLE(1, 0, 3, 2)));
+            half = _mm_add_epi32(half, _mm_shuffle_epi32(half, _MM_SHUFFLE(2, 3, 0, 1)));
+            return static_cast<std::uint32_t>(_mm_cvtsi128_si32(half));
+        };
+
+    auto consumed = blocksCount * BlockSize;
+    state.m_ckB +=
+        static_cast<std::uint32_t>(consumed) * state.m_ckA +
+        static_cast<std::uint32_t>(BlockSize) * reduce(prevSums) +
+        reduce(weightedSums);
+    state.m_ckA += reduce(sums);
+    return consumed;
+}
+
+#elif defined(UBLOX_CHECKSUM_SSE2)
+
+/// @brief SSE2 update of the checksum state using 16 byte blocks.
+/// @return Number of processed bytes.
+inline std::size_t checksumUpdateBlocksSimd(ChecksumState& state, const std::uint8_t* data, std::size_t len)
+{
+    static const std::size_t BlockSize = 16U;
+    auto blocksCount = len / BlockSize;
+    if (blocksCount == 0U) {
+        return 0U;
+    }
+
+    auto zero = _mm_setzero_si128();
+    auto loWeights = _mm_setr_epi16(16, 15, 14, 13, 12, 11, 10, 9);
+    auto hiWeights = _mm_setr_epi16(8, 7, 6, 5, 4, 3, 2, 1);
+
+    auto sums = _mm_setzero_si128();
+    auto prevSums = _mm_setzero_si128();
+    auto weightedSums = _mm_setzero_si128();
+    for (std::size_t idx = 0U; idx < blocksCount; ++idx) {
+        auto block =
+            _mm_loadu_si128(
+                static_cast<const __m128i*>(static_cast<const void*>(data + (idx * BlockSize))));
+        prevSums = _mm_add_epi32(prevSums, sums);
+        sums = _mm_add_epi32(sums, _mm_sad_epu8(block, zero));
+        weightedSums =
+            _mm_add_epi32(
+                weightedSums,
+                _mm_add_epi32(
+                    _mm_madd_epi16(_mm_unpacklo_epi8(block, zero), loWeights),
+                    _mm_madd_epi16(_mm_unpackhi_epi8(block, zero), hiWeights)));
+    }
+
+    auto reduce =
+        [](__m128i value) -> std::uint32_t
+        {
+            value = _mm_add_epi32(value, _mm_shuffle_epi32(value, _MM_SHUFFLE(1, 0, 3, 2)));
+            value = _mm_add_epi32(value, _mm_shuffle_epi32(value, _MM_SHUFFLE(2, 3, 0, 1)));
+            return static_cast<std::uint32_t>(_mm_cvtsi128_si32(value));
+        };
+
+    auto consumed = blocksCount * BlockSize;
+    state.m_ckB +=
+        static_cast<std::uint32_t>(consumed) * state.m_ckA +
+        static_cast<std::uint32_t>(BlockSize) * reduce(prevSums) +
+        reduce(weightedSums);
+    state.m_ckA += reduce(sums);
+    return consumed;
+}
+
+#elif defined(UBLOX_CHECKSUM_NEON)
+
+/// @brief NEON update of the checksum state using 16 byte blocks.
+/// @return Number of processed bytes.
+inline std::size_t checksumUpdateBlocksSimd(ChecksumState& state, const std::uint8_t* data, std::size_t len)
+{
+    static const std::size_t BlockSize = 16U;
+    auto blocksCount = len / BlockSize;
+    if (blocksCount == 0U) {
+        return 0U;
+    }
+
+    static const std::uint8_t LoWeightsData[] = {16, 15, 14, 13, 12, 11, 10, 9};
+    static const std::uint8_t HiWeightsData[] = {8, 7, 6, 5, 4, 3, 2, 1};
+    auto loWeights = vld1_u8(LoWeightsData);
+    auto hiWeights = vld1_u8(HiWeightsData);
+
+    auto sums = vdupq_n_u32(0U);
+    auto prevSums = vdupq_n_u32(0U);
+    auto weightedSums = vdupq_n_u32(0U);
+    for (std::size_t idx = 0U; idx < blocksCount; ++idx) {
+        auto block = vld1q_u8(data + (idx * BlockSize));
+        prevSums = vaddq_u32(prevSums, sums);
+        sums = vpadalq_u16(sums, vpaddlq_u8(block));
+        auto weighted = vmull_u8(vget_low_u8(block), loWeights);
+        weighted = vmlal_u8(weighted, vget_high_u8(block), hiWeights);
+        weightedSums = vpadalq_u16(weightedSums, weighted);
+    }
+
+    auto reduce =
+        [](uint32x4_t value) -> std::uint32_t
+        {
+            auto half = vadd_u32(vget_low_u32(value), vget_high_u32(value));
+            return vget_lane_u32(vpadd_u32(half, half), 0);
+        };
+
+    auto consumed = blocksCount * BlockSize;
+    state.m_ckB +=
+        static_cast<std::uint32_t>(consumed) * state.m_ckA +
+        static_cast<std::uint32_t>(BlockSize) * reduce(prevSums) +
+        reduce(weightedSums);
+    state.m_ckA += reduce(sums);
+    return consumed;
+}
+
+#else
+
+/// @brief Fallback when no SIMD instruction set is available.
+inline std::size_t checksumUpdateBlocksSimd(ChecksumState& state, const std::uint8_t* data, std::size_t len)
+{
+    return checksumUpdateBlocksPortable(state, data, len);
+}
+
+#endif
+
+/// @brief Update the checksum state with contiguous block of data.
+inline void checksumUpdate(ChecksumState& state, const std::uint8_t* data, std::size_t len)
+{
+    auto consumed = checksumUpdateBlocksSimd(state, data, len);
+    checksumUpdateScalar(state, data + consumed, len - consumed);
+}
+
+/// @brief Combine the checksum state into the value transmitted on the wire.
+inline std::uint16_t checksumValue(const ChecksumState& state)
+{
+    return
+        static_cast<std::uint16_t>(
+            ((state.m_ckB & 0xffU) << std::numeric_limits<std::uint8_t>::digits) |
+            (state.m_ckA & 0xffU));
+}
+
+} // namespace details
+
 /// @brief Checksum calculator.
 /// @details Provided to @b comms::protocol::ChecksumLayer
-///     when defining protocol stack (@ref ublox::Stack).
+///     when defining protocol stack (@ref ublox::Stack).@n
+///     When the iterator is a raw pointer to the contiguous buffer of bytes,
+///     the calculation is performed on the blocks of 16 (SSE2, NEON) or
+///     32 (AVX2) bytes at a time. The SIMD code paths may be disabled by
+///     defining @b UBLOX_CHECKSUM_NO_SIMD, in which case the portable
+///     block-wise calculation is used.
 struct ChecksumCalc
 {
+    /// @brief Calculate checksum of the data referenced by generic iterator.
+    /// @details Iterates over the data one byte at a time.
+    /// @param[in, out] iter Iterator used for reading, advanced by @b len.
+    /// @param[in] len Number of bytes to process.
+    /// @return Checksum value, @b CK_A is the least significant byte,
+    ///     @b CK_B is the most significant one.
     template <typename TIter>
     std::uint16_t operator()(TIter& iter, std::size_t len) const
     {
@@ -49,6 +311,29 @@ struct ChecksumCalc
             (static_cast<std::uint16_t>(ckB) << std::numeric_limits<std::uint8_t>::digits) |
             ckA;
     }
+
+    /// @brief Calculate checksum of the contiguous buffer.
+    /// @param[in, out] iter Pointer to the data, advanced by @b len.
+    /// @param[in] len Number of bytes to process.
+    /// @return Checksum value, @b CK_A is the least significant byte,
+    ///     @b CK_B is the most significant one.
+    std::uint16_t operator()(const std::uint8_t*& iter, std::size_t len) const
+    {
+        details::ChecksumState state;
+        details::checksumUpdate(state, iter, len);
+        iter += len;
+        return details::checksumValue(state);
+    }
+
+    /// @brief Same as other operator()(const std::uint8_t*&, std::size_t) const,
+    ///     but for the writable buffer.
+    std::uint16_t operator()(std::uint8_t*& iter, std::size_t len) const
+    {
+        const std::uint8_t* constIter = iter;
+        auto result = operator()(constIter, len);
+        iter += len;
+        return result;
+    }
 };
 
 }  // namespace protocol
@@ -0,0 +1,188 @@
+//
+// Copyright 2018 (C). Alex Robenko. All rights reserved.
+//
+
+// This file is free software: you can redistribute it and/or modify
+// it under the terms of the GNU General Public License as published by
+// the Free Software Foundation, either version 3 of the License, or
+// (at your option) any later version.
+//
+// This program is distributed in the hope that it will be useful,
+// but WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+// GNU General Public License for more details.
+//
+// You should have received a copy of the GNU General Public License
+// along with this program.  If not, see <http://www.gnu.org/licenses/>.
+
+/// @file
+/// @brief Contains definition of ublox::protocol::FrameScanner class.
+
+#pragma once
+
+#include <cstdint>
+#include <cstddef>
+#include <cstring>
+#include <limits>
+
+#include "comms/ErrorStatus.h"
+
+#include "ChecksumCalc.h"
+
+namespace ublox
+{
+
+namespace protocol
+{
+
+/// @brief Result of the single frame scan performed by @ref FrameScanner.
+struct FrameScanResult
+{
+    /// @brief Status of the scan.
+    /// @details @b comms::ErrorStatus::Success when complete valid frame
+    ///     has been found, @b comms::ErrorStatus::NotEnoughData when the
+    ///     input buffer ended before the frame was complete.
+    comms::ErrorStatus m_status = comms::ErrorStatus::NotEnoughData;
+
+    /// @brief Pointer to the first sync character of the found frame.
+    /// @details Valid only when @ref m_status is @b comms::ErrorStatus::Success.
+    const std::uint8_t* m_frame = nullptr;
+
+    /// @brief Full length of the found frame, including sync characters
+    ///     and checksum.
+    std::size_t m_frameLen = 0U;
+
+    /// @brief Number of bytes at the beginning of the scanned buffer,
+    ///     which cannot be part of any valid frame and must be dropped.
+    std::size_t m_discarded = 0U;
+};
+
+/// @brief Locator of the complete UBX frames in the raw input data.
+/// @details Intended to be used in front of @ref ublox::Stack. Skips all the
+///     garbage (NMEA sentences, line noise) in a single linear pass:
+///     @li The @b 0xb5 sync character is searched using @b std::memchr.
+///     @li The second sync character (@b 0x62) and @b LENGTH field are
+///         validated before any checksum calculation takes place.
+///     @li The checksum is calculated (see @ref ChecksumCalc) only once the whole
+///         frame is available.
+///
+///     The frame reported as found is guaranteed to be properly wrapped, so
+///     it can be passed directly to @b read() member function of the @ref ublox::Stack
+///     with the exact frame length.
+/// @tparam TMaxPayloadLen Maximal expected payload length. The frames
+///     reporting bigger payload are treated as false detection of the sync
+///     characters and are skipped. Limiting the value prevents waiting
+///     for large amount of data when synchronisation sequence appears in
+///     the noise.
+template <std::size_t TMaxPayloadLen = std::numeric_limits<std::uint16_t>::max()>
+class FrameScanner
+{
+public:
+    /// @brief First synchronisation character.
+    static const std::uint8_t SyncChar1 = 0xb5;
+
+    /// @brief Second synchronisation character.
+    static const std::uint8_t SyncChar2 = 0x62;
+
+    /// @brief Length of the frame header (sync, class, id, length).
+    static const std::size_t HeaderLen = 6U;
+
+    /// @brief Length of the checksum suffix.
+    static const std::size_t ChecksumLen = 2U;
+
+    /// @brief Minimal length of the full frame (empty payload).
+    static const std::size_t MinFrameLen = HeaderLen + ChecksumLen;
+
+    /// @brief Maximal length of the full frame.
+    static const std::size_t MaxFrameLen = MinFrameLen + TMaxPayloadLen;
+
+    /// @brief Locate first complete frame in the provided buffer.
+    /// @param[in] buf Pointer to the beginning of the input data.
+    /// @param[in] len Number of bytes in the input buffer.
+    /// @return Scan result, see @ref FrameScanResult. Even when complete frame
+    ///     hasn't been found, the @b m_discarded member may indicate that
+    ///     some bytes at the beginning of the buffer are not needed any more.
+    FrameScanResult scan(const std::uint8_t* buf, std::size_t len)
+    {
+        FrameScanResult result;
+        std::size_t pos = 0U;
+        while (pos < len) {
+            auto* sync = static_cast<const std::uint8_t*>(std::memchr(buf + pos, SyncChar1, len - pos));
+            if (sync == nullptr) {
+                pos = len;
+                break;
+            }
+
+            pos = static_cast<std::size_t>(sync - buf);
+            auto remLen = len - pos;
+            if (remLen < 2U) {
+                break;
+            }
+
+            if (sync[1] != SyncChar2) {
+                ++pos;
+                continue;
+            }
+
+            if (remLen < HeaderLen) {
+                break;
+            }
+
+            auto payloadLen =
+                static_cast<std::size_t>(sync[4]) |
+                (static_cast<std::size_t>(sync[5]) << std::numeric_limits<std::uint8_t>::digits);
+
+            if (TMaxPayloadLen < payloadLen) {
+                pos += 2U;
+                continue;
+            }
+
+            auto frameLen = MinFrameLen + payloadLen;
+            if (remLen < frameLen) {
+                break;
+            }
+
+            const std::uint8_t* checksumIter = sync + 2U;
+            auto expected = ChecksumCalc()(checksumIter, (HeaderLen - 2U) + payloadLen);
+            auto actual =
+                static_cast<std::uint16_t>(
+                    checksumIter[0] |
+                    (static_cast<unsigned>(checksumIter[1]) << std::numeric_limits<std::uint8_t>::digits));
+
+            if (expected != actual) {
+                pos += 2U;
+                continue;
+            }
+
+            result.m_status = comms::ErrorStatus::Success;
+            result.m_frame = sync;
+            result.m_frameLen = frameLen;
+            break;
+        }
+
+        result.m_discarded = pos;
+        m_discardedCount += pos;
+        return result;
+    }
+
+    /// @brief Get total number of bytes discarded by all the scans so far.
+    std::size_t discardedCount() const
+    {
+        return m_discardedCount;
+    }
+
+    /// @brief Reset the counter of the discarded bytes.
+    void resetDiscardedCount()
+    {
+        m_discardedCount = 0U;
+    }
+
+private:
+    std::size_t m_discardedCount = 0U;
+};
+
+}  // namespace protocol
+
+}  // namespace ublox
+
+
@@ -0,0 +1,296 @@
+//
+// Copyright 2018 (C). Alex Robenko. All rights reserved.
+//
+
+// This file is free software: you can redistribute it and/or modify
+// it under the terms of the GNU General Public License as published by
+// the Free Software Foundation, either version 3 of the License, or
+// (at your option) any later version.
+//
+// This program is distributed in the hope that it will be useful,
+// but WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+// GNU General Public License for more details.
+//
+// You should have received a copy of the GNU General Public License
+// along with this program.  If not, see <http://www.gnu.org/licenses/>.
+
+/// @file
+/// @brief Contains definition of text formatting helpers used by the
+///     RINEX writers.
+
+#pragma once
+
+#include <cstdint>
+#include <cstddef>
+#include <cstdio>
+#include <cstring>
+#include <cmath>
+#include <ctime>
+#include <string>
+
+namespace ublox
+{
+
+/// @brief Conversion of the receiver data into RINEX format.
+namespace rinex
+{
+
+/// @brief Calendar time.
+struct CalendarTime
+{
+    int m_year = 1980; ///< Year
+    int m_month = 1; ///< Month (1 - 12)
+    int m_day = 6; ///< Day of month (1 - 31)
+    int m_hour = 0; ///< Hour (0 - 23)
+    int m_min = 0; ///< Minute (0 - 59)
+    double m_sec = 0.0; ///< Seconds (0 - 60)
+};
+
+/// @brief Convert GPS week and time of week into calendar time of GPS
+///     time scale.
+/// @details The seconds are rounded to 100 nanoseconds, the precision
+///     of RINEX epoch time.
+inline CalendarTime gpsCalendarTime(unsigned week, double tow)
+{
+    static const std::int64_t TicksPerSec = 10000000;
+    static const std::int64_t TicksPerDay = TicksPerSec * 86400;
+    static const std::int64_t GpsEpochDays = 3657; // 1980-01-06 since 1970-01-01
+
+    auto ticks =
+        static_cast<std::int64_t>(week) * 7 * TicksPerDay +
+        static_cast<std::int64_t>(std::floor(tow * static_cast<double>(TicksPerSec) + 0.5));
+    auto days = ticks / TicksPerDay;
+    auto dayTicks = ticks - (days * TicksPerDay);
+    if (dayTicks < 0) {
+        dayTicks += TicksPerDay;
+        --days;
+    }
+
+    // Civil from days, see http://howardhinnant.github.io/date_algorithms.html
+    auto z = days + GpsEpochDays + 719468;
+    auto era = ((0 <= z) ? z : z - 146096) / 146097;
+    auto doe = static_cast<unsigned>(z - era * 146097);
+    auto yoe = (doe - doe / 1460U + doe / 36524U - doe / 146096U) / 365U;
+    auto doy = doe - (365U * yoe + yoe / 4U - yoe / 100U);
+    auto mp = (5U * doy + 2U) / 153U;
+
+    CalendarTime result;
+    result.m_day = static_cast<int>(doy - (153U * mp + 2U) / 5U + 1U);
+    result.m_month = static_cast<int>((mp < 10U) ? (mp + 3U) : (mp - 9U));
+    result.m_year = static_cast<int>(static_cast<std::int64_t>(yoe) + era * 400 + ((result.m_month <= 2) ? 1 : 0));
+    result.m_hour = static_cast<int>(dayTicks / (3600 * TicksPerSec));
+    result.m_min = static_cast<int>((dayTicks / (60 * TicksPerSec)) % 60);
+    result.m_sec = static_cast<double>(dayTicks % (60 * TicksPerSec)) / static_cast<double>(TicksPerSec);
+    return result;
+}
+
+/// @brief Current UTC time formatted for @b "PGM / RUN BY / DATE" header line.
+inline std::string currentFileDate()
+{
+    char date[32] = {0};
+    auto now = std::time(nullptr);
+    auto* utc = std::gmtime(&now);
+    if (utc != nullptr) {
+        std::strftime(date, sizeof(date), "%Y%m%d %H%M%S UTC", utc);
+    }
+    return date;
+}
+
+/// @brief Output buffer of RINEX text.
+/// @details Provides formatting of the fixed width fields without
+///     involvement of the iostreams or @b printf() for the integral and
+///     fixed point values.
+class TextBuffer
+{
+public:
+    /// @brief Append the character.
+    void append(char ch)
+    {
+        m_data.push_back(ch);
+    }
+
+    /// @brief Append the characters repeated specified number of times.
+    void append(char ch, std::size_t count)
+    {
+        m_data.append(count, ch);
+    }
+
+    /// @brief Append the text, padded with spaces or truncated to the width.
+    /// @param[in] text Text to append.
+    /// @param[in] width Width of the field.
+    /// @param[in] right Align to the right rather than to the left.
+    void appendText(const std::string& text, std::size_t width, bool right = false)
+    {
+        auto len = (width < text.size()) ? width : text.size();
+        if (right) {
+            append(' ', width - len);
+        }
+
+        m_data.append(text, 0U, len);
+        if (!right) {
+            append(' ', width - len);
+        }
+    }
+
+    /// @brief Append the integral value right aligned in the field.
+    /// @param[in] value Value to append.
+    /// @param[in] width Width of the field.
+    /// @param[in] zeroPad Pad with zeroes rather than spaces.
+    void appendInt(std::int64_t value, std::size_t width, bool zeroPad = false)
+    {
+        char buf[24];
+        auto len = formatInt(value, buf, zeroPad ? width : 0U);
+        appendField(buf, len, width);
+    }
+
+    /// @brief Append the fixed point value right aligned in the field
+    ///     (Fortran @b Fw.d format).
+    /// @details The field is left blank when the value doesn't fit.
+    void appendFixed(double value, std::size_t width, unsigned decimals)
+    {
+        static const std::uint64_t Pow10[] = {
+            1U, 10U, 100U, 1000U, 10000U, 100000U, 1000000U, 10000000U,
+            100000000U, 1000000000U, 10000000000U, 100000000000U, 1000000000000U
+        };
+
+        if (((sizeof(Pow10) / sizeof(Pow10[0])) <= decimals) || (!std::isfinite(value))) {
+            append(' ', width);
+            return;
+        }
+
+        auto scaled = std::fabs(value) * static_cast<double>(Pow10[decimals]);
+        if (9.0e18 <= scaled) {
+            append(' ', width);
+            return;
+        }
+
+        auto units = static_cast<std::uint64_t>(scaled + 0.5);
+        auto intPart = units / Pow10[decimals];
+        auto fracPart = units % Pow10[decimals];
+
+        char buf[48];
+        std::size_t len = 0U;
+        if ((value < 0.0) && (units != 0U)) {
+            buf[len++] = '-';
+        }
+
+        len += formatUInt(intPart, &buf[len], 0U);
+        if (0U < decimals) {
+            buf[len++] = '.';
+            len += formatUInt(fracPart, &buf[len], decimals);
+        }
+
+        if (width < len) {
+            append(' ', width);
+            return;
+        }
+
+        appendField(buf, len, width);
+    }
+
+    /// @brief Append the value in exponential format (Fortran @b Dw.d format,
+    ///     using @b E as exponent character).
+    void appendExp(double value, std::size_t width, unsigned decimals)
+    {
+        char buf[64];
+        auto result = std::snprintf(buf, sizeof(buf), "%*.*E", static_cast<int>(width), static_cast<int>(decimals), value);
+        if ((result < 0) || (static_cast<std::size_t>(result) != width)) {
+            append(' ', width);
+            return;
+        }
+        m_data.append(buf, width);
+    }
+
+    /// @brief Pad the current line with spaces to the specified column.
+    void padTo(std::size_t column)
+    {
+        auto lineStart = m_data.rfind('\n');
+        lineStart = (lineStart == std::string::npos) ? 0U : lineStart + 1U;
+        auto lineLen = m_data.size() - lineStart;
+        if (lineLen < column) {
+            append(' ', column - lineLen);
+        }
+    }
+
+    /// @brief Complete the header line: pad the content to 60 columns
+    ///     and append the label.
+    void endHeaderLine(const char* label)
+    {
+        padTo(60U);
+        appendText(label, 20U);
+        endLine();
+    }
+
+    /// @brief Complete the line, the trailing spaces are removed.
+    void endLine()
+    {
+        while ((!m_data.empty()) && (m_data.back() == ' ')) {
+            m_data.pop_back();
+        }
+        m_data.push_back('\n');
+    }
+
+    /// @brief Accumulated text.
+    const std::string& str() const
+    {
+        return m_data;
+    }
+
+    /// @brief Remove the accumulated text, keeps the allocated memory.
+    void clear()
+    {
+        m_data.clear();
+    }
+
+    /// @brief Write the accumulated text to the file and clear the buffer.
+    /// @return @b true on success.
+    bool flush(std::FILE* file)
+    {
+        auto result = (std::fwrite(m_data.data(), 1U, m_data.size(), file) == m_data.size());
+        m_data.clear();
+        return result;
+    }
+
+private:
+    static std::size_t formatUInt(std::uint64_t value, char* buf, std::size_t minDigits)
+    {
+        char digits[24];
+        std::size_t count = 0U;
+        do {
+            digits[count++] = static_cast<char>('0' + (value % 10U));
+            value /= 10U;
+        } while ((value != 0U) || (count < minDigits));
+
+        for (std::size_t idx = 0U; idx < count; ++idx) {
+            buf[idx] = digits[count - idx - 1U];
+        }
+        return count;
+    }
+
+    static std::size_t formatInt(std::int64_t value, char* buf, std::size_t minDigits)
+    {
+        if (value < 0) {
+            buf[0] = '-';
+            auto minRest = (0U < minDigits) ? minDigits - 1U : 0U;
+            return 1U + formatUInt(static_cast<std::uint64_t>(-(value + 1)) + 1U, buf + 1, minRest);
+        }
+        return formatUInt(static_cast<std::uint64_t>(value), buf, minDigits);
+    }
+
+    void appendField(const char* buf, std::size_t len, std::size_t width)
+    {
+        if (len < width) {
+            append(' ', width - len);
+        }
+        m_data.append(buf, len);
+    }
+
+    std::string m_data;
+};
+
+} // namespace rinex
+
+}  // namespace ublox
+
+
@@ -0,0 +1,460 @@
+//
+// Copyright 2018 (C). Alex Robenko. All rights reserved.
+//
+
+// This file is free software: you can redistribute it and/or modify
+// it under the terms of the GNU General Public License as published by
+// the Free Software Foundation, either version 3 of the License, or
+// (at your option) any later version.
+//
+// This program is distributed in the hope that it will be useful,
+// but WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+// GNU General Public License for more details.
+//
+// You should have received a copy of the GNU General Public License
+// along with this program.  If not, see <http://www.gnu.org/licenses/>.
+
+/// @file
+/// @brief Contains definition of ublox::rinex::GpsLnavDecoder class.
+
+#pragma once
+
+#include <cstdint>
+#include <cstddef>
+#include <ctime>
+#include <cmath>
+#include <array>
+#include <algorithm>
+
+#include "ublox/message/RxmSfrbx.h"
+
+namespace ublox
+{
+
+namespace rinex
+{
+
+/// @brief GPS broadcast ephemeris decoded out of LNAV subframes 1 - 3.
+/// @details The angles are in radians, the times are in seconds of the
+///     GPS week.
+struct GpsEphemeris
+{
+    unsigned m_prn = 0U; ///< Satellite PRN number
+    unsigned m_week = 0U; ///< Full GPS week number of @ref m_toe
+    unsigned m_tocWeek = 0U; ///< Full GPS week number of @ref m_toc
+    unsigned m_iode = 0U; ///< Issue of data, ephemeris
+    unsigned m_iodc = 0U; ///< Issue of data, clock
+    unsigned m_ura = 0U; ///< User range accuracy index
+    unsigned m_health = 0U; ///< Satellite health
+    unsigned m_codeL2 = 0U; ///< Codes on L2 channel
+    unsigned m_flagL2P = 0U; ///< L2 P data flag
+    double m_ttr = 0.0; ///< Transmission time of the subframe 1
+    double m_toc = 0.0; ///< Clock data reference time
+    double m_toe = 0.0; ///< Ephemeris reference time
+    double m_af0 = 0.0; ///< Clock bias [s]
+    double m_af1 = 0.0; ///< Clock drift [s/s]
+    double m_af2 = 0.0; ///< Clock drift rate [s/s^2]
+    double m_tgd = 0.0; ///< Group delay differential [s]
+    double m_crs = 0.0; ///< Sine correction to the orbit radius [m]
+    double m_deltaN = 0.0; ///< Mean motion difference [rad/s]
+    double m_m0 = 0.0; ///< Mean anomaly at reference time
+    double m_cuc = 0.0; ///< Cosine correction to the argument of latitude
+    double m_e = 0.0; ///< Eccentricity
+    double m_cus = 0.0; ///< Sine correction to the argument of latitude
+    double m_sqrtA = 0.0; ///< Square root of the semi-major axis [m^0.5]
+    double m_cic = 0.0; ///< Cosine correction to the inclination
+    double m_omega0 = 0.0; ///< Longitude of ascending node at weekly epoch
+    double m_cis = 0.0; ///< Sine correction to the inclination
+    double m_i0 = 0.0; ///< Inclination at reference time
+    double m_crc = 0.0; ///< Cosine correction to the orbit radius [m]
+    double m_omega = 0.0; ///< Argument of perigee
+    double m_omegaDot = 0.0; ///< Rate of right ascension [rad/s]
+    double m_idot = 0.0; ///< Rate of inclination [rad/s]
+    double m_fitInterval = 0.0; ///< Curve fit interval [hours], @b 0 when unknown
+};
+
+/// @brief Statistics of the GPS LNAV decoder.
+struct GpsLnavStats
+{
+    std::size_t m_subframes = 0U; ///< Number of handled subframes
+    std::size_t m_cached = 0U; ///< Number of subframes identical to the cached ones
+    std::size_t m_parityErrors = 0U; ///< Number of subframes dropped due to parity error
+    std::size_t m_ephemerides = 0U; ///< Number of reported ephemerides
+    std::size_t m_duplicates = 0U; ///< Number of assembled ephemerides identical to the reported ones
+};
+
+/// @brief Decoder of GPS LNAV ephemerides out of RXM-SFRBX subframes.
+/// @details The subframes 1, 2 and 3 of every satellite are collected,
+///     parity of every word is checked (both inverted and not inverted
+///     data bits are accepted), and the ephemeris is reported as soon as
+///     all three subframes with matching IODC / IODE values are available.
+///     The ephemeris having the same IODC, IODE and reference time as the
+///     previously reported one for the same satellite is not reported again.@n
+///     The words 3 - 10 of the last accepted subframes 1 - 3 are cached per
+///     satellite. They don't change until the data set is updated (unlike
+///     TLM and HOW words, the latter contains time of week), i.e. the
+///     same subframe repeated every 30 seconds is recognised by the
+///     comparison with the cached words and dropped without parity
+///     check or decoding.@n
+///     The transmitted week number is 10 bits long, the full week is the one
+///     closest to the reference week (see setReferenceWeek()), which defaults
+///     to the current week according to the system clock.
+class GpsLnavDecoder
+{
+public:
+    /// @brief Number of 32 bit words in GPS LNAV subframe.
+    static const std::size_t WordsCount = 10U;
+
+    /// @brief Maximal supported PRN number.
+    static const unsigned MaxPrn = 32U;
+
+    /// @brief Constructor
+    GpsLnavDecoder()
+    {
+        static const std::time_t GpsEpoch = 315964800; // 1980-01-06 in Unix time
+        auto now = std::time(nullptr);
+        if (GpsEpoch < now) {
+            m_refWeek = static_cast<unsigned>((now - GpsEpoch) / SecondsInWeek);
+        }
+    }
+
+    /// @brief Set the reference full GPS week number used to resolve the
+    ///     week rollover, for example received in RXM-RAWX.
+    void setReferenceWeek(unsigned week)
+    {
+        m_refWeek = week;
+    }
+
+    /// @brief Handle RXM-SFRBX message.
+    /// @return Pointer to the new ephemeris, @b nullptr if none.
+    template <typename TMsgBase, typename TDwrdOpt>
+    const GpsEphemeris* handle(const message::RxmSfrbx<TMsgBase, TDwrdOpt>& msg)
+    {
+        std::array<std::uint32_t, WordsCount> words;
+        auto& dwrd = msg.field_dwrd().value();
+        if (dwrd.size() != WordsCount) {
+            return nullptr;
+        }
+
+        for (std::size_t idx = 0U; idx < WordsCount; ++idx) {
+            words[idx] = dwrd[idx].value();
+        }
+
+        return handleWords(
+            static_cast<std::uint8_t>(msg.field_gnssId().value()),
+            msg.field_svId().value(),
+            &words[0],
+            WordsCount);
+    }
+
+    /// @brief Handle the payload of RXM-SFRBX message.
+    /// @return Pointer to the new ephemeris, @b nullptr if none.
+    const GpsEphemeris* handlePayload(const std::uint8_t* payload, std::size_t len)
+    {
+        static const std::size_t HeaderLen = 8U;
+        if ((len < HeaderLen) || (payload[4] != WordsCount) || (len < (HeaderLen + (WordsCount * 4U)))) {
+            return nullptr;
+        }
+
+        std::array<std::uint32_t, WordsCount> words;
+        auto* data = payload + HeaderLen;
+        for (auto& word : words) {
+            word =
+                static_cast<std::uint32_t>(data[0]) |
+                (static_cast<std::uint32_t>(data[1]) << 8) |
+                (static_cast<std::uint32_t>(data[2]) << 16) |
+                (static_cast<std::uint32_t>(data[3]) << 24);
+            data += 4;
+        }
+
+        return handleWords(payload[0], payload[1], &words[0], WordsCount);
+    }
+
+    /// @brief Handle the navigation words reported by RXM-SFRBX.
+    /// @param[in] gnssId GNSS identifier, only GPS (@b 0) is decoded.
+    /// @param[in] svId Satellite identifier.
+    /// @param[in] words Navigation words.
+    /// @param[in] count Number of words.
+    /// @return Pointer to the new ephemeris, @b nullptr if none.
+    const GpsEphemeris* handleWords(std::uint8_t gnssId, std::uint8_t svId, const std::uint32_t* words, std::size_t count)
+    {
+        if ((gnssId != 0U) || (svId == 0U) || (MaxPrn < svId) || (count != WordsCount)) {
+            return nullptr;
+        }
+
+        ++m_stats.m_subframes;
+        auto& sat = m_sats[svId - 1U];
+        for (std::size_t idx = 0U; idx < sat.m_bodies.size(); ++idx) {
+            if (((sat.m_bodiesMask & (1U << idx)) != 0U) && sameBody(words, sat.m_bodies[idx])) {
+                ++m_stats.m_cached;
+                return nullptr;
+            }
+        }
+
+        Subframe data;
+        if (!checkParity(words, data)) {
+            ++m_stats.m_parityErrors;
+            return nullptr;
+        }
+
+        // The subframe ID is in the HOW word, bits 20 - 22 out of 24 data bits
+        auto subframeId = (data[1] >> 2) & 0x7;
+        if ((subframeId < 1U) || (3U < subframeId)) {
+            return nullptr;
+        }
+
+        auto& body = sat.m_bodies[subframeId - 1U];
+        for (std::size_t idx = 0U; idx < body.size(); ++idx) {
+            body[idx] = words[idx + BodyOffset] & WordMask;
+        }
+        sat.m_bodiesMask |= (1U << (subframeId - 1U));
+
+        auto& eph = sat.m_pending;
+        if (subframeId == 1U) {
+            decodeSubframe1(data, eph, sat.m_week);
+        }
+        else if (subframeId == 2U) {
+            decodeSubframe2(data, eph, sat.m_iode2);
+        }
+        else {
+            decodeSubframe3(data, eph, sat.m_iode3);
+        }
+
+        sat.m_received |= static_cast<unsigned>(1U << subframeId);
+        if ((sat.m_received != 0xe) ||
+            (sat.m_iode2 != sat.m_iode3) ||
+            (sat.m_iode2 != (eph.m_iodc & 0xff))) {
+            return nullptr;
+        }
+
+        eph.m_prn = svId;
+        eph.m_iode = sat.m_iode2;
+        resolveWeeks(sat.m_week, eph);
+
+        if (sat.m_reported &&
+            (sat.m_current.m_iodc == eph.m_iodc) &&
+            (sat.m_current.m_iode == eph.m_iode) &&
+            (sat.m_current.m_toe == eph.m_toe)) {
+            ++m_stats.m_duplicates;
+            return nullptr;
+        }
+
+        sat.m_current = eph;
+        sat.m_reported = true;
+        ++m_stats.m_ephemerides;
+        return &sat.m_current;
+    }
+
+    /// @brief Get the last reported ephemeris of the satellite.
+    /// @return Pointer to the ephemeris, @b nullptr if none.
+    const GpsEphemeris* ephemeris(unsigned prn) const
+    {
+        if ((prn == 0U) || (MaxPrn < prn) || (!m_sats[prn - 1U].m_reported)) {
+            return nullptr;
+        }
+
+        return &m_sats[prn - 1U].m_current;
+    }
+
+    /// @brief Get the decoding statistics.
+    const GpsLnavStats& stats() const
+    {
+        return m_stats;
+    }
+
+private:
+    using Subframe = std::array<std::uint32_t, WordsCount>; // 24 data bits per word
+
+    // The words following TLM and HOW, they don't change until the data set
+    // is updated.
+    static const std::size_t BodyOffset = 2U;
+    using Body = std::array<std::uint32_t, WordsCount - BodyOffset>;
+
+    struct SatState
+    {
+        std::array<Body, 3> m_bodies;
+        unsigned m_bodiesMask = 0U;
+        GpsEphemeris m_pending;
+        GpsEphemeris m_current;
+        unsigned m_received = 0U;
+        unsigned m_week = 0U;
+        unsigned m_iode2 = 0U;
+        unsigned m_iode3 = 0U;
+        bool m_reported = false;
+    };
+
+    static const unsigned SecondsInWeek = 604800U;
+    static const std::uint32_t WordMask = 0x3fffffff;
+
+    static bool sameBody(const std::uint32_t* words, const Body& body)
+    {
+        for (std::size_t idx = 0U; idx < body.size(); ++idx) {
+            if ((words[idx + BodyOffset] & WordMask) != body[idx]) {
+                return false;
+            }
+        }
+        return true;
+    }
+
+    static unsigned parityBit(std::uint32_t data, std::uint32_t mask, unsigned prevBit)
+    {
+        auto value = data & mask;
+        value ^= value >> 16;
+        value ^= value >> 8;
+        value ^= value >> 4;
+        value ^= value >> 2;
+        value ^= value >> 1;
+        return (value ^ prevBit) & 0x1;
+    }
+
+    static unsigned parity(std::uint32_t data, unsigned d29, unsigned d30)
+    {
+        // IS-GPS-200, table 20-XIV, d1 is the MSB of 24 bit data
+        return
+            (parityBit(data, 0xec7cd2, d29) << 5) |
+            (parityBit(data, 0x763e69, d30) << 4) |
+            (parityBit(data, 0xbb1f34, d29) << 3) |
+            (parityBit(data, 0x5d8f9a, d30) << 2) |
+            (parityBit(data, 0xaec7cd, d30) << 1) |
+            parityBit(data, 0x2dea27, d29);
+    }
+
+    static bool checkParity(const std::uint32_t* words, Subframe& data)
+    {
+        // D29 and D30 of the last word of every subframe are always 0
+        unsigned d29 = 0U;
+        unsigned d30 = 0U;
+        for (std::size_t idx = 0U; idx < WordsCount; ++idx) {
+            auto word = words[idx] & WordMask;
+            auto bits = (word >> 6) & 0xffffff;
+            auto expected = word & 0x3f;
+            if (parity(bits, d29, d30) != expected) {
+                bits ^= 0xffffff;
+                if ((d30 == 0U) || (parity(bits, d29, d30) != expected)) {
+                    return false;
+                }
+            }
+
+            data[idx] = bits;
+            d29 = (word >> 1) & 0x1;
+            d30 = word & 0x1;
+        }
+
+        return (data[0] >> 16) == 0x8b; // Preamble
+    }
+
+    static std::uint32_t bitsU(const Subframe& data, unsigned pos, unsigned len)
+    {
+        std::uint32_t value = 0U;
+        for (auto bit = pos; bit < (pos + len); ++bit) {
+            auto word = data[bit / 24U];
+            value = (value << 1) | ((word >> (23U - (bit % 24U))) & 0x1);
+        }
+        return value;
+    }
+
+    static std::int32_t bitsS(const Subframe& data, unsigned pos, unsigned len)
+    {
+        auto value = bitsU(data, pos, len);
+        if ((len < 32U) && (((value >> (len - 1U)) & 0x1) != 0U)) {
+            value |= ~((std::uint32_t(1U) << len) - 1U);
+        }
+        return static_cast<std::int32_t>(value);
+    }
+
+    static double scaled(std::int64_t value, int exp)
+    {
+        return std::ldexp(static_cast<double>(value), exp);
+    }
+
+    static double semiCircles(std::int64_t value, int exp)
+    {
+        static const double Pi = 3.1415926535898; // Value defined by IS-GPS-200
+        return scaled(value, exp) * Pi;
+    }
+
+    static void decodeSubframe1(const Subframe& data, GpsEphemeris& eph, unsigned& week)
+    {
+        eph.m_ttr = static_cast<double>(bitsU(data, 24U, 17U) * 6U);
+        week = bitsU(data, 48U, 10U);
+        eph.m_codeL2 = bitsU(data, 58U, 2U);
+        eph.m_ura = bitsU(data, 60U, 4U);
+        eph.m_health = bitsU(data, 64U, 6U);
+        auto iodcMsb = bitsU(data, 70U, 2U);
+        eph.m_flagL2P = bitsU(data, 72U, 1U);
+        auto tgd = bitsS(data, 160U, 8U);
+        eph.m_iodc = (iodcMsb << 8) | bitsU(data, 168U, 8U);
+        eph.m_toc = static_cast<double>(bitsU(data, 176U, 16U) * 16U);
+        eph.m_af2 = scaled(bitsS(data, 192U, 8U), -55);
+        eph.m_af1 = scaled(bitsS(data, 200U, 16U), -43);
+        eph.m_af0 = scaled(bitsS(data, 216U, 22U), -31);
+        eph.m_tgd = (tgd == -128) ? 0.0 : scaled(tgd, -31);
+    }
+
+    static void decodeSubframe2(const Subframe& data, GpsEphemeris& eph, unsigned& iode)
+    {
+        iode = bitsU(data, 48U, 8U);
+        eph.m_crs = scaled(bitsS(data, 56U, 16U), -5);
+        eph.m_deltaN = semiCircles(bitsS(data, 72U, 16U), -43);
+        eph.m_m0 = semiCircles(bitsS(data, 88U, 32U), -31);
+        eph.m_cuc = scaled(bitsS(data, 120U, 16U), -29);
+        eph.m_e = scaled(bitsU(data, 136U, 32U), -33);
+        eph.m_cus = scaled(bitsS(data, 168U, 16U), -29);
+        eph.m_sqrtA = scaled(bitsU(data, 184U, 32U), -19);
+        eph.m_toe = static_cast<double>(bitsU(data, 216U, 16U) * 16U);
+        eph.m_fitInterval = (bitsU(data, 232U, 1U) == 0U) ? 4.0 : 0.0;
+    }
+
+    static void decodeSubframe3(const Subframe& data, GpsEphemeris& eph, unsigned& iode)
+    {
+        eph.m_cic = scaled(bitsS(data, 48U, 16U), -29);
+        eph.m_omega0 = semiCircles(bitsS(data, 64U, 32U), -31);
+        eph.m_cis = scaled(bitsS(data, 96U, 16U), -29);
+        eph.m_i0 = semiCircles(bitsS(data, 112U, 32U), -31);
+        eph.m_crc = scaled(bitsS(data, 144U, 16U), -5);
+        eph.m_omega = semiCircles(bitsS(data, 160U, 32U), -31);
+        eph.m_omegaDot = semiCircles(bitsS(data, 192U, 24U), -43);
+        iode = bitsU(data, 216U, 8U);
+        eph.m_idot = semiCircles(bitsS(data, 224U, 14U), -43);
+    }
+
+    static unsigned adjustWeek(unsigned week, double time, double ttr)
+    {
+        static const double HalfWeek = 302400.0;
+        if ((time - ttr) < -HalfWeek) {
+            return week + 1U;
+        }
+
+        if ((HalfWeek < (time - ttr)) && (0U < week)) {
+            return week - 1U;
+        }
+
+        return week;
+    }
+
+    void resolveWeeks(unsigned truncatedWeek, GpsEphemeris& eph) const
+    {
+        static const unsigned Rollover = 1024U;
+        auto week = (truncatedWeek % Rollover) + ((m_refWeek / Rollover) * Rollover);
+        if ((m_refWeek + (Rollover / 2U)) < week) {
+            week -= Rollover;
+        }
+        else if ((week + (Rollover / 2U)) < m_refWeek) {
+            week += Rollover;
+        }
+
+        eph.m_week = adjustWeek(week, eph.m_toe, eph.m_ttr);
+        eph.m_tocWeek = adjustWeek(week, eph.m_toc, eph.m_ttr);
+    }
+
+    std::array<SatState, MaxPrn> m_sats;
+    GpsLnavStats m_stats;
+    unsigned m_refWeek = 0U;
+};
+
+} // namespace rinex
+
+}  // namespace ublox
+
+
@@ -0,0 +1,232 @@
+//
+// Copyright 2018 (C). Alex Robenko. All rights reserved.
+//
+
+// This file is free software: you can redistribute it and/or modify
+// it under the terms of the GNU General Public License as published by
+// the Free Software Foundation, either version 3 of the License, or
+// (at your option) any later version.
+//
+// This program is distributed in the hope that it will be useful,
+// but WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+// GNU General Public License for more details.
+//
+// You should have received a copy of the GNU General Public License
+// along with this program.  If not, see <http://www.gnu.org/licenses/>.
+
+/// @file
+/// @brief Contains definition of ublox::rinex::NavWriter class.
+
+#pragma once
+
+#include <cstdint>
+#include <cstddef>
+#include <cstdio>
+#include <initializer_list>
+#include <string>
+
+#include "GpsLnavDecoder.h"
+#include "Format.h"
+
+namespace ublox
+{
+
+namespace rinex
+{
+
+/// @brief Information reported in the header of the RINEX navigation file.
+struct NavHeaderInfo
+{
+    std::string m_program = "ublox"; ///< Name of the program creating the file
+    std::string m_runBy; ///< Name of the agency creating the file
+    std::string m_date; ///< Date of the file creation, current UTC time when empty
+};
+
+/// @brief Streaming writer of RINEX 3.03 GPS navigation file.
+/// @details The header is written when the file is opened, every ephemeris
+///     is appended as a separate record immediately, i.e. the writer is
+///     expected to be fed with the ephemerides reported by
+///     @ref GpsLnavDecoder.
+/// @code
+/// ublox::rinex::GpsLnavDecoder decoder;
+/// ublox::rinex::NavWriter writer;
+/// writer.open("rover.18n");
+///
+/// void MyHandler::handle(InRxmSfrbx& msg)
+/// {
+///     auto* eph = decoder.handle(msg);
+///     if (eph != nullptr) {
+///         writer.write(*eph);
+///     }
+/// }
+/// @endcode
+class NavWriter
+{
+public:
+    /// @brief Default constructor
+    NavWriter() = default;
+
+    /// @brief Copy constructor is deleted
+    NavWriter(const NavWriter&) = delete;
+
+    /// @brief Destructor
+    ~NavWriter()
+    {
+        close();
+    }
+
+    /// @brief Copy assignment is deleted
+    NavWriter& operator=(const NavWriter&) = delete;
+
+    /// @brief Set the information reported in the header.
+    /// @details Must be invoked before the file is opened.
+    void setHeaderInfo(const NavHeaderInfo& info)
+    {
+        m_info = info;
+    }
+
+    /// @brief Create the file, truncates the existing one, and write the header.
+    /// @return @b true on success.
+    bool open(const char* path)
+    {
+        close();
+        m_file = std::fopen(path, "w");
+        m_recordsCount = 0U;
+        if (m_file == nullptr) {
+            return false;
+        }
+
+        writeHeader();
+        return m_buf.flush(m_file);
+    }
+
+    /// @brief Close the file.
+    /// @return @b true on success.
+    bool close()
+    {
+        if (m_file == nullptr) {
+            return true;
+        }
+
+        auto result = (std::fclose(m_file) == 0);
+        m_file = nullptr;
+        return result;
+    }
+
+    /// @brief Check whether the file is open.
+    bool isOpen() const
+    {
+        return m_file != nullptr;
+    }
+
+    /// @brief Number of written records.
+    std::size_t recordsCount() const
+    {
+        return m_recordsCount;
+    }
+
+    /// @brief Append the record of GPS ephemeris.
+    /// @return @b true on success.
+    bool write(const GpsEphemeris& eph)
+    {
+        if (m_file == nullptr) {
+            return false;
+        }
+
+        auto toc = gpsCalendarTime(eph.m_tocWeek, eph.m_toc);
+        m_buf.append('G');
+        m_buf.appendInt(eph.m_prn, 2U, true);
+        m_buf.append(' ');
+        m_buf.appendInt(toc.m_year, 4U);
+        for (auto value : {toc.m_month, toc.m_day, toc.m_hour, toc.m_min, static_cast<int>(toc.m_sec + 0.5)}) {
+            m_buf.append(' ');
+            m_buf.appendInt(value, 2U, true);
+        }
+        appendValues(eph.m_af0, eph.m_af1, eph.m_af2);
+        m_buf.endLine();
+
+        appendOrbit(static_cast<double>(eph.m_iode), eph.m_crs, eph.m_deltaN, eph.m_m0);
+        appendOrbit(eph.m_cuc, eph.m_e, eph.m_cus, eph.m_sqrtA);
+        appendOrbit(eph.m_toe, eph.m_cic, eph.m_omega0, eph.m_cis);
+        appendOrbit(eph.m_i0, eph.m_crc, eph.m_omega, eph.m_omegaDot);
+        appendOrbit(
+            eph.m_idot,
+            static_cast<double>(eph.m_codeL2),
+            static_cast<double>(eph.m_week),
+            static_cast<double>(eph.m_flagL2P));
+        appendOrbit(
+            uraMeters(eph.m_ura),
+            static_cast<double>(eph.m_health),
+            eph.m_tgd,
+            static_cast<double>(eph.m_iodc));
+
+        m_buf.append(' ', 4U);
+        appendValues(eph.m_ttr, eph.m_fitInterval);
+        m_buf.endLine();
+
+        ++m_recordsCount;
+        return m_buf.flush(m_file);
+    }
+
+private:
+    static double uraMeters(unsigned ura)
+    {
+        static const double Values[] = {
+            2.4, 3.4, 4.85, 6.85, 9.65, 13.65, 24.0, 48.0,
+            96.0, 192.0, 384.0, 768.0, 1536.0, 3072.0, 6144.0
+        };
+
+        static const std::size_t ValuesCount = sizeof(Values) / sizeof(Values[0]);
+        if (ValuesCount <= ura) {
+            return 6144.0;
+        }
+        return Values[ura];
+    }
+
+    void appendValues(double value)
+    {
+        m_buf.appendExp(value, 19U, 12U);
+    }
+
+    template <typename... TRest>
+    void appendValues(double value, TRest... rest)
+    {
+        appendValues(value);
+        appendValues(rest...);
+    }
+
+    void appendOrbit(double value1, double value2, double value3, double value4)
+    {
+        m_buf.append(' ', 4U);
+        appendValues(value1, value2, value3, value4);
+        m_buf.endLine();
+    }
+
+    void writeHeader()
+    {
+        m_buf.appendFixed(3.03, 9U, 2U);
+        m_buf.append(' ', 11U);
+        m_buf.appendText("N: GNSS NAV DATA", 20U);
+        m_buf.appendText("G: GPS", 20U);
+        m_buf.endHeaderLine("RINEX VERSION / TYPE");
+
+        m_buf.appendText(m_info.m_program, 20U);
+        m_buf.appendText(m_info.m_runBy, 20U);
+        m_buf.appendText(m_info.m_date.empty() ? currentFileDate() : m_info.m_date, 20U);
+        m_buf.endHeaderLine("PGM / RUN BY / DATE");
+
+        m_buf.endHeaderLine("END OF HEADER");
+    }
+
+    std::FILE* m_file = nullptr;
+    NavHeaderInfo m_info;
+    TextBuffer m_buf;
+    std::size_t m_recordsCount = 0U;
+};
+
+} // namespace rinex
+
+}  // namespace ublox
+
+
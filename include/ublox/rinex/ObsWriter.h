@@ -0,0 +1,626 @@
+//
+// Copyright 2018 (C). Alex Robenko. All rights reserved.
+//
+
+// This file is free software: you can redistribute it and/or modify
+// it under the terms of the GNU General Public License as published by
+// the Free Software Foundation, either version 3 of the License, or
+// (at your option) any later version.
+//
+// This program is distributed in the hope that it will be useful,
+// but WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+// GNU General Public License for more details.
+//
+// You should have received a copy of the GNU General Public License
+// along with this program.  If not, see <http://www.gnu.org/licenses/>.
+
+/// @file
+/// @brief Contains definition of ublox::rinex::ObsWriter class.
+
+#pragma once
+
+#include <cstdint>
+#include <cstddef>
+#include <cstdio>
+#include <array>
+#include <initializer_list>
+#include <string>
+#include <vector>
+
+#include "comms/ErrorStatus.h"
+
+#include "ublox/message/RxmRawx.h"
+#include "ublox/view/RxmRawxBatch.h"
+#include "Format.h"
+
+namespace ublox
+{
+
+namespace rinex
+{
+
+/// @brief GLONASS slot and its frequency number.
+struct GlonassSlot
+{
+    unsigned m_slot; ///< Slot number (1 - 24)
+    int m_frequency; ///< Frequency number (-7 - +6)
+};
+
+/// @brief Information reported in the header of the RINEX observation file.
+struct ObsHeaderInfo
+{
+    std::string m_program = "ublox"; ///< Name of the program creating the file
+    std::string m_runBy; ///< Name of the agency creating the file
+    std::string m_date; ///< Date of the file creation, current UTC time when empty
+    std::string m_markerName = "UNKNOWN"; ///< Name of the antenna marker
+    std::string m_markerType = "NON_GEODETIC"; ///< Type of the marker
+    std::string m_observer; ///< Name of the observer
+    std::string m_agency; ///< Name of the agency
+    std::string m_receiverNumber; ///< Receiver serial number
+    std::string m_receiverType = "U-BLOX"; ///< Receiver type
+    std::string m_receiverVersion; ///< Receiver firmware version
+    std::string m_antennaNumber; ///< Antenna serial number
+    std::string m_antennaType; ///< Antenna type
+    double m_approxPos[3] = {0.0, 0.0, 0.0}; ///< Approximate marker position (ECEF X, Y, Z) [m]
+    double m_antennaDelta[3] = {0.0, 0.0, 0.0}; ///< Antenna height and horizontal eccentricity (H, E, N) [m]
+    double m_interval = 0.0; ///< Observation interval [s], not reported when @b 0
+
+    /// @brief GLONASS slots and frequency numbers reported in the header.
+    /// @details The slots observed in the first epoch are reported when empty.
+    std::vector<GlonassSlot> m_glonassSlots;
+};
+
+/// @brief Streaming writer of RINEX 3.03 observation file out of RXM-RAWX
+///     measurements.
+/// @details Every RXM-RAWX message is written as a single epoch, the header
+///     is written before the first epoch. The satellites are mapped to RINEX
+///     satellite numbers by @b gnssId and @b svId (IMES and unknown GLONASS
+///     slots are skipped). The RXM-RAWX message defined in this library
+///     doesn't report the signal ID, hence single (L1 / E1 / B1I) signal per
+///     satellite is assumed and reported as @b C1C, @b L1C, @b D1C and @b S1C
+///     observations (@b C2I, @b L2I, @b D2I, @b S2I for BeiDou).@n
+///     The pseudorange is written only when marked valid by @b trkStat, the
+///     same for the carrier phase. The loss of lock indicator of the carrier
+///     phase has bit 0 set when the @b locktime value shows that the lock
+///     has been lost since the previous observation of the satellite, and
+///     bit 1 set when the half cycle ambiguity hasn't been resolved.
+///     The header is written before the first epoch, hence the GLONASS
+///     frequency numbers are expected to be provided up front (see
+///     @ref ObsHeaderInfo::m_glonassSlots, for example out of the
+///     almanac or the previous session). Otherwise only the slots observed
+///     in the first epoch are reported.@n
+///     The numbers are formatted without iostreams (see @ref TextBuffer),
+///     the fastest way to feed the writer is to pass the payloads of the
+///     RXM-RAWX frames directly to writePayload().
+class ObsWriter
+{
+public:
+    /// @brief Maximal number of measurements in the single epoch.
+    static const std::size_t MaxMeasurements = 255U;
+
+    /// @brief Constructor
+    ObsWriter()
+    {
+        m_columns.m_prMes = &m_prMes[0];
+        m_columns.m_cpMes = &m_cpMes[0];
+        m_columns.m_doMes = &m_doMes[0];
+        m_columns.m_gnssId = &m_gnssId[0];
+        m_columns.m_svId = &m_svId[0];
+        m_columns.m_freqId = &m_freqId[0];
+        m_columns.m_locktime = &m_locktime[0];
+        m_columns.m_cno = &m_cno[0];
+        m_columns.m_prStdev = &m_prStdev[0];
+        m_columns.m_cpStdev = &m_cpStdev[0];
+        m_columns.m_doStdev = &m_doStdev[0];
+        m_columns.m_trkStat = &m_trkStat[0];
+        m_columns.m_capacity = MaxMeasurements;
+    }
+
+    /// @brief Copy constructor is deleted
+    ObsWriter(const ObsWriter&) = delete;
+
+    /// @brief Destructor
+    ~ObsWriter()
+    {
+        close();
+    }
+
+    /// @brief Copy assignment is deleted
+    ObsWriter& operator=(const ObsWriter&) = delete;
+
+    /// @brief Set the information reported in the header.
+    /// @details Must be invoked before the first epoch is written.
+    void setHeaderInfo(const ObsHeaderInfo& info)
+    {
+        m_info = info;
+    }
+
+    /// @brief Create the file, truncates the existing one.
+    /// @return @b true on success.
+    bool open(const char* path)
+    {
+        close();
+        m_file = std::fopen(path, "w");
+        m_headerWritten = false;
+        m_epochsCount = 0U;
+        m_lockKnown.fill(false);
+        return m_file != nullptr;
+    }
+
+    /// @brief Close the file.
+    /// @return @b true on success.
+    bool close()
+    {
+        if (m_file == nullptr) {
+            return true;
+        }
+
+        auto result = (std::fclose(m_file) == 0);
+        m_file = nullptr;
+        return result;
+    }
+
+    /// @brief Check whether the file is open.
+    bool isOpen() const
+    {
+        return m_file != nullptr;
+    }
+
+    /// @brief Number of written epochs.
+    std::size_t epochsCount() const
+    {
+        return m_epochsCount;
+    }
+
+    /// @brief Write the epoch out of the payload of RXM-RAWX message.
+    /// @details The payload is decoded using ublox::view::decodeRxmRawx().
+    /// @return @b true on success.
+    bool writePayload(const std::uint8_t* payload, std::size_t len)
+    {
+        view::RxmRawxEpoch epoch;
+        std::size_t count = 0U;
+        auto es = view::decodeRxmRawx(payload, len, epoch, m_columns, count);
+        if (es != comms::ErrorStatus::Success) {
+            return false;
+        }
+
+        return writeEpoch(epoch, m_columns, count);
+    }
+
+    /// @brief Write the epoch out of RXM-RAWX message.
+    /// @return @b true on success.
+    template <typename TMsgBase>
+    bool handle(const message::RxmRawx<TMsgBase>& msg)
+    {
+        view::RxmRawxEpoch epoch;
+        epoch.m_rcvTow = msg.field_rcvTow().value();
+        epoch.m_week = msg.field_week().value();
+        epoch.m_leapS = msg.field_leapS().value();
+        epoch.m_numMeas = msg.field_numMeas().value();
+        epoch.m_recStat = static_cast<std::uint8_t>(msg.field_recStat().value());
+        epoch.m_version = msg.field_version().value();
+
+        std::size_t count = 0U;
+        for (auto& block : msg.field_data().value()) {
+            if (MaxMeasurements <= count) {
+                break;
+            }
+
+            m_prMes[count] = block.field_prMes().value();
+            m_cpMes[count] = block.field_cpMes().value();
+            m_doMes[count] = static_cast<double>(block.field_doMes().value());
+            m_gnssId[count] = static_cast<std::uint8_t>(block.field_gnssId().value());
+            m_svId[count] = block.field_svId().value();
+            m_freqId[count] = block.field_freqId().value();
+            m_locktime[count] = block.field_locktime().value();
+            m_cno[count] = block.field_cno().value();
+            m_prStdev[count] = block.field_prStdev().value();
+            m_cpStdev[count] = block.field_cpStdev().value();
+            m_doStdev[count] = block.field_doStdev().value();
+            m_trkStat[count] = static_cast<std::uint8_t>(block.field_trkStat().value());
+            ++count;
+        }
+
+        return writeEpoch(epoch, m_columns, count);
+    }
+
+    /// @brief Write the epoch out of the decoded measurements.
+    /// @param[in] epoch Epoch information.
+    /// @param[in] columns Decoded measurements.
+    /// @param[in] count Number of measurements.
+    /// @return @b true on success.
+    bool writeEpoch(const view::RxmRawxEpoch& epoch, const view::RxmRawxColumns& columns, std::size_t count)
+    {
+        if (m_file == nullptr) {
+            return false;
+        }
+
+        if (MaxMeasurements < count) {
+            count = MaxMeasurements;
+        }
+
+        // Sort the satellites by system and number
+        std::array<std::uint16_t, MaxMeasurements> keys;
+        std::array<std::uint8_t, MaxMeasurements> order;
+        std::size_t satsCount = 0U;
+        for (std::size_t idx = 0U; idx < count; ++idx) {
+            auto sysIdx = systemIdx(columns.m_gnssId[idx]);
+            auto prn = satNumber(columns.m_gnssId[idx], columns.m_svId[idx]);
+            if ((SystemsCount <= sysIdx) || (prn == 0U)) {
+                continue;
+            }
+
+            auto key = static_cast<std::uint16_t>((sysIdx << 8) | prn);
+            auto pos = satsCount;
+            while ((0U < pos) && (key < keys[pos - 1U])) {
+                keys[pos] = keys[pos - 1U];
+                order[pos] = order[pos - 1U];
+                --pos;
+            }
+
+            if ((0U < pos) && (keys[pos - 1U] == key)) {
+                // Duplicate satellite, keep the first signal only
+                for (; pos < satsCount; ++pos) {
+                    keys[pos] = keys[pos + 1U];
+                    order[pos] = order[pos + 1U];
+                }
+                continue;
+            }
+
+            keys[pos] = key;
+            order[pos] = static_cast<std::uint8_t>(idx);
+            ++satsCount;
+        }
+
+        auto time = gpsCalendarTime(epoch.m_week, epoch.m_rcvTow);
+        if (!m_headerWritten) {
+            writeHeader(time, columns, count);
+            m_headerWritten = true;
+        }
+
+        m_buf.append('>');
+        m_buf.append(' ');
+        appendTime(time, false);
+        m_buf.append(' ', 2U);
+        m_buf.appendInt(0, 1U);
+        m_buf.appendInt(static_cast<std::int64_t>(satsCount), 3U);
+        m_buf.endLine();
+
+        auto epochMs = (static_cast<double>(epoch.m_week) * SecondsInWeek + epoch.m_rcvTow) * 1000.0;
+        for (std::size_t pos = 0U; pos < satsCount; ++pos) {
+            auto idx = order[pos];
+            auto sysIdx = static_cast<std::size_t>(keys[pos] >> 8);
+            m_buf.append(systemChar(sysIdx));
+            m_buf.appendInt(keys[pos] & 0xff, 2U, true);
+
+            auto trkStat = columns.m_trkStat[idx];
+            auto ssi = signalStrength(columns.m_cno[idx]);
+
+            // Pseudorange
+            if ((trkStat & TrkStat_prValid) != 0U) {
+                m_buf.appendFixed(columns.m_prMes[idx], 14U, 3U);
+                m_buf.append(' ');
+                m_buf.append(ssi);
+            }
+            else {
+                m_buf.append(' ', 16U);
+            }
+
+            // Carrier phase
+            auto lli = lossOfLock(columns.m_gnssId[idx], columns.m_svId[idx], columns.m_locktime[idx], epochMs);
+            if ((trkStat & TrkStat_cpValid) != 0U) {
+                if ((trkStat & TrkStat_halfCyc) == 0U) {
+                    lli |= 0x2;
+                }
+
+                m_buf.appendFixed(columns.m_cpMes[idx], 14U, 3U);
+                m_buf.append((lli == 0U) ? ' ' : static_cast<char>('0' + lli));
+                m_buf.append(ssi);
+            }
+            else {
+                m_buf.append(' ', 16U);
+            }
+
+            // Doppler
+            m_buf.appendFixed(columns.m_doMes[idx], 14U, 3U);
+            m_buf.append(' ', 2U);
+
+            // Signal strength
+            m_buf.appendFixed(static_cast<double>(columns.m_cno[idx]), 14U, 3U);
+            m_buf.endLine();
+        }
+
+        ++m_epochsCount;
+        return m_buf.flush(m_file);
+    }
+
+private:
+    enum TrkStat : std::uint8_t
+    {
+        TrkStat_prValid = 0x1,
+        TrkStat_cpValid = 0x2,
+        TrkStat_halfCyc = 0x4
+    };
+
+    static const std::size_t SystemsCount = 6U;
+    static const std::size_t GnssIdsCount = 7U;
+    static constexpr double SecondsInWeek = 604800.0;
+    static const std::uint16_t MaxLocktime = 64500U;
+
+    static char systemChar(std::size_t sysIdx)
+    {
+        return "GRECJS"[sysIdx];
+    }
+
+    static std::size_t systemIdx(std::uint8_t gnssId)
+    {
+        static const std::uint8_t Map[GnssIdsCount] = {
+            0U, // GPS
+            5U, // SBAS
+            2U, // Galileo
+            3U, // BeiDou
+            SystemsCount, // IMES
+            4U, // QZSS
+            1U // GLONASS
+        };
+
+        if (GnssIdsCount <= gnssId) {
+            return SystemsCount;
+        }
+        return Map[gnssId];
+    }
+
+    static unsigned satNumber(std::uint8_t gnssId, std::uint8_t svId)
+    {
+        static const std::uint8_t GnssId_Sbas = 1U;
+        static const std::uint8_t GnssId_Glonass = 6U;
+        unsigned prn = svId;
+        if (gnssId == GnssId_Sbas) {
+            prn = (100U < prn) ? (prn - 100U) : 0U;
+        }
+        else if ((gnssId == GnssId_Glonass) && (32U < prn)) {
+            prn = 0U; // Unknown slot
+        }
+
+        return (prn < 100U) ? prn : 0U;
+    }
+
+    static char signalStrength(std::uint8_t cno)
+    {
+        auto ssi = cno / 6U;
+        if (ssi < 1U) {
+            ssi = 1U;
+        }
+
+        if (9U < ssi) {
+            ssi = 9U;
+        }
+        return static_cast<char>('0' + ssi);
+    }
+
+    unsigned lossOfLock(std::uint8_t gnssId, std::uint8_t svId, std::uint16_t locktime, double epochMs)
+    {
+        auto key = (static_cast<std::size_t>(gnssId % GnssIdsCount) << 8) | svId;
+        bool slip = false;
+        if (m_lockKnown[key]) {
+            auto elapsedMs = epochMs - m_lockEpochMs[key];
+            slip =
+                (locktime < m_locktimes[key]) ||
+                ((locktime < MaxLocktime) && (static_cast<double>(locktime) < elapsedMs));
+        }
+
+        m_lockKnown[key] = true;
+        m_locktimes[key] = locktime;
+        m_lockEpochMs[key] = epochMs;
+        return slip ? 0x1 : 0x0;
+    }
+
+    void appendTime(const CalendarTime& time, bool header)
+    {
+        if (header) {
+            m_buf.appendInt(time.m_year, 6U);
+            m_buf.appendInt(time.m_month, 6U);
+            m_buf.appendInt(time.m_day, 6U);
+            m_buf.appendInt(time.m_hour, 6U);
+            m_buf.appendInt(time.m_min, 6U);
+            m_buf.appendFixed(time.m_sec, 13U, 7U);
+            return;
+        }
+
+        m_buf.appendInt(time.m_year, 4U);
+        m_buf.append(' ');
+        m_buf.appendInt(time.m_month, 2U, true);
+        m_buf.append(' ');
+        m_buf.appendInt(time.m_day, 2U, true);
+        m_buf.append(' ');
+        m_buf.appendInt(time.m_hour, 2U, true);
+        m_buf.append(' ');
+        m_buf.appendInt(time.m_min, 2U, true);
+        m_buf.appendFixed(time.m_sec, 11U, 7U);
+    }
+
+    void writeHeader(const CalendarTime& firstObs, const view::RxmRawxColumns& columns, std::size_t count)
+    {
+        m_buf.appendFixed(3.03, 9U, 2U);
+        m_buf.append(' ', 11U);
+        m_buf.appendText("OBSERVATION DATA", 20U);
+        m_buf.appendText("M (MIXED)", 20U);
+        m_buf.endHeaderLine("RINEX VERSION / TYPE");
+
+        m_buf.appendText(m_info.m_program, 20U);
+        m_buf.appendText(m_info.m_runBy, 20U);
+        m_buf.appendText(m_info.m_date.empty() ? currentFileDate() : m_info.m_date, 20U);
+        m_buf.endHeaderLine("PGM / RUN BY / DATE");
+
+        m_buf.appendText(m_info.m_markerName, 60U);
+        m_buf.endHeaderLine("MARKER NAME");
+
+        m_buf.appendText(m_info.m_markerType, 20U);
+        m_buf.endHeaderLine("MARKER TYPE");
+
+        m_buf.appendText(m_info.m_observer, 20U);
+        m_buf.appendText(m_info.m_agency, 40U);
+        m_buf.endHeaderLine("OBSERVER / AGENCY");
+
+        m_buf.appendText(m_info.m_receiverNumber, 20U);
+        m_buf.appendText(m_info.m_receiverType, 20U);
+        m_buf.appendText(m_info.m_receiverVersion, 20U);
+        m_buf.endHeaderLine("REC # / TYPE / VERS");
+
+        m_buf.appendText(m_info.m_antennaNumber, 20U);
+        m_buf.appendText(m_info.m_antennaType, 20U);
+        m_buf.endHeaderLine("ANT # / TYPE");
+
+        for (auto value : m_info.m_approxPos) {
+            m_buf.appendFixed(value, 14U, 4U);
+        }
+        m_buf.endHeaderLine("APPROX POSITION XYZ");
+
+        for (auto value : m_info.m_antennaDelta) {
+            m_buf.appendFixed(value, 14U, 4U);
+        }
+        m_buf.endHeaderLine("ANTENNA: DELTA H/E/N");
+
+        for (std::size_t sysIdx = 0U; sysIdx < SystemsCount; ++sysIdx) {
+            m_buf.append(systemChar(sysIdx));
+            m_buf.append(' ', 2U);
+            m_buf.appendInt(4, 3U);
+            auto band = bandChars(sysIdx);
+            for (auto obsType : {'C', 'L', 'D', 'S'}) {
+                m_buf.append(' ');
+                m_buf.append(obsType);
+                m_buf.append(band[0]);
+                m_buf.append(band[1]);
+            }
+            m_buf.endHeaderLine("SYS / # / OBS TYPES");
+        }
+
+        m_buf.appendText("DBHZ", 20U);
+        m_buf.endHeaderLine("SIGNAL STRENGTH UNIT");
+
+        if (0.0 < m_info.m_interval) {
+            m_buf.appendFixed(m_info.m_interval, 10U, 3U);
+            m_buf.endHeaderLine("INTERVAL");
+        }
+
+        appendTime(firstObs, true);
+        m_buf.append(' ', 5U);
+        m_buf.appendText("GPS", 3U);
+        m_buf.endHeaderLine("TIME OF FIRST OBS");
+
+        writeGlonassSlots(columns, count);
+
+        // Code-phase alignment is unknown, report zero corrections
+        for (auto code : {"C1C", "C1P", "C2C", "C2P"}) {
+            m_buf.append(' ');
+            m_buf.appendText(code, 3U);
+            m_buf.append(' ');
+            m_buf.appendFixed(0.0, 8U, 3U);
+        }
+        m_buf.endHeaderLine("GLONASS COD/PHS/BIS");
+
+        for (std::size_t sysIdx = 0U; sysIdx < SystemsCount; ++sysIdx) {
+            auto band = bandChars(sysIdx);
+            m_buf.append(systemChar(sysIdx));
+            m_buf.append(' ');
+            m_buf.append('L');
+            m_buf.append(band[0]);
+            m_buf.append(band[1]);
+            m_buf.append(' ');
+            m_buf.appendFixed(0.0, 8U, 5U);
+            m_buf.endHeaderLine("SYS / PHASE SHIFT");
+        }
+
+        m_buf.endHeaderLine("END OF HEADER");
+    }
+
+    void writeGlonassSlots(const view::RxmRawxColumns& columns, std::size_t count)
+    {
+        static const std::uint8_t GnssId_Glonass = 6U;
+        static const int FreqIdOffset = 7;
+        static const int NoFrequency = FreqIdOffset + 1;
+        static const std::size_t SlotsPerLine = 8U;
+
+        std::array<int, 33> freqs;
+        freqs.fill(NoFrequency);
+        for (auto& info : m_info.m_glonassSlots) {
+            if ((0U < info.m_slot) && (info.m_slot < freqs.size())) {
+                freqs[info.m_slot] = info.m_frequency;
+            }
+        }
+
+        for (std::size_t idx = 0U; m_info.m_glonassSlots.empty() && (idx < count); ++idx) {
+            auto slot = columns.m_svId[idx];
+            if ((columns.m_gnssId[idx] != GnssId_Glonass) || (slot == 0U) || (32U < slot)) {
+                continue;
+            }
+
+            freqs[slot] = static_cast<int>(columns.m_freqId[idx]) - FreqIdOffset;
+        }
+
+        std::size_t slotsCount = 0U;
+        for (auto freq : freqs) {
+            if (freq != NoFrequency) {
+                ++slotsCount;
+            }
+        }
+
+        m_buf.appendInt(static_cast<std::int64_t>(slotsCount), 3U);
+        m_buf.append(' ');
+        std::size_t written = 0U;
+        for (std::size_t slot = 1U; slot < freqs.size(); ++slot) {
+            if (freqs[slot] == NoFrequency) {
+                continue;
+            }
+
+            if ((0U < written) && ((written % SlotsPerLine) == 0U)) {
+                m_buf.endHeaderLine("GLONASS SLOT / FRQ #");
+                m_buf.append(' ', 4U);
+            }
+
+            m_buf.append('R');
+            m_buf.appendInt(static_cast<std::int64_t>(slot), 2U, true);
+            m_buf.append(' ');
+            m_buf.appendInt(freqs[slot], 2U);
+            m_buf.append(' ');
+            ++written;
+        }
+        m_buf.endHeaderLine("GLONASS SLOT / FRQ #");
+    }
+
+    static const char* bandChars(std::size_t sysIdx)
+    {
+        return (sysIdx == 3U) ? "2I" : "1C";
+    }
+
+    std::FILE* m_file = nullptr;
+    ObsHeaderInfo m_info;
+    TextBuffer m_buf;
+    bool m_headerWritten = false;
+    std::size_t m_epochsCount = 0U;
+
+    std::array<double, MaxMeasurements> m_prMes;
+    std::array<double, MaxMeasurements> m_cpMes;
+    std::array<double, MaxMeasurements> m_doMes;
+    std::array<std::uint8_t, MaxMeasurements> m_gnssId;
+    std::array<std::uint8_t, MaxMeasurements> m_svId;
+    std::array<std::uint8_t, MaxMeasurements> m_freqId;
+    std::array<std::uint16_t, MaxMeasurements> m_locktime;
+    std::array<std::uint8_t, MaxMeasurements> m_cno;
+    std::array<std::uint8_t, MaxMeasurements> m_prStdev;
+    std::array<std::uint8_t, MaxMeasurements> m_cpStdev;
+    std::array<std::uint8_t, MaxMeasurements> m_doStdev;
+    std::array<std::uint8_t, MaxMeasurements> m_trkStat;
+    view::RxmRawxColumns m_columns;
+
+    std::array<bool, GnssIdsCount * 256U> m_lockKnown;
+    std::array<std::uint16_t, GnssIdsCount * 256U> m_locktimes;
+    std::array<double, GnssIdsCount * 256U> m_lockEpochMs;
+};
+
+} // namespace rinex
+
+}  // namespace ublox
+
+
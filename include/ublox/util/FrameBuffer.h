@@ -0,0 +1,97 @@
+//
+// Copyright 2018 (C). Alex Robenko. All rights reserved.
+//
+
+// This file is free software: you can redistribute it and/or modify
+// it under the terms of the GNU General Public License as published by
+// the Free Software Foundation, either version 3 of the License, or
+// (at your option) any later version.
+//
+// This program is distributed in the hope that it will be useful,
+// but WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+// GNU General Public License for more details.
+//
+// You should have received a copy of the GNU General Public License
+// along with this program.  If not, see <http://www.gnu.org/licenses/>.
+
+/// @file
+/// @brief Contains definition of ublox::util::FrameBuffer class.
+
+#pragma once
+
+#include <cstdint>
+#include <cstddef>
+#include <cstring>
+#include <array>
+
+#include "ublox/FrameSpan.h"
+
+namespace ublox
+{
+
+namespace util
+{
+
+/// @brief Fixed size storage of the single frame.
+/// @details Used as element of @ref SpscQueue to pass the frames between
+///     threads without dynamic memory allocation.
+/// @tparam TMaxLen Maximal length of the frame.
+template <std::size_t TMaxLen>
+class FrameBuffer
+{
+public:
+    /// @brief Maximal length of the frame.
+    static const std::size_t MaxLen = TMaxLen;
+
+    /// @brief Copy the frame.
+    /// @return @b false in case the frame is too long.
+    bool assign(const FrameSpan& frame)
+    {
+        if (TMaxLen < frame.size()) {
+            m_size = 0U;
+            return false;
+        }
+
+        std::memcpy(&m_data[0], frame.data(), frame.size());
+        m_size = frame.size();
+        return true;
+    }
+
+    /// @brief Remove the stored frame.
+    void clear()
+    {
+        m_size = 0U;
+    }
+
+    /// @brief Get the stored frame.
+    FrameSpan span() const
+    {
+        FrameSpan result;
+        result.m_data = &m_data[0];
+        result.m_size = m_size;
+        return result;
+    }
+
+    /// @brief Pointer to the first byte of the frame.
+    const std::uint8_t* data() const
+    {
+        return &m_data[0];
+    }
+
+    /// @brief Length of the stored frame.
+    std::size_t size() const
+    {
+        return m_size;
+    }
+
+private:
+    std::array<std::uint8_t, TMaxLen> m_data = {{}};
+    std::size_t m_size = 0U;
+};
+
+} // namespace util
+
+}  // namespace ublox
+
+
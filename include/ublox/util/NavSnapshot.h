@@ -0,0 +1,266 @@
+//
+// Copyright 2018 (C). Alex Robenko. All rights reserved.
+//
+
+// This file is free software: you can redistribute it and/or modify
+// it under the terms of the GNU General Public License as published by
+// the Free Software Foundation, either version 3 of the License, or
+// (at your option) any later version.
+//
+// This program is distributed in the hope that it will be useful,
+// but WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+// GNU General Public License for more details.
+//
+// You should have received a copy of the GNU General Public License
+// along with this program.  If not, see <http://www.gnu.org/licenses/>.
+
+/// @file
+/// @brief Contains definition of ublox::util::NavSnapshotStore class.
+
+#pragma once
+
+#include <cstdint>
+#include <cstddef>
+
+#include "comms/comms.h"
+
+#include "ublox/message/NavPvt.h"
+#include "ublox/message/NavHpposllh.h"
+#include "ublox/message/NavVelned.h"
+#include "ublox/message/NavTimeutc.h"
+#include "SeqLock.h"
+
+namespace ublox
+{
+
+namespace util
+{
+
+/// @brief Compact snapshot of the latest navigation solution.
+/// @details All the values are converted to SI units, except latitude,
+///     longitude and heading, which are reported in degrees.
+struct NavSnapshot
+{
+    /// @brief Bits of @ref m_valid member.
+    enum ValidBit
+    {
+        ValidBit_position = 0x1, ///< Position is valid (gnssFixOK)
+        ValidBit_velocity = 0x2, ///< Velocity is valid
+        ValidBit_time = 0x4, ///< UTC time is valid and fully resolved
+        ValidBit_highPrecision = 0x8, ///< Position comes from @b NAV-HPPOSLLH
+    };
+
+    double m_lat = 0.0; ///< Latitude [deg]
+    double m_lon = 0.0; ///< Longitude [deg]
+    double m_height = 0.0; ///< Height above ellipsoid [m]
+    double m_hMSL = 0.0; ///< Height above mean sea level [m]
+    double m_utcTime = 0.0; ///< UTC time since Unix epoch [s]
+    float m_hAcc = 0.0f; ///< Horizontal accuracy estimate [m]
+    float m_vAcc = 0.0f; ///< Vertical accuracy estimate [m]
+    float m_velN = 0.0f; ///< North velocity [m/s]
+    float m_velE = 0.0f; ///< East velocity [m/s]
+    float m_velD = 0.0f; ///< Down velocity [m/s]
+    float m_gSpeed = 0.0f; ///< Ground speed [m/s]
+    float m_heading = 0.0f; ///< Heading of motion [deg]
+    float m_sAcc = 0.0f; ///< Speed accuracy estimate [m/s]
+    float m_tAcc = 0.0f; ///< Time accuracy estimate [s]
+    std::uint32_t m_iTOW = 0U; ///< GPS time of week of the latest update [ms]
+    std::uint8_t m_fixType = 0U; ///< Fix type, see @ref ublox::field::nav::GpsFix
+    std::uint8_t m_numSV = 0U; ///< Number of satellites used in solution
+    std::uint8_t m_valid = 0U; ///< Validity bits, see @ref ValidBit
+};
+
+/// @brief Per receiver latest-value cache of the navigation solution.
+/// @details The messages are passed to the handle() overloads by the
+///     thread dispatching the messages of the receiver (the single writer),
+///     the consumers retrieve the latest @ref NavSnapshot from any thread
+///     using snapshot() without subscribing to the message stream.
+///     The store is based on @ref SeqLock, hence updating never waits
+///     and reading never blocks the update.@n
+///     When both @b NAV-PVT and @b NAV-HPPOSLLH are received, the position
+///     reported by the latter takes precedence for the same epoch.
+class NavSnapshotStore
+{
+public:
+    /// @brief Default constructor
+    NavSnapshotStore() = default;
+
+    /// @brief Update from @b NAV-PVT message.
+    template <typename TMsgBase>
+    void handle(const message::NavPvt<TMsgBase>& msg)
+    {
+        m_current.m_iTOW = msg.field_iTOW().value();
+        if ((!isHighPrecision()) || (m_hpITOW != m_current.m_iTOW)) {
+            m_current.m_lat = comms::units::getDegrees<double>(msg.field_lat());
+            m_current.m_lon = comms::units::getDegrees<double>(msg.field_lon());
+            m_current.m_height = comms::units::getMeters<double>(msg.field_height());
+            m_current.m_hMSL = comms::units::getMeters<double>(msg.field_hMSL());
+            m_current.m_hAcc = comms::units::getMeters<float>(msg.field_hAcc());
+            m_current.m_vAcc = comms::units::getMeters<float>(msg.field_vAcc());
+            m_current.m_valid &= static_cast<std::uint8_t>(~NavSnapshot::ValidBit_highPrecision);
+        }
+
+        m_current.m_velN = comms::units::getMetersPerSecond<float>(msg.field_velN());
+        m_current.m_velE = comms::units::getMetersPerSecond<float>(msg.field_velE());
+        m_current.m_velD = comms::units::getMetersPerSecond<float>(msg.field_velD());
+        m_current.m_gSpeed = comms::units::getMetersPerSecond<float>(msg.field_gSpeed());
+        m_current.m_heading = comms::units::getDegrees<float>(msg.field_headMot());
+        m_current.m_sAcc = comms::units::getMetersPerSecond<float>(msg.field_sAcc());
+        m_current.m_fixType = static_cast<std::uint8_t>(msg.field_fixType().value());
+        m_current.m_numSV = static_cast<std::uint8_t>(msg.field_numSV().value());
+
+        auto& valid = msg.field_valid();
+        updateTime(
+            msg.field_year().value(), msg.field_month().value(), msg.field_day().value(),
+            msg.field_hour().value(), msg.field_min().value(), msg.field_sec().value(),
+            msg.field_nano().value(),
+            comms::units::getSeconds<float>(msg.field_tAcc()),
+            valid.getBitValue_validDate() && valid.getBitValue_validTime() && valid.getBitValue_fullyResolved());
+
+        bool fixOk = msg.field_flags().field_flagsLow().getBitValue_gnssFixOK();
+        setValid(NavSnapshot::ValidBit_position, fixOk);
+        setValid(NavSnapshot::ValidBit_velocity, fixOk);
+        publish();
+    }
+
+    /// @brief Update from @b NAV-HPPOSLLH message.
+    template <typename TMsgBase>
+    void handle(const message::NavHpposllh<TMsgBase>& msg)
+    {
+        m_hpITOW = msg.field_iTOW().value();
+        m_current.m_iTOW = m_hpITOW;
+        m_current.m_lat =
+            comms::units::getDegrees<double>(msg.field_lat()) +
+            comms::units::getDegrees<double>(msg.field_latHp());
+        m_current.m_lon =
+            comms::units::getDegrees<double>(msg.field_lon()) +
+            comms::units::getDegrees<double>(msg.field_lonHp());
+        m_current.m_height =
+            comms::units::getMeters<double>(msg.field_height()) +
+            comms::units::getMeters<double>(msg.field_heightHp());
+        m_current.m_hMSL =
+            comms::units::getMeters<double>(msg.field_hMSL()) +
+            comms::units::getMeters<double>(msg.field_hMSLHp());
+        m_current.m_hAcc = comms::units::getMeters<float>(msg.field_hAcc());
+        m_current.m_vAcc = comms::units::getMeters<float>(msg.field_vAcc());
+        m_current.m_valid |= NavSnapshot::ValidBit_highPrecision;
+        publish();
+    }
+
+    /// @brief Update from @b NAV-VELNED message.
+    template <typename TMsgBase>
+    void handle(const message::NavVelned<TMsgBase>& msg)
+    {
+        m_current.m_iTOW = msg.field_iTOW().value();
+        m_current.m_velN = comms::units::getMetersPerSecond<float>(msg.field_velN());
+        m_current.m_velE = comms::units::getMetersPerSecond<float>(msg.field_velE());
+        m_current.m_velD = comms::units::getMetersPerSecond<float>(msg.field_velD());
+        m_current.m_gSpeed = comms::units::getMetersPerSecond<float>(msg.field_gSpeed());
+        m_current.m_heading = comms::units::getDegrees<float>(msg.field_heading());
+        m_current.m_sAcc = comms::units::getMetersPerSecond<float>(msg.field_sAcc());
+        m_current.m_valid |= NavSnapshot::ValidBit_velocity;
+        publish();
+    }
+
+    /// @brief Update from @b NAV-TIMEUTC message.
+    template <typename TMsgBase>
+    void handle(const message::NavTimeutc<TMsgBase>& msg)
+    {
+        m_current.m_iTOW = msg.field_iTOW().value();
+        auto& validBits = msg.field_valid().field_validBits();
+        updateTime(
+            msg.field_year().value(), msg.field_month().value(), msg.field_day().value(),
+            msg.field_hour().value(), msg.field_min().value(), msg.field_sec().value(),
+            msg.field_nano().value(),
+            comms::units::getSeconds<float>(msg.field_tAcc()),
+            validBits.getBitValue_validUTC());
+        publish();
+    }
+
+    /// @brief Retrieve the latest snapshot.
+    /// @details May be invoked from any thread.
+    NavSnapshot snapshot() const
+    {
+        return m_lock.read();
+    }
+
+    /// @brief Try to retrieve the latest snapshot with single attempt.
+    /// @details May be invoked from any thread, never waits, fails
+    ///     when the snapshot is being updated at the same time.
+    bool trySnapshot(NavSnapshot& value) const
+    {
+        return m_lock.tryRead(value);
+    }
+
+    /// @brief Number of published updates.
+    /// @details Allows detection of the new snapshot without copying it.
+    std::size_t version() const
+    {
+        return m_lock.version();
+    }
+
+private:
+    static std::int64_t daysFromCivil(std::int64_t year, unsigned month, unsigned day)
+    {
+        year -= (month <= 2U) ? 1 : 0;
+        auto era = ((0 <= year) ? year : year - 399) / 400;
+        auto yoe = static_cast<unsigned>(year - era * 400);
+        auto doy = (153U * ((2U < month) ? (month - 3U) : (month + 9U)) + 2U) / 5U + day - 1U;
+        auto doe = yoe * 365U + yoe / 4U - yoe / 100U + doy;
+        return (era * 146097) + static_cast<std::int64_t>(doe) - 719468;
+    }
+
+    void updateTime(
+        unsigned year,
+        unsigned month,
+        unsigned day,
+        unsigned hour,
+        unsigned min,
+        unsigned sec,
+        std::int32_t nano,
+        float tAcc,
+        bool valid)
+    {
+        setValid(NavSnapshot::ValidBit_time, valid);
+        if ((!valid) || (month < 1U) || (12U < month) || (day < 1U)) {
+            return;
+        }
+
+        auto secs =
+            daysFromCivil(year, month, day) * 86400 +
+            static_cast<std::int64_t>(hour * 3600U + min * 60U + sec);
+        m_current.m_utcTime = static_cast<double>(secs) + static_cast<double>(nano) * 1e-9;
+        m_current.m_tAcc = tAcc;
+    }
+
+    void setValid(NavSnapshot::ValidBit bit, bool value)
+    {
+        if (value) {
+            m_current.m_valid |= bit;
+        }
+        else {
+            m_current.m_valid &= static_cast<std::uint8_t>(~bit);
+        }
+    }
+
+    bool isHighPrecision() const
+    {
+        return (m_current.m_valid & NavSnapshot::ValidBit_highPrecision) != 0U;
+    }
+
+    void publish()
+    {
+        m_lock.write(m_current);
+    }
+
+    NavSnapshot m_current;
+    std::uint32_t m_hpITOW = 0U;
+    SeqLock<NavSnapshot> m_lock;
+};
+
+} // namespace util
+
+}  // namespace ublox
+
+
@@ -0,0 +1,146 @@
+//
+// Copyright 2018 (C). Alex Robenko. All rights reserved.
+//
+
+// This file is free software: you can redistribute it and/or modify
+// it under the terms of the GNU General Public License as published by
+// the Free Software Foundation, either version 3 of the License, or
+// (at your option) any later version.
+//
+// This program is distributed in the hope that it will be useful,
+// but WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+// GNU General Public License for more details.
+//
+// You should have received a copy of the GNU General Public License
+// along with this program.  If not, see <http://www.gnu.org/licenses/>.
+
+/// @file
+/// @brief Contains definition of ublox::util::SeqLock class.
+
+#pragma once
+
+#include <cstdint>
+#include <cstddef>
+#include <cstring>
+#include <array>
+#include <atomic>
+#include <type_traits>
+
+namespace ublox
+{
+
+namespace util
+{
+
+/// @brief Single writer latest-value store based on sequence lock.
+/// @details The writer never waits, the readers never block the writer,
+///     they detect the concurrent update by the change of the sequence
+///     number and retry. The value is kept as an array of atomic words
+///     accessed with relaxed ordering, so the concurrent access is
+///     well defined, the ordering is provided by the fences around the
+///     sequence number updates.@n
+///     Only one thread may call write(), any number of threads may call
+///     read() and tryRead().
+/// @tparam T Type of the stored value, must be trivially copyable.
+template <typename T>
+class SeqLock
+{
+    static_assert(std::is_trivially_copyable<T>::value, "The value must be trivially copyable");
+
+    using Word = std::uint32_t;
+    static const std::size_t WordsCount = (sizeof(T) + sizeof(Word) - 1U) / sizeof(Word);
+
+public:
+    /// @brief Type of the stored value.
+    using ValueType = T;
+
+    /// @brief Constructor
+    /// @param[in] value Initial value.
+    explicit SeqLock(const T& value = T())
+    {
+        storeWords(value);
+    }
+
+    /// @brief Copy constructor is deleted
+    SeqLock(const SeqLock&) = delete;
+
+    /// @brief Copy assignment is deleted
+    SeqLock& operator=(const SeqLock&) = delete;
+
+    /// @brief Publish new value.
+    /// @details Must be invoked from the single writer thread only.
+    void write(const T& value)
+    {
+        auto seq = m_seq.load(std::memory_order_relaxed);
+        m_seq.store(seq + 1U, std::memory_order_relaxed);
+        std::atomic_thread_fence(std::memory_order_release);
+        storeWords(value);
+        m_seq.store(seq + 2U, std::memory_order_release);
+    }
+
+    /// @brief Try to read the value with single attempt.
+    /// @details Never waits, fails when the value is being updated
+    ///     at the same time.
+    /// @param[out] value Read value, untouched on failure.
+    /// @return @b true on success.
+    bool tryRead(T& value) const
+    {
+        auto before = m_seq.load(std::memory_order_acquire);
+        if ((before & 0x1U) != 0U) {
+            return false;
+        }
+
+        std::array<Word, WordsCount> words;
+        for (std::size_t idx = 0U; idx < WordsCount; ++idx) {
+            words[idx] = m_words[idx].load(std::memory_order_relaxed);
+        }
+
+        std::atomic_thread_fence(std::memory_order_acquire);
+        if (m_seq.load(std::memory_order_relaxed) != before) {
+            return false;
+        }
+
+        // The type is trivially copyable, but may have default member initializers
+        std::memcpy(static_cast<void*>(&value), &words[0], sizeof(T));
+        return true;
+    }
+
+    /// @brief Read the value.
+    /// @details Retries until consistent copy is retrieved, the number
+    ///     of retries is bound by the update rate of the writer.
+    T read() const
+    {
+        T value;
+        while (!tryRead(value)) {}
+        return value;
+    }
+
+    /// @brief Number of performed updates.
+    /// @details May be used by the readers to detect new value without
+    ///     copying it.
+    std::size_t version() const
+    {
+        return static_cast<std::size_t>(m_seq.load(std::memory_order_acquire) / 2U);
+    }
+
+private:
+    void storeWords(const T& value)
+    {
+        std::array<Word, WordsCount> words;
+        words.back() = 0U;
+        std::memcpy(&words[0], &value, sizeof(T));
+        for (std::size_t idx = 0U; idx < WordsCount; ++idx) {
+            m_words[idx].store(words[idx], std::memory_order_relaxed);
+        }
+    }
+
+    std::atomic<std::size_t> m_seq{0U};
+    std::array<std::atomic<Word>, WordsCount> m_words;
+};
+
+} // namespace util
+
+}  // namespace ublox
+
+
@@ -0,0 +1,273 @@
+//
+// Copyright 2018 (C). Alex Robenko. All rights reserved.
+//
+
+// This file is free software: you can redistribute it and/or modify
+// it under the terms of the GNU General Public License as published by
+// the Free Software Foundation, either version 3 of the License, or
+// (at your option) any later version.
+//
+// This program is distributed in the hope that it will be useful,
+// but WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+// GNU General Public License for more details.
+//
+// You should have received a copy of the GNU General Public License
+// along with this program.  If not, see <http://www.gnu.org/licenses/>.
+
+/// @file
+/// @brief Contains definition of ublox::util::SpscQueue class.
+
+#pragma once
+
+#include <cstdint>
+#include <cstddef>
+#include <array>
+#include <atomic>
+#include <thread>
+#include <type_traits>
+#include <utility>
+
+namespace ublox
+{
+
+namespace util
+{
+
+/// @brief Behaviour of @ref SpscQueue when pushing into full queue.
+enum class OverflowPolicy : std::uint8_t
+{
+    DropOldest, ///< Discard the oldest element to make room for the new one
+    DropNewest, ///< Discard the new element
+    Block, ///< Wait for the consumer to make room
+    NumOfValues ///< Number of available values, must be last
+};
+
+namespace details
+{
+
+template <typename T>
+struct SpscQueueHasClear
+{
+    template <typename U>
+    static auto test(int) -> decltype(std::declval<U&>().clear(), std::true_type());
+
+    template <typename U>
+    static std::false_type test(...);
+
+    static const bool Value = decltype(test<T>(0))::value;
+};
+
+template <typename T>
+void spscQueueClear(T& elem, std::true_type)
+{
+    elem.clear();
+}
+
+template <typename T>
+void spscQueueClear(T& elem, std::false_type)
+{
+    elem = T();
+}
+
+} // namespace details
+
+/// @brief Bounded lock-free single producer / single consumer queue.
+/// @details Used to decouple the thread reading the device from the
+///     thread handling the messages, the elements are usually complete
+///     frames (see @ref FrameBuffer) or decoded message pointers. The
+///     producer never takes a lock, a slow consumer results in dropped
+///     elements (counted, see droppedCount()) or in the producer waiting,
+///     depending on the configured @ref OverflowPolicy.@n
+///     With @ref OverflowPolicy::DropOldest the producer may remove the oldest
+///     element, hence the head of the queue is claimed with compare-and-swap
+///     by both sides, and every slot carries its state so the producer
+///     never overwrites the element the consumer is still moving out.
+///     The dropped element is reset by its @b clear() member function
+///     when available (see for example @ref FrameBuffer::clear()), by
+///     assigning default constructed value otherwise.@n
+///     The elements are stored inside the queue object, the queue of large
+///     elements (such as @ref FrameBuffer) should be allocated statically or
+///     on the heap rather than on the stack.
+/// @tparam T Type of the element, must be default constructible and
+///     move assignable.
+/// @tparam TCapacity Maximal number of elements in the queue.
+template <typename T, std::size_t TCapacity>
+class SpscQueue
+{
+    static_assert(0U < TCapacity, "The capacity must be positive");
+
+public:
+    /// @brief Type of the element.
+    using ValueType = T;
+
+    /// @brief Capacity of the queue.
+    static const std::size_t Capacity = TCapacity;
+
+    /// @brief Constructor
+    /// @param[in] policy Behaviour when pushing into full queue.
+    explicit SpscQueue(OverflowPolicy policy = OverflowPolicy::DropNewest)
+      : m_policy(policy)
+    {
+        for (auto& slot : m_slots) {
+            slot.m_full.store(false, std::memory_order_relaxed);
+        }
+    }
+
+    /// @brief Copy constructor is deleted
+    SpscQueue(const SpscQueue&) = delete;
+
+    /// @brief Copy assignment is deleted
+    SpscQueue& operator=(const SpscQueue&) = delete;
+
+    /// @brief Push the element (producer side).
+    /// @return @b false in case the element has been dropped.
+    bool push(T&& value)
+    {
+        return pushWith(
+            [&value](T& elem) -> bool
+            {
+                elem = std::move(value);
+                return true;
+            });
+    }
+
+    /// @brief Push the element by filling the slot in place (producer side).
+    /// @details When the fill functor fails, the element isn't pushed. Note
+    ///     that with @ref OverflowPolicy::DropOldest the oldest element has
+    ///     already been dropped at that point when the queue was full.
+    /// @param[in] fillFunc Functor with <b>bool (T& elem)</b> signature used to
+    ///     assign the value of the element stored in the queue, returning
+    ///     @b false to cancel the push.
+    /// @return @b false in case the element has been dropped or the fill
+    ///     functor has failed.
+    template <typename TFillFunc>
+    bool pushWith(TFillFunc&& fillFunc)
+    {
+        auto tail = m_tail.load(std::memory_order_relaxed);
+        auto head = m_head.load(std::memory_order_acquire);
+        while (TCapacity <= (tail - head)) {
+            if (m_policy == OverflowPolicy::DropNewest) {
+                increment(m_dropped);
+                return false;
+            }
+
+            if (m_policy == OverflowPolicy::Block) {
+                std::this_thread::yield();
+                head = m_head.load(std::memory_order_acquire);
+                continue;
+            }
+
+            if (m_head.compare_exchange_strong(head, head + 1U, std::memory_order_acq_rel)) {
+                auto& dropped = m_slots[head % TCapacity];
+                details::spscQueueClear(
+                    dropped.m_value,
+                    std::integral_constant<bool, details::SpscQueueHasClear<T>::Value>());
+                dropped.m_full.store(false, std::memory_order_relaxed);
+                increment(m_dropped);
+                break;
+            }
+        }
+
+        auto& slot = m_slots[tail % TCapacity];
+        while (slot.m_full.load(std::memory_order_acquire)) {
+            // The consumer is still moving the value out
+            std::this_thread::yield();
+        }
+
+        if (!fillFunc(slot.m_value)) {
+            return false;
+        }
+
+        slot.m_full.store(true, std::memory_order_relaxed);
+        m_tail.store(tail + 1U, std::memory_order_release);
+        increment(m_pushed);
+        return true;
+    }
+
+    /// @brief Pop the oldest element (consumer side).
+    /// @return @b false in case the queue is empty.
+    bool pop(T& value)
+    {
+        auto head = m_head.load(std::memory_order_acquire);
+        while (true) {
+            if (head == m_tail.load(std::memory_order_acquire)) {
+                return false;
+            }
+
+            if (m_head.compare_exchange_weak(head, head + 1U, std::memory_order_acq_rel)) {
+                break;
+            }
+        }
+
+        auto& slot = m_slots[head % TCapacity];
+        value = std::move(slot.m_value);
+        slot.m_full.store(false, std::memory_order_release);
+        increment(m_popped);
+        return true;
+    }
+
+    /// @brief Number of elements in the queue (approximate when called
+    ///     concurrently with push or pop).
+    std::size_t size() const
+    {
+        auto head = m_head.load(std::memory_order_acquire);
+        auto tail = m_tail.load(std::memory_order_acquire);
+        return static_cast<std::size_t>(tail - head);
+    }
+
+    /// @brief Check whether the queue is empty.
+    bool empty() const
+    {
+        return size() == 0U;
+    }
+
+    /// @brief Total number of pushed elements.
+    std::uint64_t pushedCount() const
+    {
+        return m_pushed.load(std::memory_order_relaxed);
+    }
+
+    /// @brief Total number of popped elements.
+    std::uint64_t poppedCount() const
+    {
+        return m_popped.load(std::memory_order_relaxed);
+    }
+
+    /// @brief Total number of dropped elements.
+    std::uint64_t droppedCount() const
+    {
+        return m_dropped.load(std::memory_order_relaxed);
+    }
+
+private:
+    struct Slot
+    {
+        T m_value;
+        std::atomic<bool> m_full;
+    };
+
+    static void increment(std::atomic<std::uint64_t>& counter)
+    {
+        counter.store(counter.load(std::memory_order_relaxed) + 1U, std::memory_order_relaxed);
+    }
+
+    static const std::size_t CacheLineSize = 64U;
+
+    // Padding keeps the consumer and producer indices on separate cache lines
+    std::array<Slot, TCapacity> m_slots;
+    std::uint8_t m_padding1[CacheLineSize];
+    std::atomic<std::uint64_t> m_head{0U};
+    std::atomic<std::uint64_t> m_popped{0U};
+    std::uint8_t m_padding2[CacheLineSize];
+    std::atomic<std::uint64_t> m_tail{0U};
+    std::atomic<std::uint64_t> m_pushed{0U};
+    std::atomic<std::uint64_t> m_dropped{0U};
+    OverflowPolicy m_policy = OverflowPolicy::DropNewest;
+};
+
+} // namespace util
+
+}  // namespace ublox
+
+
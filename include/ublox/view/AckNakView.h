@@ -0,0 +1,80 @@
+//
+// Copyright 2018 (C). Alex Robenko. All rights reserved.
+//
+
+// This file is free software: you can redistribute it and/or modify
+// it under the terms of the GNU General Public License as published by
+// the Free Software Foundation, either version 3 of the License, or
+// (at your option) any later version.
+//
+// This program is distributed in the hope that it will be useful,
+// but WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+// GNU General Public License for more details.
+//
+// You should have received a copy of the GNU General Public License
+// along with this program.  If not, see <http://www.gnu.org/licenses/>.
+
+/// @file
+/// @brief Contains definition of lazy view of ACK-NAK message.
+/// @details Generated by script/gen_views.py, do NOT edit manually.
+
+#pragma once
+
+#include "ublox/message/AckNak.h"
+#include "MsgView.h"
+
+namespace ublox
+{
+
+namespace view
+{
+
+/// @brief Lazy read-only view of ACK-NAK message payload.
+/// @details Wraps the pointer to the validated payload, the fields are
+///     decoded on access only, see @ref MsgView.
+/// @see @ref ublox::message::AckNak
+class AckNakView : public
+    MsgView<
+        ublox::message::AckNakFields::All
+    >
+{
+    using Base =
+        MsgView<
+            ublox::message::AckNakFields::All
+        >;
+
+public:
+    /// @brief ID of the viewed message.
+    static const MsgId MsgIdValue = MsgId_ACK_NAK;
+
+    /// @brief Index of the fields, same as the ones defined by
+    ///     @b COMMS_MSG_FIELDS_ACCESS() in @ref ublox::message::AckNak.
+    enum FieldIdx
+    {
+        FieldIdx_id, ///< index of @b id field
+        FieldIdx_numOfValues ///< number of available fields
+    };
+
+    /// @brief Default constructor, creates empty view.
+    AckNakView() = default;
+
+    /// @brief Constructor
+    /// @param[in] payload Pointer to the payload of the message.
+    /// @param[in] len Length of the payload.
+    AckNakView(const std::uint8_t* payload, std::size_t len)
+      : Base(payload, len)
+    {
+    }
+
+    /// @brief Decode "id" field (see @ref ublox::message::AckNakFields::id).
+    comms::ErrorStatus field_id(FieldType<FieldIdx_id>& field) const
+    {
+        return Base::readField<FieldIdx_id>(field);
+    }
+};
+
+} // namespace view
+
+} // namespace ublox
+
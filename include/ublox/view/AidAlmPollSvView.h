@@ -0,0 +1,80 @@
+//
+// Copyright 2018 (C). Alex Robenko. All rights reserved.
+//
+
+// This file is free software: you can redistribute it and/or modify
+// it under the terms of the GNU General Public License as published by
+// the Free Software Foundation, either version 3 of the License, or
+// (at your option) any later version.
+//
+// This program is distributed in the hope that it will be useful,
+// but WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+// GNU General Public License for more details.
+//
+// You should have received a copy of the GNU General Public License
+// along with this program.  If not, see <http://www.gnu.org/licenses/>.
+
+/// @file
+/// @brief Contains definition of lazy view of AID-ALM (<b>poll SV</b>) message.
+/// @details Generated by script/gen_views.py, do NOT edit manually.
+
+#pragma once
+
+#include "ublox/message/AidAlmPollSv.h"
+#include "MsgView.h"
+
+namespace ublox
+{
+
+namespace view
+{
+
+/// @brief Lazy read-only view of AID-ALM (<b>poll SV</b>) message payload.
+/// @details Wraps the pointer to the validated payload, the fields are
+///     decoded on access only, see @ref MsgView.
+/// @see @ref ublox::message::AidAlmPollSv
+class AidAlmPollSvView : public
+    MsgView<
+        ublox::message::AidAlmPollSvFields::All
+    >
+{
+    using Base =
+        MsgView<
+            ublox::message::AidAlmPollSvFields::All
+        >;
+
+public:
+    /// @brief ID of the viewed message.
+    static const MsgId MsgIdValue = MsgId_AID_ALM;
+
+    /// @brief Index of the fields, same as the ones defined by
+    ///     @b COMMS_MSG_FIELDS_ACCESS() in @ref ublox::message::AidAlmPollSv.
+    enum FieldIdx
+    {
+        FieldIdx_svid, ///< index of @b svid field
+        FieldIdx_numOfValues ///< number of available fields
+    };
+
+    /// @brief Default constructor, creates empty view.
+    AidAlmPollSvView() = default;
+
+    /// @brief Constructor
+    /// @param[in] payload Pointer to the payload of the message.
+    /// @param[in] len Length of the payload.
+    AidAlmPollSvView(const std::uint8_t* payload, std::size_t len)
+      : Base(payload, len)
+    {
+    }
+
+    /// @brief Decode "svid" field (see @ref ublox::message::AidAlmPollSvFields::svid).
+    comms::ErrorStatus field_svid(FieldType<FieldIdx_svid>& field) const
+    {
+        return Base::readField<FieldIdx_svid>(field);
+    }
+};
+
+} // namespace view
+
+} // namespace ublox
+
@@ -0,0 +1,66 @@
+//
+// Copyright 2018 (C). Alex Robenko. All rights reserved.
+//
+
+// This file is free software: you can redistribute it and/or modify
+// it under the terms of the GNU General Public License as published by
+// the Free Software Foundation, either version 3 of the License, or
+// (at your option) any later version.
+//
+// This program is distributed in the hope that it will be useful,
+// but WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+// GNU General Public License for more details.
+//
+// You should have received a copy of the GNU General Public License
+// along with this program.  If not, see <http://www.gnu.org/licenses/>.
+
+/// @file
+/// @brief Contains definition of lazy view of AID-ALM (@b poll) message.
+/// @details Generated by script/gen_views.py, do NOT edit manually.
+
+#pragma once
+
+#include "ublox/message/AidAlmPoll.h"
+#include "MsgView.h"
+
+namespace ublox
+{
+
+namespace view
+{
+
+/// @brief Lazy read-only view of AID-ALM (@b poll) message payload.
+/// @details Wraps the pointer to the validated payload, the fields are
+///     decoded on access only, see @ref MsgView.
+/// @see @ref ublox::message::AidAlmPoll
+class AidAlmPollView : public
+    MsgView<
+        ublox::message::AidAlmPollFields::All
+    >
+{
+    using Base =
+        MsgView<
+            ublox::message::AidAlmPollFields::All
+        >;
+
+public:
+    /// @brief ID of the viewed message.
+    static const MsgId MsgIdValue = MsgId_AID_ALM;
+
+    /// @brief Default constructor, creates empty view.
+    AidAlmPollView() = default;
+
+    /// @brief Constructor
+    /// @param[in] payload Pointer to the payload of the message.
+    /// @param[in] len Length of the payload.
+    AidAlmPollView(const std::uint8_t* payload, std::size_t len)
+      : Base(payload, len)
+    {
+    }
+};
+
+} // namespace view
+
+} // namespace ublox
+
@@ -0,0 +1,136 @@
+//
+// Copyright 2018 (C). Alex Robenko. All rights reserved.
+//
+
+// This file is free software: you can redistribute it and/or modify
+// it under the terms of the GNU General Public License as published by
+// the Free Software Foundation, either version 3 of the License, or
+// (at your option) any later version.
+//
+// This program is distributed in the hope that it will be useful,
+// but WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+// GNU General Public License for more details.
+//
+// You should have received a copy of the GNU General Public License
+// along with this program.  If not, see <http://www.gnu.org/licenses/>.
+
+/// @file
+/// @brief Contains definition of lazy view of AID-ALP message.
+/// @details Generated by script/gen_views.py, do NOT edit manually.
+
+#pragma once
+
+#include "ublox/message/AidAlp.h"
+#include "MsgView.h"
+
+namespace ublox
+{
+
+namespace view
+{
+
+/// @brief Lazy read-only view of AID-ALP message payload.
+/// @details Wraps the pointer to the validated payload, the fields are
+///     decoded on access only, see @ref MsgView.
+/// @see @ref ublox::message::AidAlp
+class AidAlpView : public
+    MsgView<
+        ublox::message::AidAlpFields::All
+    >
+{
+    using Base =
+        MsgView<
+            ublox::message::AidAlpFields::All
+        >;
+
+public:
+    /// @brief ID of the viewed message.
+    static const MsgId MsgIdValue = MsgId_AID_ALP;
+
+    /// @brief Index of the fields, same as the ones defined by
+    ///     @b COMMS_MSG_FIELDS_ACCESS() in @ref ublox::message::AidAlp.
+    enum FieldIdx
+    {
+        FieldIdx_predTow, ///< index of @b predTow field
+        FieldIdx_predDur, ///< index of @b predDur field
+        FieldIdx_age, ///< index of @b age field
+        FieldIdx_predWno, ///< index of @b predWno field
+        FieldIdx_almWno, ///< index of @b almWno field
+        FieldIdx_reserved1, ///< index of @b reserved1 field
+        FieldIdx_svs, ///< index of @b svs field
+        FieldIdx_reserved2, ///< index of @b reserved2 field
+        FieldIdx_reserved3, ///< index of @b reserved3 field
+        FieldIdx_numOfValues ///< number of available fields
+    };
+
+    /// @brief Default constructor, creates empty view.
+    AidAlpView() = default;
+
+    /// @brief Constructor
+    /// @param[in] payload Pointer to the payload of the message.
+    /// @param[in] len Length of the payload.
+    AidAlpView(const std::uint8_t* payload, std::size_t len)
+      : Base(payload, len)
+    {
+    }
+
+    /// @brief Decode "predTow" field (see @ref ublox::message::AidAlpFields::predTow).
+    comms::ErrorStatus field_predTow(FieldType<FieldIdx_predTow>& field) const
+    {
+        return Base::readField<FieldIdx_predTow>(field);
+    }
+
+    /// @brief Decode "predDur" field (see @ref ublox::message::AidAlpFields::predDur).
+    comms::ErrorStatus field_predDur(FieldType<FieldIdx_predDur>& field) const
+    {
+        return Base::readField<FieldIdx_predDur>(field);
+    }
+
+    /// @brief Decode "age" field (see @ref ublox::message::AidAlpFields::age).
+    comms::ErrorStatus field_age(FieldType<FieldIdx_age>& field) const
+    {
+        return Base::readField<FieldIdx_age>(field);
+    }
+
+    /// @brief Decode "predWno" field (see @ref ublox::message::AidAlpFields::predWno).
+    comms::ErrorStatus field_predWno(FieldType<FieldIdx_predWno>& field) const
+    {
+        return Base::readField<FieldIdx_predWno>(field);
+    }
+
+    /// @brief Decode "almWno" field (see @ref ublox::message::AidAlpFields::almWno).
+    comms::ErrorStatus field_almWno(FieldType<FieldIdx_almWno>& field) const
+    {
+        return Base::readField<FieldIdx_almWno>(field);
+    }
+
+    /// @brief Decode "reserved1" field (see @ref ublox::message::AidAlpFields::reserved1).
+    comms::ErrorStatus field_reserved1(FieldType<FieldIdx_reserved1>& field) const
+    {
+        return Base::readField<FieldIdx_reserved1>(field);
+    }
+
+    /// @brief Decode "svs" field (see @ref ublox::message::AidAlpFields::svs).
+    comms::ErrorStatus field_svs(FieldType<FieldIdx_svs>& field) const
+    {
+        return Base::readField<FieldIdx_svs>(field);
+    }
+
+    /// @brief Decode "reserved2" field (see @ref ublox::message::AidAlpFields::reserved2).
+    comms::ErrorStatus field_reserved2(FieldType<FieldIdx_reserved2>& field) const
+    {
+        return Base::readField<FieldIdx_reserved2>(field);
+    }
+
+    /// @brief Decode "reserved3" field (see @ref ublox::message::AidAlpFields::reserved3).
+    comms::ErrorStatus field_reserved3(FieldType<FieldIdx_reserved3>& field) const
+    {
+        return Base::readField<FieldIdx_reserved3>(field);
+    }
+};
+
+} // namespace view
+
+} // namespace ublox
+
@@ -0,0 +1,140 @@
+//
+// Copyright 2018 (C). Alex Robenko. All rights reserved.
+//
+
+// This file is free software: you can redistribute it and/or modify
+// it under the terms of the GNU General Public License as published by
+// the Free Software Foundation, either version 3 of the License, or
+// (at your option) any later version.
+//
+// This program is distributed in the hope that it will be useful,
+// but WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+// GNU General Public License for more details.
+//
+// You should have received a copy of the GNU General Public License
+// along with this program.  If not, see <http://www.gnu.org/licenses/>.
+
+/// @file
+/// @brief Contains definition of lazy view of AID-ALPSRV message.
+/// @details Generated by script/gen_views.py, do NOT edit manually.
+
+#pragma once
+
+#include "ublox/message/AidAlpsrv.h"
+#include "MsgView.h"
+
+namespace ublox
+{
+
+namespace view
+{
+
+/// @brief Lazy read-only view of AID-ALPSRV message payload.
+/// @details Wraps the pointer to the validated payload, the fields are
+///     decoded on access only, see @ref MsgView.
+///     The message performs custom read of its fields, the fields starting
+///     from "data" are not accessible through the view, because their
+///     presence and/or size depend on the values of preceding fields.
+/// @see @ref ublox::message::AidAlpsrv
+class AidAlpsrvView : public
+    MsgView<
+        ublox::message::AidAlpsrvFields::All<comms::option::EmptyOption>
+    >
+{
+    using Base =
+        MsgView<
+            ublox::message::AidAlpsrvFields::All<comms::option::EmptyOption>
+        >;
+
+public:
+    /// @brief ID of the viewed message.
+    static const MsgId MsgIdValue = MsgId_AID_ALPSRV;
+
+    /// @brief Index of the fields, same as the ones defined by
+    ///     @b COMMS_MSG_FIELDS_ACCESS() in @ref ublox::message::AidAlpsrv.
+    enum FieldIdx
+    {
+        FieldIdx_idSize, ///< index of @b idSize field
+        FieldIdx_type, ///< index of @b type field
+        FieldIdx_ofs, ///< index of @b ofs field
+        FieldIdx_size, ///< index of @b size field
+        FieldIdx_fileId, ///< index of @b fileId field
+        FieldIdx_dataSize, ///< index of @b dataSize field
+        FieldIdx_id1, ///< index of @b id1 field
+        FieldIdx_id2, ///< index of @b id2 field
+        FieldIdx_id3, ///< index of @b id3 field
+        FieldIdx_data, ///< index of @b data field
+        FieldIdx_numOfValues ///< number of available fields
+    };
+
+    /// @brief Default constructor, creates empty view.
+    AidAlpsrvView() = default;
+
+    /// @brief Constructor
+    /// @param[in] payload Pointer to the payload of the message.
+    /// @param[in] len Length of the payload.
+    AidAlpsrvView(const std::uint8_t* payload, std::size_t len)
+      : Base(payload, len)
+    {
+    }
+
+    /// @brief Decode "idSize" field (see @ref ublox::message::AidAlpsrvFields::idSize).
+    comms::ErrorStatus field_idSize(FieldType<FieldIdx_idSize>& field) const
+    {
+        return Base::readField<FieldIdx_idSize>(field);
+    }
+
+    /// @brief Decode "type" field (see @ref ublox::message::AidAlpsrvFields::type).
+    comms::ErrorStatus field_type(FieldType<FieldIdx_type>& field) const
+    {
+        return Base::readField<FieldIdx_type>(field);
+    }
+
+    /// @brief Decode "ofs" field (see @ref ublox::message::AidAlpsrvFields::ofs).
+    comms::ErrorStatus field_ofs(FieldType<FieldIdx_ofs>& field) const
+    {
+        return Base::readField<FieldIdx_ofs>(field);
+    }
+
+    /// @brief Decode "size" field (see @ref ublox::message::AidAlpsrvFields::size).
+    comms::ErrorStatus field_size(FieldType<FieldIdx_size>& field) const
+    {
+        return Base::readField<FieldIdx_size>(field);
+    }
+
+    /// @brief Decode "fileId" field (see @ref ublox::message::AidAlpsrvFields::fileId).
+    comms::ErrorStatus field_fileId(FieldType<FieldIdx_fileId>& field) const
+    {
+        return Base::readField<FieldIdx_fileId>(field);
+    }
+
+    /// @brief Decode "dataSize" field (see @ref ublox::message::AidAlpsrvFields::dataSize).
+    comms::ErrorStatus field_dataSize(FieldType<FieldIdx_dataSize>& field) const
+    {
+        return Base::readField<FieldIdx_dataSize>(field);
+    }
+
+    /// @brief Decode "id1" field (see @ref ublox::message::AidAlpsrvFields::id1).
+    comms::ErrorStatus field_id1(FieldType<FieldIdx_id1>& field) const
+    {
+        return Base::readField<FieldIdx_id1>(field);
+    }
+
+    /// @brief Decode "id2" field (see @ref ublox::message::AidAlpsrvFields::id2).
+    comms::ErrorStatus field_id2(FieldType<FieldIdx_id2>& field) const
+    {
+        return Base::readField<FieldIdx_id2>(field);
+    }
+
+    /// @brief Decode "id3" field (see @ref ublox::message::AidAlpsrvFields::id3).
+    comms::ErrorStatus field_id3(FieldType<FieldIdx_id3>& field) const
+    {
+        return Base::readField<FieldIdx_id3>(field);
+    }
+};
+
+} // namespace view
+
+} // namespace ublox
+
@@ -0,0 +1,98 @@
+//
+// Copyright 2018 (C). Alex Robenko. All rights reserved.
+//
+
+// This file is free software: you can redistribute it and/or modify
+// it under the terms of the GNU General Public License as published by
+// the Free Software Foundation, either version 3 of the License, or
+// (at your option) any later version.
+//
+// This program is distributed in the hope that it will be useful,
+// but WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+// GNU General Public License for more details.
+//
+// You should have received a copy of the GNU General Public License
+// along with this program.  If not, see <http://www.gnu.org/licenses/>.
+
+/// @file
+/// @brief Contains definition of lazy view of AID-AOP (@b ublox-8) message.
+/// @details Generated by script/gen_views.py, do NOT edit manually.
+
+#pragma once
+
+#include "ublox/message/AidAopU8.h"
+#include "MsgView.h"
+
+namespace ublox
+{
+
+namespace view
+{
+
+/// @brief Lazy read-only view of AID-AOP (@b ublox-8) message payload.
+/// @details Wraps the pointer to the validated payload, the fields are
+///     decoded on access only, see @ref MsgView.
+///     The message performs custom read of its fields, the fields starting
+///     from "data" are not accessible through the view, because their
+///     presence and/or size depend on the values of preceding fields.
+/// @see @ref ublox::message::AidAopU8
+class AidAopU8View : public
+    MsgView<
+        ublox::message::AidAopU8Fields::All<comms::option::EmptyOption>
+    >
+{
+    using Base =
+        MsgView<
+            ublox::message::AidAopU8Fields::All<comms::option::EmptyOption>
+        >;
+
+public:
+    /// @brief ID of the viewed message.
+    static const MsgId MsgIdValue = MsgId_AID_AOP;
+
+    /// @brief Index of the fields, same as the ones defined by
+    ///     @b COMMS_MSG_FIELDS_ACCESS() in @ref ublox::message::AidAopU8.
+    enum FieldIdx
+    {
+        FieldIdx_gnssId, ///< index of @b gnssId field
+        FieldIdx_svid, ///< index of @b svid field
+        FieldIdx_reserved1, ///< index of @b reserved1 field
+        FieldIdx_data, ///< index of @b data field
+        FieldIdx_numOfValues ///< number of available fields
+    };
+
+    /// @brief Default constructor, creates empty view.
+    AidAopU8View() = default;
+
+    /// @brief Constructor
+    /// @param[in] payload Pointer to the payload of the message.
+    /// @param[in] len Length of the payload.
+    AidAopU8View(const std::uint8_t* payload, std::size_t len)
+      : Base(payload, len)
+    {
+    }
+
+    /// @brief Decode "gnssId" field (see @ref ublox::message::AidAopU8Fields::gnssId).
+    comms::ErrorStatus field_gnssId(FieldType<FieldIdx_gnssId>& field) const
+    {
+        return Base::readField<FieldIdx_gnssId>(field);
+    }
+
+    /// @brief Decode "svid" field (see @ref ublox::message::AidAopU8Fields::svid).
+    comms::ErrorStatus field_svid(FieldType<FieldIdx_svid>& field) const
+    {
+        return Base::readField<FieldIdx_svid>(field);
+    }
+
+    /// @brief Decode "reserved1" field (see @ref ublox::message::AidAopU8Fields::reserved1).
+    comms::ErrorStatus field_reserved1(FieldType<FieldIdx_reserved1>& field) const
+    {
+        return Base::readField<FieldIdx_reserved1>(field);
+    }
+};
+
+} // namespace view
+
+} // namespace ublox
+
@@ -0,0 +1,85 @@
+//
+// Copyright 2018 (C). Alex Robenko. All rights reserved.
+//
+
+// This file is free software: you can redistribute it and/or modify
+// it under the terms of the GNU General Public License as published by
+// the Free Software Foundation, either version 3 of the License, or
+// (at your option) any later version.
+//
+// This program is distributed in the hope that it will be useful,
+// but WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+// GNU General Public License for more details.
+//
+// You should have received a copy of the GNU General Public License
+// along with this program.  If not, see <http://www.gnu.org/licenses/>.
+
+/// @file
+/// @brief Contains definition of lazy view of AID-AOP message.
+/// @details Generated by script/gen_views.py, do NOT edit manually.
+
+#pragma once
+
+#include "ublox/message/AidAop.h"
+#include "MsgView.h"
+
+namespace ublox
+{
+
+namespace view
+{
+
+/// @brief Lazy read-only view of AID-AOP message payload.
+/// @details Wraps the pointer to the validated payload, the fields are
+///     decoded on access only, see @ref MsgView.
+///     The message performs custom read of its fields, the fields starting
+///     from "data" are not accessible through the view, because their
+///     presence and/or size depend on the values of preceding fields.
+/// @see @ref ublox::message::AidAop
+class AidAopView : public
+    MsgView<
+        ublox::message::AidAopFields::All<comms::option::EmptyOption, comms::option::EmptyOption>
+    >
+{
+    using Base =
+        MsgView<
+            ublox::message::AidAopFields::All<comms::option::EmptyOption, comms::option::EmptyOption>
+        >;
+
+public:
+    /// @brief ID of the viewed message.
+    static const MsgId MsgIdValue = MsgId_AID_AOP;
+
+    /// @brief Index of the fields, same as the ones defined by
+    ///     @b COMMS_MSG_FIELDS_ACCESS() in @ref ublox::message::AidAop.
+    enum FieldIdx
+    {
+        FieldIdx_svid, ///< index of @b svid field
+        FieldIdx_data, ///< index of @b data field
+        FieldIdx_optional, ///< index of @b optional field
+        FieldIdx_numOfValues ///< number of available fields
+    };
+
+    /// @brief Default constructor, creates empty view.
+    AidAopView() = default;
+
+    /// @brief Constructor
+    /// @param[in] payload Pointer to the payload of the message.
+    /// @param[in] len Length of the payload.
+    AidAopView(const std::uint8_t* payload, std::size_t len)
+      : Base(payload, len)
+    {
+    }
+
+    /// @brief Decode "svid" field (see @ref ublox::message::AidAopFields::svid).
+    comms::ErrorStatus field_svid(FieldType<FieldIdx_svid>& field) const
+    {
+        return Base::readField<FieldIdx_svid>(field);
+    }
+};
+
+} // namespace view
+
+} // namespace ublox
+
@@ -0,0 +1,206 @@
+//
+// Copyright 2018 (C). Alex Robenko. All rights reserved.
+//
+
+// This file is free software: you can redistribute it and/or modify
+// it under the terms of the GNU General Public License as published by
+// the Free Software Foundation, either version 3 of the License, or
+// (at your option) any later version.
+//
+// This program is distributed in the hope that it will be useful,
+// but WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+// GNU General Public License for more details.
+//
+// You should have received a copy of the GNU General Public License
+// along with this program.  If not, see <http://www.gnu.org/licenses/>.
+
+/// @file
+/// @brief Contains definition of lazy view of AID-HUI message.
+/// @details Generated by script/gen_views.py, do NOT edit manually.
+
+#pragma once
+
+#include "ublox/message/AidHui.h"
+#include "MsgView.h"
+
+namespace ublox
+{
+
+namespace view
+{
+
+/// @brief Lazy read-only view of AID-HUI message payload.
+/// @details Wraps the pointer to the validated payload, the fields are
+///     decoded on access only, see @ref MsgView.
+/// @see @ref ublox::message::AidHui
+class AidHuiView : public
+    MsgView<
+        ublox::message::AidHuiFields::All
+    >
+{
+    using Base =
+        MsgView<
+            ublox::message::AidHuiFields::All
+        >;
+
+public:
+    /// @brief ID of the viewed message.
+    static const MsgId MsgIdValue = MsgId_AID_HUI;
+
+    /// @brief Index of the fields, same as the ones defined by
+    ///     @b COMMS_MSG_FIELDS_ACCESS() in @ref ublox::message::AidHui.
+    enum FieldIdx
+    {
+        FieldIdx_health, ///< index of @b health field
+        FieldIdx_utcA0, ///< index of @b utcA0 field
+        FieldIdx_utcA1, ///< index of @b utcA1 field
+        FieldIdx_utcTOW, ///< index of @b utcTOW field
+        FieldIdx_utcWNT, ///< index of @b utcWNT field
+        FieldIdx_utcLS, ///< index of @b utcLS field
+        FieldIdx_utcWNF, ///< index of @b utcWNF field
+        FieldIdx_utcDN, ///< index of @b utcDN field
+        FieldIdx_utcLSF, ///< index of @b utcLSF field
+        FieldIdx_utcSpare, ///< index of @b utcSpare field
+        FieldIdx_klobA0, ///< index of @b klobA0 field
+        FieldIdx_klobA1, ///< index of @b klobA1 field
+        FieldIdx_klobA2, ///< index of @b klobA2 field
+        FieldIdx_klobA3, ///< index of @b klobA3 field
+        FieldIdx_klobB0, ///< index of @b klobB0 field
+        FieldIdx_klobB1, ///< index of @b klobB1 field
+        FieldIdx_klobB2, ///< index of @b klobB2 field
+        FieldIdx_klobB3, ///< index of @b klobB3 field
+        FieldIdx_flags, ///< index of @b flags field
+        FieldIdx_numOfValues ///< number of available fields
+    };
+
+    /// @brief Default constructor, creates empty view.
+    AidHuiView() = default;
+
+    /// @brief Constructor
+    /// @param[in] payload Pointer to the payload of the message.
+    /// @param[in] len Length of the payload.
+    AidHuiView(const std::uint8_t* payload, std::size_t len)
+      : Base(payload, len)
+    {
+    }
+
+    /// @brief Decode "health" field (see @ref ublox::message::AidHuiFields::health).
+    comms::ErrorStatus field_health(FieldType<FieldIdx_health>& field) const
+    {
+        return Base::readField<FieldIdx_health>(field);
+    }
+
+    /// @brief Decode "utcA0" field (see @ref ublox::message::AidHuiFields::utcA0).
+    comms::ErrorStatus field_utcA0(FieldType<FieldIdx_utcA0>& field) const
+    {
+        return Base::readField<FieldIdx_utcA0>(field);
+    }
+
+    /// @brief Decode "utcA1" field (see @ref ublox::message::AidHuiFields::utcA1).
+    comms::ErrorStatus field_utcA1(FieldType<FieldIdx_utcA1>& field) const
+    {
+        return Base::readField<FieldIdx_utcA1>(field);
+    }
+
+    /// @brief Decode "utcTOW" field (see @ref ublox::message::AidHuiFields::utcTOW).
+    comms::ErrorStatus field_utcTOW(FieldType<FieldIdx_utcTOW>& field) const
+    {
+        return Base::readField<FieldIdx_utcTOW>(field);
+    }
+
+    /// @brief Decode "utcWNT" field (see @ref ublox::message::AidHuiFields::utcWNT).
+    comms::ErrorStatus field_utcWNT(FieldType<FieldIdx_utcWNT>& field) const
+    {
+        return Base::readField<FieldIdx_utcWNT>(field);
+    }
+
+    /// @brief Decode "utcLS" field (see @ref ublox::message::AidHuiFields::utcLS).
+    comms::ErrorStatus field_utcLS(FieldType<FieldIdx_utcLS>& field) const
+    {
+        return Base::readField<FieldIdx_utcLS>(field);
+    }
+
+    /// @brief Decode "utcWNF" field (see @ref ublox::message::AidHuiFields::utcWNF).
+    comms::ErrorStatus field_utcWNF(FieldType<FieldIdx_utcWNF>& field) const
+    {
+        return Base::readField<FieldIdx_utcWNF>(field);
+    }
+
+    /// @brief Decode "utcDN" field (see @ref ublox::message::AidHuiFields::utcDN).
+    comms::ErrorStatus field_utcDN(FieldType<FieldIdx_utcDN>& field) const
+    {
+        return Base::readField<FieldIdx_utcDN>(field);
+    }
+
+    /// @brief Decode "utcLSF" field (see @ref ublox::message::AidHuiFields::utcLSF).
+    comms::ErrorStatus field_utcLSF(FieldType<FieldIdx_utcLSF>& field) const
+    {
+        return Base::readField<FieldIdx_utcLSF>(field);
+    }
+
+    /// @brief Decode "utcSpare" field (see @ref ublox::message::AidHuiFields::utcSpare).
+    comms::ErrorStatus field_utcSpare(FieldType<FieldIdx_utcSpare>& field) const
+    {
+        return Base::readField<FieldIdx_utcSpare>(field);
+    }
+
+    /// @brief Decode "klobA0" field (see @ref ublox::message::AidHuiFields::klobA0).
+    comms::ErrorStatus field_klobA0(FieldType<FieldIdx_klobA0>& field) const
+    {
+        return Base::readField<FieldIdx_klobA0>(field);
+    }
+
+    /// @brief Decode "klobA1" field (see @ref ublox::message::AidHuiFields::klobA1).
+    comms::ErrorStatus field_klobA1(FieldType<FieldIdx_klobA1>& field) const
+    {
+        return Base::readField<FieldIdx_klobA1>(field);
+    }
+
+    /// @brief Decode "klobA2" field (see @ref ublox::message::AidHuiFields::klobA2).
+    comms::ErrorStatus field_klobA2(FieldType<FieldIdx_klobA2>& field) const
+    {
+        return Base::readField<FieldIdx_klobA2>(field);
+    }
+
+    /// @brief Decode "klobA3" field (see @ref ublox::message::AidHuiFields::klobA3).
+    comms::ErrorStatus field_klobA3(FieldType<FieldIdx_klobA3>& field) const
+    {
+        return Base::readField<FieldIdx_klobA3>(field);
+    }
+
+    /// @brief Decode "klobB0" field (see @ref ublox::message::AidHuiFields::klobB0).
+    comms::ErrorStatus field_klobB0(FieldType<FieldIdx_klobB0>& field) const
+    {
+        return Base::readField<FieldIdx_klobB0>(field);
+    }
+
+    /// @brief Decode "klobB1" field (see @ref ublox::message::AidHuiFields::klobB1).
+    comms::ErrorStatus field_klobB1(FieldType<FieldIdx_klobB1>& field) const
+    {
+        return Base::readField<FieldIdx_klobB1>(field);
+    }
+
+    /// @brief Decode "klobB2" field (see @ref ublox::message::AidHuiFields::klobB2).
+    comms::ErrorStatus field_klobB2(FieldType<FieldIdx_klobB2>& field) const
+    {
+        return Base::readField<FieldIdx_klobB2>(field);
+    }
+
+    /// @brief Decode "klobB3" field (see @ref ublox::message::AidHuiFields::klobB3).
+    comms::ErrorStatus field_klobB3(FieldType<FieldIdx_klobB3>& field) const
+    {
+        return Base::readField<FieldIdx_klobB3>(field);
+    }
+
+    /// @brief Decode "flags" field (see @ref ublox::message::AidHuiFields::flags).
+    comms::ErrorStatus field_flags(FieldType<FieldIdx_flags>& field) const
+    {
+        return Base::readField<FieldIdx_flags>(field);
+    }
+};
+
+} // namespace view
+
+} // namespace ublox
+
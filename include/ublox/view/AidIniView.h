@@ -0,0 +1,96 @@
+//
+// Copyright 2018 (C). Alex Robenko. All rights reserved.
+//
+
+// This file is free software: you can redistribute it and/or modify
+// it under the terms of the GNU General Public License as published by
+// the Free Software Foundation, either version 3 of the License, or
+// (at your option) any later version.
+//
+// This program is distributed in the hope that it will be useful,
+// but WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+// GNU General Public License for more details.
+//
+// You should have received a copy of the GNU General Public License
+// along with this program.  If not, see <http://www.gnu.org/licenses/>.
+
+/// @file
+/// @brief Contains definition of lazy view of AID-INI message.
+/// @details Generated by script/gen_views.py, do NOT edit manually.
+
+#pragma once
+
+#include "ublox/message/AidIni.h"
+#include "MsgView.h"
+
+namespace ublox
+{
+
+namespace view
+{
+
+/// @brief Lazy read-only view of AID-INI message payload.
+/// @details Wraps the pointer to the validated payload, the fields are
+///     decoded on access only, see @ref MsgView.
+///     The message performs custom read of its fields, the fields starting
+///     from "ecefX" are not accessible through the view, because their
+///     presence and/or size depend on the values of preceding fields.
+/// @see @ref ublox::message::AidIni
+class AidIniView : public
+    MsgView<
+        ublox::message::AidIniFields::All
+    >
+{
+    using Base =
+        MsgView<
+            ublox::message::AidIniFields::All
+        >;
+
+public:
+    /// @brief ID of the viewed message.
+    static const MsgId MsgIdValue = MsgId_AID_INI;
+
+    /// @brief Index of the fields, same as the ones defined by
+    ///     @b COMMS_MSG_FIELDS_ACCESS() in @ref ublox::message::AidIni.
+    enum FieldIdx
+    {
+        FieldIdx_ecefX, ///< index of @b ecefX field
+        FieldIdx_lat, ///< index of @b lat field
+        FieldIdx_ecefY, ///< index of @b ecefY field
+        FieldIdx_lon, ///< index of @b lon field
+        FieldIdx_ecefZ, ///< index of @b ecefZ field
+        FieldIdx_alt, ///< index of @b alt field
+        FieldIdx_posAcc, ///< index of @b posAcc field
+        FieldIdx_tmCfg, ///< index of @b tmCfg field
+        FieldIdx_wno, ///< index of @b wno field
+        FieldIdx_date, ///< index of @b date field
+        FieldIdx_tow, ///< index of @b tow field
+        FieldIdx_time, ///< index of @b time field
+        FieldIdx_towNs, ///< index of @b towNs field
+        FieldIdx_tAccMs, ///< index of @b tAccMs field
+        FieldIdx_tAccNs, ///< index of @b tAccNs field
+        FieldIdx_clkD, ///< index of @b clkD field
+        FieldIdx_freq, ///< index of @b freq field
+        FieldIdx_clkDAcc, ///< index of @b clkDAcc field
+        FieldIdx_freqAcc, ///< index of @b freqAcc field
+        FieldIdx_flags, ///< index of @b flags field
+        FieldIdx_numOfValues ///< number of available fields
+    };
+
+    /// @brief Default constructor, creates empty view.
+    AidIniView() = default;
+
+    /// @brief Constructor
+    /// @param[in] payload Pointer to the payload of the message.
+    /// @param[in] len Length of the payload.
+    AidIniView(const std::uint8_t* payload, std::size_t len)
+      : Base(payload, len)
+    {
+    }
+};
+
+} // namespace view
+
+} // namespace ublox
+
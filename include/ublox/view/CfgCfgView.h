@@ -0,0 +1,101 @@
+//
+// Copyright 2018 (C). Alex Robenko. All rights reserved.
+//
+
+// This file is free software: you can redistribute it and/or modify
+// it under the terms of the GNU General Public License as published by
+// the Free Software Foundation, either version 3 of the License, or
+// (at your option) any later version.
+//
+// This program is distributed in the hope that it will be useful,
+// but WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+// GNU General Public License for more details.
+//
+// You should have received a copy of the GNU General Public License
+// along with this program.  If not, see <http://www.gnu.org/licenses/>.
+
+/// @file
+/// @brief Contains definition of lazy view of CFG-CFG message.
+/// @details Generated by script/gen_views.py, do NOT edit manually.
+
+#pragma once
+
+#include "ublox/message/CfgCfg.h"
+#include "MsgView.h"
+
+namespace ublox
+{
+
+namespace view
+{
+
+/// @brief Lazy read-only view of CFG-CFG message payload.
+/// @details Wraps the pointer to the validated payload, the fields are
+///     decoded on access only, see @ref MsgView.
+/// @see @ref ublox::message::CfgCfg
+class CfgCfgView : public
+    MsgView<
+        ublox::message::CfgCfgFields::All
+    >
+{
+    using Base =
+        MsgView<
+            ublox::message::CfgCfgFields::All
+        >;
+
+public:
+    /// @brief ID of the viewed message.
+    static const MsgId MsgIdValue = MsgId_CFG_CFG;
+
+    /// @brief Index of the fields, same as the ones defined by
+    ///     @b COMMS_MSG_FIELDS_ACCESS() in @ref ublox::message::CfgCfg.
+    enum FieldIdx
+    {
+        FieldIdx_clearMask, ///< index of @b clearMask field
+        FieldIdx_saveMask, ///< index of @b saveMask field
+        FieldIdx_loadMask, ///< index of @b loadMask field
+        FieldIdx_deviceMask, ///< index of @b deviceMask field
+        FieldIdx_numOfValues ///< number of available fields
+    };
+
+    /// @brief Default constructor, creates empty view.
+    CfgCfgView() = default;
+
+    /// @brief Constructor
+    /// @param[in] payload Pointer to the payload of the message.
+    /// @param[in] len Length of the payload.
+    CfgCfgView(const std::uint8_t* payload, std::size_t len)
+      : Base(payload, len)
+    {
+    }
+
+    /// @brief Decode "clearMask" field (see @ref ublox::message::CfgCfgFields::clearMask).
+    comms::ErrorStatus field_clearMask(FieldType<FieldIdx_clearMask>& field) const
+    {
+        return Base::readField<FieldIdx_clearMask>(field);
+    }
+
+    /// @brief Decode "saveMask" field (see @ref ublox::message::CfgCfgFields::saveMask).
+    comms::ErrorStatus field_saveMask(FieldType<FieldIdx_saveMask>& field) const
+    {
+        return Base::readField<FieldIdx_saveMask>(field);
+    }
+
+    /// @brief Decode "loadMask" field (see @ref ublox::message::CfgCfgFields::loadMask).
+    comms::ErrorStatus field_loadMask(FieldType<FieldIdx_loadMask>& field) const
+    {
+        return Base::readField<FieldIdx_loadMask>(field);
+    }
+
+    /// @brief Decode "deviceMask" field (see @ref ublox::message::CfgCfgFields::deviceMask).
+    comms::ErrorStatus field_deviceMask(FieldType<FieldIdx_deviceMask>& field) const
+    {
+        return Base::readField<FieldIdx_deviceMask>(field);
+    }
+};
+
+} // namespace view
+
+} // namespace ublox
+
@@ -0,0 +1,136 @@
+//
+// Copyright 2018 (C). Alex Robenko. All rights reserved.
+//
+
+// This file is free software: you can redistribute it and/or modify
+// it under the terms of the GNU General Public License as published by
+// the Free Software Foundation, either version 3 of the License, or
+// (at your option) any later version.
+//
+// This program is distributed in the hope that it will be useful,
+// but WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+// GNU General Public License for more details.
+//
+// You should have received a copy of the GNU General Public License
+// along with this program.  If not, see <http://www.gnu.org/licenses/>.
+
+/// @file
+/// @brief Contains definition of lazy view of CFG-DAT (<b>user input</b>) message.
+/// @details Generated by script/gen_views.py, do NOT edit manually.
+
+#pragma once
+
+#include "ublox/message/CfgDatUser.h"
+#include "MsgView.h"
+
+namespace ublox
+{
+
+namespace view
+{
+
+/// @brief Lazy read-only view of CFG-DAT (<b>user input</b>) message payload.
+/// @details Wraps the pointer to the validated payload, the fields are
+///     decoded on access only, see @ref MsgView.
+/// @see @ref ublox::message::CfgDatUser
+class CfgDatUserView : public
+    MsgView<
+        ublox::message::CfgDatUserFields::All
+    >
+{
+    using Base =
+        MsgView<
+            ublox::message::CfgDatUserFields::All
+        >;
+
+public:
+    /// @brief ID of the viewed message.
+    static const MsgId MsgIdValue = MsgId_CFG_DAT;
+
+    /// @brief Index of the fields, same as the ones defined by
+    ///     @b COMMS_MSG_FIELDS_ACCESS() in @ref ublox::message::CfgDatUser.
+    enum FieldIdx
+    {
+        FieldIdx_majA, ///< index of @b majA field
+        FieldIdx_flat, ///< index of @b flat field
+        FieldIdx_dX, ///< index of @b dX field
+        FieldIdx_dY, ///< index of @b dY field
+        FieldIdx_dZ, ///< index of @b dZ field
+        FieldIdx_rotX, ///< index of @b rotX field
+        FieldIdx_rotY, ///< index of @b rotY field
+        FieldIdx_rotZ, ///< index of @b rotZ field
+        FieldIdx_scale, ///< index of @b scale field
+        FieldIdx_numOfValues ///< number of available fields
+    };
+
+    /// @brief Default constructor, creates empty view.
+    CfgDatUserView() = default;
+
+    /// @brief Constructor
+    /// @param[in] payload Pointer to the payload of the message.
+    /// @param[in] len Length of the payload.
+    CfgDatUserView(const std::uint8_t* payload, std::size_t len)
+      : Base(payload, len)
+    {
+    }
+
+    /// @brief Decode "majA" field (see @ref ublox::message::CfgDatUserFields::majA).
+    comms::ErrorStatus field_majA(FieldType<FieldIdx_majA>& field) const
+    {
+        return Base::readField<FieldIdx_majA>(field);
+    }
+
+    /// @brief Decode "flat" field (see @ref ublox::message::CfgDatUserFields::flat).
+    comms::ErrorStatus field_flat(FieldType<FieldIdx_flat>& field) const
+    {
+        return Base::readField<FieldIdx_flat>(field);
+    }
+
+    /// @brief Decode "dX" field (see @ref ublox::message::CfgDatUserFields::dX).
+    comms::ErrorStatus field_dX(FieldType<FieldIdx_dX>& field) const
+    {
+        return Base::readField<FieldIdx_dX>(field);
+    }
+
+    /// @brief Decode "dY" field (see @ref ublox::message::CfgDatUserFields::dY).
+    comms::ErrorStatus field_dY(FieldType<FieldIdx_dY>& field) const
+    {
+        return Base::readField<FieldIdx_dY>(field);
+    }
+
+    /// @brief Decode "dZ" field (see @ref ublox::message::CfgDatUserFields::dZ).
+    comms::ErrorStatus field_dZ(FieldType<FieldIdx_dZ>& field) const
+    {
+        return Base::readField<FieldIdx_dZ>(field);
+    }
+
+    /// @brief Decode "rotX" field (see @ref ublox::message::CfgDatUserFields::rotX).
+    comms::ErrorStatus field_rotX(FieldType<FieldIdx_rotX>& field) const
+    {
+        return Base::readField<FieldIdx_rotX>(field);
+    }
+
+    /// @brief Decode "rotY" field (see @ref ublox::message::CfgDatUserFields::rotY).
+    comms::ErrorStatus field_rotY(FieldType<FieldIdx_rotY>& field) const
+    {
+        return Base::readField<FieldIdx_rotY>(field);
+    }
+
+    /// @brief Decode "rotZ" field (see @ref ublox::message::CfgDatUserFields::rotZ).
+    comms::ErrorStatus field_rotZ(FieldType<FieldIdx_rotZ>& field) const
+    {
+        return Base::readField<FieldIdx_rotZ>(field);
+    }
+
+    /// @brief Decode "scale" field (see @ref ublox::message::CfgDatUserFields::scale).
+    comms::ErrorStatus field_scale(FieldType<FieldIdx_scale>& field) const
+    {
+        return Base::readField<FieldIdx_scale>(field);
+    }
+};
+
+} // namespace view
+
+} // namespace ublox
+
@@ -0,0 +1,98 @@
+//
+// Copyright 2018 (C). Alex Robenko. All rights reserved.
+//
+
+// This file is free software: you can redistribute it and/or modify
+// it under the terms of the GNU General Public License as published by
+// the Free Software Foundation, either version 3 of the License, or
+// (at your option) any later version.
+//
+// This program is distributed in the hope that it will be useful,
+// but WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+// GNU General Public License for more details.
+//
+// You should have received a copy of the GNU General Public License
+// along with this program.  If not, see <http://www.gnu.org/licenses/>.
+
+/// @file
+/// @brief Contains definition of lazy view of CFG-DOSC message.
+/// @details Generated by script/gen_views.py, do NOT edit manually.
+
+#pragma once
+
+#include "ublox/message/CfgDosc.h"
+#include "MsgView.h"
+
+namespace ublox
+{
+
+namespace view
+{
+
+/// @brief Lazy read-only view of CFG-DOSC message payload.
+/// @details Wraps the pointer to the validated payload, the fields are
+///     decoded on access only, see @ref MsgView.
+///     The message performs custom read of its fields, the fields starting
+///     from "data" are not accessible through the view, because their
+///     presence and/or size depend on the values of preceding fields.
+/// @see @ref ublox::message::CfgDosc
+class CfgDoscView : public
+    MsgView<
+        ublox::message::CfgDoscFields::All<comms::option::EmptyOption>
+    >
+{
+    using Base =
+        MsgView<
+            ublox::message::CfgDoscFields::All<comms::option::EmptyOption>
+        >;
+
+public:
+    /// @brief ID of the viewed message.
+    static const MsgId MsgIdValue = MsgId_CFG_DOSC;
+
+    /// @brief Index of the fields, same as the ones defined by
+    ///     @b COMMS_MSG_FIELDS_ACCESS() in @ref ublox::message::CfgDosc.
+    enum FieldIdx
+    {
+        FieldIdx_version, ///< index of @b version field
+        FieldIdx_numOsc, ///< index of @b numOsc field
+        FieldIdx_reserved1, ///< index of @b reserved1 field
+        FieldIdx_data, ///< index of @b data field
+        FieldIdx_numOfValues ///< number of available fields
+    };
+
+    /// @brief Default constructor, creates empty view.
+    CfgDoscView() = default;
+
+    /// @brief Constructor
+    /// @param[in] payload Pointer to the payload of the message.
+    /// @param[in] len Length of the payload.
+    CfgDoscView(const std::uint8_t* payload, std::size_t len)
+      : Base(payload, len)
+    {
+    }
+
+    /// @brief Decode "version" field (see @ref ublox::message::CfgDoscFields::version).
+    comms::ErrorStatus field_version(FieldType<FieldIdx_version>& field) const
+    {
+        return Base::readField<FieldIdx_version>(field);
+    }
+
+    /// @brief Decode "numOsc" field (see @ref ublox::message::CfgDoscFields::numOsc).
+    comms::ErrorStatus field_numOsc(FieldType<FieldIdx_numOsc>& field) const
+    {
+        return Base::readField<FieldIdx_numOsc>(field);
+    }
+
+    /// @brief Decode "reserved1" field (see @ref ublox::message::CfgDoscFields::reserved1).
+    comms::ErrorStatus field_reserved1(FieldType<FieldIdx_reserved1>& field) const
+    {
+        return Base::readField<FieldIdx_reserved1>(field);
+    }
+};
+
+} // namespace view
+
+} // namespace ublox
+
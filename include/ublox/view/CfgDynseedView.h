@@ -0,0 +1,101 @@
+//
+// Copyright 2018 (C). Alex Robenko. All rights reserved.
+//
+
+// This file is free software: you can redistribute it and/or modify
+// it under the terms of the GNU General Public License as published by
+// the Free Software Foundation, either version 3 of the License, or
+// (at your option) any later version.
+//
+// This program is distributed in the hope that it will be useful,
+// but WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+// GNU General Public License for more details.
+//
+// You should have received a copy of the GNU General Public License
+// along with this program.  If not, see <http://www.gnu.org/licenses/>.
+
+/// @file
+/// @brief Contains definition of lazy view of CFG-DYNSEED message.
+/// @details Generated by script/gen_views.py, do NOT edit manually.
+
+#pragma once
+
+#include "ublox/message/CfgDynseed.h"
+#include "MsgView.h"
+
+namespace ublox
+{
+
+namespace view
+{
+
+/// @brief Lazy read-only view of CFG-DYNSEED message payload.
+/// @details Wraps the pointer to the validated payload, the fields are
+///     decoded on access only, see @ref MsgView.
+/// @see @ref ublox::message::CfgDynseed
+class CfgDynseedView : public
+    MsgView<
+        ublox::message::CfgDynseedFields::All
+    >
+{
+    using Base =
+        MsgView<
+            ublox::message::CfgDynseedFields::All
+        >;
+
+public:
+    /// @brief ID of the viewed message.
+    static const MsgId MsgIdValue = MsgId_CFG_DYNSEED;
+
+    /// @brief Index of the fields, same as the ones defined by
+    ///     @b COMMS_MSG_FIELDS_ACCESS() in @ref ublox::message::CfgDynseed.
+    enum FieldIdx
+    {
+        FieldIdx_version, ///< index of @b version field
+        FieldIdx_reserved1, ///< index of @b reserved1 field
+        FieldIdx_seedHi, ///< index of @b seedHi field
+        FieldIdx_seedLo, ///< index of @b seedLo field
+        FieldIdx_numOfValues ///< number of available fields
+    };
+
+    /// @brief Default constructor, creates empty view.
+    CfgDynseedView() = default;
+
+    /// @brief Constructor
+    /// @param[in] payload Pointer to the payload of the message.
+    /// @param[in] len Length of the payload.
+    CfgDynseedView(const std::uint8_t* payload, std::size_t len)
+      : Base(payload, len)
+    {
+    }
+
+    /// @brief Decode "version" field (see @ref ublox::message::CfgDynseedFields::version).
+    comms::ErrorStatus field_version(FieldType<FieldIdx_version>& field) const
+    {
+        return Base::readField<FieldIdx_version>(field);
+    }
+
+    /// @brief Decode "reserved1" field (see @ref ublox::message::CfgDynseedFields::reserved1).
+    comms::ErrorStatus field_reserved1(FieldType<FieldIdx_reserved1>& field) const
+    {
+        return Base::readField<FieldIdx_reserved1>(field);
+    }
+
+    /// @brief Decode "seedHi" field (see @ref ublox::message::CfgDynseedFields::seedHi).
+    comms::ErrorStatus field_seedHi(FieldType<FieldIdx_seedHi>& field) const
+    {
+        return Base::readField<FieldIdx_seedHi>(field);
+    }
+
+    /// @brief Decode "seedLo" field (see @ref ublox::message::CfgDynseedFields::seedLo).
+    comms::ErrorStatus field_seedLo(FieldType<FieldIdx_seedLo>& field) const
+    {
+        return Base::readField<FieldIdx_seedLo>(field);
+    }
+};
+
+} // namespace view
+
+} // namespace ublox
+
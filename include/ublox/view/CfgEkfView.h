@@ -0,0 +1,143 @@
+//
+// Copyright 2018 (C). Alex Robenko. All rights reserved.
+//
+
+// This file is free software: you can redistribute it and/or modify
+// it under the terms of the GNU General Public License as published by
+// the Free Software Foundation, either version 3 of the License, or
+// (at your option) any later version.
+//
+// This program is distributed in the hope that it will be useful,
+// but WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+// GNU General Public License for more details.
+//
+// You should have received a copy of the GNU General Public License
+// along with this program.  If not, see <http://www.gnu.org/licenses/>.
+
+/// @file
+/// @brief Contains definition of lazy view of CFG-EKF message.
+/// @details Generated by script/gen_views.py, do NOT edit manually.
+
+#pragma once
+
+#include "ublox/message/CfgEkf.h"
+#include "MsgView.h"
+
+namespace ublox
+{
+
+namespace view
+{
+
+/// @brief Lazy read-only view of CFG-EKF message payload.
+/// @details Wraps the pointer to the validated payload, the fields are
+///     decoded on access only, see @ref MsgView.
+/// @see @ref ublox::message::CfgEkf
+class CfgEkfView : public
+    MsgView<
+        ublox::message::CfgEkfFields::All
+    >
+{
+    using Base =
+        MsgView<
+            ublox::message::CfgEkfFields::All
+        >;
+
+public:
+    /// @brief ID of the viewed message.
+    static const MsgId MsgIdValue = MsgId_CFG_EKF;
+
+    /// @brief Index of the fields, same as the ones defined by
+    ///     @b COMMS_MSG_FIELDS_ACCESS() in @ref ublox::message::CfgEkf.
+    enum FieldIdx
+    {
+        FieldIdx_disableEkf, ///< index of @b disableEkf field
+        FieldIdx_actionFlags, ///< index of @b actionFlags field
+        FieldIdx_configFlags, ///< index of @b configFlags field
+        FieldIdx_inverseFlags, ///< index of @b inverseFlags field
+        FieldIdx_reserved2, ///< index of @b reserved2 field
+        FieldIdx_nomPPDist, ///< index of @b nomPPDist field
+        FieldIdx_nomZero, ///< index of @b nomZero field
+        FieldIdx_nomSens, ///< index of @b nomSens field
+        FieldIdx_rmsTemp, ///< index of @b rmsTemp field
+        FieldIdx_tempUpdate, ///< index of @b tempUpdate field
+        FieldIdx_numOfValues ///< number of available fields
+    };
+
+    /// @brief Default constructor, creates empty view.
+    CfgEkfView() = default;
+
+    /// @brief Constructor
+    /// @param[in] payload Pointer to the payload of the message.
+    /// @param[in] len Length of the payload.
+    CfgEkfView(const std::uint8_t* payload, std::size_t len)
+      : Base(payload, len)
+    {
+    }
+
+    /// @brief Decode "disableEkf" field (see @ref ublox::message::CfgEkfFields::disableEkf).
+    comms::ErrorStatus field_disableEkf(FieldType<FieldIdx_disableEkf>& field) const
+    {
+        return Base::readField<FieldIdx_disableEkf>(field);
+    }
+
+    /// @brief Decode "actionFlags" field (see @ref ublox::message::CfgEkfFields::actionFlags).
+    comms::ErrorStatus field_actionFlags(FieldType<FieldIdx_actionFlags>& field) const
+    {
+        return Base::readField<FieldIdx_actionFlags>(field);
+    }
+
+    /// @brief Decode "configFlags" field (see @ref ublox::message::CfgEkfFields::configFlags).
+    comms::ErrorStatus field_configFlags(FieldType<FieldIdx_configFlags>& field) const
+    {
+        return Base::readField<FieldIdx_configFlags>(field);
+    }
+
+    /// @brief Decode "inverseFlags" field (see @ref ublox::message::CfgEkfFields::inverseFlags).
+    comms::ErrorStatus field_inverseFlags(FieldType<FieldIdx_inverseFlags>& field) const
+    {
+        return Base::readField<FieldIdx_inverseFlags>(field);
+    }
+
+    /// @brief Decode "reserved2" field (see @ref ublox::message::CfgEkfFields::reserved2).
+    comms::ErrorStatus field_reserved2(FieldType<FieldIdx_reserved2>& field) const
+    {
+        return Base::readField<FieldIdx_reserved2>(field);
+    }
+
+    /// @brief Decode "nomPPDist" field (see @ref ublox::message::CfgEkfFields::nomPPDist).
+    comms::ErrorStatus field_nomPPDist(FieldType<FieldIdx_nomPPDist>& field) const
+    {
+        return Base::readField<FieldIdx_nomPPDist>(field);
+    }
+
+    /// @brief Decode "nomZero" field (see @ref ublox::message::CfgEkfFields::nomZero).
+    comms::ErrorStatus field_nomZero(FieldType<FieldIdx_nomZero>& field) const
+    {
+        return Base::readField<FieldIdx_nomZero>(field);
+    }
+
+    /// @brief Decode "nomSens" field (see @ref ublox::message::CfgEkfFields::nomSens).
+    comms::ErrorStatus field_nomSens(FieldType<FieldIdx_nomSens>& field) const
+    {
+        return Base::readField<FieldIdx_nomSens>(field);
+    }
+
+    /// @brief Decode "rmsTemp" field (see @ref ublox::message::CfgEkfFields::rmsTemp).
+    comms::ErrorStatus field_rmsTemp(FieldType<FieldIdx_rmsTemp>& field) const
+    {
+        return Base::readField<FieldIdx_rmsTemp>(field);
+    }
+
+    /// @brief Decode "tempUpdate" field (see @ref ublox::message::CfgEkfFields::tempUpdate).
+    comms::ErrorStatus field_tempUpdate(FieldType<FieldIdx_tempUpdate>& field) const
+    {
+        return Base::readField<FieldIdx_tempUpdate>(field);
+    }
+};
+
+} // namespace view
+
+} // namespace ublox
+
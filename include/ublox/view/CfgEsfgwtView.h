@@ -0,0 +1,178 @@
+//
+// Copyright 2018 (C). Alex Robenko. All rights reserved.
+//
+
+// This file is free software: you can redistribute it and/or modify
+// it under the terms of the GNU General Public License as published by
+// the Free Software Foundation, either version 3 of the License, or
+// (at your option) any later version.
+//
+// This program is distributed in the hope that it will be useful,
+// but WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+// GNU General Public License for more details.
+//
+// You should have received a copy of the GNU General Public License
+// along with this program.  If not, see <http://www.gnu.org/licenses/>.
+
+/// @file
+/// @brief Contains definition of lazy view of CFG-ESFGWT message.
+/// @details Generated by script/gen_views.py, do NOT edit manually.
+
+#pragma once
+
+#include "ublox/message/CfgEsfgwt.h"
+#include "MsgView.h"
+
+namespace ublox
+{
+
+namespace view
+{
+
+/// @brief Lazy read-only view of CFG-ESFGWT message payload.
+/// @details Wraps the pointer to the validated payload, the fields are
+///     decoded on access only, see @ref MsgView.
+/// @see @ref ublox::message::CfgEsfgwt
+class CfgEsfgwtView : public
+    MsgView<
+        ublox::message::CfgEsfgwtFields::All
+    >
+{
+    using Base =
+        MsgView<
+            ublox::message::CfgEsfgwtFields::All
+        >;
+
+public:
+    /// @brief ID of the viewed message.
+    static const MsgId MsgIdValue = MsgId_CFG_ESFGWT;
+
+    /// @brief Index of the fields, same as the ones defined by
+    ///     @b COMMS_MSG_FIELDS_ACCESS() in @ref ublox::message::CfgEsfgwt.
+    enum FieldIdx
+    {
+        FieldIdx_flags, ///< index of @b flags field
+        FieldIdx_id, ///< index of @b id field
+        FieldIdx_wtFactor, ///< index of @b wtFactor field
+        FieldIdx_reserved1, ///< index of @b reserved1 field
+        FieldIdx_wtQuantError, ///< index of @b wtQuantError field
+        FieldIdx_timeTagFactor, ///< index of @b timeTagFactor field
+        FieldIdx_wtCountMax, ///< index of @b wtCountMax field
+        FieldIdx_timeTagMax, ///< index of @b timeTagMax field
+        FieldIdx_wtLatency, ///< index of @b wtLatency field
+        FieldIdx_reserved2, ///< index of @b reserved2 field
+        FieldIdx_wtFrequency, ///< index of @b wtFrequency field
+        FieldIdx_reserved3, ///< index of @b reserved3 field
+        FieldIdx_speedDeadBand, ///< index of @b speedDeadBand field
+        FieldIdx_reserved4, ///< index of @b reserved4 field
+        FieldIdx_reserved5, ///< index of @b reserved5 field
+        FieldIdx_numOfValues ///< number of available fields
+    };
+
+    /// @brief Default constructor, creates empty view.
+    CfgEsfgwtView() = default;
+
+    /// @brief Constructor
+    /// @param[in] payload Pointer to the payload of the message.
+    /// @param[in] len Length of the payload.
+    CfgEsfgwtView(const std::uint8_t* payload, std::size_t len)
+      : Base(payload, len)
+    {
+    }
+
+    /// @brief Decode "flags" field (see @ref ublox::message::CfgEsfgwtFields::flags).
+    comms::ErrorStatus field_flags(FieldType<FieldIdx_flags>& field) const
+    {
+        return Base::readField<FieldIdx_flags>(field);
+    }
+
+    /// @brief Decode "id" field (see @ref ublox::message::CfgEsfgwtFields::id).
+    comms::ErrorStatus field_id(FieldType<FieldIdx_id>& field) const
+    {
+        return Base::readField<FieldIdx_id>(field);
+    }
+
+    /// @brief Decode "wtFactor" field (see @ref ublox::message::CfgEsfgwtFields::wtFactor).
+    comms::ErrorStatus field_wtFactor(FieldType<FieldIdx_wtFactor>& field) const
+    {
+        return Base::readField<FieldIdx_wtFactor>(field);
+    }
+
+    /// @brief Decode "reserved1" field (see @ref ublox::message::CfgEsfgwtFields::reserved1).
+    comms::ErrorStatus field_reserved1(FieldType<FieldIdx_reserved1>& field) const
+    {
+        return Base::readField<FieldIdx_reserved1>(field);
+    }
+
+    /// @brief Decode "wtQuantError" field (see @ref ublox::message::CfgEsfgwtFields::wtQuantError).
+    comms::ErrorStatus field_wtQuantError(FieldType<FieldIdx_wtQuantError>& field) const
+    {
+        return Base::readField<FieldIdx_wtQuantError>(field);
+    }
+
+    /// @brief Decode "timeTagFactor" field (see @ref ublox::message::CfgEsfgwtFields::timeTagFactor).
+    comms::ErrorStatus field_timeTagFactor(FieldType<FieldIdx_timeTagFactor>& field) const
+    {
+        return Base::readField<FieldIdx_timeTagFactor>(field);
+    }
+
+    /// @brief Decode "wtCountMax" field (see @ref ublox::message::CfgEsfgwtFields::wtCountMax).
+    comms::ErrorStatus field_wtCountMax(FieldType<FieldIdx_wtCountMax>& field) const
+    {
+        return Base::readField<FieldIdx_wtCountMax>(field);
+    }
+
+    /// @brief Decode "timeTagMax" field (see @ref ublox::message::CfgEsfgwtFields::timeTagMax).
+    comms::ErrorStatus field_timeTagMax(FieldType<FieldIdx_timeTagMax>& field) const
+    {
+        return Base::readField<FieldIdx_timeTagMax>(field);
+    }
+
+    /// @brief Decode "wtLatency" field (see @ref ublox::message::CfgEsfgwtFields::wtLatency).
+    comms::ErrorStatus field_wtLatency(FieldType<FieldIdx_wtLatency>& field) const
+    {
+        return Base::readField<FieldIdx_wtLatency>(field);
+    }
+
+    /// @brief Decode "reserved2" field (see @ref ublox::message::CfgEsfgwtFields::reserved2).
+    comms::ErrorStatus field_reserved2(FieldType<FieldIdx_reserved2>& field) const
+    {
+        return Base::readField<FieldIdx_reserved2>(field);
+    }
+
+    /// @brief Decode "wtFrequency" field (see @ref ublox::message::CfgEsfgwtFields::wtFrequency).
+    comms::ErrorStatus field_wtFrequency(FieldType<FieldIdx_wtFrequency>& field) const
+    {
+        return Base::readField<FieldIdx_wtFrequency>(field);
+    }
+
+    /// @brief Decode "reserved3" field (see @ref ublox::message::CfgEsfgwtFields::reserved3).
+    comms::ErrorStatus field_reserved3(FieldType<FieldIdx_reserved3>& field) const
+    {
+        return Base::readField<FieldIdx_reserved3>(field);
+    }
+
+    /// @brief Decode "speedDeadBand" field (see @ref ublox::message::CfgEsfgwtFields::speedDeadBand).
+    comms::ErrorStatus field_speedDeadBand(FieldType<FieldIdx_speedDeadBand>& field) const
+    {
+        return Base::readField<FieldIdx_speedDeadBand>(field);
+    }
+
+    /// @brief Decode "reserved4" field (see @ref ublox::message::CfgEsfgwtFields::reserved4).
+    comms::ErrorStatus field_reserved4(FieldType<FieldIdx_reserved4>& field) const
+    {
+        return Base::readField<FieldIdx_reserved4>(field);
+    }
+
+    /// @brief Decode "reserved5" field (see @ref ublox::message::CfgEsfgwtFields::reserved5).
+    comms::ErrorStatus field_reserved5(FieldType<FieldIdx_reserved5>& field) const
+    {
+        return Base::readField<FieldIdx_reserved5>(field);
+    }
+};
+
+} // namespace view
+
+} // namespace ublox
+
@@ -0,0 +1,136 @@
+//
+// Copyright 2018 (C). Alex Robenko. All rights reserved.
+//
+
+// This file is free software: you can redistribute it and/or modify
+// it under the terms of the GNU General Public License as published by
+// the Free Software Foundation, either version 3 of the License, or
+// (at your option) any later version.
+//
+// This program is distributed in the hope that it will be useful,
+// but WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+// GNU General Public License for more details.
+//
+// You should have received a copy of the GNU General Public License
+// along with this program.  If not, see <http://www.gnu.org/licenses/>.
+
+/// @file
+/// @brief Contains definition of lazy view of CFG-FXN message.
+/// @details Generated by script/gen_views.py, do NOT edit manually.
+
+#pragma once
+
+#include "ublox/message/CfgFxn.h"
+#include "MsgView.h"
+
+namespace ublox
+{
+
+namespace view
+{
+
+/// @brief Lazy read-only view of CFG-FXN message payload.
+/// @details Wraps the pointer to the validated payload, the fields are
+///     decoded on access only, see @ref MsgView.
+/// @see @ref ublox::message::CfgFxn
+class CfgFxnView : public
+    MsgView<
+        ublox::message::CfgFxnFields::All
+    >
+{
+    using Base =
+        MsgView<
+            ublox::message::CfgFxnFields::All
+        >;
+
+public:
+    /// @brief ID of the viewed message.
+    static const MsgId MsgIdValue = MsgId_CFG_FXN;
+
+    /// @brief Index of the fields, same as the ones defined by
+    ///     @b COMMS_MSG_FIELDS_ACCESS() in @ref ublox::message::CfgFxn.
+    enum FieldIdx
+    {
+        FieldIdx_flags, ///< index of @b flags field
+        FieldIdx_tReacq, ///< index of @b tReacq field
+        FieldIdx_tAcq, ///< index of @b tAcq field
+        FieldIdx_tReacqOff, ///< index of @b tReacqOff field
+        FieldIdx_tAcqOff, ///< index of @b tAcqOff field
+        FieldIdx_tOn, ///< index of @b tOn field
+        FieldIdx_tOff, ///< index of @b tOff field
+        FieldIdx_res, ///< index of @b res field
+        FieldIdx_baseTow, ///< index of @b baseTow field
+        FieldIdx_numOfValues ///< number of available fields
+    };
+
+    /// @brief Default constructor, creates empty view.
+    CfgFxnView() = default;
+
+    /// @brief Constructor
+    /// @param[in] payload Pointer to the payload of the message.
+    /// @param[in] len Length of the payload.
+    CfgFxnView(const std::uint8_t* payload, std::size_t len)
+      : Base(payload, len)
+    {
+    }
+
+    /// @brief Decode "flags" field (see @ref ublox::message::CfgFxnFields::flags).
+    comms::ErrorStatus field_flags(FieldType<FieldIdx_flags>& field) const
+    {
+        return Base::readField<FieldIdx_flags>(field);
+    }
+
+    /// @brief Decode "tReacq" field (see @ref ublox::message::CfgFxnFields::tReacq).
+    comms::ErrorStatus field_tReacq(FieldType<FieldIdx_tReacq>& field) const
+    {
+        return Base::readField<FieldIdx_tReacq>(field);
+    }
+
+    /// @brief Decode "tAcq" field (see @ref ublox::message::CfgFxnFields::tAcq).
+    comms::ErrorStatus field_tAcq(FieldType<FieldIdx_tAcq>& field) const
+    {
+        return Base::readField<FieldIdx_tAcq>(field);
+    }
+
+    /// @brief Decode "tReacqOff" field (see @ref ublox::message::CfgFxnFields::tReacqOff).
+    comms::ErrorStatus field_tReacqOff(FieldType<FieldIdx_tReacqOff>& field) const
+    {
+        return Base::readField<FieldIdx_tReacqOff>(field);
+    }
+
+    /// @brief Decode "tAcqOff" field (see @ref ublox::message::CfgFxnFields::tAcqOff).
+    comms::ErrorStatus field_tAcqOff(FieldType<FieldIdx_tAcqOff>& field) const
+    {
+        return Base::readField<FieldIdx_tAcqOff>(field);
+    }
+
+    /// @brief Decode "tOn" field (see @ref ublox::message::CfgFxnFields::tOn).
+    comms::ErrorStatus field_tOn(FieldType<FieldIdx_tOn>& field) const
+    {
+        return Base::readField<FieldIdx_tOn>(field);
+    }
+
+    /// @brief Decode "tOff" field (see @ref ublox::message::CfgFxnFields::tOff).
+    comms::ErrorStatus field_tOff(FieldType<FieldIdx_tOff>& field) const
+    {
+        return Base::readField<FieldIdx_tOff>(field);
+    }
+
+    /// @brief Decode "res" field (see @ref ublox::message::CfgFxnFields::res).
+    comms::ErrorStatus field_res(FieldType<FieldIdx_res>& field) const
+    {
+        return Base::readField<FieldIdx_res>(field);
+    }
+
+    /// @brief Decode "baseTow" field (see @ref ublox::message::CfgFxnFields::baseTow).
+    comms::ErrorStatus field_baseTow(FieldType<FieldIdx_baseTow>& field) const
+    {
+        return Base::readField<FieldIdx_baseTow>(field);
+    }
+};
+
+} // namespace view
+
+} // namespace ublox
+
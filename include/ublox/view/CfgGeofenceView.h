@@ -0,0 +1,133 @@
+//
+// Copyright 2018 (C). Alex Robenko. All rights reserved.
+//
+
+// This file is free software: you can redistribute it and/or modify
+// it under the terms of the GNU General Public License as published by
+// the Free Software Foundation, either version 3 of the License, or
+// (at your option) any later version.
+//
+// This program is distributed in the hope that it will be useful,
+// but WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+// GNU General Public License for more details.
+//
+// You should have received a copy of the GNU General Public License
+// along with this program.  If not, see <http://www.gnu.org/licenses/>.
+
+/// @file
+/// @brief Contains definition of lazy view of CFG-GEOFENCE message.
+/// @details Generated by script/gen_views.py, do NOT edit manually.
+
+#pragma once
+
+#include "ublox/message/CfgGeofence.h"
+#include "MsgView.h"
+
+namespace ublox
+{
+
+namespace view
+{
+
+/// @brief Lazy read-only view of CFG-GEOFENCE message payload.
+/// @details Wraps the pointer to the validated payload, the fields are
+///     decoded on access only, see @ref MsgView.
+///     The message performs custom read of its fields, the fields starting
+///     from "data" are not accessible through the view, because their
+///     presence and/or size depend on the values of preceding fields.
+/// @see @ref ublox::message::CfgGeofence
+class CfgGeofenceView : public
+    MsgView<
+        ublox::message::CfgGeofenceFields::All<comms::option::EmptyOption>
+    >
+{
+    using Base =
+        MsgView<
+            ublox::message::CfgGeofenceFields::All<comms::option::EmptyOption>
+        >;
+
+public:
+    /// @brief ID of the viewed message.
+    static const MsgId MsgIdValue = MsgId_CFG_GEOFENCE;
+
+    /// @brief Index of the fields, same as the ones defined by
+    ///     @b COMMS_MSG_FIELDS_ACCESS() in @ref ublox::message::CfgGeofence.
+    enum FieldIdx
+    {
+        FieldIdx_version, ///< index of @b version field
+        FieldIdx_numFences, ///< index of @b numFences field
+        FieldIdx_confLvl, ///< index of @b confLvl field
+        FieldIdx_reserved1, ///< index of @b reserved1 field
+        FieldIdx_pioEnabled, ///< index of @b pioEnabled field
+        FieldIdx_pioPolarity, ///< index of @b pioPolarity field
+        FieldIdx_pin, ///< index of @b pin field
+        FieldIdx_reserved2, ///< index of @b reserved2 field
+        FieldIdx_data, ///< index of @b data field
+        FieldIdx_numOfValues ///< number of available fields
+    };
+
+    /// @brief Default constructor, creates empty view.
+    CfgGeofenceView() = default;
+
+    /// @brief Constructor
+    /// @param[in] payload Pointer to the payload of the message.
+    /// @param[in] len Length of the payload.
+    CfgGeofenceView(const std::uint8_t* payload, std::size_t len)
+      : Base(payload, len)
+    {
+    }
+
+    /// @brief Decode "version" field (see @ref ublox::message::CfgGeofenceFields::version).
+    comms::ErrorStatus field_version(FieldType<FieldIdx_version>& field) const
+    {
+        return Base::readField<FieldIdx_version>(field);
+    }
+
+    /// @brief Decode "numFences" field (see @ref ublox::message::CfgGeofenceFields::numFences).
+    comms::ErrorStatus field_numFences(FieldType<FieldIdx_numFences>& field) const
+    {
+        return Base::readField<FieldIdx_numFences>(field);
+    }
+
+    /// @brief Decode "confLvl" field (see @ref ublox::message::CfgGeofenceFields::confLvl).
+    comms::ErrorStatus field_confLvl(FieldType<FieldIdx_confLvl>& field) const
+    {
+        return Base::readField<FieldIdx_confLvl>(field);
+    }
+
+    /// @brief Decode "reserved1" field (see @ref ublox::message::CfgGeofenceFields::reserved1).
+    comms::ErrorStatus field_reserved1(FieldType<FieldIdx_reserved1>& field) const
+    {
+        return Base::readField<FieldIdx_reserved1>(field);
+    }
+
+    /// @brief Decode "pioEnabled" field (see @ref ublox::message::CfgGeofenceFields::pioEnabled).
+    comms::ErrorStatus field_pioEnabled(FieldType<FieldIdx_pioEnabled>& field) const
+    {
+        return Base::readField<FieldIdx_pioEnabled>(field);
+    }
+
+    /// @brief Decode "pioPolarity" field (see @ref ublox::message::CfgGeofenceFields::pioPolarity).
+    comms::ErrorStatus field_pioPolarity(FieldType<FieldIdx_pioPolarity>& field) const
+    {
+        return Base::readField<FieldIdx_pioPolarity>(field);
+    }
+
+    /// @brief Decode "pin" field (see @ref ublox::message::CfgGeofenceFields::pin).
+    comms::ErrorStatus field_pin(FieldType<FieldIdx_pin>& field) const
+    {
+        return Base::readField<FieldIdx_pin>(field);
+    }
+
+    /// @brief Decode "reserved2" field (see @ref ublox::message::CfgGeofenceFields::reserved2).
+    comms::ErrorStatus field_reserved2(FieldType<FieldIdx_reserved2>& field) const
+    {
+        return Base::readField<FieldIdx_reserved2>(field);
+    }
+};
+
+} // namespace view
+
+} // namespace ublox
+
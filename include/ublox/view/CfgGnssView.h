@@ -0,0 +1,105 @@
+//
+// Copyright 2018 (C). Alex Robenko. All rights reserved.
+//
+
+// This file is free software: you can redistribute it and/or modify
+// it under the terms of the GNU General Public License as published by
+// the Free Software Foundation, either version 3 of the License, or
+// (at your option) any later version.
+//
+// This program is distributed in the hope that it will be useful,
+// but WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+// GNU General Public License for more details.
+//
+// You should have received a copy of the GNU General Public License
+// along with this program.  If not, see <http://www.gnu.org/licenses/>.
+
+/// @file
+/// @brief Contains definition of lazy view of CFG-GNSS message.
+/// @details Generated by script/gen_views.py, do NOT edit manually.
+
+#pragma once
+
+#include "ublox/message/CfgGnss.h"
+#include "MsgView.h"
+
+namespace ublox
+{
+
+namespace view
+{
+
+/// @brief Lazy read-only view of CFG-GNSS message payload.
+/// @details Wraps the pointer to the validated payload, the fields are
+///     decoded on access only, see @ref MsgView.
+///     The message performs custom read of its fields, the fields starting
+///     from "blocksList" are not accessible through the view, because their
+///     presence and/or size depend on the values of preceding fields.
+/// @see @ref ublox::message::CfgGnss
+class CfgGnssView : public
+    MsgView<
+        ublox::message::CfgGnssFields::All<comms::option::EmptyOption>
+    >
+{
+    using Base =
+        MsgView<
+            ublox::message::CfgGnssFields::All<comms::option::EmptyOption>
+        >;
+
+public:
+    /// @brief ID of the viewed message.
+    static const MsgId MsgIdValue = MsgId_CFG_GNSS;
+
+    /// @brief Index of the fields, same as the ones defined by
+    ///     @b COMMS_MSG_FIELDS_ACCESS() in @ref ublox::message::CfgGnss.
+    enum FieldIdx
+    {
+        FieldIdx_msgVer, ///< index of @b msgVer field
+        FieldIdx_numTrkChHw, ///< index of @b numTrkChHw field
+        FieldIdx_numTrkChUse, ///< index of @b numTrkChUse field
+        FieldIdx_numConfigBlocks, ///< index of @b numConfigBlocks field
+        FieldIdx_blocksList, ///< index of @b blocksList field
+        FieldIdx_numOfValues ///< number of available fields
+    };
+
+    /// @brief Default constructor, creates empty view.
+    CfgGnssView() = default;
+
+    /// @brief Constructor
+    /// @param[in] payload Pointer to the payload of the message.
+    /// @param[in] len Length of the payload.
+    CfgGnssView(const std::uint8_t* payload, std::size_t len)
+      : Base(payload, len)
+    {
+    }
+
+    /// @brief Decode "msgVer" field (see @ref ublox::message::CfgGnssFields::msgVer).
+    comms::ErrorStatus field_msgVer(FieldType<FieldIdx_msgVer>& field) const
+    {
+        return Base::readField<FieldIdx_msgVer>(field);
+    }
+
+    /// @brief Decode "numTrkChHw" field (see @ref ublox::message::CfgGnssFields::numTrkChHw).
+    comms::ErrorStatus field_numTrkChHw(FieldType<FieldIdx_numTrkChHw>& field) const
+    {
+        return Base::readField<FieldIdx_numTrkChHw>(field);
+    }
+
+    /// @brief Decode "numTrkChUse" field (see @ref ublox::message::CfgGnssFields::numTrkChUse).
+    comms::ErrorStatus field_numTrkChUse(FieldType<FieldIdx_numTrkChUse>& field) const
+    {
+        return Base::readField<FieldIdx_numTrkChUse>(field);
+    }
+
+    /// @brief Decode "numConfigBlocks" field (see @ref ublox::message::CfgGnssFields::numConfigBlocks).
+    comms::ErrorStatus field_numConfigBlocks(FieldType<FieldIdx_numConfigBlocks>& field) const
+    {
+        return Base::readField<FieldIdx_numConfigBlocks>(field);
+    }
+};
+
+} // namespace view
+
+} // namespace ublox
+
@@ -0,0 +1,115 @@
+//
+// Copyright 2018 (C). Alex Robenko. All rights reserved.
+//
+
+// This file is free software: you can redistribute it and/or modify
+// it under the terms of the GNU General Public License as published by
+// the Free Software Foundation, either version 3 of the License, or
+// (at your option) any later version.
+//
+// This program is distributed in the hope that it will be useful,
+// but WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+// GNU General Public License for more details.
+//
+// You should have received a copy of the GNU General Public License
+// along with this program.  If not, see <http://www.gnu.org/licenses/>.
+
+/// @file
+/// @brief Contains definition of lazy view of CFG-LOGFILTER message.
+/// @details Generated by script/gen_views.py, do NOT edit manually.
+
+#pragma once
+
+#include "ublox/message/CfgLogfilter.h"
+#include "MsgView.h"
+
+namespace ublox
+{
+
+namespace view
+{
+
+/// @brief Lazy read-only view of CFG-LOGFILTER message payload.
+/// @details Wraps the pointer to the validated payload, the fields are
+///     decoded on access only, see @ref MsgView.
+/// @see @ref ublox::message::CfgLogfilter
+class CfgLogfilterView : public
+    MsgView<
+        ublox::message::CfgLogfilterFields::All
+    >
+{
+    using Base =
+        MsgView<
+            ublox::message::CfgLogfilterFields::All
+        >;
+
+public:
+    /// @brief ID of the viewed message.
+    static const MsgId MsgIdValue = MsgId_CFG_LOGFILTER;
+
+    /// @brief Index of the fields, same as the ones defined by
+    ///     @b COMMS_MSG_FIELDS_ACCESS() in @ref ublox::message::CfgLogfilter.
+    enum FieldIdx
+    {
+        FieldIdx_version, ///< index of @b version field
+        FieldIdx_flags, ///< index of @b flags field
+        FieldIdx_minInterval, ///< index of @b minInterval field
+        FieldIdx_timeThreshold, ///< index of @b timeThreshold field
+        FieldIdx_speedThreshold, ///< index of @b speedThreshold field
+        FieldIdx_positionThreshold, ///< index of @b positionThreshold field
+        FieldIdx_numOfValues ///< number of available fields
+    };
+
+    /// @brief Default constructor, creates empty view.
+    CfgLogfilterView() = default;
+
+    /// @brief Constructor
+    /// @param[in] payload Pointer to the payload of the message.
+    /// @param[in] len Length of the payload.
+    CfgLogfilterView(const std::uint8_t* payload, std::size_t len)
+      : Base(payload, len)
+    {
+    }
+
+    /// @brief Decode "version" field (see @ref ublox::message::CfgLogfilterFields::version).
+    comms::ErrorStatus field_version(FieldType<FieldIdx_version>& field) const
+    {
+        return Base::readField<FieldIdx_version>(field);
+    }
+
+    /// @brief Decode "flags" field (see @ref ublox::message::CfgLogfilterFields::flags).
+    comms::ErrorStatus field_flags(FieldType<FieldIdx_flags>& field) const
+    {
+        return Base::readField<FieldIdx_flags>(field);
+    }
+
+    /// @brief Decode "minInterval" field (see @ref ublox::message::CfgLogfilterFields::minInterval).
+    comms::ErrorStatus field_minInterval(FieldType<FieldIdx_minInterval>& field) const
+    {
+        return Base::readField<FieldIdx_minInterval>(field);
+    }
+
+    /// @brief Decode "timeThreshold" field (see @ref ublox::message::CfgLogfilterFields::timeThreshold).
+    comms::ErrorStatus field_timeThreshold(FieldType<FieldIdx_timeThreshold>& field) const
+    {
+        return Base::readField<FieldIdx_timeThreshold>(field);
+    }
+
+    /// @brief Decode "speedThreshold" field (see @ref ublox::message::CfgLogfilterFields::speedThreshold).
+    comms::ErrorStatus field_speedThreshold(FieldType<FieldIdx_speedThreshold>& field) const
+    {
+        return Base::readField<FieldIdx_speedThreshold>(field);
+    }
+
+    /// @brief Decode "positionThreshold" field (see @ref ublox::message::CfgLogfilterFields::positionThreshold).
+    comms::ErrorStatus field_positionThreshold(FieldType<FieldIdx_positionThreshold>& field) const
+    {
+        return Base::readField<FieldIdx_positionThreshold>(field);
+    }
+};
+
+} // namespace view
+
+} // namespace ublox
+
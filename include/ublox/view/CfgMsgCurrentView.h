@@ -0,0 +1,87 @@
+//
+// Copyright 2018 (C). Alex Robenko. All rights reserved.
+//
+
+// This file is free software: you can redistribute it and/or modify
+// it under the terms of the GNU General Public License as published by
+// the Free Software Foundation, either version 3 of the License, or
+// (at your option) any later version.
+//
+// This program is distributed in the hope that it will be useful,
+// but WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+// GNU General Public License for more details.
+//
+// You should have received a copy of the GNU General Public License
+// along with this program.  If not, see <http://www.gnu.org/licenses/>.
+
+/// @file
+/// @brief Contains definition of lazy view of CFG-MSG (<b>current port</b>) message.
+/// @details Generated by script/gen_views.py, do NOT edit manually.
+
+#pragma once
+
+#include "ublox/message/CfgMsgCurrent.h"
+#include "MsgView.h"
+
+namespace ublox
+{
+
+namespace view
+{
+
+/// @brief Lazy read-only view of CFG-MSG (<b>current port</b>) message payload.
+/// @details Wraps the pointer to the validated payload, the fields are
+///     decoded on access only, see @ref MsgView.
+/// @see @ref ublox::message::CfgMsgCurrent
+class CfgMsgCurrentView : public
+    MsgView<
+        ublox::message::CfgMsgCurrentFields::All
+    >
+{
+    using Base =
+        MsgView<
+            ublox::message::CfgMsgCurrentFields::All
+        >;
+
+public:
+    /// @brief ID of the viewed message.
+    static const MsgId MsgIdValue = MsgId_CFG_MSG;
+
+    /// @brief Index of the fields, same as the ones defined by
+    ///     @b COMMS_MSG_FIELDS_ACCESS() in @ref ublox::message::CfgMsgCurrent.
+    enum FieldIdx
+    {
+        FieldIdx_id, ///< index of @b id field
+        FieldIdx_rate, ///< index of @b rate field
+        FieldIdx_numOfValues ///< number of available fields
+    };
+
+    /// @brief Default constructor, creates empty view.
+    CfgMsgCurrentView() = default;
+
+    /// @brief Constructor
+    /// @param[in] payload Pointer to the payload of the message.
+    /// @param[in] len Length of the payload.
+    CfgMsgCurrentView(const std::uint8_t* payload, std::size_t len)
+      : Base(payload, len)
+    {
+    }
+
+    /// @brief Decode "id" field (see @ref ublox::message::CfgMsgCurrentFields::id).
+    comms::ErrorStatus field_id(FieldType<FieldIdx_id>& field) const
+    {
+        return Base::readField<FieldIdx_id>(field);
+    }
+
+    /// @brief Decode "rate" field (see @ref ublox::message::CfgMsgCurrentFields::rate).
+    comms::ErrorStatus field_rate(FieldType<FieldIdx_rate>& field) const
+    {
+        return Base::readField<FieldIdx_rate>(field);
+    }
+};
+
+} // namespace view
+
+} // namespace ublox
+
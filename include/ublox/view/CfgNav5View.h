@@ -0,0 +1,213 @@
+//
+// Copyright 2018 (C). Alex Robenko. All rights reserved.
+//
+
+// This file is free software: you can redistribute it and/or modify
+// it under the terms of the GNU General Public License as published by
+// the Free Software Foundation, either version 3 of the License, or
+// (at your option) any later version.
+//
+// This program is distributed in the hope that it will be useful,
+// but WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+// GNU General Public License for more details.
+//
+// You should have received a copy of the GNU General Public License
+// along with this program.  If not, see <http://www.gnu.org/licenses/>.
+
+/// @file
+/// @brief Contains definition of lazy view of CFG-NAV5 message.
+/// @details Generated by script/gen_views.py, do NOT edit manually.
+
+#pragma once
+
+#include "ublox/message/CfgNav5.h"
+#include "MsgView.h"
+
+namespace ublox
+{
+
+namespace view
+{
+
+/// @brief Lazy read-only view of CFG-NAV5 message payload.
+/// @details Wraps the pointer to the validated payload, the fields are
+///     decoded on access only, see @ref MsgView.
+/// @see @ref ublox::message::CfgNav5
+class CfgNav5View : public
+    MsgView<
+        ublox::message::CfgNav5Fields::All
+    >
+{
+    using Base =
+        MsgView<
+            ublox::message::CfgNav5Fields::All
+        >;
+
+public:
+    /// @brief ID of the viewed message.
+    static const MsgId MsgIdValue = MsgId_CFG_NAV5;
+
+    /// @brief Index of the fields, same as the ones defined by
+    ///     @b COMMS_MSG_FIELDS_ACCESS() in @ref ublox::message::CfgNav5.
+    enum FieldIdx
+    {
+        FieldIdx_mask, ///< index of @b mask field
+        FieldIdx_dynModel, ///< index of @b dynModel field
+        FieldIdx_fixMode, ///< index of @b fixMode field
+        FieldIdx_fixedAlt, ///< index of @b fixedAlt field
+        FieldIdx_fixedAltVar, ///< index of @b fixedAltVar field
+        FieldIdx_minElev, ///< index of @b minElev field
+        FieldIdx_drLimit, ///< index of @b drLimit field
+        FieldIdx_pDOP, ///< index of @b pDOP field
+        FieldIdx_tDOP, ///< index of @b tDOP field
+        FieldIdx_pAcc, ///< index of @b pAcc field
+        FieldIdx_tAcc, ///< index of @b tAcc field
+        FieldIdx_staticHoldThreash, ///< index of @b staticHoldThreash field
+        FieldIdx_dgpsTimeOut, ///< index of @b dgpsTimeOut field
+        FieldIdx_cnoThreshNumSVs, ///< index of @b cnoThreshNumSVs field
+        FieldIdx_cnoThresh, ///< index of @b cnoThresh field
+        FieldIdx_reserved1, ///< index of @b reserved1 field
+        FieldIdx_staticHoldMaxDist, ///< index of @b staticHoldMaxDist field
+        FieldIdx_utcStandard, ///< index of @b utcStandard field
+        FieldIdx_reserved2, ///< index of @b reserved2 field
+        FieldIdx_reserved3, ///< index of @b reserved3 field
+        FieldIdx_numOfValues ///< number of available fields
+    };
+
+    /// @brief Default constructor, creates empty view.
+    CfgNav5View() = default;
+
+    /// @brief Constructor
+    /// @param[in] payload Pointer to the payload of the message.
+    /// @param[in] len Length of the payload.
+    CfgNav5View(const std::uint8_t* payload, std::size_t len)
+      : Base(payload, len)
+    {
+    }
+
+    /// @brief Decode "mask" field (see @ref ublox::message::CfgNav5Fields::mask).
+    comms::ErrorStatus field_mask(FieldType<FieldIdx_mask>& field) const
+    {
+        return Base::readField<FieldIdx_mask>(field);
+    }
+
+    /// @brief Decode "dynModel" field (see @ref ublox::message::CfgNav5Fields::dynModel).
+    comms::ErrorStatus field_dynModel(FieldType<FieldIdx_dynModel>& field) const
+    {
+        return Base::readField<FieldIdx_dynModel>(field);
+    }
+
+    /// @brief Decode "fixMode" field (see @ref ublox::message::CfgNav5Fields::fixMode).
+    comms::ErrorStatus field_fixMode(FieldType<FieldIdx_fixMode>& field) const
+    {
+        return Base::readField<FieldIdx_fixMode>(field);
+    }
+
+    /// @brief Decode "fixedAlt" field (see @ref ublox::message::CfgNav5Fields::fixedAlt).
+    comms::ErrorStatus field_fixedAlt(FieldType<FieldIdx_fixedAlt>& field) const
+    {
+        return Base::readField<FieldIdx_fixedAlt>(field);
+    }
+
+    /// @brief Decode "fixedAltVar" field (see @ref ublox::message::CfgNav5Fields::fixedAltVar).
+    comms::ErrorStatus field_fixedAltVar(FieldType<FieldIdx_fixedAltVar>& field) const
+    {
+        return Base::readField<FieldIdx_fixedAltVar>(field);
+    }
+
+    /// @brief Decode "minElev" field (see @ref ublox::message::CfgNav5Fields::minElev).
+    comms::ErrorStatus field_minElev(FieldType<FieldIdx_minElev>& field) const
+    {
+        return Base::readField<FieldIdx_minElev>(field);
+    }
+
+    /// @brief Decode "drLimit" field (see @ref ublox::message::CfgNav5Fields::drLimit).
+    comms::ErrorStatus field_drLimit(FieldType<FieldIdx_drLimit>& field) const
+    {
+        return Base::readField<FieldIdx_drLimit>(field);
+    }
+
+    /// @brief Decode "pDOP" field (see @ref ublox::message::CfgNav5Fields::pDOP).
+    comms::ErrorStatus field_pDOP(FieldType<FieldIdx_pDOP>& field) const
+    {
+        return Base::readField<FieldIdx_pDOP>(field);
+    }
+
+    /// @brief Decode "tDOP" field (see @ref ublox::message::CfgNav5Fields::tDOP).
+    comms::ErrorStatus field_tDOP(FieldType<FieldIdx_tDOP>& field) const
+    {
+        return Base::readField<FieldIdx_tDOP>(field);
+    }
+
+    /// @brief Decode "pAcc" field (see @ref ublox::message::CfgNav5Fields::pAcc).
+    comms::ErrorStatus field_pAcc(FieldType<FieldIdx_pAcc>& field) const
+    {
+        return Base::readField<FieldIdx_pAcc>(field);
+    }
+
+    /// @brief Decode "tAcc" field (see @ref ublox::message::CfgNav5Fields::tAcc).
+    comms::ErrorStatus field_tAcc(FieldType<FieldIdx_tAcc>& field) const
+    {
+        return Base::readField<FieldIdx_tAcc>(field);
+    }
+
+    /// @brief Decode "staticHoldThreash" field (see @ref ublox::message::CfgNav5Fields::staticHoldThreash).
+    comms::ErrorStatus field_staticHoldThreash(FieldType<FieldIdx_staticHoldThreash>& field) const
+    {
+        return Base::readField<FieldIdx_staticHoldThreash>(field);
+    }
+
+    /// @brief Decode "dgpsTimeOut" field (see @ref ublox::message::CfgNav5Fields::dgpsTimeOut).
+    comms::ErrorStatus field_dgpsTimeOut(FieldType<FieldIdx_dgpsTimeOut>& field) const
+    {
+        return Base::readField<FieldIdx_dgpsTimeOut>(field);
+    }
+
+    /// @brief Decode "cnoThreshNumSVs" field (see @ref ublox::message::CfgNav5Fields::cnoThreshNumSVs).
+    comms::ErrorStatus field_cnoThreshNumSVs(FieldType<FieldIdx_cnoThreshNumSVs>& field) const
+    {
+        return Base::readField<FieldIdx_cnoThreshNumSVs>(field);
+    }
+
+    /// @brief Decode "cnoThresh" field (see @ref ublox::message::CfgNav5Fields::cnoThresh).
+    comms::ErrorStatus field_cnoThresh(FieldType<FieldIdx_cnoThresh>& field) const
+    {
+        return Base::readField<FieldIdx_cnoThresh>(field);
+    }
+
+    /// @brief Decode "reserved1" field (see @ref ublox::message::CfgNav5Fields::reserved1).
+    comms::ErrorStatus field_reserved1(FieldType<FieldIdx_reserved1>& field) const
+    {
+        return Base::readField<FieldIdx_reserved1>(field);
+    }
+
+    /// @brief Decode "staticHoldMaxDist" field (see @ref ublox::message::CfgNav5Fields::staticHoldMaxDist).
+    comms::ErrorStatus field_staticHoldMaxDist(FieldType<FieldIdx_staticHoldMaxDist>& field) const
+    {
+        return Base::readField<FieldIdx_staticHoldMaxDist>(field);
+    }
+
+    /// @brief Decode "utcStandard" field (see @ref ublox::message::CfgNav5Fields::utcStandard).
+    comms::ErrorStatus field_utcStandard(FieldType<FieldIdx_utcStandard>& field) const
+    {
+        return Base::readField<FieldIdx_utcStandard>(field);
+    }
+
+    /// @brief Decode "reserved2" field (see @ref ublox::message::CfgNav5Fields::reserved2).
+    comms::ErrorStatus field_reserved2(FieldType<FieldIdx_reserved2>& field) const
+    {
+        return Base::readField<FieldIdx_reserved2>(field);
+    }
+
+    /// @brief Decode "reserved3" field (see @ref ublox::message::CfgNav5Fields::reserved3).
+    comms::ErrorStatus field_reserved3(FieldType<FieldIdx_reserved3>& field) const
+    {
+        return Base::readField<FieldIdx_reserved3>(field);
+    }
+};
+
+} // namespace view
+
+} // namespace ublox
+
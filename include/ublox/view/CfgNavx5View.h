@@ -0,0 +1,239 @@
+//
+// Copyright 2018 (C). Alex Robenko. All rights reserved.
+//
+
+// This file is free software: you can redistribute it and/or modify
+// it under the terms of the GNU General Public License as published by
+// the Free Software Foundation, either version 3 of the License, or
+// (at your option) any later version.
+//
+// This program is distributed in the hope that it will be useful,
+// but WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+// GNU General Public License for more details.
+//
+// You should have received a copy of the GNU General Public License
+// along with this program.  If not, see <http://www.gnu.org/licenses/>.
+
+/// @file
+/// @brief Contains definition of lazy view of CFG-NAVX5 message.
+/// @details Generated by script/gen_views.py, do NOT edit manually.
+
+#pragma once
+
+#include "ublox/message/CfgNavx5.h"
+#include "MsgView.h"
+
+namespace ublox
+{
+
+namespace view
+{
+
+/// @brief Lazy read-only view of CFG-NAVX5 message payload.
+/// @details Wraps the pointer to the validated payload, the fields are
+///     decoded on access only, see @ref MsgView.
+///     The message performs custom read of its fields, the fields starting
+///     from "reserved10" are not accessible through the view, because their
+///     presence and/or size depend on the values of preceding fields.
+/// @see @ref ublox::message::CfgNavx5
+class CfgNavx5View : public
+    MsgView<
+        ublox::message::CfgNavx5Fields::All
+    >
+{
+    using Base =
+        MsgView<
+            ublox::message::CfgNavx5Fields::All
+        >;
+
+public:
+    /// @brief ID of the viewed message.
+    static const MsgId MsgIdValue = MsgId_CFG_NAVX5;
+
+    /// @brief Index of the fields, same as the ones defined by
+    ///     @b COMMS_MSG_FIELDS_ACCESS() in @ref ublox::message::CfgNavx5.
+    enum FieldIdx
+    {
+        FieldIdx_version, ///< index of @b version field
+        FieldIdx_mask1, ///< index of @b mask1 field
+        FieldIdx_mask2, ///< index of @b mask2 field
+        FieldIdx_reserved1, ///< index of @b reserved1 field
+        FieldIdx_minSVs, ///< index of @b minSVs field
+        FieldIdx_maxSVs, ///< index of @b maxSVs field
+        FieldIdx_minCNO, ///< index of @b minCNO field
+        FieldIdx_reserved2, ///< index of @b reserved2 field
+        FieldIdx_iniFix3D, ///< index of @b iniFix3D field
+        FieldIdx_reserved3, ///< index of @b reserved3 field
+        FieldIdx_ackAiding, ///< index of @b ackAiding field
+        FieldIdx_wknRollover, ///< index of @b wknRollover field
+        FieldIdx_sigAttenCompMode, ///< index of @b sigAttenCompMode field
+        FieldIdx_reserved4, ///< index of @b reserved4 field
+        FieldIdx_reserved5, ///< index of @b reserved5 field
+        FieldIdx_reserved6, ///< index of @b reserved6 field
+        FieldIdx_usePPP, ///< index of @b usePPP field
+        FieldIdx_aopCfg, ///< index of @b aopCfg field
+        FieldIdx_reserved7, ///< index of @b reserved7 field
+        FieldIdx_aopOrbMaxErr, ///< index of @b aopOrbMaxErr field
+        FieldIdx_reserved8, ///< index of @b reserved8 field
+        FieldIdx_reserved9, ///< index of @b reserved9 field
+        FieldIdx_useAdr, ///< index of @b useAdr field
+        FieldIdx_reserved10, ///< index of @b reserved10 field
+        FieldIdx_reserved11, ///< index of @b reserved11 field
+        FieldIdx_numOfValues ///< number of available fields
+    };
+
+    /// @brief Default constructor, creates empty view.
+    CfgNavx5View() = default;
+
+    /// @brief Constructor
+    /// @param[in] payload Pointer to the payload of the message.
+    /// @param[in] len Length of the payload.
+    CfgNavx5View(const std::uint8_t* payload, std::size_t len)
+      : Base(payload, len)
+    {
+    }
+
+    /// @brief Decode "version" field (see @ref ublox::message::CfgNavx5Fields::version).
+    comms::ErrorStatus field_version(FieldType<FieldIdx_version>& field) const
+    {
+        return Base::readField<FieldIdx_version>(field);
+    }
+
+    /// @brief Decode "mask1" field (see @ref ublox::message::CfgNavx5Fields::mask1).
+    comms::ErrorStatus field_mask1(FieldType<FieldIdx_mask1>& field) const
+    {
+        return Base::readField<FieldIdx_mask1>(field);
+    }
+
+    /// @brief Decode "mask2" field (see @ref ublox::message::CfgNavx5Fields::mask2).
+    comms::ErrorStatus field_mask2(FieldType<FieldIdx_mask2>& field) const
+    {
+        return Base::readField<FieldIdx_mask2>(field);
+    }
+
+    /// @brief Decode "reserved1" field (see @ref ublox::message::CfgNavx5Fields::reserved1).
+    comms::ErrorStatus field_reserved1(FieldType<FieldIdx_reserved1>& field) const
+    {
+        return Base::readField<FieldIdx_reserved1>(field);
+    }
+
+    /// @brief Decode "minSVs" field (see @ref ublox::message::CfgNavx5Fields::minSVs).
+    comms::ErrorStatus field_minSVs(FieldType<FieldIdx_minSVs>& field) const
+    {
+        return Base::readField<FieldIdx_minSVs>(field);
+    }
+
+    /// @brief Decode "maxSVs" field (see @ref ublox::message::CfgNavx5Fields::maxSVs).
+    comms::ErrorStatus field_maxSVs(FieldType<FieldIdx_maxSVs>& field) const
+    {
+        return Base::readField<FieldIdx_maxSVs>(field);
+    }
+
+    /// @brief Decode "minCNO" field (see @ref ublox::message::CfgNavx5Fields::minCNO).
+    comms::ErrorStatus field_minCNO(FieldType<FieldIdx_minCNO>& field) const
+    {
+        return Base::readField<FieldIdx_minCNO>(field);
+    }
+
+    /// @brief Decode "reserved2" field (see @ref ublox::message::CfgNavx5Fields::reserved2).
+    comms::ErrorStatus field_reserved2(FieldType<FieldIdx_reserved2>& field) const
+    {
+        return Base::readField<FieldIdx_reserved2>(field);
+    }
+
+    /// @brief Decode "iniFix3D" field (see @ref ublox::message::CfgNavx5Fields::iniFix3D).
+    comms::ErrorStatus field_iniFix3D(FieldType<FieldIdx_iniFix3D>& field) const
+    {
+        return Base::readField<FieldIdx_iniFix3D>(field);
+    }
+
+    /// @brief Decode "reserved3" field (see @ref ublox::message::CfgNavx5Fields::reserved3).
+    comms::ErrorStatus field_reserved3(FieldType<FieldIdx_reserved3>& field) const
+    {
+        return Base::readField<FieldIdx_reserved3>(field);
+    }
+
+    /// @brief Decode "ackAiding" field (see @ref ublox::message::CfgNavx5Fields::ackAiding).
+    comms::ErrorStatus field_ackAiding(FieldType<FieldIdx_ackAiding>& field) const
+    {
+        return Base::readField<FieldIdx_ackAiding>(field);
+    }
+
+    /// @brief Decode "wknRollover" field (see @ref ublox::message::CfgNavx5Fields::wknRollover).
+    comms::ErrorStatus field_wknRollover(FieldType<FieldIdx_wknRollover>& field) const
+    {
+        return Base::readField<FieldIdx_wknRollover>(field);
+    }
+
+    /// @brief Decode "sigAttenCompMode" field (see @ref ublox::message::CfgNavx5Fields::sigAttenCompMode).
+    comms::ErrorStatus field_sigAttenCompMode(FieldType<FieldIdx_sigAttenCompMode>& field) const
+    {
+        return Base::readField<FieldIdx_sigAttenCompMode>(field);
+    }
+
+    /// @brief Decode "reserved4" field (see @ref ublox::message::CfgNavx5Fields::reserved4).
+    comms::ErrorStatus field_reserved4(FieldType<FieldIdx_reserved4>& field) const
+    {
+        return Base::readField<FieldIdx_reserved4>(field);
+    }
+
+    /// @brief Decode "reserved5" field (see @ref ublox::message::CfgNavx5Fields::reserved5).
+    comms::ErrorStatus field_reserved5(FieldType<FieldIdx_reserved5>& field) const
+    {
+        return Base::readField<FieldIdx_reserved5>(field);
+    }
+
+    /// @brief Decode "reserved6" field (see @ref ublox::message::CfgNavx5Fields::reserved6).
+    comms::ErrorStatus field_reserved6(FieldType<FieldIdx_reserved6>& field) const
+    {
+        return Base::readField<FieldIdx_reserved6>(field);
+    }
+
+    /// @brief Decode "usePPP" field (see @ref ublox::message::CfgNavx5Fields::usePPP).
+    comms::ErrorStatus field_usePPP(FieldType<FieldIdx_usePPP>& field) const
+    {
+        return Base::readField<FieldIdx_usePPP>(field);
+    }
+
+    /// @brief Decode "aopCfg" field (see @ref ublox::message::CfgNavx5Fields::aopCfg).
+    comms::ErrorStatus field_aopCfg(FieldType<FieldIdx_aopCfg>& field) const
+    {
+        return Base::readField<FieldIdx_aopCfg>(field);
+    }
+
+    /// @brief Decode "reserved7" field (see @ref ublox::message::CfgNavx5Fields::reserved7).
+    comms::ErrorStatus field_reserved7(FieldType<FieldIdx_reserved7>& field) const
+    {
+        return Base::readField<FieldIdx_reserved7>(field);
+    }
+
+    /// @brief Decode "aopOrbMaxErr" field (see @ref ublox::message::CfgNavx5Fields::aopOrbMaxErr).
+    comms::ErrorStatus field_aopOrbMaxErr(FieldType<FieldIdx_aopOrbMaxErr>& field) const
+    {
+        return Base::readField<FieldIdx_aopOrbMaxErr>(field);
+    }
+
+    /// @brief Decode "reserved8" field (see @ref ublox::message::CfgNavx5Fields::reserved8).
+    comms::ErrorStatus field_reserved8(FieldType<FieldIdx_reserved8>& field) const
+    {
+        return Base::readField<FieldIdx_reserved8>(field);
+    }
+
+    /// @brief Decode "reserved9" field (see @ref ublox::message::CfgNavx5Fields::reserved9).
+    comms::ErrorStatus field_reserved9(FieldType<FieldIdx_reserved9>& field) const
+    {
+        return Base::readField<FieldIdx_reserved9>(field);
+    }
+
+    /// @brief Decode "useAdr" field (see @ref ublox::message::CfgNavx5Fields::useAdr).
+    comms::ErrorStatus field_useAdr(FieldType<FieldIdx_useAdr>& field) const
+    {
+        return Base::readField<FieldIdx_useAdr>(field);
+    }
+};
+
+} // namespace view
+
+} // namespace ublox
+
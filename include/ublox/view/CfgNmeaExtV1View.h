@@ -0,0 +1,157 @@
+//
+// Copyright 2018 (C). Alex Robenko. All rights reserved.
+//
+
+// This file is free software: you can redistribute it and/or modify
+// it under the terms of the GNU General Public License as published by
+// the Free Software Foundation, either version 3 of the License, or
+// (at your option) any later version.
+//
+// This program is distributed in the hope that it will be useful,
+// but WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+// GNU General Public License for more details.
+//
+// You should have received a copy of the GNU General Public License
+// along with this program.  If not, see <http://www.gnu.org/licenses/>.
+
+/// @file
+/// @brief Contains definition of lazy view of CFG-NMEA (@b extended) message.
+/// @details Generated by script/gen_views.py, do NOT edit manually.
+
+#pragma once
+
+#include "ublox/message/CfgNmeaExtV1.h"
+#include "MsgView.h"
+
+namespace ublox
+{
+
+namespace view
+{
+
+/// @brief Lazy read-only view of CFG-NMEA (@b extended) message payload.
+/// @details Wraps the pointer to the validated payload, the fields are
+///     decoded on access only, see @ref MsgView.
+/// @see @ref ublox::message::CfgNmeaExtV1
+class CfgNmeaExtV1View : public
+    MsgView<
+        ublox::message::CfgNmeaExtV1Fields::All<comms::option::EmptyOption>
+    >
+{
+    using Base =
+        MsgView<
+            ublox::message::CfgNmeaExtV1Fields::All<comms::option::EmptyOption>
+        >;
+
+public:
+    /// @brief ID of the viewed message.
+    static const MsgId MsgIdValue = MsgId_CFG_NMEA;
+
+    /// @brief Index of the fields, same as the ones defined by
+    ///     @b COMMS_MSG_FIELDS_ACCESS() in @ref ublox::message::CfgNmeaExtV1.
+    enum FieldIdx
+    {
+        FieldIdx_filter, ///< index of @b filter field
+        FieldIdx_nmeaVersion, ///< index of @b nmeaVersion field
+        FieldIdx_numSV, ///< index of @b numSV field
+        FieldIdx_flags, ///< index of @b flags field
+        FieldIdx_gnssToFilter, ///< index of @b gnssToFilter field
+        FieldIdx_svNumbering, ///< index of @b svNumbering field
+        FieldIdx_mainTalkerId, ///< index of @b mainTalkerId field
+        FieldIdx_gsvTalkerId, ///< index of @b gsvTalkerId field
+        FieldIdx_version, ///< index of @b version field
+        FieldIdx_bdsTalkerId, ///< index of @b bdsTalkerId field
+        FieldIdx_reserved1, ///< index of @b reserved1 field
+        FieldIdx_reserved2, ///< index of @b reserved2 field
+        FieldIdx_numOfValues ///< number of available fields
+    };
+
+    /// @brief Default constructor, creates empty view.
+    CfgNmeaExtV1View() = default;
+
+    /// @brief Constructor
+    /// @param[in] payload Pointer to the payload of the message.
+    /// @param[in] len Length of the payload.
+    CfgNmeaExtV1View(const std::uint8_t* payload, std::size_t len)
+      : Base(payload, len)
+    {
+    }
+
+    /// @brief Decode "filter" field (see @ref ublox::message::CfgNmeaFields::filter).
+    comms::ErrorStatus field_filter(FieldType<FieldIdx_filter>& field) const
+    {
+        return Base::readField<FieldIdx_filter>(field);
+    }
+
+    /// @brief Decode "nmeaVersion" field (see @ref ublox::message::CfgNmeaExtV1Fields::nmeaVersion).
+    comms::ErrorStatus field_nmeaVersion(FieldType<FieldIdx_nmeaVersion>& field) const
+    {
+        return Base::readField<FieldIdx_nmeaVersion>(field);
+    }
+
+    /// @brief Decode "numSV" field (see @ref ublox::message::CfgNmeaExtFields::numSV).
+    comms::ErrorStatus field_numSV(FieldType<FieldIdx_numSV>& field) const
+    {
+        return Base::readField<FieldIdx_numSV>(field);
+    }
+
+    /// @brief Decode "flags" field (see @ref ublox::message::CfgNmeaExtV1Fields::flags).
+    comms::ErrorStatus field_flags(FieldType<FieldIdx_flags>& field) const
+    {
+        return Base::readField<FieldIdx_flags>(field);
+    }
+
+    /// @brief Decode "gnssToFilter" field (see @ref ublox::message::CfgNmeaExtFields::gnssToFilter).
+    comms::ErrorStatus field_gnssToFilter(FieldType<FieldIdx_gnssToFilter>& field) const
+    {
+        return Base::readField<FieldIdx_gnssToFilter>(field);
+    }
+
+    /// @brief Decode "svNumbering" field (see @ref ublox::message::CfgNmeaExtFields::svNumbering).
+    comms::ErrorStatus field_svNumbering(FieldType<FieldIdx_svNumbering>& field) const
+    {
+        return Base::readField<FieldIdx_svNumbering>(field);
+    }
+
+    /// @brief Decode "mainTalkerId" field (see @ref ublox::message::CfgNmeaExtFields::mainTalkerId).
+    comms::ErrorStatus field_mainTalkerId(FieldType<FieldIdx_mainTalkerId>& field) const
+    {
+        return Base::readField<FieldIdx_mainTalkerId>(field);
+    }
+
+    /// @brief Decode "gsvTalkerId" field (see @ref ublox::message::CfgNmeaExtFields::gsvTalkerId).
+    comms::ErrorStatus field_gsvTalkerId(FieldType<FieldIdx_gsvTalkerId>& field) const
+    {
+        return Base::readField<FieldIdx_gsvTalkerId>(field);
+    }
+
+    /// @brief Decode "version" field (see @ref ublox::message::CfgNmeaExtV1Fields::version).
+    comms::ErrorStatus field_version(FieldType<FieldIdx_version>& field) const
+    {
+        return Base::readField<FieldIdx_version>(field);
+    }
+
+    /// @brief Decode "bdsTalkerId" field (see @ref ublox::message::CfgNmeaExtV1Fields::bdsTalkerId).
+    comms::ErrorStatus field_bdsTalkerId(FieldType<FieldIdx_bdsTalkerId>& field) const
+    {
+        return Base::readField<FieldIdx_bdsTalkerId>(field);
+    }
+
+    /// @brief Decode "reserved1" field (see @ref ublox::message::CfgNmeaExtV1Fields::reserved1).
+    comms::ErrorStatus field_reserved1(FieldType<FieldIdx_reserved1>& field) const
+    {
+        return Base::readField<FieldIdx_reserved1>(field);
+    }
+
+    /// @brief Decode "reserved2" field (see @ref ublox::message::CfgNmeaExtV1Fields::reserved2).
+    comms::ErrorStatus field_reserved2(FieldType<FieldIdx_reserved2>& field) const
+    {
+        return Base::readField<FieldIdx_reserved2>(field);
+    }
+};
+
+} // namespace view
+
+} // namespace ublox
+
@@ -0,0 +1,101 @@
+//
+// Copyright 2018 (C). Alex Robenko. All rights reserved.
+//
+
+// This file is free software: you can redistribute it and/or modify
+// it under the terms of the GNU General Public License as published by
+// the Free Software Foundation, either version 3 of the License, or
+// (at your option) any later version.
+//
+// This program is distributed in the hope that it will be useful,
+// but WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+// GNU General Public License for more details.
+//
+// You should have received a copy of the GNU General Public License
+// along with this program.  If not, see <http://www.gnu.org/licenses/>.
+
+/// @file
+/// @brief Contains definition of lazy view of CFG-NMEA message.
+/// @details Generated by script/gen_views.py, do NOT edit manually.
+
+#pragma once
+
+#include "ublox/message/CfgNmea.h"
+#include "MsgView.h"
+
+namespace ublox
+{
+
+namespace view
+{
+
+/// @brief Lazy read-only view of CFG-NMEA message payload.
+/// @details Wraps the pointer to the validated payload, the fields are
+///     decoded on access only, see @ref MsgView.
+/// @see @ref ublox::message::CfgNmea
+class CfgNmeaView : public
+    MsgView<
+        ublox::message::CfgNmeaFields::All
+    >
+{
+    using Base =
+        MsgView<
+            ublox::message::CfgNmeaFields::All
+        >;
+
+public:
+    /// @brief ID of the viewed message.
+    static const MsgId MsgIdValue = MsgId_CFG_NMEA;
+
+    /// @brief Index of the fields, same as the ones defined by
+    ///     @b COMMS_MSG_FIELDS_ACCESS() in @ref ublox::message::CfgNmea.
+    enum FieldIdx
+    {
+        FieldIdx_filter, ///< index of @b filter field
+        FieldIdx_nmeaVersion, ///< index of @b nmeaVersion field
+        FieldIdx_numSV, ///< index of @b numSV field
+        FieldIdx_flags, ///< index of @b flags field
+        FieldIdx_numOfValues ///< number of available fields
+    };
+
+    /// @brief Default constructor, creates empty view.
+    CfgNmeaView() = default;
+
+    /// @brief Constructor
+    /// @param[in] payload Pointer to the payload of the message.
+    /// @param[in] len Length of the payload.
+    CfgNmeaView(const std::uint8_t* payload, std::size_t len)
+      : Base(payload, len)
+    {
+    }
+
+    /// @brief Decode "filter" field (see @ref ublox::message::CfgNmeaFields::filter).
+    comms::ErrorStatus field_filter(FieldType<FieldIdx_filter>& field) const
+    {
+        return Base::readField<FieldIdx_filter>(field);
+    }
+
+    /// @brief Decode "nmeaVersion" field (see @ref ublox::message::CfgNmeaFields::nmeaVersion).
+    comms::ErrorStatus field_nmeaVersion(FieldType<FieldIdx_nmeaVersion>& field) const
+    {
+        return Base::readField<FieldIdx_nmeaVersion>(field);
+    }
+
+    /// @brief Decode "numSV" field (see @ref ublox::message::CfgNmeaFields::numSV).
+    comms::ErrorStatus field_numSV(FieldType<FieldIdx_numSV>& field) const
+    {
+        return Base::readField<FieldIdx_numSV>(field);
+    }
+
+    /// @brief Decode "flags" field (see @ref ublox::message::CfgNmeaFields::flags).
+    comms::ErrorStatus field_flags(FieldType<FieldIdx_flags>& field) const
+    {
+        return Base::readField<FieldIdx_flags>(field);
+    }
+};
+
+} // namespace view
+
+} // namespace ublox
+
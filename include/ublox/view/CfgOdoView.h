@@ -0,0 +1,150 @@
+//
+// Copyright 2018 (C). Alex Robenko. All rights reserved.
+//
+
+// This file is free software: you can redistribute it and/or modify
+// it under the terms of the GNU General Public License as published by
+// the Free Software Foundation, either version 3 of the License, or
+// (at your option) any later version.
+//
+// This program is distributed in the hope that it will be useful,
+// but WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+// GNU General Public License for more details.
+//
+// You should have received a copy of the GNU General Public License
+// along with this program.  If not, see <http://www.gnu.org/licenses/>.
+
+/// @file
+/// @brief Contains definition of lazy view of CFG-ODO message.
+/// @details Generated by script/gen_views.py, do NOT edit manually.
+
+#pragma once
+
+#include "ublox/message/CfgOdo.h"
+#include "MsgView.h"
+
+namespace ublox
+{
+
+namespace view
+{
+
+/// @brief Lazy read-only view of CFG-ODO message payload.
+/// @details Wraps the pointer to the validated payload, the fields are
+///     decoded on access only, see @ref MsgView.
+/// @see @ref ublox::message::CfgOdo
+class CfgOdoView : public
+    MsgView<
+        ublox::message::CfgOdoFields::All
+    >
+{
+    using Base =
+        MsgView<
+            ublox::message::CfgOdoFields::All
+        >;
+
+public:
+    /// @brief ID of the viewed message.
+    static const MsgId MsgIdValue = MsgId_CFG_ODO;
+
+    /// @brief Index of the fields, same as the ones defined by
+    ///     @b COMMS_MSG_FIELDS_ACCESS() in @ref ublox::message::CfgOdo.
+    enum FieldIdx
+    {
+        FieldIdx_version, ///< index of @b version field
+        FieldIdx_reserved1, ///< index of @b reserved1 field
+        FieldIdx_flags, ///< index of @b flags field
+        FieldIdx_odoCfg, ///< index of @b odoCfg field
+        FieldIdx_reserved2, ///< index of @b reserved2 field
+        FieldIdx_cogMaxSpeed, ///< index of @b cogMaxSpeed field
+        FieldIdx_cogMaxPosAcc, ///< index of @b cogMaxPosAcc field
+        FieldIdx_reserved3, ///< index of @b reserved3 field
+        FieldIdx_velLpGain, ///< index of @b velLpGain field
+        FieldIdx_cogLpGain, ///< index of @b cogLpGain field
+        FieldIdx_reserved4, ///< index of @b reserved4 field
+        FieldIdx_numOfValues ///< number of available fields
+    };
+
+    /// @brief Default constructor, creates empty view.
+    CfgOdoView() = default;
+
+    /// @brief Constructor
+    /// @param[in] payload Pointer to the payload of the message.
+    /// @param[in] len Length of the payload.
+    CfgOdoView(const std::uint8_t* payload, std::size_t len)
+      : Base(payload, len)
+    {
+    }
+
+    /// @brief Decode "version" field (see @ref ublox::message::CfgOdoFields::version).
+    comms::ErrorStatus field_version(FieldType<FieldIdx_version>& field) const
+    {
+        return Base::readField<FieldIdx_version>(field);
+    }
+
+    /// @brief Decode "reserved1" field (see @ref ublox::message::CfgOdoFields::reserved1).
+    comms::ErrorStatus field_reserved1(FieldType<FieldIdx_reserved1>& field) const
+    {
+        return Base::readField<FieldIdx_reserved1>(field);
+    }
+
+    /// @brief Decode "flags" field (see @ref ublox::message::CfgOdoFields::flags).
+    comms::ErrorStatus field_flags(FieldType<FieldIdx_flags>& field) const
+    {
+        return Base::readField<FieldIdx_flags>(field);
+    }
+
+    /// @brief Decode "odoCfg" field (see @ref ublox::message::CfgOdoFields::odoCfg).
+    comms::ErrorStatus field_odoCfg(FieldType<FieldIdx_odoCfg>& field) const
+    {
+        return Base::readField<FieldIdx_odoCfg>(field);
+    }
+
+    /// @brief Decode "reserved2" field (see @ref ublox::message::CfgOdoFields::reserved2).
+    comms::ErrorStatus field_reserved2(FieldType<FieldIdx_reserved2>& field) const
+    {
+        return Base::readField<FieldIdx_reserved2>(field);
+    }
+
+    /// @brief Decode "cogMaxSpeed" field (see @ref ublox::message::CfgOdoFields::cogMaxSpeed).
+    comms::ErrorStatus field_cogMaxSpeed(FieldType<FieldIdx_cogMaxSpeed>& field) const
+    {
+        return Base::readField<FieldIdx_cogMaxSpeed>(field);
+    }
+
+    /// @brief Decode "cogMaxPosAcc" field (see @ref ublox::message::CfgOdoFields::cogMaxPosAcc).
+    comms::ErrorStatus field_cogMaxPosAcc(FieldType<FieldIdx_cogMaxPosAcc>& field) const
+    {
+        return Base::readField<FieldIdx_cogMaxPosAcc>(field);
+    }
+
+    /// @brief Decode "reserved3" field (see @ref ublox::message::CfgOdoFields::reserved3).
+    comms::ErrorStatus field_reserved3(FieldType<FieldIdx_reserved3>& field) const
+    {
+        return Base::readField<FieldIdx_reserved3>(field);
+    }
+
+    /// @brief Decode "velLpGain" field (see @ref ublox::message::CfgOdoFields::velLpGain).
+    comms::ErrorStatus field_velLpGain(FieldType<FieldIdx_velLpGain>& field) const
+    {
+        return Base::readField<FieldIdx_velLpGain>(field);
+    }
+
+    /// @brief Decode "cogLpGain" field (see @ref ublox::message::CfgOdoFields::cogLpGain).
+    comms::ErrorStatus field_cogLpGain(FieldType<FieldIdx_cogLpGain>& field) const
+    {
+        return Base::readField<FieldIdx_cogLpGain>(field);
+    }
+
+    /// @brief Decode "reserved4" field (see @ref ublox::message::CfgOdoFields::reserved4).
+    comms::ErrorStatus field_reserved4(FieldType<FieldIdx_reserved4>& field) const
+    {
+        return Base::readField<FieldIdx_reserved4>(field);
+    }
+};
+
+} // namespace view
+
+} // namespace ublox
+
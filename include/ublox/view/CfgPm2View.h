@@ -0,0 +1,203 @@
+//
+// Copyright 2018 (C). Alex Robenko. All rights reserved.
+//
+
+// This file is free software: you can redistribute it and/or modify
+// it under the terms of the GNU General Public License as published by
+// the Free Software Foundation, either version 3 of the License, or
+// (at your option) any later version.
+//
+// This program is distributed in the hope that it will be useful,
+// but WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+// GNU General Public License for more details.
+//
+// You should have received a copy of the GNU General Public License
+// along with this program.  If not, see <http://www.gnu.org/licenses/>.
+
+/// @file
+/// @brief Contains definition of lazy view of CFG-PM2 message.
+/// @details Generated by script/gen_views.py, do NOT edit manually.
+
+#pragma once
+
+#include "ublox/message/CfgPm2.h"
+#include "MsgView.h"
+
+namespace ublox
+{
+
+namespace view
+{
+
+/// @brief Lazy read-only view of CFG-PM2 message payload.
+/// @details Wraps the pointer to the validated payload, the fields are
+///     decoded on access only, see @ref MsgView.
+///     The message performs custom read of its fields, the fields starting
+///     from "extintInactivityMs" are not accessible through the view, because their
+///     presence and/or size depend on the values of preceding fields.
+/// @see @ref ublox::message::CfgPm2
+class CfgPm2View : public
+    MsgView<
+        ublox::message::CfgPm2Fields::All
+    >
+{
+    using Base =
+        MsgView<
+            ublox::message::CfgPm2Fields::All
+        >;
+
+public:
+    /// @brief ID of the viewed message.
+    static const MsgId MsgIdValue = MsgId_CFG_PM2;
+
+    /// @brief Index of the fields, same as the ones defined by
+    ///     @b COMMS_MSG_FIELDS_ACCESS() in @ref ublox::message::CfgPm2.
+    enum FieldIdx
+    {
+        FieldIdx_version, ///< index of @b version field
+        FieldIdx_reserved1, ///< index of @b reserved1 field
+        FieldIdx_reserved2, ///< index of @b reserved2 field
+        FieldIdx_reserved3, ///< index of @b reserved3 field
+        FieldIdx_flags, ///< index of @b flags field
+        FieldIdx_updatePeriod, ///< index of @b updatePeriod field
+        FieldIdx_searchPeriod, ///< index of @b searchPeriod field
+        FieldIdx_gridOffset, ///< index of @b gridOffset field
+        FieldIdx_onTime, ///< index of @b onTime field
+        FieldIdx_minAcqTime, ///< index of @b minAcqTime field
+        FieldIdx_reserved4, ///< index of @b reserved4 field
+        FieldIdx_reserved5, ///< index of @b reserved5 field
+        FieldIdx_reserved6, ///< index of @b reserved6 field
+        FieldIdx_reserved7, ///< index of @b reserved7 field
+        FieldIdx_reserved8, ///< index of @b reserved8 field
+        FieldIdx_reserved9, ///< index of @b reserved9 field
+        FieldIdx_reserved10, ///< index of @b reserved10 field
+        FieldIdx_reserved11, ///< index of @b reserved11 field
+        FieldIdx_extintInactivityMs, ///< index of @b extintInactivityMs field
+        FieldIdx_numOfValues ///< number of available fields
+    };
+
+    /// @brief Default constructor, creates empty view.
+    CfgPm2View() = default;
+
+    /// @brief Constructor
+    /// @param[in] payload Pointer to the payload of the message.
+    /// @param[in] len Length of the payload.
+    CfgPm2View(const std::uint8_t* payload, std::size_t len)
+      : Base(payload, len)
+    {
+    }
+
+    /// @brief Decode "version" field (see @ref ublox::message::CfgPm2Fields::version).
+    comms::ErrorStatus field_version(FieldType<FieldIdx_version>& field) const
+    {
+        return Base::readField<FieldIdx_version>(field);
+    }
+
+    /// @brief Decode "reserved1" field (see @ref ublox::message::CfgPm2Fields::reserved1).
+    comms::ErrorStatus field_reserved1(FieldType<FieldIdx_reserved1>& field) const
+    {
+        return Base::readField<FieldIdx_reserved1>(field);
+    }
+
+    /// @brief Decode "reserved2" field (see @ref ublox::message::CfgPm2Fields::reserved2).
+    comms::ErrorStatus field_reserved2(FieldType<FieldIdx_reserved2>& field) const
+    {
+        return Base::readField<FieldIdx_reserved2>(field);
+    }
+
+    /// @brief Decode "reserved3" field (see @ref ublox::message::CfgPm2Fields::reserved3).
+    comms::ErrorStatus field_reserved3(FieldType<FieldIdx_reserved3>& field) const
+    {
+        return Base::readField<FieldIdx_reserved3>(field);
+    }
+
+    /// @brief Decode "flags" field (see @ref ublox::message::CfgPm2Fields::flags).
+    comms::ErrorStatus field_flags(FieldType<FieldIdx_flags>& field) const
+    {
+        return Base::readField<FieldIdx_flags>(field);
+    }
+
+    /// @brief Decode "updatePeriod" field (see @ref ublox::message::CfgPm2Fields::updatePeriod).
+    comms::ErrorStatus field_updatePeriod(FieldType<FieldIdx_updatePeriod>& field) const
+    {
+        return Base::readField<FieldIdx_updatePeriod>(field);
+    }
+
+    /// @brief Decode "searchPeriod" field (see @ref ublox::message::CfgPm2Fields::searchPeriod).
+    comms::ErrorStatus field_searchPeriod(FieldType<FieldIdx_searchPeriod>& field) const
+    {
+        return Base::readField<FieldIdx_searchPeriod>(field);
+    }
+
+    /// @brief Decode "gridOffset" field (see @ref ublox::message::CfgPm2Fields::gridOffset).
+    comms::ErrorStatus field_gridOffset(FieldType<FieldIdx_gridOffset>& field) const
+    {
+        return Base::readField<FieldIdx_gridOffset>(field);
+    }
+
+    /// @brief Decode "onTime" field (see @ref ublox::message::CfgPm2Fields::onTime).
+    comms::ErrorStatus field_onTime(FieldType<FieldIdx_onTime>& field) const
+    {
+        return Base::readField<FieldIdx_onTime>(field);
+    }
+
+    /// @brief Decode "minAcqTime" field (see @ref ublox::message::CfgPm2Fields::minAcqTime).
+    comms::ErrorStatus field_minAcqTime(FieldType<FieldIdx_minAcqTime>& field) const
+    {
+        return Base::readField<FieldIdx_minAcqTime>(field);
+    }
+
+    /// @brief Decode "reserved4" field (see @ref ublox::message::CfgPm2Fields::reserved4).
+    comms::ErrorStatus field_reserved4(FieldType<FieldIdx_reserved4>& field) const
+    {
+        return Base::readField<FieldIdx_reserved4>(field);
+    }
+
+    /// @brief Decode "reserved5" field (see @ref ublox::message::CfgPm2Fields::reserved5).
+    comms::ErrorStatus field_reserved5(FieldType<FieldIdx_reserved5>& field) const
+    {
+        return Base::readField<FieldIdx_reserved5>(field);
+    }
+
+    /// @brief Decode "reserved6" field (see @ref ublox::message::CfgPm2Fields::reserved6).
+    comms::ErrorStatus field_reserved6(FieldType<FieldIdx_reserved6>& field) const
+    {
+        return Base::readField<FieldIdx_reserved6>(field);
+    }
+
+    /// @brief Decode "reserved7" field (see @ref ublox::message::CfgPm2Fields::reserved7).
+    comms::ErrorStatus field_reserved7(FieldType<FieldIdx_reserved7>& field) const
+    {
+        return Base::readField<FieldIdx_reserved7>(field);
+    }
+
+    /// @brief Decode "reserved8" field (see @ref ublox::message::CfgPm2Fields::reserved8).
+    comms::ErrorStatus field_reserved8(FieldType<FieldIdx_reserved8>& field) const
+    {
+        return Base::readField<FieldIdx_reserved8>(field);
+    }
+
+    /// @brief Decode "reserved9" field (see @ref ublox::message::CfgPm2Fields::reserved9).
+    comms::ErrorStatus field_reserved9(FieldType<FieldIdx_reserved9>& field) const
+    {
+        return Base::readField<FieldIdx_reserved9>(field);
+    }
+
+    /// @brief Decode "reserved10" field (see @ref ublox::message::CfgPm2Fields::reserved10).
+    comms::ErrorStatus field_reserved10(FieldType<FieldIdx_reserved10>& field) const
+    {
+        return Base::readField<FieldIdx_reserved10>(field);
+    }
+
+    /// @brief Decode "reserved11" field (see @ref ublox::message::CfgPm2Fields::reserved11).
+    comms::ErrorStatus field_reserved11(FieldType<FieldIdx_reserved11>& field) const
+    {
+        return Base::readField<FieldIdx_reserved11>(field);
+    }
+};
+
+} // namespace view
+
+} // namespace ublox
+
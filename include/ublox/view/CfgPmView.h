@@ -0,0 +1,143 @@
+//
+// Copyright 2018 (C). Alex Robenko. All rights reserved.
+//
+
+// This file is free software: you can redistribute it and/or modify
+// it under the terms of the GNU General Public License as published by
+// the Free Software Foundation, either version 3 of the License, or
+// (at your option) any later version.
+//
+// This program is distributed in the hope that it will be useful,
+// but WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+// GNU General Public License for more details.
+//
+// You should have received a copy of the GNU General Public License
+// along with this program.  If not, see <http://www.gnu.org/licenses/>.
+
+/// @file
+/// @brief Contains definition of lazy view of CFG-PM message.
+/// @details Generated by script/gen_views.py, do NOT edit manually.
+
+#pragma once
+
+#include "ublox/message/CfgPm.h"
+#include "MsgView.h"
+
+namespace ublox
+{
+
+namespace view
+{
+
+/// @brief Lazy read-only view of CFG-PM message payload.
+/// @details Wraps the pointer to the validated payload, the fields are
+///     decoded on access only, see @ref MsgView.
+/// @see @ref ublox::message::CfgPm
+class CfgPmView : public
+    MsgView<
+        ublox::message::CfgPmFields::All
+    >
+{
+    using Base =
+        MsgView<
+            ublox::message::CfgPmFields::All
+        >;
+
+public:
+    /// @brief ID of the viewed message.
+    static const MsgId MsgIdValue = MsgId_CFG_PM;
+
+    /// @brief Index of the fields, same as the ones defined by
+    ///     @b COMMS_MSG_FIELDS_ACCESS() in @ref ublox::message::CfgPm.
+    enum FieldIdx
+    {
+        FieldIdx_version, ///< index of @b version field
+        FieldIdx_reserved1, ///< index of @b reserved1 field
+        FieldIdx_reserved2, ///< index of @b reserved2 field
+        FieldIdx_reserved3, ///< index of @b reserved3 field
+        FieldIdx_flags, ///< index of @b flags field
+        FieldIdx_updatePeriod, ///< index of @b updatePeriod field
+        FieldIdx_searchPeriod, ///< index of @b searchPeriod field
+        FieldIdx_gridOffset, ///< index of @b gridOffset field
+        FieldIdx_onTime, ///< index of @b onTime field
+        FieldIdx_minAcqTime, ///< index of @b minAcqTime field
+        FieldIdx_numOfValues ///< number of available fields
+    };
+
+    /// @brief Default constructor, creates empty view.
+    CfgPmView() = default;
+
+    /// @brief Constructor
+    /// @param[in] payload Pointer to the payload of the message.
+    /// @param[in] len Length of the payload.
+    CfgPmView(const std::uint8_t* payload, std::size_t len)
+      : Base(payload, len)
+    {
+    }
+
+    /// @brief Decode "version" field (see @ref ublox::message::CfgPmFields::version).
+    comms::ErrorStatus field_version(FieldType<FieldIdx_version>& field) const
+    {
+        return Base::readField<FieldIdx_version>(field);
+    }
+
+    /// @brief Decode "reserved1" field (see @ref ublox::message::CfgPmFields::reserved1).
+    comms::ErrorStatus field_reserved1(FieldType<FieldIdx_reserved1>& field) const
+    {
+        return Base::readField<FieldIdx_reserved1>(field);
+    }
+
+    /// @brief Decode "reserved2" field (see @ref ublox::message::CfgPmFields::reserved2).
+    comms::ErrorStatus field_reserved2(FieldType<FieldIdx_reserved2>& field) const
+    {
+        return Base::readField<FieldIdx_reserved2>(field);
+    }
+
+    /// @brief Decode "reserved3" field (see @ref ublox::message::CfgPmFields::reserved3).
+    comms::ErrorStatus field_reserved3(FieldType<FieldIdx_reserved3>& field) const
+    {
+        return Base::readField<FieldIdx_reserved3>(field);
+    }
+
+    /// @brief Decode "flags" field (see @ref ublox::message::CfgPmFields::flags).
+    comms::ErrorStatus field_flags(FieldType<FieldIdx_flags>& field) const
+    {
+        return Base::readField<FieldIdx_flags>(field);
+    }
+
+    /// @brief Decode "updatePeriod" field (see @ref ublox::message::CfgPmFields::updatePeriod).
+    comms::ErrorStatus field_updatePeriod(FieldType<FieldIdx_updatePeriod>& field) const
+    {
+        return Base::readField<FieldIdx_updatePeriod>(field);
+    }
+
+    /// @brief Decode "searchPeriod" field (see @ref ublox::message::CfgPmFields::searchPeriod).
+    comms::ErrorStatus field_searchPeriod(FieldType<FieldIdx_searchPeriod>& field) const
+    {
+        return Base::readField<FieldIdx_searchPeriod>(field);
+    }
+
+    /// @brief Decode "gridOffset" field (see @ref ublox::message::CfgPmFields::gridOffset).
+    comms::ErrorStatus field_gridOffset(FieldType<FieldIdx_gridOffset>& field) const
+    {
+        return Base::readField<FieldIdx_gridOffset>(field);
+    }
+
+    /// @brief Decode "onTime" field (see @ref ublox::message::CfgPmFields::onTime).
+    comms::ErrorStatus field_onTime(FieldType<FieldIdx_onTime>& field) const
+    {
+        return Base::readField<FieldIdx_onTime>(field);
+    }
+
+    /// @brief Decode "minAcqTime" field (see @ref ublox::message::CfgPmFields::minAcqTime).
+    comms::ErrorStatus field_minAcqTime(FieldType<FieldIdx_minAcqTime>& field) const
+    {
+        return Base::readField<FieldIdx_minAcqTime>(field);
+    }
+};
+
+} // namespace view
+
+} // namespace ublox
+
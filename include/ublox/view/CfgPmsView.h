@@ -0,0 +1,108 @@
+//
+// Copyright 2018 (C). Alex Robenko. All rights reserved.
+//
+
+// This file is free software: you can redistribute it and/or modify
+// it under the terms of the GNU General Public License as published by
+// the Free Software Foundation, either version 3 of the License, or
+// (at your option) any later version.
+//
+// This program is distributed in the hope that it will be useful,
+// but WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+// GNU General Public License for more details.
+//
+// You should have received a copy of the GNU General Public License
+// along with this program.  If not, see <http://www.gnu.org/licenses/>.
+
+/// @file
+/// @brief Contains definition of lazy view of CFG-PMS message.
+/// @details Generated by script/gen_views.py, do NOT edit manually.
+
+#pragma once
+
+#include "ublox/message/CfgPms.h"
+#include "MsgView.h"
+
+namespace ublox
+{
+
+namespace view
+{
+
+/// @brief Lazy read-only view of CFG-PMS message payload.
+/// @details Wraps the pointer to the validated payload, the fields are
+///     decoded on access only, see @ref MsgView.
+/// @see @ref ublox::message::CfgPms
+class CfgPmsView : public
+    MsgView<
+        ublox::message::CfgPmsFields::All
+    >
+{
+    using Base =
+        MsgView<
+            ublox::message::CfgPmsFields::All
+        >;
+
+public:
+    /// @brief ID of the viewed message.
+    static const MsgId MsgIdValue = MsgId_CFG_PMS;
+
+    /// @brief Index of the fields, same as the ones defined by
+    ///     @b COMMS_MSG_FIELDS_ACCESS() in @ref ublox::message::CfgPms.
+    enum FieldIdx
+    {
+        FieldIdx_version, ///< index of @b version field
+        FieldIdx_powerSetupValue, ///< index of @b powerSetupValue field
+        FieldIdx_period, ///< index of @b period field
+        FieldIdx_onTime, ///< index of @b onTime field
+        FieldIdx_reserved1, ///< index of @b reserved1 field
+        FieldIdx_numOfValues ///< number of available fields
+    };
+
+    /// @brief Default constructor, creates empty view.
+    CfgPmsView() = default;
+
+    /// @brief Constructor
+    /// @param[in] payload Pointer to the payload of the message.
+    /// @param[in] len Length of the payload.
+    CfgPmsView(const std::uint8_t* payload, std::size_t len)
+      : Base(payload, len)
+    {
+    }
+
+    /// @brief Decode "version" field (see @ref ublox::message::CfgPmsFields::version).
+    comms::ErrorStatus field_version(FieldType<FieldIdx_version>& field) const
+    {
+        return Base::readField<FieldIdx_version>(field);
+    }
+
+    /// @brief Decode "powerSetupValue" field (see @ref ublox::message::CfgPmsFields::powerSetupValue).
+    comms::ErrorStatus field_powerSetupValue(FieldType<FieldIdx_powerSetupValue>& field) const
+    {
+        return Base::readField<FieldIdx_powerSetupValue>(field);
+    }
+
+    /// @brief Decode "period" field (see @ref ublox::message::CfgPmsFields::period).
+    comms::ErrorStatus field_period(FieldType<FieldIdx_period>& field) const
+    {
+        return Base::readField<FieldIdx_period>(field);
+    }
+
+    /// @brief Decode "onTime" field (see @ref ublox::message::CfgPmsFields::onTime).
+    comms::ErrorStatus field_onTime(FieldType<FieldIdx_onTime>& field) const
+    {
+        return Base::readField<FieldIdx_onTime>(field);
+    }
+
+    /// @brief Decode "reserved1" field (see @ref ublox::message::CfgPmsFields::reserved1).
+    comms::ErrorStatus field_reserved1(FieldType<FieldIdx_reserved1>& field) const
+    {
+        return Base::readField<FieldIdx_reserved1>(field);
+    }
+};
+
+} // namespace view
+
+} // namespace ublox
+
@@ -0,0 +1,136 @@
+//
+// Copyright 2018 (C). Alex Robenko. All rights reserved.
+//
+
+// This file is free software: you can redistribute it and/or modify
+// it under the terms of the GNU General Public License as published by
+// the Free Software Foundation, either version 3 of the License, or
+// (at your option) any later version.
+//
+// This program is distributed in the hope that it will be useful,
+// but WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+// GNU General Public License for more details.
+//
+// You should have received a copy of the GNU General Public License
+// along with this program.  If not, see <http://www.gnu.org/licenses/>.
+
+/// @file
+/// @brief Contains definition of lazy view of CFG-PRT (@b DDC) message.
+/// @details Generated by script/gen_views.py, do NOT edit manually.
+
+#pragma once
+
+#include "ublox/message/CfgPrtDdc.h"
+#include "MsgView.h"
+
+namespace ublox
+{
+
+namespace view
+{
+
+/// @brief Lazy read-only view of CFG-PRT (@b DDC) message payload.
+/// @details Wraps the pointer to the validated payload, the fields are
+///     decoded on access only, see @ref MsgView.
+/// @see @ref ublox::message::CfgPrtDdc
+class CfgPrtDdcView : public
+    MsgView<
+        ublox::message::CfgPrtDdcFields::All
+    >
+{
+    using Base =
+        MsgView<
+            ublox::message::CfgPrtDdcFields::All
+        >;
+
+public:
+    /// @brief ID of the viewed message.
+    static const MsgId MsgIdValue = MsgId_CFG_PRT;
+
+    /// @brief Index of the fields, same as the ones defined by
+    ///     @b COMMS_MSG_FIELDS_ACCESS() in @ref ublox::message::CfgPrtDdc.
+    enum FieldIdx
+    {
+        FieldIdx_portID, ///< index of @b portID field
+        FieldIdx_reserved0, ///< index of @b reserved0 field
+        FieldIdx_txReady, ///< index of @b txReady field
+        FieldIdx_mode, ///< index of @b mode field
+        FieldIdx_reserved3, ///< index of @b reserved3 field
+        FieldIdx_inProtoMask, ///< index of @b inProtoMask field
+        FieldIdx_outProtoMask, ///< index of @b outProtoMask field
+        FieldIdx_flags, ///< index of @b flags field
+        FieldIdx_reserved5, ///< index of @b reserved5 field
+        FieldIdx_numOfValues ///< number of available fields
+    };
+
+    /// @brief Default constructor, creates empty view.
+    CfgPrtDdcView() = default;
+
+    /// @brief Constructor
+    /// @param[in] payload Pointer to the payload of the message.
+    /// @param[in] len Length of the payload.
+    CfgPrtDdcView(const std::uint8_t* payload, std::size_t len)
+      : Base(payload, len)
+    {
+    }
+
+    /// @brief Decode "portID" field (see @ref ublox::message::CfgPrtDdcFields::portID).
+    comms::ErrorStatus field_portID(FieldType<FieldIdx_portID>& field) const
+    {
+        return Base::readField<FieldIdx_portID>(field);
+    }
+
+    /// @brief Decode "reserved0" field (see @ref ublox::message::CfgPrtDdcFields::reserved0).
+    comms::ErrorStatus field_reserved0(FieldType<FieldIdx_reserved0>& field) const
+    {
+        return Base::readField<FieldIdx_reserved0>(field);
+    }
+
+    /// @brief Decode "txReady" field (see @ref ublox::message::CfgPrtFields::txReady).
+    comms::ErrorStatus field_txReady(FieldType<FieldIdx_txReady>& field) const
+    {
+        return Base::readField<FieldIdx_txReady>(field);
+    }
+
+    /// @brief Decode "mode" field (see @ref ublox::message::CfgPrtDdcFields::mode).
+    comms::ErrorStatus field_mode(FieldType<FieldIdx_mode>& field) const
+    {
+        return Base::readField<FieldIdx_mode>(field);
+    }
+
+    /// @brief Decode "reserved3" field (see @ref ublox::message::CfgPrtDdcFields::reserved3).
+    comms::ErrorStatus field_reserved3(FieldType<FieldIdx_reserved3>& field) const
+    {
+        return Base::readField<FieldIdx_reserved3>(field);
+    }
+
+    /// @brief Decode "inProtoMask" field (see @ref ublox::message::CfgPrtFields::inProtoMask).
+    comms::ErrorStatus field_inProtoMask(FieldType<FieldIdx_inProtoMask>& field) const
+    {
+        return Base::readField<FieldIdx_inProtoMask>(field);
+    }
+
+    /// @brief Decode "outProtoMask" field (see @ref ublox::message::CfgPrtFields::outProtoMask).
+    comms::ErrorStatus field_outProtoMask(FieldType<FieldIdx_outProtoMask>& field) const
+    {
+        return Base::readField<FieldIdx_outProtoMask>(field);
+    }
+
+    /// @brief Decode "flags" field (see @ref ublox::message::CfgPrtFields::flags).
+    comms::ErrorStatus field_flags(FieldType<FieldIdx_flags>& field) const
+    {
+        return Base::readField<FieldIdx_flags>(field);
+    }
+
+    /// @brief Decode "reserved5" field (see @ref ublox::message::CfgPrtDdcFields::reserved5).
+    comms::ErrorStatus field_reserved5(FieldType<FieldIdx_reserved5>& field) const
+    {
+        return Base::readField<FieldIdx_reserved5>(field);
+    }
+};
+
+} // namespace view
+
+} // namespace ublox
+
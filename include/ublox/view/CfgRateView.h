@@ -0,0 +1,94 @@
+//
+// Copyright 2018 (C). Alex Robenko. All rights reserved.
+//
+
+// This file is free software: you can redistribute it and/or modify
+// it under the terms of the GNU General Public License as published by
+// the Free Software Foundation, either version 3 of the License, or
+// (at your option) any later version.
+//
+// This program is distributed in the hope that it will be useful,
+// but WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+// GNU General Public License for more details.
+//
+// You should have received a copy of the GNU General Public License
+// along with this program.  If not, see <http://www.gnu.org/licenses/>.
+
+/// @file
+/// @brief Contains definition of lazy view of CFG-RATE message.
+/// @details Generated by script/gen_views.py, do NOT edit manually.
+
+#pragma once
+
+#include "ublox/message/CfgRate.h"
+#include "MsgView.h"
+
+namespace ublox
+{
+
+namespace view
+{
+
+/// @brief Lazy read-only view of CFG-RATE message payload.
+/// @details Wraps the pointer to the validated payload, the fields are
+///     decoded on access only, see @ref MsgView.
+/// @see @ref ublox::message::CfgRate
+class CfgRateView : public
+    MsgView<
+        ublox::message::CfgRateFields::All
+    >
+{
+    using Base =
+        MsgView<
+            ublox::message::CfgRateFields::All
+        >;
+
+public:
+    /// @brief ID of the viewed message.
+    static const MsgId MsgIdValue = MsgId_CFG_RATE;
+
+    /// @brief Index of the fields, same as the ones defined by
+    ///     @b COMMS_MSG_FIELDS_ACCESS() in @ref ublox::message::CfgRate.
+    enum FieldIdx
+    {
+        FieldIdx_measRate, ///< index of @b measRate field
+        FieldIdx_navRate, ///< index of @b navRate field
+        FieldIdx_timeRef, ///< index of @b timeRef field
+        FieldIdx_numOfValues ///< number of available fields
+    };
+
+    /// @brief Default constructor, creates empty view.
+    CfgRateView() = default;
+
+    /// @brief Constructor
+    /// @param[in] payload Pointer to the payload of the message.
+    /// @param[in] len Length of the payload.
+    CfgRateView(const std::uint8_t* payload, std::size_t len)
+      : Base(payload, len)
+    {
+    }
+
+    /// @brief Decode "measRate" field (see @ref ublox::message::CfgRateFields::measRate).
+    comms::ErrorStatus field_measRate(FieldType<FieldIdx_measRate>& field) const
+    {
+        return Base::readField<FieldIdx_measRate>(field);
+    }
+
+    /// @brief Decode "navRate" field (see @ref ublox::message::CfgRateFields::navRate).
+    comms::ErrorStatus field_navRate(FieldType<FieldIdx_navRate>& field) const
+    {
+        return Base::readField<FieldIdx_navRate>(field);
+    }
+
+    /// @brief Decode "timeRef" field (see @ref ublox::message::CfgRateFields::timeRef).
+    comms::ErrorStatus field_timeRef(FieldType<FieldIdx_timeRef>& field) const
+    {
+        return Base::readField<FieldIdx_timeRef>(field);
+    }
+};
+
+} // namespace view
+
+} // namespace ublox
+
@@ -0,0 +1,94 @@
+//
+// Copyright 2018 (C). Alex Robenko. All rights reserved.
+//
+
+// This file is free software: you can redistribute it and/or modify
+// it under the terms of the GNU General Public License as published by
+// the Free Software Foundation, either version 3 of the License, or
+// (at your option) any later version.
+//
+// This program is distributed in the hope that it will be useful,
+// but WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+// GNU General Public License for more details.
+//
+// You should have received a copy of the GNU General Public License
+// along with this program.  If not, see <http://www.gnu.org/licenses/>.
+
+/// @file
+/// @brief Contains definition of lazy view of CFG-RST message.
+/// @details Generated by script/gen_views.py, do NOT edit manually.
+
+#pragma once
+
+#include "ublox/message/CfgRst.h"
+#include "MsgView.h"
+
+namespace ublox
+{
+
+namespace view
+{
+
+/// @brief Lazy read-only view of CFG-RST message payload.
+/// @details Wraps the pointer to the validated payload, the fields are
+///     decoded on access only, see @ref MsgView.
+/// @see @ref ublox::message::CfgRst
+class CfgRstView : public
+    MsgView<
+        ublox::message::CfgRstFields::All
+    >
+{
+    using Base =
+        MsgView<
+            ublox::message::CfgRstFields::All
+        >;
+
+public:
+    /// @brief ID of the viewed message.
+    static const MsgId MsgIdValue = MsgId_CFG_RST;
+
+    /// @brief Index of the fields, same as the ones defined by
+    ///     @b COMMS_MSG_FIELDS_ACCESS() in @ref ublox::message::CfgRst.
+    enum FieldIdx
+    {
+        FieldIdx_navBbrMask, ///< index of @b navBbrMask field
+        FieldIdx_resetMode, ///< index of @b resetMode field
+        FieldIdx_reserved1, ///< index of @b reserved1 field
+        FieldIdx_numOfValues ///< number of available fields
+    };
+
+    /// @brief Default constructor, creates empty view.
+    CfgRstView() = default;
+
+    /// @brief Constructor
+    /// @param[in] payload Pointer to the payload of the message.
+    /// @param[in] len Length of the payload.
+    CfgRstView(const std::uint8_t* payload, std::size_t len)
+      : Base(payload, len)
+    {
+    }
+
+    /// @brief Decode "navBbrMask" field (see @ref ublox::message::CfgRstFields::navBbrMask).
+    comms::ErrorStatus field_navBbrMask(FieldType<FieldIdx_navBbrMask>& field) const
+    {
+        return Base::readField<FieldIdx_navBbrMask>(field);
+    }
+
+    /// @brief Decode "resetMode" field (see @ref ublox::message::CfgRstFields::resetMode).
+    comms::ErrorStatus field_resetMode(FieldType<FieldIdx_resetMode>& field) const
+    {
+        return Base::readField<FieldIdx_resetMode>(field);
+    }
+
+    /// @brief Decode "reserved1" field (see @ref ublox::message::CfgRstFields::reserved1).
+    comms::ErrorStatus field_reserved1(FieldType<FieldIdx_reserved1>& field) const
+    {
+        return Base::readField<FieldIdx_reserved1>(field);
+    }
+};
+
+} // namespace view
+
+} // namespace ublox
+
@@ -0,0 +1,108 @@
+//
+// Copyright 2018 (C). Alex Robenko. All rights reserved.
+//
+
+// This file is free software: you can redistribute it and/or modify
+// it under the terms of the GNU General Public License as published by
+// the Free Software Foundation, either version 3 of the License, or
+// (at your option) any later version.
+//
+// This program is distributed in the hope that it will be useful,
+// but WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+// GNU General Public License for more details.
+//
+// You should have received a copy of the GNU General Public License
+// along with this program.  If not, see <http://www.gnu.org/licenses/>.
+
+/// @file
+/// @brief Contains definition of lazy view of CFG-SBAS message.
+/// @details Generated by script/gen_views.py, do NOT edit manually.
+
+#pragma once
+
+#include "ublox/message/CfgSbas.h"
+#include "MsgView.h"
+
+namespace ublox
+{
+
+namespace view
+{
+
+/// @brief Lazy read-only view of CFG-SBAS message payload.
+/// @details Wraps the pointer to the validated payload, the fields are
+///     decoded on access only, see @ref MsgView.
+/// @see @ref ublox::message::CfgSbas
+class CfgSbasView : public
+    MsgView<
+        ublox::message::CfgSbasFields::All
+    >
+{
+    using Base =
+        MsgView<
+            ublox::message::CfgSbasFields::All
+        >;
+
+public:
+    /// @brief ID of the viewed message.
+    static const MsgId MsgIdValue = MsgId_CFG_SBAS;
+
+    /// @brief Index of the fields, same as the ones defined by
+    ///     @b COMMS_MSG_FIELDS_ACCESS() in @ref ublox::message::CfgSbas.
+    enum FieldIdx
+    {
+        FieldIdx_mode, ///< index of @b mode field
+        FieldIdx_usage, ///< index of @b usage field
+        FieldIdx_maxSBAS, ///< index of @b maxSBAS field
+        FieldIdx_scanmode2, ///< index of @b scanmode2 field
+        FieldIdx_scanmode1, ///< index of @b scanmode1 field
+        FieldIdx_numOfValues ///< number of available fields
+    };
+
+    /// @brief Default constructor, creates empty view.
+    CfgSbasView() = default;
+
+    /// @brief Constructor
+    /// @param[in] payload Pointer to the payload of the message.
+    /// @param[in] len Length of the payload.
+    CfgSbasView(const std::uint8_t* payload, std::size_t len)
+      : Base(payload, len)
+    {
+    }
+
+    /// @brief Decode "mode" field (see @ref ublox::message::CfgSbasFields::mode).
+    comms::ErrorStatus field_mode(FieldType<FieldIdx_mode>& field) const
+    {
+        return Base::readField<FieldIdx_mode>(field);
+    }
+
+    /// @brief Decode "usage" field (see @ref ublox::message::CfgSbasFields::usage).
+    comms::ErrorStatus field_usage(FieldType<FieldIdx_usage>& field) const
+    {
+        return Base::readField<FieldIdx_usage>(field);
+    }
+
+    /// @brief Decode "maxSBAS" field (see @ref ublox::message::CfgSbasFields::maxSBAS).
+    comms::ErrorStatus field_maxSBAS(FieldType<FieldIdx_maxSBAS>& field) const
+    {
+        return Base::readField<FieldIdx_maxSBAS>(field);
+    }
+
+    /// @brief Decode "scanmode2" field (see @ref ublox::message::CfgSbasFields::scanmode2).
+    comms::ErrorStatus field_scanmode2(FieldType<FieldIdx_scanmode2>& field) const
+    {
+        return Base::readField<FieldIdx_scanmode2>(field);
+    }
+
+    /// @brief Decode "scanmode1" field (see @ref ublox::message::CfgSbasFields::scanmode1).
+    comms::ErrorStatus field_scanmode1(FieldType<FieldIdx_scanmode1>& field) const
+    {
+        return Base::readField<FieldIdx_scanmode1>(field);
+    }
+};
+
+} // namespace view
+
+} // namespace ublox
+
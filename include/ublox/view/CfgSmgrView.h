@@ -0,0 +1,143 @@
+//
+// Copyright 2018 (C). Alex Robenko. All rights reserved.
+//
+
+// This file is free software: you can redistribute it and/or modify
+// it under the terms of the GNU General Public License as published by
+// the Free Software Foundation, either version 3 of the License, or
+// (at your option) any later version.
+//
+// This program is distributed in the hope that it will be useful,
+// but WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+// GNU General Public License for more details.
+//
+// You should have received a copy of the GNU General Public License
+// along with this program.  If not, see <http://www.gnu.org/licenses/>.
+
+/// @file
+/// @brief Contains definition of lazy view of CFG-SMGR message.
+/// @details Generated by script/gen_views.py, do NOT edit manually.
+
+#pragma once
+
+#include "ublox/message/CfgSmgr.h"
+#include "MsgView.h"
+
+namespace ublox
+{
+
+namespace view
+{
+
+/// @brief Lazy read-only view of CFG-SMGR message payload.
+/// @details Wraps the pointer to the validated payload, the fields are
+///     decoded on access only, see @ref MsgView.
+/// @see @ref ublox::message::CfgSmgr
+class CfgSmgrView : public
+    MsgView<
+        ublox::message::CfgSmgrFields::All
+    >
+{
+    using Base =
+        MsgView<
+            ublox::message::CfgSmgrFields::All
+        >;
+
+public:
+    /// @brief ID of the viewed message.
+    static const MsgId MsgIdValue = MsgId_CFG_SMGR;
+
+    /// @brief Index of the fields, same as the ones defined by
+    ///     @b COMMS_MSG_FIELDS_ACCESS() in @ref ublox::message::CfgSmgr.
+    enum FieldIdx
+    {
+        FieldIdx_version, ///< index of @b version field
+        FieldIdx_minGNSSFix, ///< index of @b minGNSSFix field
+        FieldIdx_maxFreqChangeRate, ///< index of @b maxFreqChangeRate field
+        FieldIdx_maxPhaseCorrRate, ///< index of @b maxPhaseCorrRate field
+        FieldIdx_reserved1, ///< index of @b reserved1 field
+        FieldIdx_freqTolerance, ///< index of @b freqTolerance field
+        FieldIdx_timeTolerance, ///< index of @b timeTolerance field
+        FieldIdx_messageCfg, ///< index of @b messageCfg field
+        FieldIdx_maxSlewRate, ///< index of @b maxSlewRate field
+        FieldIdx_flags, ///< index of @b flags field
+        FieldIdx_numOfValues ///< number of available fields
+    };
+
+    /// @brief Default constructor, creates empty view.
+    CfgSmgrView() = default;
+
+    /// @brief Constructor
+    /// @param[in] payload Pointer to the payload of the message.
+    /// @param[in] len Length of the payload.
+    CfgSmgrView(const std::uint8_t* payload, std::size_t len)
+      : Base(payload, len)
+    {
+    }
+
+    /// @brief Decode "version" field (see @ref ublox::message::CfgSmgrFields::version).
+    comms::ErrorStatus field_version(FieldType<FieldIdx_version>& field) const
+    {
+        return Base::readField<FieldIdx_version>(field);
+    }
+
+    /// @brief Decode "minGNSSFix" field (see @ref ublox::message::CfgSmgrFields::minGNSSFix).
+    comms::ErrorStatus field_minGNSSFix(FieldType<FieldIdx_minGNSSFix>& field) const
+    {
+        return Base::readField<FieldIdx_minGNSSFix>(field);
+    }
+
+    /// @brief Decode "maxFreqChangeRate" field (see @ref ublox::message::CfgSmgrFields::maxFreqChangeRate).
+    comms::ErrorStatus field_maxFreqChangeRate(FieldType<FieldIdx_maxFreqChangeRate>& field) const
+    {
+        return Base::readField<FieldIdx_maxFreqChangeRate>(field);
+    }
+
+    /// @brief Decode "maxPhaseCorrRate" field (see @ref ublox::message::CfgSmgrFields::maxPhaseCorrRate).
+    comms::ErrorStatus field_maxPhaseCorrRate(FieldType<FieldIdx_maxPhaseCorrRate>& field) const
+    {
+        return Base::readField<FieldIdx_maxPhaseCorrRate>(field);
+    }
+
+    /// @brief Decode "reserved1" field (see @ref ublox::message::CfgSmgrFields::reserved1).
+    comms::ErrorStatus field_reserved1(FieldType<FieldIdx_reserved1>& field) const
+    {
+        return Base::readField<FieldIdx_reserved1>(field);
+    }
+
+    /// @brief Decode "freqTolerance" field (see @ref ublox::message::CfgSmgrFields::freqTolerance).
+    comms::ErrorStatus field_freqTolerance(FieldType<FieldIdx_freqTolerance>& field) const
+    {
+        return Base::readField<FieldIdx_freqTolerance>(field);
+    }
+
+    /// @brief Decode "timeTolerance" field (see @ref ublox::message::CfgSmgrFields::timeTolerance).
+    comms::ErrorStatus field_timeTolerance(FieldType<FieldIdx_timeTolerance>& field) const
+    {
+        return Base::readField<FieldIdx_timeTolerance>(field);
+    }
+
+    /// @brief Decode "messageCfg" field (see @ref ublox::message::CfgSmgrFields::messageCfg).
+    comms::ErrorStatus field_messageCfg(FieldType<FieldIdx_messageCfg>& field) const
+    {
+        return Base::readField<FieldIdx_messageCfg>(field);
+    }
+
+    /// @brief Decode "maxSlewRate" field (see @ref ublox::message::CfgSmgrFields::maxSlewRate).
+    comms::ErrorStatus field_maxSlewRate(FieldType<FieldIdx_maxSlewRate>& field) const
+    {
+        return Base::readField<FieldIdx_maxSlewRate>(field);
+    }
+
+    /// @brief Decode "flags" field (see @ref ublox::message::CfgSmgrFields::flags).
+    comms::ErrorStatus field_flags(FieldType<FieldIdx_flags>& field) const
+    {
+        return Base::readField<FieldIdx_flags>(field);
+    }
+};
+
+} // namespace view
+
+} // namespace ublox
+
@@ -0,0 +1,106 @@
+//
+// Copyright 2018 (C). Alex Robenko. All rights reserved.
+//
+
+// This file is free software: you can redistribute it and/or modify
+// it under the terms of the GNU General Public License as published by
+// the Free Software Foundation, either version 3 of the License, or
+// (at your option) any later version.
+//
+// This program is distributed in the hope that it will be useful,
+// but WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+// GNU General Public License for more details.
+//
+// You should have received a copy of the GNU General Public License
+// along with this program.  If not, see <http://www.gnu.org/licenses/>.
+
+/// @file
+/// @brief Contains definition of lazy view of AID-TMODE2 message.
+/// @details Generated by script/gen_views.py, do NOT edit manually.
+
+#pragma once
+
+#include "ublox/message/CfgTmode2.h"
+#include "MsgView.h"
+
+namespace ublox
+{
+
+namespace view
+{
+
+/// @brief Lazy read-only view of AID-TMODE2 message payload.
+/// @details Wraps the pointer to the validated payload, the fields are
+///     decoded on access only, see @ref MsgView.
+///     The message performs custom read of its fields, the fields starting
+///     from "ecefX" are not accessible through the view, because their
+///     presence and/or size depend on the values of preceding fields.
+/// @see @ref ublox::message::CfgTmode2
+class CfgTmode2View : public
+    MsgView<
+        ublox::message::CfgTmode2Fields::All
+    >
+{
+    using Base =
+        MsgView<
+            ublox::message::CfgTmode2Fields::All
+        >;
+
+public:
+    /// @brief ID of the viewed message.
+    static const MsgId MsgIdValue = MsgId_CFG_TMODE2;
+
+    /// @brief Index of the fields, same as the ones defined by
+    ///     @b COMMS_MSG_FIELDS_ACCESS() in @ref ublox::message::CfgTmode2.
+    enum FieldIdx
+    {
+        FieldIdx_timeMode, ///< index of @b timeMode field
+        FieldIdx_reserved1, ///< index of @b reserved1 field
+        FieldIdx_flags, ///< index of @b flags field
+        FieldIdx_ecefX, ///< index of @b ecefX field
+        FieldIdx_lat, ///< index of @b lat field
+        FieldIdx_ecefY, ///< index of @b ecefY field
+        FieldIdx_lon, ///< index of @b lon field
+        FieldIdx_ecefZ, ///< index of @b ecefZ field
+        FieldIdx_alt, ///< index of @b alt field
+        FieldIdx_fixedPosAcc, ///< index of @b fixedPosAcc field
+        FieldIdx_svinMinDur, ///< index of @b svinMinDur field
+        FieldIdx_svinAccLimit, ///< index of @b svinAccLimit field
+        FieldIdx_numOfValues ///< number of available fields
+    };
+
+    /// @brief Default constructor, creates empty view.
+    CfgTmode2View() = default;
+
+    /// @brief Constructor
+    /// @param[in] payload Pointer to the payload of the message.
+    /// @param[in] len Length of the payload.
+    CfgTmode2View(const std::uint8_t* payload, std::size_t len)
+      : Base(payload, len)
+    {
+    }
+
+    /// @brief Decode "timeMode" field (see @ref ublox::message::CfgTmode2Fields::timeMode).
+    comms::ErrorStatus field_timeMode(FieldType<FieldIdx_timeMode>& field) const
+    {
+        return Base::readField<FieldIdx_timeMode>(field);
+    }
+
+    /// @brief Decode "reserved1" field (see @ref ublox::message::CfgTmode2Fields::reserved1).
+    comms::ErrorStatus field_reserved1(FieldType<FieldIdx_reserved1>& field) const
+    {
+        return Base::readField<FieldIdx_reserved1>(field);
+    }
+
+    /// @brief Decode "flags" field (see @ref ublox::message::CfgTmode2Fields::flags).
+    comms::ErrorStatus field_flags(FieldType<FieldIdx_flags>& field) const
+    {
+        return Base::readField<FieldIdx_flags>(field);
+    }
+};
+
+} // namespace view
+
+} // namespace ublox
+
@@ -0,0 +1,122 @@
+//
+// Copyright 2018 (C). Alex Robenko. All rights reserved.
+//
+
+// This file is free software: you can redistribute it and/or modify
+// it under the terms of the GNU General Public License as published by
+// the Free Software Foundation, either version 3 of the License, or
+// (at your option) any later version.
+//
+// This program is distributed in the hope that it will be useful,
+// but WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+// GNU General Public License for more details.
+//
+// You should have received a copy of the GNU General Public License
+// along with this program.  If not, see <http://www.gnu.org/licenses/>.
+
+/// @file
+/// @brief Contains definition of lazy view of CFG-TMODE message.
+/// @details Generated by script/gen_views.py, do NOT edit manually.
+
+#pragma once
+
+#include "ublox/message/CfgTmode.h"
+#include "MsgView.h"
+
+namespace ublox
+{
+
+namespace view
+{
+
+/// @brief Lazy read-only view of CFG-TMODE message payload.
+/// @details Wraps the pointer to the validated payload, the fields are
+///     decoded on access only, see @ref MsgView.
+/// @see @ref ublox::message::CfgTmode
+class CfgTmodeView : public
+    MsgView<
+        ublox::message::CfgTmodeFields::All
+    >
+{
+    using Base =
+        MsgView<
+            ublox::message::CfgTmodeFields::All
+        >;
+
+public:
+    /// @brief ID of the viewed message.
+    static const MsgId MsgIdValue = MsgId_CFG_TMODE;
+
+    /// @brief Index of the fields, same as the ones defined by
+    ///     @b COMMS_MSG_FIELDS_ACCESS() in @ref ublox::message::CfgTmode.
+    enum FieldIdx
+    {
+        FieldIdx_timeMode, ///< index of @b timeMode field
+        FieldIdx_fixedPosX, ///< index of @b fixedPosX field
+        FieldIdx_fixedPosY, ///< index of @b fixedPosY field
+        FieldIdx_fixedPosZ, ///< index of @b fixedPosZ field
+        FieldIdx_fixedPosVar, ///< index of @b fixedPosVar field
+        FieldIdx_svinMinDur, ///< index of @b svinMinDur field
+        FieldIdx_svinVarLimit, ///< index of @b svinVarLimit field
+        FieldIdx_numOfValues ///< number of available fields
+    };
+
+    /// @brief Default constructor, creates empty view.
+    CfgTmodeView() = default;
+
+    /// @brief Constructor
+    /// @param[in] payload Pointer to the payload of the message.
+    /// @param[in] len Length of the payload.
+    CfgTmodeView(const std::uint8_t* payload, std::size_t len)
+      : Base(payload, len)
+    {
+    }
+
+    /// @brief Decode "timeMode" field (see @ref ublox::message::CfgTmodeFields::timeMode).
+    comms::ErrorStatus field_timeMode(FieldType<FieldIdx_timeMode>& field) const
+    {
+        return Base::readField<FieldIdx_timeMode>(field);
+    }
+
+    /// @brief Decode "fixedPosX" field (see @ref ublox::message::CfgTmodeFields::fixedPosX).
+    comms::ErrorStatus field_fixedPosX(FieldType<FieldIdx_fixedPosX>& field) const
+    {
+        return Base::readField<FieldIdx_fixedPosX>(field);
+    }
+
+    /// @brief Decode "fixedPosY" field (see @ref ublox::message::CfgTmodeFields::fixedPosY).
+    comms::ErrorStatus field_fixedPosY(FieldType<FieldIdx_fixedPosY>& field) const
+    {
+        return Base::readField<FieldIdx_fixedPosY>(field);
+    }
+
+    /// @brief Decode "fixedPosZ" field (see @ref ublox::message::CfgTmodeFields::fixedPosZ).
+    comms::ErrorStatus field_fixedPosZ(FieldType<FieldIdx_fixedPosZ>& field) const
+    {
+        return Base::readField<FieldIdx_fixedPosZ>(field);
+    }
+
+    /// @brief Decode "fixedPosVar" field (see @ref ublox::message::CfgTmodeFields::fixedPosVar).
+    comms::ErrorStatus field_fixedPosVar(FieldType<FieldIdx_fixedPosVar>& field) const
+    {
+        return Base::readField<FieldIdx_fixedPosVar>(field);
+    }
+
+    /// @brief Decode "svinMinDur" field (see @ref ublox::message::CfgTmodeFields::svinMinDur).
+    comms::ErrorStatus field_svinMinDur(FieldType<FieldIdx_svinMinDur>& field) const
+    {
+        return Base::readField<FieldIdx_svinMinDur>(field);
+    }
+
+    /// @brief Decode "svinVarLimit" field (see @ref ublox::message::CfgTmodeFields::svinVarLimit).
+    comms::ErrorStatus field_svinVarLimit(FieldType<FieldIdx_svinVarLimit>& field) const
+    {
+        return Base::readField<FieldIdx_svinVarLimit>(field);
+    }
+};
+
+} // namespace view
+
+} // namespace ublox
+
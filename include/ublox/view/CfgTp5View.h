@@ -0,0 +1,117 @@
+//
+// Copyright 2018 (C). Alex Robenko. All rights reserved.
+//
+
+// This file is free software: you can redistribute it and/or modify
+// it under the terms of the GNU General Public License as published by
+// the Free Software Foundation, either version 3 of the License, or
+// (at your option) any later version.
+//
+// This program is distributed in the hope that it will be useful,
+// but WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+// GNU General Public License for more details.
+//
+// You should have received a copy of the GNU General Public License
+// along with this program.  If not, see <http://www.gnu.org/licenses/>.
+
+/// @file
+/// @brief Contains definition of lazy view of CFG-TP5 message.
+/// @details Generated by script/gen_views.py, do NOT edit manually.
+
+#pragma once
+
+#include "ublox/message/CfgTp5.h"
+#include "MsgView.h"
+
+namespace ublox
+{
+
+namespace view
+{
+
+/// @brief Lazy read-only view of CFG-TP5 message payload.
+/// @details Wraps the pointer to the validated payload, the fields are
+///     decoded on access only, see @ref MsgView.
+///     The message performs custom read of its fields, the fields starting
+///     from "freqPeriod" are not accessible through the view, because their
+///     presence and/or size depend on the values of preceding fields.
+/// @see @ref ublox::message::CfgTp5
+class CfgTp5View : public
+    MsgView<
+        ublox::message::CfgTp5Fields::All
+    >
+{
+    using Base =
+        MsgView<
+            ublox::message::CfgTp5Fields::All
+        >;
+
+public:
+    /// @brief ID of the viewed message.
+    static const MsgId MsgIdValue = MsgId_CFG_TP5;
+
+    /// @brief Index of the fields, same as the ones defined by
+    ///     @b COMMS_MSG_FIELDS_ACCESS() in @ref ublox::message::CfgTp5.
+    enum FieldIdx
+    {
+        FieldIdx_tpIdx, ///< index of @b tpIdx field
+        FieldIdx_version, ///< index of @b version field
+        FieldIdx_reserved1, ///< index of @b reserved1 field
+        FieldIdx_antCableDelay, ///< index of @b antCableDelay field
+        FieldIdx_rfGroupDelay, ///< index of @b rfGroupDelay field
+        FieldIdx_freqPeriod, ///< index of @b freqPeriod field
+        FieldIdx_freqPeriodLock, ///< index of @b freqPeriodLock field
+        FieldIdx_pulseLenRatio, ///< index of @b pulseLenRatio field
+        FieldIdx_pulseLenRatioLock, ///< index of @b pulseLenRatioLock field
+        FieldIdx_userConfigDelay, ///< index of @b userConfigDelay field
+        FieldIdx_flags, ///< index of @b flags field
+        FieldIdx_numOfValues ///< number of available fields
+    };
+
+    /// @brief Default constructor, creates empty view.
+    CfgTp5View() = default;
+
+    /// @brief Constructor
+    /// @param[in] payload Pointer to the payload of the message.
+    /// @param[in] len Length of the payload.
+    CfgTp5View(const std::uint8_t* payload, std::size_t len)
+      : Base(payload, len)
+    {
+    }
+
+    /// @brief Decode "tpIdx" field (see @ref ublox::message::CfgTp5Fields::tpIdx).
+    comms::ErrorStatus field_tpIdx(FieldType<FieldIdx_tpIdx>& field) const
+    {
+        return Base::readField<FieldIdx_tpIdx>(field);
+    }
+
+    /// @brief Decode "version" field (see @ref ublox::message::CfgTp5Fields::version).
+    comms::ErrorStatus field_version(FieldType<FieldIdx_version>& field) const
+    {
+        return Base::readField<FieldIdx_version>(field);
+    }
+
+    /// @brief Decode "reserved1" field (see @ref ublox::message::CfgTp5Fields::reserved1).
+    comms::ErrorStatus field_reserved1(FieldType<FieldIdx_reserved1>& field) const
+    {
+        return Base::readField<FieldIdx_reserved1>(field);
+    }
+
+    /// @brief Decode "antCableDelay" field (see @ref ublox::message::CfgTp5Fields::antCableDelay).
+    comms::ErrorStatus field_antCableDelay(FieldType<FieldIdx_antCableDelay>& field) const
+    {
+        return Base::readField<FieldIdx_antCableDelay>(field);
+    }
+
+    /// @brief Decode "rfGroupDelay" field (see @ref ublox::message::CfgTp5Fields::rfGroupDelay).
+    comms::ErrorStatus field_rfGroupDelay(FieldType<FieldIdx_rfGroupDelay>& field) const
+    {
+        return Base::readField<FieldIdx_rfGroupDelay>(field);
+    }
+};
+
+} // namespace view
+
+} // namespace ublox
+
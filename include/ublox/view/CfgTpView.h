@@ -0,0 +1,136 @@
+//
+// Copyright 2018 (C). Alex Robenko. All rights reserved.
+//
+
+// This file is free software: you can redistribute it and/or modify
+// it under the terms of the GNU General Public License as published by
+// the Free Software Foundation, either version 3 of the License, or
+// (at your option) any later version.
+//
+// This program is distributed in the hope that it will be useful,
+// but WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+// GNU General Public License for more details.
+//
+// You should have received a copy of the GNU General Public License
+// along with this program.  If not, see <http://www.gnu.org/licenses/>.
+
+/// @file
+/// @brief Contains definition of lazy view of CFG-TP message.
+/// @details Generated by script/gen_views.py, do NOT edit manually.
+
+#pragma once
+
+#include "ublox/message/CfgTp.h"
+#include "MsgView.h"
+
+namespace ublox
+{
+
+namespace view
+{
+
+/// @brief Lazy read-only view of CFG-TP message payload.
+/// @details Wraps the pointer to the validated payload, the fields are
+///     decoded on access only, see @ref MsgView.
+/// @see @ref ublox::message::CfgTp
+class CfgTpView : public
+    MsgView<
+        ublox::message::CfgTpFields::All
+    >
+{
+    using Base =
+        MsgView<
+            ublox::message::CfgTpFields::All
+        >;
+
+public:
+    /// @brief ID of the viewed message.
+    static const MsgId MsgIdValue = MsgId_CFG_TP;
+
+    /// @brief Index of the fields, same as the ones defined by
+    ///     @b COMMS_MSG_FIELDS_ACCESS() in @ref ublox::message::CfgTp.
+    enum FieldIdx
+    {
+        FieldIdx_interval, ///< index of @b interval field
+        FieldIdx_length, ///< index of @b length field
+        FieldIdx_status, ///< index of @b status field
+        FieldIdx_timeRef, ///< index of @b timeRef field
+        FieldIdx_flags, ///< index of @b flags field
+        FieldIdx_res, ///< index of @b res field
+        FieldIdx_antennaCableDelay, ///< index of @b antennaCableDelay field
+        FieldIdx_rfGroupDelay, ///< index of @b rfGroupDelay field
+        FieldIdx_userDelay, ///< index of @b userDelay field
+        FieldIdx_numOfValues ///< number of available fields
+    };
+
+    /// @brief Default constructor, creates empty view.
+    CfgTpView() = default;
+
+    /// @brief Constructor
+    /// @param[in] payload Pointer to the payload of the message.
+    /// @param[in] len Length of the payload.
+    CfgTpView(const std::uint8_t* payload, std::size_t len)
+      : Base(payload, len)
+    {
+    }
+
+    /// @brief Decode "interval" field (see @ref ublox::message::CfgTpFields::interval).
+    comms::ErrorStatus field_interval(FieldType<FieldIdx_interval>& field) const
+    {
+        return Base::readField<FieldIdx_interval>(field);
+    }
+
+    /// @brief Decode "length" field (see @ref ublox::message::CfgTpFields::length).
+    comms::ErrorStatus field_length(FieldType<FieldIdx_length>& field) const
+    {
+        return Base::readField<FieldIdx_length>(field);
+    }
+
+    /// @brief Decode "status" field (see @ref ublox::message::CfgTpFields::status).
+    comms::ErrorStatus field_status(FieldType<FieldIdx_status>& field) const
+    {
+        return Base::readField<FieldIdx_status>(field);
+    }
+
+    /// @brief Decode "timeRef" field (see @ref ublox::message::CfgTpFields::timeRef).
+    comms::ErrorStatus field_timeRef(FieldType<FieldIdx_timeRef>& field) const
+    {
+        return Base::readField<FieldIdx_timeRef>(field);
+    }
+
+    /// @brief Decode "flags" field (see @ref ublox::message::CfgTpFields::flags).
+    comms::ErrorStatus field_flags(FieldType<FieldIdx_flags>& field) const
+    {
+        return Base::readField<FieldIdx_flags>(field);
+    }
+
+    /// @brief Decode "res" field (see @ref ublox::message::CfgTpFields::res).
+    comms::ErrorStatus field_res(FieldType<FieldIdx_res>& field) const
+    {
+        return Base::readField<FieldIdx_res>(field);
+    }
+
+    /// @brief Decode "antennaCableDelay" field (see @ref ublox::message::CfgTpFields::antennaCableDelay).
+    comms::ErrorStatus field_antennaCableDelay(FieldType<FieldIdx_antennaCableDelay>& field) const
+    {
+        return Base::readField<FieldIdx_antennaCableDelay>(field);
+    }
+
+    /// @brief Decode "rfGroupDelay" field (see @ref ublox::message::CfgTpFields::rfGroupDelay).
+    comms::ErrorStatus field_rfGroupDelay(FieldType<FieldIdx_rfGroupDelay>& field) const
+    {
+        return Base::readField<FieldIdx_rfGroupDelay>(field);
+    }
+
+    /// @brief Decode "userDelay" field (see @ref ublox::message::CfgTpFields::userDelay).
+    comms::ErrorStatus field_userDelay(FieldType<FieldIdx_userDelay>& field) const
+    {
+        return Base::readField<FieldIdx_userDelay>(field);
+    }
+};
+
+} // namespace view
+
+} // namespace ublox
+
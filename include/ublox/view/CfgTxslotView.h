@@ -0,0 +1,122 @@
+//
+// Copyright 2018 (C). Alex Robenko. All rights reserved.
+//
+
+// This file is free software: you can redistribute it and/or modify
+// it under the terms of the GNU General Public License as published by
+// the Free Software Foundation, either version 3 of the License, or
+// (at your option) any later version.
+//
+// This program is distributed in the hope that it will be useful,
+// but WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+// GNU General Public License for more details.
+//
+// You should have received a copy of the GNU General Public License
+// along with this program.  If not, see <http://www.gnu.org/licenses/>.
+
+/// @file
+/// @brief Contains definition of lazy view of CFG-TXSLOT message.
+/// @details Generated by script/gen_views.py, do NOT edit manually.
+
+#pragma once
+
+#include "ublox/message/CfgTxslot.h"
+#include "MsgView.h"
+
+namespace ublox
+{
+
+namespace view
+{
+
+/// @brief Lazy read-only view of CFG-TXSLOT message payload.
+/// @details Wraps the pointer to the validated payload, the fields are
+///     decoded on access only, see @ref MsgView.
+/// @see @ref ublox::message::CfgTxslot
+class CfgTxslotView : public
+    MsgView<
+        ublox::message::CfgTxslotFields::All
+    >
+{
+    using Base =
+        MsgView<
+            ublox::message::CfgTxslotFields::All
+        >;
+
+public:
+    /// @brief ID of the viewed message.
+    static const MsgId MsgIdValue = MsgId_CFG_TXSLOT;
+
+    /// @brief Index of the fields, same as the ones defined by
+    ///     @b COMMS_MSG_FIELDS_ACCESS() in @ref ublox::message::CfgTxslot.
+    enum FieldIdx
+    {
+        FieldIdx_version, ///< index of @b version field
+        FieldIdx_enable, ///< index of @b enable field
+        FieldIdx_refTp, ///< index of @b refTp field
+        FieldIdx_reserved1, ///< index of @b reserved1 field
+        FieldIdx_end0, ///< index of @b end0 field
+        FieldIdx_end1, ///< index of @b end1 field
+        FieldIdx_end2, ///< index of @b end2 field
+        FieldIdx_numOfValues ///< number of available fields
+    };
+
+    /// @brief Default constructor, creates empty view.
+    CfgTxslotView() = default;
+
+    /// @brief Constructor
+    /// @param[in] payload Pointer to the payload of the message.
+    /// @param[in] len Length of the payload.
+    CfgTxslotView(const std::uint8_t* payload, std::size_t len)
+      : Base(payload, len)
+    {
+    }
+
+    /// @brief Decode "version" field (see @ref ublox::message::CfgTxslotFields::version).
+    comms::ErrorStatus field_version(FieldType<FieldIdx_version>& field) const
+    {
+        return Base::readField<FieldIdx_version>(field);
+    }
+
+    /// @brief Decode "enable" field (see @ref ublox::message::CfgTxslotFields::enable).
+    comms::ErrorStatus field_enable(FieldType<FieldIdx_enable>& field) const
+    {
+        return Base::readField<FieldIdx_enable>(field);
+    }
+
+    /// @brief Decode "refTp" field (see @ref ublox::message::CfgTxslotFields::refTp).
+    comms::ErrorStatus field_refTp(FieldType<FieldIdx_refTp>& field) const
+    {
+        return Base::readField<FieldIdx_refTp>(field);
+    }
+
+    /// @brief Decode "reserved1" field (see @ref ublox::message::CfgTxslotFields::reserved1).
+    comms::ErrorStatus field_reserved1(FieldType<FieldIdx_reserved1>& field) const
+    {
+        return Base::readField<FieldIdx_reserved1>(field);
+    }
+
+    /// @brief Decode "end0" field (see @ref ublox::message::CfgTxslotFields::end0).
+    comms::ErrorStatus field_end0(FieldType<FieldIdx_end0>& field) const
+    {
+        return Base::readField<FieldIdx_end0>(field);
+    }
+
+    /// @brief Decode "end1" field (see @ref ublox::message::CfgTxslotFields::end1).
+    comms::ErrorStatus field_end1(FieldType<FieldIdx_end1>& field) const
+    {
+        return Base::readField<FieldIdx_end1>(field);
+    }
+
+    /// @brief Decode "end2" field (see @ref ublox::message::CfgTxslotFields::end2).
+    comms::ErrorStatus field_end2(FieldType<FieldIdx_end2>& field) const
+    {
+        return Base::readField<FieldIdx_end2>(field);
+    }
+};
+
+} // namespace view
+
+} // namespace ublox
+
@@ -0,0 +1,136 @@
+//
+// Copyright 2018 (C). Alex Robenko. All rights reserved.
+//
+
+// This file is free software: you can redistribute it and/or modify
+// it under the terms of the GNU General Public License as published by
+// the Free Software Foundation, either version 3 of the License, or
+// (at your option) any later version.
+//
+// This program is distributed in the hope that it will be useful,
+// but WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+// GNU General Public License for more details.
+//
+// You should have received a copy of the GNU General Public License
+// along with this program.  If not, see <http://www.gnu.org/licenses/>.
+
+/// @file
+/// @brief Contains definition of lazy view of CFG-USB message.
+/// @details Generated by script/gen_views.py, do NOT edit manually.
+
+#pragma once
+
+#include "ublox/message/CfgUsb.h"
+#include "MsgView.h"
+
+namespace ublox
+{
+
+namespace view
+{
+
+/// @brief Lazy read-only view of CFG-USB message payload.
+/// @details Wraps the pointer to the validated payload, the fields are
+///     decoded on access only, see @ref MsgView.
+/// @see @ref ublox::message::CfgUsb
+class CfgUsbView : public
+    MsgView<
+        ublox::message::CfgUsbFields::All<comms::option::EmptyOption>
+    >
+{
+    using Base =
+        MsgView<
+            ublox::message::CfgUsbFields::All<comms::option::EmptyOption>
+        >;
+
+public:
+    /// @brief ID of the viewed message.
+    static const MsgId MsgIdValue = MsgId_CFG_USB;
+
+    /// @brief Index of the fields, same as the ones defined by
+    ///     @b COMMS_MSG_FIELDS_ACCESS() in @ref ublox::message::CfgUsb.
+    enum FieldIdx
+    {
+        FieldIdx_vendorID, ///< index of @b vendorID field
+        FieldIdx_productID, ///< index of @b productID field
+        FieldIdx_reserved1, ///< index of @b reserved1 field
+        FieldIdx_reserved2, ///< index of @b reserved2 field
+        FieldIdx_powerConsumption, ///< index of @b powerConsumption field
+        FieldIdx_flags, ///< index of @b flags field
+        FieldIdx_vendorString, ///< index of @b vendorString field
+        FieldIdx_productString, ///< index of @b productString field
+        FieldIdx_serialNumber, ///< index of @b serialNumber field
+        FieldIdx_numOfValues ///< number of available fields
+    };
+
+    /// @brief Default constructor, creates empty view.
+    CfgUsbView() = default;
+
+    /// @brief Constructor
+    /// @param[in] payload Pointer to the payload of the message.
+    /// @param[in] len Length of the payload.
+    CfgUsbView(const std::uint8_t* payload, std::size_t len)
+      : Base(payload, len)
+    {
+    }
+
+    /// @brief Decode "vendorID" field (see @ref ublox::message::CfgUsbFields::vendorID).
+    comms::ErrorStatus field_vendorID(FieldType<FieldIdx_vendorID>& field) const
+    {
+        return Base::readField<FieldIdx_vendorID>(field);
+    }
+
+    /// @brief Decode "productID" field (see @ref ublox::message::CfgUsbFields::productID).
+    comms::ErrorStatus field_productID(FieldType<FieldIdx_productID>& field) const
+    {
+        return Base::readField<FieldIdx_productID>(field);
+    }
+
+    /// @brief Decode "reserved1" field (see @ref ublox::message::CfgUsbFields::reserved1).
+    comms::ErrorStatus field_reserved1(FieldType<FieldIdx_reserved1>& field) const
+    {
+        return Base::readField<FieldIdx_reserved1>(field);
+    }
+
+    /// @brief Decode "reserved2" field (see @ref ublox::message::CfgUsbFields::reserved2).
+    comms::ErrorStatus field_reserved2(FieldType<FieldIdx_reserved2>& field) const
+    {
+        return Base::readField<FieldIdx_reserved2>(field);
+    }
+
+    /// @brief Decode "powerConsumption" field (see @ref ublox::message::CfgUsbFields::powerConsumption).
+    comms::ErrorStatus field_powerConsumption(FieldType<FieldIdx_powerConsumption>& field) const
+    {
+        return Base::readField<FieldIdx_powerConsumption>(field);
+    }
+
+    /// @brief Decode "flags" field (see @ref ublox::message::CfgUsbFields::flags).
+    comms::ErrorStatus field_flags(FieldType<FieldIdx_flags>& field) const
+    {
+        return Base::readField<FieldIdx_flags>(field);
+    }
+
+    /// @brief Decode "vendorString" field (see @ref ublox::message::CfgUsbFields::vendorString).
+    comms::ErrorStatus field_vendorString(FieldType<FieldIdx_vendorString>& field) const
+    {
+        return Base::readField<FieldIdx_vendorString>(field);
+    }
+
+    /// @brief Decode "productString" field (see @ref ublox::message::CfgUsbFields::productString).
+    comms::ErrorStatus field_productString(FieldType<FieldIdx_productString>& field) const
+    {
+        return Base::readField<FieldIdx_productString>(field);
+    }
+
+    /// @brief Decode "serialNumber" field (see @ref ublox::message::CfgUsbFields::serialNumber).
+    comms::ErrorStatus field_serialNumber(FieldType<FieldIdx_serialNumber>& field) const
+    {
+        return Base::readField<FieldIdx_serialNumber>(field);
+    }
+};
+
+} // namespace view
+
+} // namespace ublox
+
@@ -0,0 +1,143 @@
+//
+// Copyright 2018 (C). Alex Robenko. All rights reserved.
+//
+
+// This file is free software: you can redistribute it and/or modify
+// it under the terms of the GNU General Public License as published by
+// the Free Software Foundation, either version 3 of the License, or
+// (at your option) any later version.
+//
+// This program is distributed in the hope that it will be useful,
+// but WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+// GNU General Public License for more details.
+//
+// You should have received a copy of the GNU General Public License
+// along with this program.  If not, see <http://www.gnu.org/licenses/>.
+
+/// @file
+/// @brief Contains definition of lazy view of ESF-INS message.
+/// @details Generated by script/gen_views.py, do NOT edit manually.
+
+#pragma once
+
+#include "ublox/message/EsfIns.h"
+#include "MsgView.h"
+
+namespace ublox
+{
+
+namespace view
+{
+
+/// @brief Lazy read-only view of ESF-INS message payload.
+/// @details Wraps the pointer to the validated payload, the fields are
+///     decoded on access only, see @ref MsgView.
+/// @see @ref ublox::message::EsfIns
+class EsfInsView : public
+    MsgView<
+        ublox::message::EsfInsFields::All
+    >
+{
+    using Base =
+        MsgView<
+            ublox::message::EsfInsFields::All
+        >;
+
+public:
+    /// @brief ID of the viewed message.
+    static const MsgId MsgIdValue = MsgId_ESF_INS;
+
+    /// @brief Index of the fields, same as the ones defined by
+    ///     @b COMMS_MSG_FIELDS_ACCESS() in @ref ublox::message::EsfIns.
+    enum FieldIdx
+    {
+        FieldIdx_version, ///< index of @b version field
+        FieldIdx_bitfield0, ///< index of @b bitfield0 field
+        FieldIdx_reserved1, ///< index of @b reserved1 field
+        FieldIdx_iTOW, ///< index of @b iTOW field
+        FieldIdx_xAngRate, ///< index of @b xAngRate field
+        FieldIdx_yAngRate, ///< index of @b yAngRate field
+        FieldIdx_zAngRate, ///< index of @b zAngRate field
+        FieldIdx_xAccel, ///< index of @b xAccel field
+        FieldIdx_yAccel, ///< index of @b yAccel field
+        FieldIdx_zAccel, ///< index of @b zAccel field
+        FieldIdx_numOfValues ///< number of available fields
+    };
+
+    /// @brief Default constructor, creates empty view.
+    EsfInsView() = default;
+
+    /// @brief Constructor
+    /// @param[in] payload Pointer to the payload of the message.
+    /// @param[in] len Length of the payload.
+    EsfInsView(const std::uint8_t* payload, std::size_t len)
+      : Base(payload, len)
+    {
+    }
+
+    /// @brief Decode "version" field (see @ref ublox::message::EsfInsFields::version).
+    comms::ErrorStatus field_version(FieldType<FieldIdx_version>& field) const
+    {
+        return Base::readField<FieldIdx_version>(field);
+    }
+
+    /// @brief Decode "bitfield0" field (see @ref ublox::message::EsfInsFields::bitfield0).
+    comms::ErrorStatus field_bitfield0(FieldType<FieldIdx_bitfield0>& field) const
+    {
+        return Base::readField<FieldIdx_bitfield0>(field);
+    }
+
+    /// @brief Decode "reserved1" field (see @ref ublox::message::EsfInsFields::reserved1).
+    comms::ErrorStatus field_reserved1(FieldType<FieldIdx_reserved1>& field) const
+    {
+        return Base::readField<FieldIdx_reserved1>(field);
+    }
+
+    /// @brief Decode "iTOW" field (see @ref ublox::message::EsfInsFields::iTOW).
+    comms::ErrorStatus field_iTOW(FieldType<FieldIdx_iTOW>& field) const
+    {
+        return Base::readField<FieldIdx_iTOW>(field);
+    }
+
+    /// @brief Decode "xAngRate" field (see @ref ublox::message::EsfInsFields::xAngRate).
+    comms::ErrorStatus field_xAngRate(FieldType<FieldIdx_xAngRate>& field) const
+    {
+        return Base::readField<FieldIdx_xAngRate>(field);
+    }
+
+    /// @brief Decode "yAngRate" field (see @ref ublox::message::EsfInsFields::yAngRate).
+    comms::ErrorStatus field_yAngRate(FieldType<FieldIdx_yAngRate>& field) const
+    {
+        return Base::readField<FieldIdx_yAngRate>(field);
+    }
+
+    /// @brief Decode "zAngRate" field (see @ref ublox::message::EsfInsFields::zAngRate).
+    comms::ErrorStatus field_zAngRate(FieldType<FieldIdx_zAngRate>& field) const
+    {
+        return Base::readField<FieldIdx_zAngRate>(field);
+    }
+
+    /// @brief Decode "xAccel" field (see @ref ublox::message::EsfInsFields::xAccel).
+    comms::ErrorStatus field_xAccel(FieldType<FieldIdx_xAccel>& field) const
+    {
+        return Base::readField<FieldIdx_xAccel>(field);
+    }
+
+    /// @brief Decode "yAccel" field (see @ref ublox::message::EsfInsFields::yAccel).
+    comms::ErrorStatus field_yAccel(FieldType<FieldIdx_yAccel>& field) const
+    {
+        return Base::readField<FieldIdx_yAccel>(field);
+    }
+
+    /// @brief Decode "zAccel" field (see @ref ublox::message::EsfInsFields::zAccel).
+    comms::ErrorStatus field_zAccel(FieldType<FieldIdx_zAccel>& field) const
+    {
+        return Base::readField<FieldIdx_zAccel>(field);
+    }
+};
+
+} // namespace view
+
+} // namespace ublox
+
@@ -0,0 +1,119 @@
+//
+// Copyright 2018 (C). Alex Robenko. All rights reserved.
+//
+
+// This file is free software: you can redistribute it and/or modify
+// it under the terms of the GNU General Public License as published by
+// the Free Software Foundation, either version 3 of the License, or
+// (at your option) any later version.
+//
+// This program is distributed in the hope that it will be useful,
+// but WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+// GNU General Public License for more details.
+//
+// You should have received a copy of the GNU General Public License
+// along with this program.  If not, see <http://www.gnu.org/licenses/>.
+
+/// @file
+/// @brief Contains definition of lazy view of ESF-STATUS message.
+/// @details Generated by script/gen_views.py, do NOT edit manually.
+
+#pragma once
+
+#include "ublox/message/EsfStatus.h"
+#include "MsgView.h"
+
+namespace ublox
+{
+
+namespace view
+{
+
+/// @brief Lazy read-only view of ESF-STATUS message payload.
+/// @details Wraps the pointer to the validated payload, the fields are
+///     decoded on access only, see @ref MsgView.
+///     The message performs custom read of its fields, the fields starting
+///     from "data" are not accessible through the view, because their
+///     presence and/or size depend on the values of preceding fields.
+/// @see @ref ublox::message::EsfStatus
+class EsfStatusView : public
+    MsgView<
+        ublox::message::EsfStatusFields::All<comms::option::EmptyOption>
+    >
+{
+    using Base =
+        MsgView<
+            ublox::message::EsfStatusFields::All<comms::option::EmptyOption>
+        >;
+
+public:
+    /// @brief ID of the viewed message.
+    static const MsgId MsgIdValue = MsgId_ESF_STATUS;
+
+    /// @brief Index of the fields, same as the ones defined by
+    ///     @b COMMS_MSG_FIELDS_ACCESS() in @ref ublox::message::EsfStatus.
+    enum FieldIdx
+    {
+        FieldIdx_iTOW, ///< index of @b iTOW field
+        FieldIdx_version, ///< index of @b version field
+        FieldIdx_reserved1, ///< index of @b reserved1 field
+        FieldIdx_fusionMode, ///< index of @b fusionMode field
+        FieldIdx_reserved2, ///< index of @b reserved2 field
+        FieldIdx_numSens, ///< index of @b numSens field
+        FieldIdx_data, ///< index of @b data field
+        FieldIdx_numOfValues ///< number of available fields
+    };
+
+    /// @brief Default constructor, creates empty view.
+    EsfStatusView() = default;
+
+    /// @brief Constructor
+    /// @param[in] payload Pointer to the payload of the message.
+    /// @param[in] len Length of the payload.
+    EsfStatusView(const std::uint8_t* payload, std::size_t len)
+      : Base(payload, len)
+    {
+    }
+
+    /// @brief Decode "iTOW" field (see @ref ublox::message::EsfStatusFields::iTOW).
+    comms::ErrorStatus field_iTOW(FieldType<FieldIdx_iTOW>& field) const
+    {
+        return Base::readField<FieldIdx_iTOW>(field);
+    }
+
+    /// @brief Decode "version" field (see @ref ublox::message::EsfStatusFields::version).
+    comms::ErrorStatus field_version(FieldType<FieldIdx_version>& field) const
+    {
+        return Base::readField<FieldIdx_version>(field);
+    }
+
+    /// @brief Decode "reserved1" field (see @ref ublox::message::EsfStatusFields::reserved1).
+    comms::ErrorStatus field_reserved1(FieldType<FieldIdx_reserved1>& field) const
+    {
+        return Base::readField<FieldIdx_reserved1>(field);
+    }
+
+    /// @brief Decode "fusionMode" field (see @ref ublox::message::EsfStatusFields::fusionMode).
+    comms::ErrorStatus field_fusionMode(FieldType<FieldIdx_fusionMode>& field) const
+    {
+        return Base::readField<FieldIdx_fusionMode>(field);
+    }
+
+    /// @brief Decode "reserved2" field (see @ref ublox::message::EsfStatusFields::reserved2).
+    comms::ErrorStatus field_reserved2(FieldType<FieldIdx_reserved2>& field) const
+    {
+        return Base::readField<FieldIdx_reserved2>(field);
+    }
+
+    /// @brief Decode "numSens" field (see @ref ublox::message::EsfStatusFields::numSens).
+    comms::ErrorStatus field_numSens(FieldType<FieldIdx_numSens>& field) const
+    {
+        return Base::readField<FieldIdx_numSens>(field);
+    }
+};
+
+} // namespace view
+
+} // namespace ublox
+
@@ -0,0 +1,248 @@
+//
+// Copyright 2018 (C). Alex Robenko. All rights reserved.
+//
+
+// This file is free software: you can redistribute it and/or modify
+// it under the terms of the GNU General Public License as published by
+// the Free Software Foundation, either version 3 of the License, or
+// (at your option) any later version.
+//
+// This program is distributed in the hope that it will be useful,
+// but WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+// GNU General Public License for more details.
+//
+// You should have received a copy of the GNU General Public License
+// along with this program.  If not, see <http://www.gnu.org/licenses/>.
+
+/// @file
+/// @brief Contains definition of lazy view of HNR-PVT message.
+/// @details Generated by script/gen_views.py, do NOT edit manually.
+
+#pragma once
+
+#include "ublox/message/HnrPvt.h"
+#include "MsgView.h"
+
+namespace ublox
+{
+
+namespace view
+{
+
+/// @brief Lazy read-only view of HNR-PVT message payload.
+/// @details Wraps the pointer to the validated payload, the fields are
+///     decoded on access only, see @ref MsgView.
+/// @see @ref ublox::message::HnrPvt
+class HnrPvtView : public
+    MsgView<
+        ublox::message::HnrPvtFields::All
+    >
+{
+    using Base =
+        MsgView<
+            ublox::message::HnrPvtFields::All
+        >;
+
+public:
+    /// @brief ID of the viewed message.
+    static const MsgId MsgIdValue = MsgId_HNR_PVT;
+
+    /// @brief Index of the fields, same as the ones defined by
+    ///     @b COMMS_MSG_FIELDS_ACCESS() in @ref ublox::message::HnrPvt.
+    enum FieldIdx
+    {
+        FieldIdx_iTOW, ///< index of @b iTOW field
+        FieldIdx_year, ///< index of @b year field
+        FieldIdx_month, ///< index of @b month field
+        FieldIdx_day, ///< index of @b day field
+        FieldIdx_hour, ///< index of @b hour field
+        FieldIdx_min, ///< index of @b min field
+        FieldIdx_sec, ///< index of @b sec field
+        FieldIdx_validBits, ///< index of @b validBits field
+        FieldIdx_nano, ///< index of @b nano field
+        FieldIdx_gpsFix, ///< index of @b gpsFix field
+        FieldIdx_flags, ///< index of @b flags field
+        FieldIdx_reserved1, ///< index of @b reserved1 field
+        FieldIdx_lon, ///< index of @b lon field
+        FieldIdx_lat, ///< index of @b lat field
+        FieldIdx_height, ///< index of @b height field
+        FieldIdx_hMSL, ///< index of @b hMSL field
+        FieldIdx_gSpeed, ///< index of @b gSpeed field
+        FieldIdx_speed, ///< index of @b speed field
+        FieldIdx_headMot, ///< index of @b headMot field
+        FieldIdx_headVeh, ///< index of @b headVeh field
+        FieldIdx_hAcc, ///< index of @b hAcc field
+        FieldIdx_vAcc, ///< index of @b vAcc field
+        FieldIdx_sAcc, ///< index of @b sAcc field
+        FieldIdx_headAcc, ///< index of @b headAcc field
+        FieldIdx_reserved2, ///< index of @b reserved2 field
+        FieldIdx_numOfValues ///< number of available fields
+    };
+
+    /// @brief Default constructor, creates empty view.
+    HnrPvtView() = default;
+
+    /// @brief Constructor
+    /// @param[in] payload Pointer to the payload of the message.
+    /// @param[in] len Length of the payload.
+    HnrPvtView(const std::uint8_t* payload, std::size_t len)
+      : Base(payload, len)
+    {
+    }
+
+    /// @brief Decode "iTOW" field (see @ref ublox::message::HnrPvtFields::iTOW).
+    comms::ErrorStatus field_iTOW(FieldType<FieldIdx_iTOW>& field) const
+    {
+        return Base::readField<FieldIdx_iTOW>(field);
+    }
+
+    /// @brief Decode "year" field (see @ref ublox::message::HnrPvtFields::year).
+    comms::ErrorStatus field_year(FieldType<FieldIdx_year>& field) const
+    {
+        return Base::readField<FieldIdx_year>(field);
+    }
+
+    /// @brief Decode "month" field (see @ref ublox::message::HnrPvtFields::month).
+    comms::ErrorStatus field_month(FieldType<FieldIdx_month>& field) const
+    {
+        return Base::readField<FieldIdx_month>(field);
+    }
+
+    /// @brief Decode "day" field (see @ref ublox::message::HnrPvtFields::day).
+    comms::ErrorStatus field_day(FieldType<FieldIdx_day>& field) const
+    {
+        return Base::readField<FieldIdx_day>(field);
+    }
+
+    /// @brief Decode "hour" field (see @ref ublox::message::HnrPvtFields::hour).
+    comms::ErrorStatus field_hour(FieldType<FieldIdx_hour>& field) const
+    {
+        return Base::readField<FieldIdx_hour>(field);
+    }
+
+    /// @brief Decode "min" field (see @ref ublox::message::HnrPvtFields::min).
+    comms::ErrorStatus field_min(FieldType<FieldIdx_min>& field) const
+    {
+        return Base::readField<FieldIdx_min>(field);
+    }
+
+    /// @brief Decode "sec" field (see @ref ublox::message::HnrPvtFields::sec).
+    comms::ErrorStatus field_sec(FieldType<FieldIdx_sec>& field) const
+    {
+        return Base::readField<FieldIdx_sec>(field);
+    }
+
+    /// @brief Decode "validBits" field (see @ref ublox::message::HnrPvtFields::validBits).
+    comms::ErrorStatus field_validBits(FieldType<FieldIdx_validBits>& field) const
+    {
+        return Base::readField<FieldIdx_validBits>(field);
+    }
+
+    /// @brief Decode "nano" field (see @ref ublox::message::HnrPvtFields::nano).
+    comms::ErrorStatus field_nano(FieldType<FieldIdx_nano>& field) const
+    {
+        return Base::readField<FieldIdx_nano>(field);
+    }
+
+    /// @brief Decode "gpsFix" field (see @ref ublox::message::HnrPvtFields::gpsFix).
+    comms::ErrorStatus field_gpsFix(FieldType<FieldIdx_gpsFix>& field) const
+    {
+        return Base::readField<FieldIdx_gpsFix>(field);
+    }
+
+    /// @brief Decode "flags" field (see @ref ublox::message::HnrPvtFields::flags).
+    comms::ErrorStatus field_flags(FieldType<FieldIdx_flags>& field) const
+    {
+        return Base::readField<FieldIdx_flags>(field);
+    }
+
+    /// @brief Decode "reserved1" field (see @ref ublox::message::HnrPvtFields::reserved1).
+    comms::ErrorStatus field_reserved1(FieldType<FieldIdx_reserved1>& field) const
+    {
+        return Base::readField<FieldIdx_reserved1>(field);
+    }
+
+    /// @brief Decode "lon" field (see @ref ublox::message::HnrPvtFields::lon).
+    comms::ErrorStatus field_lon(FieldType<FieldIdx_lon>& field) const
+    {
+        return Base::readField<FieldIdx_lon>(field);
+    }
+
+    /// @brief Decode "lat" field (see @ref ublox::message::HnrPvtFields::lat).
+    comms::ErrorStatus field_lat(FieldType<FieldIdx_lat>& field) const
+    {
+        return Base::readField<FieldIdx_lat>(field);
+    }
+
+    /// @brief Decode "height" field (see @ref ublox::message::HnrPvtFields::height).
+    comms::ErrorStatus field_height(FieldType<FieldIdx_height>& field) const
+    {
+        return Base::readField<FieldIdx_height>(field);
+    }
+
+    /// @brief Decode "hMSL" field (see @ref ublox::message::HnrPvtFields::hMSL).
+    comms::ErrorStatus field_hMSL(FieldType<FieldIdx_hMSL>& field) const
+    {
+        return Base::readField<FieldIdx_hMSL>(field);
+    }
+
+    /// @brief Decode "gSpeed" field (see @ref ublox::message::HnrPvtFields::gSpeed).
+    comms::ErrorStatus field_gSpeed(FieldType<FieldIdx_gSpeed>& field) const
+    {
+        return Base::readField<FieldIdx_gSpeed>(field);
+    }
+
+    /// @brief Decode "speed" field (see @ref ublox::message::HnrPvtFields::speed).
+    comms::ErrorStatus field_speed(FieldType<FieldIdx_speed>& field) const
+    {
+        return Base::readField<FieldIdx_speed>(field);
+    }
+
+    /// @brief Decode "headMot" field (see @ref ublox::message::HnrPvtFields::headMot).
+    comms::ErrorStatus field_headMot(FieldType<FieldIdx_headMot>& field) const
+    {
+        return Base::readField<FieldIdx_headMot>(field);
+    }
+
+    /// @brief Decode "headVeh" field (see @ref ublox::message::HnrPvtFields::headVeh).
+    comms::ErrorStatus field_headVeh(FieldType<FieldIdx_headVeh>& field) const
+    {
+        return Base::readField<FieldIdx_headVeh>(field);
+    }
+
+    /// @brief Decode "hAcc" field (see @ref ublox::message::HnrPvtFields::hAcc).
+    comms::ErrorStatus field_hAcc(FieldType<FieldIdx_hAcc>& field) const
+    {
+        return Base::readField<FieldIdx_hAcc>(field);
+    }
+
+    /// @brief Decode "vAcc" field (see @ref ublox::message::HnrPvtFields::vAcc).
+    comms::ErrorStatus field_vAcc(FieldType<FieldIdx_vAcc>& field) const
+    {
+        return Base::readField<FieldIdx_vAcc>(field);
+    }
+
+    /// @brief Decode "sAcc" field (see @ref ublox::message::HnrPvtFields::sAcc).
+    comms::ErrorStatus field_sAcc(FieldType<FieldIdx_sAcc>& field) const
+    {
+        return Base::readField<FieldIdx_sAcc>(field);
+    }
+
+    /// @brief Decode "headAcc" field (see @ref ublox::message::HnrPvtFields::headAcc).
+    comms::ErrorStatus field_headAcc(FieldType<FieldIdx_headAcc>& field) const
+    {
+        return Base::readField<FieldIdx_headAcc>(field);
+    }
+
+    /// @brief Decode "reserved2" field (see @ref ublox::message::HnrPvtFields::reserved2).
+    comms::ErrorStatus field_reserved2(FieldType<FieldIdx_reserved2>& field) const
+    {
+        return Base::readField<FieldIdx_reserved2>(field);
+    }
+};
+
+} // namespace view
+
+} // namespace ublox
+
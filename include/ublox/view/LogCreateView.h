@@ -0,0 +1,108 @@
+//
+// Copyright 2018 (C). Alex Robenko. All rights reserved.
+//
+
+// This file is free software: you can redistribute it and/or modify
+// it under the terms of the GNU General Public License as published by
+// the Free Software Foundation, either version 3 of the License, or
+// (at your option) any later version.
+//
+// This program is distributed in the hope that it will be useful,
+// but WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+// GNU General Public License for more details.
+//
+// You should have received a copy of the GNU General Public License
+// along with this program.  If not, see <http://www.gnu.org/licenses/>.
+
+/// @file
+/// @brief Contains definition of lazy view of LOG-CREATE message.
+/// @details Generated by script/gen_views.py, do NOT edit manually.
+
+#pragma once
+
+#include "ublox/message/LogCreate.h"
+#include "MsgView.h"
+
+namespace ublox
+{
+
+namespace view
+{
+
+/// @brief Lazy read-only view of LOG-CREATE message payload.
+/// @details Wraps the pointer to the validated payload, the fields are
+///     decoded on access only, see @ref MsgView.
+/// @see @ref ublox::message::LogCreate
+class LogCreateView : public
+    MsgView<
+        ublox::message::LogCreateFields::All
+    >
+{
+    using Base =
+        MsgView<
+            ublox::message::LogCreateFields::All
+        >;
+
+public:
+    /// @brief ID of the viewed message.
+    static const MsgId MsgIdValue = MsgId_LOG_CREATE;
+
+    /// @brief Index of the fields, same as the ones defined by
+    ///     @b COMMS_MSG_FIELDS_ACCESS() in @ref ublox::message::LogCreate.
+    enum FieldIdx
+    {
+        FieldIdx_version, ///< index of @b version field
+        FieldIdx_logCfg, ///< index of @b logCfg field
+        FieldIdx_reserved, ///< index of @b reserved field
+        FieldIdx_logSize, ///< index of @b logSize field
+        FieldIdx_userDefinedSize, ///< index of @b userDefinedSize field
+        FieldIdx_numOfValues ///< number of available fields
+    };
+
+    /// @brief Default constructor, creates empty view.
+    LogCreateView() = default;
+
+    /// @brief Constructor
+    /// @param[in] payload Pointer to the payload of the message.
+    /// @param[in] len Length of the payload.
+    LogCreateView(const std::uint8_t* payload, std::size_t len)
+      : Base(payload, len)
+    {
+    }
+
+    /// @brief Decode "version" field (see @ref ublox::message::LogCreateFields::version).
+    comms::ErrorStatus field_version(FieldType<FieldIdx_version>& field) const
+    {
+        return Base::readField<FieldIdx_version>(field);
+    }
+
+    /// @brief Decode "logCfg" field (see @ref ublox::message::LogCreateFields::logCfg).
+    comms::ErrorStatus field_logCfg(FieldType<FieldIdx_logCfg>& field) const
+    {
+        return Base::readField<FieldIdx_logCfg>(field);
+    }
+
+    /// @brief Decode "reserved" field (see @ref ublox::message::LogCreateFields::reserved).
+    comms::ErrorStatus field_reserved(FieldType<FieldIdx_reserved>& field) const
+    {
+        return Base::readField<FieldIdx_reserved>(field);
+    }
+
+    /// @brief Decode "logSize" field (see @ref ublox::message::LogCreateFields::logSize).
+    comms::ErrorStatus field_logSize(FieldType<FieldIdx_logSize>& field) const
+    {
+        return Base::readField<FieldIdx_logSize>(field);
+    }
+
+    /// @brief Decode "userDefinedSize" field (see @ref ublox::message::LogCreateFields::userDefinedSize).
+    comms::ErrorStatus field_userDefinedSize(FieldType<FieldIdx_userDefinedSize>& field) const
+    {
+        return Base::readField<FieldIdx_userDefinedSize>(field);
+    }
+};
+
+} // namespace view
+
+} // namespace ublox
+
@@ -0,0 +1,143 @@
+//
+// Copyright 2018 (C). Alex Robenko. All rights reserved.
+//
+
+// This file is free software: you can redistribute it and/or modify
+// it under the terms of the GNU General Public License as published by
+// the Free Software Foundation, either version 3 of the License, or
+// (at your option) any later version.
+//
+// This program is distributed in the hope that it will be useful,
+// but WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+// GNU General Public License for more details.
+//
+// You should have received a copy of the GNU General Public License
+// along with this program.  If not, see <http://www.gnu.org/licenses/>.
+
+/// @file
+/// @brief Contains definition of lazy view of LOG-FINDTIME (@b command) message.
+/// @details Generated by script/gen_views.py, do NOT edit manually.
+
+#pragma once
+
+#include "ublox/message/LogFindtimeCmd.h"
+#include "MsgView.h"
+
+namespace ublox
+{
+
+namespace view
+{
+
+/// @brief Lazy read-only view of LOG-FINDTIME (@b command) message payload.
+/// @details Wraps the pointer to the validated payload, the fields are
+///     decoded on access only, see @ref MsgView.
+/// @see @ref ublox::message::LogFindtimeCmd
+class LogFindtimeCmdView : public
+    MsgView<
+        ublox::message::LogFindtimeCmdFields::All
+    >
+{
+    using Base =
+        MsgView<
+            ublox::message::LogFindtimeCmdFields::All
+        >;
+
+public:
+    /// @brief ID of the viewed message.
+    static const MsgId MsgIdValue = MsgId_LOG_FINDTIME;
+
+    /// @brief Index of the fields, same as the ones defined by
+    ///     @b COMMS_MSG_FIELDS_ACCESS() in @ref ublox::message::LogFindtimeCmd.
+    enum FieldIdx
+    {
+        FieldIdx_version, ///< index of @b version field
+        FieldIdx_type, ///< index of @b type field
+        FieldIdx_reserved1, ///< index of @b reserved1 field
+        FieldIdx_year, ///< index of @b year field
+        FieldIdx_month, ///< index of @b month field
+        FieldIdx_day, ///< index of @b day field
+        FieldIdx_hour, ///< index of @b hour field
+        FieldIdx_minute, ///< index of @b minute field
+        FieldIdx_second, ///< index of @b second field
+        FieldIdx_reserved2, ///< index of @b reserved2 field
+        FieldIdx_numOfValues ///< number of available fields
+    };
+
+    /// @brief Default constructor, creates empty view.
+    LogFindtimeCmdView() = default;
+
+    /// @brief Constructor
+    /// @param[in] payload Pointer to the payload of the message.
+    /// @param[in] len Length of the payload.
+    LogFindtimeCmdView(const std::uint8_t* payload, std::size_t len)
+      : Base(payload, len)
+    {
+    }
+
+    /// @brief Decode "version" field (see @ref ublox::message::LogFindtimeCmdFields::version).
+    comms::ErrorStatus field_version(FieldType<FieldIdx_version>& field) const
+    {
+        return Base::readField<FieldIdx_version>(field);
+    }
+
+    /// @brief Decode "type" field (see @ref ublox::message::LogFindtimeCmdFields::type).
+    comms::ErrorStatus field_type(FieldType<FieldIdx_type>& field) const
+    {
+        return Base::readField<FieldIdx_type>(field);
+    }
+
+    /// @brief Decode "reserved1" field (see @ref ublox::message::LogFindtimeCmdFields::reserved1).
+    comms::ErrorStatus field_reserved1(FieldType<FieldIdx_reserved1>& field) const
+    {
+        return Base::readField<FieldIdx_reserved1>(field);
+    }
+
+    /// @brief Decode "year" field (see @ref ublox::message::LogFindtimeCmdFields::year).
+    comms::ErrorStatus field_year(FieldType<FieldIdx_year>& field) const
+    {
+        return Base::readField<FieldIdx_year>(field);
+    }
+
+    /// @brief Decode "month" field (see @ref ublox::message::LogFindtimeCmdFields::month).
+    comms::ErrorStatus field_month(FieldType<FieldIdx_month>& field) const
+    {
+        return Base::readField<FieldIdx_month>(field);
+    }
+
+    /// @brief Decode "day" field (see @ref ublox::message::LogFindtimeCmdFields::day).
+    comms::ErrorStatus field_day(FieldType<FieldIdx_day>& field) const
+    {
+        return Base::readField<FieldIdx_day>(field);
+    }
+
+    /// @brief Decode "hour" field (see @ref ublox::message::LogFindtimeCmdFields::hour).
+    comms::ErrorStatus field_hour(FieldType<FieldIdx_hour>& field) const
+    {
+        return Base::readField<FieldIdx_hour>(field);
+    }
+
+    /// @brief Decode "minute" field (see @ref ublox::message::LogFindtimeCmdFields::minute).
+    comms::ErrorStatus field_minute(FieldType<FieldIdx_minute>& field) const
+    {
+        return Base::readField<FieldIdx_minute>(field);
+    }
+
+    /// @brief Decode "second" field (see @ref ublox::message::LogFindtimeCmdFields::second).
+    comms::ErrorStatus field_second(FieldType<FieldIdx_second>& field) const
+    {
+        return Base::readField<FieldIdx_second>(field);
+    }
+
+    /// @brief Decode "reserved2" field (see @ref ublox::message::LogFindtimeCmdFields::reserved2).
+    comms::ErrorStatus field_reserved2(FieldType<FieldIdx_reserved2>& field) const
+    {
+        return Base::readField<FieldIdx_reserved2>(field);
+    }
+};
+
+} // namespace view
+
+} // namespace ublox
+
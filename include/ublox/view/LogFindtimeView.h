@@ -0,0 +1,101 @@
+//
+// Copyright 2018 (C). Alex Robenko. All rights reserved.
+//
+
+// This file is free software: you can redistribute it and/or modify
+// it under the terms of the GNU General Public License as published by
+// the Free Software Foundation, either version 3 of the License, or
+// (at your option) any later version.
+//
+// This program is distributed in the hope that it will be useful,
+// but WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+// GNU General Public License for more details.
+//
+// You should have received a copy of the GNU General Public License
+// along with this program.  If not, see <http://www.gnu.org/licenses/>.
+
+/// @file
+/// @brief Contains definition of lazy view of LOG-FINDTIME message.
+/// @details Generated by script/gen_views.py, do NOT edit manually.
+
+#pragma once
+
+#include "ublox/message/LogFindtime.h"
+#include "MsgView.h"
+
+namespace ublox
+{
+
+namespace view
+{
+
+/// @brief Lazy read-only view of LOG-FINDTIME message payload.
+/// @details Wraps the pointer to the validated payload, the fields are
+///     decoded on access only, see @ref MsgView.
+/// @see @ref ublox::message::LogFindtime
+class LogFindtimeView : public
+    MsgView<
+        ublox::message::LogFindtimeFields::All
+    >
+{
+    using Base =
+        MsgView<
+            ublox::message::LogFindtimeFields::All
+        >;
+
+public:
+    /// @brief ID of the viewed message.
+    static const MsgId MsgIdValue = MsgId_LOG_FINDTIME;
+
+    /// @brief Index of the fields, same as the ones defined by
+    ///     @b COMMS_MSG_FIELDS_ACCESS() in @ref ublox::message::LogFindtime.
+    enum FieldIdx
+    {
+        FieldIdx_version, ///< index of @b version field
+        FieldIdx_type, ///< index of @b type field
+        FieldIdx_reserved1, ///< index of @b reserved1 field
+        FieldIdx_entryNumber, ///< index of @b entryNumber field
+        FieldIdx_numOfValues ///< number of available fields
+    };
+
+    /// @brief Default constructor, creates empty view.
+    LogFindtimeView() = default;
+
+    /// @brief Constructor
+    /// @param[in] payload Pointer to the payload of the message.
+    /// @param[in] len Length of the payload.
+    LogFindtimeView(const std::uint8_t* payload, std::size_t len)
+      : Base(payload, len)
+    {
+    }
+
+    /// @brief Decode "version" field (see @ref ublox::message::LogFindtimeFields::version).
+    comms::ErrorStatus field_version(FieldType<FieldIdx_version>& field) const
+    {
+        return Base::readField<FieldIdx_version>(field);
+    }
+
+    /// @brief Decode "type" field (see @ref ublox::message::LogFindtimeFields::type).
+    comms::ErrorStatus field_type(FieldType<FieldIdx_type>& field) const
+    {
+        return Base::readField<FieldIdx_type>(field);
+    }
+
+    /// @brief Decode "reserved1" field (see @ref ublox::message::LogFindtimeFields::reserved1).
+    comms::ErrorStatus field_reserved1(FieldType<FieldIdx_reserved1>& field) const
+    {
+        return Base::readField<FieldIdx_reserved1>(field);
+    }
+
+    /// @brief Decode "entryNumber" field (see @ref ublox::message::LogFindtimeFields::entryNumber).
+    comms::ErrorStatus field_entryNumber(FieldType<FieldIdx_entryNumber>& field) const
+    {
+        return Base::readField<FieldIdx_entryNumber>(field);
+    }
+};
+
+} // namespace view
+
+} // namespace ublox
+
@@ -0,0 +1,241 @@
+//
+// Copyright 2018 (C). Alex Robenko. All rights reserved.
+//
+
+// This file is free software: you can redistribute it and/or modify
+// it under the terms of the GNU General Public License as published by
+// the Free Software Foundation, either version 3 of the License, or
+// (at your option) any later version.
+//
+// This program is distributed in the hope that it will be useful,
+// but WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+// GNU General Public License for more details.
+//
+// You should have received a copy of the GNU General Public License
+// along with this program.  If not, see <http://www.gnu.org/licenses/>.
+
+/// @file
+/// @brief Contains definition of lazy view of LOG-INFO message.
+/// @details Generated by script/gen_views.py, do NOT edit manually.
+
+#pragma once
+
+#include "ublox/message/LogInfo.h"
+#include "MsgView.h"
+
+namespace ublox
+{
+
+namespace view
+{
+
+/// @brief Lazy read-only view of LOG-INFO message payload.
+/// @details Wraps the pointer to the validated payload, the fields are
+///     decoded on access only, see @ref MsgView.
+/// @see @ref ublox::message::LogInfo
+class LogInfoView : public
+    MsgView<
+        ublox::message::LogInfoFields::All
+    >
+{
+    using Base =
+        MsgView<
+            ublox::message::LogInfoFields::All
+        >;
+
+public:
+    /// @brief ID of the viewed message.
+    static const MsgId MsgIdValue = MsgId_LOG_INFO;
+
+    /// @brief Index of the fields, same as the ones defined by
+    ///     @b COMMS_MSG_FIELDS_ACCESS() in @ref ublox::message::LogInfo.
+    enum FieldIdx
+    {
+        FieldIdx_version, ///< index of @b version field
+        FieldIdx_reserved1, ///< index of @b reserved1 field
+        FieldIdx_filestoreCapacity, ///< index of @b filestoreCapacity field
+        FieldIdx_reserved2, ///< index of @b reserved2 field
+        FieldIdx_reserved3, ///< index of @b reserved3 field
+        FieldIdx_currentMaxLogSize, ///< index of @b currentMaxLogSize field
+        FieldIdx_currentLogSize, ///< index of @b currentLogSize field
+        FieldIdx_entryCount, ///< index of @b entryCount field
+        FieldIdx_oldestYear, ///< index of @b oldestYear field
+        FieldIdx_oldestMonth, ///< index of @b oldestMonth field
+        FieldIdx_oldestDay, ///< index of @b oldestDay field
+        FieldIdx_oldestHour, ///< index of @b oldestHour field
+        FieldIdx_oldestMinute, ///< index of @b oldestMinute field
+        FieldIdx_oldestSecond, ///< index of @b oldestSecond field
+        FieldIdx_reserved4, ///< index of @b reserved4 field
+        FieldIdx_newestYear, ///< index of @b newestYear field
+        FieldIdx_newestMonth, ///< index of @b newestMonth field
+        FieldIdx_newestDay, ///< index of @b newestDay field
+        FieldIdx_newestHour, ///< index of @b newestHour field
+        FieldIdx_newestMinute, ///< index of @b newestMinute field
+        FieldIdx_newestSecond, ///< index of @b newestSecond field
+        FieldIdx_reserved5, ///< index of @b reserved5 field
+        FieldIdx_status, ///< index of @b status field
+        FieldIdx_reserved6, ///< index of @b reserved6 field
+        FieldIdx_numOfValues ///< number of available fields
+    };
+
+    /// @brief Default constructor, creates empty view.
+    LogInfoView() = default;
+
+    /// @brief Constructor
+    /// @param[in] payload Pointer to the payload of the message.
+    /// @param[in] len Length of the payload.
+    LogInfoView(const std::uint8_t* payload, std::size_t len)
+      : Base(payload, len)
+    {
+    }
+
+    /// @brief Decode "version" field (see @ref ublox::message::LogInfoFields::version).
+    comms::ErrorStatus field_version(FieldType<FieldIdx_version>& field) const
+    {
+        return Base::readField<FieldIdx_version>(field);
+    }
+
+    /// @brief Decode "reserved1" field (see @ref ublox::message::LogInfoFields::reserved1).
+    comms::ErrorStatus field_reserved1(FieldType<FieldIdx_reserved1>& field) const
+    {
+        return Base::readField<FieldIdx_reserved1>(field);
+    }
+
+    /// @brief Decode "filestoreCapacity" field (see @ref ublox::message::LogInfoFields::filestoreCapacity).
+    comms::ErrorStatus field_filestoreCapacity(FieldType<FieldIdx_filestoreCapacity>& field) const
+    {
+        return Base::readField<FieldIdx_filestoreCapacity>(field);
+    }
+
+    /// @brief Decode "reserved2" field (see @ref ublox::message::LogInfoFields::reserved2).
+    comms::ErrorStatus field_reserved2(FieldType<FieldIdx_reserved2>& field) const
+    {
+        return Base::readField<FieldIdx_reserved2>(field);
+    }
+
+    /// @brief Decode "reserved3" field (see @ref ublox::message::LogInfoFields::reserved3).
+    comms::ErrorStatus field_reserved3(FieldType<FieldIdx_reserved3>& field) const
+    {
+        return Base::readField<FieldIdx_reserved3>(field);
+    }
+
+    /// @brief Decode "currentMaxLogSize" field (see @ref ublox::message::LogInfoFields::currentMaxLogSize).
+    comms::ErrorStatus field_currentMaxLogSize(FieldType<FieldIdx_currentMaxLogSize>& field) const
+    {
+        return Base::readField<FieldIdx_currentMaxLogSize>(field);
+    }
+
+    /// @brief Decode "currentLogSize" field (see @ref ublox::message::LogInfoFields::currentLogSize).
+    comms::ErrorStatus field_currentLogSize(FieldType<FieldIdx_currentLogSize>& field) const
+    {
+        return Base::readField<FieldIdx_currentLogSize>(field);
+    }
+
+    /// @brief Decode "entryCount" field (see @ref ublox::message::LogInfoFields::entryCount).
+    comms::ErrorStatus field_entryCount(FieldType<FieldIdx_entryCount>& field) const
+    {
+        return Base::readField<FieldIdx_entryCount>(field);
+    }
+
+    /// @brief Decode "oldestYear" field (see @ref ublox::message::LogInfoFields::oldestYear).
+    comms::ErrorStatus field_oldestYear(FieldType<FieldIdx_oldestYear>& field) const
+    {
+        return Base::readField<FieldIdx_oldestYear>(field);
+    }
+
+    /// @brief Decode "oldestMonth" field (see @ref ublox::message::LogInfoFields::oldestMonth).
+    comms::ErrorStatus field_oldestMonth(FieldType<FieldIdx_oldestMonth>& field) const
+    {
+        return Base::readField<FieldIdx_oldestMonth>(field);
+    }
+
+    /// @brief Decode "oldestDay" field (see @ref ublox::message::LogInfoFields::oldestDay).
+    comms::ErrorStatus field_oldestDay(FieldType<FieldIdx_oldestDay>& field) const
+    {
+        return Base::readField<FieldIdx_oldestDay>(field);
+    }
+
+    /// @brief Decode "oldestHour" field (see @ref ublox::message::LogInfoFields::oldestHour).
+    comms::ErrorStatus field_oldestHour(FieldType<FieldIdx_oldestHour>& field) const
+    {
+        return Base::readField<FieldIdx_oldestHour>(field);
+    }
+
+    /// @brief Decode "oldestMinute" field (see @ref ublox::message::LogInfoFields::oldestMinute).
+    comms::ErrorStatus field_oldestMinute(FieldType<FieldIdx_oldestMinute>& field) const
+    {
+        return Base::readField<FieldIdx_oldestMinute>(field);
+    }
+
+    /// @brief Decode "oldestSecond" field (see @ref ublox::message::LogInfoFields::oldestSecond).
+    comms::ErrorStatus field_oldestSecond(FieldType<FieldIdx_oldestSecond>& field) const
+    {
+        return Base::readField<FieldIdx_oldestSecond>(field);
+    }
+
+    /// @brief Decode "reserved4" field (see @ref ublox::message::LogInfoFields::reserved4).
+    comms::ErrorStatus field_reserved4(FieldType<FieldIdx_reserved4>& field) const
+    {
+        return Base::readField<FieldIdx_reserved4>(field);
+    }
+
+    /// @brief Decode "newestYear" field (see @ref ublox::message::LogInfoFields::newestYear).
+    comms::ErrorStatus field_newestYear(FieldType<FieldIdx_newestYear>& field) const
+    {
+        return Base::readField<FieldIdx_newestYear>(field);
+    }
+
+    /// @brief Decode "newestMonth" field (see @ref ublox::message::LogInfoFields::newestMonth).
+    comms::ErrorStatus field_newestMonth(FieldType<FieldIdx_newestMonth>& field) const
+    {
+        return Base::readField<FieldIdx_newestMonth>(field);
+    }
+
+    /// @brief Decode "newestDay" field (see @ref ublox::message::LogInfoFields::newestDay).
+    comms::ErrorStatus field_newestDay(FieldType<FieldIdx_newestDay>& field) const
+    {
+        return Base::readField<FieldIdx_newestDay>(field);
+    }
+
+    /// @brief Decode "newestHour" field (see @ref ublox::message::LogInfoFields::newestHour).
+    comms::ErrorStatus field_newestHour(FieldType<FieldIdx_newestHour>& field) const
+    {
+        return Base::readField<FieldIdx_newestHour>(field);
+    }
+
+    /// @brief Decode "newestMinute" field (see @ref ublox::message::LogInfoFields::newestMinute).
+    comms::ErrorStatus field_newestMinute(FieldType<FieldIdx_newestMinute>& field) const
+    {
+        return Base::readField<FieldIdx_newestMinute>(field);
+    }
+
+    /// @brief Decode "newestSecond" field (see @ref ublox::message::LogInfoFields::newestSecond).
+    comms::ErrorStatus field_newestSecond(FieldType<FieldIdx_newestSecond>& field) const
+    {
+        return Base::readField<FieldIdx_newestSecond>(field);
+    }
+
+    /// @brief Decode "reserved5" field (see @ref ublox::message::LogInfoFields::reserved5).
+    comms::ErrorStatus field_reserved5(FieldType<FieldIdx_reserved5>& field) const
+    {
+        return Base::readField<FieldIdx_reserved5>(field);
+    }
+
+    /// @brief Decode "status" field (see @ref ublox::message::LogInfoFields::status).
+    comms::ErrorStatus field_status(FieldType<FieldIdx_status>& field) const
+    {
+        return Base::readField<FieldIdx_status>(field);
+    }
+
+    /// @brief Decode "reserved6" field (see @ref ublox::message::LogInfoFields::reserved6).
+    comms::ErrorStatus field_reserved6(FieldType<FieldIdx_reserved6>& field) const
+    {
+        return Base::readField<FieldIdx_reserved6>(field);
+    }
+};
+
+} // namespace view
+
+} // namespace ublox
+
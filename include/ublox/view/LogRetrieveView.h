@@ -0,0 +1,101 @@
+//
+// Copyright 2018 (C). Alex Robenko. All rights reserved.
+//
+
+// This file is free software: you can redistribute it and/or modify
+// it under the terms of the GNU General Public License as published by
+// the Free Software Foundation, either version 3 of the License, or
+// (at your option) any later version.
+//
+// This program is distributed in the hope that it will be useful,
+// but WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+// GNU General Public License for more details.
+//
+// You should have received a copy of the GNU General Public License
+// along with this program.  If not, see <http://www.gnu.org/licenses/>.
+
+/// @file
+/// @brief Contains definition of lazy view of LOG-RETRIEVE message.
+/// @details Generated by script/gen_views.py, do NOT edit manually.
+
+#pragma once
+
+#include "ublox/message/LogRetrieve.h"
+#include "MsgView.h"
+
+namespace ublox
+{
+
+namespace view
+{
+
+/// @brief Lazy read-only view of LOG-RETRIEVE message payload.
+/// @details Wraps the pointer to the validated payload, the fields are
+///     decoded on access only, see @ref MsgView.
+/// @see @ref ublox::message::LogRetrieve
+class LogRetrieveView : public
+    MsgView<
+        ublox::message::LogRetrieveFields::All
+    >
+{
+    using Base =
+        MsgView<
+            ublox::message::LogRetrieveFields::All
+        >;
+
+public:
+    /// @brief ID of the viewed message.
+    static const MsgId MsgIdValue = MsgId_LOG_RETRIEVE;
+
+    /// @brief Index of the fields, same as the ones defined by
+    ///     @b COMMS_MSG_FIELDS_ACCESS() in @ref ublox::message::LogRetrieve.
+    enum FieldIdx
+    {
+        FieldIdx_startNumber, ///< index of @b startNumber field
+        FieldIdx_entryCount, ///< index of @b entryCount field
+        FieldIdx_version, ///< index of @b version field
+        FieldIdx_reserved, ///< index of @b reserved field
+        FieldIdx_numOfValues ///< number of available fields
+    };
+
+    /// @brief Default constructor, creates empty view.
+    LogRetrieveView() = default;
+
+    /// @brief Constructor
+    /// @param[in] payload Pointer to the payload of the message.
+    /// @param[in] len Length of the payload.
+    LogRetrieveView(const std::uint8_t* payload, std::size_t len)
+      : Base(payload, len)
+    {
+    }
+
+    /// @brief Decode "startNumber" field (see @ref ublox::message::LogRetrieveFields::startNumber).
+    comms::ErrorStatus field_startNumber(FieldType<FieldIdx_startNumber>& field) const
+    {
+        return Base::readField<FieldIdx_startNumber>(field);
+    }
+
+    /// @brief Decode "entryCount" field (see @ref ublox::message::LogRetrieveFields::entryCount).
+    comms::ErrorStatus field_entryCount(FieldType<FieldIdx_entryCount>& field) const
+    {
+        return Base::readField<FieldIdx_entryCount>(field);
+    }
+
+    /// @brief Decode "version" field (see @ref ublox::message::LogRetrieveFields::version).
+    comms::ErrorStatus field_version(FieldType<FieldIdx_version>& field) const
+    {
+        return Base::readField<FieldIdx_version>(field);
+    }
+
+    /// @brief Decode "reserved" field (see @ref ublox::message::LogRetrieveFields::reserved).
+    comms::ErrorStatus field_reserved(FieldType<FieldIdx_reserved>& field) const
+    {
+        return Base::readField<FieldIdx_reserved>(field);
+    }
+};
+
+} // namespace view
+
+} // namespace ublox
+
@@ -0,0 +1,199 @@
+//
+// Copyright 2018 (C). Alex Robenko. All rights reserved.
+//
+
+// This file is free software: you can redistribute it and/or modify
+// it under the terms of the GNU General Public License as published by
+// the Free Software Foundation, either version 3 of the License, or
+// (at your option) any later version.
+//
+// This program is distributed in the hope that it will be useful,
+// but WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+// GNU General Public License for more details.
+//
+// You should have received a copy of the GNU General Public License
+// along with this program.  If not, see <http://www.gnu.org/licenses/>.
+
+/// @file
+/// @brief Contains definition of lazy view of LOG-RETRIEVEPOS message.
+/// @details Generated by script/gen_views.py, do NOT edit manually.
+
+#pragma once
+
+#include "ublox/message/LogRetrievepos.h"
+#include "MsgView.h"
+
+namespace ublox
+{
+
+namespace view
+{
+
+/// @brief Lazy read-only view of LOG-RETRIEVEPOS message payload.
+/// @details Wraps the pointer to the validated payload, the fields are
+///     decoded on access only, see @ref MsgView.
+/// @see @ref ublox::message::LogRetrievepos
+class LogRetrieveposView : public
+    MsgView<
+        ublox::message::LogRetrieveposFields::All
+    >
+{
+    using Base =
+        MsgView<
+            ublox::message::LogRetrieveposFields::All
+        >;
+
+public:
+    /// @brief ID of the viewed message.
+    static const MsgId MsgIdValue = MsgId_LOG_RETRIEVEPOS;
+
+    /// @brief Index of the fields, same as the ones defined by
+    ///     @b COMMS_MSG_FIELDS_ACCESS() in @ref ublox::message::LogRetrievepos.
+    enum FieldIdx
+    {
+        FieldIdx_entryIndex, ///< index of @b entryIndex field
+        FieldIdx_lon, ///< index of @b lon field
+        FieldIdx_lat, ///< index of @b lat field
+        FieldIdx_hMSL, ///< index of @b hMSL field
+        FieldIdx_hAcc, ///< index of @b hAcc field
+        FieldIdx_gSpeed, ///< index of @b gSpeed field
+        FieldIdx_heading, ///< index of @b heading field
+        FieldIdx_version, ///< index of @b version field
+        FieldIdx_fixType, ///< index of @b fixType field
+        FieldIdx_year, ///< index of @b year field
+        FieldIdx_month, ///< index of @b month field
+        FieldIdx_day, ///< index of @b day field
+        FieldIdx_hour, ///< index of @b hour field
+        FieldIdx_minute, ///< index of @b minute field
+        FieldIdx_second, ///< index of @b second field
+        FieldIdx_reserved1, ///< index of @b reserved1 field
+        FieldIdx_numSV, ///< index of @b numSV field
+        FieldIdx_reserved2, ///< index of @b reserved2 field
+        FieldIdx_numOfValues ///< number of available fields
+    };
+
+    /// @brief Default constructor, creates empty view.
+    LogRetrieveposView() = default;
+
+    /// @brief Constructor
+    /// @param[in] payload Pointer to the payload of the message.
+    /// @param[in] len Length of the payload.
+    LogRetrieveposView(const std::uint8_t* payload, std::size_t len)
+      : Base(payload, len)
+    {
+    }
+
+    /// @brief Decode "entryIndex" field (see @ref ublox::message::LogRetrieveposFields::entryIndex).
+    comms::ErrorStatus field_entryIndex(FieldType<FieldIdx_entryIndex>& field) const
+    {
+        return Base::readField<FieldIdx_entryIndex>(field);
+    }
+
+    /// @brief Decode "lon" field (see @ref ublox::message::LogRetrieveposFields::lon).
+    comms::ErrorStatus field_lon(FieldType<FieldIdx_lon>& field) const
+    {
+        return Base::readField<FieldIdx_lon>(field);
+    }
+
+    /// @brief Decode "lat" field (see @ref ublox::message::LogRetrieveposFields::lat).
+    comms::ErrorStatus field_lat(FieldType<FieldIdx_lat>& field) const
+    {
+        return Base::readField<FieldIdx_lat>(field);
+    }
+
+    /// @brief Decode "hMSL" field (see @ref ublox::message::LogRetrieveposFields::hMSL).
+    comms::ErrorStatus field_hMSL(FieldType<FieldIdx_hMSL>& field) const
+    {
+        return Base::readField<FieldIdx_hMSL>(field);
+    }
+
+    /// @brief Decode "hAcc" field (see @ref ublox::message::LogRetrieveposFields::hAcc).
+    comms::ErrorStatus field_hAcc(FieldType<FieldIdx_hAcc>& field) const
+    {
+        return Base::readField<FieldIdx_hAcc>(field);
+    }
+
+    /// @brief Decode "gSpeed" field (see @ref ublox::message::LogRetrieveposFields::gSpeed).
+    comms::ErrorStatus field_gSpeed(FieldType<FieldIdx_gSpeed>& field) const
+    {
+        return Base::readField<FieldIdx_gSpeed>(field);
+    }
+
+    /// @brief Decode "heading" field (see @ref ublox::message::LogRetrieveposFields::heading).
+    comms::ErrorStatus field_heading(FieldType<FieldIdx_heading>& field) const
+    {
+        return Base::readField<FieldIdx_heading>(field);
+    }
+
+    /// @brief Decode "version" field (see @ref ublox::message::LogRetrieveposFields::version).
+    comms::ErrorStatus field_version(FieldType<FieldIdx_version>& field) const
+    {
+        return Base::readField<FieldIdx_version>(field);
+    }
+
+    /// @brief Decode "fixType" field (see @ref ublox::message::LogRetrieveposFields::fixType).
+    comms::ErrorStatus field_fixType(FieldType<FieldIdx_fixType>& field) const
+    {
+        return Base::readField<FieldIdx_fixType>(field);
+    }
+
+    /// @brief Decode "year" field (see @ref ublox::message::LogRetrieveposFields::year).
+    comms::ErrorStatus field_year(FieldType<FieldIdx_year>& field) const
+    {
+        return Base::readField<FieldIdx_year>(field);
+    }
+
+    /// @brief Decode "month" field (see @ref ublox::message::LogRetrieveposFields::month).
+    comms::ErrorStatus field_month(FieldType<FieldIdx_month>& field) const
+    {
+        return Base::readField<FieldIdx_month>(field);
+    }
+
+    /// @brief Decode "day" field (see @ref ublox::message::LogRetrieveposFields::day).
+    comms::ErrorStatus field_day(FieldType<FieldIdx_day>& field) const
+    {
+        return Base::readField<FieldIdx_day>(field);
+    }
+
+    /// @brief Decode "hour" field (see @ref ublox::message::LogRetrieveposFields::hour).
+    comms::ErrorStatus field_hour(FieldType<FieldIdx_hour>& field) const
+    {
+        return Base::readField<FieldIdx_hour>(field);
+    }
+
+    /// @brief Decode "minute" field (see @ref ublox::message::LogRetrieveposFields::minute).
+    comms::ErrorStatus field_minute(FieldType<FieldIdx_minute>& field) const
+    {
+        return Base::readField<FieldIdx_minute>(field);
+    }
+
+    /// @brief Decode "second" field (see @ref ublox::message::LogRetrieveposFields::second).
+    comms::ErrorStatus field_second(FieldType<FieldIdx_second>& field) const
+    {
+        return Base::readField<FieldIdx_second>(field);
+    }
+
+    /// @brief Decode "reserved1" field (see @ref ublox::message::LogRetrieveposFields::reserved1).
+    comms::ErrorStatus field_reserved1(FieldType<FieldIdx_reserved1>& field) const
+    {
+        return Base::readField<FieldIdx_reserved1>(field);
+    }
+
+    /// @brief Decode "numSV" field (see @ref ublox::message::LogRetrieveposFields::numSV).
+    comms::ErrorStatus field_numSV(FieldType<FieldIdx_numSV>& field) const
+    {
+        return Base::readField<FieldIdx_numSV>(field);
+    }
+
+    /// @brief Decode "reserved2" field (see @ref ublox::message::LogRetrieveposFields::reserved2).
+    comms::ErrorStatus field_reserved2(FieldType<FieldIdx_reserved2>& field) const
+    {
+        return Base::readField<FieldIdx_reserved2>(field);
+    }
+};
+
+} // namespace view
+
+} // namespace ublox
+
@@ -0,0 +1,108 @@
+//
+// Copyright 2018 (C). Alex Robenko. All rights reserved.
+//
+
+// This file is free software: you can redistribute it and/or modify
+// it under the terms of the GNU General Public License as published by
+// the Free Software Foundation, either version 3 of the License, or
+// (at your option) any later version.
+//
+// This program is distributed in the hope that it will be useful,
+// but WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+// GNU General Public License for more details.
+//
+// You should have received a copy of the GNU General Public License
+// along with this program.  If not, see <http://www.gnu.org/licenses/>.
+
+/// @file
+/// @brief Contains definition of lazy view of MGA-ACK message.
+/// @details Generated by script/gen_views.py, do NOT edit manually.
+
+#pragma once
+
+#include "ublox/message/MgaAck.h"
+#include "MsgView.h"
+
+namespace ublox
+{
+
+namespace view
+{
+
+/// @brief Lazy read-only view of MGA-ACK message payload.
+/// @details Wraps the pointer to the validated payload, the fields are
+///     decoded on access only, see @ref MsgView.
+/// @see @ref ublox::message::MgaAck
+class MgaAckView : public
+    MsgView<
+        ublox::message::MgaAckFields::All
+    >
+{
+    using Base =
+        MsgView<
+            ublox::message::MgaAckFields::All
+        >;
+
+public:
+    /// @brief ID of the viewed message.
+    static const MsgId MsgIdValue = MsgId_MGA_ACK;
+
+    /// @brief Index of the fields, same as the ones defined by
+    ///     @b COMMS_MSG_FIELDS_ACCESS() in @ref ublox::message::MgaAck.
+    enum FieldIdx
+    {
+        FieldIdx_type, ///< index of @b type field
+        FieldIdx_version, ///< index of @b version field
+        FieldIdx_infoCode, ///< index of @b infoCode field
+        FieldIdx_msgId, ///< index of @b msgId field
+        FieldIdx_msgPayloadStart, ///< index of @b msgPayloadStart field
+        FieldIdx_numOfValues ///< number of available fields
+    };
+
+    /// @brief Default constructor, creates empty view.
+    MgaAckView() = default;
+
+    /// @brief Constructor
+    /// @param[in] payload Pointer to the payload of the message.
+    /// @param[in] len Length of the payload.
+    MgaAckView(const std::uint8_t* payload, std::size_t len)
+      : Base(payload, len)
+    {
+    }
+
+    /// @brief Decode "type" field (see @ref ublox::message::MgaAckFields::type).
+    comms::ErrorStatus field_type(FieldType<FieldIdx_type>& field) const
+    {
+        return Base::readField<FieldIdx_type>(field);
+    }
+
+    /// @brief Decode "version" field (see @ref ublox::message::MgaAckFields::version).
+    comms::ErrorStatus field_version(FieldType<FieldIdx_version>& field) const
+    {
+        return Base::readField<FieldIdx_version>(field);
+    }
+
+    /// @brief Decode "infoCode" field (see @ref ublox::message::MgaAckFields::infoCode).
+    comms::ErrorStatus field_infoCode(FieldType<FieldIdx_infoCode>& field) const
+    {
+        return Base::readField<FieldIdx_infoCode>(field);
+    }
+
+    /// @brief Decode "msgId" field (see @ref ublox::message::MgaAckFields::msgId).
+    comms::ErrorStatus field_msgId(FieldType<FieldIdx_msgId>& field) const
+    {
+        return Base::readField<FieldIdx_msgId>(field);
+    }
+
+    /// @brief Decode "msgPayloadStart" field (see @ref ublox::message::MgaAckFields::msgPayloadStart).
+    comms::ErrorStatus field_msgPayloadStart(FieldType<FieldIdx_msgPayloadStart>& field) const
+    {
+        return Base::readField<FieldIdx_msgPayloadStart>(field);
+    }
+};
+
+} // namespace view
+
+} // namespace ublox
+
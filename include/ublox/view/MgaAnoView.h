@@ -0,0 +1,143 @@
+//
+// Copyright 2018 (C). Alex Robenko. All rights reserved.
+//
+
+// This file is free software: you can redistribute it and/or modify
+// it under the terms of the GNU General Public License as published by
+// the Free Software Foundation, either version 3 of the License, or
+// (at your option) any later version.
+//
+// This program is distributed in the hope that it will be useful,
+// but WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+// GNU General Public License for more details.
+//
+// You should have received a copy of the GNU General Public License
+// along with this program.  If not, see <http://www.gnu.org/licenses/>.
+
+/// @file
+/// @brief Contains definition of lazy view of MGA-ANO message.
+/// @details Generated by script/gen_views.py, do NOT edit manually.
+
+#pragma once
+
+#include "ublox/message/MgaAno.h"
+#include "MsgView.h"
+
+namespace ublox
+{
+
+namespace view
+{
+
+/// @brief Lazy read-only view of MGA-ANO message payload.
+/// @details Wraps the pointer to the validated payload, the fields are
+///     decoded on access only, see @ref MsgView.
+/// @see @ref ublox::message::MgaAno
+class MgaAnoView : public
+    MsgView<
+        ublox::message::MgaAnoFields::All<comms::option::EmptyOption>
+    >
+{
+    using Base =
+        MsgView<
+            ublox::message::MgaAnoFields::All<comms::option::EmptyOption>
+        >;
+
+public:
+    /// @brief ID of the viewed message.
+    static const MsgId MsgIdValue = MsgId_MGA_ANO;
+
+    /// @brief Index of the fields, same as the ones defined by
+    ///     @b COMMS_MSG_FIELDS_ACCESS() in @ref ublox::message::MgaAno.
+    enum FieldIdx
+    {
+        FieldIdx_type, ///< index of @b type field
+        FieldIdx_version, ///< index of @b version field
+        FieldIdx_svId, ///< index of @b svId field
+        FieldIdx_gnssId, ///< index of @b gnssId field
+        FieldIdx_year, ///< index of @b year field
+        FieldIdx_month, ///< index of @b month field
+        FieldIdx_day, ///< index of @b day field
+        FieldIdx_reserved1, ///< index of @b reserved1 field
+        FieldIdx_data, ///< index of @b data field
+        FieldIdx_reserved2, ///< index of @b reserved2 field
+        FieldIdx_numOfValues ///< number of available fields
+    };
+
+    /// @brief Default constructor, creates empty view.
+    MgaAnoView() = default;
+
+    /// @brief Constructor
+    /// @param[in] payload Pointer to the payload of the message.
+    /// @param[in] len Length of the payload.
+    MgaAnoView(const std::uint8_t* payload, std::size_t len)
+      : Base(payload, len)
+    {
+    }
+
+    /// @brief Decode "type" field (see @ref ublox::message::MgaAnoFields::type).
+    comms::ErrorStatus field_type(FieldType<FieldIdx_type>& field) const
+    {
+        return Base::readField<FieldIdx_type>(field);
+    }
+
+    /// @brief Decode "version" field (see @ref ublox::message::MgaAnoFields::version).
+    comms::ErrorStatus field_version(FieldType<FieldIdx_version>& field) const
+    {
+        return Base::readField<FieldIdx_version>(field);
+    }
+
+    /// @brief Decode "svId" field (see @ref ublox::message::MgaAnoFields::svId).
+    comms::ErrorStatus field_svId(FieldType<FieldIdx_svId>& field) const
+    {
+        return Base::readField<FieldIdx_svId>(field);
+    }
+
+    /// @brief Decode "gnssId" field (see @ref ublox::message::MgaAnoFields::gnssId).
+    comms::ErrorStatus field_gnssId(FieldType<FieldIdx_gnssId>& field) const
+    {
+        return Base::readField<FieldIdx_gnssId>(field);
+    }
+
+    /// @brief Decode "year" field (see @ref ublox::message::MgaAnoFields::year).
+    comms::ErrorStatus field_year(FieldType<FieldIdx_year>& field) const
+    {
+        return Base::readField<FieldIdx_year>(field);
+    }
+
+    /// @brief Decode "month" field (see @ref ublox::message::MgaAnoFields::month).
+    comms::ErrorStatus field_month(FieldType<FieldIdx_month>& field) const
+    {
+        return Base::readField<FieldIdx_month>(field);
+    }
+
+    /// @brief Decode "day" field (see @ref ublox::message::MgaAnoFields::day).
+    comms::ErrorStatus field_day(FieldType<FieldIdx_day>& field) const
+    {
+        return Base::readField<FieldIdx_day>(field);
+    }
+
+    /// @brief Decode "reserved1" field (see @ref ublox::message::MgaAnoFields::reserved1).
+    comms::ErrorStatus field_reserved1(FieldType<FieldIdx_reserved1>& field) const
+    {
+        return Base::readField<FieldIdx_reserved1>(field);
+    }
+
+    /// @brief Decode "data" field (see @ref ublox::message::MgaAnoFields::data).
+    comms::ErrorStatus field_data(FieldType<FieldIdx_data>& field) const
+    {
+        return Base::readField<FieldIdx_data>(field);
+    }
+
+    /// @brief Decode "reserved2" field (see @ref ublox::message::MgaAnoFields::reserved2).
+    comms::ErrorStatus field_reserved2(FieldType<FieldIdx_reserved2>& field) const
+    {
+        return Base::readField<FieldIdx_reserved2>(field);
+    }
+};
+
+} // namespace view
+
+} // namespace ublox
+
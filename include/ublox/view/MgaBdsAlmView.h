@@ -0,0 +1,185 @@
+//
+// Copyright 2018 (C). Alex Robenko. All rights reserved.
+//
+
+// This file is free software: you can redistribute it and/or modify
+// it under the terms of the GNU General Public License as published by
+// the Free Software Foundation, either version 3 of the License, or
+// (at your option) any later version.
+//
+// This program is distributed in the hope that it will be useful,
+// but WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+// GNU General Public License for more details.
+//
+// You should have received a copy of the GNU General Public License
+// along with this program.  If not, see <http://www.gnu.org/licenses/>.
+
+/// @file
+/// @brief Contains definition of lazy view of MGA-BDS-ALM message.
+/// @details Generated by script/gen_views.py, do NOT edit manually.
+
+#pragma once
+
+#include "ublox/message/MgaBdsAlm.h"
+#include "MsgView.h"
+
+namespace ublox
+{
+
+namespace view
+{
+
+/// @brief Lazy read-only view of MGA-BDS-ALM message payload.
+/// @details Wraps the pointer to the validated payload, the fields are
+///     decoded on access only, see @ref MsgView.
+/// @see @ref ublox::message::MgaBdsAlm
+class MgaBdsAlmView : public
+    MsgView<
+        ublox::message::MgaBdsAlmFields::All
+    >
+{
+    using Base =
+        MsgView<
+            ublox::message::MgaBdsAlmFields::All
+        >;
+
+public:
+    /// @brief ID of the viewed message.
+    static const MsgId MsgIdValue = MsgId_MGA_BDS;
+
+    /// @brief Index of the fields, same as the ones defined by
+    ///     @b COMMS_MSG_FIELDS_ACCESS() in @ref ublox::message::MgaBdsAlm.
+    enum FieldIdx
+    {
+        FieldIdx_type, ///< index of @b type field
+        FieldIdx_version, ///< index of @b version field
+        FieldIdx_svId, ///< index of @b svId field
+        FieldIdx_reserved1, ///< index of @b reserved1 field
+        FieldIdx_Wna, ///< index of @b Wna field
+        FieldIdx_toa, ///< index of @b toa field
+        FieldIdx_deltaI, ///< index of @b deltaI field
+        FieldIdx_sqrtA, ///< index of @b sqrtA field
+        FieldIdx_e, ///< index of @b e field
+        FieldIdx_omega, ///< index of @b omega field
+        FieldIdx_M0, ///< index of @b M0 field
+        FieldIdx_Omega0, ///< index of @b Omega0 field
+        FieldIdx_OmegaDot, ///< index of @b OmegaDot field
+        FieldIdx_a0, ///< index of @b a0 field
+        FieldIdx_a1, ///< index of @b a1 field
+        FieldIdx_reserved2, ///< index of @b reserved2 field
+        FieldIdx_numOfValues ///< number of available fields
+    };
+
+    /// @brief Default constructor, creates empty view.
+    MgaBdsAlmView() = default;
+
+    /// @brief Constructor
+    /// @param[in] payload Pointer to the payload of the message.
+    /// @param[in] len Length of the payload.
+    MgaBdsAlmView(const std::uint8_t* payload, std::size_t len)
+      : Base(payload, len)
+    {
+    }
+
+    /// @brief Decode "type" field (see @ref ublox::message::MgaBdsAlmFields::type).
+    comms::ErrorStatus field_type(FieldType<FieldIdx_type>& field) const
+    {
+        return Base::readField<FieldIdx_type>(field);
+    }
+
+    /// @brief Decode "version" field (see @ref ublox::message::MgaBdsAlmFields::version).
+    comms::ErrorStatus field_version(FieldType<FieldIdx_version>& field) const
+    {
+        return Base::readField<FieldIdx_version>(field);
+    }
+
+    /// @brief Decode "svId" field (see @ref ublox::message::MgaBdsAlmFields::svId).
+    comms::ErrorStatus field_svId(FieldType<FieldIdx_svId>& field) const
+    {
+        return Base::readField<FieldIdx_svId>(field);
+    }
+
+    /// @brief Decode "reserved1" field (see @ref ublox::message::MgaBdsAlmFields::reserved1).
+    comms::ErrorStatus field_reserved1(FieldType<FieldIdx_reserved1>& field) const
+    {
+        return Base::readField<FieldIdx_reserved1>(field);
+    }
+
+    /// @brief Decode "Wna" field (see @ref ublox::message::MgaBdsAlmFields::Wna).
+    comms::ErrorStatus field_Wna(FieldType<FieldIdx_Wna>& field) const
+    {
+        return Base::readField<FieldIdx_Wna>(field);
+    }
+
+    /// @brief Decode "toa" field (see @ref ublox::message::MgaBdsAlmFields::toa).
+    comms::ErrorStatus field_toa(FieldType<FieldIdx_toa>& field) const
+    {
+        return Base::readField<FieldIdx_toa>(field);
+    }
+
+    /// @brief Decode "deltaI" field (see @ref ublox::message::MgaBdsAlmFields::deltaI).
+    comms::ErrorStatus field_deltaI(FieldType<FieldIdx_deltaI>& field) const
+    {
+        return Base::readField<FieldIdx_deltaI>(field);
+    }
+
+    /// @brief Decode "sqrtA" field (see @ref ublox::message::MgaBdsAlmFields::sqrtA).
+    comms::ErrorStatus field_sqrtA(FieldType<FieldIdx_sqrtA>& field) const
+    {
+        return Base::readField<FieldIdx_sqrtA>(field);
+    }
+
+    /// @brief Decode "e" field (see @ref ublox::message::MgaBdsAlmFields::e).
+    comms::ErrorStatus field_e(FieldType<FieldIdx_e>& field) const
+    {
+        return Base::readField<FieldIdx_e>(field);
+    }
+
+    /// @brief Decode "omega" field (see @ref ublox::message::MgaBdsAlmFields::omega).
+    comms::ErrorStatus field_omega(FieldType<FieldIdx_omega>& field) const
+    {
+        return Base::readField<FieldIdx_omega>(field);
+    }
+
+    /// @brief Decode "M0" field (see @ref ublox::message::MgaBdsAlmFields::M0).
+    comms::ErrorStatus field_M0(FieldType<FieldIdx_M0>& field) const
+    {
+        return Base::readField<FieldIdx_M0>(field);
+    }
+
+    /// @brief Decode "Omega0" field (see @ref ublox::message::MgaBdsAlmFields::Omega0).
+    comms::ErrorStatus field_Omega0(FieldType<FieldIdx_Omega0>& field) const
+    {
+        return Base::readField<FieldIdx_Omega0>(field);
+    }
+
+    /// @brief Decode "OmegaDot" field (see @ref ublox::message::MgaBdsAlmFields::OmegaDot).
+    comms::ErrorStatus field_OmegaDot(FieldType<FieldIdx_OmegaDot>& field) const
+    {
+        return Base::readField<FieldIdx_OmegaDot>(field);
+    }
+
+    /// @brief Decode "a0" field (see @ref ublox::message::MgaBdsAlmFields::a0).
+    comms::ErrorStatus field_a0(FieldType<FieldIdx_a0>& field) const
+    {
+        return Base::readField<FieldIdx_a0>(field);
+    }
+
+    /// @brief Decode "a1" field (see @ref ublox::message::MgaBdsAlmFields::a1).
+    comms::ErrorStatus field_a1(FieldType<FieldIdx_a1>& field) const
+    {
+        return Base::readField<FieldIdx_a1>(field);
+    }
+
+    /// @brief Decode "reserved2" field (see @ref ublox::message::MgaBdsAlmFields::reserved2).
+    comms::ErrorStatus field_reserved2(FieldType<FieldIdx_reserved2>& field) const
+    {
+        return Base::readField<FieldIdx_reserved2>(field);
+    }
+};
+
+} // namespace view
+
+} // namespace ublox
+
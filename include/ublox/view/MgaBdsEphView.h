@@ -0,0 +1,283 @@
+//
+// Copyright 2018 (C). Alex Robenko. All rights reserved.
+//
+
+// This file is free software: you can redistribute it and/or modify
+// it under the terms of the GNU General Public License as published by
+// the Free Software Foundation, either version 3 of the License, or
+// (at your option) any later version.
+//
+// This program is distributed in the hope that it will be useful,
+// but WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+// GNU General Public License for more details.
+//
+// You should have received a copy of the GNU General Public License
+// along with this program.  If not, see <http://www.gnu.org/licenses/>.
+
+/// @file
+/// @brief Contains definition of lazy view of MGA-BDS-EPH message.
+/// @details Generated by script/gen_views.py, do NOT edit manually.
+
+#pragma once
+
+#include "ublox/message/MgaBdsEph.h"
+#include "MsgView.h"
+
+namespace ublox
+{
+
+namespace view
+{
+
+/// @brief Lazy read-only view of MGA-BDS-EPH message payload.
+/// @details Wraps the pointer to the validated payload, the fields are
+///     decoded on access only, see @ref MsgView.
+/// @see @ref ublox::message::MgaBdsEph
+class MgaBdsEphView : public
+    MsgView<
+        ublox::message::MgaBdsEphFields::All
+    >
+{
+    using Base =
+        MsgView<
+            ublox::message::MgaBdsEphFields::All
+        >;
+
+public:
+    /// @brief ID of the viewed message.
+    static const MsgId MsgIdValue = MsgId_MGA_BDS;
+
+    /// @brief Index of the fields, same as the ones defined by
+    ///     @b COMMS_MSG_FIELDS_ACCESS() in @ref ublox::message::MgaBdsEph.
+    enum FieldIdx
+    {
+        FieldIdx_type, ///< index of @b type field
+        FieldIdx_version, ///< index of @b version field
+        FieldIdx_svId, ///< index of @b svId field
+        FieldIdx_reserved1, ///< index of @b reserved1 field
+        FieldIdx_SatH1, ///< index of @b SatH1 field
+        FieldIdx_IODC, ///< index of @b IODC field
+        FieldIdx_a2, ///< index of @b a2 field
+        FieldIdx_a1, ///< index of @b a1 field
+        FieldIdx_a0, ///< index of @b a0 field
+        FieldIdx_toc, ///< index of @b toc field
+        FieldIdx_TGD1, ///< index of @b TGD1 field
+        FieldIdx_URAI, ///< index of @b URAI field
+        FieldIdx_IODE, ///< index of @b IODE field
+        FieldIdx_toe, ///< index of @b toe field
+        FieldIdx_sqrtA, ///< index of @b sqrtA field
+        FieldIdx_e, ///< index of @b e field
+        FieldIdx_omega, ///< index of @b omega field
+        FieldIdx_Deltan, ///< index of @b Deltan field
+        FieldIdx_IDOT, ///< index of @b IDOT field
+        FieldIdx_M0, ///< index of @b M0 field
+        FieldIdx_Omega0, ///< index of @b Omega0 field
+        FieldIdx_OmegaDot, ///< index of @b OmegaDot field
+        FieldIdx_i0, ///< index of @b i0 field
+        FieldIdx_Cuc, ///< index of @b Cuc field
+        FieldIdx_Cus, ///< index of @b Cus field
+        FieldIdx_Crc, ///< index of @b Crc field
+        FieldIdx_Crs, ///< index of @b Crs field
+        FieldIdx_Cic, ///< index of @b Cic field
+        FieldIdx_Cis, ///< index of @b Cis field
+        FieldIdx_reserved2, ///< index of @b reserved2 field
+        FieldIdx_numOfValues ///< number of available fields
+    };
+
+    /// @brief Default constructor, creates empty view.
+    MgaBdsEphView() = default;
+
+    /// @brief Constructor
+    /// @param[in] payload Pointer to the payload of the message.
+    /// @param[in] len Length of the payload.
+    MgaBdsEphView(const std::uint8_t* payload, std::size_t len)
+      : Base(payload, len)
+    {
+    }
+
+    /// @brief Decode "type" field (see @ref ublox::message::MgaBdsEphFields::type).
+    comms::ErrorStatus field_type(FieldType<FieldIdx_type>& field) const
+    {
+        return Base::readField<FieldIdx_type>(field);
+    }
+
+    /// @brief Decode "version" field (see @ref ublox::message::MgaBdsEphFields::version).
+    comms::ErrorStatus field_version(FieldType<FieldIdx_version>& field) const
+    {
+        return Base::readField<FieldIdx_version>(field);
+    }
+
+    /// @brief Decode "svId" field (see @ref ublox::message::MgaBdsEphFields::svId).
+    comms::ErrorStatus field_svId(FieldType<FieldIdx_svId>& field) const
+    {
+        return Base::readField<FieldIdx_svId>(field);
+    }
+
+    /// @brief Decode "reserved1" field (see @ref ublox::message::MgaBdsEphFields::reserved1).
+    comms::ErrorStatus field_reserved1(FieldType<FieldIdx_reserved1>& field) const
+    {
+        return Base::readField<FieldIdx_reserved1>(field);
+    }
+
+    /// @brief Decode "SatH1" field (see @ref ublox::message::MgaBdsEphFields::SatH1).
+    comms::ErrorStatus field_SatH1(FieldType<FieldIdx_SatH1>& field) const
+    {
+        return Base::readField<FieldIdx_SatH1>(field);
+    }
+
+    /// @brief Decode "IODC" field (see @ref ublox::message::MgaBdsEphFields::IODC).
+    comms::ErrorStatus field_IODC(FieldType<FieldIdx_IODC>& field) const
+    {
+        return Base::readField<FieldIdx_IODC>(field);
+    }
+
+    /// @brief Decode "a2" field (see @ref ublox::message::MgaBdsEphFields::a2).
+    comms::ErrorStatus field_a2(FieldType<FieldIdx_a2>& field) const
+    {
+        return Base::readField<FieldIdx_a2>(field);
+    }
+
+    /// @brief Decode "a1" field (see @ref ublox::message::MgaBdsEphFields::a1).
+    comms::ErrorStatus field_a1(FieldType<FieldIdx_a1>& field) const
+    {
+        return Base::readField<FieldIdx_a1>(field);
+    }
+
+    /// @brief Decode "a0" field (see @ref ublox::message::MgaBdsEphFields::a0).
+    comms::ErrorStatus field_a0(FieldType<FieldIdx_a0>& field) const
+    {
+        return Base::readField<FieldIdx_a0>(field);
+    }
+
+    /// @brief Decode "toc" field (see @ref ublox::message::MgaBdsEphFields::toc).
+    comms::ErrorStatus field_toc(FieldType<FieldIdx_toc>& field) const
+    {
+        return Base::readField<FieldIdx_toc>(field);
+    }
+
+    /// @brief Decode "TGD1" field (see @ref ublox::message::MgaBdsEphFields::TGD1).
+    comms::ErrorStatus field_TGD1(FieldType<FieldIdx_TGD1>& field) const
+    {
+        return Base::readField<FieldIdx_TGD1>(field);
+    }
+
+    /// @brief Decode "URAI" field (see @ref ublox::message::MgaBdsEphFields::URAI).
+    comms::ErrorStatus field_URAI(FieldType<FieldIdx_URAI>& field) const
+    {
+        return Base::readField<FieldIdx_URAI>(field);
+    }
+
+    /// @brief Decode "IODE" field (see @ref ublox::message::MgaBdsEphFields::IODE).
+    comms::ErrorStatus field_IODE(FieldType<FieldIdx_IODE>& field) const
+    {
+        return Base::readField<FieldIdx_IODE>(field);
+    }
+
+    /// @brief Decode "toe" field (see @ref ublox::message::MgaBdsEphFields::toe).
+    comms::ErrorStatus field_toe(FieldType<FieldIdx_toe>& field) const
+    {
+        return Base::readField<FieldIdx_toe>(field);
+    }
+
+    /// @brief Decode "sqrtA" field (see @ref ublox::message::MgaBdsEphFields::sqrtA).
+    comms::ErrorStatus field_sqrtA(FieldType<FieldIdx_sqrtA>& field) const
+    {
+        return Base::readField<FieldIdx_sqrtA>(field);
+    }
+
+    /// @brief Decode "e" field (see @ref ublox::message::MgaBdsEphFields::e).
+    comms::ErrorStatus field_e(FieldType<FieldIdx_e>& field) const
+    {
+        return Base::readField<FieldIdx_e>(field);
+    }
+
+    /// @brief Decode "omega" field (see @ref ublox::message::MgaBdsEphFields::omega).
+    comms::ErrorStatus field_omega(FieldType<FieldIdx_omega>& field) const
+    {
+        return Base::readField<FieldIdx_omega>(field);
+    }
+
+    /// @brief Decode "Deltan" field (see @ref ublox::message::MgaBdsEphFields::Deltan).
+    comms::ErrorStatus field_Deltan(FieldType<FieldIdx_Deltan>& field) const
+    {
+        return Base::readField<FieldIdx_Deltan>(field);
+    }
+
+    /// @brief Decode "IDOT" field (see @ref ublox::message::MgaBdsEphFields::IDOT).
+    comms::ErrorStatus field_IDOT(FieldType<FieldIdx_IDOT>& field) const
+    {
+        return Base::readField<FieldIdx_IDOT>(field);
+    }
+
+    /// @brief Decode "M0" field (see @ref ublox::message::MgaBdsEphFields::M0).
+    comms::ErrorStatus field_M0(FieldType<FieldIdx_M0>& field) const
+    {
+        return Base::readField<FieldIdx_M0>(field);
+    }
+
+    /// @brief Decode "Omega0" field (see @ref ublox::message::MgaBdsEphFields::Omega0).
+    comms::ErrorStatus field_Omega0(FieldType<FieldIdx_Omega0>& field) const
+    {
+        return Base::readField<FieldIdx_Omega0>(field);
+    }
+
+    /// @brief Decode "OmegaDot" field (see @ref ublox::message::MgaBdsEphFields::OmegaDot).
+    comms::ErrorStatus field_OmegaDot(FieldType<FieldIdx_OmegaDot>& field) const
+    {
+        return Base::readField<FieldIdx_OmegaDot>(field);
+    }
+
+    /// @brief Decode "i0" field (see @ref ublox::message::MgaBdsEphFields::i0).
+    comms::ErrorStatus field_i0(FieldType<FieldIdx_i0>& field) const
+    {
+        return Base::readField<FieldIdx_i0>(field);
+    }
+
+    /// @brief Decode "Cuc" field (see @ref ublox::message::MgaBdsEphFields::Cuc).
+    comms::ErrorStatus field_Cuc(FieldType<FieldIdx_Cuc>& field) const
+    {
+        return Base::readField<FieldIdx_Cuc>(field);
+    }
+
+    /// @brief Decode "Cus" field (see @ref ublox::message::MgaBdsEphFields::Cus).
+    comms::ErrorStatus field_Cus(FieldType<FieldIdx_Cus>& field) const
+    {
+        return Base::readField<FieldIdx_Cus>(field);
+    }
+
+    /// @brief Decode "Crc" field (see @ref ublox::message::MgaBdsEphFields::Crc).
+    comms::ErrorStatus field_Crc(FieldType<FieldIdx_Crc>& field) const
+    {
+        return Base::readField<FieldIdx_Crc>(field);
+    }
+
+    /// @brief Decode "Crs" field (see @ref ublox::message::MgaBdsEphFields::Crs).
+    comms::ErrorStatus field_Crs(FieldType<FieldIdx_Crs>& field) const
+    {
+        return Base::readField<FieldIdx_Crs>(field);
+    }
+
+    /// @brief Decode "Cic" field (see @ref ublox::message::MgaBdsEphFields::Cic).
+    comms::ErrorStatus field_Cic(FieldType<FieldIdx_Cic>& field) const
+    {
+        return Base::readField<FieldIdx_Cic>(field);
+    }
+
+    /// @brief Decode "Cis" field (see @ref ublox::message::MgaBdsEphFields::Cis).
+    comms::ErrorStatus field_Cis(FieldType<FieldIdx_Cis>& field) const
+    {
+        return Base::readField<FieldIdx_Cis>(field);
+    }
+
+    /// @brief Decode "reserved2" field (see @ref ublox::message::MgaBdsEphFields::reserved2).
+    comms::ErrorStatus field_reserved2(FieldType<FieldIdx_reserved2>& field) const
+    {
+        return Base::readField<FieldIdx_reserved2>(field);
+    }
+};
+
+} // namespace view
+
+} // namespace ublox
+
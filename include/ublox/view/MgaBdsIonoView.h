@@ -0,0 +1,157 @@
+//
+// Copyright 2018 (C). Alex Robenko. All rights reserved.
+//
+
+// This file is free software: you can redistribute it and/or modify
+// it under the terms of the GNU General Public License as published by
+// the Free Software Foundation, either version 3 of the License, or
+// (at your option) any later version.
+//
+// This program is distributed in the hope that it will be useful,
+// but WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+// GNU General Public License for more details.
+//
+// You should have received a copy of the GNU General Public License
+// along with this program.  If not, see <http://www.gnu.org/licenses/>.
+
+/// @file
+/// @brief Contains definition of lazy view of MGA-BDS-IONO message.
+/// @details Generated by script/gen_views.py, do NOT edit manually.
+
+#pragma once
+
+#include "ublox/message/MgaBdsIono.h"
+#include "MsgView.h"
+
+namespace ublox
+{
+
+namespace view
+{
+
+/// @brief Lazy read-only view of MGA-BDS-IONO message payload.
+/// @details Wraps the pointer to the validated payload, the fields are
+///     decoded on access only, see @ref MsgView.
+/// @see @ref ublox::message::MgaBdsIono
+class MgaBdsIonoView : public
+    MsgView<
+        ublox::message::MgaBdsIonoFields::All
+    >
+{
+    using Base =
+        MsgView<
+            ublox::message::MgaBdsIonoFields::All
+        >;
+
+public:
+    /// @brief ID of the viewed message.
+    static const MsgId MsgIdValue = MsgId_MGA_BDS;
+
+    /// @brief Index of the fields, same as the ones defined by
+    ///     @b COMMS_MSG_FIELDS_ACCESS() in @ref ublox::message::MgaBdsIono.
+    enum FieldIdx
+    {
+        FieldIdx_type, ///< index of @b type field
+        FieldIdx_version, ///< index of @b version field
+        FieldIdx_reserved1, ///< index of @b reserved1 field
+        FieldIdx_alpha0, ///< index of @b alpha0 field
+        FieldIdx_alpha1, ///< index of @b alpha1 field
+        FieldIdx_alpha2, ///< index of @b alpha2 field
+        FieldIdx_alpha3, ///< index of @b alpha3 field
+        FieldIdx_beta0, ///< index of @b beta0 field
+        FieldIdx_beta1, ///< index of @b beta1 field
+        FieldIdx_beta2, ///< index of @b beta2 field
+        FieldIdx_beta3, ///< index of @b beta3 field
+        FieldIdx_reserved2, ///< index of @b reserved2 field
+        FieldIdx_numOfValues ///< number of available fields
+    };
+
+    /// @brief Default constructor, creates empty view.
+    MgaBdsIonoView() = default;
+
+    /// @brief Constructor
+    /// @param[in] payload Pointer to the payload of the message.
+    /// @param[in] len Length of the payload.
+    MgaBdsIonoView(const std::uint8_t* payload, std::size_t len)
+      : Base(payload, len)
+    {
+    }
+
+    /// @brief Decode "type" field (see @ref ublox::message::MgaBdsIonoFields::type).
+    comms::ErrorStatus field_type(FieldType<FieldIdx_type>& field) const
+    {
+        return Base::readField<FieldIdx_type>(field);
+    }
+
+    /// @brief Decode "version" field (see @ref ublox::message::MgaBdsIonoFields::version).
+    comms::ErrorStatus field_version(FieldType<FieldIdx_version>& field) const
+    {
+        return Base::readField<FieldIdx_version>(field);
+    }
+
+    /// @brief Decode "reserved1" field (see @ref ublox::message::MgaBdsIonoFields::reserved1).
+    comms::ErrorStatus field_reserved1(FieldType<FieldIdx_reserved1>& field) const
+    {
+        return Base::readField<FieldIdx_reserved1>(field);
+    }
+
+    /// @brief Decode "alpha0" field (see @ref ublox::message::MgaBdsIonoFields::alpha0).
+    comms::ErrorStatus field_alpha0(FieldType<FieldIdx_alpha0>& field) const
+    {
+        return Base::readField<FieldIdx_alpha0>(field);
+    }
+
+    /// @brief Decode "alpha1" field (see @ref ublox::message::MgaBdsIonoFields::alpha1).
+    comms::ErrorStatus field_alpha1(FieldType<FieldIdx_alpha1>& field) const
+    {
+        return Base::readField<FieldIdx_alpha1>(field);
+    }
+
+    /// @brief Decode "alpha2" field (see @ref ublox::message::MgaBdsIonoFields::alpha2).
+    comms::ErrorStatus field_alpha2(FieldType<FieldIdx_alpha2>& field) const
+    {
+        return Base::readField<FieldIdx_alpha2>(field);
+    }
+
+    /// @brief Decode "alpha3" field (see @ref ublox::message::MgaBdsIonoFields::alpha3).
+    comms::ErrorStatus field_alpha3(FieldType<FieldIdx_alpha3>& field) const
+    {
+        return Base::readField<FieldIdx_alpha3>(field);
+    }
+
+    /// @brief Decode "beta0" field (see @ref ublox::message::MgaBdsIonoFields::beta0).
+    comms::ErrorStatus field_beta0(FieldType<FieldIdx_beta0>& field) const
+    {
+        return Base::readField<FieldIdx_beta0>(field);
+    }
+
+    /// @brief Decode "beta1" field (see @ref ublox::message::MgaBdsIonoFields::beta1).
+    comms::ErrorStatus field_beta1(FieldType<FieldIdx_beta1>& field) const
+    {
+        return Base::readField<FieldIdx_beta1>(field);
+    }
+
+    /// @brief Decode "beta2" field (see @ref ublox::message::MgaBdsIonoFields::beta2).
+    comms::ErrorStatus field_beta2(FieldType<FieldIdx_beta2>& field) const
+    {
+        return Base::readField<FieldIdx_beta2>(field);
+    }
+
+    /// @brief Decode "beta3" field (see @ref ublox::message::MgaBdsIonoFields::beta3).
+    comms::ErrorStatus field_beta3(FieldType<FieldIdx_beta3>& field) const
+    {
+        return Base::readField<FieldIdx_beta3>(field);
+    }
+
+    /// @brief Decode "reserved2" field (see @ref ublox::message::MgaBdsIonoFields::reserved2).
+    comms::ErrorStatus field_reserved2(FieldType<FieldIdx_reserved2>& field) const
+    {
+        return Base::readField<FieldIdx_reserved2>(field);
+    }
+};
+
+} // namespace view
+
+} // namespace ublox
+
@@ -0,0 +1,157 @@
+//
+// Copyright 2018 (C). Alex Robenko. All rights reserved.
+//
+
+// This file is free software: you can redistribute it and/or modify
+// it under the terms of the GNU General Public License as published by
+// the Free Software Foundation, either version 3 of the License, or
+// (at your option) any later version.
+//
+// This program is distributed in the hope that it will be useful,
+// but WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+// GNU General Public License for more details.
+//
+// You should have received a copy of the GNU General Public License
+// along with this program.  If not, see <http://www.gnu.org/licenses/>.
+
+/// @file
+/// @brief Contains definition of lazy view of MGA-BDS-UTC message.
+/// @details Generated by script/gen_views.py, do NOT edit manually.
+
+#pragma once
+
+#include "ublox/message/MgaBdsUtc.h"
+#include "MsgView.h"
+
+namespace ublox
+{
+
+namespace view
+{
+
+/// @brief Lazy read-only view of MGA-BDS-UTC message payload.
+/// @details Wraps the pointer to the validated payload, the fields are
+///     decoded on access only, see @ref MsgView.
+/// @see @ref ublox::message::MgaBdsUtc
+class MgaBdsUtcView : public
+    MsgView<
+        ublox::message::MgaBdsUtcFields::All
+    >
+{
+    using Base =
+        MsgView<
+            ublox::message::MgaBdsUtcFields::All
+        >;
+
+public:
+    /// @brief ID of the viewed message.
+    static const MsgId MsgIdValue = MsgId_MGA_BDS;
+
+    /// @brief Index of the fields, same as the ones defined by
+    ///     @b COMMS_MSG_FIELDS_ACCESS() in @ref ublox::message::MgaBdsUtc.
+    enum FieldIdx
+    {
+        FieldIdx_type, ///< index of @b type field
+        FieldIdx_version, ///< index of @b version field
+        FieldIdx_reserved1, ///< index of @b reserved1 field
+        FieldIdx_a0UTC, ///< index of @b a0UTC field
+        FieldIdx_a1UTC, ///< index of @b a1UTC field
+        FieldIdx_dtLS, ///< index of @b dtLS field
+        FieldIdx_reserved2, ///< index of @b reserved2 field
+        FieldIdx_wnRec, ///< index of @b wnRec field
+        FieldIdx_wnLSF, ///< index of @b wnLSF field
+        FieldIdx_dN, ///< index of @b dN field
+        FieldIdx_dtLSF, ///< index of @b dtLSF field
+        FieldIdx_reserved3, ///< index of @b reserved3 field
+        FieldIdx_numOfValues ///< number of available fields
+    };
+
+    /// @brief Default constructor, creates empty view.
+    MgaBdsUtcView() = default;
+
+    /// @brief Constructor
+    /// @param[in] payload Pointer to the payload of the message.
+    /// @param[in] len Length of the payload.
+    MgaBdsUtcView(const std::uint8_t* payload, std::size_t len)
+      : Base(payload, len)
+    {
+    }
+
+    /// @brief Decode "type" field (see @ref ublox::message::MgaBdsUtcFields::type).
+    comms::ErrorStatus field_type(FieldType<FieldIdx_type>& field) const
+    {
+        return Base::readField<FieldIdx_type>(field);
+    }
+
+    /// @brief Decode "version" field (see @ref ublox::message::MgaBdsUtcFields::version).
+    comms::ErrorStatus field_version(FieldType<FieldIdx_version>& field) const
+    {
+        return Base::readField<FieldIdx_version>(field);
+    }
+
+    /// @brief Decode "reserved1" field (see @ref ublox::message::MgaBdsUtcFields::reserved1).
+    comms::ErrorStatus field_reserved1(FieldType<FieldIdx_reserved1>& field) const
+    {
+        return Base::readField<FieldIdx_reserved1>(field);
+    }
+
+    /// @brief Decode "a0UTC" field (see @ref ublox::message::MgaBdsUtcFields::a0UTC).
+    comms::ErrorStatus field_a0UTC(FieldType<FieldIdx_a0UTC>& field) const
+    {
+        return Base::readField<FieldIdx_a0UTC>(field);
+    }
+
+    /// @brief Decode "a1UTC" field (see @ref ublox::message::MgaBdsUtcFields::a1UTC).
+    comms::ErrorStatus field_a1UTC(FieldType<FieldIdx_a1UTC>& field) const
+    {
+        return Base::readField<FieldIdx_a1UTC>(field);
+    }
+
+    /// @brief Decode "dtLS" field (see @ref ublox::message::MgaBdsUtcFields::dtLS).
+    comms::ErrorStatus field_dtLS(FieldType<FieldIdx_dtLS>& field) const
+    {
+        return Base::readField<FieldIdx_dtLS>(field);
+    }
+
+    /// @brief Decode "reserved2" field (see @ref ublox::message::MgaBdsUtcFields::reserved2).
+    comms::ErrorStatus field_reserved2(FieldType<FieldIdx_reserved2>& field) const
+    {
+        return Base::readField<FieldIdx_reserved2>(field);
+    }
+
+    /// @brief Decode "wnRec" field (see @ref ublox::message::MgaBdsUtcFields::wnRec).
+    comms::ErrorStatus field_wnRec(FieldType<FieldIdx_wnRec>& field) const
+    {
+        return Base::readField<FieldIdx_wnRec>(field);
+    }
+
+    /// @brief Decode "wnLSF" field (see @ref ublox::message::MgaBdsUtcFields::wnLSF).
+    comms::ErrorStatus field_wnLSF(FieldType<FieldIdx_wnLSF>& field) const
+    {
+        return Base::readField<FieldIdx_wnLSF>(field);
+    }
+
+    /// @brief Decode "dN" field (see @ref ublox::message::MgaBdsUtcFields::dN).
+    comms::ErrorStatus field_dN(FieldType<FieldIdx_dN>& field) const
+    {
+        return Base::readField<FieldIdx_dN>(field);
+    }
+
+    /// @brief Decode "dtLSF" field (see @ref ublox::message::MgaBdsUtcFields::dtLSF).
+    comms::ErrorStatus field_dtLSF(FieldType<FieldIdx_dtLSF>& field) const
+    {
+        return Base::readField<FieldIdx_dtLSF>(field);
+    }
+
+    /// @brief Decode "reserved3" field (see @ref ublox::message::MgaBdsUtcFields::reserved3).
+    comms::ErrorStatus field_reserved3(FieldType<FieldIdx_reserved3>& field) const
+    {
+        return Base::readField<FieldIdx_reserved3>(field);
+    }
+};
+
+} // namespace view
+
+} // namespace ublox
+
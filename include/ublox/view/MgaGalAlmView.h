@@ -0,0 +1,206 @@
+//
+// Copyright 2018 (C). Alex Robenko. All rights reserved.
+//
+
+// This file is free software: you can redistribute it and/or modify
+// it under the terms of the GNU General Public License as published by
+// the Free Software Foundation, either version 3 of the License, or
+// (at your option) any later version.
+//
+// This program is distributed in the hope that it will be useful,
+// but WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+// GNU General Public License for more details.
+//
+// You should have received a copy of the GNU General Public License
+// along with this program.  If not, see <http://www.gnu.org/licenses/>.
+
+/// @file
+/// @brief Contains definition of lazy view of MGA-GAL-ALM message.
+/// @details Generated by script/gen_views.py, do NOT edit manually.
+
+#pragma once
+
+#include "ublox/message/MgaGalAlm.h"
+#include "MsgView.h"
+
+namespace ublox
+{
+
+namespace view
+{
+
+/// @brief Lazy read-only view of MGA-GAL-ALM message payload.
+/// @details Wraps the pointer to the validated payload, the fields are
+///     decoded on access only, see @ref MsgView.
+/// @see @ref ublox::message::MgaGalAlm
+class MgaGalAlmView : public
+    MsgView<
+        ublox::message::MgaGalAlmFields::All
+    >
+{
+    using Base =
+        MsgView<
+            ublox::message::MgaGalAlmFields::All
+        >;
+
+public:
+    /// @brief ID of the viewed message.
+    static const MsgId MsgIdValue = MsgId_MGA_GAL;
+
+    /// @brief Index of the fields, same as the ones defined by
+    ///     @b COMMS_MSG_FIELDS_ACCESS() in @ref ublox::message::MgaGalAlm.
+    enum FieldIdx
+    {
+        FieldIdx_type, ///< index of @b type field
+        FieldIdx_version, ///< index of @b version field
+        FieldIdx_svId, ///< index of @b svId field
+        FieldIdx_reserved1, ///< index of @b reserved1 field
+        FieldIdx_ioda, ///< index of @b ioda field
+        FieldIdx_almWNa, ///< index of @b almWNa field
+        FieldIdx_toa, ///< index of @b toa field
+        FieldIdx_deltaSqrtA, ///< index of @b deltaSqrtA field
+        FieldIdx_e, ///< index of @b e field
+        FieldIdx_deltaI, ///< index of @b deltaI field
+        FieldIdx_omega0, ///< index of @b omega0 field
+        FieldIdx_omegaDot, ///< index of @b omegaDot field
+        FieldIdx_omega, ///< index of @b omega field
+        FieldIdx_m0, ///< index of @b m0 field
+        FieldIdx_af0, ///< index of @b af0 field
+        FieldIdx_af1, ///< index of @b af1 field
+        FieldIdx_healthE1B, ///< index of @b healthE1B field
+        FieldIdx_healthE5b, ///< index of @b healthE5b field
+        FieldIdx_reserved2, ///< index of @b reserved2 field
+        FieldIdx_numOfValues ///< number of available fields
+    };
+
+    /// @brief Default constructor, creates empty view.
+    MgaGalAlmView() = default;
+
+    /// @brief Constructor
+    /// @param[in] payload Pointer to the payload of the message.
+    /// @param[in] len Length of the payload.
+    MgaGalAlmView(const std::uint8_t* payload, std::size_t len)
+      : Base(payload, len)
+    {
+    }
+
+    /// @brief Decode "type" field (see @ref ublox::message::MgaGalAlmFields::type).
+    comms::ErrorStatus field_type(FieldType<FieldIdx_type>& field) const
+    {
+        return Base::readField<FieldIdx_type>(field);
+    }
+
+    /// @brief Decode "version" field (see @ref ublox::message::MgaGalAlmFields::version).
+    comms::ErrorStatus field_version(FieldType<FieldIdx_version>& field) const
+    {
+        return Base::readField<FieldIdx_version>(field);
+    }
+
+    /// @brief Decode "svId" field (see @ref ublox::message::MgaGalAlmFields::svId).
+    comms::ErrorStatus field_svId(FieldType<FieldIdx_svId>& field) const
+    {
+        return Base::readField<FieldIdx_svId>(field);
+    }
+
+    /// @brief Decode "reserved1" field (see @ref ublox::message::MgaGalAlmFields::reserved1).
+    comms::ErrorStatus field_reserved1(FieldType<FieldIdx_reserved1>& field) const
+    {
+        return Base::readField<FieldIdx_reserved1>(field);
+    }
+
+    /// @brief Decode "ioda" field (see @ref ublox::message::MgaGalAlmFields::ioda).
+    comms::ErrorStatus field_ioda(FieldType<FieldIdx_ioda>& field) const
+    {
+        return Base::readField<FieldIdx_ioda>(field);
+    }
+
+    /// @brief Decode "almWNa" field (see @ref ublox::message::MgaGalAlmFields::almWNa).
+    comms::ErrorStatus field_almWNa(FieldType<FieldIdx_almWNa>& field) const
+    {
+        return Base::readField<FieldIdx_almWNa>(field);
+    }
+
+    /// @brief Decode "toa" field (see @ref ublox::message::MgaGalAlmFields::toa).
+    comms::ErrorStatus field_toa(FieldType<FieldIdx_toa>& field) const
+    {
+        return Base::readField<FieldIdx_toa>(field);
+    }
+
+    /// @brief Decode "deltaSqrtA" field (see @ref ublox::message::MgaGalAlmFields::deltaSqrtA).
+    comms::ErrorStatus field_deltaSqrtA(FieldType<FieldIdx_deltaSqrtA>& field) const
+    {
+        return Base::readField<FieldIdx_deltaSqrtA>(field);
+    }
+
+    /// @brief Decode "e" field (see @ref ublox::message::MgaGalAlmFields::e).
+    comms::ErrorStatus field_e(FieldType<FieldIdx_e>& field) const
+    {
+        return Base::readField<FieldIdx_e>(field);
+    }
+
+    /// @brief Decode "deltaI" field (see @ref ublox::message::MgaGalAlmFields::deltaI).
+    comms::ErrorStatus field_deltaI(FieldType<FieldIdx_deltaI>& field) const
+    {
+        return Base::readField<FieldIdx_deltaI>(field);
+    }
+
+    /// @brief Decode "omega0" field (see @ref ublox::message::MgaGalAlmFields::omega0).
+    comms::ErrorStatus field_omega0(FieldType<FieldIdx_omega0>& field) const
+    {
+        return Base::readField<FieldIdx_omega0>(field);
+    }
+
+    /// @brief Decode "omegaDot" field (see @ref ublox::message::MgaGalAlmFields::omegaDot).
+    comms::ErrorStatus field_omegaDot(FieldType<FieldIdx_omegaDot>& field) const
+    {
+        return Base::readField<FieldIdx_omegaDot>(field);
+    }
+
+    /// @brief Decode "omega" field (see @ref ublox::message::MgaGalAlmFields::omega).
+    comms::ErrorStatus field_omega(FieldType<FieldIdx_omega>& field) const
+    {
+        return Base::readField<FieldIdx_omega>(field);
+    }
+
+    /// @brief Decode "m0" field (see @ref ublox::message::MgaGalAlmFields::m0).
+    comms::ErrorStatus field_m0(FieldType<FieldIdx_m0>& field) const
+    {
+        return Base::readField<FieldIdx_m0>(field);
+    }
+
+    /// @brief Decode "af0" field (see @ref ublox::message::MgaGalAlmFields::af0).
+    comms::ErrorStatus field_af0(FieldType<FieldIdx_af0>& field) const
+    {
+        return Base::readField<FieldIdx_af0>(field);
+    }
+
+    /// @brief Decode "af1" field (see @ref ublox::message::MgaGalAlmFields::af1).
+    comms::ErrorStatus field_af1(FieldType<FieldIdx_af1>& field) const
+    {
+        return Base::readField<FieldIdx_af1>(field);
+    }
+
+    /// @brief Decode "healthE1B" field (see @ref ublox::message::MgaGalAlmFields::healthE1B).
+    comms::ErrorStatus field_healthE1B(FieldType<FieldIdx_healthE1B>& field) const
+    {
+        return Base::readField<FieldIdx_healthE1B>(field);
+    }
+
+    /// @brief Decode "healthE5b" field (see @ref ublox::message::MgaGalAlmFields::healthE5b).
+    comms::ErrorStatus field_healthE5b(FieldType<FieldIdx_healthE5b>& field) const
+    {
+        return Base::readField<FieldIdx_healthE5b>(field);
+    }
+
+    /// @brief Decode "reserved2" field (see @ref ublox::message::MgaGalAlmFields::reserved2).
+    comms::ErrorStatus field_reserved2(FieldType<FieldIdx_reserved2>& field) const
+    {
+        return Base::readField<FieldIdx_reserved2>(field);
+    }
+};
+
+} // namespace view
+
+} // namespace ublox
+
@@ -0,0 +1,304 @@
+//
+// Copyright 2018 (C). Alex Robenko. All rights reserved.
+//
+
+// This file is free software: you can redistribute it and/or modify
+// it under the terms of the GNU General Public License as published by
+// the Free Software Foundation, either version 3 of the License, or
+// (at your option) any later version.
+//
+// This program is distributed in the hope that it will be useful,
+// but WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+// GNU General Public License for more details.
+//
+// You should have received a copy of the GNU General Public License
+// along with this program.  If not, see <http://www.gnu.org/licenses/>.
+
+/// @file
+/// @brief Contains definition of lazy view of MGA-GAL-EPH message.
+/// @details Generated by script/gen_views.py, do NOT edit manually.
+
+#pragma once
+
+#include "ublox/message/MgaGalEph.h"
+#include "MsgView.h"
+
+namespace ublox
+{
+
+namespace view
+{
+
+/// @brief Lazy read-only view of MGA-GAL-EPH message payload.
+/// @details Wraps the pointer to the validated payload, the fields are
+///     decoded on access only, see @ref MsgView.
+/// @see @ref ublox::message::MgaGalEph
+class MgaGalEphView : public
+    MsgView<
+        ublox::message::MgaGalEphFields::All
+    >
+{
+    using Base =
+        MsgView<
+            ublox::message::MgaGalEphFields::All
+        >;
+
+public:
+    /// @brief ID of the viewed message.
+    static const MsgId MsgIdValue = MsgId_MGA_GAL;
+
+    /// @brief Index of the fields, same as the ones defined by
+    ///     @b COMMS_MSG_FIELDS_ACCESS() in @ref ublox::message::MgaGalEph.
+    enum FieldIdx
+    {
+        FieldIdx_type, ///< index of @b type field
+        FieldIdx_version, ///< index of @b version field
+        FieldIdx_svId, ///< index of @b svId field
+        FieldIdx_reserved1, ///< index of @b reserved1 field
+        FieldIdx_iodNav, ///< index of @b iodNav field
+        FieldIdx_deltaN, ///< index of @b deltaN field
+        FieldIdx_m0, ///< index of @b m0 field
+        FieldIdx_e, ///< index of @b e field
+        FieldIdx_sqrtA, ///< index of @b sqrtA field
+        FieldIdx_omega0, ///< index of @b omega0 field
+        FieldIdx_i0, ///< index of @b i0 field
+        FieldIdx_omega, ///< index of @b omega field
+        FieldIdx_omegaDot, ///< index of @b omegaDot field
+        FieldIdx_iDot, ///< index of @b iDot field
+        FieldIdx_cuc, ///< index of @b cuc field
+        FieldIdx_cus, ///< index of @b cus field
+        FieldIdx_crc, ///< index of @b crc field
+        FieldIdx_crs, ///< index of @b crs field
+        FieldIdx_cic, ///< index of @b cic field
+        FieldIdx_cis, ///< index of @b cis field
+        FieldIdx_toe, ///< index of @b toe field
+        FieldIdx_af0, ///< index of @b af0 field
+        FieldIdx_af1, ///< index of @b af1 field
+        FieldIdx_af2, ///< index of @b af2 field
+        FieldIdx_sisaIndexE1E5b, ///< index of @b sisaIndexE1E5b field
+        FieldIdx_toc, ///< index of @b toc field
+        FieldIdx_bgdE1E5b, ///< index of @b bgdE1E5b field
+        FieldIdx_reserved2, ///< index of @b reserved2 field
+        FieldIdx_healthE1B, ///< index of @b healthE1B field
+        FieldIdx_dataValidityE1B, ///< index of @b dataValidityE1B field
+        FieldIdx_healthE5B, ///< index of @b healthE5B field
+        FieldIdx_dataValidityE5B, ///< index of @b dataValidityE5B field
+        FieldIdx_reserved3, ///< index of @b reserved3 field
+        FieldIdx_numOfValues ///< number of available fields
+    };
+
+    /// @brief Default constructor, creates empty view.
+    MgaGalEphView() = default;
+
+    /// @brief Constructor
+    /// @param[in] payload Pointer to the payload of the message.
+    /// @param[in] len Length of the payload.
+    MgaGalEphView(const std::uint8_t* payload, std::size_t len)
+      : Base(payload, len)
+    {
+    }
+
+    /// @brief Decode "type" field (see @ref ublox::message::MgaGalEphFields::type).
+    comms::ErrorStatus field_type(FieldType<FieldIdx_type>& field) const
+    {
+        return Base::readField<FieldIdx_type>(field);
+    }
+
+    /// @brief Decode "version" field (see @ref ublox::message::MgaGalEphFields::version).
+    comms::ErrorStatus field_version(FieldType<FieldIdx_version>& field) const
+    {
+        return Base::readField<FieldIdx_version>(field);
+    }
+
+    /// @brief Decode "svId" field (see @ref ublox::message::MgaGalEphFields::svId).
+    comms::ErrorStatus field_svId(FieldType<FieldIdx_svId>& field) const
+    {
+        return Base::readField<FieldIdx_svId>(field);
+    }
+
+    /// @brief Decode "reserved1" field (see @ref ublox::message::MgaGalEphFields::reserved1).
+    comms::ErrorStatus field_reserved1(FieldType<FieldIdx_reserved1>& field) const
+    {
+        return Base::readField<FieldIdx_reserved1>(field);
+    }
+
+    /// @brief Decode "iodNav" field (see @ref ublox::message::MgaGalEphFields::iodNav).
+    comms::ErrorStatus field_iodNav(FieldType<FieldIdx_iodNav>& field) const
+    {
+        return Base::readField<FieldIdx_iodNav>(field);
+    }
+
+    /// @brief Decode "deltaN" field (see @ref ublox::message::MgaGalEphFields::deltaN).
+    comms::ErrorStatus field_deltaN(FieldType<FieldIdx_deltaN>& field) const
+    {
+        return Base::readField<FieldIdx_deltaN>(field);
+    }
+
+    /// @brief Decode "m0" field (see @ref ublox::message::MgaGalEphFields::m0).
+    comms::ErrorStatus field_m0(FieldType<FieldIdx_m0>& field) const
+    {
+        return Base::readField<FieldIdx_m0>(field);
+    }
+
+    /// @brief Decode "e" field (see @ref ublox::message::MgaGalEphFields::e).
+    comms::ErrorStatus field_e(FieldType<FieldIdx_e>& field) const
+    {
+        return Base::readField<FieldIdx_e>(field);
+    }
+
+    /// @brief Decode "sqrtA" field (see @ref ublox::message::MgaGalEphFields::sqrtA).
+    comms::ErrorStatus field_sqrtA(FieldType<FieldIdx_sqrtA>& field) const
+    {
+        return Base::readField<FieldIdx_sqrtA>(field);
+    }
+
+    /// @brief Decode "omega0" field (see @ref ublox::message::MgaGalEphFields::omega0).
+    comms::ErrorStatus field_omega0(FieldType<FieldIdx_omega0>& field) const
+    {
+        return Base::readField<FieldIdx_omega0>(field);
+    }
+
+    /// @brief Decode "i0" field (see @ref ublox::message::MgaGalEphFields::i0).
+    comms::ErrorStatus field_i0(FieldType<FieldIdx_i0>& field) const
+    {
+        return Base::readField<FieldIdx_i0>(field);
+    }
+
+    /// @brief Decode "omega" field (see @ref ublox::message::MgaGalEphFields::omega).
+    comms::ErrorStatus field_omega(FieldType<FieldIdx_omega>& field) const
+    {
+        return Base::readField<FieldIdx_omega>(field);
+    }
+
+    /// @brief Decode "omegaDot" field (see @ref ublox::message::MgaGalEphFields::omegaDot).
+    comms::ErrorStatus field_omegaDot(FieldType<FieldIdx_omegaDot>& field) const
+    {
+        return Base::readField<FieldIdx_omegaDot>(field);
+    }
+
+    /// @brief Decode "iDot" field (see @ref ublox::message::MgaGalEphFields::iDot).
+    comms::ErrorStatus field_iDot(FieldType<FieldIdx_iDot>& field) const
+    {
+        return Base::readField<FieldIdx_iDot>(field);
+    }
+
+    /// @brief Decode "cuc" field (see @ref ublox::message::MgaGalEphFields::cuc).
+    comms::ErrorStatus field_cuc(FieldType<FieldIdx_cuc>& field) const
+    {
+        return Base::readField<FieldIdx_cuc>(field);
+    }
+
+    /// @brief Decode "cus" field (see @ref ublox::message::MgaGalEphFields::cus).
+    comms::ErrorStatus field_cus(FieldType<FieldIdx_cus>& field) const
+    {
+        return Base::readField<FieldIdx_cus>(field);
+    }
+
+    /// @brief Decode "crc" field (see @ref ublox::message::MgaGalEphFields::crc).
+    comms::ErrorStatus field_crc(FieldType<FieldIdx_crc>& field) const
+    {
+        return Base::readField<FieldIdx_crc>(field);
+    }
+
+    /// @brief Decode "crs" field (see @ref ublox::message::MgaGalEphFields::crs).
+    comms::ErrorStatus field_crs(FieldType<FieldIdx_crs>& field) const
+    {
+        return Base::readField<FieldIdx_crs>(field);
+    }
+
+    /// @brief Decode "cic" field (see @ref ublox::message::MgaGalEphFields::cic).
+    comms::ErrorStatus field_cic(FieldType<FieldIdx_cic>& field) const
+    {
+        return Base::readField<FieldIdx_cic>(field);
+    }
+
+    /// @brief Decode "cis" field (see @ref ublox::message::MgaGalEphFields::cis).
+    comms::ErrorStatus field_cis(FieldType<FieldIdx_cis>& field) const
+    {
+        return Base::readField<FieldIdx_cis>(field);
+    }
+
+    /// @brief Decode "toe" field (see @ref ublox::message::MgaGalEphFields::toe).
+    comms::ErrorStatus field_toe(FieldType<FieldIdx_toe>& field) const
+    {
+        return Base::readField<FieldIdx_toe>(field);
+    }
+
+    /// @brief Decode "af0" field (see @ref ublox::message::MgaGalEphFields::af0).
+    comms::ErrorStatus field_af0(FieldType<FieldIdx_af0>& field) const
+    {
+        return Base::readField<FieldIdx_af0>(field);
+    }
+
+    /// @brief Decode "af1" field (see @ref ublox::message::MgaGalEphFields::af1).
+    comms::ErrorStatus field_af1(FieldType<FieldIdx_af1>& field) const
+    {
+        return Base::readField<FieldIdx_af1>(field);
+    }
+
+    /// @brief Decode "af2" field (see @ref ublox::message::MgaGalEphFields::af2).
+    comms::ErrorStatus field_af2(FieldType<FieldIdx_af2>& field) const
+    {
+        return Base::readField<FieldIdx_af2>(field);
+    }
+
+    /// @brief Decode "sisaIndexE1E5b" field (see @ref ublox::message::MgaGalEphFields::sisaIndexE1E5b).
+    comms::ErrorStatus field_sisaIndexE1E5b(FieldType<FieldIdx_sisaIndexE1E5b>& field) const
+    {
+        return Base::readField<FieldIdx_sisaIndexE1E5b>(field);
+    }
+
+    /// @brief Decode "toc" field (see @ref ublox::message::MgaGalEphFields::toc).
+    comms::ErrorStatus field_toc(FieldType<FieldIdx_toc>& field) const
+    {
+        return Base::readField<FieldIdx_toc>(field);
+    }
+
+    /// @brief Decode "bgdE1E5b" field (see @ref ublox::message::MgaGalEphFields::bgdE1E5b).
+    comms::ErrorStatus field_bgdE1E5b(FieldType<FieldIdx_bgdE1E5b>& field) const
+    {
+        return Base::readField<FieldIdx_bgdE1E5b>(field);
+    }
+
+    /// @brief Decode "reserved2" field (see @ref ublox::message::MgaGalEphFields::reserved2).
+    comms::ErrorStatus field_reserved2(FieldType<FieldIdx_reserved2>& field) const
+    {
+        return Base::readField<FieldIdx_reserved2>(field);
+    }
+
+    /// @brief Decode "healthE1B" field (see @ref ublox::message::MgaGalEphFields::healthE1B).
+    comms::ErrorStatus field_healthE1B(FieldType<FieldIdx_healthE1B>& field) const
+    {
+        return Base::readField<FieldIdx_healthE1B>(field);
+    }
+
+    /// @brief Decode "dataValidityE1B" field (see @ref ublox::message::MgaGalEphFields::dataValidityE1B).
+    comms::ErrorStatus field_dataValidityE1B(FieldType<FieldIdx_dataValidityE1B>& field) const
+    {
+        return Base::readField<FieldIdx_dataValidityE1B>(field);
+    }
+
+    /// @brief Decode "healthE5B" field (see @ref ublox::message::MgaGalEphFields::healthE5B).
+    comms::ErrorStatus field_healthE5B(FieldType<FieldIdx_healthE5B>& field) const
+    {
+        return Base::readField<FieldIdx_healthE5B>(field);
+    }
+
+    /// @brief Decode "dataValidityE5B" field (see @ref ublox::message::MgaGalEphFields::dataValidityE5B).
+    comms::ErrorStatus field_dataValidityE5B(FieldType<FieldIdx_dataValidityE5B>& field) const
+    {
+        return Base::readField<FieldIdx_dataValidityE5B>(field);
+    }
+
+    /// @brief Decode "reserved3" field (see @ref ublox::message::MgaGalEphFields::reserved3).
+    comms::ErrorStatus field_reserved3(FieldType<FieldIdx_reserved3>& field) const
+    {
+        return Base::readField<FieldIdx_reserved3>(field);
+    }
+};
+
+} // namespace view
+
+} // namespace ublox
+
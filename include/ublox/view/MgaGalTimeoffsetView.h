@@ -0,0 +1,129 @@
+//
+// Copyright 2018 (C). Alex Robenko. All rights reserved.
+//
+
+// This file is free software: you can redistribute it and/or modify
+// it under the terms of the GNU General Public License as published by
+// the Free Software Foundation, either version 3 of the License, or
+// (at your option) any later version.
+//
+// This program is distributed in the hope that it will be useful,
+// but WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+// GNU General Public License for more details.
+//
+// You should have received a copy of the GNU General Public License
+// along with this program.  If not, see <http://www.gnu.org/licenses/>.
+
+/// @file
+/// @brief Contains definition of lazy view of MGA-GAL-TIMEOFFSET message.
+/// @details Generated by script/gen_views.py, do NOT edit manually.
+
+#pragma once
+
+#include "ublox/message/MgaGalTimeoffset.h"
+#include "MsgView.h"
+
+namespace ublox
+{
+
+namespace view
+{
+
+/// @brief Lazy read-only view of MGA-GAL-TIMEOFFSET message payload.
+/// @details Wraps the pointer to the validated payload, the fields are
+///     decoded on access only, see @ref MsgView.
+/// @see @ref ublox::message::MgaGalTimeoffset
+class MgaGalTimeoffsetView : public
+    MsgView<
+        ublox::message::MgaGalTimeoffsetFields::All
+    >
+{
+    using Base =
+        MsgView<
+            ublox::message::MgaGalTimeoffsetFields::All
+        >;
+
+public:
+    /// @brief ID of the viewed message.
+    static const MsgId MsgIdValue = MsgId_MGA_GAL;
+
+    /// @brief Index of the fields, same as the ones defined by
+    ///     @b COMMS_MSG_FIELDS_ACCESS() in @ref ublox::message::MgaGalTimeoffset.
+    enum FieldIdx
+    {
+        FieldIdx_type, ///< index of @b type field
+        FieldIdx_version, ///< index of @b version field
+        FieldIdx_reserved1, ///< index of @b reserved1 field
+        FieldIdx_a0G, ///< index of @b a0G field
+        FieldIdx_a1G, ///< index of @b a1G field
+        FieldIdx_t0G, ///< index of @b t0G field
+        FieldIdx_wn0G, ///< index of @b wn0G field
+        FieldIdx_reserved2, ///< index of @b reserved2 field
+        FieldIdx_numOfValues ///< number of available fields
+    };
+
+    /// @brief Default constructor, creates empty view.
+    MgaGalTimeoffsetView() = default;
+
+    /// @brief Constructor
+    /// @param[in] payload Pointer to the payload of the message.
+    /// @param[in] len Length of the payload.
+    MgaGalTimeoffsetView(const std::uint8_t* payload, std::size_t len)
+      : Base(payload, len)
+    {
+    }
+
+    /// @brief Decode "type" field (see @ref ublox::message::MgaGalTimeoffsetFields::type).
+    comms::ErrorStatus field_type(FieldType<FieldIdx_type>& field) const
+    {
+        return Base::readField<FieldIdx_type>(field);
+    }
+
+    /// @brief Decode "version" field (see @ref ublox::message::MgaGalTimeoffsetFields::version).
+    comms::ErrorStatus field_version(FieldType<FieldIdx_version>& field) const
+    {
+        return Base::readField<FieldIdx_version>(field);
+    }
+
+    /// @brief Decode "reserved1" field (see @ref ublox::message::MgaGalTimeoffsetFields::reserved1).
+    comms::ErrorStatus field_reserved1(FieldType<FieldIdx_reserved1>& field) const
+    {
+        return Base::readField<FieldIdx_reserved1>(field);
+    }
+
+    /// @brief Decode "a0G" field (see @ref ublox::message::MgaGalTimeoffsetFields::a0G).
+    comms::ErrorStatus field_a0G(FieldType<FieldIdx_a0G>& field) const
+    {
+        return Base::readField<FieldIdx_a0G>(field);
+    }
+
+    /// @brief Decode "a1G" field (see @ref ublox::message::MgaGalTimeoffsetFields::a1G).
+    comms::ErrorStatus field_a1G(FieldType<FieldIdx_a1G>& field) const
+    {
+        return Base::readField<FieldIdx_a1G>(field);
+    }
+
+    /// @brief Decode "t0G" field (see @ref ublox::message::MgaGalTimeoffsetFields::t0G).
+    comms::ErrorStatus field_t0G(FieldType<FieldIdx_t0G>& field) const
+    {
+        return Base::readField<FieldIdx_t0G>(field);
+    }
+
+    /// @brief Decode "wn0G" field (see @ref ublox::message::MgaGalTimeoffsetFields::wn0G).
+    comms::ErrorStatus field_wn0G(FieldType<FieldIdx_wn0G>& field) const
+    {
+        return Base::readField<FieldIdx_wn0G>(field);
+    }
+
+    /// @brief Decode "reserved2" field (see @ref ublox::message::MgaGalTimeoffsetFields::reserved2).
+    comms::ErrorStatus field_reserved2(FieldType<FieldIdx_reserved2>& field) const
+    {
+        return Base::readField<FieldIdx_reserved2>(field);
+    }
+};
+
+} // namespace view
+
+} // namespace ublox
+
@@ -0,0 +1,157 @@
+//
+// Copyright 2018 (C). Alex Robenko. All rights reserved.
+//
+
+// This file is free software: you can redistribute it and/or modify
+// it under the terms of the GNU General Public License as published by
+// the Free Software Foundation, either version 3 of the License, or
+// (at your option) any later version.
+//
+// This program is distributed in the hope that it will be useful,
+// but WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+// GNU General Public License for more details.
+//
+// You should have received a copy of the GNU General Public License
+// along with this program.  If not, see <http://www.gnu.org/licenses/>.
+
+/// @file
+/// @brief Contains definition of lazy view of MGA-GAL-UTC message.
+/// @details Generated by script/gen_views.py, do NOT edit manually.
+
+#pragma once
+
+#include "ublox/message/MgaGalUtc.h"
+#include "MsgView.h"
+
+namespace ublox
+{
+
+namespace view
+{
+
+/// @brief Lazy read-only view of MGA-GAL-UTC message payload.
+/// @details Wraps the pointer to the validated payload, the fields are
+///     decoded on access only, see @ref MsgView.
+/// @see @ref ublox::message::MgaGalUtc
+class MgaGalUtcView : public
+    MsgView<
+        ublox::message::MgaGalUtcFields::All
+    >
+{
+    using Base =
+        MsgView<
+            ublox::message::MgaGalUtcFields::All
+        >;
+
+public:
+    /// @brief ID of the viewed message.
+    static const MsgId MsgIdValue = MsgId_MGA_GAL;
+
+    /// @brief Index of the fields, same as the ones defined by
+    ///     @b COMMS_MSG_FIELDS_ACCESS() in @ref ublox::message::MgaGalUtc.
+    enum FieldIdx
+    {
+        FieldIdx_type, ///< index of @b type field
+        FieldIdx_version, ///< index of @b version field
+        FieldIdx_reserved1, ///< index of @b reserved1 field
+        FieldIdx_a0, ///< index of @b a0 field
+        FieldIdx_a1, ///< index of @b a1 field
+        FieldIdx_dtLS, ///< index of @b dtLS field
+        FieldIdx_tot, ///< index of @b tot field
+        FieldIdx_wnt, ///< index of @b wnt field
+        FieldIdx_wnLSF, ///< index of @b wnLSF field
+        FieldIdx_dN, ///< index of @b dN field
+        FieldIdx_dTLSF, ///< index of @b dTLSF field
+        FieldIdx_reserved2, ///< index of @b reserved2 field
+        FieldIdx_numOfValues ///< number of available fields
+    };
+
+    /// @brief Default constructor, creates empty view.
+    MgaGalUtcView() = default;
+
+    /// @brief Constructor
+    /// @param[in] payload Pointer to the payload of the message.
+    /// @param[in] len Length of the payload.
+    MgaGalUtcView(const std::uint8_t* payload, std::size_t len)
+      : Base(payload, len)
+    {
+    }
+
+    /// @brief Decode "type" field (see @ref ublox::message::MgaGalUtcFields::type).
+    comms::ErrorStatus field_type(FieldType<FieldIdx_type>& field) const
+    {
+        return Base::readField<FieldIdx_type>(field);
+    }
+
+    /// @brief Decode "version" field (see @ref ublox::message::MgaGalUtcFields::version).
+    comms::ErrorStatus field_version(FieldType<FieldIdx_version>& field) const
+    {
+        return Base::readField<FieldIdx_version>(field);
+    }
+
+    /// @brief Decode "reserved1" field (see @ref ublox::message::MgaGalUtcFields::reserved1).
+    comms::ErrorStatus field_reserved1(FieldType<FieldIdx_reserved1>& field) const
+    {
+        return Base::readField<FieldIdx_reserved1>(field);
+    }
+
+    /// @brief Decode "a0" field (see @ref ublox::message::MgaGalUtcFields::a0).
+    comms::ErrorStatus field_a0(FieldType<FieldIdx_a0>& field) const
+    {
+        return Base::readField<FieldIdx_a0>(field);
+    }
+
+    /// @brief Decode "a1" field (see @ref ublox::message::MgaGalUtcFields::a1).
+    comms::ErrorStatus field_a1(FieldType<FieldIdx_a1>& field) const
+    {
+        return Base::readField<FieldIdx_a1>(field);
+    }
+
+    /// @brief Decode "dtLS" field (see @ref ublox::message::MgaGalUtcFields::dtLS).
+    comms::ErrorStatus field_dtLS(FieldType<FieldIdx_dtLS>& field) const
+    {
+        return Base::readField<FieldIdx_dtLS>(field);
+    }
+
+    /// @brief Decode "tot" field (see @ref ublox::message::MgaGalUtcFields::tot).
+    comms::ErrorStatus field_tot(FieldType<FieldIdx_tot>& field) const
+    {
+        return Base::readField<FieldIdx_tot>(field);
+    }
+
+    /// @brief Decode "wnt" field (see @ref ublox::message::MgaGalUtcFields::wnt).
+    comms::ErrorStatus field_wnt(FieldType<FieldIdx_wnt>& field) const
+    {
+        return Base::readField<FieldIdx_wnt>(field);
+    }
+
+    /// @brief Decode "wnLSF" field (see @ref ublox::message::MgaGalUtcFields::wnLSF).
+    comms::ErrorStatus field_wnLSF(FieldType<FieldIdx_wnLSF>& field) const
+    {
+        return Base::readField<FieldIdx_wnLSF>(field);
+    }
+
+    /// @brief Decode "dN" field (see @ref ublox::message::MgaGalUtcFields::dN).
+    comms::ErrorStatus field_dN(FieldType<FieldIdx_dN>& field) const
+    {
+        return Base::readField<FieldIdx_dN>(field);
+    }
+
+    /// @brief Decode "dTLSF" field (see @ref ublox::message::MgaGalUtcFields::dTLSF).
+    comms::ErrorStatus field_dTLSF(FieldType<FieldIdx_dTLSF>& field) const
+    {
+        return Base::readField<FieldIdx_dTLSF>(field);
+    }
+
+    /// @brief Decode "reserved2" field (see @ref ublox::message::MgaGalUtcFields::reserved2).
+    comms::ErrorStatus field_reserved2(FieldType<FieldIdx_reserved2>& field) const
+    {
+        return Base::readField<FieldIdx_reserved2>(field);
+    }
+};
+
+} // namespace view
+
+} // namespace ublox
+
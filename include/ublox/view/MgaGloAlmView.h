@@ -0,0 +1,192 @@
+//
+// Copyright 2018 (C). Alex Robenko. All rights reserved.
+//
+
+// This file is free software: you can redistribute it and/or modify
+// it under the terms of the GNU General Public License as published by
+// the Free Software Foundation, either version 3 of the License, or
+// (at your option) any later version.
+//
+// This program is distributed in the hope that it will be useful,
+// but WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+// GNU General Public License for more details.
+//
+// You should have received a copy of the GNU General Public License
+// along with this program.  If not, see <http://www.gnu.org/licenses/>.
+
+/// @file
+/// @brief Contains definition of lazy view of MGA-GLO-ALM message.
+/// @details Generated by script/gen_views.py, do NOT edit manually.
+
+#pragma once
+
+#include "ublox/message/MgaGloAlm.h"
+#include "MsgView.h"
+
+namespace ublox
+{
+
+namespace view
+{
+
+/// @brief Lazy read-only view of MGA-GLO-ALM message payload.
+/// @details Wraps the pointer to the validated payload, the fields are
+///     decoded on access only, see @ref MsgView.
+/// @see @ref ublox::message::MgaGloAlm
+class MgaGloAlmView : public
+    MsgView<
+        ublox::message::MgaGloAlmFields::All
+    >
+{
+    using Base =
+        MsgView<
+            ublox::message::MgaGloAlmFields::All
+        >;
+
+public:
+    /// @brief ID of the viewed message.
+    static const MsgId MsgIdValue = MsgId_MGA_GLO;
+
+    /// @brief Index of the fields, same as the ones defined by
+    ///     @b COMMS_MSG_FIELDS_ACCESS() in @ref ublox::message::MgaGloAlm.
+    enum FieldIdx
+    {
+        FieldIdx_type, ///< index of @b type field
+        FieldIdx_version, ///< index of @b version field
+        FieldIdx_svId, ///< index of @b svId field
+        FieldIdx_reserved1, ///< index of @b reserved1 field
+        FieldIdx_N, ///< index of @b N field
+        FieldIdx_M, ///< index of @b M field
+        FieldIdx_C, ///< index of @b C field
+        FieldIdx_tau, ///< index of @b tau field
+        FieldIdx_epsilon, ///< index of @b epsilon field
+        FieldIdx_lambda, ///< index of @b lambda field
+        FieldIdx_deltaI, ///< index of @b deltaI field
+        FieldIdx_tLambda, ///< index of @b tLambda field
+        FieldIdx_deltaT, ///< index of @b deltaT field
+        FieldIdx_deltaDT, ///< index of @b deltaDT field
+        FieldIdx_H, ///< index of @b H field
+        FieldIdx_omega, ///< index of @b omega field
+        FieldIdx_reserved2, ///< index of @b reserved2 field
+        FieldIdx_numOfValues ///< number of available fields
+    };
+
+    /// @brief Default constructor, creates empty view.
+    MgaGloAlmView() = default;
+
+    /// @brief Constructor
+    /// @param[in] payload Pointer to the payload of the message.
+    /// @param[in] len Length of the payload.
+    MgaGloAlmView(const std::uint8_t* payload, std::size_t len)
+      : Base(payload, len)
+    {
+    }
+
+    /// @brief Decode "type" field (see @ref ublox::message::MgaGloAlmFields::type).
+    comms::ErrorStatus field_type(FieldType<FieldIdx_type>& field) const
+    {
+        return Base::readField<FieldIdx_type>(field);
+    }
+
+    /// @brief Decode "version" field (see @ref ublox::message::MgaGloAlmFields::version).
+    comms::ErrorStatus field_version(FieldType<FieldIdx_version>& field) const
+    {
+        return Base::readField<FieldIdx_version>(field);
+    }
+
+    /// @brief Decode "svId" field (see @ref ublox::message::MgaGloAlmFields::svId).
+    comms::ErrorStatus field_svId(FieldType<FieldIdx_svId>& field) const
+    {
+        return Base::readField<FieldIdx_svId>(field);
+    }
+
+    /// @brief Decode "reserved1" field (see @ref ublox::message::MgaGloAlmFields::reserved1).
+    comms::ErrorStatus field_reserved1(FieldType<FieldIdx_reserved1>& field) const
+    {
+        return Base::readField<FieldIdx_reserved1>(field);
+    }
+
+    /// @brief Decode "N" field (see @ref ublox::message::MgaGloAlmFields::N).
+    comms::ErrorStatus field_N(FieldType<FieldIdx_N>& field) const
+    {
+        return Base::readField<FieldIdx_N>(field);
+    }
+
+    /// @brief Decode "M" field (see @ref ublox::message::MgaGloAlmFields::M).
+    comms::ErrorStatus field_M(FieldType<FieldIdx_M>& field) const
+    {
+        return Base::readField<FieldIdx_M>(field);
+    }
+
+    /// @brief Decode "C" field (see @ref ublox::message::MgaGloAlmFields::C).
+    comms::ErrorStatus field_C(FieldType<FieldIdx_C>& field) const
+    {
+        return Base::readField<FieldIdx_C>(field);
+    }
+
+    /// @brief Decode "tau" field (see @ref ublox::message::MgaGloAlmFields::tau).
+    comms::ErrorStatus field_tau(FieldType<FieldIdx_tau>& field) const
+    {
+        return Base::readField<FieldIdx_tau>(field);
+    }
+
+    /// @brief Decode "epsilon" field (see @ref ublox::message::MgaGloAlmFields::epsilon).
+    comms::ErrorStatus field_epsilon(FieldType<FieldIdx_epsilon>& field) const
+    {
+        return Base::readField<FieldIdx_epsilon>(field);
+    }
+
+    /// @brief Decode "lambda" field (see @ref ublox::message::MgaGloAlmFields::lambda).
+    comms::ErrorStatus field_lambda(FieldType<FieldIdx_lambda>& field) const
+    {
+        return Base::readField<FieldIdx_lambda>(field);
+    }
+
+    /// @brief Decode "deltaI" field (see @ref ublox::message::MgaGloAlmFields::deltaI).
+    comms::ErrorStatus field_deltaI(FieldType<FieldIdx_deltaI>& field) const
+    {
+        return Base::readField<FieldIdx_deltaI>(field);
+    }
+
+    /// @brief Decode "tLambda" field (see @ref ublox::message::MgaGloAlmFields::tLambda).
+    comms::ErrorStatus field_tLambda(FieldType<FieldIdx_tLambda>& field) const
+    {
+        return Base::readField<FieldIdx_tLambda>(field);
+    }
+
+    /// @brief Decode "deltaT" field (see @ref ublox::message::MgaGloAlmFields::deltaT).
+    comms::ErrorStatus field_deltaT(FieldType<FieldIdx_deltaT>& field) const
+    {
+        return Base::readField<FieldIdx_deltaT>(field);
+    }
+
+    /// @brief Decode "deltaDT" field (see @ref ublox::message::MgaGloAlmFields::deltaDT).
+    comms::ErrorStatus field_deltaDT(FieldType<FieldIdx_deltaDT>& field) const
+    {
+        return Base::readField<FieldIdx_deltaDT>(field);
+    }
+
+    /// @brief Decode "H" field (see @ref ublox::message::MgaGloAlmFields::H).
+    comms::ErrorStatus field_H(FieldType<FieldIdx_H>& field) const
+    {
+        return Base::readField<FieldIdx_H>(field);
+    }
+
+    /// @brief Decode "omega" field (see @ref ublox::message::MgaGloAlmFields::omega).
+    comms::ErrorStatus field_omega(FieldType<FieldIdx_omega>& field) const
+    {
+        return Base::readField<FieldIdx_omega>(field);
+    }
+
+    /// @brief Decode "reserved2" field (see @ref ublox::message::MgaGloAlmFields::reserved2).
+    comms::ErrorStatus field_reserved2(FieldType<FieldIdx_reserved2>& field) const
+    {
+        return Base::readField<FieldIdx_reserved2>(field);
+    }
+};
+
+} // namespace view
+
+} // namespace ublox
+
@@ -0,0 +1,234 @@
+//
+// Copyright 2018 (C). Alex Robenko. All rights reserved.
+//
+
+// This file is free software: you can redistribute it and/or modify
+// it under the terms of the GNU General Public License as published by
+// the Free Software Foundation, either version 3 of the License, or
+// (at your option) any later version.
+//
+// This program is distributed in the hope that it will be useful,
+// but WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+// GNU General Public License for more details.
+//
+// You should have received a copy of the GNU General Public License
+// along with this program.  If not, see <http://www.gnu.org/licenses/>.
+
+/// @file
+/// @brief Contains definition of lazy view of MGA-GLO-EPH message.
+/// @details Generated by script/gen_views.py, do NOT edit manually.
+
+#pragma once
+
+#include "ublox/message/MgaGloEph.h"
+#include "MsgView.h"
+
+namespace ublox
+{
+
+namespace view
+{
+
+/// @brief Lazy read-only view of MGA-GLO-EPH message payload.
+/// @details Wraps the pointer to the validated payload, the fields are
+///     decoded on access only, see @ref MsgView.
+/// @see @ref ublox::message::MgaGloEph
+class MgaGloEphView : public
+    MsgView<
+        ublox::message::MgaGloEphFields::All
+    >
+{
+    using Base =
+        MsgView<
+            ublox::message::MgaGloEphFields::All
+        >;
+
+public:
+    /// @brief ID of the viewed message.
+    static const MsgId MsgIdValue = MsgId_MGA_GLO;
+
+    /// @brief Index of the fields, same as the ones defined by
+    ///     @b COMMS_MSG_FIELDS_ACCESS() in @ref ublox::message::MgaGloEph.
+    enum FieldIdx
+    {
+        FieldIdx_type, ///< index of @b type field
+        FieldIdx_version, ///< index of @b version field
+        FieldIdx_svId, ///< index of @b svId field
+        FieldIdx_reserved1, ///< index of @b reserved1 field
+        FieldIdx_FT, ///< index of @b FT field
+        FieldIdx_B, ///< index of @b B field
+        FieldIdx_M, ///< index of @b M field
+        FieldIdx_H, ///< index of @b H field
+        FieldIdx_x, ///< index of @b x field
+        FieldIdx_y, ///< index of @b y field
+        FieldIdx_z, ///< index of @b z field
+        FieldIdx_dx, ///< index of @b dx field
+        FieldIdx_dy, ///< index of @b dy field
+        FieldIdx_dz, ///< index of @b dz field
+        FieldIdx_ddx, ///< index of @b ddx field
+        FieldIdx_ddy, ///< index of @b ddy field
+        FieldIdx_ddz, ///< index of @b ddz field
+        FieldIdx_tb, ///< index of @b tb field
+        FieldIdx_gamma, ///< index of @b gamma field
+        FieldIdx_E, ///< index of @b E field
+        FieldIdx_deltaTau, ///< index of @b deltaTau field
+        FieldIdx_tau, ///< index of @b tau field
+        FieldIdx_reserved2, ///< index of @b reserved2 field
+        FieldIdx_numOfValues ///< number of available fields
+    };
+
+    /// @brief Default constructor, creates empty view.
+    MgaGloEphView() = default;
+
+    /// @brief Constructor
+    /// @param[in] payload Pointer to the payload of the message.
+    /// @param[in] len Length of the payload.
+    MgaGloEphView(const std::uint8_t* payload, std::size_t len)
+      : Base(payload, len)
+    {
+    }
+
+    /// @brief Decode "type" field (see @ref ublox::message::MgaGloEphFields::type).
+    comms::ErrorStatus field_type(FieldType<FieldIdx_type>& field) const
+    {
+        return Base::readField<FieldIdx_type>(field);
+    }
+
+    /// @brief Decode "version" field (see @ref ublox::message::MgaGloEphFields::version).
+    comms::ErrorStatus field_version(FieldType<FieldIdx_version>& field) const
+    {
+        return Base::readField<FieldIdx_version>(field);
+    }
+
+    /// @brief Decode "svId" field (see @ref ublox::message::MgaGloEphFields::svId).
+    comms::ErrorStatus field_svId(FieldType<FieldIdx_svId>& field) const
+    {
+        return Base::readField<FieldIdx_svId>(field);
+    }
+
+    /// @brief Decode "reserved1" field (see @ref ublox::message::MgaGloEphFields::reserved1).
+    comms::ErrorStatus field_reserved1(FieldType<FieldIdx_reserved1>& field) const
+    {
+        return Base::readField<FieldIdx_reserved1>(field);
+    }
+
+    /// @brief Decode "FT" field (see @ref ublox::message::MgaGloEphFields::FT).
+    comms::ErrorStatus field_FT(FieldType<FieldIdx_FT>& field) const
+    {
+        return Base::readField<FieldIdx_FT>(field);
+    }
+
+    /// @brief Decode "B" field (see @ref ublox::message::MgaGloEphFields::B).
+    comms::ErrorStatus field_B(FieldType<FieldIdx_B>& field) const
+    {
+        return Base::readField<FieldIdx_B>(field);
+    }
+
+    /// @brief Decode "M" field (see @ref ublox::message::MgaGloEphFields::M).
+    comms::ErrorStatus field_M(FieldType<FieldIdx_M>& field) const
+    {
+        return Base::readField<FieldIdx_M>(field);
+    }
+
+    /// @brief Decode "H" field (see @ref ublox::message::MgaGloEphFields::H).
+    comms::ErrorStatus field_H(FieldType<FieldIdx_H>& field) const
+    {
+        return Base::readField<FieldIdx_H>(field);
+    }
+
+    /// @brief Decode "x" field (see @ref ublox::message::MgaGloEphFields::x).
+    comms::ErrorStatus field_x(FieldType<FieldIdx_x>& field) const
+    {
+        return Base::readField<FieldIdx_x>(field);
+    }
+
+    /// @brief Decode "y" field (see @ref ublox::message::MgaGloEphFields::y).
+    comms::ErrorStatus field_y(FieldType<FieldIdx_y>& field) const
+    {
+        return Base::readField<FieldIdx_y>(field);
+    }
+
+    /// @brief Decode "z" field (see @ref ublox::message::MgaGloEphFields::z).
+    comms::ErrorStatus field_z(FieldType<FieldIdx_z>& field) const
+    {
+        return Base::readField<FieldIdx_z>(field);
+    }
+
+    /// @brief Decode "dx" field (see @ref ublox::message::MgaGloEphFields::dx).
+    comms::ErrorStatus field_dx(FieldType<FieldIdx_dx>& field) const
+    {
+        return Base::readField<FieldIdx_dx>(field);
+    }
+
+    /// @brief Decode "dy" field (see @ref ublox::message::MgaGloEphFields::dy).
+    comms::ErrorStatus field_dy(FieldType<FieldIdx_dy>& field) const
+    {
+        return Base::readField<FieldIdx_dy>(field);
+    }
+
+    /// @brief Decode "dz" field (see @ref ublox::message::MgaGloEphFields::dz).
+    comms::ErrorStatus field_dz(FieldType<FieldIdx_dz>& field) const
+    {
+        return Base::readField<FieldIdx_dz>(field);
+    }
+
+    /// @brief Decode "ddx" field (see @ref ublox::message::MgaGloEphFields::ddx).
+    comms::ErrorStatus field_ddx(FieldType<FieldIdx_ddx>& field) const
+    {
+        return Base::readField<FieldIdx_ddx>(field);
+    }
+
+    /// @brief Decode "ddy" field (see @ref ublox::message::MgaGloEphFields::ddy).
+    comms::ErrorStatus field_ddy(FieldType<FieldIdx_ddy>& field) const
+    {
+        return Base::readField<FieldIdx_ddy>(field);
+    }
+
+    /// @brief Decode "ddz" field (see @ref ublox::message::MgaGloEphFields::ddz).
+    comms::ErrorStatus field_ddz(FieldType<FieldIdx_ddz>& field) const
+    {
+        return Base::readField<FieldIdx_ddz>(field);
+    }
+
+    /// @brief Decode "tb" field (see @ref ublox::message::MgaGloEphFields::tb).
+    comms::ErrorStatus field_tb(FieldType<FieldIdx_tb>& field) const
+    {
+        return Base::readField<FieldIdx_tb>(field);
+    }
+
+    /// @brief Decode "gamma" field (see @ref ublox::message::MgaGloEphFields::gamma).
+    comms::ErrorStatus field_gamma(FieldType<FieldIdx_gamma>& field) const
+    {
+        return Base::readField<FieldIdx_gamma>(field);
+    }
+
+    /// @brief Decode "E" field (see @ref ublox::message::MgaGloEphFields::E).
+    comms::ErrorStatus field_E(FieldType<FieldIdx_E>& field) const
+    {
+        return Base::readField<FieldIdx_E>(field);
+    }
+
+    /// @brief Decode "deltaTau" field (see @ref ublox::message::MgaGloEphFields::deltaTau).
+    comms::ErrorStatus field_deltaTau(FieldType<FieldIdx_deltaTau>& field) const
+    {
+        return Base::readField<FieldIdx_deltaTau>(field);
+    }
+
+    /// @brief Decode "tau" field (see @ref ublox::message::MgaGloEphFields::tau).
+    comms::ErrorStatus field_tau(FieldType<FieldIdx_tau>& field) const
+    {
+        return Base::readField<FieldIdx_tau>(field);
+    }
+
+    /// @brief Decode "reserved2" field (see @ref ublox::message::MgaGloEphFields::reserved2).
+    comms::ErrorStatus field_reserved2(FieldType<FieldIdx_reserved2>& field) const
+    {
+        return Base::readField<FieldIdx_reserved2>(field);
+    }
+};
+
+} // namespace view
+
+} // namespace ublox
+
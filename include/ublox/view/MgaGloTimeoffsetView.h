@@ -0,0 +1,129 @@
+//
+// Copyright 2018 (C). Alex Robenko. All rights reserved.
+//
+
+// This file is free software: you can redistribute it and/or modify
+// it under the terms of the GNU General Public License as published by
+// the Free Software Foundation, either version 3 of the License, or
+// (at your option) any later version.
+//
+// This program is distributed in the hope that it will be useful,
+// but WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+// GNU General Public License for more details.
+//
+// You should have received a copy of the GNU General Public License
+// along with this program.  If not, see <http://www.gnu.org/licenses/>.
+
+/// @file
+/// @brief Contains definition of lazy view of MGA-GLO-TIMEOFFSET message.
+/// @details Generated by script/gen_views.py, do NOT edit manually.
+
+#pragma once
+
+#include "ublox/message/MgaGloTimeoffset.h"
+#include "MsgView.h"
+
+namespace ublox
+{
+
+namespace view
+{
+
+/// @brief Lazy read-only view of MGA-GLO-TIMEOFFSET message payload.
+/// @details Wraps the pointer to the validated payload, the fields are
+///     decoded on access only, see @ref MsgView.
+/// @see @ref ublox::message::MgaGloTimeoffset
+class MgaGloTimeoffsetView : public
+    MsgView<
+        ublox::message::MgaGloTimeoffsetFields::All
+    >
+{
+    using Base =
+        MsgView<
+            ublox::message::MgaGloTimeoffsetFields::All
+        >;
+
+public:
+    /// @brief ID of the viewed message.
+    static const MsgId MsgIdValue = MsgId_MGA_GLO;
+
+    /// @brief Index of the fields, same as the ones defined by
+    ///     @b COMMS_MSG_FIELDS_ACCESS() in @ref ublox::message::MgaGloTimeoffset.
+    enum FieldIdx
+    {
+        FieldIdx_type, ///< index of @b type field
+        FieldIdx_version, ///< index of @b version field
+        FieldIdx_N, ///< index of @b N field
+        FieldIdx_tauC, ///< index of @b tauC field
+        FieldIdx_tauGps, ///< index of @b tauGps field
+        FieldIdx_B1, ///< index of @b B1 field
+        FieldIdx_B2, ///< index of @b B2 field
+        FieldIdx_reserved1, ///< index of @b reserved1 field
+        FieldIdx_numOfValues ///< number of available fields
+    };
+
+    /// @brief Default constructor, creates empty view.
+    MgaGloTimeoffsetView() = default;
+
+    /// @brief Constructor
+    /// @param[in] payload Pointer to the payload of the message.
+    /// @param[in] len Length of the payload.
+    MgaGloTimeoffsetView(const std::uint8_t* payload, std::size_t len)
+      : Base(payload, len)
+    {
+    }
+
+    /// @brief Decode "type" field (see @ref ublox::message::MgaGloTimeoffsetFields::type).
+    comms::ErrorStatus field_type(FieldType<FieldIdx_type>& field) const
+    {
+        return Base::readField<FieldIdx_type>(field);
+    }
+
+    /// @brief Decode "version" field (see @ref ublox::message::MgaGloTimeoffsetFields::version).
+    comms::ErrorStatus field_version(FieldType<FieldIdx_version>& field) const
+    {
+        return Base::readField<FieldIdx_version>(field);
+    }
+
+    /// @brief Decode "N" field (see @ref ublox::message::MgaGloTimeoffsetFields::N).
+    comms::ErrorStatus field_N(FieldType<FieldIdx_N>& field) const
+    {
+        return Base::readField<FieldIdx_N>(field);
+    }
+
+    /// @brief Decode "tauC" field (see @ref ublox::message::MgaGloTimeoffsetFields::tauC).
+    comms::ErrorStatus field_tauC(FieldType<FieldIdx_tauC>& field) const
+    {
+        return Base::readField<FieldIdx_tauC>(field);
+    }
+
+    /// @brief Decode "tauGps" field (see @ref ublox::message::MgaGloTimeoffsetFields::tauGps).
+    comms::ErrorStatus field_tauGps(FieldType<FieldIdx_tauGps>& field) const
+    {
+        return Base::readField<FieldIdx_tauGps>(field);
+    }
+
+    /// @brief Decode "B1" field (see @ref ublox::message::MgaGloTimeoffsetFields::B1).
+    comms::ErrorStatus field_B1(FieldType<FieldIdx_B1>& field) const
+    {
+        return Base::readField<FieldIdx_B1>(field);
+    }
+
+    /// @brief Decode "B2" field (see @ref ublox::message::MgaGloTimeoffsetFields::B2).
+    comms::ErrorStatus field_B2(FieldType<FieldIdx_B2>& field) const
+    {
+        return Base::readField<FieldIdx_B2>(field);
+    }
+
+    /// @brief Decode "reserved1" field (see @ref ublox::message::MgaGloTimeoffsetFields::reserved1).
+    comms::ErrorStatus field_reserved1(FieldType<FieldIdx_reserved1>& field) const
+    {
+        return Base::readField<FieldIdx_reserved1>(field);
+    }
+};
+
+} // namespace view
+
+} // namespace ublox
+
@@ -0,0 +1,290 @@
+//
+// Copyright 2018 (C). Alex Robenko. All rights reserved.
+//
+
+// This file is free software: you can redistribute it and/or modify
+// it under the terms of the GNU General Public License as published by
+// the Free Software Foundation, either version 3 of the License, or
+// (at your option) any later version.
+//
+// This program is distributed in the hope that it will be useful,
+// but WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+// GNU General Public License for more details.
+//
+// You should have received a copy of the GNU General Public License
+// along with this program.  If not, see <http://www.gnu.org/licenses/>.
+
+/// @file
+/// @brief Contains definition of lazy view of MGA-GPS-EPH message.
+/// @details Generated by script/gen_views.py, do NOT edit manually.
+
+#pragma once
+
+#include "ublox/message/MgaGpsEph.h"
+#include "MsgView.h"
+
+namespace ublox
+{
+
+namespace view
+{
+
+/// @brief Lazy read-only view of MGA-GPS-EPH message payload.
+/// @details Wraps the pointer to the validated payload, the fields are
+///     decoded on access only, see @ref MsgView.
+/// @see @ref ublox::message::MgaGpsEph
+class MgaGpsEphView : public
+    MsgView<
+        ublox::message::MgaGpsEphFields::All
+    >
+{
+    using Base =
+        MsgView<
+            ublox::message::MgaGpsEphFields::All
+        >;
+
+public:
+    /// @brief ID of the viewed message.
+    static const MsgId MsgIdValue = MsgId_MGA_GPS;
+
+    /// @brief Index of the fields, same as the ones defined by
+    ///     @b COMMS_MSG_FIELDS_ACCESS() in @ref ublox::message::MgaGpsEph.
+    enum FieldIdx
+    {
+        FieldIdx_type, ///< index of @b type field
+        FieldIdx_version, ///< index of @b version field
+        FieldIdx_svId, ///< index of @b svId field
+        FieldIdx_reserved1, ///< index of @b reserved1 field
+        FieldIdx_fitInterval, ///< index of @b fitInterval field
+        FieldIdx_uraIndex, ///< index of @b uraIndex field
+        FieldIdx_svHealth, ///< index of @b svHealth field
+        FieldIdx_tgd, ///< index of @b tgd field
+        FieldIdx_iodc, ///< index of @b iodc field
+        FieldIdx_toc, ///< index of @b toc field
+        FieldIdx_reserved2, ///< index of @b reserved2 field
+        FieldIdx_af2, ///< index of @b af2 field
+        FieldIdx_af1, ///< index of @b af1 field
+        FieldIdx_af0, ///< index of @b af0 field
+        FieldIdx_crs, ///< index of @b crs field
+        FieldIdx_deltaN, ///< index of @b deltaN field
+        FieldIdx_m0, ///< index of @b m0 field
+        FieldIdx_cuc, ///< index of @b cuc field
+        FieldIdx_cus, ///< index of @b cus field
+        FieldIdx_e, ///< index of @b e field
+        FieldIdx_sqrtA, ///< index of @b sqrtA field
+        FieldIdx_toe, ///< index of @b toe field
+        FieldIdx_cic, ///< index of @b cic field
+        FieldIdx_omega0, ///< index of @b omega0 field
+        FieldIdx_cis, ///< index of @b cis field
+        FieldIdx_crc, ///< index of @b crc field
+        FieldIdx_i0, ///< index of @b i0 field
+        FieldIdx_omega, ///< index of @b omega field
+        FieldIdx_omegaDot, ///< index of @b omegaDot field
+        FieldIdx_idot, ///< index of @b idot field
+        FieldIdx_reserved3, ///< index of @b reserved3 field
+        FieldIdx_numOfValues ///< number of available fields
+    };
+
+    /// @brief Default constructor, creates empty view.
+    MgaGpsEphView() = default;
+
+    /// @brief Constructor
+    /// @param[in] payload Pointer to the payload of the message.
+    /// @param[in] len Length of the payload.
+    MgaGpsEphView(const std::uint8_t* payload, std::size_t len)
+      : Base(payload, len)
+    {
+    }
+
+    /// @brief Decode "type" field (see @ref ublox::message::MgaGpsEphFields::type).
+    comms::ErrorStatus field_type(FieldType<FieldIdx_type>& field) const
+    {
+        return Base::readField<FieldIdx_type>(field);
+    }
+
+    /// @brief Decode "version" field (see @ref ublox::message::MgaGpsEphFields::version).
+    comms::ErrorStatus field_version(FieldType<FieldIdx_version>& field) const
+    {
+        return Base::readField<FieldIdx_version>(field);
+    }
+
+    /// @brief Decode "svId" field (see @ref ublox::message::MgaGpsEphFields::svId).
+    comms::ErrorStatus field_svId(FieldType<FieldIdx_svId>& field) const
+    {
+        return Base::readField<FieldIdx_svId>(field);
+    }
+
+    /// @brief Decode "reserved1" field (see @ref ublox::message::MgaGpsEphFields::reserved1).
+    comms::ErrorStatus field_reserved1(FieldType<FieldIdx_reserved1>& field) const
+    {
+        return Base::readField<FieldIdx_reserved1>(field);
+    }
+
+    /// @brief Decode "fitInterval" field (see @ref ublox::message::MgaGpsEphFields::fitInterval).
+    comms::ErrorStatus field_fitInterval(FieldType<FieldIdx_fitInterval>& field) const
+    {
+        return Base::readField<FieldIdx_fitInterval>(field);
+    }
+
+    /// @brief Decode "uraIndex" field (see @ref ublox::message::MgaGpsEphFields::uraIndex).
+    comms::ErrorStatus field_uraIndex(FieldType<FieldIdx_uraIndex>& field) const
+    {
+        return Base::readField<FieldIdx_uraIndex>(field);
+    }
+
+    /// @brief Decode "svHealth" field (see @ref ublox::message::MgaGpsEphFields::svHealth).
+    comms::ErrorStatus field_svHealth(FieldType<FieldIdx_svHealth>& field) const
+    {
+        return Base::readField<FieldIdx_svHealth>(field);
+    }
+
+    /// @brief Decode "tgd" field (see @ref ublox::message::MgaGpsEphFields::tgd).
+    comms::ErrorStatus field_tgd(FieldType<FieldIdx_tgd>& field) const
+    {
+        return Base::readField<FieldIdx_tgd>(field);
+    }
+
+    /// @brief Decode "iodc" field (see @ref ublox::message::MgaGpsEphFields::iodc).
+    comms::ErrorStatus field_iodc(FieldType<FieldIdx_iodc>& field) const
+    {
+        return Base::readField<FieldIdx_iodc>(field);
+    }
+
+    /// @brief Decode "toc" field (see @ref ublox::message::MgaGpsEphFields::toc).
+    comms::ErrorStatus field_toc(FieldType<FieldIdx_toc>& field) const
+    {
+        return Base::readField<FieldIdx_toc>(field);
+    }
+
+    /// @brief Decode "reserved2" field (see @ref ublox::message::MgaGpsEphFields::reserved2).
+    comms::ErrorStatus field_reserved2(FieldType<FieldIdx_reserved2>& field) const
+    {
+        return Base::readField<FieldIdx_reserved2>(field);
+    }
+
+    /// @brief Decode "af2" field (see @ref ublox::message::MgaGpsEphFields::af2).
+    comms::ErrorStatus field_af2(FieldType<FieldIdx_af2>& field) const
+    {
+        return Base::readField<FieldIdx_af2>(field);
+    }
+
+    /// @brief Decode "af1" field (see @ref ublox::message::MgaGpsEphFields::af1).
+    comms::ErrorStatus field_af1(FieldType<FieldIdx_af1>& field) const
+    {
+        return Base::readField<FieldIdx_af1>(field);
+    }
+
+    /// @brief Decode "af0" field (see @ref ublox::message::MgaGpsEphFields::af0).
+    comms::ErrorStatus field_af0(FieldType<FieldIdx_af0>& field) const
+    {
+        return Base::readField<FieldIdx_af0>(field);
+    }
+
+    /// @brief Decode "crs" field (see @ref ublox::message::MgaGpsEphFields::crs).
+    comms::ErrorStatus field_crs(FieldType<FieldIdx_crs>& field) const
+    {
+        return Base::readField<FieldIdx_crs>(field);
+    }
+
+    /// @brief Decode "deltaN" field (see @ref ublox::message::MgaGpsEphFields::deltaN).
+    comms::ErrorStatus field_deltaN(FieldType<FieldIdx_deltaN>& field) const
+    {
+        return Base::readField<FieldIdx_deltaN>(field);
+    }
+
+    /// @brief Decode "m0" field (see @ref ublox::message::MgaGpsEphFields::m0).
+    comms::ErrorStatus field_m0(FieldType<FieldIdx_m0>& field) const
+    {
+        return Base::readField<FieldIdx_m0>(field);
+    }
+
+    /// @brief Decode "cuc" field (see @ref ublox::message::MgaGpsEphFields::cuc).
+    comms::ErrorStatus field_cuc(FieldType<FieldIdx_cuc>& field) const
+    {
+        return Base::readField<FieldIdx_cuc>(field);
+    }
+
+    /// @brief Decode "cus" field (see @ref ublox::message::MgaGpsEphFields::cus).
+    comms::ErrorStatus field_cus(FieldType<FieldIdx_cus>& field) const
+    {
+        return Base::readField<FieldIdx_cus>(field);
+    }
+
+    /// @brief Decode "e" field (see @ref ublox::message::MgaGpsEphFields::e).
+    comms::ErrorStatus field_e(FieldType<FieldIdx_e>& field) const
+    {
+        return Base::readField<FieldIdx_e>(field);
+    }
+
+    /// @brief Decode "sqrtA" field (see @ref ublox::message::MgaGpsEphFields::sqrtA).
+    comms::ErrorStatus field_sqrtA(FieldType<FieldIdx_sqrtA>& field) const
+    {
+        return Base::readField<FieldIdx_sqrtA>(field);
+    }
+
+    /// @brief Decode "toe" field (see @ref ublox::message::MgaGpsEphFields::toe).
+    comms::ErrorStatus field_toe(FieldType<FieldIdx_toe>& field) const
+    {
+        return Base::readField<FieldIdx_toe>(field);
+    }
+
+    /// @brief Decode "cic" field (see @ref ublox::message::MgaGpsEphFields::cic).
+    comms::ErrorStatus field_cic(FieldType<FieldIdx_cic>& field) const
+    {
+        return Base::readField<FieldIdx_cic>(field);
+    }
+
+    /// @brief Decode "omega0" field (see @ref ublox::message::MgaGpsEphFields::omega0).
+    comms::ErrorStatus field_omega0(FieldType<FieldIdx_omega0>& field) const
+    {
+        return Base::readField<FieldIdx_omega0>(field);
+    }
+
+    /// @brief Decode "cis" field (see @ref ublox::message::MgaGpsEphFields::cis).
+    comms::ErrorStatus field_cis(FieldType<FieldIdx_cis>& field) const
+    {
+        return Base::readField<FieldIdx_cis>(field);
+    }
+
+    /// @brief Decode "crc" field (see @ref ublox::message::MgaGpsEphFields::crc).
+    comms::ErrorStatus field_crc(FieldType<FieldIdx_crc>& field) const
+    {
+        return Base::readField<FieldIdx_crc>(field);
+    }
+
+    /// @brief Decode "i0" field (see @ref ublox::message::MgaGpsEphFields::i0).
+    comms::ErrorStatus field_i0(FieldType<FieldIdx_i0>& field) const
+    {
+        return Base::readField<FieldIdx_i0>(field);
+    }
+
+    /// @brief Decode "omega" field (see @ref ublox::message::MgaGpsEphFields::omega).
+    comms::ErrorStatus field_omega(FieldType<FieldIdx_omega>& field) const
+    {
+        return Base::readField<FieldIdx_omega>(field);
+    }
+
+    /// @brief Decode "omegaDot" field (see @ref ublox::message::MgaGpsEphFields::omegaDot).
+    comms::ErrorStatus field_omegaDot(FieldType<FieldIdx_omegaDot>& field) const
+    {
+        return Base::readField<FieldIdx_omegaDot>(field);
+    }
+
+    /// @brief Decode "idot" field (see @ref ublox::message::MgaGpsEphFields::idot).
+    comms::ErrorStatus field_idot(FieldType<FieldIdx_idot>& field) const
+    {
+        return Base::readField<FieldIdx_idot>(field);
+    }
+
+    /// @brief Decode "reserved3" field (see @ref ublox::message::MgaGpsEphFields::reserved3).
+    comms::ErrorStatus field_reserved3(FieldType<FieldIdx_reserved3>& field) const
+    {
+        return Base::readField<FieldIdx_reserved3>(field);
+    }
+};
+
+} // namespace view
+
+} // namespace ublox
+
@@ -0,0 +1,157 @@
+//
+// Copyright 2018 (C). Alex Robenko. All rights reserved.
+//
+
+// This file is free software: you can redistribute it and/or modify
+// it under the terms of the GNU General Public License as published by
+// the Free Software Foundation, either version 3 of the License, or
+// (at your option) any later version.
+//
+// This program is distributed in the hope that it will be useful,
+// but WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+// GNU General Public License for more details.
+//
+// You should have received a copy of the GNU General Public License
+// along with this program.  If not, see <http://www.gnu.org/licenses/>.
+
+/// @file
+/// @brief Contains definition of lazy view of MGA-GPS-IONO message.
+/// @details Generated by script/gen_views.py, do NOT edit manually.
+
+#pragma once
+
+#include "ublox/message/MgaGpsIono.h"
+#include "MsgView.h"
+
+namespace ublox
+{
+
+namespace view
+{
+
+/// @brief Lazy read-only view of MGA-GPS-IONO message payload.
+/// @details Wraps the pointer to the validated payload, the fields are
+///     decoded on access only, see @ref MsgView.
+/// @see @ref ublox::message::MgaGpsIono
+class MgaGpsIonoView : public
+    MsgView<
+        ublox::message::MgaGpsIonoFields::All
+    >
+{
+    using Base =
+        MsgView<
+            ublox::message::MgaGpsIonoFields::All
+        >;
+
+public:
+    /// @brief ID of the viewed message.
+    static const MsgId MsgIdValue = MsgId_MGA_GPS;
+
+    /// @brief Index of the fields, same as the ones defined by
+    ///     @b COMMS_MSG_FIELDS_ACCESS() in @ref ublox::message::MgaGpsIono.
+    enum FieldIdx
+    {
+        FieldIdx_type, ///< index of @b type field
+        FieldIdx_version, ///< index of @b version field
+        FieldIdx_reserved1, ///< index of @b reserved1 field
+        FieldIdx_ionoAlpha0, ///< index of @b ionoAlpha0 field
+        FieldIdx_ionoAlpha1, ///< index of @b ionoAlpha1 field
+        FieldIdx_ionoAlpha2, ///< index of @b ionoAlpha2 field
+        FieldIdx_ionoAlpha3, ///< index of @b ionoAlpha3 field
+        FieldIdx_ionoBeta0, ///< index of @b ionoBeta0 field
+        FieldIdx_ionoBeta1, ///< index of @b ionoBeta1 field
+        FieldIdx_ionoBeta2, ///< index of @b ionoBeta2 field
+        FieldIdx_ionoBeta3, ///< index of @b ionoBeta3 field
+        FieldIdx_reserved2, ///< index of @b reserved2 field
+        FieldIdx_numOfValues ///< number of available fields
+    };
+
+    /// @brief Default constructor, creates empty view.
+    MgaGpsIonoView() = default;
+
+    /// @brief Constructor
+    /// @param[in] payload Pointer to the payload of the message.
+    /// @param[in] len Length of the payload.
+    MgaGpsIonoView(const std::uint8_t* payload, std::size_t len)
+      : Base(payload, len)
+    {
+    }
+
+    /// @brief Decode "type" field (see @ref ublox::message::MgaGpsIonoFields::type).
+    comms::ErrorStatus field_type(FieldType<FieldIdx_type>& field) const
+    {
+        return Base::readField<FieldIdx_type>(field);
+    }
+
+    /// @brief Decode "version" field (see @ref ublox::message::MgaGpsIonoFields::version).
+    comms::ErrorStatus field_version(FieldType<FieldIdx_version>& field) const
+    {
+        return Base::readField<FieldIdx_version>(field);
+    }
+
+    /// @brief Decode "reserved1" field (see @ref ublox::message::MgaGpsIonoFields::reserved1).
+    comms::ErrorStatus field_reserved1(FieldType<FieldIdx_reserved1>& field) const
+    {
+        return Base::readField<FieldIdx_reserved1>(field);
+    }
+
+    /// @brief Decode "ionoAlpha0" field (see @ref ublox::message::MgaGpsIonoFields::ionoAlpha0).
+    comms::ErrorStatus field_ionoAlpha0(FieldType<FieldIdx_ionoAlpha0>& field) const
+    {
+        return Base::readField<FieldIdx_ionoAlpha0>(field);
+    }
+
+    /// @brief Decode "ionoAlpha1" field (see @ref ublox::message::MgaGpsIonoFields::ionoAlpha1).
+    comms::ErrorStatus field_ionoAlpha1(FieldType<FieldIdx_ionoAlpha1>& field) const
+    {
+        return Base::readField<FieldIdx_ionoAlpha1>(field);
+    }
+
+    /// @brief Decode "ionoAlpha2" field (see @ref ublox::message::MgaGpsIonoFields::ionoAlpha2).
+    comms::ErrorStatus field_ionoAlpha2(FieldType<FieldIdx_ionoAlpha2>& field) const
+    {
+        return Base::readField<FieldIdx_ionoAlpha2>(field);
+    }
+
+    /// @brief Decode "ionoAlpha3" field (see @ref ublox::message::MgaGpsIonoFields::ionoAlpha3).
+    comms::ErrorStatus field_ionoAlpha3(FieldType<FieldIdx_ionoAlpha3>& field) const
+    {
+        return Base::readField<FieldIdx_ionoAlpha3>(field);
+    }
+
+    /// @brief Decode "ionoBeta0" field (see @ref ublox::message::MgaGpsIonoFields::ionoBeta0).
+    comms::ErrorStatus field_ionoBeta0(FieldType<FieldIdx_ionoBeta0>& field) const
+    {
+        return Base::readField<FieldIdx_ionoBeta0>(field);
+    }
+
+    /// @brief Decode "ionoBeta1" field (see @ref ublox::message::MgaGpsIonoFields::ionoBeta1).
+    comms::ErrorStatus field_ionoBeta1(FieldType<FieldIdx_ionoBeta1>& field) const
+    {
+        return Base::readField<FieldIdx_ionoBeta1>(field);
+    }
+
+    /// @brief Decode "ionoBeta2" field (see @ref ublox::message::MgaGpsIonoFields::ionoBeta2).
+    comms::ErrorStatus field_ionoBeta2(FieldType<FieldIdx_ionoBeta2>& field) const
+    {
+        return Base::readField<FieldIdx_ionoBeta2>(field);
+    }
+
+    /// @brief Decode "ionoBeta3" field (see @ref ublox::message::MgaGpsIonoFields::ionoBeta3).
+    comms::ErrorStatus field_ionoBeta3(FieldType<FieldIdx_ionoBeta3>& field) const
+    {
+        return Base::readField<FieldIdx_ionoBeta3>(field);
+    }
+
+    /// @brief Decode "reserved2" field (see @ref ublox::message::MgaGpsIonoFields::reserved2).
+    comms::ErrorStatus field_reserved2(FieldType<FieldIdx_reserved2>& field) const
+    {
+        return Base::readField<FieldIdx_reserved2>(field);
+    }
+};
+
+} // namespace view
+
+} // namespace ublox
+
@@ -0,0 +1,157 @@
+//
+// Copyright 2018 (C). Alex Robenko. All rights reserved.
+//
+
+// This file is free software: you can redistribute it and/or modify
+// it under the terms of the GNU General Public License as published by
+// the Free Software Foundation, either version 3 of the License, or
+// (at your option) any later version.
+//
+// This program is distributed in the hope that it will be useful,
+// but WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+// GNU General Public License for more details.
+//
+// You should have received a copy of the GNU General Public License
+// along with this program.  If not, see <http://www.gnu.org/licenses/>.
+
+/// @file
+/// @brief Contains definition of lazy view of MGA-GPS-UTC message.
+/// @details Generated by script/gen_views.py, do NOT edit manually.
+
+#pragma once
+
+#include "ublox/message/MgaGpsUtc.h"
+#include "MsgView.h"
+
+namespace ublox
+{
+
+namespace view
+{
+
+/// @brief Lazy read-only view of MGA-GPS-UTC message payload.
+/// @details Wraps the pointer to the validated payload, the fields are
+///     decoded on access only, see @ref MsgView.
+/// @see @ref ublox::message::MgaGpsUtc
+class MgaGpsUtcView : public
+    MsgView<
+        ublox::message::MgaGpsUtcFields::All
+    >
+{
+    using Base =
+        MsgView<
+            ublox::message::MgaGpsUtcFields::All
+        >;
+
+public:
+    /// @brief ID of the viewed message.
+    static const MsgId MsgIdValue = MsgId_MGA_GPS;
+
+    /// @brief Index of the fields, same as the ones defined by
+    ///     @b COMMS_MSG_FIELDS_ACCESS() in @ref ublox::message::MgaGpsUtc.
+    enum FieldIdx
+    {
+        FieldIdx_type, ///< index of @b type field
+        FieldIdx_version, ///< index of @b version field
+        FieldIdx_reserved1, ///< index of @b reserved1 field
+        FieldIdx_utcA0, ///< index of @b utcA0 field
+        FieldIdx_utcA1, ///< index of @b utcA1 field
+        FieldIdx_utcDtLS, ///< index of @b utcDtLS field
+        FieldIdx_utcTot, ///< index of @b utcTot field
+        FieldIdx_utcWNt, ///< index of @b utcWNt field
+        FieldIdx_utcWNlsf, ///< index of @b utcWNlsf field
+        FieldIdx_utcDn, ///< index of @b utcDn field
+        FieldIdx_utcDtLSF, ///< index of @b utcDtLSF field
+        FieldIdx_reserved2, ///< index of @b reserved2 field
+        FieldIdx_numOfValues ///< number of available fields
+    };
+
+    /// @brief Default constructor, creates empty view.
+    MgaGpsUtcView() = default;
+
+    /// @brief Constructor
+    /// @param[in] payload Pointer to the payload of the message.
+    /// @param[in] len Length of the payload.
+    MgaGpsUtcView(const std::uint8_t* payload, std::size_t len)
+      : Base(payload, len)
+    {
+    }
+
+    /// @brief Decode "type" field (see @ref ublox::message::MgaGpsUtcFields::type).
+    comms::ErrorStatus field_type(FieldType<FieldIdx_type>& field) const
+    {
+        return Base::readField<FieldIdx_type>(field);
+    }
+
+    /// @brief Decode "version" field (see @ref ublox::message::MgaGpsUtcFields::version).
+    comms::ErrorStatus field_version(FieldType<FieldIdx_version>& field) const
+    {
+        return Base::readField<FieldIdx_version>(field);
+    }
+
+    /// @brief Decode "reserved1" field (see @ref ublox::message::MgaGpsUtcFields::reserved1).
+    comms::ErrorStatus field_reserved1(FieldType<FieldIdx_reserved1>& field) const
+    {
+        return Base::readField<FieldIdx_reserved1>(field);
+    }
+
+    /// @brief Decode "utcA0" field (see @ref ublox::message::MgaGpsUtcFields::utcA0).
+    comms::ErrorStatus field_utcA0(FieldType<FieldIdx_utcA0>& field) const
+    {
+        return Base::readField<FieldIdx_utcA0>(field);
+    }
+
+    /// @brief Decode "utcA1" field (see @ref ublox::message::MgaGpsUtcFields::utcA1).
+    comms::ErrorStatus field_utcA1(FieldType<FieldIdx_utcA1>& field) const
+    {
+        return Base::readField<FieldIdx_utcA1>(field);
+    }
+
+    /// @brief Decode "utcDtLS" field (see @ref ublox::message::MgaGpsUtcFields::utcDtLS).
+    comms::ErrorStatus field_utcDtLS(FieldType<FieldIdx_utcDtLS>& field) const
+    {
+        return Base::readField<FieldIdx_utcDtLS>(field);
+    }
+
+    /// @brief Decode "utcTot" field (see @ref ublox::message::MgaGpsUtcFields::utcTot).
+    comms::ErrorStatus field_utcTot(FieldType<FieldIdx_utcTot>& field) const
+    {
+        return Base::readField<FieldIdx_utcTot>(field);
+    }
+
+    /// @brief Decode "utcWNt" field (see @ref ublox::message::MgaGpsUtcFields::utcWNt).
+    comms::ErrorStatus field_utcWNt(FieldType<FieldIdx_utcWNt>& field) const
+    {
+        return Base::readField<FieldIdx_utcWNt>(field);
+    }
+
+    /// @brief Decode "utcWNlsf" field (see @ref ublox::message::MgaGpsUtcFields::utcWNlsf).
+    comms::ErrorStatus field_utcWNlsf(FieldType<FieldIdx_utcWNlsf>& field) const
+    {
+        return Base::readField<FieldIdx_utcWNlsf>(field);
+    }
+
+    /// @brief Decode "utcDn" field (see @ref ublox::message::MgaGpsUtcFields::utcDn).
+    comms::ErrorStatus field_utcDn(FieldType<FieldIdx_utcDn>& field) const
+    {
+        return Base::readField<FieldIdx_utcDn>(field);
+    }
+
+    /// @brief Decode "utcDtLSF" field (see @ref ublox::message::MgaGpsUtcFields::utcDtLSF).
+    comms::ErrorStatus field_utcDtLSF(FieldType<FieldIdx_utcDtLSF>& field) const
+    {
+        return Base::readField<FieldIdx_utcDtLSF>(field);
+    }
+
+    /// @brief Decode "reserved2" field (see @ref ublox::message::MgaGpsUtcFields::reserved2).
+    comms::ErrorStatus field_reserved2(FieldType<FieldIdx_reserved2>& field) const
+    {
+        return Base::readField<FieldIdx_reserved2>(field);
+    }
+};
+
+} // namespace view
+
+} // namespace ublox
+
@@ -0,0 +1,220 @@
+//
+// Copyright 2018 (C). Alex Robenko. All rights reserved.
+//
+
+// This file is free software: you can redistribute it and/or modify
+// it under the terms of the GNU General Public License as published by
+// the Free Software Foundation, either version 3 of the License, or
+// (at your option) any later version.
+//
+// This program is distributed in the hope that it will be useful,
+// but WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+// GNU General Public License for more details.
+//
+// You should have received a copy of the GNU General Public License
+// along with this program.  If not, see <http://www.gnu.org/licenses/>.
+
+/// @file
+/// @brief Contains definition of lazy view of MGA-INI-EOP message.
+/// @details Generated by script/gen_views.py, do NOT edit manually.
+
+#pragma once
+
+#include "ublox/message/MgaIniEop.h"
+#include "MsgView.h"
+
+namespace ublox
+{
+
+namespace view
+{
+
+/// @brief Lazy read-only view of MGA-INI-EOP message payload.
+/// @details Wraps the pointer to the validated payload, the fields are
+///     decoded on access only, see @ref MsgView.
+/// @see @ref ublox::message::MgaIniEop
+class MgaIniEopView : public
+    MsgView<
+        ublox::message::MgaIniEopFields::All
+    >
+{
+    using Base =
+        MsgView<
+            ublox::message::MgaIniEopFields::All
+        >;
+
+public:
+    /// @brief ID of the viewed message.
+    static const MsgId MsgIdValue = MsgId_MGA_INI;
+
+    /// @brief Index of the fields, same as the ones defined by
+    ///     @b COMMS_MSG_FIELDS_ACCESS() in @ref ublox::message::MgaIniEop.
+    enum FieldIdx
+    {
+        FieldIdx_type, ///< index of @b type field
+        FieldIdx_version, ///< index of @b version field
+        FieldIdx_reserved1, ///< index of @b reserved1 field
+        FieldIdx_d2kRef, ///< index of @b d2kRef field
+        FieldIdx_d2kMax, ///< index of @b d2kMax field
+        FieldIdx_xpP0, ///< index of @b xpP0 field
+        FieldIdx_xpP1, ///< index of @b xpP1 field
+        FieldIdx_ypP0, ///< index of @b ypP0 field
+        FieldIdx_ypP1, ///< index of @b ypP1 field
+        FieldIdx_dUT1, ///< index of @b dUT1 field
+        FieldIdx_ddUT1, ///< index of @b ddUT1 field
+        FieldIdx_reserved2, ///< index of @b reserved2 field
+        FieldIdx_reserved3, ///< index of @b reserved3 field
+        FieldIdx_reserved4, ///< index of @b reserved4 field
+        FieldIdx_reserved5, ///< index of @b reserved5 field
+        FieldIdx_reserved6, ///< index of @b reserved6 field
+        FieldIdx_reserved7, ///< index of @b reserved7 field
+        FieldIdx_reserved8, ///< index of @b reserved8 field
+        FieldIdx_reserved9, ///< index of @b reserved9 field
+        FieldIdx_reserved10, ///< index of @b reserved10 field
+        FieldIdx_reserved11, ///< index of @b reserved11 field
+        FieldIdx_numOfValues ///< number of available fields
+    };
+
+    /// @brief Default constructor, creates empty view.
+    MgaIniEopView() = default;
+
+    /// @brief Constructor
+    /// @param[in] payload Pointer to the payload of the message.
+    /// @param[in] len Length of the payload.
+    MgaIniEopView(const std::uint8_t* payload, std::size_t len)
+      : Base(payload, len)
+    {
+    }
+
+    /// @brief Decode "type" field (see @ref ublox::message::MgaIniEopFields::type).
+    comms::ErrorStatus field_type(FieldType<FieldIdx_type>& field) const
+    {
+        return Base::readField<FieldIdx_type>(field);
+    }
+
+    /// @brief Decode "version" field (see @ref ublox::message::MgaIniEopFields::version).
+    comms::ErrorStatus field_version(FieldType<FieldIdx_version>& field) const
+    {
+        return Base::readField<FieldIdx_version>(field);
+    }
+
+    /// @brief Decode "reserved1" field (see @ref ublox::message::MgaIniEopFields::reserved1).
+    comms::ErrorStatus field_reserved1(FieldType<FieldIdx_reserved1>& field) const
+    {
+        return Base::readField<FieldIdx_reserved1>(field);
+    }
+
+    /// @brief Decode "d2kRef" field (see @ref ublox::message::MgaIniEopFields::d2kRef).
+    comms::ErrorStatus field_d2kRef(FieldType<FieldIdx_d2kRef>& field) const
+    {
+        return Base::readField<FieldIdx_d2kRef>(field);
+    }
+
+    /// @brief Decode "d2kMax" field (see @ref ublox::message::MgaIniEopFields::d2kMax).
+    comms::ErrorStatus field_d2kMax(FieldType<FieldIdx_d2kMax>& field) const
+    {
+        return Base::readField<FieldIdx_d2kMax>(field);
+    }
+
+    /// @brief Decode "xpP0" field (see @ref ublox::message::MgaIniEopFields::xpP0).
+    comms::ErrorStatus field_xpP0(FieldType<FieldIdx_xpP0>& field) const
+    {
+        return Base::readField<FieldIdx_xpP0>(field);
+    }
+
+    /// @brief Decode "xpP1" field (see @ref ublox::message::MgaIniEopFields::xpP1).
+    comms::ErrorStatus field_xpP1(FieldType<FieldIdx_xpP1>& field) const
+    {
+        return Base::readField<FieldIdx_xpP1>(field);
+    }
+
+    /// @brief Decode "ypP0" field (see @ref ublox::message::MgaIniEopFields::ypP0).
+    comms::ErrorStatus field_ypP0(FieldType<FieldIdx_ypP0>& field) const
+    {
+        return Base::readField<FieldIdx_ypP0>(field);
+    }
+
+    /// @brief Decode "ypP1" field (see @ref ublox::message::MgaIniEopFields::ypP1).
+    comms::ErrorStatus field_ypP1(FieldType<FieldIdx_ypP1>& field) const
+    {
+        return Base::readField<FieldIdx_ypP1>(field);
+    }
+
+    /// @brief Decode "dUT1" field (see @ref ublox::message::MgaIniEopFields::dUT1).
+    comms::ErrorStatus field_dUT1(FieldType<FieldIdx_dUT1>& field) const
+    {
+        return Base::readField<FieldIdx_dUT1>(field);
+    }
+
+    /// @brief Decode "ddUT1" field (see @ref ublox::message::MgaIniEopFields::ddUT1).
+    comms::ErrorStatus field_ddUT1(FieldType<FieldIdx_ddUT1>& field) const
+    {
+        return Base::readField<FieldIdx_ddUT1>(field);
+    }
+
+    /// @brief Decode "reserved2" field (see @ref ublox::message::MgaIniEopFields::reserved2).
+    comms::ErrorStatus field_reserved2(FieldType<FieldIdx_reserved2>& field) const
+    {
+        return Base::readField<FieldIdx_reserved2>(field);
+    }
+
+    /// @brief Decode "reserved3" field (see @ref ublox::message::MgaIniEopFields::reserved3).
+    comms::ErrorStatus field_reserved3(FieldType<FieldIdx_reserved3>& field) const
+    {
+        return Base::readField<FieldIdx_reserved3>(field);
+    }
+
+    /// @brief Decode "reserved4" field (see @ref ublox::message::MgaIniEopFields::reserved4).
+    comms::ErrorStatus field_reserved4(FieldType<FieldIdx_reserved4>& field) const
+    {
+        return Base::readField<FieldIdx_reserved4>(field);
+    }
+
+    /// @brief Decode "reserved5" field (see @ref ublox::message::MgaIniEopFields::reserved5).
+    comms::ErrorStatus field_reserved5(FieldType<FieldIdx_reserved5>& field) const
+    {
+        return Base::readField<FieldIdx_reserved5>(field);
+    }
+
+    /// @brief Decode "reserved6" field (see @ref ublox::message::MgaIniEopFields::reserved6).
+    comms::ErrorStatus field_reserved6(FieldType<FieldIdx_reserved6>& field) const
+    {
+        return Base::readField<FieldIdx_reserved6>(field);
+    }
+
+    /// @brief Decode "reserved7" field (see @ref ublox::message::MgaIniEopFields::reserved7).
+    comms::ErrorStatus field_reserved7(FieldType<FieldIdx_reserved7>& field) const
+    {
+        return Base::readField<FieldIdx_reserved7>(field);
+    }
+
+    /// @brief Decode "reserved8" field (see @ref ublox::message::MgaIniEopFields::reserved8).
+    comms::ErrorStatus field_reserved8(FieldType<FieldIdx_reserved8>& field) const
+    {
+        return Base::readField<FieldIdx_reserved8>(field);
+    }
+
+    /// @brief Decode "reserved9" field (see @ref ublox::message::MgaIniEopFields::reserved9).
+    comms::ErrorStatus field_reserved9(FieldType<FieldIdx_reserved9>& field) const
+    {
+        return Base::readField<FieldIdx_reserved9>(field);
+    }
+
+    /// @brief Decode "reserved10" field (see @ref ublox::message::MgaIniEopFields::reserved10).
+    comms::ErrorStatus field_reserved10(FieldType<FieldIdx_reserved10>& field) const
+    {
+        return Base::readField<FieldIdx_reserved10>(field);
+    }
+
+    /// @brief Decode "reserved11" field (see @ref ublox::message::MgaIniEopFields::reserved11).
+    comms::ErrorStatus field_reserved11(FieldType<FieldIdx_reserved11>& field) const
+    {
+        return Base::readField<FieldIdx_reserved11>(field);
+    }
+};
+
+} // namespace view
+
+} // namespace ublox
+
@@ -0,0 +1,122 @@
+//
+// Copyright 2018 (C). Alex Robenko. All rights reserved.
+//
+
+// This file is free software: you can redistribute it and/or modify
+// it under the terms of the GNU General Public License as published by
+// the Free Software Foundation, either version 3 of the License, or
+// (at your option) any later version.
+//
+// This program is distributed in the hope that it will be useful,
+// but WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+// GNU General Public License for more details.
+//
+// You should have received a copy of the GNU General Public License
+// along with this program.  If not, see <http://www.gnu.org/licenses/>.
+
+/// @file
+/// @brief Contains definition of lazy view of MGA-INI-POS_LLH message.
+/// @details Generated by script/gen_views.py, do NOT edit manually.
+
+#pragma once
+
+#include "ublox/message/MgaIniPosLlh.h"
+#include "MsgView.h"
+
+namespace ublox
+{
+
+namespace view
+{
+
+/// @brief Lazy read-only view of MGA-INI-POS_LLH message payload.
+/// @details Wraps the pointer to the validated payload, the fields are
+///     decoded on access only, see @ref MsgView.
+/// @see @ref ublox::message::MgaIniPosLlh
+class MgaIniPosLlhView : public
+    MsgView<
+        ublox::message::MgaIniPosLlhFields::All
+    >
+{
+    using Base =
+        MsgView<
+            ublox::message::MgaIniPosLlhFields::All
+        >;
+
+public:
+    /// @brief ID of the viewed message.
+    static const MsgId MsgIdValue = MsgId_MGA_INI;
+
+    /// @brief Index of the fields, same as the ones defined by
+    ///     @b COMMS_MSG_FIELDS_ACCESS() in @ref ublox::message::MgaIniPosLlh.
+    enum FieldIdx
+    {
+        FieldIdx_type, ///< index of @b type field
+        FieldIdx_version, ///< index of @b version field
+        FieldIdx_reserved1, ///< index of @b reserved1 field
+        FieldIdx_lat, ///< index of @b lat field
+        FieldIdx_lon, ///< index of @b lon field
+        FieldIdx_alt, ///< index of @b alt field
+        FieldIdx_posAcc, ///< index of @b posAcc field
+        FieldIdx_numOfValues ///< number of available fields
+    };
+
+    /// @brief Default constructor, creates empty view.
+    MgaIniPosLlhView() = default;
+
+    /// @brief Constructor
+    /// @param[in] payload Pointer to the payload of the message.
+    /// @param[in] len Length of the payload.
+    MgaIniPosLlhView(const std::uint8_t* payload, std::size_t len)
+      : Base(payload, len)
+    {
+    }
+
+    /// @brief Decode "type" field (see @ref ublox::message::MgaIniPosLlhFields::type).
+    comms::ErrorStatus field_type(FieldType<FieldIdx_type>& field) const
+    {
+        return Base::readField<FieldIdx_type>(field);
+    }
+
+    /// @brief Decode "version" field (see @ref ublox::message::MgaIniPosLlhFields::version).
+    comms::ErrorStatus field_version(FieldType<FieldIdx_version>& field) const
+    {
+        return Base::readField<FieldIdx_version>(field);
+    }
+
+    /// @brief Decode "reserved1" field (see @ref ublox::message::MgaIniPosLlhFields::reserved1).
+    comms::ErrorStatus field_reserved1(FieldType<FieldIdx_reserved1>& field) const
+    {
+        return Base::readField<FieldIdx_reserved1>(field);
+    }
+
+    /// @brief Decode "lat" field (see @ref ublox::message::MgaIniPosLlhFields::lat).
+    comms::ErrorStatus field_lat(FieldType<FieldIdx_lat>& field) const
+    {
+        return Base::readField<FieldIdx_lat>(field);
+    }
+
+    /// @brief Decode "lon" field (see @ref ublox::message::MgaIniPosLlhFields::lon).
+    comms::ErrorStatus field_lon(FieldType<FieldIdx_lon>& field) const
+    {
+        return Base::readField<FieldIdx_lon>(field);
+    }
+
+    /// @brief Decode "alt" field (see @ref ublox::message::MgaIniPosLlhFields::alt).
+    comms::ErrorStatus field_alt(FieldType<FieldIdx_alt>& field) const
+    {
+        return Base::readField<FieldIdx_alt>(field);
+    }
+
+    /// @brief Decode "posAcc" field (see @ref ublox::message::MgaIniPosLlhFields::posAcc).
+    comms::ErrorStatus field_posAcc(FieldType<FieldIdx_posAcc>& field) const
+    {
+        return Base::readField<FieldIdx_posAcc>(field);
+    }
+};
+
+} // namespace view
+
+} // namespace ublox
+
@@ -0,0 +1,122 @@
+//
+// Copyright 2018 (C). Alex Robenko. All rights reserved.
+//
+
+// This file is free software: you can redistribute it and/or modify
+// it under the terms of the GNU General Public License as published by
+// the Free Software Foundation, either version 3 of the License, or
+// (at your option) any later version.
+//
+// This program is distributed in the hope that it will be useful,
+// but WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+// GNU General Public License for more details.
+//
+// You should have received a copy of the GNU General Public License
+// along with this program.  If not, see <http://www.gnu.org/licenses/>.
+
+/// @file
+/// @brief Contains definition of lazy view of MGA-INI-POS_XYZ message.
+/// @details Generated by script/gen_views.py, do NOT edit manually.
+
+#pragma once
+
+#include "ublox/message/MgaIniPosXyz.h"
+#include "MsgView.h"
+
+namespace ublox
+{
+
+namespace view
+{
+
+/// @brief Lazy read-only view of MGA-INI-POS_XYZ message payload.
+/// @details Wraps the pointer to the validated payload, the fields are
+///     decoded on access only, see @ref MsgView.
+/// @see @ref ublox::message::MgaIniPosXyz
+class MgaIniPosXyzView : public
+    MsgView<
+        ublox::message::MgaIniPosXyzFields::All
+    >
+{
+    using Base =
+        MsgView<
+            ublox::message::MgaIniPosXyzFields::All
+        >;
+
+public:
+    /// @brief ID of the viewed message.
+    static const MsgId MsgIdValue = MsgId_MGA_INI;
+
+    /// @brief Index of the fields, same as the ones defined by
+    ///     @b COMMS_MSG_FIELDS_ACCESS() in @ref ublox::message::MgaIniPosXyz.
+    enum FieldIdx
+    {
+        FieldIdx_type, ///< index of @b type field
+        FieldIdx_version, ///< index of @b version field
+        FieldIdx_reserved1, ///< index of @b reserved1 field
+        FieldIdx_ecefX, ///< index of @b ecefX field
+        FieldIdx_ecefY, ///< index of @b ecefY field
+        FieldIdx_ecefZ, ///< index of @b ecefZ field
+        FieldIdx_posAcc, ///< index of @b posAcc field
+        FieldIdx_numOfValues ///< number of available fields
+    };
+
+    /// @brief Default constructor, creates empty view.
+    MgaIniPosXyzView() = default;
+
+    /// @brief Constructor
+    /// @param[in] payload Pointer to the payload of the message.
+    /// @param[in] len Length of the payload.
+    MgaIniPosXyzView(const std::uint8_t* payload, std::size_t len)
+      : Base(payload, len)
+    {
+    }
+
+    /// @brief Decode "type" field (see @ref ublox::message::MgaIniPosXyzFields::type).
+    comms::ErrorStatus field_type(FieldType<FieldIdx_type>& field) const
+    {
+        return Base::readField<FieldIdx_type>(field);
+    }
+
+    /// @brief Decode "version" field (see @ref ublox::message::MgaIniPosXyzFields::version).
+    comms::ErrorStatus field_version(FieldType<FieldIdx_version>& field) const
+    {
+        return Base::readField<FieldIdx_version>(field);
+    }
+
+    /// @brief Decode "reserved1" field (see @ref ublox::message::MgaIniPosXyzFields::reserved1).
+    comms::ErrorStatus field_reserved1(FieldType<FieldIdx_reserved1>& field) const
+    {
+        return Base::readField<FieldIdx_reserved1>(field);
+    }
+
+    /// @brief Decode "ecefX" field (see @ref ublox::message::MgaIniPosXyzFields::ecefX).
+    comms::ErrorStatus field_ecefX(FieldType<FieldIdx_ecefX>& field) const
+    {
+        return Base::readField<FieldIdx_ecefX>(field);
+    }
+
+    /// @brief Decode "ecefY" field (see @ref ublox::message::MgaIniPosXyzFields::ecefY).
+    comms::ErrorStatus field_ecefY(FieldType<FieldIdx_ecefY>& field) const
+    {
+        return Base::readField<FieldIdx_ecefY>(field);
+    }
+
+    /// @brief Decode "ecefZ" field (see @ref ublox::message::MgaIniPosXyzFields::ecefZ).
+    comms::ErrorStatus field_ecefZ(FieldType<FieldIdx_ecefZ>& field) const
+    {
+        return Base::readField<FieldIdx_ecefZ>(field);
+    }
+
+    /// @brief Decode "posAcc" field (see @ref ublox::message::MgaIniPosXyzFields::posAcc).
+    comms::ErrorStatus field_posAcc(FieldType<FieldIdx_posAcc>& field) const
+    {
+        return Base::readField<FieldIdx_posAcc>(field);
+    }
+};
+
+} // namespace view
+
+} // namespace ublox
+
@@ -0,0 +1,150 @@
+//
+// Copyright 2018 (C). Alex Robenko. All rights reserved.
+//
+
+// This file is free software: you can redistribute it and/or modify
+// it under the terms of the GNU General Public License as published by
+// the Free Software Foundation, either version 3 of the License, or
+// (at your option) any later version.
+//
+// This program is distributed in the hope that it will be useful,
+// but WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+// GNU General Public License for more details.
+//
+// You should have received a copy of the GNU General Public License
+// along with this program.  If not, see <http://www.gnu.org/licenses/>.
+
+/// @file
+/// @brief Contains definition of lazy view of MGA-INI-TIME_GNSS message.
+/// @details Generated by script/gen_views.py, do NOT edit manually.
+
+#pragma once
+
+#include "ublox/message/MgaIniTimeGnss.h"
+#include "MsgView.h"
+
+namespace ublox
+{
+
+namespace view
+{
+
+/// @brief Lazy read-only view of MGA-INI-TIME_GNSS message payload.
+/// @details Wraps the pointer to the validated payload, the fields are
+///     decoded on access only, see @ref MsgView.
+/// @see @ref ublox::message::MgaIniTimeGnss
+class MgaIniTimeGnssView : public
+    MsgView<
+        ublox::message::MgaIniTimeGnssFields::All
+    >
+{
+    using Base =
+        MsgView<
+            ublox::message::MgaIniTimeGnssFields::All
+        >;
+
+public:
+    /// @brief ID of the viewed message.
+    static const MsgId MsgIdValue = MsgId_MGA_INI;
+
+    /// @brief Index of the fields, same as the ones defined by
+    ///     @b COMMS_MSG_FIELDS_ACCESS() in @ref ublox::message::MgaIniTimeGnss.
+    enum FieldIdx
+    {
+        FieldIdx_type, ///< index of @b type field
+        FieldIdx_version, ///< index of @b version field
+        FieldIdx_ref, ///< index of @b ref field
+        FieldIdx_gnssId, ///< index of @b gnssId field
+        FieldIdx_reserved1, ///< index of @b reserved1 field
+        FieldIdx_week, ///< index of @b week field
+        FieldIdx_tow, ///< index of @b tow field
+        FieldIdx_ns, ///< index of @b ns field
+        FieldIdx_tAccS, ///< index of @b tAccS field
+        FieldIdx_reserved2, ///< index of @b reserved2 field
+        FieldIdx_tAccNs, ///< index of @b tAccNs field
+        FieldIdx_numOfValues ///< number of available fields
+    };
+
+    /// @brief Default constructor, creates empty view.
+    MgaIniTimeGnssView() = default;
+
+    /// @brief Constructor
+    /// @param[in] payload Pointer to the payload of the message.
+    /// @param[in] len Length of the payload.
+    MgaIniTimeGnssView(const std::uint8_t* payload, std::size_t len)
+      : Base(payload, len)
+    {
+    }
+
+    /// @brief Decode "type" field (see @ref ublox::message::MgaIniTimeGnssFields::type).
+    comms::ErrorStatus field_type(FieldType<FieldIdx_type>& field) const
+    {
+        return Base::readField<FieldIdx_type>(field);
+    }
+
+    /// @brief Decode "version" field (see @ref ublox::message::MgaIniTimeGnssFields::version).
+    comms::ErrorStatus field_version(FieldType<FieldIdx_version>& field) const
+    {
+        return Base::readField<FieldIdx_version>(field);
+    }
+
+    /// @brief Decode "ref" field (see @ref ublox::message::MgaIniTimeGnssFields::ref).
+    comms::ErrorStatus field_ref(FieldType<FieldIdx_ref>& field) const
+    {
+        return Base::readField<FieldIdx_ref>(field);
+    }
+
+    /// @brief Decode "gnssId" field (see @ref ublox::message::MgaIniTimeGnssFields::gnssId).
+    comms::ErrorStatus field_gnssId(FieldType<FieldIdx_gnssId>& field) const
+    {
+        return Base::readField<FieldIdx_gnssId>(field);
+    }
+
+    /// @brief Decode "reserved1" field (see @ref ublox::message::MgaIniTimeGnssFields::reserved1).
+    comms::ErrorStatus field_reserved1(FieldType<FieldIdx_reserved1>& field) const
+    {
+        return Base::readField<FieldIdx_reserved1>(field);
+    }
+
+    /// @brief Decode "week" field (see @ref ublox::message::MgaIniTimeGnssFields::week).
+    comms::ErrorStatus field_week(FieldType<FieldIdx_week>& field) const
+    {
+        return Base::readField<FieldIdx_week>(field);
+    }
+
+    /// @brief Decode "tow" field (see @ref ublox::message::MgaIniTimeGnssFields::tow).
+    comms::ErrorStatus field_tow(FieldType<FieldIdx_tow>& field) const
+    {
+        return Base::readField<FieldIdx_tow>(field);
+    }
+
+    /// @brief Decode "ns" field (see @ref ublox::message::MgaIniTimeGnssFields::ns).
+    comms::ErrorStatus field_ns(FieldType<FieldIdx_ns>& field) const
+    {
+        return Base::readField<FieldIdx_ns>(field);
+    }
+
+    /// @brief Decode "tAccS" field (see @ref ublox::message::MgaIniTimeGnssFields::tAccS).
+    comms::ErrorStatus field_tAccS(FieldType<FieldIdx_tAccS>& field) const
+    {
+        return Base::readField<FieldIdx_tAccS>(field);
+    }
+
+    /// @brief Decode "reserved2" field (see @ref ublox::message::MgaIniTimeGnssFields::reserved2).
+    comms::ErrorStatus field_reserved2(FieldType<FieldIdx_reserved2>& field) const
+    {
+        return Base::readField<FieldIdx_reserved2>(field);
+    }
+
+    /// @brief Decode "tAccNs" field (see @ref ublox::message::MgaIniTimeGnssFields::tAccNs).
+    comms::ErrorStatus field_tAccNs(FieldType<FieldIdx_tAccNs>& field) const
+    {
+        return Base::readField<FieldIdx_tAccNs>(field);
+    }
+};
+
+} // namespace view
+
+} // namespace ublox
+
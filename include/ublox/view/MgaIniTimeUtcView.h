@@ -0,0 +1,178 @@
+//
+// Copyright 2018 (C). Alex Robenko. All rights reserved.
+//
+
+// This file is free software: you can redistribute it and/or modify
+// it under the terms of the GNU General Public License as published by
+// the Free Software Foundation, either version 3 of the License, or
+// (at your option) any later version.
+//
+// This program is distributed in the hope that it will be useful,
+// but WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+// GNU General Public License for more details.
+//
+// You should have received a copy of the GNU General Public License
+// along with this program.  If not, see <http://www.gnu.org/licenses/>.
+
+/// @file
+/// @brief Contains definition of lazy view of MGA-INI-TIME_UTC message.
+/// @details Generated by script/gen_views.py, do NOT edit manually.
+
+#pragma once
+
+#include "ublox/message/MgaIniTimeUtc.h"
+#include "MsgView.h"
+
+namespace ublox
+{
+
+namespace view
+{
+
+/// @brief Lazy read-only view of MGA-INI-TIME_UTC message payload.
+/// @details Wraps the pointer to the validated payload, the fields are
+///     decoded on access only, see @ref MsgView.
+/// @see @ref ublox::message::MgaIniTimeUtc
+class MgaIniTimeUtcView : public
+    MsgView<
+        ublox::message::MgaIniTimeUtcFields::All
+    >
+{
+    using Base =
+        MsgView<
+            ublox::message::MgaIniTimeUtcFields::All
+        >;
+
+public:
+    /// @brief ID of the viewed message.
+    static const MsgId MsgIdValue = MsgId_MGA_INI;
+
+    /// @brief Index of the fields, same as the ones defined by
+    ///     @b COMMS_MSG_FIELDS_ACCESS() in @ref ublox::message::MgaIniTimeUtc.
+    enum FieldIdx
+    {
+        FieldIdx_type, ///< index of @b type field
+        FieldIdx_version, ///< index of @b version field
+        FieldIdx_ref, ///< index of @b ref field
+        FieldIdx_leapSecs, ///< index of @b leapSecs field
+        FieldIdx_year, ///< index of @b year field
+        FieldIdx_month, ///< index of @b month field
+        FieldIdx_day, ///< index of @b day field
+        FieldIdx_hour, ///< index of @b hour field
+        FieldIdx_minute, ///< index of @b minute field
+        FieldIdx_second, ///< index of @b second field
+        FieldIdx_reserved1, ///< index of @b reserved1 field
+        FieldIdx_ns, ///< index of @b ns field
+        FieldIdx_tAccS, ///< index of @b tAccS field
+        FieldIdx_reserved2, ///< index of @b reserved2 field
+        FieldIdx_tAccNs, ///< index of @b tAccNs field
+        FieldIdx_numOfValues ///< number of available fields
+    };
+
+    /// @brief Default constructor, creates empty view.
+    MgaIniTimeUtcView() = default;
+
+    /// @brief Constructor
+    /// @param[in] payload Pointer to the payload of the message.
+    /// @param[in] len Length of the payload.
+    MgaIniTimeUtcView(const std::uint8_t* payload, std::size_t len)
+      : Base(payload, len)
+    {
+    }
+
+    /// @brief Decode "type" field (see @ref ublox::message::MgaIniTimeUtcFields::type).
+    comms::ErrorStatus field_type(FieldType<FieldIdx_type>& field) const
+    {
+        return Base::readField<FieldIdx_type>(field);
+    }
+
+    /// @brief Decode "version" field (see @ref ublox::message::MgaIniTimeUtcFields::version).
+    comms::ErrorStatus field_version(FieldType<FieldIdx_version>& field) const
+    {
+        return Base::readField<FieldIdx_version>(field);
+    }
+
+    /// @brief Decode "ref" field (see @ref ublox::message::MgaIniTimeUtcFields::ref).
+    comms::ErrorStatus field_ref(FieldType<FieldIdx_ref>& field) const
+    {
+        return Base::readField<FieldIdx_ref>(field);
+    }
+
+    /// @brief Decode "leapSecs" field (see @ref ublox::message::MgaIniTimeUtcFields::leapSecs).
+    comms::ErrorStatus field_leapSecs(FieldType<FieldIdx_leapSecs>& field) const
+    {
+        return Base::readField<FieldIdx_leapSecs>(field);
+    }
+
+    /// @brief Decode "year" field (see @ref ublox::message::MgaIniTimeUtcFields::year).
+    comms::ErrorStatus field_year(FieldType<FieldIdx_year>& field) const
+    {
+        return Base::readField<FieldIdx_year>(field);
+    }
+
+    /// @brief Decode "month" field (see @ref ublox::message::MgaIniTimeUtcFields::month).
+    comms::ErrorStatus field_month(FieldType<FieldIdx_month>& field) const
+    {
+        return Base::readField<FieldIdx_month>(field);
+    }
+
+    /// @brief Decode "day" field (see @ref ublox::message::MgaIniTimeUtcFields::day).
+    comms::ErrorStatus field_day(FieldType<FieldIdx_day>& field) const
+    {
+        return Base::readField<FieldIdx_day>(field);
+    }
+
+    /// @brief Decode "hour" field (see @ref ublox::message::MgaIniTimeUtcFields::hour).
+    comms::ErrorStatus field_hour(FieldType<FieldIdx_hour>& field) const
+    {
+        return Base::readField<FieldIdx_hour>(field);
+    }
+
+    /// @brief Decode "minute" field (see @ref ublox::message::MgaIniTimeUtcFields::minute).
+    comms::ErrorStatus field_minute(FieldType<FieldIdx_minute>& field) const
+    {
+        return Base::readField<FieldIdx_minute>(field);
+    }
+
+    /// @brief Decode "second" field (see @ref ublox::message::MgaIniTimeUtcFields::second).
+    comms::ErrorStatus field_second(FieldType<FieldIdx_second>& field) const
+    {
+        return Base::readField<FieldIdx_second>(field);
+    }
+
+    /// @brief Decode "reserved1" field (see @ref ublox::message::MgaIniTimeUtcFields::reserved1).
+    comms::ErrorStatus field_reserved1(FieldType<FieldIdx_reserved1>& field) const
+    {
+        return Base::readField<FieldIdx_reserved1>(field);
+    }
+
+    /// @brief Decode "ns" field (see @ref ublox::message::MgaIniTimeUtcFields::ns).
+    comms::ErrorStatus field_ns(FieldType<FieldIdx_ns>& field) const
+    {
+        return Base::readField<FieldIdx_ns>(field);
+    }
+
+    /// @brief Decode "tAccS" field (see @ref ublox::message::MgaIniTimeUtcFields::tAccS).
+    comms::ErrorStatus field_tAccS(FieldType<FieldIdx_tAccS>& field) const
+    {
+        return Base::readField<FieldIdx_tAccS>(field);
+    }
+
+    /// @brief Decode "reserved2" field (see @ref ublox::message::MgaIniTimeUtcFields::reserved2).
+    comms::ErrorStatus field_reserved2(FieldType<FieldIdx_reserved2>& field) const
+    {
+        return Base::readField<FieldIdx_reserved2>(field);
+    }
+
+    /// @brief Decode "tAccNs" field (see @ref ublox::message::MgaIniTimeUtcFields::tAccNs).
+    comms::ErrorStatus field_tAccNs(FieldType<FieldIdx_tAccNs>& field) const
+    {
+        return Base::readField<FieldIdx_tAccNs>(field);
+    }
+};
+
+} // namespace view
+
+} // namespace ublox
+
@@ -0,0 +1,115 @@
+//
+// Copyright 2018 (C). Alex Robenko. All rights reserved.
+//
+
+// This file is free software: you can redistribute it and/or modify
+// it under the terms of the GNU General Public License as published by
+// the Free Software Foundation, either version 3 of the License, or
+// (at your option) any later version.
+//
+// This program is distributed in the hope that it will be useful,
+// but WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+// GNU General Public License for more details.
+//
+// You should have received a copy of the GNU General Public License
+// along with this program.  If not, see <http://www.gnu.org/licenses/>.
+
+/// @file
+/// @brief Contains definition of lazy view of MON-GNSS message.
+/// @details Generated by script/gen_views.py, do NOT edit manually.
+
+#pragma once
+
+#include "ublox/message/MonGnss.h"
+#include "MsgView.h"
+
+namespace ublox
+{
+
+namespace view
+{
+
+/// @brief Lazy read-only view of MON-GNSS message payload.
+/// @details Wraps the pointer to the validated payload, the fields are
+///     decoded on access only, see @ref MsgView.
+/// @see @ref ublox::message::MonGnss
+class MonGnssView : public
+    MsgView<
+        ublox::message::MonGnssFields::All
+    >
+{
+    using Base =
+        MsgView<
+            ublox::message::MonGnssFields::All
+        >;
+
+public:
+    /// @brief ID of the viewed message.
+    static const MsgId MsgIdValue = MsgId_MON_GNSS;
+
+    /// @brief Index of the fields, same as the ones defined by
+    ///     @b COMMS_MSG_FIELDS_ACCESS() in @ref ublox::message::MonGnss.
+    enum FieldIdx
+    {
+        FieldIdx_version, ///< index of @b version field
+        FieldIdx_supported, ///< index of @b supported field
+        FieldIdx_defaultGnss, ///< index of @b defaultGnss field
+        FieldIdx_enabled, ///< index of @b enabled field
+        FieldIdx_simultaneous, ///< index of @b simultaneous field
+        FieldIdx_reserved1, ///< index of @b reserved1 field
+        FieldIdx_numOfValues ///< number of available fields
+    };
+
+    /// @brief Default constructor, creates empty view.
+    MonGnssView() = default;
+
+    /// @brief Constructor
+    /// @param[in] payload Pointer to the payload of the message.
+    /// @param[in] len Length of the payload.
+    MonGnssView(const std::uint8_t* payload, std::size_t len)
+      : Base(payload, len)
+    {
+    }
+
+    /// @brief Decode "version" field (see @ref ublox::message::MonGnssFields::version).
+    comms::ErrorStatus field_version(FieldType<FieldIdx_version>& field) const
+    {
+        return Base::readField<FieldIdx_version>(field);
+    }
+
+    /// @brief Decode "supported" field (see @ref ublox::message::MonGnssFields::supported).
+    comms::ErrorStatus field_supported(FieldType<FieldIdx_supported>& field) const
+    {
+        return Base::readField<FieldIdx_supported>(field);
+    }
+
+    /// @brief Decode "defaultGnss" field (see @ref ublox::message::MonGnssFields::defaultGnss).
+    comms::ErrorStatus field_defaultGnss(FieldType<FieldIdx_defaultGnss>& field) const
+    {
+        return Base::readField<FieldIdx_defaultGnss>(field);
+    }
+
+    /// @brief Decode "enabled" field (see @ref ublox::message::MonGnssFields::enabled).
+    comms::ErrorStatus field_enabled(FieldType<FieldIdx_enabled>& field) const
+    {
+        return Base::readField<FieldIdx_enabled>(field);
+    }
+
+    /// @brief Decode "simultaneous" field (see @ref ublox::message::MonGnssFields::simultaneous).
+    comms::ErrorStatus field_simultaneous(FieldType<FieldIdx_simultaneous>& field) const
+    {
+        return Base::readField<FieldIdx_simultaneous>(field);
+    }
+
+    /// @brief Decode "reserved1" field (see @ref ublox::message::MonGnssFields::reserved1).
+    comms::ErrorStatus field_reserved1(FieldType<FieldIdx_reserved1>& field) const
+    {
+        return Base::readField<FieldIdx_reserved1>(field);
+    }
+};
+
+} // namespace view
+
+} // namespace ublox
+
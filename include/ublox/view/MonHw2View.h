@@ -0,0 +1,143 @@
+//
+// Copyright 2018 (C). Alex Robenko. All rights reserved.
+//
+
+// This file is free software: you can redistribute it and/or modify
+// it under the terms of the GNU General Public License as published by
+// the Free Software Foundation, either version 3 of the License, or
+// (at your option) any later version.
+//
+// This program is distributed in the hope that it will be useful,
+// but WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+// GNU General Public License for more details.
+//
+// You should have received a copy of the GNU General Public License
+// along with this program.  If not, see <http://www.gnu.org/licenses/>.
+
+/// @file
+/// @brief Contains definition of lazy view of MON-HW2 message.
+/// @details Generated by script/gen_views.py, do NOT edit manually.
+
+#pragma once
+
+#include "ublox/message/MonHw2.h"
+#include "MsgView.h"
+
+namespace ublox
+{
+
+namespace view
+{
+
+/// @brief Lazy read-only view of MON-HW2 message payload.
+/// @details Wraps the pointer to the validated payload, the fields are
+///     decoded on access only, see @ref MsgView.
+/// @see @ref ublox::message::MonHw2
+class MonHw2View : public
+    MsgView<
+        ublox::message::MonHw2Fields::All
+    >
+{
+    using Base =
+        MsgView<
+            ublox::message::MonHw2Fields::All
+        >;
+
+public:
+    /// @brief ID of the viewed message.
+    static const MsgId MsgIdValue = MsgId_MON_HW2;
+
+    /// @brief Index of the fields, same as the ones defined by
+    ///     @b COMMS_MSG_FIELDS_ACCESS() in @ref ublox::message::MonHw2.
+    enum FieldIdx
+    {
+        FieldIdx_ofsI, ///< index of @b ofsI field
+        FieldIdx_magI, ///< index of @b magI field
+        FieldIdx_ofsQ, ///< index of @b ofsQ field
+        FieldIdx_magQ, ///< index of @b magQ field
+        FieldIdx_cfgSource, ///< index of @b cfgSource field
+        FieldIdx_reserved0, ///< index of @b reserved0 field
+        FieldIdx_lowLevelCfg, ///< index of @b lowLevelCfg field
+        FieldIdx_reserved1, ///< index of @b reserved1 field
+        FieldIdx_postStatus, ///< index of @b postStatus field
+        FieldIdx_reserved2, ///< index of @b reserved2 field
+        FieldIdx_numOfValues ///< number of available fields
+    };
+
+    /// @brief Default constructor, creates empty view.
+    MonHw2View() = default;
+
+    /// @brief Constructor
+    /// @param[in] payload Pointer to the payload of the message.
+    /// @param[in] len Length of the payload.
+    MonHw2View(const std::uint8_t* payload, std::size_t len)
+      : Base(payload, len)
+    {
+    }
+
+    /// @brief Decode "ofsI" field (see @ref ublox::message::MonHw2Fields::ofsI).
+    comms::ErrorStatus field_ofsI(FieldType<FieldIdx_ofsI>& field) const
+    {
+        return Base::readField<FieldIdx_ofsI>(field);
+    }
+
+    /// @brief Decode "magI" field (see @ref ublox::message::MonHw2Fields::magI).
+    comms::ErrorStatus field_magI(FieldType<FieldIdx_magI>& field) const
+    {
+        return Base::readField<FieldIdx_magI>(field);
+    }
+
+    /// @brief Decode "ofsQ" field (see @ref ublox::message::MonHw2Fields::ofsQ).
+    comms::ErrorStatus field_ofsQ(FieldType<FieldIdx_ofsQ>& field) const
+    {
+        return Base::readField<FieldIdx_ofsQ>(field);
+    }
+
+    /// @brief Decode "magQ" field (see @ref ublox::message::MonHw2Fields::magQ).
+    comms::ErrorStatus field_magQ(FieldType<FieldIdx_magQ>& field) const
+    {
+        return Base::readField<FieldIdx_magQ>(field);
+    }
+
+    /// @brief Decode "cfgSource" field (see @ref ublox::message::MonHw2Fields::cfgSource).
+    comms::ErrorStatus field_cfgSource(FieldType<FieldIdx_cfgSource>& field) const
+    {
+        return Base::readField<FieldIdx_cfgSource>(field);
+    }
+
+    /// @brief Decode "reserved0" field (see @ref ublox::message::MonHw2Fields::reserved0).
+    comms::ErrorStatus field_reserved0(FieldType<FieldIdx_reserved0>& field) const
+    {
+        return Base::readField<FieldIdx_reserved0>(field);
+    }
+
+    /// @brief Decode "lowLevelCfg" field (see @ref ublox::message::MonHw2Fields::lowLevelCfg).
+    comms::ErrorStatus field_lowLevelCfg(FieldType<FieldIdx_lowLevelCfg>& field) const
+    {
+        return Base::readField<FieldIdx_lowLevelCfg>(field);
+    }
+
+    /// @brief Decode "reserved1" field (see @ref ublox::message::MonHw2Fields::reserved1).
+    comms::ErrorStatus field_reserved1(FieldType<FieldIdx_reserved1>& field) const
+    {
+        return Base::readField<FieldIdx_reserved1>(field);
+    }
+
+    /// @brief Decode "postStatus" field (see @ref ublox::message::MonHw2Fields::postStatus).
+    comms::ErrorStatus field_postStatus(FieldType<FieldIdx_postStatus>& field) const
+    {
+        return Base::readField<FieldIdx_postStatus>(field);
+    }
+
+    /// @brief Decode "reserved2" field (see @ref ublox::message::MonHw2Fields::reserved2).
+    comms::ErrorStatus field_reserved2(FieldType<FieldIdx_reserved2>& field) const
+    {
+        return Base::readField<FieldIdx_reserved2>(field);
+    }
+};
+
+} // namespace view
+
+} // namespace ublox
+
@@ -0,0 +1,192 @@
+//
+// Copyright 2018 (C). Alex Robenko. All rights reserved.
+//
+
+// This file is free software: you can redistribute it and/or modify
+// it under the terms of the GNU General Public License as published by
+// the Free Software Foundation, either version 3 of the License, or
+// (at your option) any later version.
+//
+// This program is distributed in the hope that it will be useful,
+// but WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+// GNU General Public License for more details.
+//
+// You should have received a copy of the GNU General Public License
+// along with this program.  If not, see <http://www.gnu.org/licenses/>.
+
+/// @file
+/// @brief Contains definition of lazy view of MON-HW message.
+/// @details Generated by script/gen_views.py, do NOT edit manually.
+
+#pragma once
+
+#include "ublox/message/MonHw.h"
+#include "MsgView.h"
+
+namespace ublox
+{
+
+namespace view
+{
+
+/// @brief Lazy read-only view of MON-HW message payload.
+/// @details Wraps the pointer to the validated payload, the fields are
+///     decoded on access only, see @ref MsgView.
+/// @see @ref ublox::message::MonHw
+class MonHwView : public
+    MsgView<
+        ublox::message::MonHwFields::All<comms::option::EmptyOption>
+    >
+{
+    using Base =
+        MsgView<
+            ublox::message::MonHwFields::All<comms::option::EmptyOption>
+        >;
+
+public:
+    /// @brief ID of the viewed message.
+    static const MsgId MsgIdValue = MsgId_MON_HW;
+
+    /// @brief Index of the fields, same as the ones defined by
+    ///     @b COMMS_MSG_FIELDS_ACCESS() in @ref ublox::message::MonHw.
+    enum FieldIdx
+    {
+        FieldIdx_pinSel, ///< index of @b pinSel field
+        FieldIdx_pinBank, ///< index of @b pinBank field
+        FieldIdx_pinDir, ///< index of @b pinDir field
+        FieldIdx_pinVal, ///< index of @b pinVal field
+        FieldIdx_noisePerMS, ///< index of @b noisePerMS field
+        FieldIdx_agcCnt, ///< index of @b agcCnt field
+        FieldIdx_aStatus, ///< index of @b aStatus field
+        FieldIdx_aPower, ///< index of @b aPower field
+        FieldIdx_flags, ///< index of @b flags field
+        FieldIdx_reserved1, ///< index of @b reserved1 field
+        FieldIdx_usedMask, ///< index of @b usedMask field
+        FieldIdx_VP, ///< index of @b VP field
+        FieldIdx_jamInd, ///< index of @b jamInd field
+        FieldIdx_reserved3, ///< index of @b reserved3 field
+        FieldIdx_pinIrq, ///< index of @b pinIrq field
+        FieldIdx_pullH, ///< index of @b pullH field
+        FieldIdx_pullL, ///< index of @b pullL field
+        FieldIdx_numOfValues ///< number of available fields
+    };
+
+    /// @brief Default constructor, creates empty view.
+    MonHwView() = default;
+
+    /// @brief Constructor
+    /// @param[in] payload Pointer to the payload of the message.
+    /// @param[in] len Length of the payload.
+    MonHwView(const std::uint8_t* payload, std::size_t len)
+      : Base(payload, len)
+    {
+    }
+
+    /// @brief Decode "pinSel" field (see @ref ublox::message::MonHwFields::pinSel).
+    comms::ErrorStatus field_pinSel(FieldType<FieldIdx_pinSel>& field) const
+    {
+        return Base::readField<FieldIdx_pinSel>(field);
+    }
+
+    /// @brief Decode "pinBank" field (see @ref ublox::message::MonHwFields::pinBank).
+    comms::ErrorStatus field_pinBank(FieldType<FieldIdx_pinBank>& field) const
+    {
+        return Base::readField<FieldIdx_pinBank>(field);
+    }
+
+    /// @brief Decode "pinDir" field (see @ref ublox::message::MonHwFields::pinDir).
+    comms::ErrorStatus field_pinDir(FieldType<FieldIdx_pinDir>& field) const
+    {
+        return Base::readField<FieldIdx_pinDir>(field);
+    }
+
+    /// @brief Decode "pinVal" field (see @ref ublox::message::MonHwFields::pinVal).
+    comms::ErrorStatus field_pinVal(FieldType<FieldIdx_pinVal>& field) const
+    {
+        return Base::readField<FieldIdx_pinVal>(field);
+    }
+
+    /// @brief Decode "noisePerMS" field (see @ref ublox::message::MonHwFields::noisePerMS).
+    comms::ErrorStatus field_noisePerMS(FieldType<FieldIdx_noisePerMS>& field) const
+    {
+        return Base::readField<FieldIdx_noisePerMS>(field);
+    }
+
+    /// @brief Decode "agcCnt" field (see @ref ublox::message::MonHwFields::agcCnt).
+    comms::ErrorStatus field_agcCnt(FieldType<FieldIdx_agcCnt>& field) const
+    {
+        return Base::readField<FieldIdx_agcCnt>(field);
+    }
+
+    /// @brief Decode "aStatus" field (see @ref ublox::message::MonHwFields::aStatus).
+    comms::ErrorStatus field_aStatus(FieldType<FieldIdx_aStatus>& field) const
+    {
+        return Base::readField<FieldIdx_aStatus>(field);
+    }
+
+    /// @brief Decode "aPower" field (see @ref ublox::message::MonHwFields::aPower).
+    comms::ErrorStatus field_aPower(FieldType<FieldIdx_aPower>& field) const
+    {
+        return Base::readField<FieldIdx_aPower>(field);
+    }
+
+    /// @brief Decode "flags" field (see @ref ublox::message::MonHwFields::flags).
+    comms::ErrorStatus field_flags(FieldType<FieldIdx_flags>& field) const
+    {
+        return Base::readField<FieldIdx_flags>(field);
+    }
+
+    /// @brief Decode "reserved1" field (see @ref ublox::message::MonHwFields::reserved1).
+    comms::ErrorStatus field_reserved1(FieldType<FieldIdx_reserved1>& field) const
+    {
+        return Base::readField<FieldIdx_reserved1>(field);
+    }
+
+    /// @brief Decode "usedMask" field (see @ref ublox::message::MonHwFields::usedMask).
+    comms::ErrorStatus field_usedMask(FieldType<FieldIdx_usedMask>& field) const
+    {
+        return Base::readField<FieldIdx_usedMask>(field);
+    }
+
+    /// @brief Decode "VP" field (see @ref ublox::message::MonHwFields::VP).
+    comms::ErrorStatus field_VP(FieldType<FieldIdx_VP>& field) const
+    {
+        return Base::readField<FieldIdx_VP>(field);
+    }
+
+    /// @brief Decode "jamInd" field (see @ref ublox::message::MonHwFields::jamInd).
+    comms::ErrorStatus field_jamInd(FieldType<FieldIdx_jamInd>& field) const
+    {
+        return Base::readField<FieldIdx_jamInd>(field);
+    }
+
+    /// @brief Decode "reserved3" field (see @ref ublox::message::MonHwFields::reserved3).
+    comms::ErrorStatus field_reserved3(FieldType<FieldIdx_reserved3>& field) const
+    {
+        return Base::readField<FieldIdx_reserved3>(field);
+    }
+
+    /// @brief Decode "pinIrq" field (see @ref ublox::message::MonHwFields::pinIrq).
+    comms::ErrorStatus field_pinIrq(FieldType<FieldIdx_pinIrq>& field) const
+    {
+        return Base::readField<FieldIdx_pinIrq>(field);
+    }
+
+    /// @brief Decode "pullH" field (see @ref ublox::message::MonHwFields::pullH).
+    comms::ErrorStatus field_pullH(FieldType<FieldIdx_pullH>& field) const
+    {
+        return Base::readField<FieldIdx_pullH>(field);
+    }
+
+    /// @brief Decode "pullL" field (see @ref ublox::message::MonHwFields::pullL).
+    comms::ErrorStatus field_pullL(FieldType<FieldIdx_pullL>& field) const
+    {
+        return Base::readField<FieldIdx_pullL>(field);
+    }
+};
+
+} // namespace view
+
+} // namespace ublox
+
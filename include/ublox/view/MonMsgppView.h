@@ -0,0 +1,122 @@
+//
+// Copyright 2018 (C). Alex Robenko. All rights reserved.
+//
+
+// This file is free software: you can redistribute it and/or modify
+// it under the terms of the GNU General Public License as published by
+// the Free Software Foundation, either version 3 of the License, or
+// (at your option) any later version.
+//
+// This program is distributed in the hope that it will be useful,
+// but WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+// GNU General Public License for more details.
+//
+// You should have received a copy of the GNU General Public License
+// along with this program.  If not, see <http://www.gnu.org/licenses/>.
+
+/// @file
+/// @brief Contains definition of lazy view of MON-MSGPP message.
+/// @details Generated by script/gen_views.py, do NOT edit manually.
+
+#pragma once
+
+#include "ublox/message/MonMsgpp.h"
+#include "MsgView.h"
+
+namespace ublox
+{
+
+namespace view
+{
+
+/// @brief Lazy read-only view of MON-MSGPP message payload.
+/// @details Wraps the pointer to the validated payload, the fields are
+///     decoded on access only, see @ref MsgView.
+/// @see @ref ublox::message::MonMsgpp
+class MonMsgppView : public
+    MsgView<
+        ublox::message::MonMsgppFields::All<comms::option::EmptyOption, comms::option::EmptyOption>
+    >
+{
+    using Base =
+        MsgView<
+            ublox::message::MonMsgppFields::All<comms::option::EmptyOption, comms::option::EmptyOption>
+        >;
+
+public:
+    /// @brief ID of the viewed message.
+    static const MsgId MsgIdValue = MsgId_MON_MSGPP;
+
+    /// @brief Index of the fields, same as the ones defined by
+    ///     @b COMMS_MSG_FIELDS_ACCESS() in @ref ublox::message::MonMsgpp.
+    enum FieldIdx
+    {
+        FieldIdx_msg1, ///< index of @b msg1 field
+        FieldIdx_msg2, ///< index of @b msg2 field
+        FieldIdx_msg3, ///< index of @b msg3 field
+        FieldIdx_msg4, ///< index of @b msg4 field
+        FieldIdx_msg5, ///< index of @b msg5 field
+        FieldIdx_msg6, ///< index of @b msg6 field
+        FieldIdx_skipped, ///< index of @b skipped field
+        FieldIdx_numOfValues ///< number of available fields
+    };
+
+    /// @brief Default constructor, creates empty view.
+    MonMsgppView() = default;
+
+    /// @brief Constructor
+    /// @param[in] payload Pointer to the payload of the message.
+    /// @param[in] len Length of the payload.
+    MonMsgppView(const std::uint8_t* payload, std::size_t len)
+      : Base(payload, len)
+    {
+    }
+
+    /// @brief Decode "msg1" field (see @ref ublox::message::MonMsgppFields::msg1).
+    comms::ErrorStatus field_msg1(FieldType<FieldIdx_msg1>& field) const
+    {
+        return Base::readField<FieldIdx_msg1>(field);
+    }
+
+    /// @brief Decode "msg2" field (see @ref ublox::message::MonMsgppFields::msg2).
+    comms::ErrorStatus field_msg2(FieldType<FieldIdx_msg2>& field) const
+    {
+        return Base::readField<FieldIdx_msg2>(field);
+    }
+
+    /// @brief Decode "msg3" field (see @ref ublox::message::MonMsgppFields::msg3).
+    comms::ErrorStatus field_msg3(FieldType<FieldIdx_msg3>& field) const
+    {
+        return Base::readField<FieldIdx_msg3>(field);
+    }
+
+    /// @brief Decode "msg4" field (see @ref ublox::message::MonMsgppFields::msg4).
+    comms::ErrorStatus field_msg4(FieldType<FieldIdx_msg4>& field) const
+    {
+        return Base::readField<FieldIdx_msg4>(field);
+    }
+
+    /// @brief Decode "msg5" field (see @ref ublox::message::MonMsgppFields::msg5).
+    comms::ErrorStatus field_msg5(FieldType<FieldIdx_msg5>& field) const
+    {
+        return Base::readField<FieldIdx_msg5>(field);
+    }
+
+    /// @brief Decode "msg6" field (see @ref ublox::message::MonMsgppFields::msg6).
+    comms::ErrorStatus field_msg6(FieldType<FieldIdx_msg6>& field) const
+    {
+        return Base::readField<FieldIdx_msg6>(field);
+    }
+
+    /// @brief Decode "skipped" field (see @ref ublox::message::MonMsgppFields::skipped).
+    comms::ErrorStatus field_skipped(FieldType<FieldIdx_skipped>& field) const
+    {
+        return Base::readField<FieldIdx_skipped>(field);
+    }
+};
+
+} // namespace view
+
+} // namespace ublox
+
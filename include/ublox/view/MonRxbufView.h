@@ -0,0 +1,94 @@
+//
+// Copyright 2018 (C). Alex Robenko. All rights reserved.
+//
+
+// This file is free software: you can redistribute it and/or modify
+// it under the terms of the GNU General Public License as published by
+// the Free Software Foundation, either version 3 of the License, or
+// (at your option) any later version.
+//
+// This program is distributed in the hope that it will be useful,
+// but WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+// GNU General Public License for more details.
+//
+// You should have received a copy of the GNU General Public License
+// along with this program.  If not, see <http://www.gnu.org/licenses/>.
+
+/// @file
+/// @brief Contains definition of lazy view of MON-RXBUF message.
+/// @details Generated by script/gen_views.py, do NOT edit manually.
+
+#pragma once
+
+#include "ublox/message/MonRxbuf.h"
+#include "MsgView.h"
+
+namespace ublox
+{
+
+namespace view
+{
+
+/// @brief Lazy read-only view of MON-RXBUF message payload.
+/// @details Wraps the pointer to the validated payload, the fields are
+///     decoded on access only, see @ref MsgView.
+/// @see @ref ublox::message::MonRxbuf
+class MonRxbufView : public
+    MsgView<
+        ublox::message::MonRxbufFields::All<comms::option::EmptyOption>
+    >
+{
+    using Base =
+        MsgView<
+            ublox::message::MonRxbufFields::All<comms::option::EmptyOption>
+        >;
+
+public:
+    /// @brief ID of the viewed message.
+    static const MsgId MsgIdValue = MsgId_MON_RXBUF;
+
+    /// @brief Index of the fields, same as the ones defined by
+    ///     @b COMMS_MSG_FIELDS_ACCESS() in @ref ublox::message::MonRxbuf.
+    enum FieldIdx
+    {
+        FieldIdx_pending, ///< index of @b pending field
+        FieldIdx_usage, ///< index of @b usage field
+        FieldIdx_peakUsage, ///< index of @b peakUsage field
+        FieldIdx_numOfValues ///< number of available fields
+    };
+
+    /// @brief Default constructor, creates empty view.
+    MonRxbufView() = default;
+
+    /// @brief Constructor
+    /// @param[in] payload Pointer to the payload of the message.
+    /// @param[in] len Length of the payload.
+    MonRxbufView(const std::uint8_t* payload, std::size_t len)
+      : Base(payload, len)
+    {
+    }
+
+    /// @brief Decode "pending" field (see @ref ublox::message::MonRxbufFields::pending).
+    comms::ErrorStatus field_pending(FieldType<FieldIdx_pending>& field) const
+    {
+        return Base::readField<FieldIdx_pending>(field);
+    }
+
+    /// @brief Decode "usage" field (see @ref ublox::message::MonRxbufFields::usage).
+    comms::ErrorStatus field_usage(FieldType<FieldIdx_usage>& field) const
+    {
+        return Base::readField<FieldIdx_usage>(field);
+    }
+
+    /// @brief Decode "peakUsage" field (see @ref ublox::message::MonRxbufFields::peakUsage).
+    comms::ErrorStatus field_peakUsage(FieldType<FieldIdx_peakUsage>& field) const
+    {
+        return Base::readField<FieldIdx_peakUsage>(field);
+    }
+};
+
+} // namespace view
+
+} // namespace ublox
+
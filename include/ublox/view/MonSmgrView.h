@@ -0,0 +1,136 @@
+//
+// Copyright 2018 (C). Alex Robenko. All rights reserved.
+//
+
+// This file is free software: you can redistribute it and/or modify
+// it under the terms of the GNU General Public License as published by
+// the Free Software Foundation, either version 3 of the License, or
+// (at your option) any later version.
+//
+// This program is distributed in the hope that it will be useful,
+// but WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+// GNU General Public License for more details.
+//
+// You should have received a copy of the GNU General Public License
+// along with this program.  If not, see <http://www.gnu.org/licenses/>.
+
+/// @file
+/// @brief Contains definition of lazy view of MON-SMGR message.
+/// @details Generated by script/gen_views.py, do NOT edit manually.
+
+#pragma once
+
+#include "ublox/message/MonSmgr.h"
+#include "MsgView.h"
+
+namespace ublox
+{
+
+namespace view
+{
+
+/// @brief Lazy read-only view of MON-SMGR message payload.
+/// @details Wraps the pointer to the validated payload, the fields are
+///     decoded on access only, see @ref MsgView.
+/// @see @ref ublox::message::MonSmgr
+class MonSmgrView : public
+    MsgView<
+        ublox::message::MonSmgrFields::All
+    >
+{
+    using Base =
+        MsgView<
+            ublox::message::MonSmgrFields::All
+        >;
+
+public:
+    /// @brief ID of the viewed message.
+    static const MsgId MsgIdValue = MsgId_MON_SMGR;
+
+    /// @brief Index of the fields, same as the ones defined by
+    ///     @b COMMS_MSG_FIELDS_ACCESS() in @ref ublox::message::MonSmgr.
+    enum FieldIdx
+    {
+        FieldIdx_version, ///< index of @b version field
+        FieldIdx_reserved1, ///< index of @b reserved1 field
+        FieldIdx_iTOW, ///< index of @b iTOW field
+        FieldIdx_intOsc, ///< index of @b intOsc field
+        FieldIdx_extOsc, ///< index of @b extOsc field
+        FieldIdx_discSrc, ///< index of @b discSrc field
+        FieldIdx_gnss, ///< index of @b gnss field
+        FieldIdx_extInt0, ///< index of @b extInt0 field
+        FieldIdx_extInt1, ///< index of @b extInt1 field
+        FieldIdx_numOfValues ///< number of available fields
+    };
+
+    /// @brief Default constructor, creates empty view.
+    MonSmgrView() = default;
+
+    /// @brief Constructor
+    /// @param[in] payload Pointer to the payload of the message.
+    /// @param[in] len Length of the payload.
+    MonSmgrView(const std::uint8_t* payload, std::size_t len)
+      : Base(payload, len)
+    {
+    }
+
+    /// @brief Decode "version" field (see @ref ublox::message::MonSmgrFields::version).
+    comms::ErrorStatus field_version(FieldType<FieldIdx_version>& field) const
+    {
+        return Base::readField<FieldIdx_version>(field);
+    }
+
+    /// @brief Decode "reserved1" field (see @ref ublox::message::MonSmgrFields::reserved1).
+    comms::ErrorStatus field_reserved1(FieldType<FieldIdx_reserved1>& field) const
+    {
+        return Base::readField<FieldIdx_reserved1>(field);
+    }
+
+    /// @brief Decode "iTOW" field (see @ref ublox::message::MonSmgrFields::iTOW).
+    comms::ErrorStatus field_iTOW(FieldType<FieldIdx_iTOW>& field) const
+    {
+        return Base::readField<FieldIdx_iTOW>(field);
+    }
+
+    /// @brief Decode "intOsc" field (see @ref ublox::message::MonSmgrFields::intOsc).
+    comms::ErrorStatus field_intOsc(FieldType<FieldIdx_intOsc>& field) const
+    {
+        return Base::readField<FieldIdx_intOsc>(field);
+    }
+
+    /// @brief Decode "extOsc" field (see @ref ublox::message::MonSmgrFields::extOsc).
+    comms::ErrorStatus field_extOsc(FieldType<FieldIdx_extOsc>& field) const
+    {
+        return Base::readField<FieldIdx_extOsc>(field);
+    }
+
+    /// @brief Decode "discSrc" field (see @ref ublox::message::MonSmgrFields::discSrc).
+    comms::ErrorStatus field_discSrc(FieldType<FieldIdx_discSrc>& field) const
+    {
+        return Base::readField<FieldIdx_discSrc>(field);
+    }
+
+    /// @brief Decode "gnss" field (see @ref ublox::message::MonSmgrFields::gnss).
+    comms::ErrorStatus field_gnss(FieldType<FieldIdx_gnss>& field) const
+    {
+        return Base::readField<FieldIdx_gnss>(field);
+    }
+
+    /// @brief Decode "extInt0" field (see @ref ublox::message::MonSmgrFields::extInt0).
+    comms::ErrorStatus field_extInt0(FieldType<FieldIdx_extInt0>& field) const
+    {
+        return Base::readField<FieldIdx_extInt0>(field);
+    }
+
+    /// @brief Decode "extInt1" field (see @ref ublox::message::MonSmgrFields::extInt1).
+    comms::ErrorStatus field_extInt1(FieldType<FieldIdx_extInt1>& field) const
+    {
+        return Base::readField<FieldIdx_extInt1>(field);
+    }
+};
+
+} // namespace view
+
+} // namespace ublox
+
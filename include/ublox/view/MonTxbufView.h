@@ -0,0 +1,122 @@
+//
+// Copyright 2018 (C). Alex Robenko. All rights reserved.
+//
+
+// This file is free software: you can redistribute it and/or modify
+// it under the terms of the GNU General Public License as published by
+// the Free Software Foundation, either version 3 of the License, or
+// (at your option) any later version.
+//
+// This program is distributed in the hope that it will be useful,
+// but WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+// GNU General Public License for more details.
+//
+// You should have received a copy of the GNU General Public License
+// along with this program.  If not, see <http://www.gnu.org/licenses/>.
+
+/// @file
+/// @brief Contains definition of lazy view of MON-TXBUF message.
+/// @details Generated by script/gen_views.py, do NOT edit manually.
+
+#pragma once
+
+#include "ublox/message/MonTxbuf.h"
+#include "MsgView.h"
+
+namespace ublox
+{
+
+namespace view
+{
+
+/// @brief Lazy read-only view of MON-TXBUF message payload.
+/// @details Wraps the pointer to the validated payload, the fields are
+///     decoded on access only, see @ref MsgView.
+/// @see @ref ublox::message::MonTxbuf
+class MonTxbufView : public
+    MsgView<
+        ublox::message::MonTxbufFields::All<comms::option::EmptyOption>
+    >
+{
+    using Base =
+        MsgView<
+            ublox::message::MonTxbufFields::All<comms::option::EmptyOption>
+        >;
+
+public:
+    /// @brief ID of the viewed message.
+    static const MsgId MsgIdValue = MsgId_MON_TXBUF;
+
+    /// @brief Index of the fields, same as the ones defined by
+    ///     @b COMMS_MSG_FIELDS_ACCESS() in @ref ublox::message::MonTxbuf.
+    enum FieldIdx
+    {
+        FieldIdx_pending, ///< index of @b pending field
+        FieldIdx_usage, ///< index of @b usage field
+        FieldIdx_peakUsage, ///< index of @b peakUsage field
+        FieldIdx_tUsage, ///< index of @b tUsage field
+        FieldIdx_tPeakUsage, ///< index of @b tPeakUsage field
+        FieldIdx_errors, ///< index of @b errors field
+        FieldIdx_reserved1, ///< index of @b reserved1 field
+        FieldIdx_numOfValues ///< number of available fields
+    };
+
+    /// @brief Default constructor, creates empty view.
+    MonTxbufView() = default;
+
+    /// @brief Constructor
+    /// @param[in] payload Pointer to the payload of the message.
+    /// @param[in] len Length of the payload.
+    MonTxbufView(const std::uint8_t* payload, std::size_t len)
+      : Base(payload, len)
+    {
+    }
+
+    /// @brief Decode "pending" field (see @ref ublox::message::MonTxbufFields::pending).
+    comms::ErrorStatus field_pending(FieldType<FieldIdx_pending>& field) const
+    {
+        return Base::readField<FieldIdx_pending>(field);
+    }
+
+    /// @brief Decode "usage" field (see @ref ublox::message::MonTxbufFields::usage).
+    comms::ErrorStatus field_usage(FieldType<FieldIdx_usage>& field) const
+    {
+        return Base::readField<FieldIdx_usage>(field);
+    }
+
+    /// @brief Decode "peakUsage" field (see @ref ublox::message::MonTxbufFields::peakUsage).
+    comms::ErrorStatus field_peakUsage(FieldType<FieldIdx_peakUsage>& field) const
+    {
+        return Base::readField<FieldIdx_peakUsage>(field);
+    }
+
+    /// @brief Decode "tUsage" field (see @ref ublox::message::MonTxbufFields::tUsage).
+    comms::ErrorStatus field_tUsage(FieldType<FieldIdx_tUsage>& field) const
+    {
+        return Base::readField<FieldIdx_tUsage>(field);
+    }
+
+    /// @brief Decode "tPeakUsage" field (see @ref ublox::message::MonTxbufFields::tPeakUsage).
+    comms::ErrorStatus field_tPeakUsage(FieldType<FieldIdx_tPeakUsage>& field) const
+    {
+        return Base::readField<FieldIdx_tPeakUsage>(field);
+    }
+
+    /// @brief Decode "errors" field (see @ref ublox::message::MonTxbufFields::errors).
+    comms::ErrorStatus field_errors(FieldType<FieldIdx_errors>& field) const
+    {
+        return Base::readField<FieldIdx_errors>(field);
+    }
+
+    /// @brief Decode "reserved1" field (see @ref ublox::message::MonTxbufFields::reserved1).
+    comms::ErrorStatus field_reserved1(FieldType<FieldIdx_reserved1>& field) const
+    {
+        return Base::readField<FieldIdx_reserved1>(field);
+    }
+};
+
+} // namespace view
+
+} // namespace ublox
+
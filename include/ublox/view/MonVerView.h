@@ -0,0 +1,94 @@
+//
+// Copyright 2018 (C). Alex Robenko. All rights reserved.
+//
+
+// This file is free software: you can redistribute it and/or modify
+// it under the terms of the GNU General Public License as published by
+// the Free Software Foundation, either version 3 of the License, or
+// (at your option) any later version.
+//
+// This program is distributed in the hope that it will be useful,
+// but WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+// GNU General Public License for more details.
+//
+// You should have received a copy of the GNU General Public License
+// along with this program.  If not, see <http://www.gnu.org/licenses/>.
+
+/// @file
+/// @brief Contains definition of lazy view of MON-VER message.
+/// @details Generated by script/gen_views.py, do NOT edit manually.
+
+#pragma once
+
+#include "ublox/message/MonVer.h"
+#include "MsgView.h"
+
+namespace ublox
+{
+
+namespace view
+{
+
+/// @brief Lazy read-only view of MON-VER message payload.
+/// @details Wraps the pointer to the validated payload, the fields are
+///     decoded on access only, see @ref MsgView.
+/// @see @ref ublox::message::MonVer
+class MonVerView : public
+    MsgView<
+        ublox::message::MonVerFields::All<comms::option::EmptyOption, comms::option::EmptyOption, comms::option::EmptyOption, comms::option::EmptyOption>
+    >
+{
+    using Base =
+        MsgView<
+            ublox::message::MonVerFields::All<comms::option::EmptyOption, comms::option::EmptyOption, comms::option::EmptyOption, comms::option::EmptyOption>
+        >;
+
+public:
+    /// @brief ID of the viewed message.
+    static const MsgId MsgIdValue = MsgId_MON_VER;
+
+    /// @brief Index of the fields, same as the ones defined by
+    ///     @b COMMS_MSG_FIELDS_ACCESS() in @ref ublox::message::MonVer.
+    enum FieldIdx
+    {
+        FieldIdx_swVersion, ///< index of @b swVersion field
+        FieldIdx_hwVersion, ///< index of @b hwVersion field
+        FieldIdx_extensions, ///< index of @b extensions field
+        FieldIdx_numOfValues ///< number of available fields
+    };
+
+    /// @brief Default constructor, creates empty view.
+    MonVerView() = default;
+
+    /// @brief Constructor
+    /// @param[in] payload Pointer to the payload of the message.
+    /// @param[in] len Length of the payload.
+    MonVerView(const std::uint8_t* payload, std::size_t len)
+      : Base(payload, len)
+    {
+    }
+
+    /// @brief Decode "swVersion" field (see @ref ublox::message::MonVerFields::swVersion).
+    comms::ErrorStatus field_swVersion(FieldType<FieldIdx_swVersion>& field) const
+    {
+        return Base::readField<FieldIdx_swVersion>(field);
+    }
+
+    /// @brief Decode "hwVersion" field (see @ref ublox::message::MonVerFields::hwVersion).
+    comms::ErrorStatus field_hwVersion(FieldType<FieldIdx_hwVersion>& field) const
+    {
+        return Base::readField<FieldIdx_hwVersion>(field);
+    }
+
+    /// @brief Decode "extensions" field (see @ref ublox::message::MonVerFields::extensions).
+    comms::ErrorStatus field_extensions(FieldType<FieldIdx_extensions>& field) const
+    {
+        return Base::readField<FieldIdx_extensions>(field);
+    }
+};
+
+} // namespace view
+
+} // namespace ublox
+
@@ -0,0 +1,274 @@
+//
+// Copyright 2018 (C). Alex Robenko. All rights reserved.
+//
+
+// This file is free software: you can redistribute it and/or modify
+// it under the terms of the GNU General Public License as published by
+// the Free Software Foundation, either version 3 of the License, or
+// (at your option) any later version.
+//
+// This program is distributed in the hope that it will be useful,
+// but WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+// GNU General Public License for more details.
+//
+// You should have received a copy of the GNU General Public License
+// along with this program.  If not, see <http://www.gnu.org/licenses/>.
+
+/// @file
+/// @brief Contains definition of ublox::view::MsgView class.
+
+#pragma once
+
+#include <cstdint>
+#include <cstddef>
+#include <tuple>
+#include <type_traits>
+
+#include "comms/comms.h"
+
+#include "ublox/MsgId.h"
+
+namespace ublox
+{
+
+/// @brief Lazy read-only views of the message payloads.
+/// @details Every view class is generated by script/gen_views.py out of the
+///     relevant message definition in ublox::message namespace.@n
+///     The views of the messages performing custom read, whose list of
+///     blocks (or other variable part) depends on the values of the preceding
+///     fields, stop at the variable part. For example @b RXM-RAWX view
+///     provides no access to the measurement blocks and @b NAV-SAT view
+///     provides no access to the list of satellites. Such fields are
+///     decoded by the message classes, the measurement blocks of
+///     @b RXM-RAWX can also be decoded using ublox::view::RxmRawxBatch.
+namespace view
+{
+
+namespace details
+{
+
+template <typename TField, bool TFixedLength>
+struct MsgViewFieldSkipHelper
+{
+    static comms::ErrorStatus skip(const std::uint8_t* payload, std::size_t len, std::size_t& offset)
+    {
+        static_cast<void>(payload);
+        if (len < (offset + TField::minLength())) {
+            return comms::ErrorStatus::NotEnoughData;
+        }
+
+        offset += TField::minLength();
+        return comms::ErrorStatus::Success;
+    }
+};
+
+template <typename TField>
+struct MsgViewFieldSkipHelper<TField, false>
+{
+    static comms::ErrorStatus skip(const std::uint8_t* payload, std::size_t len, std::size_t& offset)
+    {
+        TField field;
+        const std::uint8_t* iter = payload + offset;
+        auto es = field.read(iter, len - offset);
+        if (es != comms::ErrorStatus::Success) {
+            return es;
+        }
+
+        offset = static_cast<std::size_t>(iter - payload);
+        return comms::ErrorStatus::Success;
+    }
+};
+
+template <typename TField>
+using MsgViewFieldSkip =
+    MsgViewFieldSkipHelper<TField, TField::minLength() == TField::maxLength()>;
+
+template <typename TAllFields, std::size_t TIdx>
+struct MsgViewFieldOffset
+{
+    static comms::ErrorStatus calc(const std::uint8_t* payload, std::size_t len, std::size_t& offset)
+    {
+        auto es = MsgViewFieldOffset<TAllFields, TIdx - 1>::calc(payload, len, offset);
+        if (es != comms::ErrorStatus::Success) {
+            return es;
+        }
+
+        using Field = typename std::tuple_element<TIdx - 1, TAllFields>::type;
+        return MsgViewFieldSkip<Field>::skip(payload, len, offset);
+    }
+};
+
+template <typename TAllFields>
+struct MsgViewFieldOffset<TAllFields, 0U>
+{
+    static comms::ErrorStatus calc(const std::uint8_t* payload, std::size_t len, std::size_t& offset)
+    {
+        static_cast<void>(payload);
+        static_cast<void>(len);
+        offset = 0U;
+        return comms::ErrorStatus::Success;
+    }
+};
+
+// Total length of the present optional fields in [TFrom, TTo) range
+template <typename TAllFields, std::size_t TFrom, std::size_t TTo>
+struct MsgViewOptionalLength
+{
+    using Field = typename std::tuple_element<TFrom, TAllFields>::type;
+    static const std::size_t Value =
+        Field::Field::maxLength() + MsgViewOptionalLength<TAllFields, TFrom + 1U, TTo>::Value;
+};
+
+template <typename TAllFields, std::size_t TIdx>
+struct MsgViewOptionalLength<TAllFields, TIdx, TIdx>
+{
+    static const std::size_t Value = 0U;
+};
+
+} // namespace details
+
+/// @brief Base class of all the lazy message views.
+/// @details Wraps the pointer to the payload of the message (already
+///     validated by the framing, for example by ublox::protocol::FrameScanner),
+///     and decodes the requested field only when accessed. The offset
+///     of the field is calculated at compile time when all the preceding fields
+///     have fixed length, otherwise the preceding variable length fields are
+///     read to determine their length. The returned field objects are of the
+///     same type as the ones used by relevant message class, i.e. all the
+///     units retrieval functions from @b comms::units namespace are applicable.
+///     The read of the field fails with @b comms::ErrorStatus::NotEnoughData
+///     when the payload is too short to contain it, no default value is
+///     reported instead. The group of trailing optional fields, which are either
+///     all present or all missing depending on the payload length (for example
+///     @b headVeh, @b magDec and @b magAcc of @b NAV-PVT), is read using
+///     readTrailingOptionalField(), the field is reported as missing when the
+///     payload is too short to contain the whole group.@n
+///     Every generated view provides @b field_<name>() accessor for every
+///     accessible field. It receives the field object to read the value into
+///     and returns status of the read operation:
+///     @b comms::ErrorStatus::NotEnoughData in case the payload is too short
+///     to contain the field (or the fields preceding the trailing optional group).@n
+///     The view doesn't own the payload, it must remain valid as long as
+///     the view is used.
+/// @tparam TAllFields All the fields of the message bundled in @b std::tuple.
+template <typename TAllFields>
+class MsgView
+{
+public:
+    /// @brief All the fields of the message bundled in @b std::tuple.
+    using AllFields = TAllFields;
+
+    /// @brief Type of the field with specified index.
+    template <std::size_t TIdx>
+    using FieldType = typename std::tuple_element<TIdx, TAllFields>::type;
+
+    /// @brief Default constructor, creates empty view.
+    MsgView() = default;
+
+    /// @brief Constructor
+    /// @param[in] payload Pointer to the payload of the message.
+    /// @param[in] len Length of the payload.
+    MsgView(const std::uint8_t* payload, std::size_t len)
+      : m_payload(payload),
+        m_len(len)
+    {
+    }
+
+    /// @brief Pointer to the payload of the message.
+    const std::uint8_t* payload() const
+    {
+        return m_payload;
+    }
+
+    /// @brief Length of the payload of the message.
+    std::size_t length() const
+    {
+        return m_len;
+    }
+
+    /// @brief Check whether the view refers to any payload.
+    bool empty() const
+    {
+        return m_payload == nullptr;
+    }
+
+    /// @brief Decode the field with specified index.
+    /// @param[out] field Field object to read the value into.
+    /// @return Status of the read operation,
+    ///     @b comms::ErrorStatus::NotEnoughData in case the payload is
+    ///     too short to contain the field.
+    template <std::size_t TIdx>
+    comms::ErrorStatus readField(FieldType<TIdx>& field) const
+    {
+        static_assert(TIdx < std::tuple_size<TAllFields>::value, "Invalid field index");
+        if (m_payload == nullptr) {
+            return comms::ErrorStatus::NotEnoughData;
+        }
+
+        std::size_t offset = 0U;
+        auto es = details::MsgViewFieldOffset<TAllFields, TIdx>::calc(m_payload, m_len, offset);
+        if (es != comms::ErrorStatus::Success) {
+            return es;
+        }
+
+        const std::uint8_t* iter = m_payload + offset;
+        return field.read(iter, m_len - offset);
+    }
+
+    /// @brief Decode the optional field out of the trailing group.
+    /// @details The optional fields starting from the one with index
+    ///     @b TFirstIdx up to the last one are expected to be present only
+    ///     when the payload is long enough to contain all of them.
+    /// @param[out] field Optional field object to read the value into, its
+    ///     mode is updated to @b comms::field::OptionalMode::Exists or
+    ///     @b comms::field::OptionalMode::Missing.
+    /// @return Status of the read operation, @b comms::ErrorStatus::NotEnoughData
+    ///     in case the payload is too short to contain the fields preceding the group.
+    template <std::size_t TIdx, std::size_t TFirstIdx>
+    comms::ErrorStatus readTrailingOptionalField(FieldType<TIdx>& field) const
+    {
+        static const std::size_t NumOfFields = std::tuple_size<TAllFields>::value;
+        static_assert((TFirstIdx <= TIdx) && (TIdx < NumOfFields), "Invalid field index");
+        if (m_payload == nullptr) {
+            return comms::ErrorStatus::NotEnoughData;
+        }
+
+        std::size_t offset = 0U;
+        auto es = details::MsgViewFieldOffset<TAllFields, TFirstIdx>::calc(m_payload, m_len, offset);
+        if (es != comms::ErrorStatus::Success) {
+            return es;
+        }
+
+        static const std::size_t GroupLen =
+            details::MsgViewOptionalLength<TAllFields, TFirstIdx, NumOfFields>::Value;
+        if ((m_len - offset) < GroupLen) {
+            field.setMissing();
+            return comms::ErrorStatus::Success;
+        }
+
+        offset += details::MsgViewOptionalLength<TAllFields, TFirstIdx, TIdx>::Value;
+        const std::uint8_t* iter = m_payload + offset;
+        field.setExists();
+        return field.field().read(iter, m_len - offset);
+    }
+
+    /// @brief Check whether the payload is long enough to contain the field
+    ///     with specified index.
+    template <std::size_t TIdx>
+    bool hasField() const
+    {
+        FieldType<TIdx> fieldObj;
+        return readField<TIdx>(fieldObj) == comms::ErrorStatus::Success;
+    }
+
+private:
+    const std::uint8_t* m_payload = nullptr;
+    std::size_t m_len = 0U;
+};
+
+} // namespace view
+
+} // namespace ublox
+
+
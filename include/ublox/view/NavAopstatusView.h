@@ -0,0 +1,129 @@
+//
+// Copyright 2018 (C). Alex Robenko. All rights reserved.
+//
+
+// This file is free software: you can redistribute it and/or modify
+// it under the terms of the GNU General Public License as published by
+// the Free Software Foundation, either version 3 of the License, or
+// (at your option) any later version.
+//
+// This program is distributed in the hope that it will be useful,
+// but WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+// GNU General Public License for more details.
+//
+// You should have received a copy of the GNU General Public License
+// along with this program.  If not, see <http://www.gnu.org/licenses/>.
+
+/// @file
+/// @brief Contains definition of lazy view of NAV-AOPSTATUS message.
+/// @details Generated by script/gen_views.py, do NOT edit manually.
+
+#pragma once
+
+#include "ublox/message/NavAopstatus.h"
+#include "MsgView.h"
+
+namespace ublox
+{
+
+namespace view
+{
+
+/// @brief Lazy read-only view of NAV-AOPSTATUS message payload.
+/// @details Wraps the pointer to the validated payload, the fields are
+///     decoded on access only, see @ref MsgView.
+/// @see @ref ublox::message::NavAopstatus
+class NavAopstatusView : public
+    MsgView<
+        ublox::message::NavAopstatusFields::All
+    >
+{
+    using Base =
+        MsgView<
+            ublox::message::NavAopstatusFields::All
+        >;
+
+public:
+    /// @brief ID of the viewed message.
+    static const MsgId MsgIdValue = MsgId_NAV_AOPSTATUS;
+
+    /// @brief Index of the fields, same as the ones defined by
+    ///     @b COMMS_MSG_FIELDS_ACCESS() in @ref ublox::message::NavAopstatus.
+    enum FieldIdx
+    {
+        FieldIdx_iTOW, ///< index of @b iTOW field
+        FieldIdx_aopCfg, ///< index of @b aopCfg field
+        FieldIdx_status, ///< index of @b status field
+        FieldIdx_reserved0, ///< index of @b reserved0 field
+        FieldIdx_reserved1, ///< index of @b reserved1 field
+        FieldIdx_availGPS, ///< index of @b availGPS field
+        FieldIdx_reserved2, ///< index of @b reserved2 field
+        FieldIdx_reserved3, ///< index of @b reserved3 field
+        FieldIdx_numOfValues ///< number of available fields
+    };
+
+    /// @brief Default constructor, creates empty view.
+    NavAopstatusView() = default;
+
+    /// @brief Constructor
+    /// @param[in] payload Pointer to the payload of the message.
+    /// @param[in] len Length of the payload.
+    NavAopstatusView(const std::uint8_t* payload, std::size_t len)
+      : Base(payload, len)
+    {
+    }
+
+    /// @brief Decode "iTOW" field (see @ref ublox::message::NavAopstatusFields::iTOW).
+    comms::ErrorStatus field_iTOW(FieldType<FieldIdx_iTOW>& field) const
+    {
+        return Base::readField<FieldIdx_iTOW>(field);
+    }
+
+    /// @brief Decode "aopCfg" field (see @ref ublox::message::NavAopstatusFields::aopCfg).
+    comms::ErrorStatus field_aopCfg(FieldType<FieldIdx_aopCfg>& field) const
+    {
+        return Base::readField<FieldIdx_aopCfg>(field);
+    }
+
+    /// @brief Decode "status" field (see @ref ublox::message::NavAopstatusFields::status).
+    comms::ErrorStatus field_status(FieldType<FieldIdx_status>& field) const
+    {
+        return Base::readField<FieldIdx_status>(field);
+    }
+
+    /// @brief Decode "reserved0" field (see @ref ublox::message::NavAopstatusFields::reserved0).
+    comms::ErrorStatus field_reserved0(FieldType<FieldIdx_reserved0>& field) const
+    {
+        return Base::readField<FieldIdx_reserved0>(field);
+    }
+
+    /// @brief Decode "reserved1" field (see @ref ublox::message::NavAopstatusFields::reserved1).
+    comms::ErrorStatus field_reserved1(FieldType<FieldIdx_reserved1>& field) const
+    {
+        return Base::readField<FieldIdx_reserved1>(field);
+    }
+
+    /// @brief Decode "availGPS" field (see @ref ublox::message::NavAopstatusFields::availGPS).
+    comms::ErrorStatus field_availGPS(FieldType<FieldIdx_availGPS>& field) const
+    {
+        return Base::readField<FieldIdx_availGPS>(field);
+    }
+
+    /// @brief Decode "reserved2" field (see @ref ublox::message::NavAopstatusFields::reserved2).
+    comms::ErrorStatus field_reserved2(FieldType<FieldIdx_reserved2>& field) const
+    {
+        return Base::readField<FieldIdx_reserved2>(field);
+    }
+
+    /// @brief Decode "reserved3" field (see @ref ublox::message::NavAopstatusFields::reserved3).
+    comms::ErrorStatus field_reserved3(FieldType<FieldIdx_reserved3>& field) const
+    {
+        return Base::readField<FieldIdx_reserved3>(field);
+    }
+};
+
+} // namespace view
+
+} // namespace ublox
+
@@ -0,0 +1,136 @@
+//
+// Copyright 2018 (C). Alex Robenko. All rights reserved.
+//
+
+// This file is free software: you can redistribute it and/or modify
+// it under the terms of the GNU General Public License as published by
+// the Free Software Foundation, either version 3 of the License, or
+// (at your option) any later version.
+//
+// This program is distributed in the hope that it will be useful,
+// but WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+// GNU General Public License for more details.
+//
+// You should have received a copy of the GNU General Public License
+// along with this program.  If not, see <http://www.gnu.org/licenses/>.
+
+/// @file
+/// @brief Contains definition of lazy view of NAV-ATT message.
+/// @details Generated by script/gen_views.py, do NOT edit manually.
+
+#pragma once
+
+#include "ublox/message/NavAtt.h"
+#include "MsgView.h"
+
+namespace ublox
+{
+
+namespace view
+{
+
+/// @brief Lazy read-only view of NAV-ATT message payload.
+/// @details Wraps the pointer to the validated payload, the fields are
+///     decoded on access only, see @ref MsgView.
+/// @see @ref ublox::message::NavAtt
+class NavAttView : public
+    MsgView<
+        ublox::message::NavAttFields::All
+    >
+{
+    using Base =
+        MsgView<
+            ublox::message::NavAttFields::All
+        >;
+
+public:
+    /// @brief ID of the viewed message.
+    static const MsgId MsgIdValue = MsgId_NAV_ATT;
+
+    /// @brief Index of the fields, same as the ones defined by
+    ///     @b COMMS_MSG_FIELDS_ACCESS() in @ref ublox::message::NavAtt.
+    enum FieldIdx
+    {
+        FieldIdx_iTOW, ///< index of @b iTOW field
+        FieldIdx_version, ///< index of @b version field
+        FieldIdx_reserved1, ///< index of @b reserved1 field
+        FieldIdx_roll, ///< index of @b roll field
+        FieldIdx_pitch, ///< index of @b pitch field
+        FieldIdx_heading, ///< index of @b heading field
+        FieldIdx_accRoll, ///< index of @b accRoll field
+        FieldIdx_accPitch, ///< index of @b accPitch field
+        FieldIdx_accHeading, ///< index of @b accHeading field
+        FieldIdx_numOfValues ///< number of available fields
+    };
+
+    /// @brief Default constructor, creates empty view.
+    NavAttView() = default;
+
+    /// @brief Constructor
+    /// @param[in] payload Pointer to the payload of the message.
+    /// @param[in] len Length of the payload.
+    NavAttView(const std::uint8_t* payload, std::size_t len)
+      : Base(payload, len)
+    {
+    }
+
+    /// @brief Decode "iTOW" field (see @ref ublox::message::NavAttFields::iTOW).
+    comms::ErrorStatus field_iTOW(FieldType<FieldIdx_iTOW>& field) const
+    {
+        return Base::readField<FieldIdx_iTOW>(field);
+    }
+
+    /// @brief Decode "version" field (see @ref ublox::message::NavAttFields::version).
+    comms::ErrorStatus field_version(FieldType<FieldIdx_version>& field) const
+    {
+        return Base::readField<FieldIdx_version>(field);
+    }
+
+    /// @brief Decode "reserved1" field (see @ref ublox::message::NavAttFields::reserved1).
+    comms::ErrorStatus field_reserved1(FieldType<FieldIdx_reserved1>& field) const
+    {
+        return Base::readField<FieldIdx_reserved1>(field);
+    }
+
+    /// @brief Decode "roll" field (see @ref ublox::message::NavAttFields::roll).
+    comms::ErrorStatus field_roll(FieldType<FieldIdx_roll>& field) const
+    {
+        return Base::readField<FieldIdx_roll>(field);
+    }
+
+    /// @brief Decode "pitch" field (see @ref ublox::message::NavAttFields::pitch).
+    comms::ErrorStatus field_pitch(FieldType<FieldIdx_pitch>& field) const
+    {
+        return Base::readField<FieldIdx_pitch>(field);
+    }
+
+    /// @brief Decode "heading" field (see @ref ublox::message::NavAttFields::heading).
+    comms::ErrorStatus field_heading(FieldType<FieldIdx_heading>& field) const
+    {
+        return Base::readField<FieldIdx_heading>(field);
+    }
+
+    /// @brief Decode "accRoll" field (see @ref ublox::message::NavAttFields::accRoll).
+    comms::ErrorStatus field_accRoll(FieldType<FieldIdx_accRoll>& field) const
+    {
+        return Base::readField<FieldIdx_accRoll>(field);
+    }
+
+    /// @brief Decode "accPitch" field (see @ref ublox::message::NavAttFields::accPitch).
+    comms::ErrorStatus field_accPitch(FieldType<FieldIdx_accPitch>& field) const
+    {
+        return Base::readField<FieldIdx_accPitch>(field);
+    }
+
+    /// @brief Decode "accHeading" field (see @ref ublox::message::NavAttFields::accHeading).
+    comms::ErrorStatus field_accHeading(FieldType<FieldIdx_accHeading>& field) const
+    {
+        return Base::readField<FieldIdx_accHeading>(field);
+    }
+};
+
+} // namespace view
+
+} // namespace ublox
+
@@ -0,0 +1,108 @@
+//
+// Copyright 2018 (C). Alex Robenko. All rights reserved.
+//
+
+// This file is free software: you can redistribute it and/or modify
+// it under the terms of the GNU General Public License as published by
+// the Free Software Foundation, either version 3 of the License, or
+// (at your option) any later version.
+//
+// This program is distributed in the hope that it will be useful,
+// but WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+// GNU General Public License for more details.
+//
+// You should have received a copy of the GNU General Public License
+// along with this program.  If not, see <http://www.gnu.org/licenses/>.
+
+/// @file
+/// @brief Contains definition of lazy view of NAV-CLOCK message.
+/// @details Generated by script/gen_views.py, do NOT edit manually.
+
+#pragma once
+
+#include "ublox/message/NavClock.h"
+#include "MsgView.h"
+
+namespace ublox
+{
+
+namespace view
+{
+
+/// @brief Lazy read-only view of NAV-CLOCK message payload.
+/// @details Wraps the pointer to the validated payload, the fields are
+///     decoded on access only, see @ref MsgView.
+/// @see @ref ublox::message::NavClock
+class NavClockView : public
+    MsgView<
+        ublox::message::NavClockFields::All
+    >
+{
+    using Base =
+        MsgView<
+            ublox::message::NavClockFields::All
+        >;
+
+public:
+    /// @brief ID of the viewed message.
+    static const MsgId MsgIdValue = MsgId_NAV_CLOCK;
+
+    /// @brief Index of the fields, same as the ones defined by
+    ///     @b COMMS_MSG_FIELDS_ACCESS() in @ref ublox::message::NavClock.
+    enum FieldIdx
+    {
+        FieldIdx_iTOW, ///< index of @b iTOW field
+        FieldIdx_clkB, ///< index of @b clkB field
+        FieldIdx_clkD, ///< index of @b clkD field
+        FieldIdx_tAcc, ///< index of @b tAcc field
+        FieldIdx_fAcc, ///< index of @b fAcc field
+        FieldIdx_numOfValues ///< number of available fields
+    };
+
+    /// @brief Default constructor, creates empty view.
+    NavClockView() = default;
+
+    /// @brief Constructor
+    /// @param[in] payload Pointer to the payload of the message.
+    /// @param[in] len Length of the payload.
+    NavClockView(const std::uint8_t* payload, std::size_t len)
+      : Base(payload, len)
+    {
+    }
+
+    /// @brief Decode "iTOW" field (see @ref ublox::message::NavClockFields::iTOW).
+    comms::ErrorStatus field_iTOW(FieldType<FieldIdx_iTOW>& field) const
+    {
+        return Base::readField<FieldIdx_iTOW>(field);
+    }
+
+    /// @brief Decode "clkB" field (see @ref ublox::message::NavClockFields::clkB).
+    comms::ErrorStatus field_clkB(FieldType<FieldIdx_clkB>& field) const
+    {
+        return Base::readField<FieldIdx_clkB>(field);
+    }
+
+    /// @brief Decode "clkD" field (see @ref ublox::message::NavClockFields::clkD).
+    comms::ErrorStatus field_clkD(FieldType<FieldIdx_clkD>& field) const
+    {
+        return Base::readField<FieldIdx_clkD>(field);
+    }
+
+    /// @brief Decode "tAcc" field (see @ref ublox::message::NavClockFields::tAcc).
+    comms::ErrorStatus field_tAcc(FieldType<FieldIdx_tAcc>& field) const
+    {
+        return Base::readField<FieldIdx_tAcc>(field);
+    }
+
+    /// @brief Decode "fAcc" field (see @ref ublox::message::NavClockFields::fAcc).
+    comms::ErrorStatus field_fAcc(FieldType<FieldIdx_fAcc>& field) const
+    {
+        return Base::readField<FieldIdx_fAcc>(field);
+    }
+};
+
+} // namespace view
+
+} // namespace ublox
+
@@ -0,0 +1,126 @@
+//
+// Copyright 2018 (C). Alex Robenko. All rights reserved.
+//
+
+// This file is free software: you can redistribute it and/or modify
+// it under the terms of the GNU General Public License as published by
+// the Free Software Foundation, either version 3 of the License, or
+// (at your option) any later version.
+//
+// This program is distributed in the hope that it will be useful,
+// but WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+// GNU General Public License for more details.
+//
+// You should have received a copy of the GNU General Public License
+// along with this program.  If not, see <http://www.gnu.org/licenses/>.
+
+/// @file
+/// @brief Contains definition of lazy view of NAV-DGPS message.
+/// @details Generated by script/gen_views.py, do NOT edit manually.
+
+#pragma once
+
+#include "ublox/message/NavDgps.h"
+#include "MsgView.h"
+
+namespace ublox
+{
+
+namespace view
+{
+
+/// @brief Lazy read-only view of NAV-DGPS message payload.
+/// @details Wraps the pointer to the validated payload, the fields are
+///     decoded on access only, see @ref MsgView.
+///     The message performs custom read of its fields, the fields starting
+///     from "data" are not accessible through the view, because their
+///     presence and/or size depend on the values of preceding fields.
+/// @see @ref ublox::message::NavDgps
+class NavDgpsView : public
+    MsgView<
+        ublox::message::NavDgpsFields::All<comms::option::EmptyOption>
+    >
+{
+    using Base =
+        MsgView<
+            ublox::message::NavDgpsFields::All<comms::option::EmptyOption>
+        >;
+
+public:
+    /// @brief ID of the viewed message.
+    static const MsgId MsgIdValue = MsgId_NAV_DGPS;
+
+    /// @brief Index of the fields, same as the ones defined by
+    ///     @b COMMS_MSG_FIELDS_ACCESS() in @ref ublox::message::NavDgps.
+    enum FieldIdx
+    {
+        FieldIdx_iTOW, ///< index of @b iTOW field
+        FieldIdx_age, ///< index of @b age field
+        FieldIdx_baseId, ///< index of @b baseId field
+        FieldIdx_baseHealth, ///< index of @b baseHealth field
+        FieldIdx_numCh, ///< index of @b numCh field
+        FieldIdx_status, ///< index of @b status field
+        FieldIdx_reserved1, ///< index of @b reserved1 field
+        FieldIdx_data, ///< index of @b data field
+        FieldIdx_numOfValues ///< number of available fields
+    };
+
+    /// @brief Default constructor, creates empty view.
+    NavDgpsView() = default;
+
+    /// @brief Constructor
+    /// @param[in] payload Pointer to the payload of the message.
+    /// @param[in] len Length of the payload.
+    NavDgpsView(const std::uint8_t* payload, std::size_t len)
+      : Base(payload, len)
+    {
+    }
+
+    /// @brief Decode "iTOW" field (see @ref ublox::message::NavDgpsFields::iTOW).
+    comms::ErrorStatus field_iTOW(FieldType<FieldIdx_iTOW>& field) const
+    {
+        return Base::readField<FieldIdx_iTOW>(field);
+    }
+
+    /// @brief Decode "age" field (see @ref ublox::message::NavDgpsFields::age).
+    comms::ErrorStatus field_age(FieldType<FieldIdx_age>& field) const
+    {
+        return Base::readField<FieldIdx_age>(field);
+    }
+
+    /// @brief Decode "baseId" field (see @ref ublox::message::NavDgpsFields::baseId).
+    comms::ErrorStatus field_baseId(FieldType<FieldIdx_baseId>& field) const
+    {
+        return Base::readField<FieldIdx_baseId>(field);
+    }
+
+    /// @brief Decode "baseHealth" field (see @ref ublox::message::NavDgpsFields::baseHealth).
+    comms::ErrorStatus field_baseHealth(FieldType<FieldIdx_baseHealth>& field) const
+    {
+        return Base::readField<FieldIdx_baseHealth>(field);
+    }
+
+    /// @brief Decode "numCh" field (see @ref ublox::message::NavDgpsFields::numCh).
+    comms::ErrorStatus field_numCh(FieldType<FieldIdx_numCh>& field) const
+    {
+        return Base::readField<FieldIdx_numCh>(field);
+    }
+
+    /// @brief Decode "status" field (see @ref ublox::message::NavDgpsFields::status).
+    comms::ErrorStatus field_status(FieldType<FieldIdx_status>& field) const
+    {
+        return Base::readField<FieldIdx_status>(field);
+    }
+
+    /// @brief Decode "reserved1" field (see @ref ublox::message::NavDgpsFields::reserved1).
+    comms::ErrorStatus field_reserved1(FieldType<FieldIdx_reserved1>& field) const
+    {
+        return Base::readField<FieldIdx_reserved1>(field);
+    }
+};
+
+} // namespace view
+
+} // namespace ublox
+
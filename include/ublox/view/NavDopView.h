@@ -0,0 +1,129 @@
+//
+// Copyright 2018 (C). Alex Robenko. All rights reserved.
+//
+
+// This file is free software: you can redistribute it and/or modify
+// it under the terms of the GNU General Public License as published by
+// the Free Software Foundation, either version 3 of the License, or
+// (at your option) any later version.
+//
+// This program is distributed in the hope that it will be useful,
+// but WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+// GNU General Public License for more details.
+//
+// You should have received a copy of the GNU General Public License
+// along with this program.  If not, see <http://www.gnu.org/licenses/>.
+
+/// @file
+/// @brief Contains definition of lazy view of NAV-DOP message.
+/// @details Generated by script/gen_views.py, do NOT edit manually.
+
+#pragma once
+
+#include "ublox/message/NavDop.h"
+#include "MsgView.h"
+
+namespace ublox
+{
+
+namespace view
+{
+
+/// @brief Lazy read-only view of NAV-DOP message payload.
+/// @details Wraps the pointer to the validated payload, the fields are
+///     decoded on access only, see @ref MsgView.
+/// @see @ref ublox::message::NavDop
+class NavDopView : public
+    MsgView<
+        ublox::message::NavDopFields::All
+    >
+{
+    using Base =
+        MsgView<
+            ublox::message::NavDopFields::All
+        >;
+
+public:
+    /// @brief ID of the viewed message.
+    static const MsgId MsgIdValue = MsgId_NAV_DOP;
+
+    /// @brief Index of the fields, same as the ones defined by
+    ///     @b COMMS_MSG_FIELDS_ACCESS() in @ref ublox::message::NavDop.
+    enum FieldIdx
+    {
+        FieldIdx_iTOW, ///< index of @b iTOW field
+        FieldIdx_gDOP, ///< index of @b gDOP field
+        FieldIdx_pDOP, ///< index of @b pDOP field
+        FieldIdx_tDOP, ///< index of @b tDOP field
+        FieldIdx_vDOP, ///< index of @b vDOP field
+        FieldIdx_hDOP, ///< index of @b hDOP field
+        FieldIdx_nDOP, ///< index of @b nDOP field
+        FieldIdx_eDOP, ///< index of @b eDOP field
+        FieldIdx_numOfValues ///< number of available fields
+    };
+
+    /// @brief Default constructor, creates empty view.
+    NavDopView() = default;
+
+    /// @brief Constructor
+    /// @param[in] payload Pointer to the payload of the message.
+    /// @param[in] len Length of the payload.
+    NavDopView(const std::uint8_t* payload, std::size_t len)
+      : Base(payload, len)
+    {
+    }
+
+    /// @brief Decode "iTOW" field (see @ref ublox::message::NavDopFields::iTOW).
+    comms::ErrorStatus field_iTOW(FieldType<FieldIdx_iTOW>& field) const
+    {
+        return Base::readField<FieldIdx_iTOW>(field);
+    }
+
+    /// @brief Decode "gDOP" field (see @ref ublox::message::NavDopFields::gDOP).
+    comms::ErrorStatus field_gDOP(FieldType<FieldIdx_gDOP>& field) const
+    {
+        return Base::readField<FieldIdx_gDOP>(field);
+    }
+
+    /// @brief Decode "pDOP" field (see @ref ublox::message::NavDopFields::pDOP).
+    comms::ErrorStatus field_pDOP(FieldType<FieldIdx_pDOP>& field) const
+    {
+        return Base::readField<FieldIdx_pDOP>(field);
+    }
+
+    /// @brief Decode "tDOP" field (see @ref ublox::message::NavDopFields::tDOP).
+    comms::ErrorStatus field_tDOP(FieldType<FieldIdx_tDOP>& field) const
+    {
+        return Base::readField<FieldIdx_tDOP>(field);
+    }
+
+    /// @brief Decode "vDOP" field (see @ref ublox::message::NavDopFields::vDOP).
+    comms::ErrorStatus field_vDOP(FieldType<FieldIdx_vDOP>& field) const
+    {
+        return Base::readField<FieldIdx_vDOP>(field);
+    }
+
+    /// @brief Decode "hDOP" field (see @ref ublox::message::NavDopFields::hDOP).
+    comms::ErrorStatus field_hDOP(FieldType<FieldIdx_hDOP>& field) const
+    {
+        return Base::readField<FieldIdx_hDOP>(field);
+    }
+
+    /// @brief Decode "nDOP" field (see @ref ublox::message::NavDopFields::nDOP).
+    comms::ErrorStatus field_nDOP(FieldType<FieldIdx_nDOP>& field) const
+    {
+        return Base::readField<FieldIdx_nDOP>(field);
+    }
+
+    /// @brief Decode "eDOP" field (see @ref ublox::message::NavDopFields::eDOP).
+    comms::ErrorStatus field_eDOP(FieldType<FieldIdx_eDOP>& field) const
+    {
+        return Base::readField<FieldIdx_eDOP>(field);
+    }
+};
+
+} // namespace view
+
+} // namespace ublox
+
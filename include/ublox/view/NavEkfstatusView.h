@@ -0,0 +1,171 @@
+//
+// Copyright 2018 (C). Alex Robenko. All rights reserved.
+//
+
+// This file is free software: you can redistribute it and/or modify
+// it under the terms of the GNU General Public License as published by
+// the Free Software Foundation, either version 3 of the License, or
+// (at your option) any later version.
+//
+// This program is distributed in the hope that it will be useful,
+// but WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+// GNU General Public License for more details.
+//
+// You should have received a copy of the GNU General Public License
+// along with this program.  If not, see <http://www.gnu.org/licenses/>.
+
+/// @file
+/// @brief Contains definition of lazy view of NAV-EKFSTATUS message.
+/// @details Generated by script/gen_views.py, do NOT edit manually.
+
+#pragma once
+
+#include "ublox/message/NavEkfstatus.h"
+#include "MsgView.h"
+
+namespace ublox
+{
+
+namespace view
+{
+
+/// @brief Lazy read-only view of NAV-EKFSTATUS message payload.
+/// @details Wraps the pointer to the validated payload, the fields are
+///     decoded on access only, see @ref MsgView.
+/// @see @ref ublox::message::NavEkfstatus
+class NavEkfstatusView : public
+    MsgView<
+        ublox::message::NavEkfstatusFields::All
+    >
+{
+    using Base =
+        MsgView<
+            ublox::message::NavEkfstatusFields::All
+        >;
+
+public:
+    /// @brief ID of the viewed message.
+    static const MsgId MsgIdValue = MsgId_NAV_EKFSTATUS;
+
+    /// @brief Index of the fields, same as the ones defined by
+    ///     @b COMMS_MSG_FIELDS_ACCESS() in @ref ublox::message::NavEkfstatus.
+    enum FieldIdx
+    {
+        FieldIdx_pulses, ///< index of @b pulses field
+        FieldIdx_period, ///< index of @b period field
+        FieldIdx_gyroMean, ///< index of @b gyroMean field
+        FieldIdx_temperature, ///< index of @b temperature field
+        FieldIdx_direction, ///< index of @b direction field
+        FieldIdx_calibStatus, ///< index of @b calibStatus field
+        FieldIdx_pulseScale, ///< index of @b pulseScale field
+        FieldIdx_gyroBias, ///< index of @b gyroBias field
+        FieldIdx_gyroScale, ///< index of @b gyroScale field
+        FieldIdx_accPulseScale, ///< index of @b accPulseScale field
+        FieldIdx_accGyroBias, ///< index of @b accGyroBias field
+        FieldIdx_accGyroScale, ///< index of @b accGyroScale field
+        FieldIdx_measUsed, ///< index of @b measUsed field
+        FieldIdx_reserved2, ///< index of @b reserved2 field
+        FieldIdx_numOfValues ///< number of available fields
+    };
+
+    /// @brief Default constructor, creates empty view.
+    NavEkfstatusView() = default;
+
+    /// @brief Constructor
+    /// @param[in] payload Pointer to the payload of the message.
+    /// @param[in] len Length of the payload.
+    NavEkfstatusView(const std::uint8_t* payload, std::size_t len)
+      : Base(payload, len)
+    {
+    }
+
+    /// @brief Decode "pulses" field (see @ref ublox::message::NavEkfstatusFields::pulses).
+    comms::ErrorStatus field_pulses(FieldType<FieldIdx_pulses>& field) const
+    {
+        return Base::readField<FieldIdx_pulses>(field);
+    }
+
+    /// @brief Decode "period" field (see @ref ublox::message::NavEkfstatusFields::period).
+    comms::ErrorStatus field_period(FieldType<FieldIdx_period>& field) const
+    {
+        return Base::readField<FieldIdx_period>(field);
+    }
+
+    /// @brief Decode "gyroMean" field (see @ref ublox::message::NavEkfstatusFields::gyroMean).
+    comms::ErrorStatus field_gyroMean(FieldType<FieldIdx_gyroMean>& field) const
+    {
+        return Base::readField<FieldIdx_gyroMean>(field);
+    }
+
+    /// @brief Decode "temperature" field (see @ref ublox::message::NavEkfstatusFields::temperature).
+    comms::ErrorStatus field_temperature(FieldType<FieldIdx_temperature>& field) const
+    {
+        return Base::readField<FieldIdx_temperature>(field);
+    }
+
+    /// @brief Decode "direction" field (see @ref ublox::message::NavEkfstatusFields::direction).
+    comms::ErrorStatus field_direction(FieldType<FieldIdx_direction>& field) const
+    {
+        return Base::readField<FieldIdx_direction>(field);
+    }
+
+    /// @brief Decode "calibStatus" field (see @ref ublox::message::NavEkfstatusFields::calibStatus).
+    comms::ErrorStatus field_calibStatus(FieldType<FieldIdx_calibStatus>& field) const
+    {
+        return Base::readField<FieldIdx_calibStatus>(field);
+    }
+
+    /// @brief Decode "pulseScale" field (see @ref ublox::message::NavEkfstatusFields::pulseScale).
+    comms::ErrorStatus field_pulseScale(FieldType<FieldIdx_pulseScale>& field) const
+    {
+        return Base::readField<FieldIdx_pulseScale>(field);
+    }
+
+    /// @brief Decode "gyroBias" field (see @ref ublox::message::NavEkfstatusFields::gyroBias).
+    comms::ErrorStatus field_gyroBias(FieldType<FieldIdx_gyroBias>& field) const
+    {
+        return Base::readField<FieldIdx_gyroBias>(field);
+    }
+
+    /// @brief Decode "gyroScale" field (see @ref ublox::message::NavEkfstatusFields::gyroScale).
+    comms::ErrorStatus field_gyroScale(FieldType<FieldIdx_gyroScale>& field) const
+    {
+        return Base::readField<FieldIdx_gyroScale>(field);
+    }
+
+    /// @brief Decode "accPulseScale" field (see @ref ublox::message::NavEkfstatusFields::accPulseScale).
+    comms::ErrorStatus field_accPulseScale(FieldType<FieldIdx_accPulseScale>& field) const
+    {
+        return Base::readField<FieldIdx_accPulseScale>(field);
+    }
+
+    /// @brief Decode "accGyroBias" field (see @ref ublox::message::NavEkfstatusFields::accGyroBias).
+    comms::ErrorStatus field_accGyroBias(FieldType<FieldIdx_accGyroBias>& field) const
+    {
+        return Base::readField<FieldIdx_accGyroBias>(field);
+    }
+
+    /// @brief Decode "accGyroScale" field (see @ref ublox::message::NavEkfstatusFields::accGyroScale).
+    comms::ErrorStatus field_accGyroScale(FieldType<FieldIdx_accGyroScale>& field) const
+    {
+        return Base::readField<FieldIdx_accGyroScale>(field);
+    }
+
+    /// @brief Decode "measUsed" field (see @ref ublox::message::NavEkfstatusFields::measUsed).
+    comms::ErrorStatus field_measUsed(FieldType<FieldIdx_measUsed>& field) const
+    {
+        return Base::readField<FieldIdx_measUsed>(field);
+    }
+
+    /// @brief Decode "reserved2" field (see @ref ublox::message::NavEkfstatusFields::reserved2).
+    comms::ErrorStatus field_reserved2(FieldType<FieldIdx_reserved2>& field) const
+    {
+        return Base::readField<FieldIdx_reserved2>(field);
+    }
+};
+
+} // namespace view
+
+} // namespace ublox
+
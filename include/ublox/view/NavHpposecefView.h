@@ -0,0 +1,150 @@
+//
+// Copyright 2018 (C). Alex Robenko. All rights reserved.
+//
+
+// This file is free software: you can redistribute it and/or modify
+// it under the terms of the GNU General Public License as published by
+// the Free Software Foundation, either version 3 of the License, or
+// (at your option) any later version.
+//
+// This program is distributed in the hope that it will be useful,
+// but WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+// GNU General Public License for more details.
+//
+// You should have received a copy of the GNU General Public License
+// along with this program.  If not, see <http://www.gnu.org/licenses/>.
+
+/// @file
+/// @brief Contains definition of lazy view of NAV-HPPOSECEF message.
+/// @details Generated by script/gen_views.py, do NOT edit manually.
+
+#pragma once
+
+#include "ublox/message/NavHpposecef.h"
+#include "MsgView.h"
+
+namespace ublox
+{
+
+namespace view
+{
+
+/// @brief Lazy read-only view of NAV-HPPOSECEF message payload.
+/// @details Wraps the pointer to the validated payload, the fields are
+///     decoded on access only, see @ref MsgView.
+/// @see @ref ublox::message::NavHpposecef
+class NavHpposecefView : public
+    MsgView<
+        ublox::message::NavHpposecefFields::All
+    >
+{
+    using Base =
+        MsgView<
+            ublox::message::NavHpposecefFields::All
+        >;
+
+public:
+    /// @brief ID of the viewed message.
+    static const MsgId MsgIdValue = MsgId_NAV_HPPOSECEF;
+
+    /// @brief Index of the fields, same as the ones defined by
+    ///     @b COMMS_MSG_FIELDS_ACCESS() in @ref ublox::message::NavHpposecef.
+    enum FieldIdx
+    {
+        FieldIdx_version, ///< index of @b version field
+        FieldIdx_reserved1, ///< index of @b reserved1 field
+        FieldIdx_iTOW, ///< index of @b iTOW field
+        FieldIdx_ecefX, ///< index of @b ecefX field
+        FieldIdx_ecefY, ///< index of @b ecefY field
+        FieldIdx_ecefZ, ///< index of @b ecefZ field
+        FieldIdx_ecefXHp, ///< index of @b ecefXHp field
+        FieldIdx_ecefYHp, ///< index of @b ecefYHp field
+        FieldIdx_ecefZHp, ///< index of @b ecefZHp field
+        FieldIdx_reserved2, ///< index of @b reserved2 field
+        FieldIdx_pAcc, ///< index of @b pAcc field
+        FieldIdx_numOfValues ///< number of available fields
+    };
+
+    /// @brief Default constructor, creates empty view.
+    NavHpposecefView() = default;
+
+    /// @brief Constructor
+    /// @param[in] payload Pointer to the payload of the message.
+    /// @param[in] len Length of the payload.
+    NavHpposecefView(const std::uint8_t* payload, std::size_t len)
+      : Base(payload, len)
+    {
+    }
+
+    /// @brief Decode "version" field (see @ref ublox::message::NavHpposecefFields::version).
+    comms::ErrorStatus field_version(FieldType<FieldIdx_version>& field) const
+    {
+        return Base::readField<FieldIdx_version>(field);
+    }
+
+    /// @brief Decode "reserved1" field (see @ref ublox::message::NavHpposecefFields::reserved1).
+    comms::ErrorStatus field_reserved1(FieldType<FieldIdx_reserved1>& field) const
+    {
+        return Base::readField<FieldIdx_reserved1>(field);
+    }
+
+    /// @brief Decode "iTOW" field (see @ref ublox::message::NavHpposecefFields::iTOW).
+    comms::ErrorStatus field_iTOW(FieldType<FieldIdx_iTOW>& field) const
+    {
+        return Base::readField<FieldIdx_iTOW>(field);
+    }
+
+    /// @brief Decode "ecefX" field (see @ref ublox::message::NavHpposecefFields::ecefX).
+    comms::ErrorStatus field_ecefX(FieldType<FieldIdx_ecefX>& field) const
+    {
+        return Base::readField<FieldIdx_ecefX>(field);
+    }
+
+    /// @brief Decode "ecefY" field (see @ref ublox::message::NavHpposecefFields::ecefY).
+    comms::ErrorStatus field_ecefY(FieldType<FieldIdx_ecefY>& field) const
+    {
+        return Base::readField<FieldIdx_ecefY>(field);
+    }
+
+    /// @brief Decode "ecefZ" field (see @ref ublox::message::NavHpposecefFields::ecefZ).
+    comms::ErrorStatus field_ecefZ(FieldType<FieldIdx_ecefZ>& field) const
+    {
+        return Base::readField<FieldIdx_ecefZ>(field);
+    }
+
+    /// @brief Decode "ecefXHp" field (see @ref ublox::message::NavHpposecefFields::ecefXHp).
+    comms::ErrorStatus field_ecefXHp(FieldType<FieldIdx_ecefXHp>& field) const
+    {
+        return Base::readField<FieldIdx_ecefXHp>(field);
+    }
+
+    /// @brief Decode "ecefYHp" field (see @ref ublox::message::NavHpposecefFields::ecefYHp).
+    comms::ErrorStatus field_ecefYHp(FieldType<FieldIdx_ecefYHp>& field) const
+    {
+        return Base::readField<FieldIdx_ecefYHp>(field);
+    }
+
+    /// @brief Decode "ecefZHp" field (see @ref ublox::message::NavHpposecefFields::ecefZHp).
+    comms::ErrorStatus field_ecefZHp(FieldType<FieldIdx_ecefZHp>& field) const
+    {
+        return Base::readField<FieldIdx_ecefZHp>(field);
+    }
+
+    /// @brief Decode "reserved2" field (see @ref ublox::message::NavHpposecefFields::reserved2).
+    comms::ErrorStatus field_reserved2(FieldType<FieldIdx_reserved2>& field) const
+    {
+        return Base::readField<FieldIdx_reserved2>(field);
+    }
+
+    /// @brief Decode "pAcc" field (see @ref ublox::message::NavHpposecefFields::pAcc).
+    comms::ErrorStatus field_pAcc(FieldType<FieldIdx_pAcc>& field) const
+    {
+        return Base::readField<FieldIdx_pAcc>(field);
+    }
+};
+
+} // namespace view
+
+} // namespace ublox
+
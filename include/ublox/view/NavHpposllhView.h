@@ -0,0 +1,164 @@
+//
+// Copyright 2018 (C). Alex Robenko. All rights reserved.
+//
+
+// This file is free software: you can redistribute it and/or modify
+// it under the terms of the GNU General Public License as published by
+// the Free Software Foundation, either version 3 of the License, or
+// (at your option) any later version.
+//
+// This program is distributed in the hope that it will be useful,
+// but WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+// GNU General Public License for more details.
+//
+// You should have received a copy of the GNU General Public License
+// along with this program.  If not, see <http://www.gnu.org/licenses/>.
+
+/// @file
+/// @brief Contains definition of lazy view of NAV-HPPOSLLH message.
+/// @details Generated by script/gen_views.py, do NOT edit manually.
+
+#pragma once
+
+#include "ublox/message/NavHpposllh.h"
+#include "MsgView.h"
+
+namespace ublox
+{
+
+namespace view
+{
+
+/// @brief Lazy read-only view of NAV-HPPOSLLH message payload.
+/// @details Wraps the pointer to the validated payload, the fields are
+///     decoded on access only, see @ref MsgView.
+/// @see @ref ublox::message::NavHpposllh
+class NavHpposllhView : public
+    MsgView<
+        ublox::message::NavHpposllhFields::All
+    >
+{
+    using Base =
+        MsgView<
+            ublox::message::NavHpposllhFields::All
+        >;
+
+public:
+    /// @brief ID of the viewed message.
+    static const MsgId MsgIdValue = MsgId_NAV_HPPOSLLH;
+
+    /// @brief Index of the fields, same as the ones defined by
+    ///     @b COMMS_MSG_FIELDS_ACCESS() in @ref ublox::message::NavHpposllh.
+    enum FieldIdx
+    {
+        FieldIdx_version, ///< index of @b version field
+        FieldIdx_reserved1, ///< index of @b reserved1 field
+        FieldIdx_iTOW, ///< index of @b iTOW field
+        FieldIdx_lon, ///< index of @b lon field
+        FieldIdx_lat, ///< index of @b lat field
+        FieldIdx_height, ///< index of @b height field
+        FieldIdx_hMSL, ///< index of @b hMSL field
+        FieldIdx_lonHp, ///< index of @b lonHp field
+        FieldIdx_latHp, ///< index of @b latHp field
+        FieldIdx_heightHp, ///< index of @b heightHp field
+        FieldIdx_hMSLHp, ///< index of @b hMSLHp field
+        FieldIdx_hAcc, ///< index of @b hAcc field
+        FieldIdx_vAcc, ///< index of @b vAcc field
+        FieldIdx_numOfValues ///< number of available fields
+    };
+
+    /// @brief Default constructor, creates empty view.
+    NavHpposllhView() = default;
+
+    /// @brief Constructor
+    /// @param[in] payload Pointer to the payload of the message.
+    /// @param[in] len Length of the payload.
+    NavHpposllhView(const std::uint8_t* payload, std::size_t len)
+      : Base(payload, len)
+    {
+    }
+
+    /// @brief Decode "version" field (see @ref ublox::message::NavHpposllhFields::version).
+    comms::ErrorStatus field_version(FieldType<FieldIdx_version>& field) const
+    {
+        return Base::readField<FieldIdx_version>(field);
+    }
+
+    /// @brief Decode "reserved1" field (see @ref ublox::message::NavHpposllhFields::reserved1).
+    comms::ErrorStatus field_reserved1(FieldType<FieldIdx_reserved1>& field) const
+    {
+        return Base::readField<FieldIdx_reserved1>(field);
+    }
+
+    /// @brief Decode "iTOW" field (see @ref ublox::message::NavHpposllhFields::iTOW).
+    comms::ErrorStatus field_iTOW(FieldType<FieldIdx_iTOW>& field) const
+    {
+        return Base::readField<FieldIdx_iTOW>(field);
+    }
+
+    /// @brief Decode "lon" field (see @ref ublox::message::NavHpposllhFields::lon).
+    comms::ErrorStatus field_lon(FieldType<FieldIdx_lon>& field) const
+    {
+        return Base::readField<FieldIdx_lon>(field);
+    }
+
+    /// @brief Decode "lat" field (see @ref ublox::message::NavHpposllhFields::lat).
+    comms::ErrorStatus field_lat(FieldType<FieldIdx_lat>& field) const
+    {
+        return Base::readField<FieldIdx_lat>(field);
+    }
+
+    /// @brief Decode "height" field (see @ref ublox::message::NavHpposllhFields::height).
+    comms::ErrorStatus field_height(FieldType<FieldIdx_height>& field) const
+    {
+        return Base::readField<FieldIdx_height>(field);
+    }
+
+    /// @brief Decode "hMSL" field (see @ref ublox::message::NavHpposllhFields::hMSL).
+    comms::ErrorStatus field_hMSL(FieldType<FieldIdx_hMSL>& field) const
+    {
+        return Base::readField<FieldIdx_hMSL>(field);
+    }
+
+    /// @brief Decode "lonHp" field (see @ref ublox::message::NavHpposllhFields::lonHp).
+    comms::ErrorStatus field_lonHp(FieldType<FieldIdx_lonHp>& field) const
+    {
+        return Base::readField<FieldIdx_lonHp>(field);
+    }
+
+    /// @brief Decode "latHp" field (see @ref ublox::message::NavHpposllhFields::latHp).
+    comms::ErrorStatus field_latHp(FieldType<FieldIdx_latHp>& field) const
+    {
+        return Base::readField<FieldIdx_latHp>(field);
+    }
+
+    /// @brief Decode "heightHp" field (see @ref ublox::message::NavHpposllhFields::heightHp).
+    comms::ErrorStatus field_heightHp(FieldType<FieldIdx_heightHp>& field) const
+    {
+        return Base::readField<FieldIdx_heightHp>(field);
+    }
+
+    /// @brief Decode "hMSLHp" field (see @ref ublox::message::NavHpposllhFields::hMSLHp).
+    comms::ErrorStatus field_hMSLHp(FieldType<FieldIdx_hMSLHp>& field) const
+    {
+        return Base::readField<FieldIdx_hMSLHp>(field);
+    }
+
+    /// @brief Decode "hAcc" field (see @ref ublox::message::NavHpposllhFields::hAcc).
+    comms::ErrorStatus field_hAcc(FieldType<FieldIdx_hAcc>& field) const
+    {
+        return Base::readField<FieldIdx_hAcc>(field);
+    }
+
+    /// @brief Decode "vAcc" field (see @ref ublox::message::NavHpposllhFields::vAcc).
+    comms::ErrorStatus field_vAcc(FieldType<FieldIdx_vAcc>& field) const
+    {
+        return Base::readField<FieldIdx_vAcc>(field);
+    }
+};
+
+} // namespace view
+
+} // namespace ublox
+
@@ -0,0 +1,115 @@
+//
+// Copyright 2018 (C). Alex Robenko. All rights reserved.
+//
+
+// This file is free software: you can redistribute it and/or modify
+// it under the terms of the GNU General Public License as published by
+// the Free Software Foundation, either version 3 of the License, or
+// (at your option) any later version.
+//
+// This program is distributed in the hope that it will be useful,
+// but WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+// GNU General Public License for more details.
+//
+// You should have received a copy of the GNU General Public License
+// along with this program.  If not, see <http://www.gnu.org/licenses/>.
+
+/// @file
+/// @brief Contains definition of lazy view of NAV-ODO message.
+/// @details Generated by script/gen_views.py, do NOT edit manually.
+
+#pragma once
+
+#include "ublox/message/NavOdo.h"
+#include "MsgView.h"
+
+namespace ublox
+{
+
+namespace view
+{
+
+/// @brief Lazy read-only view of NAV-ODO message payload.
+/// @details Wraps the pointer to the validated payload, the fields are
+///     decoded on access only, see @ref MsgView.
+/// @see @ref ublox::message::NavOdo
+class NavOdoView : public
+    MsgView<
+        ublox::message::NavOdoFields::All
+    >
+{
+    using Base =
+        MsgView<
+            ublox::message::NavOdoFields::All
+        >;
+
+public:
+    /// @brief ID of the viewed message.
+    static const MsgId MsgIdValue = MsgId_NAV_ODO;
+
+    /// @brief Index of the fields, same as the ones defined by
+    ///     @b COMMS_MSG_FIELDS_ACCESS() in @ref ublox::message::NavOdo.
+    enum FieldIdx
+    {
+        FieldIdx_version, ///< index of @b version field
+        FieldIdx_reserved1, ///< index of @b reserved1 field
+        FieldIdx_iTOW, ///< index of @b iTOW field
+        FieldIdx_distance, ///< index of @b distance field
+        FieldIdx_totalDistance, ///< index of @b totalDistance field
+        FieldIdx_distanceStd, ///< index of @b distanceStd field
+        FieldIdx_numOfValues ///< number of available fields
+    };
+
+    /// @brief Default constructor, creates empty view.
+    NavOdoView() = default;
+
+    /// @brief Constructor
+    /// @param[in] payload Pointer to the payload of the message.
+    /// @param[in] len Length of the payload.
+    NavOdoView(const std::uint8_t* payload, std::size_t len)
+      : Base(payload, len)
+    {
+    }
+
+    /// @brief Decode "version" field (see @ref ublox::message::NavOdoFields::version).
+    comms::ErrorStatus field_version(FieldType<FieldIdx_version>& field) const
+    {
+        return Base::readField<FieldIdx_version>(field);
+    }
+
+    /// @brief Decode "reserved1" field (see @ref ublox::message::NavOdoFields::reserved1).
+    comms::ErrorStatus field_reserved1(FieldType<FieldIdx_reserved1>& field) const
+    {
+        return Base::readField<FieldIdx_reserved1>(field);
+    }
+
+    /// @brief Decode "iTOW" field (see @ref ublox::message::NavOdoFields::iTOW).
+    comms::ErrorStatus field_iTOW(FieldType<FieldIdx_iTOW>& field) const
+    {
+        return Base::readField<FieldIdx_iTOW>(field);
+    }
+
+    /// @brief Decode "distance" field (see @ref ublox::message::NavOdoFields::distance).
+    comms::ErrorStatus field_distance(FieldType<FieldIdx_distance>& field) const
+    {
+        return Base::readField<FieldIdx_distance>(field);
+    }
+
+    /// @brief Decode "totalDistance" field (see @ref ublox::message::NavOdoFields::totalDistance).
+    comms::ErrorStatus field_totalDistance(FieldType<FieldIdx_totalDistance>& field) const
+    {
+        return Base::readField<FieldIdx_totalDistance>(field);
+    }
+
+    /// @brief Decode "distanceStd" field (see @ref ublox::message::NavOdoFields::distanceStd).
+    comms::ErrorStatus field_distanceStd(FieldType<FieldIdx_distanceStd>& field) const
+    {
+        return Base::readField<FieldIdx_distanceStd>(field);
+    }
+};
+
+} // namespace view
+
+} // namespace ublox
+
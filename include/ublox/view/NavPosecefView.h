@@ -0,0 +1,108 @@
+//
+// Copyright 2018 (C). Alex Robenko. All rights reserved.
+//
+
+// This file is free software: you can redistribute it and/or modify
+// it under the terms of the GNU General Public License as published by
+// the Free Software Foundation, either version 3 of the License, or
+// (at your option) any later version.
+//
+// This program is distributed in the hope that it will be useful,
+// but WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+// GNU General Public License for more details.
+//
+// You should have received a copy of the GNU General Public License
+// along with this program.  If not, see <http://www.gnu.org/licenses/>.
+
+/// @file
+/// @brief Contains definition of lazy view of NAV-POSECEF message.
+/// @details Generated by script/gen_views.py, do NOT edit manually.
+
+#pragma once
+
+#include "ublox/message/NavPosecef.h"
+#include "MsgView.h"
+
+namespace ublox
+{
+
+namespace view
+{
+
+/// @brief Lazy read-only view of NAV-POSECEF message payload.
+/// @details Wraps the pointer to the validated payload, the fields are
+///     decoded on access only, see @ref MsgView.
+/// @see @ref ublox::message::NavPosecef
+class NavPosecefView : public
+    MsgView<
+        ublox::message::NavPosecefFields::All
+    >
+{
+    using Base =
+        MsgView<
+            ublox::message::NavPosecefFields::All
+        >;
+
+public:
+    /// @brief ID of the viewed message.
+    static const MsgId MsgIdValue = MsgId_NAV_POSECEF;
+
+    /// @brief Index of the fields, same as the ones defined by
+    ///     @b COMMS_MSG_FIELDS_ACCESS() in @ref ublox::message::NavPosecef.
+    enum FieldIdx
+    {
+        FieldIdx_iTOW, ///< index of @b iTOW field
+        FieldIdx_ecefX, ///< index of @b ecefX field
+        FieldIdx_ecefY, ///< index of @b ecefY field
+        FieldIdx_ecefZ, ///< index of @b ecefZ field
+        FieldIdx_pAcc, ///< index of @b pAcc field
+        FieldIdx_numOfValues ///< number of available fields
+    };
+
+    /// @brief Default constructor, creates empty view.
+    NavPosecefView() = default;
+
+    /// @brief Constructor
+    /// @param[in] payload Pointer to the payload of the message.
+    /// @param[in] len Length of the payload.
+    NavPosecefView(const std::uint8_t* payload, std::size_t len)
+      : Base(payload, len)
+    {
+    }
+
+    /// @brief Decode "iTOW" field (see @ref ublox::message::NavPosecefFields::iTOW).
+    comms::ErrorStatus field_iTOW(FieldType<FieldIdx_iTOW>& field) const
+    {
+        return Base::readField<FieldIdx_iTOW>(field);
+    }
+
+    /// @brief Decode "ecefX" field (see @ref ublox::message::NavPosecefFields::ecefX).
+    comms::ErrorStatus field_ecefX(FieldType<FieldIdx_ecefX>& field) const
+    {
+        return Base::readField<FieldIdx_ecefX>(field);
+    }
+
+    /// @brief Decode "ecefY" field (see @ref ublox::message::NavPosecefFields::ecefY).
+    comms::ErrorStatus field_ecefY(FieldType<FieldIdx_ecefY>& field) const
+    {
+        return Base::readField<FieldIdx_ecefY>(field);
+    }
+
+    /// @brief Decode "ecefZ" field (see @ref ublox::message::NavPosecefFields::ecefZ).
+    comms::ErrorStatus field_ecefZ(FieldType<FieldIdx_ecefZ>& field) const
+    {
+        return Base::readField<FieldIdx_ecefZ>(field);
+    }
+
+    /// @brief Decode "pAcc" field (see @ref ublox::message::NavPosecefFields::pAcc).
+    comms::ErrorStatus field_pAcc(FieldType<FieldIdx_pAcc>& field) const
+    {
+        return Base::readField<FieldIdx_pAcc>(field);
+    }
+};
+
+} // namespace view
+
+} // namespace ublox
+
@@ -0,0 +1,315 @@
+//
+// Copyright 2018 (C). Alex Robenko. All rights reserved.
+//
+
+// This file is free software: you can redistribute it and/or modify
+// it under the terms of the GNU General Public License as published by
+// the Free Software Foundation, either version 3 of the License, or
+// (at your option) any later version.
+//
+// This program is distributed in the hope that it will be useful,
+// but WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+// GNU General Public License for more details.
+//
+// You should have received a copy of the GNU General Public License
+// along with this program.  If not, see <http://www.gnu.org/licenses/>.
+
+/// @file
+/// @brief Contains definition of lazy view of NAV-PVT message.
+/// @details Generated by script/gen_views.py, do NOT edit manually.
+
+#pragma once
+
+#include "ublox/message/NavPvt.h"
+#include "MsgView.h"
+
+namespace ublox
+{
+
+namespace view
+{
+
+/// @brief Lazy read-only view of NAV-PVT message payload.
+/// @details Wraps the pointer to the validated payload, the fields are
+///     decoded on access only, see @ref MsgView.
+///     The fields starting from "headVeh" are present only when the
+///     payload is long enough to contain all of them.
+/// @see @ref ublox::message::NavPvt
+class NavPvtView : public
+    MsgView<
+        ublox::message::NavPvtFields::All
+    >
+{
+    using Base =
+        MsgView<
+            ublox::message::NavPvtFields::All
+        >;
+
+public:
+    /// @brief ID of the viewed message.
+    static const MsgId MsgIdValue = MsgId_NAV_PVT;
+
+    /// @brief Index of the fields, same as the ones defined by
+    ///     @b COMMS_MSG_FIELDS_ACCESS() in @ref ublox::message::NavPvt.
+    enum FieldIdx
+    {
+        FieldIdx_iTOW, ///< index of @b iTOW field
+        FieldIdx_year, ///< index of @b year field
+        FieldIdx_month, ///< index of @b month field
+        FieldIdx_day, ///< index of @b day field
+        FieldIdx_hour, ///< index of @b hour field
+        FieldIdx_min, ///< index of @b min field
+        FieldIdx_sec, ///< index of @b sec field
+        FieldIdx_valid, ///< index of @b valid field
+        FieldIdx_tAcc, ///< index of @b tAcc field
+        FieldIdx_nano, ///< index of @b nano field
+        FieldIdx_fixType, ///< index of @b fixType field
+        FieldIdx_flags, ///< index of @b flags field
+        FieldIdx_flags2, ///< index of @b flags2 field
+        FieldIdx_numSV, ///< index of @b numSV field
+        FieldIdx_lon, ///< index of @b lon field
+        FieldIdx_lat, ///< index of @b lat field
+        FieldIdx_height, ///< index of @b height field
+        FieldIdx_hMSL, ///< index of @b hMSL field
+        FieldIdx_hAcc, ///< index of @b hAcc field
+        FieldIdx_vAcc, ///< index of @b vAcc field
+        FieldIdx_velN, ///< index of @b velN field
+        FieldIdx_velE, ///< index of @b velE field
+        FieldIdx_velD, ///< index of @b velD field
+        FieldIdx_gSpeed, ///< index of @b gSpeed field
+        FieldIdx_headMot, ///< index of @b headMot field
+        FieldIdx_sAcc, ///< index of @b sAcc field
+        FieldIdx_headAcc, ///< index of @b headAcc field
+        FieldIdx_pDOP, ///< index of @b pDOP field
+        FieldIdx_reserved1, ///< index of @b reserved1 field
+        FieldIdx_reserved2, ///< index of @b reserved2 field
+        FieldIdx_headVeh, ///< index of @b headVeh field
+        FieldIdx_magDec, ///< index of @b magDec field
+        FieldIdx_magAcc, ///< index of @b magAcc field
+        FieldIdx_numOfValues ///< number of available fields
+    };
+
+    /// @brief Default constructor, creates empty view.
+    NavPvtView() = default;
+
+    /// @brief Constructor
+    /// @param[in] payload Pointer to the payload of the message.
+    /// @param[in] len Length of the payload.
+    NavPvtView(const std::uint8_t* payload, std::size_t len)
+      : Base(payload, len)
+    {
+    }
+
+    /// @brief Decode "iTOW" field (see @ref ublox::message::NavPvtFields::iTOW).
+    comms::ErrorStatus field_iTOW(FieldType<FieldIdx_iTOW>& field) const
+    {
+        return Base::readField<FieldIdx_iTOW>(field);
+    }
+
+    /// @brief Decode "year" field (see @ref ublox::message::NavPvtFields::year).
+    comms::ErrorStatus field_year(FieldType<FieldIdx_year>& field) const
+    {
+        return Base::readField<FieldIdx_year>(field);
+    }
+
+    /// @brief Decode "month" field (see @ref ublox::message::NavPvtFields::month).
+    comms::ErrorStatus field_month(FieldType<FieldIdx_month>& field) const
+    {
+        return Base::readField<FieldIdx_month>(field);
+    }
+
+    /// @brief Decode "day" field (see @ref ublox::message::NavPvtFields::day).
+    comms::ErrorStatus field_day(FieldType<FieldIdx_day>& field) const
+    {
+        return Base::readField<FieldIdx_day>(field);
+    }
+
+    /// @brief Decode "hour" field (see @ref ublox::message::NavPvtFields::hour).
+    comms::ErrorStatus field_hour(FieldType<FieldIdx_hour>& field) const
+    {
+        return Base::readField<FieldIdx_hour>(field);
+    }
+
+    /// @brief Decode "min" field (see @ref ublox::message::NavPvtFields::min).
+    comms::ErrorStatus field_min(FieldType<FieldIdx_min>& field) const
+    {
+        return Base::readField<FieldIdx_min>(field);
+    }
+
+    /// @brief Decode "sec" field (see @ref ublox::message::NavPvtFields::sec).
+    comms::ErrorStatus field_sec(FieldType<FieldIdx_sec>& field) const
+    {
+        return Base::readField<FieldIdx_sec>(field);
+    }
+
+    /// @brief Decode "valid" field (see @ref ublox::message::NavPvtFields::validBits).
+    comms::ErrorStatus field_valid(FieldType<FieldIdx_valid>& field) const
+    {
+        return Base::readField<FieldIdx_valid>(field);
+    }
+
+    /// @brief Decode "tAcc" field (see @ref ublox::message::NavPvtFields::tAcc).
+    comms::ErrorStatus field_tAcc(FieldType<FieldIdx_tAcc>& field) const
+    {
+        return Base::readField<FieldIdx_tAcc>(field);
+    }
+
+    /// @brief Decode "nano" field (see @ref ublox::message::NavPvtFields::nano).
+    comms::ErrorStatus field_nano(FieldType<FieldIdx_nano>& field) const
+    {
+        return Base::readField<FieldIdx_nano>(field);
+    }
+
+    /// @brief Decode "fixType" field (see @ref ublox::message::NavPvtFields::fixType).
+    comms::ErrorStatus field_fixType(FieldType<FieldIdx_fixType>& field) const
+    {
+        return Base::readField<FieldIdx_fixType>(field);
+    }
+
+    /// @brief Decode "flags" field (see @ref ublox::message::NavPvtFields::flags).
+    comms::ErrorStatus field_flags(FieldType<FieldIdx_flags>& field) const
+    {
+        return Base::readField<FieldIdx_flags>(field);
+    }
+
+    /// @brief Decode "flags2" field (see @ref ublox::message::NavPvtFields::flags2).
+    comms::ErrorStatus field_flags2(FieldType<FieldIdx_flags2>& field) const
+    {
+        return Base::readField<FieldIdx_flags2>(field);
+    }
+
+    /// @brief Decode "numSV" field (see @ref ublox::message::NavPvtFields::numSV).
+    comms::ErrorStatus field_numSV(FieldType<FieldIdx_numSV>& field) const
+    {
+        return Base::readField<FieldIdx_numSV>(field);
+    }
+
+    /// @brief Decode "lon" field (see @ref ublox::message::NavPvtFields::lon).
+    comms::ErrorStatus field_lon(FieldType<FieldIdx_lon>& field) const
+    {
+        return Base::readField<FieldIdx_lon>(field);
+    }
+
+    /// @brief Decode "lat" field (see @ref ublox::message::NavPvtFields::lat).
+    comms::ErrorStatus field_lat(FieldType<FieldIdx_lat>& field) const
+    {
+        return Base::readField<FieldIdx_lat>(field);
+    }
+
+    /// @brief Decode "height" field (see @ref ublox::message::NavPvtFields::height).
+    comms::ErrorStatus field_height(FieldType<FieldIdx_height>& field) const
+    {
+        return Base::readField<FieldIdx_height>(field);
+    }
+
+    /// @brief Decode "hMSL" field (see @ref ublox::message::NavPvtFields::hMSL).
+    comms::ErrorStatus field_hMSL(FieldType<FieldIdx_hMSL>& field) const
+    {
+        return Base::readField<FieldIdx_hMSL>(field);
+    }
+
+    /// @brief Decode "hAcc" field (see @ref ublox::message::NavPvtFields::hAcc).
+    comms::ErrorStatus field_hAcc(FieldType<FieldIdx_hAcc>& field) const
+    {
+        return Base::readField<FieldIdx_hAcc>(field);
+    }
+
+    /// @brief Decode "vAcc" field (see @ref ublox::message::NavPvtFields::vAcc).
+    comms::ErrorStatus field_vAcc(FieldType<FieldIdx_vAcc>& field) const
+    {
+        return Base::readField<FieldIdx_vAcc>(field);
+    }
+
+    /// @brief Decode "velN" field (see @ref ublox::message::NavPvtFields::velN).
+    comms::ErrorStatus field_velN(FieldType<FieldIdx_velN>& field) const
+    {
+        return Base::readField<FieldIdx_velN>(field);
+    }
+
+    /// @brief Decode "velE" field (see @ref ublox::message::NavPvtFields::velE).
+    comms::ErrorStatus field_velE(FieldType<FieldIdx_velE>& field) const
+    {
+        return Base::readField<FieldIdx_velE>(field);
+    }
+
+    /// @brief Decode "velD" field (see @ref ublox::message::NavPvtFields::velD).
+    comms::ErrorStatus field_velD(FieldType<FieldIdx_velD>& field) const
+    {
+        return Base::readField<FieldIdx_velD>(field);
+    }
+
+    /// @brief Decode "gSpeed" field (see @ref ublox::message::NavPvtFields::gSpeed).
+    comms::ErrorStatus field_gSpeed(FieldType<FieldIdx_gSpeed>& field) const
+    {
+        return Base::readField<FieldIdx_gSpeed>(field);
+    }
+
+    /// @brief Decode "headMot" field (see @ref ublox::message::NavPvtFields::headMot).
+    comms::ErrorStatus field_headMot(FieldType<FieldIdx_headMot>& field) const
+    {
+        return Base::readField<FieldIdx_headMot>(field);
+    }
+
+    /// @brief Decode "sAcc" field (see @ref ublox::message::NavPvtFields::sAcc).
+    comms::ErrorStatus field_sAcc(FieldType<FieldIdx_sAcc>& field) const
+    {
+        return Base::readField<FieldIdx_sAcc>(field);
+    }
+
+    /// @brief Decode "headAcc" field (see @ref ublox::message::NavPvtFields::headAcc).
+    comms::ErrorStatus field_headAcc(FieldType<FieldIdx_headAcc>& field) const
+    {
+        return Base::readField<FieldIdx_headAcc>(field);
+    }
+
+    /// @brief Decode "pDOP" field (see @ref ublox::message::NavPvtFields::pDOP).
+    comms::ErrorStatus field_pDOP(FieldType<FieldIdx_pDOP>& field) const
+    {
+        return Base::readField<FieldIdx_pDOP>(field);
+    }
+
+    /// @brief Decode "reserved1" field (see @ref ublox::message::NavPvtFields::reserved1).
+    comms::ErrorStatus field_reserved1(FieldType<FieldIdx_reserved1>& field) const
+    {
+        return Base::readField<FieldIdx_reserved1>(field);
+    }
+
+    /// @brief Decode "reserved2" field (see @ref ublox::message::NavPvtFields::reserved2).
+    comms::ErrorStatus field_reserved2(FieldType<FieldIdx_reserved2>& field) const
+    {
+        return Base::readField<FieldIdx_reserved2>(field);
+    }
+
+    /// @brief Decode "headVeh" field (see @ref ublox::message::NavPvtFields::headVeh).
+    /// @details The field is present only when the payload is long enough
+    ///     to contain all the fields starting from "headVeh", it is
+    ///     reported as missing otherwise.
+    comms::ErrorStatus field_headVeh(FieldType<FieldIdx_headVeh>& field) const
+    {
+        return Base::readTrailingOptionalField<FieldIdx_headVeh, FieldIdx_headVeh>(field);
+    }
+
+    /// @brief Decode "magDec" field (see @ref ublox::message::NavPvtFields::magDec).
+    /// @details The field is present only when the payload is long enough
+    ///     to contain all the fields starting from "headVeh", it is
+    ///     reported as missing otherwise.
+    comms::ErrorStatus field_magDec(FieldType<FieldIdx_magDec>& field) const
+    {
+        return Base::readTrailingOptionalField<FieldIdx_magDec, FieldIdx_headVeh>(field);
+    }
+
+    /// @brief Decode "magAcc" field (see @ref ublox::message::NavPvtFields::magAcc).
+    /// @details The field is present only when the payload is long enough
+    ///     to contain all the fields starting from "headVeh", it is
+    ///     reported as missing otherwise.
+    comms::ErrorStatus field_magAcc(FieldType<FieldIdx_magAcc>& field) const
+    {
+        return Base::readTrailingOptionalField<FieldIdx_magAcc, FieldIdx_headVeh>(field);
+    }
+};
+
+} // namespace view
+
+} // namespace ublox
+
@@ -0,0 +1,178 @@
+//
+// Copyright 2018 (C). Alex Robenko. All rights reserved.
+//
+
+// This file is free software: you can redistribute it and/or modify
+// it under the terms of the GNU General Public License as published by
+// the Free Software Foundation, either version 3 of the License, or
+// (at your option) any later version.
+//
+// This program is distributed in the hope that it will be useful,
+// but WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+// GNU General Public License for more details.
+//
+// You should have received a copy of the GNU General Public License
+// along with this program.  If not, see <http://www.gnu.org/licenses/>.
+
+/// @file
+/// @brief Contains definition of lazy view of NAV-RELPOSNED message.
+/// @details Generated by script/gen_views.py, do NOT edit manually.
+
+#pragma once
+
+#include "ublox/message/NavRelposned.h"
+#include "MsgView.h"
+
+namespace ublox
+{
+
+namespace view
+{
+
+/// @brief Lazy read-only view of NAV-RELPOSNED message payload.
+/// @details Wraps the pointer to the validated payload, the fields are
+///     decoded on access only, see @ref MsgView.
+/// @see @ref ublox::message::NavRelposned
+class NavRelposnedView : public
+    MsgView<
+        ublox::message::NavRelposnedFields::All
+    >
+{
+    using Base =
+        MsgView<
+            ublox::message::NavRelposnedFields::All
+        >;
+
+public:
+    /// @brief ID of the viewed message.
+    static const MsgId MsgIdValue = MsgId_NAV_RELPOSNED;
+
+    /// @brief Index of the fields, same as the ones defined by
+    ///     @b COMMS_MSG_FIELDS_ACCESS() in @ref ublox::message::NavRelposned.
+    enum FieldIdx
+    {
+        FieldIdx_version, ///< index of @b version field
+        FieldIdx_reserved1, ///< index of @b reserved1 field
+        FieldIdx_refStationId, ///< index of @b refStationId field
+        FieldIdx_iTOW, ///< index of @b iTOW field
+        FieldIdx_relPosN, ///< index of @b relPosN field
+        FieldIdx_relPosE, ///< index of @b relPosE field
+        FieldIdx_relPosD, ///< index of @b relPosD field
+        FieldIdx_relPosHPN, ///< index of @b relPosHPN field
+        FieldIdx_relPosHPE, ///< index of @b relPosHPE field
+        FieldIdx_relPosHPD, ///< index of @b relPosHPD field
+        FieldIdx_reserved2, ///< index of @b reserved2 field
+        FieldIdx_accN, ///< index of @b accN field
+        FieldIdx_accE, ///< index of @b accE field
+        FieldIdx_accD, ///< index of @b accD field
+        FieldIdx_flags, ///< index of @b flags field
+        FieldIdx_numOfValues ///< number of available fields
+    };
+
+    /// @brief Default constructor, creates empty view.
+    NavRelposnedView() = default;
+
+    /// @brief Constructor
+    /// @param[in] payload Pointer to the payload of the message.
+    /// @param[in] len Length of the payload.
+    NavRelposnedView(const std::uint8_t* payload, std::size_t len)
+      : Base(payload, len)
+    {
+    }
+
+    /// @brief Decode "version" field (see @ref ublox::message::NavRelposnedFields::version).
+    comms::ErrorStatus field_version(FieldType<FieldIdx_version>& field) const
+    {
+        return Base::readField<FieldIdx_version>(field);
+    }
+
+    /// @brief Decode "reserved1" field (see @ref ublox::message::NavRelposnedFields::reserved1).
+    comms::ErrorStatus field_reserved1(FieldType<FieldIdx_reserved1>& field) const
+    {
+        return Base::readField<FieldIdx_reserved1>(field);
+    }
+
+    /// @brief Decode "refStationId" field (see @ref ublox::message::NavRelposnedFields::refStationId).
+    comms::ErrorStatus field_refStationId(FieldType<FieldIdx_refStationId>& field) const
+    {
+        return Base::readField<FieldIdx_refStationId>(field);
+    }
+
+    /// @brief Decode "iTOW" field (see @ref ublox::message::NavRelposnedFields::iTOW).
+    comms::ErrorStatus field_iTOW(FieldType<FieldIdx_iTOW>& field) const
+    {
+        return Base::readField<FieldIdx_iTOW>(field);
+    }
+
+    /// @brief Decode "relPosN" field (see @ref ublox::message::NavRelposnedFields::relPosN).
+    comms::ErrorStatus field_relPosN(FieldType<FieldIdx_relPosN>& field) const
+    {
+        return Base::readField<FieldIdx_relPosN>(field);
+    }
+
+    /// @brief Decode "relPosE" field (see @ref ublox::message::NavRelposnedFields::relPosE).
+    comms::ErrorStatus field_relPosE(FieldType<FieldIdx_relPosE>& field) const
+    {
+        return Base::readField<FieldIdx_relPosE>(field);
+    }
+
+    /// @brief Decode "relPosD" field (see @ref ublox::message::NavRelposnedFields::relPosD).
+    comms::ErrorStatus field_relPosD(FieldType<FieldIdx_relPosD>& field) const
+    {
+        return Base::readField<FieldIdx_relPosD>(field);
+    }
+
+    /// @brief Decode "relPosHPN" field (see @ref ublox::message::NavRelposnedFields::relPosHPN).
+    comms::ErrorStatus field_relPosHPN(FieldType<FieldIdx_relPosHPN>& field) const
+    {
+        return Base::readField<FieldIdx_relPosHPN>(field);
+    }
+
+    /// @brief Decode "relPosHPE" field (see @ref ublox::message::NavRelposnedFields::relPosHPE).
+    comms::ErrorStatus field_relPosHPE(FieldType<FieldIdx_relPosHPE>& field) const
+    {
+        return Base::readField<FieldIdx_relPosHPE>(field);
+    }
+
+    /// @brief Decode "relPosHPD" field (see @ref ublox::message::NavRelposnedFields::relPosHPD).
+    comms::ErrorStatus field_relPosHPD(FieldType<FieldIdx_relPosHPD>& field) const
+    {
+        return Base::readField<FieldIdx_relPosHPD>(field);
+    }
+
+    /// @brief Decode "reserved2" field (see @ref ublox::message::NavRelposnedFields::reserved2).
+    comms::ErrorStatus field_reserved2(FieldType<FieldIdx_reserved2>& field) const
+    {
+        return Base::readField<FieldIdx_reserved2>(field);
+    }
+
+    /// @brief Decode "accN" field (see @ref ublox::message::NavRelposnedFields::accN).
+    comms::ErrorStatus field_accN(FieldType<FieldIdx_accN>& field) const
+    {
+        return Base::readField<FieldIdx_accN>(field);
+    }
+
+    /// @brief Decode "accE" field (see @ref ublox::message::NavRelposnedFields::accE).
+    comms::ErrorStatus field_accE(FieldType<FieldIdx_accE>& field) const
+    {
+        return Base::readField<FieldIdx_accE>(field);
+    }
+
+    /// @brief Decode "accD" field (see @ref ublox::message::NavRelposnedFields::accD).
+    comms::ErrorStatus field_accD(FieldType<FieldIdx_accD>& field) const
+    {
+        return Base::readField<FieldIdx_accD>(field);
+    }
+
+    /// @brief Decode "flags" field (see @ref ublox::message::NavRelposnedFields::flags).
+    comms::ErrorStatus field_flags(FieldType<FieldIdx_flags>& field) const
+    {
+        return Base::readField<FieldIdx_flags>(field);
+    }
+};
+
+} // namespace view
+
+} // namespace ublox
+
@@ -0,0 +1,126 @@
+//
+// Copyright 2018 (C). Alex Robenko. All rights reserved.
+//
+
+// This file is free software: you can redistribute it and/or modify
+// it under the terms of the GNU General Public License as published by
+// the Free Software Foundation, either version 3 of the License, or
+// (at your option) any later version.
+//
+// This program is distributed in the hope that it will be useful,
+// but WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+// GNU General Public License for more details.
+//
+// You should have received a copy of the GNU General Public License
+// along with this program.  If not, see <http://www.gnu.org/licenses/>.
+
+/// @file
+/// @brief Contains definition of lazy view of NAV-SBAS message.
+/// @details Generated by script/gen_views.py, do NOT edit manually.
+
+#pragma once
+
+#include "ublox/message/NavSbas.h"
+#include "MsgView.h"
+
+namespace ublox
+{
+
+namespace view
+{
+
+/// @brief Lazy read-only view of NAV-SBAS message payload.
+/// @details Wraps the pointer to the validated payload, the fields are
+///     decoded on access only, see @ref MsgView.
+///     The message performs custom read of its fields, the fields starting
+///     from "data" are not accessible through the view, because their
+///     presence and/or size depend on the values of preceding fields.
+/// @see @ref ublox::message::NavSbas
+class NavSbasView : public
+    MsgView<
+        ublox::message::NavSbasFields::All<comms::option::EmptyOption>
+    >
+{
+    using Base =
+        MsgView<
+            ublox::message::NavSbasFields::All<comms::option::EmptyOption>
+        >;
+
+public:
+    /// @brief ID of the viewed message.
+    static const MsgId MsgIdValue = MsgId_NAV_SBAS;
+
+    /// @brief Index of the fields, same as the ones defined by
+    ///     @b COMMS_MSG_FIELDS_ACCESS() in @ref ublox::message::NavSbas.
+    enum FieldIdx
+    {
+        FieldIdx_iTOW, ///< index of @b iTOW field
+        FieldIdx_geo, ///< index of @b geo field
+        FieldIdx_mode, ///< index of @b mode field
+        FieldIdx_sys, ///< index of @b sys field
+        FieldIdx_service, ///< index of @b service field
+        FieldIdx_cnt, ///< index of @b cnt field
+        FieldIdx_reserved0, ///< index of @b reserved0 field
+        FieldIdx_data, ///< index of @b data field
+        FieldIdx_numOfValues ///< number of available fields
+    };
+
+    /// @brief Default constructor, creates empty view.
+    NavSbasView() = default;
+
+    /// @brief Constructor
+    /// @param[in] payload Pointer to the payload of the message.
+    /// @param[in] len Length of the payload.
+    NavSbasView(const std::uint8_t* payload, std::size_t len)
+      : Base(payload, len)
+    {
+    }
+
+    /// @brief Decode "iTOW" field (see @ref ublox::message::NavSbasFields::iTOW).
+    comms::ErrorStatus field_iTOW(FieldType<FieldIdx_iTOW>& field) const
+    {
+        return Base::readField<FieldIdx_iTOW>(field);
+    }
+
+    /// @brief Decode "geo" field (see @ref ublox::message::NavSbasFields::geo).
+    comms::ErrorStatus field_geo(FieldType<FieldIdx_geo>& field) const
+    {
+        return Base::readField<FieldIdx_geo>(field);
+    }
+
+    /// @brief Decode "mode" field (see @ref ublox::message::NavSbasFields::mode).
+    comms::ErrorStatus field_mode(FieldType<FieldIdx_mode>& field) const
+    {
+        return Base::readField<FieldIdx_mode>(field);
+    }
+
+    /// @brief Decode "sys" field (see @ref ublox::message::NavSbasFields::sys).
+    comms::ErrorStatus field_sys(FieldType<FieldIdx_sys>& field) const
+    {
+        return Base::readField<FieldIdx_sys>(field);
+    }
+
+    /// @brief Decode "service" field (see @ref ublox::message::NavSbasFields::service).
+    comms::ErrorStatus field_service(FieldType<FieldIdx_service>& field) const
+    {
+        return Base::readField<FieldIdx_service>(field);
+    }
+
+    /// @brief Decode "cnt" field (see @ref ublox::message::NavSbasFields::cnt).
+    comms::ErrorStatus field_cnt(FieldType<FieldIdx_cnt>& field) const
+    {
+        return Base::readField<FieldIdx_cnt>(field);
+    }
+
+    /// @brief Decode "reserved0" field (see @ref ublox::message::NavSbasFields::reserved0).
+    comms::ErrorStatus field_reserved0(FieldType<FieldIdx_reserved0>& field) const
+    {
+        return Base::readField<FieldIdx_reserved0>(field);
+    }
+};
+
+} // namespace view
+
+} // namespace ublox
+
@@ -0,0 +1,192 @@
+//
+// Copyright 2018 (C). Alex Robenko. All rights reserved.
+//
+
+// This file is free software: you can redistribute it and/or modify
+// it under the terms of the GNU General Public License as published by
+// the Free Software Foundation, either version 3 of the License, or
+// (at your option) any later version.
+//
+// This program is distributed in the hope that it will be useful,
+// but WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+// GNU General Public License for more details.
+//
+// You should have received a copy of the GNU General Public License
+// along with this program.  If not, see <http://www.gnu.org/licenses/>.
+
+/// @file
+/// @brief Contains definition of lazy view of NAV-SOL message.
+/// @details Generated by script/gen_views.py, do NOT edit manually.
+
+#pragma once
+
+#include "ublox/message/NavSol.h"
+#include "MsgView.h"
+
+namespace ublox
+{
+
+namespace view
+{
+
+/// @brief Lazy read-only view of NAV-SOL message payload.
+/// @details Wraps the pointer to the validated payload, the fields are
+///     decoded on access only, see @ref MsgView.
+/// @see @ref ublox::message::NavSol
+class NavSolView : public
+    MsgView<
+        ublox::message::NavSolFields::All
+    >
+{
+    using Base =
+        MsgView<
+            ublox::message::NavSolFields::All
+        >;
+
+public:
+    /// @brief ID of the viewed message.
+    static const MsgId MsgIdValue = MsgId_NAV_SOL;
+
+    /// @brief Index of the fields, same as the ones defined by
+    ///     @b COMMS_MSG_FIELDS_ACCESS() in @ref ublox::message::NavSol.
+    enum FieldIdx
+    {
+        FieldIdx_iTOW, ///< index of @b iTOW field
+        FieldIdx_fTOW, ///< index of @b fTOW field
+        FieldIdx_week, ///< index of @b week field
+        FieldIdx_gpsFix, ///< index of @b gpsFix field
+        FieldIdx_flags, ///< index of @b flags field
+        FieldIdx_ecefX, ///< index of @b ecefX field
+        FieldIdx_ecefY, ///< index of @b ecefY field
+        FieldIdx_ecefZ, ///< index of @b ecefZ field
+        FieldIdx_pAcc, ///< index of @b pAcc field
+        FieldIdx_ecefVX, ///< index of @b ecefVX field
+        FieldIdx_ecefVY, ///< index of @b ecefVY field
+        FieldIdx_ecefVZ, ///< index of @b ecefVZ field
+        FieldIdx_sAcc, ///< index of @b sAcc field
+        FieldIdx_pDOP, ///< index of @b pDOP field
+        FieldIdx_reserved1, ///< index of @b reserved1 field
+        FieldIdx_numSV, ///< index of @b numSV field
+        FieldIdx_reserved2, ///< index of @b reserved2 field
+        FieldIdx_numOfValues ///< number of available fields
+    };
+
+    /// @brief Default constructor, creates empty view.
+    NavSolView() = default;
+
+    /// @brief Constructor
+    /// @param[in] payload Pointer to the payload of the message.
+    /// @param[in] len Length of the payload.
+    NavSolView(const std::uint8_t* payload, std::size_t len)
+      : Base(payload, len)
+    {
+    }
+
+    /// @brief Decode "iTOW" field (see @ref ublox::message::NavSolFields::iTOW).
+    comms::ErrorStatus field_iTOW(FieldType<FieldIdx_iTOW>& field) const
+    {
+        return Base::readField<FieldIdx_iTOW>(field);
+    }
+
+    /// @brief Decode "fTOW" field (see @ref ublox::message::NavSolFields::fTOW).
+    comms::ErrorStatus field_fTOW(FieldType<FieldIdx_fTOW>& field) const
+    {
+        return Base::readField<FieldIdx_fTOW>(field);
+    }
+
+    /// @brief Decode "week" field (see @ref ublox::message::NavSolFields::week).
+    comms::ErrorStatus field_week(FieldType<FieldIdx_week>& field) const
+    {
+        return Base::readField<FieldIdx_week>(field);
+    }
+
+    /// @brief Decode "gpsFix" field (see @ref ublox::message::NavSolFields::gpsFix).
+    comms::ErrorStatus field_gpsFix(FieldType<FieldIdx_gpsFix>& field) const
+    {
+        return Base::readField<FieldIdx_gpsFix>(field);
+    }
+
+    /// @brief Decode "flags" field (see @ref ublox::message::NavSolFields::flags).
+    comms::ErrorStatus field_flags(FieldType<FieldIdx_flags>& field) const
+    {
+        return Base::readField<FieldIdx_flags>(field);
+    }
+
+    /// @brief Decode "ecefX" field (see @ref ublox::message::NavSolFields::ecefX).
+    comms::ErrorStatus field_ecefX(FieldType<FieldIdx_ecefX>& field) const
+    {
+        return Base::readField<FieldIdx_ecefX>(field);
+    }
+
+    /// @brief Decode "ecefY" field (see @ref ublox::message::NavSolFields::ecefY).
+    comms::ErrorStatus field_ecefY(FieldType<FieldIdx_ecefY>& field) const
+    {
+        return Base::readField<FieldIdx_ecefY>(field);
+    }
+
+    /// @brief Decode "ecefZ" field (see @ref ublox::message::NavSolFields::ecefZ).
+    comms::ErrorStatus field_ecefZ(FieldType<FieldIdx_ecefZ>& field) const
+    {
+        return Base::readField<FieldIdx_ecefZ>(field);
+    }
+
+    /// @brief Decode "pAcc" field (see @ref ublox::message::NavSolFields::pAcc).
+    comms::ErrorStatus field_pAcc(FieldType<FieldIdx_pAcc>& field) const
+    {
+        return Base::readField<FieldIdx_pAcc>(field);
+    }
+
+    /// @brief Decode "ecefVX" field (see @ref ublox::message::NavSolFields::ecefVX).
+    comms::ErrorStatus field_ecefVX(FieldType<FieldIdx_ecefVX>& field) const
+    {
+        return Base::readField<FieldIdx_ecefVX>(field);
+    }
+
+    /// @brief Decode "ecefVY" field (see @ref ublox::message::NavSolFields::ecefVY).
+    comms::ErrorStatus field_ecefVY(FieldType<FieldIdx_ecefVY>& field) const
+    {
+        return Base::readField<FieldIdx_ecefVY>(field);
+    }
+
+    /// @brief Decode "ecefVZ" field (see @ref ublox::message::NavSolFields::ecefVZ).
+    comms::ErrorStatus field_ecefVZ(FieldType<FieldIdx_ecefVZ>& field) const
+    {
+        return Base::readField<FieldIdx_ecefVZ>(field);
+    }
+
+    /// @brief Decode "sAcc" field (see @ref ublox::message::NavSolFields::sAcc).
+    comms::ErrorStatus field_sAcc(FieldType<FieldIdx_sAcc>& field) const
+    {
+        return Base::readField<FieldIdx_sAcc>(field);
+    }
+
+    /// @brief Decode "pDOP" field (see @ref ublox::message::NavSolFields::pDOP).
+    comms::ErrorStatus field_pDOP(FieldType<FieldIdx_pDOP>& field) const
+    {
+        return Base::readField<FieldIdx_pDOP>(field);
+    }
+
+    /// @brief Decode "reserved1" field (see @ref ublox::message::NavSolFields::reserved1).
+    comms::ErrorStatus field_reserved1(FieldType<FieldIdx_reserved1>& field) const
+    {
+        return Base::readField<FieldIdx_reserved1>(field);
+    }
+
+    /// @brief Decode "numSV" field (see @ref ublox::message::NavSolFields::numSV).
+    comms::ErrorStatus field_numSV(FieldType<FieldIdx_numSV>& field) const
+    {
+        return Base::readField<FieldIdx_numSV>(field);
+    }
+
+    /// @brief Decode "reserved2" field (see @ref ublox::message::NavSolFields::reserved2).
+    comms::ErrorStatus field_reserved2(FieldType<FieldIdx_reserved2>& field) const
+    {
+        return Base::readField<FieldIdx_reserved2>(field);
+    }
+};
+
+} // namespace view
+
+} // namespace ublox
+
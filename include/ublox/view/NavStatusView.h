@@ -0,0 +1,122 @@
+//
+// Copyright 2018 (C). Alex Robenko. All rights reserved.
+//
+
+// This file is free software: you can redistribute it and/or modify
+// it under the terms of the GNU General Public License as published by
+// the Free Software Foundation, either version 3 of the License, or
+// (at your option) any later version.
+//
+// This program is distributed in the hope that it will be useful,
+// but WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+// GNU General Public License for more details.
+//
+// You should have received a copy of the GNU General Public License
+// along with this program.  If not, see <http://www.gnu.org/licenses/>.
+
+/// @file
+/// @brief Contains definition of lazy view of NAV-STATUS message.
+/// @details Generated by script/gen_views.py, do NOT edit manually.
+
+#pragma once
+
+#include "ublox/message/NavStatus.h"
+#include "MsgView.h"
+
+namespace ublox
+{
+
+namespace view
+{
+
+/// @brief Lazy read-only view of NAV-STATUS message payload.
+/// @details Wraps the pointer to the validated payload, the fields are
+///     decoded on access only, see @ref MsgView.
+/// @see @ref ublox::message::NavStatus
+class NavStatusView : public
+    MsgView<
+        ublox::message::NavStatusFields::All
+    >
+{
+    using Base =
+        MsgView<
+            ublox::message::NavStatusFields::All
+        >;
+
+public:
+    /// @brief ID of the viewed message.
+    static const MsgId MsgIdValue = MsgId_NAV_STATUS;
+
+    /// @brief Index of the fields, same as the ones defined by
+    ///     @b COMMS_MSG_FIELDS_ACCESS() in @ref ublox::message::NavStatus.
+    enum FieldIdx
+    {
+        FieldIdx_iTOW, ///< index of @b iTOW field
+        FieldIdx_gpsFix, ///< index of @b gpsFix field
+        FieldIdx_flags, ///< index of @b flags field
+        FieldIdx_fixStat, ///< index of @b fixStat field
+        FieldIdx_flags2, ///< index of @b flags2 field
+        FieldIdx_ttff, ///< index of @b ttff field
+        FieldIdx_msss, ///< index of @b msss field
+        FieldIdx_numOfValues ///< number of available fields
+    };
+
+    /// @brief Default constructor, creates empty view.
+    NavStatusView() = default;
+
+    /// @brief Constructor
+    /// @param[in] payload Pointer to the payload of the message.
+    /// @param[in] len Length of the payload.
+    NavStatusView(const std::uint8_t* payload, std::size_t len)
+      : Base(payload, len)
+    {
+    }
+
+    /// @brief Decode "iTOW" field (see @ref ublox::message::NavStatusFields::iTOW).
+    comms::ErrorStatus field_iTOW(FieldType<FieldIdx_iTOW>& field) const
+    {
+        return Base::readField<FieldIdx_iTOW>(field);
+    }
+
+    /// @brief Decode "gpsFix" field (see @ref ublox::message::NavStatusFields::gpsFix).
+    comms::ErrorStatus field_gpsFix(FieldType<FieldIdx_gpsFix>& field) const
+    {
+        return Base::readField<FieldIdx_gpsFix>(field);
+    }
+
+    /// @brief Decode "flags" field (see @ref ublox::message::NavStatusFields::flags).
+    comms::ErrorStatus field_flags(FieldType<FieldIdx_flags>& field) const
+    {
+        return Base::readField<FieldIdx_flags>(field);
+    }
+
+    /// @brief Decode "fixStat" field (see @ref ublox::message::NavStatusFields::fixStat).
+    comms::ErrorStatus field_fixStat(FieldType<FieldIdx_fixStat>& field) const
+    {
+        return Base::readField<FieldIdx_fixStat>(field);
+    }
+
+    /// @brief Decode "flags2" field (see @ref ublox::message::NavStatusFields::flags2).
+    comms::ErrorStatus field_flags2(FieldType<FieldIdx_flags2>& field) const
+    {
+        return Base::readField<FieldIdx_flags2>(field);
+    }
+
+    /// @brief Decode "ttff" field (see @ref ublox::message::NavStatusFields::ttff).
+    comms::ErrorStatus field_ttff(FieldType<FieldIdx_ttff>& field) const
+    {
+        return Base::readField<FieldIdx_ttff>(field);
+    }
+
+    /// @brief Decode "msss" field (see @ref ublox::message::NavStatusFields::msss).
+    comms::ErrorStatus field_msss(FieldType<FieldIdx_msss>& field) const
+    {
+        return Base::readField<FieldIdx_msss>(field);
+    }
+};
+
+} // namespace view
+
+} // namespace ublox
+
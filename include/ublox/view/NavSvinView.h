@@ -0,0 +1,185 @@
+//
+// Copyright 2018 (C). Alex Robenko. All rights reserved.
+//
+
+// This file is free software: you can redistribute it and/or modify
+// it under the terms of the GNU General Public License as published by
+// the Free Software Foundation, either version 3 of the License, or
+// (at your option) any later version.
+//
+// This program is distributed in the hope that it will be useful,
+// but WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+// GNU General Public License for more details.
+//
+// You should have received a copy of the GNU General Public License
+// along with this program.  If not, see <http://www.gnu.org/licenses/>.
+
+/// @file
+/// @brief Contains definition of lazy view of NAV-SVIN message.
+/// @details Generated by script/gen_views.py, do NOT edit manually.
+
+#pragma once
+
+#include "ublox/message/NavSvin.h"
+#include "MsgView.h"
+
+namespace ublox
+{
+
+namespace view
+{
+
+/// @brief Lazy read-only view of NAV-SVIN message payload.
+/// @details Wraps the pointer to the validated payload, the fields are
+///     decoded on access only, see @ref MsgView.
+/// @see @ref ublox::message::NavSvin
+class NavSvinView : public
+    MsgView<
+        ublox::message::NavSvinFields::All
+    >
+{
+    using Base =
+        MsgView<
+            ublox::message::NavSvinFields::All
+        >;
+
+public:
+    /// @brief ID of the viewed message.
+    static const MsgId MsgIdValue = MsgId_NAV_SVIN;
+
+    /// @brief Index of the fields, same as the ones defined by
+    ///     @b COMMS_MSG_FIELDS_ACCESS() in @ref ublox::message::NavSvin.
+    enum FieldIdx
+    {
+        FieldIdx_version, ///< index of @b version field
+        FieldIdx_reserved1, ///< index of @b reserved1 field
+        FieldIdx_iTOW, ///< index of @b iTOW field
+        FieldIdx_dur, ///< index of @b dur field
+        FieldIdx_meanX, ///< index of @b meanX field
+        FieldIdx_meanY, ///< index of @b meanY field
+        FieldIdx_meanZ, ///< index of @b meanZ field
+        FieldIdx_meanXHP, ///< index of @b meanXHP field
+        FieldIdx_meanYHP, ///< index of @b meanYHP field
+        FieldIdx_meanZHP, ///< index of @b meanZHP field
+        FieldIdx_reserved2, ///< index of @b reserved2 field
+        FieldIdx_meanAcc, ///< index of @b meanAcc field
+        FieldIdx_obs, ///< index of @b obs field
+        FieldIdx_valid, ///< index of @b valid field
+        FieldIdx_active, ///< index of @b active field
+        FieldIdx_reserved3, ///< index of @b reserved3 field
+        FieldIdx_numOfValues ///< number of available fields
+    };
+
+    /// @brief Default constructor, creates empty view.
+    NavSvinView() = default;
+
+    /// @brief Constructor
+    /// @param[in] payload Pointer to the payload of the message.
+    /// @param[in] len Length of the payload.
+    NavSvinView(const std::uint8_t* payload, std::size_t len)
+      : Base(payload, len)
+    {
+    }
+
+    /// @brief Decode "version" field (see @ref ublox::message::NavSvinFields::version).
+    comms::ErrorStatus field_version(FieldType<FieldIdx_version>& field) const
+    {
+        return Base::readField<FieldIdx_version>(field);
+    }
+
+    /// @brief Decode "reserved1" field (see @ref ublox::message::NavSvinFields::reserved1).
+    comms::ErrorStatus field_reserved1(FieldType<FieldIdx_reserved1>& field) const
+    {
+        return Base::readField<FieldIdx_reserved1>(field);
+    }
+
+    /// @brief Decode "iTOW" field (see @ref ublox::message::NavSvinFields::iTOW).
+    comms::ErrorStatus field_iTOW(FieldType<FieldIdx_iTOW>& field) const
+    {
+        return Base::readField<FieldIdx_iTOW>(field);
+    }
+
+    /// @brief Decode "dur" field (see @ref ublox::message::NavSvinFields::dur).
+    comms::ErrorStatus field_dur(FieldType<FieldIdx_dur>& field) const
+    {
+        return Base::readField<FieldIdx_dur>(field);
+    }
+
+    /// @brief Decode "meanX" field (see @ref ublox::message::NavSvinFields::meanX).
+    comms::ErrorStatus field_meanX(FieldType<FieldIdx_meanX>& field) const
+    {
+        return Base::readField<FieldIdx_meanX>(field);
+    }
+
+    /// @brief Decode "meanY" field (see @ref ublox::message::NavSvinFields::meanY).
+    comms::ErrorStatus field_meanY(FieldType<FieldIdx_meanY>& field) const
+    {
+        return Base::readField<FieldIdx_meanY>(field);
+    }
+
+    /// @brief Decode "meanZ" field (see @ref ublox::message::NavSvinFields::meanZ).
+    comms::ErrorStatus field_meanZ(FieldType<FieldIdx_meanZ>& field) const
+    {
+        return Base::readField<FieldIdx_meanZ>(field);
+    }
+
+    /// @brief Decode "meanXHP" field (see @ref ublox::message::NavSvinFields::meanXHP).
+    comms::ErrorStatus field_meanXHP(FieldType<FieldIdx_meanXHP>& field) const
+    {
+        return Base::readField<FieldIdx_meanXHP>(field);
+    }
+
+    /// @brief Decode "meanYHP" field (see @ref ublox::message::NavSvinFields::meanYHP).
+    comms::ErrorStatus field_meanYHP(FieldType<FieldIdx_meanYHP>& field) const
+    {
+        return Base::readField<FieldIdx_meanYHP>(field);
+    }
+
+    /// @brief Decode "meanZHP" field (see @ref ublox::message::NavSvinFields::meanZHP).
+    comms::ErrorStatus field_meanZHP(FieldType<FieldIdx_meanZHP>& field) const
+    {
+        return Base::readField<FieldIdx_meanZHP>(field);
+    }
+
+    /// @brief Decode "reserved2" field (see @ref ublox::message::NavSvinFields::reserved2).
+    comms::ErrorStatus field_reserved2(FieldType<FieldIdx_reserved2>& field) const
+    {
+        return Base::readField<FieldIdx_reserved2>(field);
+    }
+
+    /// @brief Decode "meanAcc" field (see @ref ublox::message::NavSvinFields::meanAcc).
+    comms::ErrorStatus field_meanAcc(FieldType<FieldIdx_meanAcc>& field) const
+    {
+        return Base::readField<FieldIdx_meanAcc>(field);
+    }
+
+    /// @brief Decode "obs" field (see @ref ublox::message::NavSvinFields::obs).
+    comms::ErrorStatus field_obs(FieldType<FieldIdx_obs>& field) const
+    {
+        return Base::readField<FieldIdx_obs>(field);
+    }
+
+    /// @brief Decode "valid" field (see @ref ublox::message::NavSvinFields::isValid).
+    comms::ErrorStatus field_valid(FieldType<FieldIdx_valid>& field) const
+    {
+        return Base::readField<FieldIdx_valid>(field);
+    }
+
+    /// @brief Decode "active" field (see @ref ublox::message::NavSvinFields::active).
+    comms::ErrorStatus field_active(FieldType<FieldIdx_active>& field) const
+    {
+        return Base::readField<FieldIdx_active>(field);
+    }
+
+    /// @brief Decode "reserved3" field (see @ref ublox::message::NavSvinFields::reserved3).
+    comms::ErrorStatus field_reserved3(FieldType<FieldIdx_reserved3>& field) const
+    {
+        return Base::readField<FieldIdx_reserved3>(field);
+    }
+};
+
+} // namespace view
+
+} // namespace ublox
+
@@ -0,0 +1,122 @@
+//
+// Copyright 2018 (C). Alex Robenko. All rights reserved.
+//
+
+// This file is free software: you can redistribute it and/or modify
+// it under the terms of the GNU General Public License as published by
+// the Free Software Foundation, either version 3 of the License, or
+// (at your option) any later version.
+//
+// This program is distributed in the hope that it will be useful,
+// but WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+// GNU General Public License for more details.
+//
+// You should have received a copy of the GNU General Public License
+// along with this program.  If not, see <http://www.gnu.org/licenses/>.
+
+/// @file
+/// @brief Contains definition of lazy view of NAV-TIMEBDS message.
+/// @details Generated by script/gen_views.py, do NOT edit manually.
+
+#pragma once
+
+#include "ublox/message/NavTimebds.h"
+#include "MsgView.h"
+
+namespace ublox
+{
+
+namespace view
+{
+
+/// @brief Lazy read-only view of NAV-TIMEBDS message payload.
+/// @details Wraps the pointer to the validated payload, the fields are
+///     decoded on access only, see @ref MsgView.
+/// @see @ref ublox::message::NavTimebds
+class NavTimebdsView : public
+    MsgView<
+        ublox::message::NavTimebdsFields::All
+    >
+{
+    using Base =
+        MsgView<
+            ublox::message::NavTimebdsFields::All
+        >;
+
+public:
+    /// @brief ID of the viewed message.
+    static const MsgId MsgIdValue = MsgId_NAV_TIMEBDS;
+
+    /// @brief Index of the fields, same as the ones defined by
+    ///     @b COMMS_MSG_FIELDS_ACCESS() in @ref ublox::message::NavTimebds.
+    enum FieldIdx
+    {
+        FieldIdx_iTOW, ///< index of @b iTOW field
+        FieldIdx_SOW, ///< index of @b SOW field
+        FieldIdx_fSOW, ///< index of @b fSOW field
+        FieldIdx_week, ///< index of @b week field
+        FieldIdx_leapS, ///< index of @b leapS field
+        FieldIdx_valid, ///< index of @b valid field
+        FieldIdx_tAcc, ///< index of @b tAcc field
+        FieldIdx_numOfValues ///< number of available fields
+    };
+
+    /// @brief Default constructor, creates empty view.
+    NavTimebdsView() = default;
+
+    /// @brief Constructor
+    /// @param[in] payload Pointer to the payload of the message.
+    /// @param[in] len Length of the payload.
+    NavTimebdsView(const std::uint8_t* payload, std::size_t len)
+      : Base(payload, len)
+    {
+    }
+
+    /// @brief Decode "iTOW" field (see @ref ublox::message::NavTimebdsFields::iTOW).
+    comms::ErrorStatus field_iTOW(FieldType<FieldIdx_iTOW>& field) const
+    {
+        return Base::readField<FieldIdx_iTOW>(field);
+    }
+
+    /// @brief Decode "SOW" field (see @ref ublox::message::NavTimebdsFields::SOW).
+    comms::ErrorStatus field_SOW(FieldType<FieldIdx_SOW>& field) const
+    {
+        return Base::readField<FieldIdx_SOW>(field);
+    }
+
+    /// @brief Decode "fSOW" field (see @ref ublox::message::NavTimebdsFields::fSOW).
+    comms::ErrorStatus field_fSOW(FieldType<FieldIdx_fSOW>& field) const
+    {
+        return Base::readField<FieldIdx_fSOW>(field);
+    }
+
+    /// @brief Decode "week" field (see @ref ublox::message::NavTimebdsFields::week).
+    comms::ErrorStatus field_week(FieldType<FieldIdx_week>& field) const
+    {
+        return Base::readField<FieldIdx_week>(field);
+    }
+
+    /// @brief Decode "leapS" field (see @ref ublox::message::NavTimebdsFields::leapS).
+    comms::ErrorStatus field_leapS(FieldType<FieldIdx_leapS>& field) const
+    {
+        return Base::readField<FieldIdx_leapS>(field);
+    }
+
+    /// @brief Decode "valid" field (see @ref ublox::message::NavTimebdsFields::validBits).
+    comms::ErrorStatus field_valid(FieldType<FieldIdx_valid>& field) const
+    {
+        return Base::readField<FieldIdx_valid>(field);
+    }
+
+    /// @brief Decode "tAcc" field (see @ref ublox::message::NavTimebdsFields::tAcc).
+    comms::ErrorStatus field_tAcc(FieldType<FieldIdx_tAcc>& field) const
+    {
+        return Base::readField<FieldIdx_tAcc>(field);
+    }
+};
+
+} // namespace view
+
+} // namespace ublox
+
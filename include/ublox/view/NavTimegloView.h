@@ -0,0 +1,122 @@
+//
+// Copyright 2018 (C). Alex Robenko. All rights reserved.
+//
+
+// This file is free software: you can redistribute it and/or modify
+// it under the terms of the GNU General Public License as published by
+// the Free Software Foundation, either version 3 of the License, or
+// (at your option) any later version.
+//
+// This program is distributed in the hope that it will be useful,
+// but WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+// GNU General Public License for more details.
+//
+// You should have received a copy of the GNU General Public License
+// along with this program.  If not, see <http://www.gnu.org/licenses/>.
+
+/// @file
+/// @brief Contains definition of lazy view of NAV-TIMEGLO message.
+/// @details Generated by script/gen_views.py, do NOT edit manually.
+
+#pragma once
+
+#include "ublox/message/NavTimeglo.h"
+#include "MsgView.h"
+
+namespace ublox
+{
+
+namespace view
+{
+
+/// @brief Lazy read-only view of NAV-TIMEGLO message payload.
+/// @details Wraps the pointer to the validated payload, the fields are
+///     decoded on access only, see @ref MsgView.
+/// @see @ref ublox::message::NavTimeglo
+class NavTimegloView : public
+    MsgView<
+        ublox::message::NavTimegloFields::All
+    >
+{
+    using Base =
+        MsgView<
+            ublox::message::NavTimegloFields::All
+        >;
+
+public:
+    /// @brief ID of the viewed message.
+    static const MsgId MsgIdValue = MsgId_NAV_TIMEGLO;
+
+    /// @brief Index of the fields, same as the ones defined by
+    ///     @b COMMS_MSG_FIELDS_ACCESS() in @ref ublox::message::NavTimeglo.
+    enum FieldIdx
+    {
+        FieldIdx_iTOW, ///< index of @b iTOW field
+        FieldIdx_TOD, ///< index of @b TOD field
+        FieldIdx_fTOD, ///< index of @b fTOD field
+        FieldIdx_Nt, ///< index of @b Nt field
+        FieldIdx_N4, ///< index of @b N4 field
+        FieldIdx_valid, ///< index of @b valid field
+        FieldIdx_tAcc, ///< index of @b tAcc field
+        FieldIdx_numOfValues ///< number of available fields
+    };
+
+    /// @brief Default constructor, creates empty view.
+    NavTimegloView() = default;
+
+    /// @brief Constructor
+    /// @param[in] payload Pointer to the payload of the message.
+    /// @param[in] len Length of the payload.
+    NavTimegloView(const std::uint8_t* payload, std::size_t len)
+      : Base(payload, len)
+    {
+    }
+
+    /// @brief Decode "iTOW" field (see @ref ublox::message::NavTimegloFields::iTOW).
+    comms::ErrorStatus field_iTOW(FieldType<FieldIdx_iTOW>& field) const
+    {
+        return Base::readField<FieldIdx_iTOW>(field);
+    }
+
+    /// @brief Decode "TOD" field (see @ref ublox::message::NavTimegloFields::TOD).
+    comms::ErrorStatus field_TOD(FieldType<FieldIdx_TOD>& field) const
+    {
+        return Base::readField<FieldIdx_TOD>(field);
+    }
+
+    /// @brief Decode "fTOD" field (see @ref ublox::message::NavTimegloFields::fTOD).
+    comms::ErrorStatus field_fTOD(FieldType<FieldIdx_fTOD>& field) const
+    {
+        return Base::readField<FieldIdx_fTOD>(field);
+    }
+
+    /// @brief Decode "Nt" field (see @ref ublox::message::NavTimegloFields::Nt).
+    comms::ErrorStatus field_Nt(FieldType<FieldIdx_Nt>& field) const
+    {
+        return Base::readField<FieldIdx_Nt>(field);
+    }
+
+    /// @brief Decode "N4" field (see @ref ublox::message::NavTimegloFields::N4).
+    comms::ErrorStatus field_N4(FieldType<FieldIdx_N4>& field) const
+    {
+        return Base::readField<FieldIdx_N4>(field);
+    }
+
+    /// @brief Decode "valid" field (see @ref ublox::message::NavTimegloFields::validBits).
+    comms::ErrorStatus field_valid(FieldType<FieldIdx_valid>& field) const
+    {
+        return Base::readField<FieldIdx_valid>(field);
+    }
+
+    /// @brief Decode "tAcc" field (see @ref ublox::message::NavTimegloFields::tAcc).
+    comms::ErrorStatus field_tAcc(FieldType<FieldIdx_tAcc>& field) const
+    {
+        return Base::readField<FieldIdx_tAcc>(field);
+    }
+};
+
+} // namespace view
+
+} // namespace ublox
+
@@ -0,0 +1,157 @@
+//
+// Copyright 2018 (C). Alex Robenko. All rights reserved.
+//
+
+// This file is free software: you can redistribute it and/or modify
+// it under the terms of the GNU General Public License as published by
+// the Free Software Foundation, either version 3 of the License, or
+// (at your option) any later version.
+//
+// This program is distributed in the hope that it will be useful,
+// but WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+// GNU General Public License for more details.
+//
+// You should have received a copy of the GNU General Public License
+// along with this program.  If not, see <http://www.gnu.org/licenses/>.
+
+/// @file
+/// @brief Contains definition of lazy view of NAV-TIMELS message.
+/// @details Generated by script/gen_views.py, do NOT edit manually.
+
+#pragma once
+
+#include "ublox/message/NavTimels.h"
+#include "MsgView.h"
+
+namespace ublox
+{
+
+namespace view
+{
+
+/// @brief Lazy read-only view of NAV-TIMELS message payload.
+/// @details Wraps the pointer to the validated payload, the fields are
+///     decoded on access only, see @ref MsgView.
+/// @see @ref ublox::message::NavTimels
+class NavTimelsView : public
+    MsgView<
+        ublox::message::NavTimelsFields::All
+    >
+{
+    using Base =
+        MsgView<
+            ublox::message::NavTimelsFields::All
+        >;
+
+public:
+    /// @brief ID of the viewed message.
+    static const MsgId MsgIdValue = MsgId_NAV_TIMELS;
+
+    /// @brief Index of the fields, same as the ones defined by
+    ///     @b COMMS_MSG_FIELDS_ACCESS() in @ref ublox::message::NavTimels.
+    enum FieldIdx
+    {
+        FieldIdx_iTOW, ///< index of @b iTOW field
+        FieldIdx_version, ///< index of @b version field
+        FieldIdx_reserved1, ///< index of @b reserved1 field
+        FieldIdx_srcOfCurrLs, ///< index of @b srcOfCurrLs field
+        FieldIdx_currLs, ///< index of @b currLs field
+        FieldIdx_srcOfLsChange, ///< index of @b srcOfLsChange field
+        FieldIdx_lsChange, ///< index of @b lsChange field
+        FieldIdx_timeToLsEvent, ///< index of @b timeToLsEvent field
+        FieldIdx_dateOfLsGpsWn, ///< index of @b dateOfLsGpsWn field
+        FieldIdx_dateOfLsGpsDn, ///< index of @b dateOfLsGpsDn field
+        FieldIdx_reserved2, ///< index of @b reserved2 field
+        FieldIdx_valid, ///< index of @b valid field
+        FieldIdx_numOfValues ///< number of available fields
+    };
+
+    /// @brief Default constructor, creates empty view.
+    NavTimelsView() = default;
+
+    /// @brief Constructor
+    /// @param[in] payload Pointer to the payload of the message.
+    /// @param[in] len Length of the payload.
+    NavTimelsView(const std::uint8_t* payload, std::size_t len)
+      : Base(payload, len)
+    {
+    }
+
+    /// @brief Decode "iTOW" field (see @ref ublox::message::NavTimelsFields::iTOW).
+    comms::ErrorStatus field_iTOW(FieldType<FieldIdx_iTOW>& field) const
+    {
+        return Base::readField<FieldIdx_iTOW>(field);
+    }
+
+    /// @brief Decode "version" field (see @ref ublox::message::NavTimelsFields::version).
+    comms::ErrorStatus field_version(FieldType<FieldIdx_version>& field) const
+    {
+        return Base::readField<FieldIdx_version>(field);
+    }
+
+    /// @brief Decode "reserved1" field (see @ref ublox::message::NavTimelsFields::reserved1).
+    comms::ErrorStatus field_reserved1(FieldType<FieldIdx_reserved1>& field) const
+    {
+        return Base::readField<FieldIdx_reserved1>(field);
+    }
+
+    /// @brief Decode "srcOfCurrLs" field (see @ref ublox::message::NavTimelsFields::srcOfCurrLs).
+    comms::ErrorStatus field_srcOfCurrLs(FieldType<FieldIdx_srcOfCurrLs>& field) const
+    {
+        return Base::readField<FieldIdx_srcOfCurrLs>(field);
+    }
+
+    /// @brief Decode "currLs" field (see @ref ublox::message::NavTimelsFields::currLs).
+    comms::ErrorStatus field_currLs(FieldType<FieldIdx_currLs>& field) const
+    {
+        return Base::readField<FieldIdx_currLs>(field);
+    }
+
+    /// @brief Decode "srcOfLsChange" field (see @ref ublox::message::NavTimelsFields::srcOfLsChange).
+    comms::ErrorStatus field_srcOfLsChange(FieldType<FieldIdx_srcOfLsChange>& field) const
+    {
+        return Base::readField<FieldIdx_srcOfLsChange>(field);
+    }
+
+    /// @brief Decode "lsChange" field (see @ref ublox::message::NavTimelsFields::lsChange).
+    comms::ErrorStatus field_lsChange(FieldType<FieldIdx_lsChange>& field) const
+    {
+        return Base::readField<FieldIdx_lsChange>(field);
+    }
+
+    /// @brief Decode "timeToLsEvent" field (see @ref ublox::message::NavTimelsFields::timeToLsEvent).
+    comms::ErrorStatus field_timeToLsEvent(FieldType<FieldIdx_timeToLsEvent>& field) const
+    {
+        return Base::readField<FieldIdx_timeToLsEvent>(field);
+    }
+
+    /// @brief Decode "dateOfLsGpsWn" field (see @ref ublox::message::NavTimelsFields::dateOfLsGpsWn).
+    comms::ErrorStatus field_dateOfLsGpsWn(FieldType<FieldIdx_dateOfLsGpsWn>& field) const
+    {
+        return Base::readField<FieldIdx_dateOfLsGpsWn>(field);
+    }
+
+    /// @brief Decode "dateOfLsGpsDn" field (see @ref ublox::message::NavTimelsFields::dateOfLsGpsDn).
+    comms::ErrorStatus field_dateOfLsGpsDn(FieldType<FieldIdx_dateOfLsGpsDn>& field) const
+    {
+        return Base::readField<FieldIdx_dateOfLsGpsDn>(field);
+    }
+
+    /// @brief Decode "reserved2" field (see @ref ublox::message::NavTimelsFields::reserved2).
+    comms::ErrorStatus field_reserved2(FieldType<FieldIdx_reserved2>& field) const
+    {
+        return Base::readField<FieldIdx_reserved2>(field);
+    }
+
+    /// @brief Decode "valid" field (see @ref ublox::message::NavTimelsFields::validBits).
+    comms::ErrorStatus field_valid(FieldType<FieldIdx_valid>& field) const
+    {
+        return Base::readField<FieldIdx_valid>(field);
+    }
+};
+
+} // namespace view
+
+} // namespace ublox
+
@@ -0,0 +1,108 @@
+//
+// Copyright 2018 (C). Alex Robenko. All rights reserved.
+//
+
+// This file is free software: you can redistribute it and/or modify
+// it under the terms of the GNU General Public License as published by
+// the Free Software Foundation, either version 3 of the License, or
+// (at your option) any later version.
+//
+// This program is distributed in the hope that it will be useful,
+// but WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+// GNU General Public License for more details.
+//
+// You should have received a copy of the GNU General Public License
+// along with this program.  If not, see <http://www.gnu.org/licenses/>.
+
+/// @file
+/// @brief Contains definition of lazy view of NAV-VELECEF message.
+/// @details Generated by script/gen_views.py, do NOT edit manually.
+
+#pragma once
+
+#include "ublox/message/NavVelecef.h"
+#include "MsgView.h"
+
+namespace ublox
+{
+
+namespace view
+{
+
+/// @brief Lazy read-only view of NAV-VELECEF message payload.
+/// @details Wraps the pointer to the validated payload, the fields are
+///     decoded on access only, see @ref MsgView.
+/// @see @ref ublox::message::NavVelecef
+class NavVelecefView : public
+    MsgView<
+        ublox::message::NavVelecefFields::All
+    >
+{
+    using Base =
+        MsgView<
+            ublox::message::NavVelecefFields::All
+        >;
+
+public:
+    /// @brief ID of the viewed message.
+    static const MsgId MsgIdValue = MsgId_NAV_VELECEF;
+
+    /// @brief Index of the fields, same as the ones defined by
+    ///     @b COMMS_MSG_FIELDS_ACCESS() in @ref ublox::message::NavVelecef.
+    enum FieldIdx
+    {
+        FieldIdx_iTOW, ///< index of @b iTOW field
+        FieldIdx_ecefVX, ///< index of @b ecefVX field
+        FieldIdx_ecefVY, ///< index of @b ecefVY field
+        FieldIdx_ecefVZ, ///< index of @b ecefVZ field
+        FieldIdx_sAcc, ///< index of @b sAcc field
+        FieldIdx_numOfValues ///< number of available fields
+    };
+
+    /// @brief Default constructor, creates empty view.
+    NavVelecefView() = default;
+
+    /// @brief Constructor
+    /// @param[in] payload Pointer to the payload of the message.
+    /// @param[in] len Length of the payload.
+    NavVelecefView(const std::uint8_t* payload, std::size_t len)
+      : Base(payload, len)
+    {
+    }
+
+    /// @brief Decode "iTOW" field (see @ref ublox::message::NavVelecefFields::iTOW).
+    comms::ErrorStatus field_iTOW(FieldType<FieldIdx_iTOW>& field) const
+    {
+        return Base::readField<FieldIdx_iTOW>(field);
+    }
+
+    /// @brief Decode "ecefVX" field (see @ref ublox::message::NavVelecefFields::ecefVX).
+    comms::ErrorStatus field_ecefVX(FieldType<FieldIdx_ecefVX>& field) const
+    {
+        return Base::readField<FieldIdx_ecefVX>(field);
+    }
+
+    /// @brief Decode "ecefVY" field (see @ref ublox::message::NavVelecefFields::ecefVY).
+    comms::ErrorStatus field_ecefVY(FieldType<FieldIdx_ecefVY>& field) const
+    {
+        return Base::readField<FieldIdx_ecefVY>(field);
+    }
+
+    /// @brief Decode "ecefVZ" field (see @ref ublox::message::NavVelecefFields::ecefVZ).
+    comms::ErrorStatus field_ecefVZ(FieldType<FieldIdx_ecefVZ>& field) const
+    {
+        return Base::readField<FieldIdx_ecefVZ>(field);
+    }
+
+    /// @brief Decode "sAcc" field (see @ref ublox::message::NavVelecefFields::sAcc).
+    comms::ErrorStatus field_sAcc(FieldType<FieldIdx_sAcc>& field) const
+    {
+        return Base::readField<FieldIdx_sAcc>(field);
+    }
+};
+
+} // namespace view
+
+} // namespace ublox
+
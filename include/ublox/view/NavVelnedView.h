@@ -0,0 +1,136 @@
+//
+// Copyright 2018 (C). Alex Robenko. All rights reserved.
+//
+
+// This file is free software: you can redistribute it and/or modify
+// it under the terms of the GNU General Public License as published by
+// the Free Software Foundation, either version 3 of the License, or
+// (at your option) any later version.
+//
+// This program is distributed in the hope that it will be useful,
+// but WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+// GNU General Public License for more details.
+//
+// You should have received a copy of the GNU General Public License
+// along with this program.  If not, see <http://www.gnu.org/licenses/>.
+
+/// @file
+/// @brief Contains definition of lazy view of NAV-VELNED message.
+/// @details Generated by script/gen_views.py, do NOT edit manually.
+
+#pragma once
+
+#include "ublox/message/NavVelned.h"
+#include "MsgView.h"
+
+namespace ublox
+{
+
+namespace view
+{
+
+/// @brief Lazy read-only view of NAV-VELNED message payload.
+/// @details Wraps the pointer to the validated payload, the fields are
+///     decoded on access only, see @ref MsgView.
+/// @see @ref ublox::message::NavVelned
+class NavVelnedView : public
+    MsgView<
+        ublox::message::NavVelnedFields::All
+    >
+{
+    using Base =
+        MsgView<
+            ublox::message::NavVelnedFields::All
+        >;
+
+public:
+    /// @brief ID of the viewed message.
+    static const MsgId MsgIdValue = MsgId_NAV_VELNED;
+
+    /// @brief Index of the fields, same as the ones defined by
+    ///     @b COMMS_MSG_FIELDS_ACCESS() in @ref ublox::message::NavVelned.
+    enum FieldIdx
+    {
+        FieldIdx_iTOW, ///< index of @b iTOW field
+        FieldIdx_velN, ///< index of @b velN field
+        FieldIdx_velE, ///< index of @b velE field
+        FieldIdx_velD, ///< index of @b velD field
+        FieldIdx_speed, ///< index of @b speed field
+        FieldIdx_gSpeed, ///< index of @b gSpeed field
+        FieldIdx_heading, ///< index of @b heading field
+        FieldIdx_sAcc, ///< index of @b sAcc field
+        FieldIdx_cAcc, ///< index of @b cAcc field
+        FieldIdx_numOfValues ///< number of available fields
+    };
+
+    /// @brief Default constructor, creates empty view.
+    NavVelnedView() = default;
+
+    /// @brief Constructor
+    /// @param[in] payload Pointer to the payload of the message.
+    /// @param[in] len Length of the payload.
+    NavVelnedView(const std::uint8_t* payload, std::size_t len)
+      : Base(payload, len)
+    {
+    }
+
+    /// @brief Decode "iTOW" field (see @ref ublox::message::NavVelnedFields::iTOW).
+    comms::ErrorStatus field_iTOW(FieldType<FieldIdx_iTOW>& field) const
+    {
+        return Base::readField<FieldIdx_iTOW>(field);
+    }
+
+    /// @brief Decode "velN" field (see @ref ublox::message::NavVelnedFields::velN).
+    comms::ErrorStatus field_velN(FieldType<FieldIdx_velN>& field) const
+    {
+        return Base::readField<FieldIdx_velN>(field);
+    }
+
+    /// @brief Decode "velE" field (see @ref ublox::message::NavVelnedFields::velE).
+    comms::ErrorStatus field_velE(FieldType<FieldIdx_velE>& field) const
+    {
+        return Base::readField<FieldIdx_velE>(field);
+    }
+
+    /// @brief Decode "velD" field (see @ref ublox::message::NavVelnedFields::velD).
+    comms::ErrorStatus field_velD(FieldType<FieldIdx_velD>& field) const
+    {
+        return Base::readField<FieldIdx_velD>(field);
+    }
+
+    /// @brief Decode "speed" field (see @ref ublox::message::NavVelnedFields::speed).
+    comms::ErrorStatus field_speed(FieldType<FieldIdx_speed>& field) const
+    {
+        return Base::readField<FieldIdx_speed>(field);
+    }
+
+    /// @brief Decode "gSpeed" field (see @ref ublox::message::NavVelnedFields::gSpeed).
+    comms::ErrorStatus field_gSpeed(FieldType<FieldIdx_gSpeed>& field) const
+    {
+        return Base::readField<FieldIdx_gSpeed>(field);
+    }
+
+    /// @brief Decode "heading" field (see @ref ublox::message::NavVelnedFields::heading).
+    comms::ErrorStatus field_heading(FieldType<FieldIdx_heading>& field) const
+    {
+        return Base::readField<FieldIdx_heading>(field);
+    }
+
+    /// @brief Decode "sAcc" field (see @ref ublox::message::NavVelnedFields::sAcc).
+    comms::ErrorStatus field_sAcc(FieldType<FieldIdx_sAcc>& field) const
+    {
+        return Base::readField<FieldIdx_sAcc>(field);
+    }
+
+    /// @brief Decode "cAcc" field (see @ref ublox::message::NavVelnedFields::cAcc).
+    comms::ErrorStatus field_cAcc(FieldType<FieldIdx_cAcc>& field) const
+    {
+        return Base::readField<FieldIdx_cAcc>(field);
+    }
+};
+
+} // namespace view
+
+} // namespace ublox
+
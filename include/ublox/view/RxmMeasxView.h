@@ -0,0 +1,189 @@
+//
+// Copyright 2018 (C). Alex Robenko. All rights reserved.
+//
+
+// This file is free software: you can redistribute it and/or modify
+// it under the terms of the GNU General Public License as published by
+// the Free Software Foundation, either version 3 of the License, or
+// (at your option) any later version.
+//
+// This program is distributed in the hope that it will be useful,
+// but WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+// GNU General Public License for more details.
+//
+// You should have received a copy of the GNU General Public License
+// along with this program.  If not, see <http://www.gnu.org/licenses/>.
+
+/// @file
+/// @brief Contains definition of lazy view of RXM-MEASX message.
+/// @details Generated by script/gen_views.py, do NOT edit manually.
+
+#pragma once
+
+#include "ublox/message/RxmMeasx.h"
+#include "MsgView.h"
+
+namespace ublox
+{
+
+namespace view
+{
+
+/// @brief Lazy read-only view of RXM-MEASX message payload.
+/// @details Wraps the pointer to the validated payload, the fields are
+///     decoded on access only, see @ref MsgView.
+///     The message performs custom read of its fields, the fields starting
+///     from "data" are not accessible through the view, because their
+///     presence and/or size depend on the values of preceding fields.
+/// @see @ref ublox::message::RxmMeasx
+class RxmMeasxView : public
+    MsgView<
+        ublox::message::RxmMeasxFields::All<comms::option::EmptyOption>
+    >
+{
+    using Base =
+        MsgView<
+            ublox::message::RxmMeasxFields::All<comms::option::EmptyOption>
+        >;
+
+public:
+    /// @brief ID of the viewed message.
+    static const MsgId MsgIdValue = MsgId_RXM_MEASX;
+
+    /// @brief Index of the fields, same as the ones defined by
+    ///     @b COMMS_MSG_FIELDS_ACCESS() in @ref ublox::message::RxmMeasx.
+    enum FieldIdx
+    {
+        FieldIdx_version, ///< index of @b version field
+        FieldIdx_reserved1, ///< index of @b reserved1 field
+        FieldIdx_gpsTOW, ///< index of @b gpsTOW field
+        FieldIdx_gloTOW, ///< index of @b gloTOW field
+        FieldIdx_bdsTOW, ///< index of @b bdsTOW field
+        FieldIdx_reserved2, ///< index of @b reserved2 field
+        FieldIdx_qzssTOW, ///< index of @b qzssTOW field
+        FieldIdx_gpsTOWacc, ///< index of @b gpsTOWacc field
+        FieldIdx_gloTOWacc, ///< index of @b gloTOWacc field
+        FieldIdx_bdsTOWacc, ///< index of @b bdsTOWacc field
+        FieldIdx_reserved3, ///< index of @b reserved3 field
+        FieldIdx_qzssTOWacc, ///< index of @b qzssTOWacc field
+        FieldIdx_numSV, ///< index of @b numSV field
+        FieldIdx_flags, ///< index of @b flags field
+        FieldIdx_reserved4, ///< index of @b reserved4 field
+        FieldIdx_reserved5, ///< index of @b reserved5 field
+        FieldIdx_data, ///< index of @b data field
+        FieldIdx_numOfValues ///< number of available fields
+    };
+
+    /// @brief Default constructor, creates empty view.
+    RxmMeasxView() = default;
+
+    /// @brief Constructor
+    /// @param[in] payload Pointer to the payload of the message.
+    /// @param[in] len Length of the payload.
+    RxmMeasxView(const std::uint8_t* payload, std::size_t len)
+      : Base(payload, len)
+    {
+    }
+
+    /// @brief Decode "version" field (see @ref ublox::message::RxmMeasxFields::version).
+    comms::ErrorStatus field_version(FieldType<FieldIdx_version>& field) const
+    {
+        return Base::readField<FieldIdx_version>(field);
+    }
+
+    /// @brief Decode "reserved1" field (see @ref ublox::message::RxmMeasxFields::reserved1).
+    comms::ErrorStatus field_reserved1(FieldType<FieldIdx_reserved1>& field) const
+    {
+        return Base::readField<FieldIdx_reserved1>(field);
+    }
+
+    /// @brief Decode "gpsTOW" field (see @ref ublox::message::RxmMeasxFields::gpsTOW).
+    comms::ErrorStatus field_gpsTOW(FieldType<FieldIdx_gpsTOW>& field) const
+    {
+        return Base::readField<FieldIdx_gpsTOW>(field);
+    }
+
+    /// @brief Decode "gloTOW" field (see @ref ublox::message::RxmMeasxFields::gloTOW).
+    comms::ErrorStatus field_gloTOW(FieldType<FieldIdx_gloTOW>& field) const
+    {
+        return Base::readField<FieldIdx_gloTOW>(field);
+    }
+
+    /// @brief Decode "bdsTOW" field (see @ref ublox::message::RxmMeasxFields::bdsTOW).
+    comms::ErrorStatus field_bdsTOW(FieldType<FieldIdx_bdsTOW>& field) const
+    {
+        return Base::readField<FieldIdx_bdsTOW>(field);
+    }
+
+    /// @brief Decode "reserved2" field (see @ref ublox::message::RxmMeasxFields::reserved2).
+    comms::ErrorStatus field_reserved2(FieldType<FieldIdx_reserved2>& field) const
+    {
+        return Base::readField<FieldIdx_reserved2>(field);
+    }
+
+    /// @brief Decode "qzssTOW" field (see @ref ublox::message::RxmMeasxFields::qzssTOW).
+    comms::ErrorStatus field_qzssTOW(FieldType<FieldIdx_qzssTOW>& field) const
+    {
+        return Base::readField<FieldIdx_qzssTOW>(field);
+    }
+
+    /// @brief Decode "gpsTOWacc" field (see @ref ublox::message::RxmMeasxFields::gpsTOWacc).
+    comms::ErrorStatus field_gpsTOWacc(FieldType<FieldIdx_gpsTOWacc>& field) const
+    {
+        return Base::readField<FieldIdx_gpsTOWacc>(field);
+    }
+
+    /// @brief Decode "gloTOWacc" field (see @ref ublox::message::RxmMeasxFields::gloTOWacc).
+    comms::ErrorStatus field_gloTOWacc(FieldType<FieldIdx_gloTOWacc>& field) const
+    {
+        return Base::readField<FieldIdx_gloTOWacc>(field);
+    }
+
+    /// @brief Decode "bdsTOWacc" field (see @ref ublox::message::RxmMeasxFields::bdsTOWacc).
+    comms::ErrorStatus field_bdsTOWacc(FieldType<FieldIdx_bdsTOWacc>& field) const
+    {
+        return Base::readField<FieldIdx_bdsTOWacc>(field);
+    }
+
+    /// @brief Decode "reserved3" field (see @ref ublox::message::RxmMeasxFields::reserved3).
+    comms::ErrorStatus field_reserved3(FieldType<FieldIdx_reserved3>& field) const
+    {
+        return Base::readField<FieldIdx_reserved3>(field);
+    }
+
+    /// @brief Decode "qzssTOWacc" field (see @ref ublox::message::RxmMeasxFields::qzssTOWacc).
+    comms::ErrorStatus field_qzssTOWacc(FieldType<FieldIdx_qzssTOWacc>& field) const
+    {
+        return Base::readField<FieldIdx_qzssTOWacc>(field);
+    }
+
+    /// @brief Decode "numSV" field (see @ref ublox::message::RxmMeasxFields::numSV).
+    comms::ErrorStatus field_numSV(FieldType<FieldIdx_numSV>& field) const
+    {
+        return Base::readField<FieldIdx_numSV>(field);
+    }
+
+    /// @brief Decode "flags" field (see @ref ublox::message::RxmMeasxFields::flags).
+    comms::ErrorStatus field_flags(FieldType<FieldIdx_flags>& field) const
+    {
+        return Base::readField<FieldIdx_flags>(field);
+    }
+
+    /// @brief Decode "reserved4" field (see @ref ublox::message::RxmMeasxFields::reserved4).
+    comms::ErrorStatus field_reserved4(FieldType<FieldIdx_reserved4>& field) const
+    {
+        return Base::readField<FieldIdx_reserved4>(field);
+    }
+
+    /// @brief Decode "reserved5" field (see @ref ublox::message::RxmMeasxFields::reserved5).
+    comms::ErrorStatus field_reserved5(FieldType<FieldIdx_reserved5>& field) const
+    {
+        return Base::readField<FieldIdx_reserved5>(field);
+    }
+};
+
+} // namespace view
+
+} // namespace ublox
+
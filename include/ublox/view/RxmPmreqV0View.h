@@ -0,0 +1,108 @@
+//
+// Copyright 2018 (C). Alex Robenko. All rights reserved.
+//
+
+// This file is free software: you can redistribute it and/or modify
+// it under the terms of the GNU General Public License as published by
+// the Free Software Foundation, either version 3 of the License, or
+// (at your option) any later version.
+//
+// This program is distributed in the hope that it will be useful,
+// but WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+// GNU General Public License for more details.
+//
+// You should have received a copy of the GNU General Public License
+// along with this program.  If not, see <http://www.gnu.org/licenses/>.
+
+/// @file
+/// @brief Contains definition of lazy view of RXM-PMREQ (version 0) message.
+/// @details Generated by script/gen_views.py, do NOT edit manually.
+
+#pragma once
+
+#include "ublox/message/RxmPmreqV0.h"
+#include "MsgView.h"
+
+namespace ublox
+{
+
+namespace view
+{
+
+/// @brief Lazy read-only view of RXM-PMREQ (version 0) message payload.
+/// @details Wraps the pointer to the validated payload, the fields are
+///     decoded on access only, see @ref MsgView.
+/// @see @ref ublox::message::RxmPmreqV0
+class RxmPmreqV0View : public
+    MsgView<
+        ublox::message::RxmPmreqV0Fields::All
+    >
+{
+    using Base =
+        MsgView<
+            ublox::message::RxmPmreqV0Fields::All
+        >;
+
+public:
+    /// @brief ID of the viewed message.
+    static const MsgId MsgIdValue = MsgId_RXM_PMREQ;
+
+    /// @brief Index of the fields, same as the ones defined by
+    ///     @b COMMS_MSG_FIELDS_ACCESS() in @ref ublox::message::RxmPmreqV0.
+    enum FieldIdx
+    {
+        FieldIdx_version, ///< index of @b version field
+        FieldIdx_reserved1, ///< index of @b reserved1 field
+        FieldIdx_duration, ///< index of @b duration field
+        FieldIdx_flags, ///< index of @b flags field
+        FieldIdx_wakeupSources, ///< index of @b wakeupSources field
+        FieldIdx_numOfValues ///< number of available fields
+    };
+
+    /// @brief Default constructor, creates empty view.
+    RxmPmreqV0View() = default;
+
+    /// @brief Constructor
+    /// @param[in] payload Pointer to the payload of the message.
+    /// @param[in] len Length of the payload.
+    RxmPmreqV0View(const std::uint8_t* payload, std::size_t len)
+      : Base(payload, len)
+    {
+    }
+
+    /// @brief Decode "version" field (see @ref ublox::message::RxmPmreqV0Fields::version).
+    comms::ErrorStatus field_version(FieldType<FieldIdx_version>& field) const
+    {
+        return Base::readField<FieldIdx_version>(field);
+    }
+
+    /// @brief Decode "reserved1" field (see @ref ublox::message::RxmPmreqV0Fields::reserved1).
+    comms::ErrorStatus field_reserved1(FieldType<FieldIdx_reserved1>& field) const
+    {
+        return Base::readField<FieldIdx_reserved1>(field);
+    }
+
+    /// @brief Decode "duration" field (see @ref ublox::message::RxmPmreqV0Fields::duration).
+    comms::ErrorStatus field_duration(FieldType<FieldIdx_duration>& field) const
+    {
+        return Base::readField<FieldIdx_duration>(field);
+    }
+
+    /// @brief Decode "flags" field (see @ref ublox::message::RxmPmreqV0Fields::flags).
+    comms::ErrorStatus field_flags(FieldType<FieldIdx_flags>& field) const
+    {
+        return Base::readField<FieldIdx_flags>(field);
+    }
+
+    /// @brief Decode "wakeupSources" field (see @ref ublox::message::RxmPmreqV0Fields::wakeupSources).
+    comms::ErrorStatus field_wakeupSources(FieldType<FieldIdx_wakeupSources>& field) const
+    {
+        return Base::readField<FieldIdx_wakeupSources>(field);
+    }
+};
+
+} // namespace view
+
+} // namespace ublox
+
@@ -0,0 +1,275 @@
+//
+// Copyright 2018 (C). Alex Robenko. All rights reserved.
+//
+
+// This file is free software: you can redistribute it and/or modify
+// it under the terms of the GNU General Public License as published by
+// the Free Software Foundation, either version 3 of the License, or
+// (at your option) any later version.
+//
+// This program is distributed in the hope that it will be useful,
+// but WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+// GNU General Public License for more details.
+//
+// You should have received a copy of the GNU General Public License
+// along with this program.  If not, see <http://www.gnu.org/licenses/>.
+
+/// @file
+/// @brief Contains batch (structure of arrays) decoder of RXM-RAWX message payload.
+
+#pragma once
+
+#include <cstdint>
+#include <cstddef>
+#include <cstring>
+
+#include "comms/ErrorStatus.h"
+
+#if !defined(UBLOX_RAWX_NO_SIMD)
+#if defined(__SSE2__) || defined(_M_X64) || (defined(_M_IX86_FP) && (_M_IX86_FP >= 2))
+#include <emmintrin.h>
+#define UBLOX_RAWX_SSE2
+#endif
+#endif // #if !defined(UBLOX_RAWX_NO_SIMD)
+
+namespace ublox
+{
+
+namespace view
+{
+
+/// @brief Epoch information (fields preceding the measurement blocks) of
+///     RXM-RAWX message.
+/// @see ublox::message::RxmRawxFields
+struct RxmRawxEpoch
+{
+    double m_rcvTow = 0.0; ///< Value of @b rcvTow field (seconds)
+    std::uint16_t m_week = 0U; ///< Value of @b week field
+    std::int8_t m_leapS = 0; ///< Value of @b leapS field
+    std::uint8_t m_numMeas = 0U; ///< Value of @b numMeas field
+    std::uint8_t m_recStat = 0U; ///< Value of @b recStat field
+    std::uint8_t m_version = 0U; ///< Value of @b version field
+};
+
+/// @brief Caller provided column buffers for measurement blocks
+///     of RXM-RAWX message.
+/// @details Every buffer must be able to contain at least @ref m_capacity
+///     elements. The measurement with index @b i is stored as @b i-th
+///     element of every column. All the buffers must be provided.
+///     The values are raw ones, i.e. not scaled, the same
+///     as reported by @b value() member function of the relevant
+///     fields in ublox::message::RxmRawxFields.
+struct RxmRawxColumns
+{
+    double* m_prMes = nullptr; ///< Values of @b prMes fields (meters)
+    double* m_cpMes = nullptr; ///< Values of @b cpMes fields (cycles)
+    double* m_doMes = nullptr; ///< Values of @b doMes fields (Hz), converted from @b float
+    std::uint8_t* m_gnssId = nullptr; ///< Values of @b gnssId fields
+    std::uint8_t* m_svId = nullptr; ///< Values of @b svId fields
+    std::uint8_t* m_freqId = nullptr; ///< Values of @b freqId fields
+    std::uint16_t* m_locktime = nullptr; ///< Values of @b locktime fields (ms)
+    std::uint8_t* m_cno = nullptr; ///< Values of @b cno fields
+    std::uint8_t* m_prStdev = nullptr; ///< Values of @b prStdev fields
+    std::uint8_t* m_cpStdev = nullptr; ///< Values of @b cpStdev fields
+    std::uint8_t* m_doStdev = nullptr; ///< Values of @b doStdev fields
+    std::uint8_t* m_trkStat = nullptr; ///< Values of @b trkStat fields
+    std::size_t m_capacity = 0U; ///< Capacity of every buffer
+};
+
+namespace details
+{
+
+static const std::size_t RxmRawxHeaderLen = 16U;
+static const std::size_t RxmRawxBlockLen = 32U;
+
+inline std::uint16_t rxmRawxU16(const std::uint8_t* data)
+{
+    return static_cast<std::uint16_t>(data[0] | (static_cast<unsigned>(data[1]) << 8));
+}
+
+inline std::uint32_t rxmRawxU32(const std::uint8_t* data)
+{
+    return
+        static_cast<std::uint32_t>(data[0]) |
+        (static_cast<std::uint32_t>(data[1]) << 8) |
+        (static_cast<std::uint32_t>(data[2]) << 16) |
+        (static_cast<std::uint32_t>(data[3]) << 24);
+}
+
+inline double rxmRawxF64(const std::uint8_t* data)
+{
+    auto bits =
+        static_cast<std::uint64_t>(rxmRawxU32(data)) |
+        (static_cast<std::uint64_t>(rxmRawxU32(data + 4)) << 32);
+    double value = 0.0;
+    std::memcpy(&value, &bits, sizeof(value));
+    return value;
+}
+
+inline float rxmRawxF32(const std::uint8_t* data)
+{
+    auto bits = rxmRawxU32(data);
+    float value = 0.0f;
+    std::memcpy(&value, &bits, sizeof(value));
+    return value;
+}
+
+inline void rxmRawxDecodeBlocksScalar(
+    const std::uint8_t* blocks,
+    std::size_t from,
+    std::size_t count,
+    const RxmRawxColumns& columns)
+{
+    for (auto idx = from; idx < count; ++idx) {
+        auto* block = blocks + (idx * RxmRawxBlockLen);
+        columns.m_prMes[idx] = rxmRawxF64(block);
+        columns.m_cpMes[idx] = rxmRawxF64(block + 8);
+        columns.m_doMes[idx] = static_cast<double>(rxmRawxF32(block + 16));
+        columns.m_gnssId[idx] = block[20];
+        columns.m_svId[idx] = block[21];
+        columns.m_freqId[idx] = block[23];
+        columns.m_locktime[idx] = rxmRawxU16(block + 24);
+        columns.m_cno[idx] = block[26];
+        columns.m_prStdev[idx] = block[27];
+        columns.m_cpStdev[idx] = block[28];
+        columns.m_doStdev[idx] = block[29];
+        columns.m_trkStat[idx] = block[30];
+    }
+}
+
+#if defined(UBLOX_RAWX_SSE2)
+
+inline void rxmRawxStoreBytes(std::uint8_t* dest, __m128i words, int shift)
+{
+    auto values = _mm_and_si128(_mm_srl_epi32(words, _mm_cvtsi32_si128(shift)), _mm_set1_epi32(0xff));
+    values = _mm_packs_epi32(values, values);
+    values = _mm_packus_epi16(values, values);
+    auto packed = _mm_cvtsi128_si32(values);
+    std::memcpy(dest, &packed, 4U);
+}
+
+// Processes 4 blocks per iteration: the (prMes, cpMes) pairs are
+// de-interleaved with 64 bit unpacks, the remaining 16 bytes of every block
+// are transposed as 4x4 matrix of 32 bit words, so every word holds
+// the same fields of 4 consecutive blocks.
+inline std::size_t rxmRawxDecodeBlocksSimd(
+    const std::uint8_t* blocks,
+    std::size_t count,
+    const RxmRawxColumns& columns)
+{
+    static const std::size_t BlocksPerIter = 4U;
+    std::size_t idx = 0U;
+    for (; (idx + BlocksPerIter) <= count; idx += BlocksPerIter) {
+        auto* block = blocks + (idx * RxmRawxBlockLen);
+        for (std::size_t pair = 0U; pair < BlocksPerIter; pair += 2U) {
+            auto* first = block + (pair * RxmRawxBlockLen);
+            auto* second = first + RxmRawxBlockLen;
+            auto firstMes = _mm_loadu_pd(reinterpret_cast<const double*>(first));
+            auto secondMes = _mm_loadu_pd(reinterpret_cast<const double*>(second));
+            _mm_storeu_pd(columns.m_prMes + idx + pair, _mm_unpacklo_pd(firstMes, secondMes));
+            _mm_storeu_pd(columns.m_cpMes + idx + pair, _mm_unpackhi_pd(firstMes, secondMes));
+        }
+
+        auto row0 = _mm_loadu_si128(reinterpret_cast<const __m128i*>(block + 16));
+        auto row1 = _mm_loadu_si128(reinterpret_cast<const __m128i*>(block + RxmRawxBlockLen + 16));
+        auto row2 = _mm_loadu_si128(reinterpret_cast<const __m128i*>(block + (2 * RxmRawxBlockLen) + 16));
+        auto row3 = _mm_loadu_si128(reinterpret_cast<const __m128i*>(block + (3 * RxmRawxBlockLen) + 16));
+
+        auto tmp0 = _mm_unpacklo_epi32(row0, row1);
+        auto tmp1 = _mm_unpacklo_epi32(row2, row3);
+        auto tmp2 = _mm_unpackhi_epi32(row0, row1);
+        auto tmp3 = _mm_unpackhi_epi32(row2, row3);
+
+        auto doMes = _mm_castsi128_ps(_mm_unpacklo_epi64(tmp0, tmp1)); // doMes
+        auto word1 = _mm_unpackhi_epi64(tmp0, tmp1); // gnssId, svId, reserved2, freqId
+        auto word2 = _mm_unpacklo_epi64(tmp2, tmp3); // locktime, cno, prStdev
+        auto word3 = _mm_unpackhi_epi64(tmp2, tmp3); // cpStdev, doStdev, trkStat, reserved3
+
+        _mm_storeu_pd(columns.m_doMes + idx, _mm_cvtps_pd(doMes));
+        _mm_storeu_pd(columns.m_doMes + idx + 2, _mm_cvtps_pd(_mm_movehl_ps(doMes, doMes)));
+
+        rxmRawxStoreBytes(columns.m_gnssId + idx, word1, 0);
+        rxmRawxStoreBytes(columns.m_svId + idx, word1, 8);
+        rxmRawxStoreBytes(columns.m_freqId + idx, word1, 24);
+        rxmRawxStoreBytes(columns.m_cno + idx, word2, 16);
+        rxmRawxStoreBytes(columns.m_prStdev + idx, word2, 24);
+        rxmRawxStoreBytes(columns.m_cpStdev + idx, word3, 0);
+        rxmRawxStoreBytes(columns.m_doStdev + idx, word3, 8);
+        rxmRawxStoreBytes(columns.m_trkStat + idx, word3, 16);
+
+        // Sign extension keeps the 16 bit pattern intact during signed saturation
+        auto locktime = _mm_srai_epi32(_mm_slli_epi32(word2, 16), 16);
+        locktime = _mm_packs_epi32(locktime, locktime);
+        _mm_storel_epi64(reinterpret_cast<__m128i*>(columns.m_locktime + idx), locktime);
+    }
+    return idx;
+}
+
+#endif // #if defined(UBLOX_RAWX_SSE2)
+
+} // namespace details
+
+/// @brief Decode payload of RXM-RAWX message into caller provided
+///     column buffers.
+/// @details Unlike reading ublox::message::RxmRawx message, no field
+///     objects or dynamic memory allocation are involved, all the measurement
+///     blocks are decoded in a single loop directly into the provided
+///     buffers (structure of arrays). When SSE2 instructions are
+///     available (can be disabled by defining @b UBLOX_RAWX_NO_SIMD), four
+///     blocks are processed per iteration.
+/// @param[in] payload Pointer to the payload of the message.
+/// @param[in] len Length of the payload.
+/// @param[out] epoch Epoch information.
+/// @param[out] columns Buffers to store the measurements into.
+/// @param[out] count Number of decoded measurements.
+/// @return Status of the operation:
+///     @li @b comms::ErrorStatus::Success on success.
+///     @li @b comms::ErrorStatus::NotEnoughData when the payload is shorter
+///         than reported number of measurements require.
+///     @li @b comms::ErrorStatus::BufferOverflow when the number of
+///         measurements exceeds the capacity of the buffers.
+inline comms::ErrorStatus decodeRxmRawx(
+    const std::uint8_t* payload,
+    std::size_t len,
+    RxmRawxEpoch& epoch,
+    const RxmRawxColumns& columns,
+    std::size_t& count)
+{
+    count = 0U;
+    if (len < details::RxmRawxHeaderLen) {
+        return comms::ErrorStatus::NotEnoughData;
+    }
+
+    epoch.m_rcvTow = details::rxmRawxF64(payload);
+    epoch.m_week = details::rxmRawxU16(payload + 8);
+    epoch.m_leapS = static_cast<std::int8_t>(payload[10]);
+    epoch.m_numMeas = payload[11];
+    epoch.m_recStat = payload[12];
+    epoch.m_version = payload[13];
+
+    std::size_t numMeas = epoch.m_numMeas;
+    if (len < (details::RxmRawxHeaderLen + (numMeas * details::RxmRawxBlockLen))) {
+        return comms::ErrorStatus::NotEnoughData;
+    }
+
+    if (columns.m_capacity < numMeas) {
+        return comms::ErrorStatus::BufferOverflow;
+    }
+
+    auto* blocks = payload + details::RxmRawxHeaderLen;
+    std::size_t decoded = 0U;
+#if defined(UBLOX_RAWX_SSE2)
+    decoded = details::rxmRawxDecodeBlocksSimd(blocks, numMeas, columns);
+#endif
+
+    details::rxmRawxDecodeBlocksScalar(blocks, decoded, numMeas, columns);
+    count = numMeas;
+    return comms::ErrorStatus::Success;
+}
+
+} // namespace view
+
+} // namespace ublox
+
+
@@ -0,0 +1,126 @@
+//
+// Copyright 2018 (C). Alex Robenko. All rights reserved.
+//
+
+// This file is free software: you can redistribute it and/or modify
+// it under the terms of the GNU General Public License as published by
+// the Free Software Foundation, either version 3 of the License, or
+// (at your option) any later version.
+//
+// This program is distributed in the hope that it will be useful,
+// but WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+// GNU General Public License for more details.
+//
+// You should have received a copy of the GNU General Public License
+// along with this program.  If not, see <http://www.gnu.org/licenses/>.
+
+/// @file
+/// @brief Contains definition of lazy view of RXM-RAWX message.
+/// @details Generated by script/gen_views.py, do NOT edit manually.
+
+#pragma once
+
+#include "ublox/message/RxmRawx.h"
+#include "MsgView.h"
+
+namespace ublox
+{
+
+namespace view
+{
+
+/// @brief Lazy read-only view of RXM-RAWX message payload.
+/// @details Wraps the pointer to the validated payload, the fields are
+///     decoded on access only, see @ref MsgView.
+///     The message performs custom read of its fields, the fields starting
+///     from "data" are not accessible through the view, because their
+///     presence and/or size depend on the values of preceding fields.
+/// @see @ref ublox::message::RxmRawx
+class RxmRawxView : public
+    MsgView<
+        ublox::message::RxmRawxFields::All<comms::option::EmptyOption>
+    >
+{
+    using Base =
+        MsgView<
+            ublox::message::RxmRawxFields::All<comms::option::EmptyOption>
+        >;
+
+public:
+    /// @brief ID of the viewed message.
+    static const MsgId MsgIdValue = MsgId_RXM_RAWX;
+
+    /// @brief Index of the fields, same as the ones defined by
+    ///     @b COMMS_MSG_FIELDS_ACCESS() in @ref ublox::message::RxmRawx.
+    enum FieldIdx
+    {
+        FieldIdx_rcvTow, ///< index of @b rcvTow field
+        FieldIdx_week, ///< index of @b week field
+        FieldIdx_leapS, ///< index of @b leapS field
+        FieldIdx_numMeas, ///< index of @b numMeas field
+        FieldIdx_recStat, ///< index of @b recStat field
+        FieldIdx_version, ///< index of @b version field
+        FieldIdx_reserved1, ///< index of @b reserved1 field
+        FieldIdx_data, ///< index of @b data field
+        FieldIdx_numOfValues ///< number of available fields
+    };
+
+    /// @brief Default constructor, creates empty view.
+    RxmRawxView() = default;
+
+    /// @brief Constructor
+    /// @param[in] payload Pointer to the payload of the message.
+    /// @param[in] len Length of the payload.
+    RxmRawxView(const std::uint8_t* payload, std::size_t len)
+      : Base(payload, len)
+    {
+    }
+
+    /// @brief Decode "rcvTow" field (see @ref ublox::message::RxmRawxFields::rcvTow).
+    comms::ErrorStatus field_rcvTow(FieldType<FieldIdx_rcvTow>& field) const
+    {
+        return Base::readField<FieldIdx_rcvTow>(field);
+    }
+
+    /// @brief Decode "week" field (see @ref ublox::message::RxmRawxFields::week).
+    comms::ErrorStatus field_week(FieldType<FieldIdx_week>& field) const
+    {
+        return Base::readField<FieldIdx_week>(field);
+    }
+
+    /// @brief Decode "leapS" field (see @ref ublox::message::RxmRawxFields::leapS).
+    comms::ErrorStatus field_leapS(FieldType<FieldIdx_leapS>& field) const
+    {
+        return Base::readField<FieldIdx_leapS>(field);
+    }
+
+    /// @brief Decode "numMeas" field (see @ref ublox::message::RxmRawxFields::numMeas).
+    comms::ErrorStatus field_numMeas(FieldType<FieldIdx_numMeas>& field) const
+    {
+        return Base::readField<FieldIdx_numMeas>(field);
+    }
+
+    /// @brief Decode "recStat" field (see @ref ublox::message::RxmRawxFields::recStat).
+    comms::ErrorStatus field_recStat(FieldType<FieldIdx_recStat>& field) const
+    {
+        return Base::readField<FieldIdx_recStat>(field);
+    }
+
+    /// @brief Decode "version" field (see @ref ublox::message::RxmRawxFields::version).
+    comms::ErrorStatus field_version(FieldType<FieldIdx_version>& field) const
+    {
+        return Base::readField<FieldIdx_version>(field);
+    }
+
+    /// @brief Decode "reserved1" field (see @ref ublox::message::RxmRawxFields::reserved1).
+    comms::ErrorStatus field_reserved1(FieldType<FieldIdx_reserved1>& field) const
+    {
+        return Base::readField<FieldIdx_reserved1>(field);
+    }
+};
+
+} // namespace view
+
+} // namespace ublox
+
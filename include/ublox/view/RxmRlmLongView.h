@@ -0,0 +1,150 @@
+//
+// Copyright 2018 (C). Alex Robenko. All rights reserved.
+//
+
+// This file is free software: you can redistribute it and/or modify
+// it under the terms of the GNU General Public License as published by
+// the Free Software Foundation, either version 3 of the License, or
+// (at your option) any later version.
+//
+// This program is distributed in the hope that it will be useful,
+// but WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+// GNU General Public License for more details.
+//
+// You should have received a copy of the GNU General Public License
+// along with this program.  If not, see <http://www.gnu.org/licenses/>.
+
+/// @file
+/// @brief Contains definition of lazy view of RXM-RLM (@b long) message.
+/// @details Generated by script/gen_views.py, do NOT edit manually.
+
+#pragma once
+
+#include "ublox/message/RxmRlmLong.h"
+#include "MsgView.h"
+
+namespace ublox
+{
+
+namespace view
+{
+
+/// @brief Lazy read-only view of RXM-RLM (@b long) message payload.
+/// @details Wraps the pointer to the validated payload, the fields are
+///     decoded on access only, see @ref MsgView.
+/// @see @ref ublox::message::RxmRlmLong
+class RxmRlmLongView : public
+    MsgView<
+        ublox::message::RxmRlmLongFields::All
+    >
+{
+    using Base =
+        MsgView<
+            ublox::message::RxmRlmLongFields::All
+        >;
+
+public:
+    /// @brief ID of the viewed message.
+    static const MsgId MsgIdValue = MsgId_RXM_RLM;
+
+    /// @brief Index of the fields, same as the ones defined by
+    ///     @b COMMS_MSG_FIELDS_ACCESS() in @ref ublox::message::RxmRlmLong.
+    enum FieldIdx
+    {
+        FieldIdx_version, ///< index of @b version field
+        FieldIdx_type, ///< index of @b type field
+        FieldIdx_svId, ///< index of @b svId field
+        FieldIdx_reserved1, ///< index of @b reserved1 field
+        FieldIdx_beacon_1, ///< index of @b beacon_1 field
+        FieldIdx_beacon_2, ///< index of @b beacon_2 field
+        FieldIdx_message, ///< index of @b message field
+        FieldIdx_params_1, ///< index of @b params_1 field
+        FieldIdx_params_2, ///< index of @b params_2 field
+        FieldIdx_params_3, ///< index of @b params_3 field
+        FieldIdx_reserved2, ///< index of @b reserved2 field
+        FieldIdx_numOfValues ///< number of available fields
+    };
+
+    /// @brief Default constructor, creates empty view.
+    RxmRlmLongView() = default;
+
+    /// @brief Constructor
+    /// @param[in] payload Pointer to the payload of the message.
+    /// @param[in] len Length of the payload.
+    RxmRlmLongView(const std::uint8_t* payload, std::size_t len)
+      : Base(payload, len)
+    {
+    }
+
+    /// @brief Decode "version" field (see @ref ublox::message::RxmRlmLongFields::version).
+    comms::ErrorStatus field_version(FieldType<FieldIdx_version>& field) const
+    {
+        return Base::readField<FieldIdx_version>(field);
+    }
+
+    /// @brief Decode "type" field (see @ref ublox::message::RxmRlmLongFields::type).
+    comms::ErrorStatus field_type(FieldType<FieldIdx_type>& field) const
+    {
+        return Base::readField<FieldIdx_type>(field);
+    }
+
+    /// @brief Decode "svId" field (see @ref ublox::message::RxmRlmLongFields::svId).
+    comms::ErrorStatus field_svId(FieldType<FieldIdx_svId>& field) const
+    {
+        return Base::readField<FieldIdx_svId>(field);
+    }
+
+    /// @brief Decode "reserved1" field (see @ref ublox::message::RxmRlmLongFields::reserved1).
+    comms::ErrorStatus field_reserved1(FieldType<FieldIdx_reserved1>& field) const
+    {
+        return Base::readField<FieldIdx_reserved1>(field);
+    }
+
+    /// @brief Decode "beacon_1" field (see @ref ublox::message::RxmRlmLongFields::beacon_1).
+    comms::ErrorStatus field_beacon_1(FieldType<FieldIdx_beacon_1>& field) const
+    {
+        return Base::readField<FieldIdx_beacon_1>(field);
+    }
+
+    /// @brief Decode "beacon_2" field (see @ref ublox::message::RxmRlmLongFields::beacon_2).
+    comms::ErrorStatus field_beacon_2(FieldType<FieldIdx_beacon_2>& field) const
+    {
+        return Base::readField<FieldIdx_beacon_2>(field);
+    }
+
+    /// @brief Decode "message" field (see @ref ublox::message::RxmRlmLongFields::message).
+    comms::ErrorStatus field_message(FieldType<FieldIdx_message>& field) const
+    {
+        return Base::readField<FieldIdx_message>(field);
+    }
+
+    /// @brief Decode "params_1" field (see @ref ublox::message::RxmRlmLongFields::params_1).
+    comms::ErrorStatus field_params_1(FieldType<FieldIdx_params_1>& field) const
+    {
+        return Base::readField<FieldIdx_params_1>(field);
+    }
+
+    /// @brief Decode "params_2" field (see @ref ublox::message::RxmRlmLongFields::params_2).
+    comms::ErrorStatus field_params_2(FieldType<FieldIdx_params_2>& field) const
+    {
+        return Base::readField<FieldIdx_params_2>(field);
+    }
+
+    /// @brief Decode "params_3" field (see @ref ublox::message::RxmRlmLongFields::params_3).
+    comms::ErrorStatus field_params_3(FieldType<FieldIdx_params_3>& field) const
+    {
+        return Base::readField<FieldIdx_params_3>(field);
+    }
+
+    /// @brief Decode "reserved2" field (see @ref ublox::message::RxmRlmLongFields::reserved2).
+    comms::ErrorStatus field_reserved2(FieldType<FieldIdx_reserved2>& field) const
+    {
+        return Base::readField<FieldIdx_reserved2>(field);
+    }
+};
+
+} // namespace view
+
+} // namespace ublox
+
@@ -0,0 +1,136 @@
+//
+// Copyright 2018 (C). Alex Robenko. All rights reserved.
+//
+
+// This file is free software: you can redistribute it and/or modify
+// it under the terms of the GNU General Public License as published by
+// the Free Software Foundation, either version 3 of the License, or
+// (at your option) any later version.
+//
+// This program is distributed in the hope that it will be useful,
+// but WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+// GNU General Public License for more details.
+//
+// You should have received a copy of the GNU General Public License
+// along with this program.  If not, see <http://www.gnu.org/licenses/>.
+
+/// @file
+/// @brief Contains definition of lazy view of RXM-RLM (@b short) message.
+/// @details Generated by script/gen_views.py, do NOT edit manually.
+
+#pragma once
+
+#include "ublox/message/RxmRlmShort.h"
+#include "MsgView.h"
+
+namespace ublox
+{
+
+namespace view
+{
+
+/// @brief Lazy read-only view of RXM-RLM (@b short) message payload.
+/// @details Wraps the pointer to the validated payload, the fields are
+///     decoded on access only, see @ref MsgView.
+/// @see @ref ublox::message::RxmRlmShort
+class RxmRlmShortView : public
+    MsgView<
+        ublox::message::RxmRlmShortFields::All
+    >
+{
+    using Base =
+        MsgView<
+            ublox::message::RxmRlmShortFields::All
+        >;
+
+public:
+    /// @brief ID of the viewed message.
+    static const MsgId MsgIdValue = MsgId_RXM_RLM;
+
+    /// @brief Index of the fields, same as the ones defined by
+    ///     @b COMMS_MSG_FIELDS_ACCESS() in @ref ublox::message::RxmRlmShort.
+    enum FieldIdx
+    {
+        FieldIdx_version, ///< index of @b version field
+        FieldIdx_type, ///< index of @b type field
+        FieldIdx_svId, ///< index of @b svId field
+        FieldIdx_reserved1, ///< index of @b reserved1 field
+        FieldIdx_beacon_1, ///< index of @b beacon_1 field
+        FieldIdx_beacon_2, ///< index of @b beacon_2 field
+        FieldIdx_message, ///< index of @b message field
+        FieldIdx_params, ///< index of @b params field
+        FieldIdx_reserved2, ///< index of @b reserved2 field
+        FieldIdx_numOfValues ///< number of available fields
+    };
+
+    /// @brief Default constructor, creates empty view.
+    RxmRlmShortView() = default;
+
+    /// @brief Constructor
+    /// @param[in] payload Pointer to the payload of the message.
+    /// @param[in] len Length of the payload.
+    RxmRlmShortView(const std::uint8_t* payload, std::size_t len)
+      : Base(payload, len)
+    {
+    }
+
+    /// @brief Decode "version" field (see @ref ublox::message::RxmRlmShortFields::version).
+    comms::ErrorStatus field_version(FieldType<FieldIdx_version>& field) const
+    {
+        return Base::readField<FieldIdx_version>(field);
+    }
+
+    /// @brief Decode "type" field (see @ref ublox::message::RxmRlmShortFields::type).
+    comms::ErrorStatus field_type(FieldType<FieldIdx_type>& field) const
+    {
+        return Base::readField<FieldIdx_type>(field);
+    }
+
+    /// @brief Decode "svId" field (see @ref ublox::message::RxmRlmShortFields::svId).
+    comms::ErrorStatus field_svId(FieldType<FieldIdx_svId>& field) const
+    {
+        return Base::readField<FieldIdx_svId>(field);
+    }
+
+    /// @brief Decode "reserved1" field (see @ref ublox::message::RxmRlmShortFields::reserved1).
+    comms::ErrorStatus field_reserved1(FieldType<FieldIdx_reserved1>& field) const
+    {
+        return Base::readField<FieldIdx_reserved1>(field);
+    }
+
+    /// @brief Decode "beacon_1" field (see @ref ublox::message::RxmRlmShortFields::beacon_1).
+    comms::ErrorStatus field_beacon_1(FieldType<FieldIdx_beacon_1>& field) const
+    {
+        return Base::readField<FieldIdx_beacon_1>(field);
+    }
+
+    /// @brief Decode "beacon_2" field (see @ref ublox::message::RxmRlmShortFields::beacon_2).
+    comms::ErrorStatus field_beacon_2(FieldType<FieldIdx_beacon_2>& field) const
+    {
+        return Base::readField<FieldIdx_beacon_2>(field);
+    }
+
+    /// @brief Decode "message" field (see @ref ublox::message::RxmRlmShortFields::message).
+    comms::ErrorStatus field_message(FieldType<FieldIdx_message>& field) const
+    {
+        return Base::readField<FieldIdx_message>(field);
+    }
+
+    /// @brief Decode "params" field (see @ref ublox::message::RxmRlmShortFields::params).
+    comms::ErrorStatus field_params(FieldType<FieldIdx_params>& field) const
+    {
+        return Base::readField<FieldIdx_params>(field);
+    }
+
+    /// @brief Decode "reserved2" field (see @ref ublox::message::RxmRlmShortFields::reserved2).
+    comms::ErrorStatus field_reserved2(FieldType<FieldIdx_reserved2>& field) const
+    {
+        return Base::readField<FieldIdx_reserved2>(field);
+    }
+};
+
+} // namespace view
+
+} // namespace ublox
+
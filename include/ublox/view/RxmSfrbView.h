@@ -0,0 +1,94 @@
+//
+// Copyright 2018 (C). Alex Robenko. All rights reserved.
+//
+
+// This file is free software: you can redistribute it and/or modify
+// it under the terms of the GNU General Public License as published by
+// the Free Software Foundation, either version 3 of the License, or
+// (at your option) any later version.
+//
+// This program is distributed in the hope that it will be useful,
+// but WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+// GNU General Public License for more details.
+//
+// You should have received a copy of the GNU General Public License
+// along with this program.  If not, see <http://www.gnu.org/licenses/>.
+
+/// @file
+/// @brief Contains definition of lazy view of RXM-SFRB message.
+/// @details Generated by script/gen_views.py, do NOT edit manually.
+
+#pragma once
+
+#include "ublox/message/RxmSfrb.h"
+#include "MsgView.h"
+
+namespace ublox
+{
+
+namespace view
+{
+
+/// @brief Lazy read-only view of RXM-SFRB message payload.
+/// @details Wraps the pointer to the validated payload, the fields are
+///     decoded on access only, see @ref MsgView.
+/// @see @ref ublox::message::RxmSfrb
+class RxmSfrbView : public
+    MsgView<
+        ublox::message::RxmSfrbFields::All<comms::option::EmptyOption>
+    >
+{
+    using Base =
+        MsgView<
+            ublox::message::RxmSfrbFields::All<comms::option::EmptyOption>
+        >;
+
+public:
+    /// @brief ID of the viewed message.
+    static const MsgId MsgIdValue = MsgId_RXM_SFRB;
+
+    /// @brief Index of the fields, same as the ones defined by
+    ///     @b COMMS_MSG_FIELDS_ACCESS() in @ref ublox::message::RxmSfrb.
+    enum FieldIdx
+    {
+        FieldIdx_chn, ///< index of @b chn field
+        FieldIdx_svid, ///< index of @b svid field
+        FieldIdx_dwrd, ///< index of @b dwrd field
+        FieldIdx_numOfValues ///< number of available fields
+    };
+
+    /// @brief Default constructor, creates empty view.
+    RxmSfrbView() = default;
+
+    /// @brief Constructor
+    /// @param[in] payload Pointer to the payload of the message.
+    /// @param[in] len Length of the payload.
+    RxmSfrbView(const std::uint8_t* payload, std::size_t len)
+      : Base(payload, len)
+    {
+    }
+
+    /// @brief Decode "chn" field (see @ref ublox::message::RxmSfrbFields::chn).
+    comms::ErrorStatus field_chn(FieldType<FieldIdx_chn>& field) const
+    {
+        return Base::readField<FieldIdx_chn>(field);
+    }
+
+    /// @brief Decode "svid" field (see @ref ublox::message::RxmSfrbFields::svid).
+    comms::ErrorStatus field_svid(FieldType<FieldIdx_svid>& field) const
+    {
+        return Base::readField<FieldIdx_svid>(field);
+    }
+
+    /// @brief Decode "dwrd" field (see @ref ublox::message::RxmSfrbFields::dwrd).
+    comms::ErrorStatus field_dwrd(FieldType<FieldIdx_dwrd>& field) const
+    {
+        return Base::readField<FieldIdx_dwrd>(field);
+    }
+};
+
+} // namespace view
+
+} // namespace ublox
+
@@ -0,0 +1,133 @@
+//
+// Copyright 2018 (C). Alex Robenko. All rights reserved.
+//
+
+// This file is free software: you can redistribute it and/or modify
+// it under the terms of the GNU General Public License as published by
+// the Free Software Foundation, either version 3 of the License, or
+// (at your option) any later version.
+//
+// This program is distributed in the hope that it will be useful,
+// but WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+// GNU General Public License for more details.
+//
+// You should have received a copy of the GNU General Public License
+// along with this program.  If not, see <http://www.gnu.org/licenses/>.
+
+/// @file
+/// @brief Contains definition of lazy view of RXM-SFRBX message.
+/// @details Generated by script/gen_views.py, do NOT edit manually.
+
+#pragma once
+
+#include "ublox/message/RxmSfrbx.h"
+#include "MsgView.h"
+
+namespace ublox
+{
+
+namespace view
+{
+
+/// @brief Lazy read-only view of RXM-SFRBX message payload.
+/// @details Wraps the pointer to the validated payload, the fields are
+///     decoded on access only, see @ref MsgView.
+///     The message performs custom read of its fields, the fields starting
+///     from "dwrd" are not accessible through the view, because their
+///     presence and/or size depend on the values of preceding fields.
+/// @see @ref ublox::message::RxmSfrbx
+class RxmSfrbxView : public
+    MsgView<
+        ublox::message::RxmSfrbxFields::All<comms::option::EmptyOption>
+    >
+{
+    using Base =
+        MsgView<
+            ublox::message::RxmSfrbxFields::All<comms::option::EmptyOption>
+        >;
+
+public:
+    /// @brief ID of the viewed message.
+    static const MsgId MsgIdValue = MsgId_RXM_SFRBX;
+
+    /// @brief Index of the fields, same as the ones defined by
+    ///     @b COMMS_MSG_FIELDS_ACCESS() in @ref ublox::message::RxmSfrbx.
+    enum FieldIdx
+    {
+        FieldIdx_gnssId, ///< index of @b gnssId field
+        FieldIdx_svId, ///< index of @b svId field
+        FieldIdx_reserved1, ///< index of @b reserved1 field
+        FieldIdx_freqId, ///< index of @b freqId field
+        FieldIdx_numWords, ///< index of @b numWords field
+        FieldIdx_chn, ///< index of @b chn field
+        FieldIdx_version, ///< index of @b version field
+        FieldIdx_reserved2, ///< index of @b reserved2 field
+        FieldIdx_dwrd, ///< index of @b dwrd field
+        FieldIdx_numOfValues ///< number of available fields
+    };
+
+    /// @brief Default constructor, creates empty view.
+    RxmSfrbxView() = default;
+
+    /// @brief Constructor
+    /// @param[in] payload Pointer to the payload of the message.
+    /// @param[in] len Length of the payload.
+    RxmSfrbxView(const std::uint8_t* payload, std::size_t len)
+      : Base(payload, len)
+    {
+    }
+
+    /// @brief Decode "gnssId" field (see @ref ublox::message::RxmSfrbxFields::gnssId).
+    comms::ErrorStatus field_gnssId(FieldType<FieldIdx_gnssId>& field) const
+    {
+        return Base::readField<FieldIdx_gnssId>(field);
+    }
+
+    /// @brief Decode "svId" field (see @ref ublox::message::RxmSfrbxFields::svId).
+    comms::ErrorStatus field_svId(FieldType<FieldIdx_svId>& field) const
+    {
+        return Base::readField<FieldIdx_svId>(field);
+    }
+
+    /// @brief Decode "reserved1" field (see @ref ublox::message::RxmSfrbxFields::reserved1).
+    comms::ErrorStatus field_reserved1(FieldType<FieldIdx_reserved1>& field) const
+    {
+        return Base::readField<FieldIdx_reserved1>(field);
+    }
+
+    /// @brief Decode "freqId" field (see @ref ublox::message::RxmSfrbxFields::freqId).
+    comms::ErrorStatus field_freqId(FieldType<FieldIdx_freqId>& field) const
+    {
+        return Base::readField<FieldIdx_freqId>(field);
+    }
+
+    /// @brief Decode "numWords" field (see @ref ublox::message::RxmSfrbxFields::numWords).
+    comms::ErrorStatus field_numWords(FieldType<FieldIdx_numWords>& field) const
+    {
+        return Base::readField<FieldIdx_numWords>(field);
+    }
+
+    /// @brief Decode "chn" field (see @ref ublox::message::RxmSfrbxFields::chn).
+    comms::ErrorStatus field_chn(FieldType<FieldIdx_chn>& field) const
+    {
+        return Base::readField<FieldIdx_chn>(field);
+    }
+
+    /// @brief Decode "version" field (see @ref ublox::message::RxmSfrbxFields::version).
+    comms::ErrorStatus field_version(FieldType<FieldIdx_version>& field) const
+    {
+        return Base::readField<FieldIdx_version>(field);
+    }
+
+    /// @brief Decode "reserved2" field (see @ref ublox::message::RxmSfrbxFields::reserved2).
+    comms::ErrorStatus field_reserved2(FieldType<FieldIdx_reserved2>& field) const
+    {
+        return Base::readField<FieldIdx_reserved2>(field);
+    }
+};
+
+} // namespace view
+
+} // namespace ublox
+
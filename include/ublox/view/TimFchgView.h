@@ -0,0 +1,136 @@
+//
+// Copyright 2018 (C). Alex Robenko. All rights reserved.
+//
+
+// This file is free software: you can redistribute it and/or modify
+// it under the terms of the GNU General Public License as published by
+// the Free Software Foundation, either version 3 of the License, or
+// (at your option) any later version.
+//
+// This program is distributed in the hope that it will be useful,
+// but WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+// GNU General Public License for more details.
+//
+// You should have received a copy of the GNU General Public License
+// along with this program.  If not, see <http://www.gnu.org/licenses/>.
+
+/// @file
+/// @brief Contains definition of lazy view of TIM-DOSC message.
+/// @details Generated by script/gen_views.py, do NOT edit manually.
+
+#pragma once
+
+#include "ublox/message/TimFchg.h"
+#include "MsgView.h"
+
+namespace ublox
+{
+
+namespace view
+{
+
+/// @brief Lazy read-only view of TIM-DOSC message payload.
+/// @details Wraps the pointer to the validated payload, the fields are
+///     decoded on access only, see @ref MsgView.
+/// @see @ref ublox::message::TimFchg
+class TimFchgView : public
+    MsgView<
+        ublox::message::TimFchgFields::All
+    >
+{
+    using Base =
+        MsgView<
+            ublox::message::TimFchgFields::All
+        >;
+
+public:
+    /// @brief ID of the viewed message.
+    static const MsgId MsgIdValue = MsgId_TIM_FCHG;
+
+    /// @brief Index of the fields, same as the ones defined by
+    ///     @b COMMS_MSG_FIELDS_ACCESS() in @ref ublox::message::TimFchg.
+    enum FieldIdx
+    {
+        FieldIdx_version, ///< index of @b version field
+        FieldIdx_reserved1, ///< index of @b reserved1 field
+        FieldIdx_iTOW, ///< index of @b iTOW field
+        FieldIdx_intDeltaFreq, ///< index of @b intDeltaFreq field
+        FieldIdx_intDeltaFreqUnc, ///< index of @b intDeltaFreqUnc field
+        FieldIdx_intRaw, ///< index of @b intRaw field
+        FieldIdx_extDeltaFreq, ///< index of @b extDeltaFreq field
+        FieldIdx_extDeltaFreqUnc, ///< index of @b extDeltaFreqUnc field
+        FieldIdx_extRaw, ///< index of @b extRaw field
+        FieldIdx_numOfValues ///< number of available fields
+    };
+
+    /// @brief Default constructor, creates empty view.
+    TimFchgView() = default;
+
+    /// @brief Constructor
+    /// @param[in] payload Pointer to the payload of the message.
+    /// @param[in] len Length of the payload.
+    TimFchgView(const std::uint8_t* payload, std::size_t len)
+      : Base(payload, len)
+    {
+    }
+
+    /// @brief Decode "version" field (see @ref ublox::message::TimFchgFields::version).
+    comms::ErrorStatus field_version(FieldType<FieldIdx_version>& field) const
+    {
+        return Base::readField<FieldIdx_version>(field);
+    }
+
+    /// @brief Decode "reserved1" field (see @ref ublox::message::TimFchgFields::reserved1).
+    comms::ErrorStatus field_reserved1(FieldType<FieldIdx_reserved1>& field) const
+    {
+        return Base::readField<FieldIdx_reserved1>(field);
+    }
+
+    /// @brief Decode "iTOW" field (see @ref ublox::message::TimFchgFields::iTOW).
+    comms::ErrorStatus field_iTOW(FieldType<FieldIdx_iTOW>& field) const
+    {
+        return Base::readField<FieldIdx_iTOW>(field);
+    }
+
+    /// @brief Decode "intDeltaFreq" field (see @ref ublox::message::TimFchgFields::intDeltaFreq).
+    comms::ErrorStatus field_intDeltaFreq(FieldType<FieldIdx_intDeltaFreq>& field) const
+    {
+        return Base::readField<FieldIdx_intDeltaFreq>(field);
+    }
+
+    /// @brief Decode "intDeltaFreqUnc" field (see @ref ublox::message::TimFchgFields::intDeltaFreqUnc).
+    comms::ErrorStatus field_intDeltaFreqUnc(FieldType<FieldIdx_intDeltaFreqUnc>& field) const
+    {
+        return Base::readField<FieldIdx_intDeltaFreqUnc>(field);
+    }
+
+    /// @brief Decode "intRaw" field (see @ref ublox::message::TimFchgFields::intRaw).
+    comms::ErrorStatus field_intRaw(FieldType<FieldIdx_intRaw>& field) const
+    {
+        return Base::readField<FieldIdx_intRaw>(field);
+    }
+
+    /// @brief Decode "extDeltaFreq" field (see @ref ublox::message::TimFchgFields::extDeltaFreq).
+    comms::ErrorStatus field_extDeltaFreq(FieldType<FieldIdx_extDeltaFreq>& field) const
+    {
+        return Base::readField<FieldIdx_extDeltaFreq>(field);
+    }
+
+    /// @brief Decode "extDeltaFreqUnc" field (see @ref ublox::message::TimFchgFields::extDeltaFreqUnc).
+    comms::ErrorStatus field_extDeltaFreqUnc(FieldType<FieldIdx_extDeltaFreqUnc>& field) const
+    {
+        return Base::readField<FieldIdx_extDeltaFreqUnc>(field);
+    }
+
+    /// @brief Decode "extRaw" field (see @ref ublox::message::TimFchgFields::extRaw).
+    comms::ErrorStatus field_extRaw(FieldType<FieldIdx_extRaw>& field) const
+    {
+        return Base::readField<FieldIdx_extRaw>(field);
+    }
+};
+
+} // namespace view
+
+} // namespace ublox
+
@@ -0,0 +1,136 @@
+//
+// Copyright 2018 (C). Alex Robenko. All rights reserved.
+//
+
+// This file is free software: you can redistribute it and/or modify
+// it under the terms of the GNU General Public License as published by
+// the Free Software Foundation, either version 3 of the License, or
+// (at your option) any later version.
+//
+// This program is distributed in the hope that it will be useful,
+// but WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+// GNU General Public License for more details.
+//
+// You should have received a copy of the GNU General Public License
+// along with this program.  If not, see <http://www.gnu.org/licenses/>.
+
+/// @file
+/// @brief Contains definition of lazy view of TIM-SVIN message.
+/// @details Generated by script/gen_views.py, do NOT edit manually.
+
+#pragma once
+
+#include "ublox/message/TimSvin.h"
+#include "MsgView.h"
+
+namespace ublox
+{
+
+namespace view
+{
+
+/// @brief Lazy read-only view of TIM-SVIN message payload.
+/// @details Wraps the pointer to the validated payload, the fields are
+///     decoded on access only, see @ref MsgView.
+/// @see @ref ublox::message::TimSvin
+class TimSvinView : public
+    MsgView<
+        ublox::message::TimSvinFields::All
+    >
+{
+    using Base =
+        MsgView<
+            ublox::message::TimSvinFields::All
+        >;
+
+public:
+    /// @brief ID of the viewed message.
+    static const MsgId MsgIdValue = MsgId_TIM_SVIN;
+
+    /// @brief Index of the fields, same as the ones defined by
+    ///     @b COMMS_MSG_FIELDS_ACCESS() in @ref ublox::message::TimSvin.
+    enum FieldIdx
+    {
+        FieldIdx_dur, ///< index of @b dur field
+        FieldIdx_meanX, ///< index of @b meanX field
+        FieldIdx_meanY, ///< index of @b meanY field
+        FieldIdx_meanZ, ///< index of @b meanZ field
+        FieldIdx_meanV, ///< index of @b meanV field
+        FieldIdx_obs, ///< index of @b obs field
+        FieldIdx_valid, ///< index of @b valid field
+        FieldIdx_active, ///< index of @b active field
+        FieldIdx_reserved, ///< index of @b reserved field
+        FieldIdx_numOfValues ///< number of available fields
+    };
+
+    /// @brief Default constructor, creates empty view.
+    TimSvinView() = default;
+
+    /// @brief Constructor
+    /// @param[in] payload Pointer to the payload of the message.
+    /// @param[in] len Length of the payload.
+    TimSvinView(const std::uint8_t* payload, std::size_t len)
+      : Base(payload, len)
+    {
+    }
+
+    /// @brief Decode "dur" field (see @ref ublox::message::TimSvinFields::dur).
+    comms::ErrorStatus field_dur(FieldType<FieldIdx_dur>& field) const
+    {
+        return Base::readField<FieldIdx_dur>(field);
+    }
+
+    /// @brief Decode "meanX" field (see @ref ublox::message::TimSvinFields::meanX).
+    comms::ErrorStatus field_meanX(FieldType<FieldIdx_meanX>& field) const
+    {
+        return Base::readField<FieldIdx_meanX>(field);
+    }
+
+    /// @brief Decode "meanY" field (see @ref ublox::message::TimSvinFields::meanY).
+    comms::ErrorStatus field_meanY(FieldType<FieldIdx_meanY>& field) const
+    {
+        return Base::readField<FieldIdx_meanY>(field);
+    }
+
+    /// @brief Decode "meanZ" field (see @ref ublox::message::TimSvinFields::meanZ).
+    comms::ErrorStatus field_meanZ(FieldType<FieldIdx_meanZ>& field) const
+    {
+        return Base::readField<FieldIdx_meanZ>(field);
+    }
+
+    /// @brief Decode "meanV" field (see @ref ublox::message::TimSvinFields::meanV).
+    comms::ErrorStatus field_meanV(FieldType<FieldIdx_meanV>& field) const
+    {
+        return Base::readField<FieldIdx_meanV>(field);
+    }
+
+    /// @brief Decode "obs" field (see @ref ublox::message::TimSvinFields::obs).
+    comms::ErrorStatus field_obs(FieldType<FieldIdx_obs>& field) const
+    {
+        return Base::readField<FieldIdx_obs>(field);
+    }
+
+    /// @brief Decode "valid" field (see @ref ublox::message::TimSvinFields::valid).
+    comms::ErrorStatus field_valid(FieldType<FieldIdx_valid>& field) const
+    {
+        return Base::readField<FieldIdx_valid>(field);
+    }
+
+    /// @brief Decode "active" field (see @ref ublox::message::TimSvinFields::active).
+    comms::ErrorStatus field_active(FieldType<FieldIdx_active>& field) const
+    {
+        return Base::readField<FieldIdx_active>(field);
+    }
+
+    /// @brief Decode "reserved" field (see @ref ublox::message::TimSvinFields::reserved).
+    comms::ErrorStatus field_reserved(FieldType<FieldIdx_reserved>& field) const
+    {
+        return Base::readField<FieldIdx_reserved>(field);
+    }
+};
+
+} // namespace view
+
+} // namespace ublox
+
@@ -0,0 +1,143 @@
+//
+// Copyright 2018 (C). Alex Robenko. All rights reserved.
+//
+
+// This file is free software: you can redistribute it and/or modify
+// it under the terms of the GNU General Public License as published by
+// the Free Software Foundation, either version 3 of the License, or
+// (at your option) any later version.
+//
+// This program is distributed in the hope that it will be useful,
+// but WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+// GNU General Public License for more details.
+//
+// You should have received a copy of the GNU General Public License
+// along with this program.  If not, see <http://www.gnu.org/licenses/>.
+
+/// @file
+/// @brief Contains definition of lazy view of TIM-TM2 message.
+/// @details Generated by script/gen_views.py, do NOT edit manually.
+
+#pragma once
+
+#include "ublox/message/TimTm2.h"
+#include "MsgView.h"
+
+namespace ublox
+{
+
+namespace view
+{
+
+/// @brief Lazy read-only view of TIM-TM2 message payload.
+/// @details Wraps the pointer to the validated payload, the fields are
+///     decoded on access only, see @ref MsgView.
+/// @see @ref ublox::message::TimTm2
+class TimTm2View : public
+    MsgView<
+        ublox::message::TimTm2Fields::All
+    >
+{
+    using Base =
+        MsgView<
+            ublox::message::TimTm2Fields::All
+        >;
+
+public:
+    /// @brief ID of the viewed message.
+    static const MsgId MsgIdValue = MsgId_TIM_TM2;
+
+    /// @brief Index of the fields, same as the ones defined by
+    ///     @b COMMS_MSG_FIELDS_ACCESS() in @ref ublox::message::TimTm2.
+    enum FieldIdx
+    {
+        FieldIdx_ch, ///< index of @b ch field
+        FieldIdx_flags, ///< index of @b flags field
+        FieldIdx_count, ///< index of @b count field
+        FieldIdx_wnR, ///< index of @b wnR field
+        FieldIdx_wnF, ///< index of @b wnF field
+        FieldIdx_towMsR, ///< index of @b towMsR field
+        FieldIdx_towSubMsR, ///< index of @b towSubMsR field
+        FieldIdx_towMsF, ///< index of @b towMsF field
+        FieldIdx_towSubMsF, ///< index of @b towSubMsF field
+        FieldIdx_accEst, ///< index of @b accEst field
+        FieldIdx_numOfValues ///< number of available fields
+    };
+
+    /// @brief Default constructor, creates empty view.
+    TimTm2View() = default;
+
+    /// @brief Constructor
+    /// @param[in] payload Pointer to the payload of the message.
+    /// @param[in] len Length of the payload.
+    TimTm2View(const std::uint8_t* payload, std::size_t len)
+      : Base(payload, len)
+    {
+    }
+
+    /// @brief Decode "ch" field (see @ref ublox::message::TimTm2Fields::ch).
+    comms::ErrorStatus field_ch(FieldType<FieldIdx_ch>& field) const
+    {
+        return Base::readField<FieldIdx_ch>(field);
+    }
+
+    /// @brief Decode "flags" field (see @ref ublox::message::TimTm2Fields::flags).
+    comms::ErrorStatus field_flags(FieldType<FieldIdx_flags>& field) const
+    {
+        return Base::readField<FieldIdx_flags>(field);
+    }
+
+    /// @brief Decode "count" field (see @ref ublox::message::TimTm2Fields::count).
+    comms::ErrorStatus field_count(FieldType<FieldIdx_count>& field) const
+    {
+        return Base::readField<FieldIdx_count>(field);
+    }
+
+    /// @brief Decode "wnR" field (see @ref ublox::message::TimTm2Fields::wnR).
+    comms::ErrorStatus field_wnR(FieldType<FieldIdx_wnR>& field) const
+    {
+        return Base::readField<FieldIdx_wnR>(field);
+    }
+
+    /// @brief Decode "wnF" field (see @ref ublox::message::TimTm2Fields::wnF).
+    comms::ErrorStatus field_wnF(FieldType<FieldIdx_wnF>& field) const
+    {
+        return Base::readField<FieldIdx_wnF>(field);
+    }
+
+    /// @brief Decode "towMsR" field (see @ref ublox::message::TimTm2Fields::towMsR).
+    comms::ErrorStatus field_towMsR(FieldType<FieldIdx_towMsR>& field) const
+    {
+        return Base::readField<FieldIdx_towMsR>(field);
+    }
+
+    /// @brief Decode "towSubMsR" field (see @ref ublox::message::TimTm2Fields::towSubMsR).
+    comms::ErrorStatus field_towSubMsR(FieldType<FieldIdx_towSubMsR>& field) const
+    {
+        return Base::readField<FieldIdx_towSubMsR>(field);
+    }
+
+    /// @brief Decode "towMsF" field (see @ref ublox::message::TimTm2Fields::towMsF).
+    comms::ErrorStatus field_towMsF(FieldType<FieldIdx_towMsF>& field) const
+    {
+        return Base::readField<FieldIdx_towMsF>(field);
+    }
+
+    /// @brief Decode "towSubMsF" field (see @ref ublox::message::TimTm2Fields::towSubMsF).
+    comms::ErrorStatus field_towSubMsF(FieldType<FieldIdx_towSubMsF>& field) const
+    {
+        return Base::readField<FieldIdx_towSubMsF>(field);
+    }
+
+    /// @brief Decode "accEst" field (see @ref ublox::message::TimTm2Fields::accEst).
+    comms::ErrorStatus field_accEst(FieldType<FieldIdx_accEst>& field) const
+    {
+        return Base::readField<FieldIdx_accEst>(field);
+    }
+};
+
+} // namespace view
+
+} // namespace ublox
+
@@ -0,0 +1,220 @@
+//
+// Copyright 2018 (C). Alex Robenko. All rights reserved.
+//
+
+// This file is free software: you can redistribute it and/or modify
+// it under the terms of the GNU General Public License as published by
+// the Free Software Foundation, either version 3 of the License, or
+// (at your option) any later version.
+//
+// This program is distributed in the hope that it will be useful,
+// but WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+// GNU General Public License for more details.
+//
+// You should have received a copy of the GNU General Public License
+// along with this program.  If not, see <http://www.gnu.org/licenses/>.
+
+/// @file
+/// @brief Contains definition of lazy view of TIM-TOS message.
+/// @details Generated by script/gen_views.py, do NOT edit manually.
+
+#pragma once
+
+#include "ublox/message/TimTos.h"
+#include "MsgView.h"
+
+namespace ublox
+{
+
+namespace view
+{
+
+/// @brief Lazy read-only view of TIM-TOS message payload.
+/// @details Wraps the pointer to the validated payload, the fields are
+///     decoded on access only, see @ref MsgView.
+/// @see @ref ublox::message::TimTos
+class TimTosView : public
+    MsgView<
+        ublox::message::TimTosFields::All
+    >
+{
+    using Base =
+        MsgView<
+            ublox::message::TimTosFields::All
+        >;
+
+public:
+    /// @brief ID of the viewed message.
+    static const MsgId MsgIdValue = MsgId_TIM_TOS;
+
+    /// @brief Index of the fields, same as the ones defined by
+    ///     @b COMMS_MSG_FIELDS_ACCESS() in @ref ublox::message::TimTos.
+    enum FieldIdx
+    {
+        FieldIdx_version, ///< index of @b version field
+        FieldIdx_gnssId, ///< index of @b gnssId field
+        FieldIdx_reserved1, ///< index of @b reserved1 field
+        FieldIdx_flags, ///< index of @b flags field
+        FieldIdx_year, ///< index of @b year field
+        FieldIdx_month, ///< index of @b month field
+        FieldIdx_day, ///< index of @b day field
+        FieldIdx_hour, ///< index of @b hour field
+        FieldIdx_minute, ///< index of @b minute field
+        FieldIdx_second, ///< index of @b second field
+        FieldIdx_utcStandard, ///< index of @b utcStandard field
+        FieldIdx_utcOffset, ///< index of @b utcOffset field
+        FieldIdx_utcUncertainty, ///< index of @b utcUncertainty field
+        FieldIdx_week, ///< index of @b week field
+        FieldIdx_TOW, ///< index of @b TOW field
+        FieldIdx_gnssOffset, ///< index of @b gnssOffset field
+        FieldIdx_gnssUncertainty, ///< index of @b gnssUncertainty field
+        FieldIdx_intOscOffset, ///< index of @b intOscOffset field
+        FieldIdx_intOscUncertainty, ///< index of @b intOscUncertainty field
+        FieldIdx_extOscOffset, ///< index of @b extOscOffset field
+        FieldIdx_extOscUncertainty, ///< index of @b extOscUncertainty field
+        FieldIdx_numOfValues ///< number of available fields
+    };
+
+    /// @brief Default constructor, creates empty view.
+    TimTosView() = default;
+
+    /// @brief Constructor
+    /// @param[in] payload Pointer to the payload of the message.
+    /// @param[in] len Length of the payload.
+    TimTosView(const std::uint8_t* payload, std::size_t len)
+      : Base(payload, len)
+    {
+    }
+
+    /// @brief Decode "version" field (see @ref ublox::message::TimTosFields::version).
+    comms::ErrorStatus field_version(FieldType<FieldIdx_version>& field) const
+    {
+        return Base::readField<FieldIdx_version>(field);
+    }
+
+    /// @brief Decode "gnssId" field (see @ref ublox::message::TimTosFields::gnssId).
+    comms::ErrorStatus field_gnssId(FieldType<FieldIdx_gnssId>& field) const
+    {
+        return Base::readField<FieldIdx_gnssId>(field);
+    }
+
+    /// @brief Decode "reserved1" field (see @ref ublox::message::TimTosFields::reserved1).
+    comms::ErrorStatus field_reserved1(FieldType<FieldIdx_reserved1>& field) const
+    {
+        return Base::readField<FieldIdx_reserved1>(field);
+    }
+
+    /// @brief Decode "flags" field (see @ref ublox::message::TimTosFields::flags).
+    comms::ErrorStatus field_flags(FieldType<FieldIdx_flags>& field) const
+    {
+        return Base::readField<FieldIdx_flags>(field);
+    }
+
+    /// @brief Decode "year" field (see @ref ublox::message::TimTosFields::year).
+    comms::ErrorStatus field_year(FieldType<FieldIdx_year>& field) const
+    {
+        return Base::readField<FieldIdx_year>(field);
+    }
+
+    /// @brief Decode "month" field (see @ref ublox::message::TimTosFields::month).
+    comms::ErrorStatus field_month(FieldType<FieldIdx_month>& field) const
+    {
+        return Base::readField<FieldIdx_month>(field);
+    }
+
+    /// @brief Decode "day" field (see @ref ublox::message::TimTosFields::day).
+    comms::ErrorStatus field_day(FieldType<FieldIdx_day>& field) const
+    {
+        return Base::readField<FieldIdx_day>(field);
+    }
+
+    /// @brief Decode "hour" field (see @ref ublox::message::TimTosFields::hour).
+    comms::ErrorStatus field_hour(FieldType<FieldIdx_hour>& field) const
+    {
+        return Base::readField<FieldIdx_hour>(field);
+    }
+
+    /// @brief Decode "minute" field (see @ref ublox::message::TimTosFields::minute).
+    comms::ErrorStatus field_minute(FieldType<FieldIdx_minute>& field) const
+    {
+        return Base::readField<FieldIdx_minute>(field);
+    }
+
+    /// @brief Decode "second" field (see @ref ublox::message::TimTosFields::second).
+    comms::ErrorStatus field_second(FieldType<FieldIdx_second>& field) const
+    {
+        return Base::readField<FieldIdx_second>(field);
+    }
+
+    /// @brief Decode "utcStandard" field (see @ref ublox::message::TimTosFields::utcStandard).
+    comms::ErrorStatus field_utcStandard(FieldType<FieldIdx_utcStandard>& field) const
+    {
+        return Base::readField<FieldIdx_utcStandard>(field);
+    }
+
+    /// @brief Decode "utcOffset" field (see @ref ublox::message::TimTosFields::utcOffset).
+    comms::ErrorStatus field_utcOffset(FieldType<FieldIdx_utcOffset>& field) const
+    {
+        return Base::readField<FieldIdx_utcOffset>(field);
+    }
+
+    /// @brief Decode "utcUncertainty" field (see @ref ublox::message::TimTosFields::utcUncertainty).
+    comms::ErrorStatus field_utcUncertainty(FieldType<FieldIdx_utcUncertainty>& field) const
+    {
+        return Base::readField<FieldIdx_utcUncertainty>(field);
+    }
+
+    /// @brief Decode "week" field (see @ref ublox::message::TimTosFields::week).
+    comms::ErrorStatus field_week(FieldType<FieldIdx_week>& field) const
+    {
+        return Base::readField<FieldIdx_week>(field);
+    }
+
+    /// @brief Decode "TOW" field (see @ref ublox::message::TimTosFields::TOW).
+    comms::ErrorStatus field_TOW(FieldType<FieldIdx_TOW>& field) const
+    {
+        return Base::readField<FieldIdx_TOW>(field);
+    }
+
+    /// @brief Decode "gnssOffset" field (see @ref ublox::message::TimTosFields::gnssOffset).
+    comms::ErrorStatus field_gnssOffset(FieldType<FieldIdx_gnssOffset>& field) const
+    {
+        return Base::readField<FieldIdx_gnssOffset>(field);
+    }
+
+    /// @brief Decode "gnssUncertainty" field (see @ref ublox::message::TimTosFields::gnssUncertainty).
+    comms::ErrorStatus field_gnssUncertainty(FieldType<FieldIdx_gnssUncertainty>& field) const
+    {
+        return Base::readField<FieldIdx_gnssUncertainty>(field);
+    }
+
+    /// @brief Decode "intOscOffset" field (see @ref ublox::message::TimTosFields::intOscOffset).
+    comms::ErrorStatus field_intOscOffset(FieldType<FieldIdx_intOscOffset>& field) const
+    {
+        return Base::readField<FieldIdx_intOscOffset>(field);
+    }
+
+    /// @brief Decode "intOscUncertainty" field (see @ref ublox::message::TimTosFields::intOscUncertainty).
+    comms::ErrorStatus field_intOscUncertainty(FieldType<FieldIdx_intOscUncertainty>& field) const
+    {
+        return Base::readField<FieldIdx_intOscUncertainty>(field);
+    }
+
+    /// @brief Decode "extOscOffset" field (see @ref ublox::message::TimTosFields::extOscOffset).
+    comms::ErrorStatus field_extOscOffset(FieldType<FieldIdx_extOscOffset>& field) const
+    {
+        return Base::readField<FieldIdx_extOscOffset>(field);
+    }
+
+    /// @brief Decode "extOscUncertainty" field (see @ref ublox::message::TimTosFields::extOscUncertainty).
+    comms::ErrorStatus field_extOscUncertainty(FieldType<FieldIdx_extOscUncertainty>& field) const
+    {
+        return Base::readField<FieldIdx_extOscUncertainty>(field);
+    }
+};
+
+} // namespace view
+
+} // namespace ublox
+
@@ -0,0 +1,115 @@
+//
+// Copyright 2018 (C). Alex Robenko. All rights reserved.
+//
+
+// This file is free software: you can redistribute it and/or modify
+// it under the terms of the GNU General Public License as published by
+// the Free Software Foundation, either version 3 of the License, or
+// (at your option) any later version.
+//
+// This program is distributed in the hope that it will be useful,
+// but WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+// GNU General Public License for more details.
+//
+// You should have received a copy of the GNU General Public License
+// along with this program.  If not, see <http://www.gnu.org/licenses/>.
+
+/// @file
+/// @brief Contains definition of lazy view of TIM-TP message.
+/// @details Generated by script/gen_views.py, do NOT edit manually.
+
+#pragma once
+
+#include "ublox/message/TimTp.h"
+#include "MsgView.h"
+
+namespace ublox
+{
+
+namespace view
+{
+
+/// @brief Lazy read-only view of TIM-TP message payload.
+/// @details Wraps the pointer to the validated payload, the fields are
+///     decoded on access only, see @ref MsgView.
+/// @see @ref ublox::message::TimTp
+class TimTpView : public
+    MsgView<
+        ublox::message::TimTpFields::All
+    >
+{
+    using Base =
+        MsgView<
+            ublox::message::TimTpFields::All
+        >;
+
+public:
+    /// @brief ID of the viewed message.
+    static const MsgId MsgIdValue = MsgId_TIM_TP;
+
+    /// @brief Index of the fields, same as the ones defined by
+    ///     @b COMMS_MSG_FIELDS_ACCESS() in @ref ublox::message::TimTp.
+    enum FieldIdx
+    {
+        FieldIdx_towMS, ///< index of @b towMS field
+        FieldIdx_towSubMS, ///< index of @b towSubMS field
+        FieldIdx_qErr, ///< index of @b qErr field
+        FieldIdx_week, ///< index of @b week field
+        FieldIdx_flags, ///< index of @b flags field
+        FieldIdx_refInfo, ///< index of @b refInfo field
+        FieldIdx_numOfValues ///< number of available fields
+    };
+
+    /// @brief Default constructor, creates empty view.
+    TimTpView() = default;
+
+    /// @brief Constructor
+    /// @param[in] payload Pointer to the payload of the message.
+    /// @param[in] len Length of the payload.
+    TimTpView(const std::uint8_t* payload, std::size_t len)
+      : Base(payload, len)
+    {
+    }
+
+    /// @brief Decode "towMS" field (see @ref ublox::message::TimTpFields::towMS).
+    comms::ErrorStatus field_towMS(FieldType<FieldIdx_towMS>& field) const
+    {
+        return Base::readField<FieldIdx_towMS>(field);
+    }
+
+    /// @brief Decode "towSubMS" field (see @ref ublox::message::TimTpFields::towSubMS).
+    comms::ErrorStatus field_towSubMS(FieldType<FieldIdx_towSubMS>& field) const
+    {
+        return Base::readField<FieldIdx_towSubMS>(field);
+    }
+
+    /// @brief Decode "qErr" field (see @ref ublox::message::TimTpFields::qErr).
+    comms::ErrorStatus field_qErr(FieldType<FieldIdx_qErr>& field) const
+    {
+        return Base::readField<FieldIdx_qErr>(field);
+    }
+
+    /// @brief Decode "week" field (see @ref ublox::message::TimTpFields::week).
+    comms::ErrorStatus field_week(FieldType<FieldIdx_week>& field) const
+    {
+        return Base::readField<FieldIdx_week>(field);
+    }
+
+    /// @brief Decode "flags" field (see @ref ublox::message::TimTpFields::flags).
+    comms::ErrorStatus field_flags(FieldType<FieldIdx_flags>& field) const
+    {
+        return Base::readField<FieldIdx_flags>(field);
+    }
+
+    /// @brief Decode "refInfo" field (see @ref ublox::message::TimTpFields::refInfo).
+    comms::ErrorStatus field_refInfo(FieldType<FieldIdx_refInfo>& field) const
+    {
+        return Base::readField<FieldIdx_refInfo>(field);
+    }
+};
+
+} // namespace view
+
+} // namespace ublox
+
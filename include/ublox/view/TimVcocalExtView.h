@@ -0,0 +1,129 @@
+//
+// Copyright 2018 (C). Alex Robenko. All rights reserved.
+//
+
+// This file is free software: you can redistribute it and/or modify
+// it under the terms of the GNU General Public License as published by
+// the Free Software Foundation, either version 3 of the License, or
+// (at your option) any later version.
+//
+// This program is distributed in the hope that it will be useful,
+// but WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+// GNU General Public License for more details.
+//
+// You should have received a copy of the GNU General Public License
+// along with this program.  If not, see <http://www.gnu.org/licenses/>.
+
+/// @file
+/// @brief Contains definition of lazy view of TIM-VCOCAL (extended command) message.
+/// @details Generated by script/gen_views.py, do NOT edit manually.
+
+#pragma once
+
+#include "ublox/message/TimVcocalExt.h"
+#include "MsgView.h"
+
+namespace ublox
+{
+
+namespace view
+{
+
+/// @brief Lazy read-only view of TIM-VCOCAL (extended command) message payload.
+/// @details Wraps the pointer to the validated payload, the fields are
+///     decoded on access only, see @ref MsgView.
+/// @see @ref ublox::message::TimVcocalExt
+class TimVcocalExtView : public
+    MsgView<
+        ublox::message::TimVcocalExtFields::All
+    >
+{
+    using Base =
+        MsgView<
+            ublox::message::TimVcocalExtFields::All
+        >;
+
+public:
+    /// @brief ID of the viewed message.
+    static const MsgId MsgIdValue = MsgId_TIM_VCOCAL;
+
+    /// @brief Index of the fields, same as the ones defined by
+    ///     @b COMMS_MSG_FIELDS_ACCESS() in @ref ublox::message::TimVcocalExt.
+    enum FieldIdx
+    {
+        FieldIdx_type, ///< index of @b type field
+        FieldIdx_version, ///< index of @b version field
+        FieldIdx_oscId, ///< index of @b oscId field
+        FieldIdx_srcId, ///< index of @b srcId field
+        FieldIdx_reserved1, ///< index of @b reserved1 field
+        FieldIdx_raw0, ///< index of @b raw0 field
+        FieldIdx_raw1, ///< index of @b raw1 field
+        FieldIdx_maxStepSize, ///< index of @b maxStepSize field
+        FieldIdx_numOfValues ///< number of available fields
+    };
+
+    /// @brief Default constructor, creates empty view.
+    TimVcocalExtView() = default;
+
+    /// @brief Constructor
+    /// @param[in] payload Pointer to the payload of the message.
+    /// @param[in] len Length of the payload.
+    TimVcocalExtView(const std::uint8_t* payload, std::size_t len)
+      : Base(payload, len)
+    {
+    }
+
+    /// @brief Decode "type" field (see @ref ublox::message::TimVcocalExtFields::type).
+    comms::ErrorStatus field_type(FieldType<FieldIdx_type>& field) const
+    {
+        return Base::readField<FieldIdx_type>(field);
+    }
+
+    /// @brief Decode "version" field (see @ref ublox::message::TimVcocalExtFields::version).
+    comms::ErrorStatus field_version(FieldType<FieldIdx_version>& field) const
+    {
+        return Base::readField<FieldIdx_version>(field);
+    }
+
+    /// @brief Decode "oscId" field (see @ref ublox::message::TimVcocalExtFields::oscId).
+    comms::ErrorStatus field_oscId(FieldType<FieldIdx_oscId>& field) const
+    {
+        return Base::readField<FieldIdx_oscId>(field);
+    }
+
+    /// @brief Decode "srcId" field (see @ref ublox::message::TimVcocalExtFields::srcId).
+    comms::ErrorStatus field_srcId(FieldType<FieldIdx_srcId>& field) const
+    {
+        return Base::readField<FieldIdx_srcId>(field);
+    }
+
+    /// @brief Decode "reserved1" field (see @ref ublox::message::TimVcocalExtFields::reserved1).
+    comms::ErrorStatus field_reserved1(FieldType<FieldIdx_reserved1>& field) const
+    {
+        return Base::readField<FieldIdx_reserved1>(field);
+    }
+
+    /// @brief Decode "raw0" field (see @ref ublox::message::TimVcocalExtFields::raw0).
+    comms::ErrorStatus field_raw0(FieldType<FieldIdx_raw0>& field) const
+    {
+        return Base::readField<FieldIdx_raw0>(field);
+    }
+
+    /// @brief Decode "raw1" field (see @ref ublox::message::TimVcocalExtFields::raw1).
+    comms::ErrorStatus field_raw1(FieldType<FieldIdx_raw1>& field) const
+    {
+        return Base::readField<FieldIdx_raw1>(field);
+    }
+
+    /// @brief Decode "maxStepSize" field (see @ref ublox::message::TimVcocalExtFields::maxStepSize).
+    comms::ErrorStatus field_maxStepSize(FieldType<FieldIdx_maxStepSize>& field) const
+    {
+        return Base::readField<FieldIdx_maxStepSize>(field);
+    }
+};
+
+} // namespace view
+
+} // namespace ublox
+
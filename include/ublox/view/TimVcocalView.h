@@ -0,0 +1,115 @@
+//
+// Copyright 2018 (C). Alex Robenko. All rights reserved.
+//
+
+// This file is free software: you can redistribute it and/or modify
+// it under the terms of the GNU General Public License as published by
+// the Free Software Foundation, either version 3 of the License, or
+// (at your option) any later version.
+//
+// This program is distributed in the hope that it will be useful,
+// but WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+// GNU General Public License for more details.
+//
+// You should have received a copy of the GNU General Public License
+// along with this program.  If not, see <http://www.gnu.org/licenses/>.
+
+/// @file
+/// @brief Contains definition of lazy view of TIM-VCOCAL message.
+/// @details Generated by script/gen_views.py, do NOT edit manually.
+
+#pragma once
+
+#include "ublox/message/TimVcocal.h"
+#include "MsgView.h"
+
+namespace ublox
+{
+
+namespace view
+{
+
+/// @brief Lazy read-only view of TIM-VCOCAL message payload.
+/// @details Wraps the pointer to the validated payload, the fields are
+///     decoded on access only, see @ref MsgView.
+/// @see @ref ublox::message::TimVcocal
+class TimVcocalView : public
+    MsgView<
+        ublox::message::TimVcocalFields::All
+    >
+{
+    using Base =
+        MsgView<
+            ublox::message::TimVcocalFields::All
+        >;
+
+public:
+    /// @brief ID of the viewed message.
+    static const MsgId MsgIdValue = MsgId_TIM_VCOCAL;
+
+    /// @brief Index of the fields, same as the ones defined by
+    ///     @b COMMS_MSG_FIELDS_ACCESS() in @ref ublox::message::TimVcocal.
+    enum FieldIdx
+    {
+        FieldIdx_type, ///< index of @b type field
+        FieldIdx_version, ///< index of @b version field
+        FieldIdx_oscId, ///< index of @b oscId field
+        FieldIdx_reserved1, ///< index of @b reserved1 field
+        FieldIdx_gainUncertainty, ///< index of @b gainUncertainty field
+        FieldIdx_gainVco, ///< index of @b gainVco field
+        FieldIdx_numOfValues ///< number of available fields
+    };
+
+    /// @brief Default constructor, creates empty view.
+    TimVcocalView() = default;
+
+    /// @brief Constructor
+    /// @param[in] payload Pointer to the payload of the message.
+    /// @param[in] len Length of the payload.
+    TimVcocalView(const std::uint8_t* payload, std::size_t len)
+      : Base(payload, len)
+    {
+    }
+
+    /// @brief Decode "type" field (see @ref ublox::message::TimVcocalFields::type).
+    comms::ErrorStatus field_type(FieldType<FieldIdx_type>& field) const
+    {
+        return Base::readField<FieldIdx_type>(field);
+    }
+
+    /// @brief Decode "version" field (see @ref ublox::message::TimVcocalFields::version).
+    comms::ErrorStatus field_version(FieldType<FieldIdx_version>& field) const
+    {
+        return Base::readField<FieldIdx_version>(field);
+    }
+
+    /// @brief Decode "oscId" field (see @ref ublox::message::TimVcocalFields::oscId).
+    comms::ErrorStatus field_oscId(FieldType<FieldIdx_oscId>& field) const
+    {
+        return Base::readField<FieldIdx_oscId>(field);
+    }
+
+    /// @brief Decode "reserved1" field (see @ref ublox::message::TimVcocalFields::reserved1).
+    comms::ErrorStatus field_reserved1(FieldType<FieldIdx_reserved1>& field) const
+    {
+        return Base::readField<FieldIdx_reserved1>(field);
+    }
+
+    /// @brief Decode "gainUncertainty" field (see @ref ublox::message::TimVcocalFields::gainUncertainty).
+    comms::ErrorStatus field_gainUncertainty(FieldType<FieldIdx_gainUncertainty>& field) const
+    {
+        return Base::readField<FieldIdx_gainUncertainty>(field);
+    }
+
+    /// @brief Decode "gainVco" field (see @ref ublox::message::TimVcocalFields::gainVco).
+    comms::ErrorStatus field_gainVco(FieldType<FieldIdx_gainVco>& field) const
+    {
+        return Base::readField<FieldIdx_gainVco>(field);
+    }
+};
+
+} // namespace view
+
+} // namespace ublox
+
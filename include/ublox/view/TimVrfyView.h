@@ -0,0 +1,122 @@
+//
+// Copyright 2018 (C). Alex Robenko. All rights reserved.
+//
+
+// This file is free software: you can redistribute it and/or modify
+// it under the terms of the GNU General Public License as published by
+// the Free Software Foundation, either version 3 of the License, or
+// (at your option) any later version.
+//
+// This program is distributed in the hope that it will be useful,
+// but WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+// GNU General Public License for more details.
+//
+// You should have received a copy of the GNU General Public License
+// along with this program.  If not, see <http://www.gnu.org/licenses/>.
+
+/// @file
+/// @brief Contains definition of lazy view of TIM-VRFY message.
+/// @details Generated by script/gen_views.py, do NOT edit manually.
+
+#pragma once
+
+#include "ublox/message/TimVrfy.h"
+#include "MsgView.h"
+
+namespace ublox
+{
+
+namespace view
+{
+
+/// @brief Lazy read-only view of TIM-VRFY message payload.
+/// @details Wraps the pointer to the validated payload, the fields are
+///     decoded on access only, see @ref MsgView.
+/// @see @ref ublox::message::TimVrfy
+class TimVrfyView : public
+    MsgView<
+        ublox::message::TimVrfyFields::All
+    >
+{
+    using Base =
+        MsgView<
+            ublox::message::TimVrfyFields::All
+        >;
+
+public:
+    /// @brief ID of the viewed message.
+    static const MsgId MsgIdValue = MsgId_TIM_VRFY;
+
+    /// @brief Index of the fields, same as the ones defined by
+    ///     @b COMMS_MSG_FIELDS_ACCESS() in @ref ublox::message::TimVrfy.
+    enum FieldIdx
+    {
+        FieldIdx_itow, ///< index of @b itow field
+        FieldIdx_frac, ///< index of @b frac field
+        FieldIdx_deltaMS, ///< index of @b deltaMS field
+        FieldIdx_deltaNS, ///< index of @b deltaNS field
+        FieldIdx_wno, ///< index of @b wno field
+        FieldIdx_flags, ///< index of @b flags field
+        FieldIdx_reserved1, ///< index of @b reserved1 field
+        FieldIdx_numOfValues ///< number of available fields
+    };
+
+    /// @brief Default constructor, creates empty view.
+    TimVrfyView() = default;
+
+    /// @brief Constructor
+    /// @param[in] payload Pointer to the payload of the message.
+    /// @param[in] len Length of the payload.
+    TimVrfyView(const std::uint8_t* payload, std::size_t len)
+      : Base(payload, len)
+    {
+    }
+
+    /// @brief Decode "itow" field (see @ref ublox::message::TimVrfyFields::itow).
+    comms::ErrorStatus field_itow(FieldType<FieldIdx_itow>& field) const
+    {
+        return Base::readField<FieldIdx_itow>(field);
+    }
+
+    /// @brief Decode "frac" field (see @ref ublox::message::TimVrfyFields::frac).
+    comms::ErrorStatus field_frac(FieldType<FieldIdx_frac>& field) const
+    {
+        return Base::readField<FieldIdx_frac>(field);
+    }
+
+    /// @brief Decode "deltaMS" field (see @ref ublox::message::TimVrfyFields::deltaMS).
+    comms::ErrorStatus field_deltaMS(FieldType<FieldIdx_deltaMS>& field) const
+    {
+        return Base::readField<FieldIdx_deltaMS>(field);
+    }
+
+    /// @brief Decode "deltaNS" field (see @ref ublox::message::TimVrfyFields::deltaNS).
+    comms::ErrorStatus field_deltaNS(FieldType<FieldIdx_deltaNS>& field) const
+    {
+        return Base::readField<FieldIdx_deltaNS>(field);
+    }
+
+    /// @brief Decode "wno" field (see @ref ublox::message::TimVrfyFields::wno).
+    comms::ErrorStatus field_wno(FieldType<FieldIdx_wno>& field) const
+    {
+        return Base::readField<FieldIdx_wno>(field);
+    }
+
+    /// @brief Decode "flags" field (see @ref ublox::message::TimVrfyFields::flags).
+    comms::ErrorStatus field_flags(FieldType<FieldIdx_flags>& field) const
+    {
+        return Base::readField<FieldIdx_flags>(field);
+    }
+
+    /// @brief Decode "reserved1" field (see @ref ublox::message::TimVrfyFields::reserved1).
+    comms::ErrorStatus field_reserved1(FieldType<FieldIdx_reserved1>& field) const
+    {
+        return Base::readField<FieldIdx_reserved1>(field);
+    }
+};
+
+} // namespace view
+
+} // namespace ublox
+
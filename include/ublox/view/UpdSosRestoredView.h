@@ -0,0 +1,101 @@
+//
+// Copyright 2018 (C). Alex Robenko. All rights reserved.
+//
+
+// This file is free software: you can redistribute it and/or modify
+// it under the terms of the GNU General Public License as published by
+// the Free Software Foundation, either version 3 of the License, or
+// (at your option) any later version.
+//
+// This program is distributed in the hope that it will be useful,
+// but WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+// GNU General Public License for more details.
+//
+// You should have received a copy of the GNU General Public License
+// along with this program.  If not, see <http://www.gnu.org/licenses/>.
+
+/// @file
+/// @brief Contains definition of lazy view of UPD-SOS (@b restored) message.
+/// @details Generated by script/gen_views.py, do NOT edit manually.
+
+#pragma once
+
+#include "ublox/message/UpdSosRestored.h"
+#include "MsgView.h"
+
+namespace ublox
+{
+
+namespace view
+{
+
+/// @brief Lazy read-only view of UPD-SOS (@b restored) message payload.
+/// @details Wraps the pointer to the validated payload, the fields are
+///     decoded on access only, see @ref MsgView.
+/// @see @ref ublox::message::UpdSosRestored
+class UpdSosRestoredView : public
+    MsgView<
+        ublox::message::UpdSosRestoredFields::All
+    >
+{
+    using Base =
+        MsgView<
+            ublox::message::UpdSosRestoredFields::All
+        >;
+
+public:
+    /// @brief ID of the viewed message.
+    static const MsgId MsgIdValue = MsgId_UPD_SOS;
+
+    /// @brief Index of the fields, same as the ones defined by
+    ///     @b COMMS_MSG_FIELDS_ACCESS() in @ref ublox::message::UpdSosRestored.
+    enum FieldIdx
+    {
+        FieldIdx_cmd, ///< index of @b cmd field
+        FieldIdx_reserved1, ///< index of @b reserved1 field
+        FieldIdx_response, ///< index of @b response field
+        FieldIdx_reserved2, ///< index of @b reserved2 field
+        FieldIdx_numOfValues ///< number of available fields
+    };
+
+    /// @brief Default constructor, creates empty view.
+    UpdSosRestoredView() = default;
+
+    /// @brief Constructor
+    /// @param[in] payload Pointer to the payload of the message.
+    /// @param[in] len Length of the payload.
+    UpdSosRestoredView(const std::uint8_t* payload, std::size_t len)
+      : Base(payload, len)
+    {
+    }
+
+    /// @brief Decode "cmd" field (see @ref ublox::message::UpdSosRestoredFields::cmd).
+    comms::ErrorStatus field_cmd(FieldType<FieldIdx_cmd>& field) const
+    {
+        return Base::readField<FieldIdx_cmd>(field);
+    }
+
+    /// @brief Decode "reserved1" field (see @ref ublox::message::UpdSosRestoredFields::reserved1).
+    comms::ErrorStatus field_reserved1(FieldType<FieldIdx_reserved1>& field) const
+    {
+        return Base::readField<FieldIdx_reserved1>(field);
+    }
+
+    /// @brief Decode "response" field (see @ref ublox::message::UpdSosRestoredFields::response).
+    comms::ErrorStatus field_response(FieldType<FieldIdx_response>& field) const
+    {
+        return Base::readField<FieldIdx_response>(field);
+    }
+
+    /// @brief Decode "reserved2" field (see @ref ublox::message::UpdSosRestoredFields::reserved2).
+    comms::ErrorStatus field_reserved2(FieldType<FieldIdx_reserved2>& field) const
+    {
+        return Base::readField<FieldIdx_reserved2>(field);
+    }
+};
+
+} // namespace view
+
+} // namespace ublox
+
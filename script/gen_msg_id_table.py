@@ -0,0 +1,183 @@
+#!/usr/bin/env python3
+#
+# Generates include/ublox/details/MsgIdTable.h out of the ublox::MsgId
+# enumeration defined in include/ublox/MsgId.h.
+#
+# Must be re-run every time a new message ID is added:
+#     python3 script/gen_msg_id_table.py
+#
+
+import os
+import re
+import sys
+
+ROOT_DIR = os.path.dirname(os.path.dirname(os.path.abspath(__file__)))
+INPUT_FILE = os.path.join(ROOT_DIR, "include", "ublox", "MsgId.h")
+OUTPUT_FILE = os.path.join(ROOT_DIR, "include", "ublox", "details", "MsgIdTable.h")
+
+ID_REGEX = re.compile(r"^\s*(MsgId_\w+)\s*=\s*(0x[0-9a-fA-F]+|\d+)\s*,")
+
+HEADER = """//
+// Copyright 2018 (C). Alex Robenko. All rights reserved.
+//
+
+// This file is free software: you can redistribute it and/or modify
+// it under the terms of the GNU General Public License as published by
+// the Free Software Foundation, either version 3 of the License, or
+// (at your option) any later version.
+//
+// This program is distributed in the hope that it will be useful,
+// but WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+// GNU General Public License for more details.
+//
+// You should have received a copy of the GNU General Public License
+// along with this program.  If not, see <http://www.gnu.org/licenses/>.
+
+/// @file
+/// @brief Contains lookup table of all the known message IDs.
+/// @details Generated by script/gen_msg_id_table.py out of ublox::MsgId
+///     enumeration, do NOT edit manually.
+
+#pragma once
+
+#include <cstdint>
+#include <cstddef>
+
+#include "ublox/MsgId.h"
+
+namespace ublox
+{
+
+namespace details
+{
+
+/// @brief Number of known message IDs.
+static const std::size_t KnownMsgIdsCount = %(count)d;
+
+/// @brief Lookup tables of the known message IDs.
+/// @details Two level table: the class ID selects the row (row 0 is
+///     empty and used for unknown classes), while the message ID within
+///     the class selects the entry within the row. The entry is the index
+///     of the ID in @b KnownIds plus one, 0 for unknown ID. All the tables
+///     are constant initialised. Defined as class template to allow
+///     the definition of the static data members in the header.
+template <typename T = void>
+struct MsgIdTableData
+{
+    /// @brief Type of the entry.
+    using Index = %(index_type)s;
+
+    /// @brief Row of every class ID.
+    static constexpr std::uint8_t ClassRows[256] = {
+%(class_rows)s
+    };
+
+    /// @brief Index (plus one) of every message ID.
+    static constexpr Index Indexes[%(rows_count)d][256] = {
+%(indexes)s
+    };
+
+    /// @brief All the known message IDs in ascending order.
+    static constexpr ublox::MsgId KnownIds[KnownMsgIdsCount] = {
+%(known_ids)s
+    };
+};
+
+template <typename T>
+constexpr std::uint8_t MsgIdTableData<T>::ClassRows[256];
+
+template <typename T>
+constexpr typename MsgIdTableData<T>::Index MsgIdTableData<T>::Indexes[%(rows_count)d][256];
+
+template <typename T>
+constexpr ublox::MsgId MsgIdTableData<T>::KnownIds[KnownMsgIdsCount];
+
+/// @brief Get index of the known message ID.
+/// @return Index of the ID in @ref MsgIdTableData::KnownIds plus one,
+///     0 in case the ID is unknown.
+constexpr std::size_t knownMsgIdIndex(ublox::MsgId id)
+{
+    return
+        MsgIdTableData<>::Indexes
+            [MsgIdTableData<>::ClassRows[(static_cast<unsigned>(id) >> 8) & 0xffU]]
+            [static_cast<unsigned>(id) & 0xffU];
+}
+
+/// @brief Check whether provided message ID is known.
+inline bool isKnownMsgId(ublox::MsgId id)
+{
+    return knownMsgIdIndex(id) != 0U;
+}
+
+} // namespace details
+
+} // namespace ublox
+
+"""
+
+
+def read_ids():
+    ids = {}
+    with open(INPUT_FILE) as input_file:
+        for line in input_file:
+            match = ID_REGEX.match(line)
+            if match:
+                # The first name of the duplicate value is used
+                ids.setdefault(int(match.group(2), 0), match.group(1))
+    return ids
+
+
+def format_values(values, indent):
+    lines = []
+    for start in range(0, len(values), 16):
+        lines.append(indent + ", ".join("%d" % v for v in values[start:start + 16]) + ",")
+    return "\n".join(lines)
+
+
+def generate(ids):
+    known_ids = sorted(ids)
+    classes = sorted(set(i >> 8 for i in known_ids))
+    class_rows = [0] * 256
+    for idx, cls in enumerate(classes):
+        class_rows[cls] = idx + 1
+
+    rows = [[0] * 256 for _ in range(len(classes) + 1)]
+    for idx, msg_id in enumerate(known_ids):
+        rows[class_rows[msg_id >> 8]][msg_id & 0xff] = idx + 1
+
+    indexes_lines = []
+    for idx, row in enumerate(rows):
+        comment = "unknown" if idx == 0 else "class 0x%02x" % classes[idx - 1]
+        indexes_lines.append("        { // " + comment)
+        indexes_lines.append(format_values(row, "            "))
+        indexes_lines.append("        },")
+
+    index_type = "std::uint8_t" if len(known_ids) < 0xff else "std::uint16_t"
+    return HEADER % {
+        "count": len(known_ids),
+        "index_type": index_type,
+        "class_rows": format_values(class_rows, "        "),
+        "rows_count": len(rows),
+        "indexes": "\n".join(indexes_lines),
+        "known_ids": "\n".join("        ublox::%s," % ids[i] for i in known_ids),
+    }
+
+
+def main():
+    ids = read_ids()
+    if not ids:
+        sys.stderr.write("ERROR: No message IDs found in %s\n" % INPUT_FILE)
+        return 1
+
+    output_dir = os.path.dirname(OUTPUT_FILE)
+    if not os.path.isdir(output_dir):
+        os.makedirs(output_dir)
+
+    with open(OUTPUT_FILE, "w") as output_file:
+        output_file.write(generate(ids))
+    return 0
+
+
+if __name__ == "__main__":
+    sys.exit(main())
@@ -0,0 +1,326 @@
+#!/usr/bin/env python3
+#
+# Generates lazy read-only views (include/ublox/view/*View.h) for all the
+# messages defined in include/ublox/message folder.
+#
+# Must be re-run every time a new message is added or the fields of
+# existing message are modified:
+#     python3 script/gen_views.py
+#
+
+import os
+import re
+import sys
+
+ROOT_DIR = os.path.dirname(os.path.dirname(os.path.abspath(__file__)))
+MESSAGE_DIR = os.path.join(ROOT_DIR, "include", "ublox", "message")
+OUTPUT_DIR = os.path.join(ROOT_DIR, "include", "ublox", "view")
+
+CLASS_REGEX = re.compile(
+    r"^template\s*<(?P<params>[^;{]*?)>\s*\nclass (?P<name>\w+) : public\s*\n(?P<bases>.*?)^\{",
+    re.S | re.M)
+FIELDS_IMPL_REGEX = re.compile(r"comms::option::FieldsImpl<\s*(?P<fields>[\w:]+(?:<[^;]*?>)?)\s*>,")
+MSG_ID_REGEX = re.compile(r"\b(MsgId_\w+)\b")
+ACCESS_REGEX = re.compile(r"^\s+COMMS_MSG_FIELDS_ACCESS\((?P<names>[^;]*?)\);", re.S | re.M)
+FIELD_REF_REGEX = re.compile(r"@li @b (\w+) for @ref ([\w:]+) field")
+TEMPLATE_OPT_REGEX = re.compile(r"typename (T\w+)\s*=\s*([\w:]+)")
+VARIABLE_FIELD_KEYWORDS = ("List", "Optional", "String")
+
+HEADER = """//
+// Copyright 2018 (C). Alex Robenko. All rights reserved.
+//
+
+// This file is free software: you can redistribute it and/or modify
+// it under the terms of the GNU General Public License as published by
+// the Free Software Foundation, either version 3 of the License, or
+// (at your option) any later version.
+//
+// This program is distributed in the hope that it will be useful,
+// but WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+// GNU General Public License for more details.
+//
+// You should have received a copy of the GNU General Public License
+// along with this program.  If not, see <http://www.gnu.org/licenses/>.
+
+/// @file
+/// @brief Contains definition of lazy view of %(display)s message.
+/// @details Generated by script/gen_views.py, do NOT edit manually.
+
+#pragma once
+
+#include "ublox/message/%(name)s.h"
+#include "MsgView.h"
+
+namespace ublox
+{
+
+namespace view
+{
+
+/// @brief Lazy read-only view of %(display)s message payload.
+/// @details Wraps the pointer to the validated payload, the fields are
+///     decoded on access only, see @ref MsgView.
+%(details)s/// @see @ref ublox::message::%(name)s
+class %(name)sView : public
+    MsgView<
+        %(fields)s
+    >
+{
+    using Base =
+        MsgView<
+            %(fields)s
+        >;
+
+public:
+    /// @brief ID of the viewed message.
+    static const MsgId MsgIdValue = %(msg_id)s;
+%(field_idx)s
+    /// @brief Default constructor, creates empty view.
+    %(name)sView() = default;
+
+    /// @brief Constructor
+    /// @param[in] payload Pointer to the payload of the message.
+    /// @param[in] len Length of the payload.
+    %(name)sView(const std::uint8_t* payload, std::size_t len)
+      : Base(payload, len)
+    {
+    }
+%(accessors)s};
+
+} // namespace view
+
+} // namespace ublox
+
+"""
+
+FIELD_IDX = """
+    /// @brief Index of the fields, same as the ones defined by
+    ///     @b COMMS_MSG_FIELDS_ACCESS() in @ref ublox::message::%(name)s.
+    enum FieldIdx
+    {
+%(values)s
+        FieldIdx_numOfValues ///< number of available fields
+    };
+"""
+
+ACCESSOR = """
+    /// @brief Decode "%(field)s" field (see @ref ublox::message::%(ref)s).
+    comms::ErrorStatus field_%(field)s(FieldType<FieldIdx_%(field)s>& field) const
+    {
+        return Base::readField<FieldIdx_%(field)s>(field);
+    }
+"""
+
+OPTIONAL_ACCESSOR = """
+    /// @brief Decode "%(field)s" field (see @ref ublox::message::%(ref)s).
+    /// @details The field is present only when the payload is long enough
+    ///     to contain all the fields starting from "%(first)s", it is
+    ///     reported as missing otherwise.
+    comms::ErrorStatus field_%(field)s(FieldType<FieldIdx_%(field)s>& field) const
+    {
+        return Base::readTrailingOptionalField<FieldIdx_%(field)s, FieldIdx_%(first)s>(field);
+    }
+"""
+
+TRUNCATED_DETAILS = """///     The message performs custom read of its fields, the fields starting
+///     from "%(field)s" are not accessible through the view, because their
+///     presence and/or size depend on the values of preceding fields.
+"""
+
+OPTIONAL_DETAILS = """///     The fields starting from "%(field)s" are present only when the
+///     payload is long enough to contain all of them.
+"""
+
+# Custom read marking the trailing optional fields missing when the
+# remaining length is too short
+LENGTH_CHECK_REGEX = re.compile(r"if \(len < \w+\)\s*\{(?P<body>[^}]*)\}", re.S)
+
+
+def field_definitions(text, struct):
+    match = re.search(r"^struct %s\b.*?^\};" % struct, text, re.S | re.M)
+    if not match:
+        return {}
+
+    body = match.group(0)
+    defs = {}
+    for def_match in re.finditer(r"^    (?:template <[^>]*>\s*)?using (\w+) =(.*?);", body, re.S | re.M):
+        defs[def_match.group(1)] = def_match.group(2)
+    for def_match in re.finditer(r"^    struct (\w+) : public(.*?)\{", body, re.S | re.M):
+        defs[def_match.group(1)] = def_match.group(2)
+    return defs
+
+
+def is_variable(defs, field, seen=None):
+    text = defs.get(field)
+    if text is None:
+        return False
+
+    if any(k in text for k in VARIABLE_FIELD_KEYWORDS):
+        return True
+
+    seen = seen or set()
+    seen.add(field)
+    for ref in re.findall(r"\b(\w+)\b", text):
+        if (ref in defs) and (ref not in seen) and is_variable(defs, ref, seen):
+            return True
+    return False
+
+
+def is_optional(defs, field):
+    text = defs.get(field)
+    return (text is not None) and ("Optional" in text)
+
+
+def length_checked(source_text, names):
+    match = LENGTH_CHECK_REGEX.search(source_text)
+    if not match:
+        return False
+
+    body = match.group("body")
+    return all(("field_%s().setMissing()" % n) in body for n in names)
+
+
+def parse_message(path):
+    with open(path) as msg_file:
+        text = msg_file.read()
+
+    class_match = CLASS_REGEX.search(text)
+    if not class_match:
+        return None
+
+    name = class_match.group("name")
+    display = "@b " + name
+    for brief_match in re.finditer(r"/// @brief Definition of (.*?) message", text[:class_match.start()]):
+        display = brief_match.group(1)
+    bases = class_match.group("bases")
+    opts = dict(TEMPLATE_OPT_REGEX.findall(class_match.group("params")))
+    msg_id_match = MSG_ID_REGEX.search(bases)
+    if not msg_id_match:
+        return None
+
+    source_text = text
+    fields_match = FIELDS_IMPL_REGEX.search(bases)
+    if not fields_match:
+        base_match = re.match(r"\s*(\w+)<", bases)
+        if not base_match:
+            return None
+
+        base_path = os.path.join(MESSAGE_DIR, base_match.group(1) + ".h")
+        if not os.path.isfile(base_path):
+            return None
+
+        with open(base_path) as base_file:
+            source_text = base_file.read()
+
+        base_class = CLASS_REGEX.search(source_text)
+        fields_match = FIELDS_IMPL_REGEX.search(base_class.group("bases"))
+        opts.update(TEMPLATE_OPT_REGEX.findall(base_class.group("params")))
+
+    fields = fields_match.group("fields")
+    for opt, default in opts.items():
+        if opt != "TMsgBase":
+            fields = re.sub(r"\b%s\b" % opt, default, fields)
+
+    access_match = ACCESS_REGEX.search(source_text)
+    names = []
+    if access_match:
+        names = [n.strip() for n in access_match.group("names").split(",") if n.strip()]
+
+    fields_struct = fields.split("::")[0]
+    refs = dict(FIELD_REF_REGEX.findall(source_text))
+    defs = field_definitions(source_text, fields_struct)
+    accessible = len(names)
+    optional_from = len(names)
+    if "doRead(" in source_text:
+        for idx, field in enumerate(names):
+            ref = refs.get(field, fields_struct + "::" + field)
+            if is_variable(defs, ref.split("::")[-1]):
+                accessible = idx
+                break
+
+        trailing = names[accessible:]
+        trailing_defs = [refs.get(n, fields_struct + "::" + n).split("::")[-1] for n in trailing]
+        if trailing and \
+                all(is_optional(defs, d) for d in trailing_defs) and \
+                length_checked(source_text, trailing):
+            optional_from = accessible
+            accessible = len(names)
+
+    return {
+        "name": name,
+        "display": display,
+        "msg_id": msg_id_match.group(1),
+        "fields": "ublox::message::" + fields,
+        "names": names,
+        "refs": refs,
+        "fields_struct": fields_struct,
+        "accessible": accessible,
+        "optional_from": optional_from,
+    }
+
+
+def generate(msg):
+    field_idx = ""
+    if msg["names"]:
+        field_idx = FIELD_IDX % {
+            "name": msg["name"],
+            "values": "\n".join(
+                "        FieldIdx_%s, ///< index of @b %s field" % (n, n) for n in msg["names"]),
+        }
+
+    accessors = ""
+    for idx, field in enumerate(msg["names"][:msg["accessible"]]):
+        template = ACCESSOR
+        if msg["optional_from"] <= idx:
+            template = OPTIONAL_ACCESSOR
+
+        accessors += template % {
+            "field": field,
+            "ref": msg["refs"].get(field, msg["fields_struct"] + "::" + field),
+            "first": msg["names"][min(msg["optional_from"], len(msg["names"]) - 1)],
+        }
+
+    details = ""
+    if msg["accessible"] < len(msg["names"]):
+        details = TRUNCATED_DETAILS % {"field": msg["names"][msg["accessible"]]}
+    elif msg["optional_from"] < len(msg["names"]):
+        details = OPTIONAL_DETAILS % {"field": msg["names"][msg["optional_from"]]}
+
+    return HEADER % {
+        "name": msg["name"],
+        "display": msg["display"],
+        "msg_id": msg["msg_id"],
+        "fields": msg["fields"],
+        "field_idx": field_idx,
+        "details": details,
+        "accessors": accessors,
+    }
+
+
+def main():
+    if not os.path.isdir(OUTPUT_DIR):
+        os.makedirs(OUTPUT_DIR)
+
+    count = 0
+    for file_name in sorted(os.listdir(MESSAGE_DIR)):
+        if not file_name.endswith(".h"):
+            continue
+
+        msg = parse_message(os.path.join(MESSAGE_DIR, file_name))
+        if msg is None:
+            continue
+
+        output_file_name = os.path.join(OUTPUT_DIR, msg["name"] + "View.h")
+        with open(output_file_name, "w") as output_file:
+            output_file.write(generate(msg))
+        count += 1
+
+    if count == 0:
+        sys.stderr.write("ERROR: No messages found in %s\n" % MESSAGE_DIR)
+        return 1
+    return 0
+
+
+if __name__ == "__main__":
+    sys.exit(main())
@@ -0,0 +1,255 @@
+//
+// Copyright 2018 (C). Alex Robenko. All rights reserved.
+//
+
+// This file is free software: you can redistribute it and/or modify
+// it under the terms of the GNU General Public License as published by
+// the Free Software Foundation, either version 3 of the License, or
+// (at your option) any later version.
+//
+// This program is distributed in the hope that it will be useful,
+// but WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+// GNU General Public License for more details.
+//
+// You should have received a copy of the GNU General Public License
+// along with this program.  If not, see <http://www.gnu.org/licenses/>.
+
+// Round trip of the capture file written by ublox::io::CaptureWriter and
+// read by ublox::io::CaptureReader, including the seek across the GPS
+// week boundary and the rebuild of the missing index.
+
+#include <cstdint>
+#include <cstddef>
+#include <cerrno>
+#include <string>
+#include <vector>
+
+#include <fcntl.h>
+#include <unistd.h>
+
+#include "ublox/io/CaptureWriter.h"
+#include "ublox/io/CaptureReader.h"
+
+#include "TestCommon.h"
+
+namespace
+{
+
+using Data = std::vector<std::uint8_t>;
+using ublox::io::capture::MsInWeek;
+using ublox::io::capture::NoTimeOfWeek;
+
+const std::uint32_t StartTOW = MsInWeek - 5000U;
+const std::uint32_t EpochStepMs = 1000U;
+const std::size_t EpochsCount = 10U;
+
+Data makeNavPvt(std::uint32_t iTOW)
+{
+    Data payload(92U, 0U);
+    ublox::io::capture::writeLe(&payload[0], iTOW, 4U);
+    return ublox::test::makeFrame(0x01, 0x07, payload);
+}
+
+Data makeMonHw()
+{
+    return ublox::test::makeFrame(0x0a, 0x09, Data(60U, 0x5a));
+}
+
+ublox::FrameSpan span(const Data& frame)
+{
+    ublox::FrameSpan result;
+    result.m_data = &frame[0];
+    result.m_size = frame.size();
+    return result;
+}
+
+std::uint32_t epochTOW(std::size_t epoch)
+{
+    return static_cast<std::uint32_t>((StartTOW + (epoch * EpochStepMs)) % MsInWeek);
+}
+
+// Untimed frame, then every epoch NAV-PVT followed by untimed frame,
+// wrapping the week in the middle.
+std::vector<Data> makeFrames()
+{
+    std::vector<Data> frames;
+    frames.push_back(makeMonHw());
+    for (std::size_t epoch = 0U; epoch < EpochsCount; ++epoch) {
+        frames.push_back(makeNavPvt(epochTOW(epoch)));
+        frames.push_back(makeMonHw());
+    }
+    return frames;
+}
+
+std::string capturePath()
+{
+    return "ublox_test_capture_" + std::to_string(::getpid()) + ".ucap";
+}
+
+bool writeCapture(const std::string& path, const std::vector<Data>& frames)
+{
+    ublox::io::CaptureWriter writer(256U);
+    if (!UBLOX_TEST_CHECK(writer.open(path.c_str()))) {
+        return false;
+    }
+
+    for (std::size_t idx = 0U; idx < frames.size(); ++idx) {
+        UBLOX_TEST_CHECK(writer.write(span(frames[idx]), static_cast<std::int64_t>(idx) * 1000));
+    }
+
+    UBLOX_TEST_CHECK(writer.frameCount() == frames.size());
+    return UBLOX_TEST_CHECK(writer.close());
+}
+
+void checkCapture(const ublox::io::CaptureReader& reader, const std::vector<Data>& frames)
+{
+    if (!UBLOX_TEST_CHECK(reader.size() == frames.size())) {
+        return;
+    }
+
+    for (std::size_t idx = 0U; idx < frames.size(); ++idx) {
+        ublox::io::CaptureRecord rec;
+        if (!UBLOX_TEST_CHECK(reader.record(idx, rec))) {
+            continue;
+        }
+
+        UBLOX_TEST_CHECK(rec.m_timestampNs == static_cast<std::int64_t>(idx) * 1000);
+        UBLOX_TEST_CHECK(Data(rec.m_frame.data(), rec.m_frame.data() + rec.m_frame.size()) == frames[idx]);
+        UBLOX_TEST_CHECK(rec.m_msgId == ublox::io::capture::frameMsgId(&frames[idx][0]));
+        if (idx == 0U) {
+            UBLOX_TEST_CHECK(rec.m_iTOW == NoTimeOfWeek);
+            continue;
+        }
+
+        auto epoch = (idx - 1U) / 2U;
+        UBLOX_TEST_CHECK(rec.m_iTOW == epochTOW(epoch));
+        UBLOX_TEST_CHECK(rec.m_week == ((StartTOW <= rec.m_iTOW) ? 0U : 1U));
+    }
+
+    // Before the wrap
+    UBLOX_TEST_CHECK(reader.seek(0U, 0U) == 1U);
+    UBLOX_TEST_CHECK(reader.seek(StartTOW) == 1U);
+    UBLOX_TEST_CHECK(reader.seek(StartTOW + 1U) == 3U);
+    UBLOX_TEST_CHECK(reader.seek(epochTOW(4U)) == 9U);
+
+    // After the wrap, the time of week restarts from 0
+    UBLOX_TEST_CHECK(epochTOW(5U) == 0U);
+    UBLOX_TEST_CHECK(reader.seek(epochTOW(5U)) == 11U);
+    UBLOX_TEST_CHECK(reader.seek(epochTOW(7U) - 1U) == 15U);
+    UBLOX_TEST_CHECK(reader.seek(epochTOW(9U)) == 19U);
+    UBLOX_TEST_CHECK(reader.seek(epochTOW(9U) + 1U) == frames.size());
+    UBLOX_TEST_CHECK(reader.seek(1U, epochTOW(6U)) == 13U);
+    UBLOX_TEST_CHECK(reader.seek(0U, MsInWeek - 1U) == 11U);
+    UBLOX_TEST_CHECK(reader.seek(2U, 0U) == frames.size());
+
+    // Replay from the found record
+    std::size_t replayed = 0U;
+    auto next =
+        reader.replay(
+            reader.seek(epochTOW(8U)),
+            reader.size(),
+            [&replayed](const ublox::io::CaptureRecord& rec) -> bool
+            {
+                ++replayed;
+                return rec.m_msgId != ublox::MsgId_NAV_PVT;
+            });
+    UBLOX_TEST_CHECK(replayed == 1U);
+    UBLOX_TEST_CHECK(next == 17U);
+}
+
+void testRoundTrip()
+{
+    auto frames = makeFrames();
+    auto path = capturePath();
+    if (!writeCapture(path, frames)) {
+        return;
+    }
+
+    ublox::io::CaptureReader reader;
+    if (UBLOX_TEST_CHECK(reader.open(path.c_str()))) {
+        UBLOX_TEST_CHECK(reader.isIndexed());
+        checkCapture(reader, frames);
+    }
+    reader.close();
+
+    // Drop the index and the half of the last record, as after the crash
+    std::size_t recordsLen = ublox::io::capture::FileHeaderLen;
+    for (auto& frame : frames) {
+        recordsLen += ublox::io::capture::RecordHeaderLen + frame.size();
+    }
+    UBLOX_TEST_CHECK(::truncate(path.c_str(), static_cast<off_t>(recordsLen - 20U)) == 0);
+
+    if (UBLOX_TEST_CHECK(reader.open(path.c_str()))) {
+        UBLOX_TEST_CHECK(!reader.isIndexed());
+        UBLOX_TEST_CHECK(reader.size() == (frames.size() - 1U));
+        UBLOX_TEST_CHECK(reader.seek(epochTOW(9U)) == 19U);
+        UBLOX_TEST_CHECK(reader.seek(epochTOW(5U)) == 11U);
+        UBLOX_TEST_CHECK(reader.seek(1U, 0U) == 11U);
+    }
+    reader.close();
+    ::unlink(path.c_str());
+}
+
+void testShortFrameRejected()
+{
+    auto path = capturePath();
+    ublox::io::CaptureWriter writer;
+    if (!UBLOX_TEST_CHECK(writer.open(path.c_str()))) {
+        return;
+    }
+
+    Data frame = {0xb5, 0x62, 0x01};
+    errno = 0;
+    UBLOX_TEST_CHECK(!writer.write(span(frame), 0));
+    UBLOX_TEST_CHECK(errno == EINVAL);
+    UBLOX_TEST_CHECK(!writer.write(ublox::FrameSpan(), 0));
+    UBLOX_TEST_CHECK(writer.frameCount() == 0U);
+    UBLOX_TEST_CHECK(writer.close());
+
+    ublox::io::CaptureReader reader;
+    if (UBLOX_TEST_CHECK(reader.open(path.c_str()))) {
+        UBLOX_TEST_CHECK(reader.isIndexed());
+        UBLOX_TEST_CHECK(reader.size() == 0U);
+        UBLOX_TEST_CHECK(reader.seek(0U) == 0U);
+    }
+    reader.close();
+    ::unlink(path.c_str());
+}
+
+void testWriteFailureNotIndexed()
+{
+    // Every write to /dev/full fails with ENOSPC
+    auto fd = ::open("/dev/full", O_WRONLY);
+    if (fd < 0) {
+        std::cout << "/dev/full is not available, skipping" << std::endl;
+        return;
+    }
+    ::close(fd);
+
+    auto frame = makeNavPvt(1000U);
+    auto recLen = ublox::io::capture::RecordHeaderLen + frame.size();
+    ublox::io::CaptureWriter writer(ublox::io::capture::FileHeaderLen + (2U * recLen));
+    if (!UBLOX_TEST_CHECK(writer.open("/dev/full"))) {
+        return;
+    }
+
+    UBLOX_TEST_CHECK(writer.write(span(frame), 0));
+    UBLOX_TEST_CHECK(writer.write(span(frame), 0));
+    errno = 0;
+    UBLOX_TEST_CHECK(!writer.write(span(frame), 0));
+    UBLOX_TEST_CHECK(errno == ENOSPC);
+    UBLOX_TEST_CHECK(writer.frameCount() == 2U);
+    UBLOX_TEST_CHECK(!writer.close());
+}
+
+} // namespace
+
+int main()
+{
+    testRoundTrip();
+    testShortFrameRejected();
+    testWriteFailureNotIndexed();
+    return ublox::test::result();
+}
+
@@ -0,0 +1,227 @@
+//
+// Copyright 2018 (C). Alex Robenko. All rights reserved.
+//
+
+// This file is free software: you can redistribute it and/or modify
+// it under the terms of the GNU General Public License as published by
+// the Free Software Foundation, either version 3 of the License, or
+// (at your option) any later version.
+//
+// This program is distributed in the hope that it will be useful,
+// but WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+// GNU General Public License for more details.
+//
+// You should have received a copy of the GNU General Public License
+// along with this program.  If not, see <http://www.gnu.org/licenses/>.
+
+// Checks the acknowledgement correlation, ordering and retries of
+// ublox::driver::CfgTransaction.
+
+#include <cstdint>
+#include <cstddef>
+#include <chrono>
+#include <limits>
+#include <vector>
+
+#include "ublox/driver/CfgTransaction.h"
+
+#include "TestCommon.h"
+
+namespace
+{
+
+using Transaction = ublox::driver::CfgTransaction;
+using ublox::driver::CfgStatus;
+
+void add(Transaction& transaction, ublox::MsgId id)
+{
+    auto frame = ublox::test::makeFrame(id, {0x00});
+    UBLOX_TEST_CHECK(transaction.addFrame(&frame[0], frame.size()) == comms::ErrorStatus::Success);
+}
+
+struct Recorder
+{
+    void operator()(const std::uint8_t* frame, std::size_t len)
+    {
+        UBLOX_TEST_CHECK(8U < len);
+        m_sent.push_back(
+            static_cast<ublox::MsgId>(
+                (static_cast<unsigned>(frame[2]) << std::numeric_limits<std::uint8_t>::digits) | frame[3]));
+    }
+
+    std::vector<ublox::MsgId> m_sent;
+};
+
+void testSameIdPipelined()
+{
+    static const std::size_t FramesCount = 10U;
+    Transaction transaction(4U);
+    for (auto idx = 0U; idx < FramesCount; ++idx) {
+        add(transaction, ublox::MsgId_CFG_MSG);
+    }
+
+    Recorder recorder;
+    auto now = Transaction::Clock::now();
+
+    // Frames with the same ID fill the whole window
+    UBLOX_TEST_CHECK(transaction.process(now, recorder) == 4U);
+    UBLOX_TEST_CHECK(transaction.inFlight() == 4U);
+
+    // Acknowledgements are attributed in order of sending
+    UBLOX_TEST_CHECK(transaction.ackReceived(ublox::MsgId_CFG_MSG));
+    UBLOX_TEST_CHECK(transaction.nakReceived(ublox::MsgId_CFG_MSG));
+    UBLOX_TEST_CHECK(transaction.status(0U) == CfgStatus::Acked);
+    UBLOX_TEST_CHECK(transaction.status(1U) == CfgStatus::Nacked);
+    UBLOX_TEST_CHECK(transaction.status(2U) == CfgStatus::InFlight);
+    UBLOX_TEST_CHECK(transaction.status(3U) == CfgStatus::InFlight);
+
+    UBLOX_TEST_CHECK(transaction.process(now, recorder) == 2U);
+    UBLOX_TEST_CHECK(transaction.status(5U) == CfgStatus::InFlight);
+    UBLOX_TEST_CHECK(transaction.status(6U) == CfgStatus::Queued);
+
+    while (!transaction.done()) {
+        if (!UBLOX_TEST_CHECK(transaction.ackReceived(ublox::MsgId_CFG_MSG))) {
+            break;
+        }
+        transaction.process(now, recorder);
+    }
+
+    // Nothing is outstanding for the stray acknowledgement
+    UBLOX_TEST_CHECK(!transaction.ackReceived(ublox::MsgId_CFG_MSG));
+    UBLOX_TEST_CHECK(transaction.count(CfgStatus::Acked) == (FramesCount - 1U));
+    UBLOX_TEST_CHECK(recorder.m_sent.size() == FramesCount);
+}
+
+void testOldestSentIsAcked()
+{
+    Transaction transaction(2U);
+    add(transaction, ublox::MsgId_CFG_MSG);
+    add(transaction, ublox::MsgId_CFG_RATE);
+    add(transaction, ublox::MsgId_CFG_MSG);
+    add(transaction, ublox::MsgId_CFG_NAV5);
+
+    Recorder recorder;
+    auto now = Transaction::Clock::now();
+    UBLOX_TEST_CHECK(transaction.process(now, recorder) == 2U);
+    UBLOX_TEST_CHECK(transaction.ackReceived(ublox::MsgId_CFG_RATE));
+    UBLOX_TEST_CHECK(transaction.process(now, recorder) == 1U);
+
+    // Both CFG-MSG are outstanding, the first one is acknowledged first
+    UBLOX_TEST_CHECK(transaction.nakReceived(ublox::MsgId_CFG_MSG));
+    UBLOX_TEST_CHECK(transaction.status(0U) == CfgStatus::Nacked);
+    UBLOX_TEST_CHECK(transaction.status(2U) == CfgStatus::InFlight);
+    UBLOX_TEST_CHECK(transaction.ackReceived(ublox::MsgId_CFG_MSG));
+    UBLOX_TEST_CHECK(transaction.status(2U) == CfgStatus::Acked);
+
+    UBLOX_TEST_CHECK(transaction.process(now, recorder) == 1U);
+    UBLOX_TEST_CHECK(transaction.ackReceived(ublox::MsgId_CFG_NAV5));
+    UBLOX_TEST_CHECK(transaction.done());
+    UBLOX_TEST_CHECK(!transaction.succeeded());
+
+    std::vector<ublox::MsgId> expected = {
+        ublox::MsgId_CFG_MSG,
+        ublox::MsgId_CFG_RATE,
+        ublox::MsgId_CFG_MSG,
+        ublox::MsgId_CFG_NAV5
+    };
+    UBLOX_TEST_CHECK(recorder.m_sent == expected);
+}
+
+void testInvalidFrame()
+{
+    Transaction transaction;
+    auto frame = ublox::test::makeFrame(ublox::MsgId_CFG_RATE, {0xe8, 0x03, 0x01, 0x00, 0x01, 0x00});
+
+    // Truncated frame
+    UBLOX_TEST_CHECK(transaction.addFrame(&frame[0], frame.size() - 1U) == comms::ErrorStatus::ProtocolError);
+
+    // Length field doesn't match
+    auto badLength = frame;
+    badLength.push_back(0x00);
+    UBLOX_TEST_CHECK(transaction.addFrame(&badLength[0], badLength.size()) == comms::ErrorStatus::ProtocolError);
+
+    // Corrupted payload
+    auto badChecksum = frame;
+    badChecksum[7] ^= 0x10;
+    UBLOX_TEST_CHECK(transaction.addFrame(&badChecksum[0], badChecksum.size()) == comms::ErrorStatus::ProtocolError);
+
+    UBLOX_TEST_CHECK(transaction.size() == 0U);
+    UBLOX_TEST_CHECK(transaction.addFrame(&frame[0], frame.size()) == comms::ErrorStatus::Success);
+    UBLOX_TEST_CHECK(transaction.size() == 1U);
+}
+
+void testRetryKeepsPosition()
+{
+    Transaction transaction(2U);
+    transaction.setTimeout(std::chrono::milliseconds(100));
+    add(transaction, ublox::MsgId_CFG_PRT);
+    add(transaction, ublox::MsgId_CFG_MSG);
+    add(transaction, ublox::MsgId_CFG_RATE);
+    add(transaction, ublox::MsgId_CFG_NAV5);
+
+    Recorder recorder;
+    auto now = Transaction::Clock::now();
+    UBLOX_TEST_CHECK(transaction.process(now, recorder) == 2U);
+    UBLOX_TEST_CHECK(transaction.ackReceived(ublox::MsgId_CFG_MSG));
+    UBLOX_TEST_CHECK(transaction.process(now, recorder) == 1U);
+
+    // CFG-PRT and CFG-RATE time out, re-sent before CFG-NAV5
+    now += std::chrono::milliseconds(150);
+    UBLOX_TEST_CHECK(transaction.process(now, recorder) == 2U);
+    UBLOX_TEST_CHECK(transaction.status(3U) == CfgStatus::Queued);
+    UBLOX_TEST_CHECK(transaction.attempts(0U) == 2U);
+    UBLOX_TEST_CHECK(transaction.attempts(2U) == 2U);
+
+    UBLOX_TEST_CHECK(transaction.ackReceived(ublox::MsgId_CFG_PRT));
+    UBLOX_TEST_CHECK(transaction.process(now, recorder) == 1U);
+    UBLOX_TEST_CHECK(transaction.ackReceived(ublox::MsgId_CFG_RATE));
+    UBLOX_TEST_CHECK(transaction.ackReceived(ublox::MsgId_CFG_NAV5));
+    UBLOX_TEST_CHECK(transaction.succeeded());
+
+    std::vector<ublox::MsgId> expected = {
+        ublox::MsgId_CFG_PRT,
+        ublox::MsgId_CFG_MSG,
+        ublox::MsgId_CFG_RATE,
+        ublox::MsgId_CFG_PRT,
+        ublox::MsgId_CFG_RATE,
+        ublox::MsgId_CFG_NAV5
+    };
+    UBLOX_TEST_CHECK(recorder.m_sent == expected);
+}
+
+void testTimeout()
+{
+    Transaction transaction;
+    transaction.setTimeout(std::chrono::milliseconds(100));
+    transaction.setMaxAttempts(2U);
+    add(transaction, ublox::MsgId_CFG_MSG);
+    add(transaction, ublox::MsgId_CFG_MSG);
+
+    Recorder recorder;
+    auto now = Transaction::Clock::now();
+    for (auto idx = 0U; idx < 5U; ++idx) {
+        transaction.process(now, recorder);
+        now += std::chrono::milliseconds(150);
+    }
+
+    UBLOX_TEST_CHECK(transaction.done());
+    UBLOX_TEST_CHECK(transaction.count(CfgStatus::TimedOut) == 2U);
+    UBLOX_TEST_CHECK(transaction.attempts(0U) == 2U);
+    UBLOX_TEST_CHECK(transaction.attempts(1U) == 2U);
+    UBLOX_TEST_CHECK(recorder.m_sent.size() == 4U);
+    UBLOX_TEST_CHECK(transaction.inFlight() == 0U);
+}
+
+} // namespace
+
+int main()
+{
+    testSameIdPipelined();
+    testOldestSentIsAcked();
+    testRetryKeepsPosition();
+    testTimeout();
+    testInvalidFrame();
+    return ublox::test::result();
+}
+
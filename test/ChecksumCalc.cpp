@@ -0,0 +1,175 @@
+//
+// Copyright 2018 (C). Alex Robenko. All rights reserved.
+//
+
+// This file is free software: you can redistribute it and/or modify
+// it under the terms of the GNU General Public License as published by
+// the Free Software Foundation, either version 3 of the License, or
+// (at your option) any later version.
+//
+// This program is distributed in the hope that it will be useful,
+// but WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+// GNU General Public License for more details.
+//
+// You should have received a copy of the GNU General Public License
+// along with this program.  If not, see <http://www.gnu.org/licenses/>.
+
+// Checks that all the checksum calculation paths of
+// ublox::protocol::ChecksumCalc produce byte-exact result of the scalar
+// Fletcher algorithm.
+
+#include <cstdint>
+#include <cstddef>
+#include <iostream>
+#include <vector>
+
+#include "ublox/protocol/ChecksumCalc.h"
+
+#include "TestCommon.h"
+
+namespace
+{
+
+using ublox::protocol::ChecksumCalc;
+namespace details = ublox::protocol::details;
+
+std::uint16_t referenceChecksum(const std::uint8_t* data, std::size_t len, std::uint8_t ckA = 0U, std::uint8_t ckB = 0U)
+{
+    for (std::size_t idx = 0U; idx < len; ++idx) {
+        ckA = static_cast<std::uint8_t>(ckA + data[idx]);
+        ckB = static_cast<std::uint8_t>(ckB + ckA);
+    }
+    return static_cast<std::uint16_t>((static_cast<unsigned>(ckB) << 8) | ckA);
+}
+
+std::uint16_t portableChecksum(const std::uint8_t* data, std::size_t len)
+{
+    details::ChecksumState state;
+    auto consumed = details::checksumUpdateBlocksPortable(state, data, len);
+    details::checksumUpdateScalar(state, data + consumed, len - consumed);
+    return details::checksumValue(state);
+}
+
+std::uint16_t simdChecksum(const std::uint8_t* data, std::size_t len)
+{
+    details::ChecksumState state;
+    auto consumed = details::checksumUpdateBlocksSimd(state, data, len);
+    details::checksumUpdateScalar(state, data + consumed, len - consumed);
+    return details::checksumValue(state);
+}
+
+std::uint16_t pointerChecksum(const std::uint8_t* data, std::size_t len)
+{
+    auto iter = data;
+    auto result = ChecksumCalc()(iter, len);
+    UBLOX_TEST_CHECK(iter == (data + len));
+    return result;
+}
+
+std::uint16_t mutablePointerChecksum(std::uint8_t* data, std::size_t len)
+{
+    auto iter = data;
+    auto result = ChecksumCalc()(iter, len);
+    UBLOX_TEST_CHECK(iter == (data + len));
+    return result;
+}
+
+std::uint16_t iteratorChecksum(const std::vector<std::uint8_t>& data, std::size_t from, std::size_t len)
+{
+    auto iter = data.begin() + static_cast<std::ptrdiff_t>(from);
+    auto result = ChecksumCalc()(iter, len);
+    UBLOX_TEST_CHECK(iter == (data.begin() + static_cast<std::ptrdiff_t>(from + len)));
+    return result;
+}
+
+bool checkRange(std::vector<std::uint8_t>& data, std::size_t from, std::size_t len)
+{
+    auto* ptr = &data[0] + from;
+    auto expected = referenceChecksum(ptr, len);
+    return
+        UBLOX_TEST_CHECK(portableChecksum(ptr, len) == expected) &&
+        UBLOX_TEST_CHECK(simdChecksum(ptr, len) == expected) &&
+        UBLOX_TEST_CHECK(pointerChecksum(ptr, len) == expected) &&
+        UBLOX_TEST_CHECK(mutablePointerChecksum(ptr, len) == expected) &&
+        UBLOX_TEST_CHECK(iteratorChecksum(data, from, len) == expected);
+}
+
+bool simdSupported()
+{
+#if defined(UBLOX_CHECKSUM_AVX2) && (defined(__GNUC__) || defined(__clang__))
+    return __builtin_cpu_supports("avx2") != 0;
+#else
+    return true;
+#endif
+}
+
+void testAllShortLengths(std::vector<std::uint8_t>& data)
+{
+    // All the lengths (including 0) at all the alignments of the 32 byte block
+    for (std::size_t from = 0U; from < 32U; ++from) {
+        for (std::size_t len = 0U; len <= 600U; ++len) {
+            if (!checkRange(data, from, len)) {
+                std::cerr << "    from=" << from << " len=" << len << std::endl;
+                return;
+            }
+        }
+    }
+}
+
+void testRandomLengths(std::vector<std::uint8_t>& data, ublox::test::Random& random)
+{
+    for (auto iter = 0U; iter < 2000U; ++iter) {
+        auto from = random.next() % 64U;
+        auto len = random.next() % (data.size() - from);
+        if (!checkRange(data, from, len)) {
+            std::cerr << "    from=" << from << " len=" << len << std::endl;
+            return;
+        }
+    }
+}
+
+void testSaturatedData(std::vector<std::uint8_t>& data)
+{
+    // All 0xff bytes exercise the maximal values of the block sums
+    std::vector<std::uint8_t> ones(data.size(), 0xff);
+    for (std::size_t len : {0U, 1U, 15U, 16U, 17U, 31U, 32U, 33U, 65535U, 65536U + 7U}) {
+        checkRange(ones, 3U, len);
+    }
+}
+
+void testContinuation(std::vector<std::uint8_t>& data)
+{
+    // The running state must be preserved between the calls
+    auto* ptr = &data[0] + 1U;
+    std::size_t len = 1000U;
+    for (std::size_t split = 0U; split <= len; split += 7U) {
+        details::ChecksumState state;
+        details::checksumUpdate(state, ptr, split);
+        details::checksumUpdate(state, ptr + split, len - split);
+        UBLOX_TEST_CHECK(details::checksumValue(state) == referenceChecksum(ptr, len));
+    }
+}
+
+} // namespace
+
+int main()
+{
+    if (!simdSupported()) {
+        std::cout << "SIMD instruction set is not supported by the CPU, skipping" << std::endl;
+        return 0;
+    }
+
+    ublox::test::Random random;
+    std::vector<std::uint8_t> data(70000U);
+    for (auto& byte : data) {
+        byte = static_cast<std::uint8_t>(random.next());
+    }
+
+    testAllShortLengths(data);
+    testRandomLengths(data, random);
+    testSaturatedData(data);
+    testContinuation(data);
+    return ublox::test::result();
+}
+
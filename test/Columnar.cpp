@@ -0,0 +1,298 @@
+//
+// Copyright 2018 (C). Alex Robenko. All rights reserved.
+//
+
+// This file is free software: you can redistribute it and/or modify
+// it under the terms of the GNU General Public License as published by
+// the Free Software Foundation, either version 3 of the License, or
+// (at your option) any later version.
+//
+// This program is distributed in the hope that it will be useful,
+// but WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+// GNU General Public License for more details.
+//
+// You should have received a copy of the GNU General Public License
+// along with this program.  If not, see <http://www.gnu.org/licenses/>.
+
+// Exports the rows using ublox::columnar::MsgExporter to the binary columnar
+// file and to CSV file, reads both back and compares with the exported
+// values.
+
+#include <cstdint>
+#include <cstddef>
+#include <cstdio>
+#include <cstdlib>
+#include <cstring>
+#include <fstream>
+#include <iterator>
+#include <limits>
+#include <sstream>
+#include <string>
+#include <vector>
+
+#include <unistd.h>
+
+#include "ublox/columnar/ColumnarFileSink.h"
+#include "ublox/columnar/CsvSink.h"
+#include "ublox/columnar/MsgExporter.h"
+
+#include "TestCommon.h"
+
+namespace
+{
+
+using ublox::columnar::ColumnType;
+
+// Stand-in for the decoded message, the columns are computed by the
+// functions, hence any type may be exported
+struct Sample
+{
+    std::int8_t m_i8 = 0;
+    std::uint8_t m_u8 = 0U;
+    std::int16_t m_i16 = 0;
+    std::uint16_t m_u16 = 0U;
+    std::int32_t m_i32 = 0;
+    std::uint32_t m_u32 = 0U;
+    std::int64_t m_i64 = 0;
+    std::uint64_t m_u64 = 0U;
+    float m_float = 0.0f;
+    double m_double = 0.0;
+    bool m_flag = false;
+};
+
+const std::size_t ColumnsCount = 11U;
+const std::size_t RowsCount = 1000U;
+const std::size_t BatchSize = 128U;
+
+std::vector<Sample> makeSamples()
+{
+    ublox::test::Random random;
+    std::vector<Sample> samples(RowsCount);
+    for (std::size_t idx = 0U; idx < samples.size(); ++idx) {
+        auto& sample = samples[idx];
+        auto value = random.next();
+        auto value64 = (static_cast<std::uint64_t>(random.next()) << 32) | random.next();
+        sample.m_i8 = static_cast<std::int8_t>(value);
+        sample.m_u8 = static_cast<std::uint8_t>(value >> 8);
+        sample.m_i16 = static_cast<std::int16_t>(value);
+        sample.m_u16 = static_cast<std::uint16_t>(value >> 16);
+        sample.m_i32 = static_cast<std::int32_t>(value);
+        sample.m_u32 = value;
+        sample.m_i64 = static_cast<std::int64_t>(value64);
+        sample.m_u64 = value64;
+        sample.m_float = static_cast<float>(static_cast<std::int32_t>(value)) / 3.0f;
+        sample.m_double = static_cast<double>(static_cast<std::int64_t>(value64)) * 1e-11 / 7.0;
+        sample.m_flag = (value & 0x1U) != 0U;
+    }
+
+    // Limits
+    samples[0].m_i8 = std::numeric_limits<std::int8_t>::min();
+    samples[0].m_i64 = std::numeric_limits<std::int64_t>::min();
+    samples[0].m_u64 = std::numeric_limits<std::uint64_t>::max();
+    samples[0].m_float = std::numeric_limits<float>::denorm_min();
+    samples[0].m_double = -std::numeric_limits<double>::max();
+    return samples;
+}
+
+template <typename TSink>
+bool exportSamples(TSink& sink, const std::vector<Sample>& samples)
+{
+    ublox::columnar::MsgExporter<Sample, TSink> exporter(sink, BatchSize);
+    exporter.addColumn("i8", [](const Sample& s) { return s.m_i8; });
+    exporter.addColumn("u8", [](const Sample& s) { return s.m_u8; });
+    exporter.addColumn("i16", [](const Sample& s) { return s.m_i16; });
+    exporter.addColumn("u16", [](const Sample& s) { return s.m_u16; });
+    exporter.addColumn("i32", [](const Sample& s) { return s.m_i32; });
+    exporter.addColumn("u32", [](const Sample& s) { return s.m_u32; });
+    exporter.addColumn("i64", [](const Sample& s) { return s.m_i64; });
+    exporter.addColumn("u64", [](const Sample& s) { return s.m_u64; });
+    exporter.addColumn("float", [](const Sample& s) { return s.m_float; });
+    exporter.addColumn("double", [](const Sample& s) { return s.m_double; });
+    exporter.addColumn("flag", [](const Sample& s) { return s.m_flag; });
+
+    for (auto& sample : samples) {
+        UBLOX_TEST_CHECK(exporter.handle(sample));
+        UBLOX_TEST_CHECK(exporter.table().rows() < BatchSize);
+    }
+
+    // Columns can't be added after the export has started
+    UBLOX_TEST_CHECK(!exporter.addColumn("late", [](const Sample& s) { return s.m_u8; }));
+    UBLOX_TEST_CHECK(exporter.flush());
+    UBLOX_TEST_CHECK(exporter.rowsCount() == samples.size());
+    return UBLOX_TEST_CHECK(sink.close());
+}
+
+std::string filePath(const char* ext)
+{
+    return "ublox_test_columnar_" + std::to_string(::getpid()) + ext;
+}
+
+std::vector<std::uint8_t> readFile(const std::string& path)
+{
+    std::ifstream stream(path, std::ios::binary);
+    return std::vector<std::uint8_t>(
+        (std::istreambuf_iterator<char>(stream)), std::istreambuf_iterator<char>());
+}
+
+std::uint64_t readLe(const std::vector<std::uint8_t>& data, std::size_t& pos, std::size_t len)
+{
+    std::uint64_t value = 0U;
+    for (std::size_t idx = 0U; idx < len; ++idx) {
+        value |= static_cast<std::uint64_t>(data[pos + idx]) << (idx * 8U);
+    }
+    pos += len;
+    return value;
+}
+
+template <typename T>
+T fromBits(std::uint64_t bits)
+{
+    T value;
+    std::memcpy(&value, &bits, sizeof(T));
+    return value;
+}
+
+void checkRow(const std::vector<std::uint64_t>& row, const Sample& sample)
+{
+    UBLOX_TEST_CHECK(static_cast<std::int8_t>(row[0]) == sample.m_i8);
+    UBLOX_TEST_CHECK(static_cast<std::uint8_t>(row[1]) == sample.m_u8);
+    UBLOX_TEST_CHECK(static_cast<std::int16_t>(row[2]) == sample.m_i16);
+    UBLOX_TEST_CHECK(static_cast<std::uint16_t>(row[3]) == sample.m_u16);
+    UBLOX_TEST_CHECK(static_cast<std::int32_t>(row[4]) == sample.m_i32);
+    UBLOX_TEST_CHECK(static_cast<std::uint32_t>(row[5]) == sample.m_u32);
+    UBLOX_TEST_CHECK(static_cast<std::int64_t>(row[6]) == sample.m_i64);
+    UBLOX_TEST_CHECK(row[7] == sample.m_u64);
+    UBLOX_TEST_CHECK(fromBits<float>(row[8]) == sample.m_float);
+    UBLOX_TEST_CHECK(fromBits<double>(row[9]) == sample.m_double);
+    UBLOX_TEST_CHECK((row[10] != 0U) == sample.m_flag);
+}
+
+void testColumnarFile()
+{
+    auto samples = makeSamples();
+    auto path = filePath(".ucol");
+    ublox::columnar::ColumnarFileSink sink;
+    if (!UBLOX_TEST_CHECK(sink.open(path.c_str())) ||
+        !exportSamples(sink, samples)) {
+        return;
+    }
+
+    auto data = readFile(path);
+    ::unlink(path.c_str());
+
+    static const ColumnType ExpectedTypes[ColumnsCount] = {
+        ColumnType::Int8, ColumnType::UInt8, ColumnType::Int16, ColumnType::UInt16,
+        ColumnType::Int32, ColumnType::UInt32, ColumnType::Int64, ColumnType::UInt64,
+        ColumnType::Float, ColumnType::Double, ColumnType::UInt8
+    };
+
+    static const char* ExpectedNames[ColumnsCount] = {
+        "i8", "u8", "i16", "u16", "i32", "u32", "i64", "u64", "float", "double", "flag"
+    };
+
+    if (!UBLOX_TEST_CHECK(8U <= data.size()) ||
+        !UBLOX_TEST_CHECK(std::memcmp(&data[0], "UCOL", 4U) == 0)) {
+        return;
+    }
+
+    std::size_t pos = 4U;
+    UBLOX_TEST_CHECK(readLe(data, pos, 2U) == ublox::columnar::ColumnarFileSink::FormatVersion);
+    if (!UBLOX_TEST_CHECK(readLe(data, pos, 2U) == ColumnsCount)) {
+        return;
+    }
+
+    std::vector<std::size_t> sizes;
+    for (std::size_t idx = 0U; idx < ColumnsCount; ++idx) {
+        auto type = static_cast<ColumnType>(readLe(data, pos, 1U));
+        auto nameLen = static_cast<std::size_t>(readLe(data, pos, 1U));
+        UBLOX_TEST_CHECK(type == ExpectedTypes[idx]);
+        UBLOX_TEST_CHECK(std::string(reinterpret_cast<const char*>(&data[pos]), nameLen) == ExpectedNames[idx]);
+        pos += nameLen;
+        sizes.push_back(ublox::columnar::columnTypeSize(type));
+    }
+
+    std::size_t rowsRead = 0U;
+    std::size_t batches = 0U;
+    while (pos < data.size()) {
+        auto rows = static_cast<std::size_t>(readLe(data, pos, 4U));
+        if (rows == 0U) {
+            break;
+        }
+
+        ++batches;
+        std::vector<std::vector<std::uint64_t> > table(rows, std::vector<std::uint64_t>(ColumnsCount));
+        for (std::size_t col = 0U; col < ColumnsCount; ++col) {
+            for (std::size_t row = 0U; row < rows; ++row) {
+                table[row][col] = readLe(data, pos, sizes[col]);
+            }
+        }
+
+        for (std::size_t row = 0U; (row < rows) && ((rowsRead + row) < samples.size()); ++row) {
+            checkRow(table[row], samples[rowsRead + row]);
+        }
+        rowsRead += rows;
+    }
+
+    UBLOX_TEST_CHECK(rowsRead == samples.size());
+    UBLOX_TEST_CHECK(batches == ((samples.size() + BatchSize - 1U) / BatchSize));
+    UBLOX_TEST_CHECK(pos == data.size());
+}
+
+void testCsvFile()
+{
+    auto samples = makeSamples();
+    auto path = filePath(".csv");
+    ublox::columnar::CsvSink sink;
+    if (!UBLOX_TEST_CHECK(sink.open(path.c_str())) ||
+        !exportSamples(sink, samples)) {
+        return;
+    }
+
+    std::ifstream stream(path);
+    std::string line;
+    std::getline(stream, line);
+    UBLOX_TEST_CHECK(line == "i8,u8,i16,u16,i32,u32,i64,u64,float,double,flag");
+
+    std::size_t rowsRead = 0U;
+    while (std::getline(stream, line)) {
+        std::vector<std::string> cells;
+        std::istringstream lineStream(line);
+        std::string cell;
+        while (std::getline(lineStream, cell, ',')) {
+            cells.push_back(cell);
+        }
+
+        if ((!UBLOX_TEST_CHECK(cells.size() == ColumnsCount)) ||
+            (!UBLOX_TEST_CHECK(rowsRead < samples.size()))) {
+            break;
+        }
+
+        auto& sample = samples[rowsRead];
+        UBLOX_TEST_CHECK(std::strtoll(cells[0].c_str(), nullptr, 10) == sample.m_i8);
+        UBLOX_TEST_CHECK(std::strtoull(cells[1].c_str(), nullptr, 10) == sample.m_u8);
+        UBLOX_TEST_CHECK(std::strtoll(cells[2].c_str(), nullptr, 10) == sample.m_i16);
+        UBLOX_TEST_CHECK(std::strtoull(cells[3].c_str(), nullptr, 10) == sample.m_u16);
+        UBLOX_TEST_CHECK(std::strtoll(cells[4].c_str(), nullptr, 10) == sample.m_i32);
+        UBLOX_TEST_CHECK(std::strtoull(cells[5].c_str(), nullptr, 10) == sample.m_u32);
+        UBLOX_TEST_CHECK(std::strtoll(cells[6].c_str(), nullptr, 10) == sample.m_i64);
+        UBLOX_TEST_CHECK(std::strtoull(cells[7].c_str(), nullptr, 10) == sample.m_u64);
+        UBLOX_TEST_CHECK(std::strtof(cells[8].c_str(), nullptr) == sample.m_float);
+        UBLOX_TEST_CHECK(std::strtod(cells[9].c_str(), nullptr) == sample.m_double);
+        UBLOX_TEST_CHECK(cells[10] == (sample.m_flag ? "1" : "0"));
+        ++rowsRead;
+    }
+
+    UBLOX_TEST_CHECK(rowsRead == samples.size());
+    ::unlink(path.c_str());
+}
+
+} // namespace
+
+int main()
+{
+    testColumnarFile();
+    testCsvFile();
+    return ublox::test::result();
+}
+
@@ -0,0 +1,301 @@
+//
+// Copyright 2018 (C). Alex Robenko. All rights reserved.
+//
+
+// This file is free software: you can redistribute it and/or modify
+// it under the terms of the GNU General Public License as published by
+// the Free Software Foundation, either version 3 of the License, or
+// (at your option) any later version.
+//
+// This program is distributed in the hope that it will be useful,
+// but WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+// GNU General Public License for more details.
+//
+// You should have received a copy of the GNU General Public License
+// along with this program.  If not, see <http://www.gnu.org/licenses/>.
+
+// Exports the fields of the real message definitions using the
+// UBLOX_COLUMNAR_* macros: single row per NAV-PVT message and row per
+// list element of NAV-SAT and RXM-RAWX messages.
+
+#include <cstdint>
+#include <cstddef>
+#include <cstdlib>
+#include <cstring>
+#include <fstream>
+#include <iterator>
+#include <string>
+#include <vector>
+
+#include <unistd.h>
+
+#include "ublox/ublox.h"
+#include "ublox/columnar/ColumnarFileSink.h"
+#include "ublox/columnar/CsvSink.h"
+#include "ublox/columnar/MsgExporter.h"
+
+#include "TestCommon.h"
+
+namespace
+{
+
+using InMessage =
+    ublox::MessageT<
+        comms::option::ReadIterator<const std::uint8_t*>
+    >;
+
+using NavPvt = ublox::message::NavPvt<InMessage>;
+using NavSat = ublox::message::NavSat<InMessage>;
+using RxmRawx = ublox::message::RxmRawx<InMessage>;
+using ublox::columnar::ColumnType;
+using ublox::columnar::ColumnTable;
+
+std::string filePath(const char* ext)
+{
+    return "ublox_test_columnar_msg_" + std::to_string(::getpid()) + ext;
+}
+
+std::vector<std::vector<std::string> > readCsv(const std::string& path)
+{
+    std::vector<std::vector<std::string> > result;
+    std::ifstream stream(path);
+    std::string line;
+    while (std::getline(stream, line)) {
+        result.emplace_back();
+        std::string::size_type pos = 0U;
+        while (true) {
+            auto next = line.find(',', pos);
+            result.back().push_back(line.substr(pos, next - pos));
+            if (next == std::string::npos) {
+                break;
+            }
+            pos = next + 1U;
+        }
+    }
+    return result;
+}
+
+std::string cell(const ColumnTable& table, std::size_t col, std::size_t row)
+{
+    char buf[64] = {0};
+    table.column(col).format(row, buf, sizeof(buf));
+    return buf;
+}
+
+NavPvt makeNavPvt(unsigned idx)
+{
+    NavPvt msg;
+    msg.field_iTOW().value() = 1000U * (idx + 1U);
+    msg.field_numSV().value() = static_cast<std::uint8_t>(10U + idx);
+    msg.field_fixType().value() = ublox::field::nav::GpsFix::Fix_3D;
+    msg.field_lat().value() = 471234567 + static_cast<std::int32_t>(idx);
+    msg.field_lon().value() = -87654321;
+    return msg;
+}
+
+NavSat makeNavSat(std::uint32_t iTOW, unsigned count)
+{
+    NavSat msg;
+    msg.field_iTOW().value() = iTOW;
+    auto& list = msg.field_data().value();
+    list.resize(count);
+    for (auto idx = 0U; idx < count; ++idx) {
+        auto& elem = list[idx];
+        elem.field_gnssId().value() = ublox::field::common::GnssId::Galileo;
+        elem.field_svId().value() = static_cast<std::uint8_t>(idx + 1U);
+        elem.field_cno().value() = static_cast<std::uint8_t>(30U + idx);
+        elem.field_elev().value() = static_cast<std::int8_t>(-5 + static_cast<int>(idx) * 10);
+    }
+    return msg;
+}
+
+RxmRawx makeRxmRawx(double rcvTow, unsigned count)
+{
+    RxmRawx msg;
+    msg.field_rcvTow().value() = rcvTow;
+    msg.field_week().value() = 2200U;
+    auto& list = msg.field_data().value();
+    list.resize(count);
+    for (auto idx = 0U; idx < count; ++idx) {
+        auto& elem = list[idx];
+        elem.field_prMes().value() = 20000000.0 + (idx * 1000.25);
+        elem.field_gnssId().value() = ublox::field::common::GnssId::Gps;
+        elem.field_svId().value() = static_cast<std::uint8_t>(idx + 3U);
+        elem.field_locktime().value() = static_cast<std::uint16_t>(500U * idx);
+    }
+    return msg;
+}
+
+void testNavPvtCsv()
+{
+    auto path = filePath(".csv");
+    ublox::columnar::CsvSink sink;
+    if (!UBLOX_TEST_CHECK(sink.open(path.c_str()))) {
+        return;
+    }
+
+    ublox::columnar::MsgExporter<NavPvt, ublox::columnar::CsvSink> exporter(sink, 2U);
+    UBLOX_TEST_CHECK(UBLOX_COLUMNAR_FIELD(exporter, iTOW));
+    UBLOX_TEST_CHECK(UBLOX_COLUMNAR_FIELD(exporter, numSV));
+    UBLOX_TEST_CHECK(UBLOX_COLUMNAR_FIELD(exporter, fixType));
+    UBLOX_TEST_CHECK(UBLOX_COLUMNAR_SCALED_FIELD(exporter, lat));
+    UBLOX_TEST_CHECK(UBLOX_COLUMNAR_SCALED_FIELD(exporter, lon));
+
+    auto& table = exporter.table();
+    UBLOX_TEST_CHECK(table.column(0U).type() == ColumnType::UInt32);
+    UBLOX_TEST_CHECK(table.column(1U).type() == ColumnType::UInt8);
+    UBLOX_TEST_CHECK(table.column(2U).type() == ColumnType::UInt8);
+    UBLOX_TEST_CHECK(table.column(3U).type() == ColumnType::Double);
+
+    static const unsigned MsgCount = 3U;
+    for (auto idx = 0U; idx < MsgCount; ++idx) {
+        UBLOX_TEST_CHECK(exporter.handle(makeNavPvt(idx)));
+    }
+
+    UBLOX_TEST_CHECK(!UBLOX_COLUMNAR_FIELD(exporter, hMSL));
+    UBLOX_TEST_CHECK(exporter.flush());
+    UBLOX_TEST_CHECK(exporter.rowsCount() == MsgCount);
+    UBLOX_TEST_CHECK(sink.close());
+
+    auto rows = readCsv(path);
+    ::unlink(path.c_str());
+    if (!UBLOX_TEST_CHECK(rows.size() == (MsgCount + 1U))) {
+        return;
+    }
+
+    UBLOX_TEST_CHECK(rows[0] == std::vector<std::string>({"iTOW", "numSV", "fixType", "lat", "lon"}));
+    for (auto idx = 0U; idx < MsgCount; ++idx) {
+        auto msg = makeNavPvt(idx);
+        auto& row = rows[idx + 1U];
+        if (!UBLOX_TEST_CHECK(row.size() == 5U)) {
+            continue;
+        }
+
+        UBLOX_TEST_CHECK(row[0] == std::to_string(1000U * (idx + 1U)));
+        UBLOX_TEST_CHECK(row[1] == std::to_string(10U + idx));
+        UBLOX_TEST_CHECK(row[2] == "3");
+        UBLOX_TEST_CHECK(std::strtod(row[3].c_str(), nullptr) == msg.field_lat().getScaled<double>());
+        UBLOX_TEST_CHECK(std::strtod(row[4].c_str(), nullptr) == msg.field_lon().getScaled<double>());
+    }
+}
+
+void testNavSatRows()
+{
+    auto path = filePath(".csv");
+    ublox::columnar::CsvSink sink;
+    if (!UBLOX_TEST_CHECK(sink.open(path.c_str()))) {
+        return;
+    }
+
+    ublox::columnar::MsgExporter<
+        NavSat,
+        ublox::columnar::CsvSink,
+        NavSat::FieldIdx_data
+    > exporter(sink);
+
+    UBLOX_COLUMNAR_FIELD(exporter, iTOW);
+    UBLOX_COLUMNAR_ELEMENT_FIELD(exporter, gnssId);
+    UBLOX_COLUMNAR_ELEMENT_FIELD(exporter, svId);
+    UBLOX_COLUMNAR_ELEMENT_FIELD(exporter, cno);
+    UBLOX_COLUMNAR_ELEMENT_FIELD(exporter, elev);
+    UBLOX_TEST_CHECK(exporter.table().column(4U).type() == ColumnType::Int8);
+
+    // Message without satellites doesn't produce any row
+    UBLOX_TEST_CHECK(exporter.handle(makeNavSat(1000U, 3U)));
+    UBLOX_TEST_CHECK(exporter.handle(makeNavSat(2000U, 0U)));
+    UBLOX_TEST_CHECK(exporter.handle(makeNavSat(3000U, 2U)));
+    UBLOX_TEST_CHECK(exporter.table().rows() == 5U);
+    UBLOX_TEST_CHECK(exporter.flush());
+    UBLOX_TEST_CHECK(sink.close());
+
+    auto rows = readCsv(path);
+    ::unlink(path.c_str());
+
+    std::vector<std::vector<std::string> > expected = {
+        {"iTOW", "gnssId", "svId", "cno", "elev"},
+        {"1000", "2", "1", "30", "-5"},
+        {"1000", "2", "2", "31", "5"},
+        {"1000", "2", "3", "32", "15"},
+        {"3000", "2", "1", "30", "-5"},
+        {"3000", "2", "2", "31", "5"},
+    };
+    UBLOX_TEST_CHECK(rows == expected);
+}
+
+void testRxmRawxColumnar()
+{
+    auto path = filePath(".ucol");
+    ublox::columnar::ColumnarFileSink sink;
+    if (!UBLOX_TEST_CHECK(sink.open(path.c_str()))) {
+        return;
+    }
+
+    ublox::columnar::MsgExporter<
+        RxmRawx,
+        ublox::columnar::ColumnarFileSink,
+        RxmRawx::FieldIdx_data
+    > exporter(sink);
+
+    UBLOX_COLUMNAR_FIELD(exporter, rcvTow);
+    UBLOX_COLUMNAR_FIELD(exporter, week);
+    UBLOX_COLUMNAR_ELEMENT_FIELD(exporter, prMes);
+    UBLOX_COLUMNAR_ELEMENT_FIELD(exporter, gnssId);
+    UBLOX_COLUMNAR_ELEMENT_FIELD(exporter, svId);
+    UBLOX_COLUMNAR_ELEMENT_FIELD(exporter, locktime);
+
+    static const ColumnType ExpectedTypes[] = {
+        ColumnType::Double, ColumnType::UInt16, ColumnType::Double,
+        ColumnType::UInt8, ColumnType::UInt8, ColumnType::UInt16
+    };
+
+    auto& table = exporter.table();
+    if (!UBLOX_TEST_CHECK(table.columnsCount() == (sizeof(ExpectedTypes) / sizeof(ExpectedTypes[0])))) {
+        return;
+    }
+
+    for (std::size_t idx = 0U; idx < table.columnsCount(); ++idx) {
+        UBLOX_TEST_CHECK(table.column(idx).type() == ExpectedTypes[idx]);
+    }
+
+    UBLOX_TEST_CHECK(exporter.handle(makeRxmRawx(100.5, 4U)));
+    UBLOX_TEST_CHECK(exporter.handle(makeRxmRawx(101.5, 1U)));
+    if (!UBLOX_TEST_CHECK(table.rows() == 5U)) {
+        return;
+    }
+
+    UBLOX_TEST_CHECK(cell(table, 0U, 3U) == "100.5");
+    UBLOX_TEST_CHECK(cell(table, 0U, 4U) == "101.5");
+    UBLOX_TEST_CHECK(cell(table, 1U, 4U) == "2200");
+    UBLOX_TEST_CHECK(cell(table, 2U, 2U) == "20002000.5");
+    UBLOX_TEST_CHECK(cell(table, 3U, 1U) == "0");
+    UBLOX_TEST_CHECK(cell(table, 4U, 3U) == "6");
+    UBLOX_TEST_CHECK(cell(table, 5U, 3U) == "1500");
+    UBLOX_TEST_CHECK(cell(table, 5U, 4U) == "0");
+
+    UBLOX_TEST_CHECK(exporter.flush());
+    UBLOX_TEST_CHECK(exporter.rowsCount() == 5U);
+    UBLOX_TEST_CHECK(sink.close());
+
+    std::ifstream stream(path, std::ios::binary);
+    std::vector<std::uint8_t> data(
+        (std::istreambuf_iterator<char>(stream)), std::istreambuf_iterator<char>());
+    ::unlink(path.c_str());
+
+    // Header followed by single batch of 5 rows and terminating empty batch
+    const std::size_t HeaderLen = 8U + (2U * 6U) + std::strlen("rcvTowweekprMesgnssIdsvIdlocktime");
+    const std::size_t RowLen = 8U + 2U + 8U + 1U + 1U + 2U;
+    UBLOX_TEST_CHECK((4U <= data.size()) && (std::memcmp(&data[0], "UCOL", 4U) == 0));
+    UBLOX_TEST_CHECK(data.size() == (HeaderLen + 4U + (5U * RowLen) + 4U));
+}
+
+} // namespace
+
+int main()
+{
+    testNavPvtCsv();
+    testNavSatRows();
+    testRxmRawxColumnar();
+    return ublox::test::result();
+}
+
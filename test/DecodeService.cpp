@@ -0,0 +1,271 @@
+//
+// Copyright 2018 (C). Alex Robenko. All rights reserved.
+//
+
+// This file is free software: you can redistribute it and/or modify
+// it under the terms of the GNU General Public License as published by
+// the Free Software Foundation, either version 3 of the License, or
+// (at your option) any later version.
+//
+// This program is distributed in the hope that it will be useful,
+// but WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+// GNU General Public License for more details.
+//
+// You should have received a copy of the GNU General Public License
+// along with this program.  If not, see <http://www.gnu.org/licenses/>.
+
+// End-to-end check of ublox::io::DecodeService using pseudo-terminals
+// as stand-in devices and simple stand-in protocol stack.
+
+#include <cstdint>
+#include <cstddef>
+#include <chrono>
+#include <memory>
+#include <mutex>
+#include <thread>
+#include <vector>
+
+#include <pthread.h>
+#include <sched.h>
+
+#include "ublox/io/SerialPort.h"
+#include "ublox/io/DecodeService.h"
+
+#include "TestCommon.h"
+#include "TestPty.h"
+
+namespace
+{
+
+using Data = std::vector<std::uint8_t>;
+using ublox::test::Pty;
+using ublox::test::writeAll;
+
+const std::uint8_t BadId = 0xff;
+
+struct TestMessage
+{
+    using ReadIterator = const std::uint8_t*;
+
+    unsigned m_seq = 0U;
+};
+
+// Reports sequence number stored in the first two payload bytes,
+// fails to read the frames with BadId
+struct TestStack
+{
+    using MsgPtr = std::unique_ptr<TestMessage>;
+
+    comms::ErrorStatus read(MsgPtr& msg, TestMessage::ReadIterator& iter, std::size_t len)
+    {
+        if ((len < 10U) || (iter[3] == BadId)) {
+            return comms::ErrorStatus::ProtocolError;
+        }
+
+        msg.reset(new TestMessage);
+        msg->m_seq = static_cast<unsigned>(iter[6]) | (static_cast<unsigned>(iter[7]) << 8);
+        iter += len;
+        return comms::ErrorStatus::Success;
+    }
+};
+
+using Service = ublox::io::DecodeService<TestStack>;
+
+Data makeFrame(std::uint8_t id, unsigned seq)
+{
+    return ublox::test::makeFrame(0x01, id,
+        {static_cast<std::uint8_t>(seq), static_cast<std::uint8_t>(seq >> 8), 0xb5, 0x62, 0x01});
+}
+
+struct Device
+{
+    Pty m_pty;
+    ublox::io::SerialPort m_port;
+    std::vector<unsigned> m_received;
+    std::size_t m_bytes = 0U;
+
+    bool open()
+    {
+        return m_pty.isValid() && m_port.open(m_pty.m_name, 115200U);
+    }
+
+    // Frames with garbage in between
+    bool write(unsigned from, unsigned count, bool withBadFrame = false)
+    {
+        Data stream = {0x00, 0xb5, 0x13};
+        for (auto seq = from; seq < (from + count); ++seq) {
+            auto frame = makeFrame(0x07, seq);
+            if (withBadFrame && (seq == from)) {
+                auto badFrame = makeFrame(BadId, seq);
+                frame.insert(frame.begin(), badFrame.begin(), badFrame.end());
+            }
+            m_bytes += frame.size();
+            stream.insert(stream.end(), frame.begin(), frame.end());
+            stream.push_back(0x55);
+        }
+        return writeAll(m_pty.m_master, stream);
+    }
+};
+
+template <typename TFunc>
+bool waitFor(TFunc&& func)
+{
+    for (auto attempt = 0; attempt < 1000; ++attempt) {
+        if (func()) {
+            return true;
+        }
+        std::this_thread::sleep_for(std::chrono::milliseconds(10));
+    }
+    return false;
+}
+
+std::vector<unsigned> sequence(unsigned from, unsigned count)
+{
+    std::vector<unsigned> result;
+    for (auto seq = from; seq < (from + count); ++seq) {
+        result.push_back(seq);
+    }
+    return result;
+}
+
+void testMultipleWorkers()
+{
+    static const std::size_t DevCount = 3U;
+    static const unsigned FramesPerDev = 30U;
+    Device devices[DevCount];
+    Service service(2U);
+    std::mutex lock;
+    service.subscribe(
+        [&devices, &lock](std::size_t deviceIdx, TestMessage& msg)
+        {
+            std::lock_guard<std::mutex> guard(lock);
+            devices[deviceIdx].m_received.push_back(msg.m_seq);
+        });
+
+    for (std::size_t idx = 0U; idx < DevCount; ++idx) {
+        if (!UBLOX_TEST_CHECK(devices[idx].open())) {
+            return;
+        }
+
+        // First two devices in the first group
+        auto group = idx / 2U;
+        UBLOX_TEST_CHECK(service.addDevice(devices[idx].m_port.fd(), group) == static_cast<int>(idx));
+    }
+    UBLOX_TEST_CHECK(service.addDevice(devices[0].m_port.fd(), 2U) < 0);
+
+    service.setPollTimeout(std::chrono::milliseconds(10));
+    service.start();
+    for (auto& dev : devices) {
+        UBLOX_TEST_CHECK(dev.write(0U, FramesPerDev, true));
+    }
+
+    UBLOX_TEST_CHECK(
+        waitFor(
+            [&service]()
+            {
+                return (DevCount * (FramesPerDev + 1U)) <= service.metrics().m_frames;
+            }));
+
+    auto metrics = service.metrics();
+    UBLOX_TEST_CHECK(metrics.m_messages == (DevCount * FramesPerDev));
+    UBLOX_TEST_CHECK(metrics.m_errors == DevCount);
+    UBLOX_TEST_CHECK(metrics.m_bytes == (devices[0].m_bytes + devices[1].m_bytes + devices[2].m_bytes));
+    UBLOX_TEST_CHECK(metrics.m_dropped == 0U);
+    UBLOX_TEST_CHECK(0U < metrics.m_maxLatencyNs);
+    UBLOX_TEST_CHECK(service.workerMetrics(1U).m_frames == (FramesPerDev + 1U));
+
+    // Hang up of one device doesn't affect the others
+    devices[1].m_pty.close();
+    UBLOX_TEST_CHECK(devices[0].write(FramesPerDev, FramesPerDev));
+    UBLOX_TEST_CHECK(devices[2].write(FramesPerDev, FramesPerDev));
+    UBLOX_TEST_CHECK(
+        waitFor(
+            [&service]()
+            {
+                return ((DevCount + 2U) * FramesPerDev) <= service.metrics().m_messages;
+            }));
+
+    service.stop();
+
+    std::lock_guard<std::mutex> guard(lock);
+    UBLOX_TEST_CHECK(devices[0].m_received == sequence(0U, FramesPerDev * 2U));
+    UBLOX_TEST_CHECK(devices[1].m_received == sequence(0U, FramesPerDev));
+    UBLOX_TEST_CHECK(devices[2].m_received == sequence(0U, FramesPerDev * 2U));
+}
+
+void testDecoupledDispatch(ublox::util::OverflowPolicy policy, unsigned framesCount)
+{
+    Device device;
+    Service service;
+    UBLOX_TEST_CHECK(service.enableDecoupledDispatch(policy));
+
+    auto cores = std::thread::hardware_concurrency();
+    auto subscriberThread = std::this_thread::get_id();
+    bool pinned = true;
+    service.subscribe(
+        [&device, &subscriberThread, &pinned, cores](std::size_t, TestMessage& msg)
+        {
+            // Slow subscriber
+            std::this_thread::sleep_for(std::chrono::milliseconds(1));
+            device.m_received.push_back(msg.m_seq);
+            subscriberThread = std::this_thread::get_id();
+
+            // Dispatch thread of the first worker is pinned to the second core
+            cpu_set_t cpus;
+            CPU_ZERO(&cpus);
+            ::pthread_getaffinity_np(::pthread_self(), sizeof(cpus), &cpus);
+            if ((0U < cores) &&
+                ((CPU_COUNT(&cpus) != 1) || (!CPU_ISSET(static_cast<int>(1U % cores), &cpus)))) {
+                pinned = false;
+            }
+        });
+
+    if (!UBLOX_TEST_CHECK(device.open())) {
+        return;
+    }
+
+    UBLOX_TEST_CHECK(service.addDevice(device.m_port.fd(), 0U) == 0);
+    service.setPollTimeout(std::chrono::milliseconds(10));
+    service.start(true);
+    UBLOX_TEST_CHECK(!service.enableDecoupledDispatch(policy));
+    UBLOX_TEST_CHECK(device.write(0U, framesCount));
+
+    UBLOX_TEST_CHECK(
+        waitFor(
+            [&service, framesCount]()
+            {
+                auto metrics = service.metrics();
+                return framesCount <= (metrics.m_frames + metrics.m_dropped);
+            }));
+    service.stop();
+
+    auto metrics = service.metrics();
+    UBLOX_TEST_CHECK(metrics.m_messages == device.m_received.size());
+    UBLOX_TEST_CHECK((metrics.m_messages + metrics.m_dropped) == framesCount);
+    UBLOX_TEST_CHECK(subscriberThread != std::this_thread::get_id());
+    UBLOX_TEST_CHECK(pinned);
+
+    if (policy == ublox::util::OverflowPolicy::Block) {
+        UBLOX_TEST_CHECK(metrics.m_dropped == 0U);
+        UBLOX_TEST_CHECK(device.m_received == sequence(0U, framesCount));
+        return;
+    }
+
+    // The reader is not stalled, the frames which don't fit are dropped
+    UBLOX_TEST_CHECK(0U < metrics.m_dropped);
+    for (std::size_t idx = 1U; idx < device.m_received.size(); ++idx) {
+        UBLOX_TEST_CHECK(device.m_received[idx - 1U] < device.m_received[idx]);
+    }
+}
+
+} // namespace
+
+int main()
+{
+    testMultipleWorkers();
+    testDecoupledDispatch(ublox::util::OverflowPolicy::Block, 300U);
+    testDecoupledDispatch(ublox::util::OverflowPolicy::DropNewest, 1000U);
+    return ublox::test::result();
+}
+
@@ -0,0 +1,278 @@
+//
+// Copyright 2018 (C). Alex Robenko. All rights reserved.
+//
+
+// This file is free software: you can redistribute it and/or modify
+// it under the terms of the GNU General Public License as published by
+// the Free Software Foundation, either version 3 of the License, or
+// (at your option) any later version.
+//
+// This program is distributed in the hope that it will be useful,
+// but WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+// GNU General Public License for more details.
+//
+// You should have received a copy of the GNU General Public License
+// along with this program.  If not, see <http://www.gnu.org/licenses/>.
+
+// Checks location of the frames by ublox::protocol::FrameScanner, including
+// resynchronisation after the frames with invalid checksum and after false
+// detection of the sync characters.
+
+#include <cstdint>
+#include <cstddef>
+#include <algorithm>
+#include <vector>
+
+#include "ublox/protocol/FrameScanner.h"
+
+#include "TestCommon.h"
+
+namespace
+{
+
+using Data = std::vector<std::uint8_t>;
+using Scanner = ublox::protocol::FrameScanner<1024U>;
+
+Data payload(std::size_t len, std::uint8_t seed)
+{
+    Data result(len);
+    for (std::size_t idx = 0U; idx < len; ++idx) {
+        result[idx] = static_cast<std::uint8_t>(seed + idx);
+    }
+    return result;
+}
+
+void append(Data& data, const Data& other)
+{
+    data.insert(data.end(), other.begin(), other.end());
+}
+
+// False sync followed by class, ID and the length field, no payload
+Data falseSync(std::size_t payloadLen)
+{
+    return Data{
+        0xb5, 0x62, 0x01, 0x07,
+        static_cast<std::uint8_t>(payloadLen),
+        static_cast<std::uint8_t>(payloadLen >> 8)};
+}
+
+// Feeds the data in chunks, removes the discarded bytes and the found frames
+// from the buffer, the same way the reading loop would.
+template <typename TScanner>
+std::vector<Data> scanAll(TScanner& scanner, const Data& input, std::size_t chunkLen)
+{
+    std::vector<Data> frames;
+    Data buf;
+    std::size_t pos = 0U;
+    while (pos < input.size()) {
+        auto count = std::min(chunkLen, input.size() - pos);
+        buf.insert(buf.end(), input.begin() + pos, input.begin() + pos + count);
+        pos += count;
+
+        while (!buf.empty()) {
+            auto result = scanner.scan(&buf[0], buf.size());
+            auto consumed = result.m_discarded;
+            if (result.m_status == comms::ErrorStatus::Success) {
+                UBLOX_TEST_CHECK(result.m_frame == &buf[result.m_discarded]);
+                frames.emplace_back(result.m_frame, result.m_frame + result.m_frameLen);
+                consumed += result.m_frameLen;
+            }
+
+            buf.erase(buf.begin(), buf.begin() + consumed);
+            if (result.m_status != comms::ErrorStatus::Success) {
+                break;
+            }
+        }
+    }
+    return frames;
+}
+
+void testIncompleteFrame()
+{
+    Scanner scanner;
+    auto frame = ublox::test::makeFrame(ublox::MsgId_NAV_POSLLH, payload(28U, 1U));
+    for (std::size_t len = 1U; len < frame.size(); ++len) {
+        auto result = scanner.scan(&frame[0], len);
+        UBLOX_TEST_CHECK(result.m_status == comms::ErrorStatus::NotEnoughData);
+        UBLOX_TEST_CHECK(result.m_discarded == 0U);
+    }
+
+    auto result = scanner.scan(&frame[0], frame.size());
+    UBLOX_TEST_CHECK(result.m_status == comms::ErrorStatus::Success);
+    UBLOX_TEST_CHECK(result.m_frame == &frame[0]);
+    UBLOX_TEST_CHECK(result.m_frameLen == frame.size());
+    UBLOX_TEST_CHECK(result.m_discarded == 0U);
+    UBLOX_TEST_CHECK(scanner.discardedCount() == 0U);
+
+    // Garbage only, the trailing first sync character is kept
+    Data garbage = {0x00, 0x62, 0xb5, 0x00, 0x01, 0xb5};
+    result = scanner.scan(&garbage[0], garbage.size());
+    UBLOX_TEST_CHECK(result.m_status == comms::ErrorStatus::NotEnoughData);
+    UBLOX_TEST_CHECK(result.m_discarded == (garbage.size() - 1U));
+    UBLOX_TEST_CHECK(scanner.discardedCount() == (garbage.size() - 1U));
+
+    scanner.resetDiscardedCount();
+    UBLOX_TEST_CHECK(scanner.discardedCount() == 0U);
+}
+
+void testChecksumResync()
+{
+    auto valid = ublox::test::makeFrame(ublox::MsgId_NAV_PVT, payload(92U, 7U));
+
+    // Corrupted message ID, payload byte and both checksum bytes
+    for (auto corruptIdx : {3U, 20U, 34U, 35U}) {
+        auto corrupted = ublox::test::makeFrame(ublox::MsgId_NAV_POSLLH, payload(28U, 3U));
+        corrupted[corruptIdx] ^= 0x10;
+
+        Data data = corrupted;
+        append(data, valid);
+
+        Scanner scanner;
+        auto result = scanner.scan(&data[0], data.size());
+        UBLOX_TEST_CHECK(result.m_status == comms::ErrorStatus::Success);
+        UBLOX_TEST_CHECK(result.m_frame == &data[corrupted.size()]);
+        UBLOX_TEST_CHECK(result.m_frameLen == valid.size());
+        UBLOX_TEST_CHECK(result.m_discarded == corrupted.size());
+        UBLOX_TEST_CHECK(scanner.discardedCount() == corrupted.size());
+
+        // Valid frame appended after the scan reported missing data
+        Data noisy = corrupted;
+        noisy.push_back(0xb5);
+        result = scanner.scan(&noisy[0], noisy.size());
+        UBLOX_TEST_CHECK(result.m_status == comms::ErrorStatus::NotEnoughData);
+        UBLOX_TEST_CHECK(result.m_discarded == corrupted.size());
+
+        for (auto chunkLen : {1U, 5U, 64U, 1000U}) {
+            Scanner chunkScanner;
+            Data input = corrupted;
+            append(input, valid);
+            append(input, corrupted);
+            append(input, valid);
+            auto frames = scanAll(chunkScanner, input, chunkLen);
+            if (UBLOX_TEST_CHECK(frames.size() == 2U)) {
+                UBLOX_TEST_CHECK(frames[0] == valid);
+                UBLOX_TEST_CHECK(frames[1] == valid);
+            }
+            UBLOX_TEST_CHECK(chunkScanner.discardedCount() == (2U * corrupted.size()));
+        }
+    }
+}
+
+void testFalseSyncLargeLength()
+{
+    static const std::size_t FalseLen = 600U;
+    auto valid = ublox::test::makeFrame(ublox::MsgId_NAV_POSLLH, payload(28U, 9U));
+
+    Data data = falseSync(FalseLen);
+    append(data, valid);
+
+    // The false frame may still be valid until all its bytes are received
+    Scanner scanner;
+    auto result = scanner.scan(&data[0], data.size());
+    UBLOX_TEST_CHECK(result.m_status == comms::ErrorStatus::NotEnoughData);
+    UBLOX_TEST_CHECK(result.m_discarded == 0U);
+
+    // Enough trailing data to cover the false frame
+    auto header = falseSync(FalseLen).size();
+    data.resize(header + FalseLen + Scanner::ChecksumLen, 0U);
+    result = scanner.scan(&data[0], data.size());
+    UBLOX_TEST_CHECK(result.m_status == comms::ErrorStatus::Success);
+    UBLOX_TEST_CHECK(result.m_frame == &data[header]);
+    UBLOX_TEST_CHECK(result.m_frameLen == valid.size());
+    UBLOX_TEST_CHECK(result.m_discarded == header);
+
+    for (auto chunkLen : {1U, 7U, 100U, 2000U}) {
+        Scanner chunkScanner;
+        auto frames = scanAll(chunkScanner, data, chunkLen);
+        if (UBLOX_TEST_CHECK(frames.size() == 1U)) {
+            UBLOX_TEST_CHECK(frames[0] == valid);
+        }
+    }
+}
+
+void testFalseSyncTooLong()
+{
+    auto valid = ublox::test::makeFrame(ublox::MsgId_NAV_POSLLH, payload(28U, 11U));
+
+    // Length above the maximum, skipped without waiting for more data
+    Data data = falseSync(Scanner::MaxFrameLen);
+    append(data, valid);
+
+    Scanner scanner;
+    auto result = scanner.scan(&data[0], data.size());
+    UBLOX_TEST_CHECK(result.m_status == comms::ErrorStatus::Success);
+    UBLOX_TEST_CHECK(result.m_frame == &data[data.size() - valid.size()]);
+    UBLOX_TEST_CHECK(result.m_frameLen == valid.size());
+    UBLOX_TEST_CHECK(result.m_discarded == (data.size() - valid.size()));
+
+    // Maximal allowed length is still waited for
+    data = falseSync(1024U);
+    append(data, valid);
+    result = scanner.scan(&data[0], data.size());
+    UBLOX_TEST_CHECK(result.m_status == comms::ErrorStatus::NotEnoughData);
+    UBLOX_TEST_CHECK(result.m_discarded == 0U);
+
+    // Valid frame of the maximal length
+    auto maxFrame = ublox::test::makeFrame(ublox::MsgId_NAV_POSLLH, payload(1024U, 13U));
+    result = scanner.scan(&maxFrame[0], maxFrame.size());
+    UBLOX_TEST_CHECK(result.m_status == comms::ErrorStatus::Success);
+    UBLOX_TEST_CHECK(result.m_frameLen == Scanner::MaxFrameLen);
+}
+
+void testNoisyStream()
+{
+    ublox::test::Random random;
+    std::vector<Data> expected;
+    Data input;
+    for (auto count = 0U; count < 200U; ++count) {
+        auto len = random.next() % 10U;
+        for (auto idx = 0U; idx < len; ++idx) {
+            auto byte = static_cast<std::uint8_t>(random.next());
+            input.push_back((byte == 0xb5) ? 0x00 : byte);
+        }
+
+        switch (random.next() % 4U) {
+        case 0U:
+            append(input, falseSync(random.next() % 300U));
+            break;
+        case 1U:
+            append(input, falseSync(2000U));
+            break;
+        case 2U: {
+            auto corrupted = ublox::test::makeFrame(ublox::MsgId_RXM_SFRBX, payload(random.next() % 64U, 5U));
+            corrupted.back() ^= 0x01;
+            append(input, corrupted);
+            break;
+        }
+        default:
+            break;
+        }
+
+        auto frame =
+            ublox::test::makeFrame(
+                ublox::MsgId_NAV_SAT,
+                payload(random.next() % 128U, static_cast<std::uint8_t>(count)));
+        expected.push_back(frame);
+        append(input, frame);
+    }
+
+    for (auto chunkLen : {1U, 3U, 17U, 256U, 100000U}) {
+        Scanner scanner;
+        auto frames = scanAll(scanner, input, chunkLen);
+        UBLOX_TEST_CHECK(frames == expected);
+    }
+}
+
+} // namespace
+
+int main()
+{
+    testIncompleteFrame();
+    testChecksumResync();
+    testFalseSyncLargeLength();
+    testFalseSyncTooLong();
+    testNoisyStream();
+    return ublox::test::result();
+}
+
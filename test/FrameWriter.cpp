@@ -0,0 +1,183 @@
+//
+// Copyright 2018 (C). Alex Robenko. All rights reserved.
+//
+
+// This file is free software: you can redistribute it and/or modify
+// it under the terms of the GNU General Public License as published by
+// the Free Software Foundation, either version 3 of the License, or
+// (at your option) any later version.
+//
+// This program is distributed in the hope that it will be useful,
+// but WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+// GNU General Public License for more details.
+//
+// You should have received a copy of the GNU General Public License
+// along with this program.  If not, see <http://www.gnu.org/licenses/>.
+
+// Checks ublox::writeFrame() produces byte exact frames, identical to the
+// ones produced by write() + update() of ublox::Stack.
+
+#include <cstdint>
+#include <cstddef>
+#include <array>
+#include <iterator>
+#include <tuple>
+#include <vector>
+
+#include "ublox/Message.h"
+#include "ublox/Stack.h"
+#include "ublox/FrameWriter.h"
+#include "ublox/message/CfgGnss.h"
+#include "ublox/message/CfgMsgCurrent.h"
+#include "ublox/message/MgaGpsEph.h"
+#include "ublox/message/NavPosllh.h"
+#include "ublox/message/NavPosllhPoll.h"
+
+#include "TestCommon.h"
+
+namespace
+{
+
+using Data = std::vector<std::uint8_t>;
+
+using InMessage =
+    ublox::MessageT<
+        comms::option::ReadIterator<const std::uint8_t*>
+    >;
+
+using ProtStack = ublox::Stack<InMessage, std::tuple<ublox::message::NavPosllh<InMessage> > >;
+
+using OutMessage =
+    ublox::MessageT<
+        comms::option::IdInfoInterface,
+        comms::option::WriteIterator<std::uint8_t*>
+    >;
+
+// Interface used with write() + update() of the protocol stack
+using StackOutMessage =
+    ublox::MessageT<
+        comms::option::IdInfoInterface,
+        comms::option::WriteIterator<std::back_insert_iterator<Data> >,
+        comms::option::LengthInfoInterface
+    >;
+
+template <typename TMsg>
+Data frameOf(const TMsg& msg, std::size_t capacity = 1024U)
+{
+    Data buf(capacity);
+    auto* iter = &buf[0];
+    auto es = ublox::writeFrame(msg, iter, buf.size());
+    UBLOX_TEST_CHECK(es == comms::ErrorStatus::Success);
+    buf.resize(static_cast<std::size_t>(iter - &buf[0]));
+    return buf;
+}
+
+template <typename TMsg>
+Data stackWrite(const TMsg& msg)
+{
+    ProtStack stack;
+    Data buf;
+    auto iter = std::back_inserter(buf);
+    auto es = stack.write(msg, iter, buf.max_size());
+    if (es == comms::ErrorStatus::UpdateRequired) {
+        auto* updateIter = &buf[0];
+        es = stack.update(updateIter, buf.size());
+    }
+    UBLOX_TEST_CHECK(es == comms::ErrorStatus::Success);
+    return buf;
+}
+
+template <typename TMsg>
+void fillMgaGpsEph(TMsg& msg)
+{
+    msg.field_svId().value() = 17;
+    msg.field_fitInterval().value() = 1;
+    msg.field_uraIndex().value() = 2;
+    msg.field_svHealth().value() = 0;
+}
+
+template <typename TMsg>
+void fillCfgGnss(TMsg& msg)
+{
+    static const std::uint8_t BlocksCount = 7U;
+    msg.field_numTrkChHw().value() = 32;
+    msg.field_numTrkChUse().value() = 32;
+    msg.field_numConfigBlocks().value() = BlocksCount;
+    auto& blocks = msg.field_blocksList().value();
+    blocks.resize(BlocksCount);
+    for (std::uint8_t idx = 0U; idx < BlocksCount; ++idx) {
+        blocks[idx].field_resTrkCh().value() = idx;
+        blocks[idx].field_maxTrkCh().value() = static_cast<std::uint8_t>(idx + 8U);
+    }
+}
+
+void testKnownFrames()
+{
+    static const Data PollFrame = {0xb5, 0x62, 0x01, 0x02, 0x00, 0x00, 0x03, 0x0a};
+    ublox::message::NavPosllhPoll<OutMessage> poll;
+    UBLOX_TEST_CHECK(frameOf(poll) == PollFrame);
+
+    // Enable NAV-PVT on the current port
+    static const Data CfgMsgFrame = {0xb5, 0x62, 0x06, 0x01, 0x03, 0x00, 0x01, 0x07, 0x01, 0x13, 0x51};
+    ublox::message::CfgMsgCurrent<OutMessage> cfgMsg;
+    cfgMsg.field_id().value() = ublox::MsgId_NAV_PVT;
+    cfgMsg.field_rate().value() = 1;
+    UBLOX_TEST_CHECK(frameOf(cfgMsg) == CfgMsgFrame);
+
+    // Through the interface class
+    const OutMessage& cfgMsgInterface = cfgMsg;
+    UBLOX_TEST_CHECK(frameOf(cfgMsgInterface) == CfgMsgFrame);
+}
+
+void testSameAsStack()
+{
+    ublox::message::MgaGpsEph<StackOutMessage> stackEph;
+    ublox::message::MgaGpsEph<OutMessage> eph;
+    fillMgaGpsEph(stackEph);
+    fillMgaGpsEph(eph);
+    auto expected = stackWrite(stackEph);
+    UBLOX_TEST_CHECK(expected.size() == (68U + 8U));
+    UBLOX_TEST_CHECK(frameOf(eph) == expected);
+
+    ublox::message::CfgGnss<StackOutMessage> stackGnss;
+    ublox::message::CfgGnss<OutMessage> gnss;
+    fillCfgGnss(stackGnss);
+    fillCfgGnss(gnss);
+    expected = stackWrite(stackGnss);
+    UBLOX_TEST_CHECK(expected.size() == (4U + (7U * 8U) + 8U));
+    UBLOX_TEST_CHECK(frameOf(gnss) == expected);
+    UBLOX_TEST_CHECK(frameOf(static_cast<const OutMessage&>(gnss)) == expected);
+}
+
+void testBufferOverflow()
+{
+    ublox::message::CfgGnss<OutMessage> gnss;
+    fillCfgGnss(gnss);
+    auto frame = frameOf(gnss);
+
+    for (auto size : {std::size_t(0U), std::size_t(7U), frame.size() - 1U}) {
+        Data buf(frame.size(), 0x00);
+        auto* iter = &buf[0];
+        auto es = ublox::writeFrame(gnss, iter, size);
+        UBLOX_TEST_CHECK(es == comms::ErrorStatus::BufferOverflow);
+        UBLOX_TEST_CHECK(iter == &buf[0]);
+    }
+
+    std::array<std::uint8_t, 4U + (7U * 8U) + 8U> exact;
+    auto* iter = &exact[0];
+    UBLOX_TEST_CHECK(ublox::writeFrame(gnss, iter, exact.size()) == comms::ErrorStatus::Success);
+    UBLOX_TEST_CHECK(iter == (&exact[0] + exact.size()));
+    UBLOX_TEST_CHECK(Data(exact.begin(), exact.end()) == frame);
+}
+
+} // namespace
+
+int main()
+{
+    testKnownFrames();
+    testSameAsStack();
+    testBufferOverflow();
+    return ublox::test::result();
+}
+
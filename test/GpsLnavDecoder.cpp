@@ -0,0 +1,343 @@
+//
+// Copyright 2018 (C). Alex Robenko. All rights reserved.
+//
+
+// This file is free software: you can redistribute it and/or modify
+// it under the terms of the GNU General Public License as published by
+// the Free Software Foundation, either version 3 of the License, or
+// (at your option) any later version.
+//
+// This program is distributed in the hope that it will be useful,
+// but WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+// GNU General Public License for more details.
+//
+// You should have received a copy of the GNU General Public License
+// along with this program.  If not, see <http://www.gnu.org/licenses/>.
+
+// Checks decoding of GPS LNAV ephemeris by ublox::rinex::GpsLnavDecoder out
+// of synthetic subframes encoded with IS-GPS-200 parity.
+
+#include <cstdint>
+#include <cstddef>
+#include <cmath>
+#include <array>
+
+#include "ublox/rinex/GpsLnavDecoder.h"
+
+#include "TestCommon.h"
+
+namespace
+{
+
+using Words = std::array<std::uint32_t, 10>;
+using ublox::rinex::GpsLnavDecoder;
+using ublox::rinex::GpsEphemeris;
+
+const double Pi = 3.1415926535898;
+const unsigned Prn = 5U;
+
+// 24 data bits per word, bit 0 is the MSB of the first word
+struct SubframeBits
+{
+    std::array<std::uint32_t, 10> m_data = {{0}};
+
+    SubframeBits(unsigned id, unsigned tow, unsigned tlmMsg = 0U)
+    {
+        set(0U, 8U, 0x8b);
+        set(8U, 14U, tlmMsg);
+        set(24U, 17U, tow);
+        set(43U, 3U, id);
+    }
+
+    void set(unsigned pos, unsigned len, std::int64_t value)
+    {
+        for (unsigned idx = 0U; idx < len; ++idx) {
+            auto bit = pos + idx;
+            auto mask = std::uint32_t(1U) << (23U - (bit % 24U));
+            auto& word = m_data[bit / 24U];
+            word &= ~mask;
+            if (((static_cast<std::uint64_t>(value) >> (len - 1U - idx)) & 0x1) != 0U) {
+                word |= mask;
+            }
+        }
+    }
+};
+
+unsigned parity(std::uint32_t data, unsigned d29, unsigned d30)
+{
+    static const int Bits[6][16] = {
+        {1, 2, 3, 5, 6, 10, 11, 12, 13, 14, 17, 18, 20, 23},
+        {2, 3, 4, 6, 7, 11, 12, 13, 14, 15, 18, 19, 21, 24},
+        {1, 3, 4, 5, 7, 8, 12, 13, 14, 15, 16, 19, 20, 22},
+        {2, 4, 5, 6, 8, 9, 13, 14, 15, 16, 17, 20, 21, 23},
+        {1, 3, 5, 6, 7, 9, 10, 14, 15, 16, 17, 18, 21, 22, 24},
+        {3, 5, 6, 8, 9, 10, 11, 13, 15, 19, 22, 23, 24}
+    };
+    static const bool UsesD29[6] = {true, false, true, false, false, true};
+
+    unsigned result = 0U;
+    for (auto eq = 0U; eq < 6U; ++eq) {
+        unsigned bit = UsesD29[eq] ? d29 : d30;
+        for (auto idx = 0U; (idx < 16U) && (Bits[eq][idx] != 0); ++idx) {
+            bit ^= (data >> (24 - Bits[eq][idx])) & 0x1;
+        }
+        result = (result << 1) | bit;
+    }
+    return result;
+}
+
+// When @b transmitted is true, the data bits are inverted by D30 of
+// the previous word as transmitted by the satellite, otherwise they
+// are reported already de-inverted.
+Words encode(SubframeBits bits, bool transmitted)
+{
+    Words words;
+    unsigned d29 = 0U;
+    unsigned d30 = 0U;
+    for (auto idx = 0U; idx < words.size(); ++idx) {
+        auto data = bits.m_data[idx];
+        auto par = parity(data, d29, d30);
+        if ((idx == 1U) || (idx == 9U)) {
+            // Solve the last two data bits to have D29 = D30 = 0
+            for (std::uint32_t solved = 0U; solved < 4U; ++solved) {
+                auto candidate = (data & ~std::uint32_t(3U)) | solved;
+                if ((parity(candidate, d29, d30) & 0x3) == 0U) {
+                    data = candidate;
+                    par = parity(candidate, d29, d30);
+                    break;
+                }
+            }
+        }
+
+        auto sent = data;
+        if (transmitted && (d30 != 0U)) {
+            sent ^= 0xffffff;
+        }
+
+        words[idx] = (sent << 6) | par | 0x40000000; // Garbage in padding bits
+        d29 = (par >> 1) & 0x1;
+        d30 = par & 0x1;
+    }
+    return words;
+}
+
+struct DataSet
+{
+    unsigned m_iodc = 0x12a;
+    unsigned m_toe = 352800U;
+    std::int32_t m_m0 = -1234567890;
+    std::uint32_t m_sqrtA = 2702000000U;
+    std::int32_t m_omega = -55555555;
+};
+
+SubframeBits subframe1(const DataSet& set, unsigned tow)
+{
+    SubframeBits bits(1U, tow);
+    bits.set(48U, 10U, 1995U % 1024U);
+    bits.set(58U, 2U, 1U);
+    bits.set(60U, 4U, 2U);
+    bits.set(64U, 6U, 0U);
+    bits.set(70U, 2U, set.m_iodc >> 8);
+    bits.set(160U, 8U, -12);
+    bits.set(168U, 8U, set.m_iodc & 0xff);
+    bits.set(176U, 16U, set.m_toe / 16U);
+    bits.set(192U, 8U, 3);
+    bits.set(200U, 16U, -77);
+    bits.set(216U, 22U, -123456);
+    return bits;
+}
+
+SubframeBits subframe2(const DataSet& set, unsigned tow)
+{
+    SubframeBits bits(2U, tow);
+    bits.set(48U, 8U, set.m_iodc & 0xff);
+    bits.set(56U, 16U, -1000);
+    bits.set(72U, 16U, 12345);
+    bits.set(88U, 32U, set.m_m0);
+    bits.set(120U, 16U, -333);
+    bits.set(136U, 32U, 0x01234567);
+    bits.set(168U, 16U, 444);
+    bits.set(184U, 32U, set.m_sqrtA);
+    bits.set(216U, 16U, set.m_toe / 16U);
+    return bits;
+}
+
+SubframeBits subframe3(const DataSet& set, unsigned tow)
+{
+    SubframeBits bits(3U, tow);
+    bits.set(48U, 16U, 55);
+    bits.set(64U, 32U, 987654321);
+    bits.set(96U, 16U, -66);
+    bits.set(112U, 32U, 660000000);
+    bits.set(144U, 16U, 7000);
+    bits.set(160U, 32U, set.m_omega);
+    bits.set(192U, 24U, -20000);
+    bits.set(216U, 8U, set.m_iodc & 0xff);
+    bits.set(224U, 14U, -100);
+    return bits;
+}
+
+const GpsEphemeris* feed(GpsLnavDecoder& decoder, const Words& words)
+{
+    return decoder.handleWords(0U, static_cast<std::uint8_t>(Prn), &words[0], words.size());
+}
+
+void checkEphemeris(const GpsEphemeris& eph, const DataSet& set)
+{
+    UBLOX_TEST_CHECK(eph.m_prn == Prn);
+    UBLOX_TEST_CHECK(eph.m_week == 1995U);
+    UBLOX_TEST_CHECK(eph.m_tocWeek == 1995U);
+    UBLOX_TEST_CHECK(eph.m_iodc == set.m_iodc);
+    UBLOX_TEST_CHECK(eph.m_iode == (set.m_iodc & 0xff));
+    UBLOX_TEST_CHECK(eph.m_ura == 2U);
+    UBLOX_TEST_CHECK(eph.m_codeL2 == 1U);
+    UBLOX_TEST_CHECK(eph.m_toe == set.m_toe);
+    UBLOX_TEST_CHECK(eph.m_toc == set.m_toe);
+    UBLOX_TEST_CHECK(eph.m_tgd == std::ldexp(-12.0, -31));
+    UBLOX_TEST_CHECK(eph.m_af0 == std::ldexp(-123456.0, -31));
+    UBLOX_TEST_CHECK(eph.m_af1 == std::ldexp(-77.0, -43));
+    UBLOX_TEST_CHECK(eph.m_af2 == std::ldexp(3.0, -55));
+    UBLOX_TEST_CHECK(eph.m_crs == std::ldexp(-1000.0, -5));
+    UBLOX_TEST_CHECK(eph.m_deltaN == (std::ldexp(12345.0, -43) * Pi));
+    UBLOX_TEST_CHECK(eph.m_m0 == (std::ldexp(static_cast<double>(set.m_m0), -31) * Pi));
+    UBLOX_TEST_CHECK(eph.m_cuc == std::ldexp(-333.0, -29));
+    UBLOX_TEST_CHECK(eph.m_e == std::ldexp(static_cast<double>(0x01234567), -33));
+    UBLOX_TEST_CHECK(eph.m_cus == std::ldexp(444.0, -29));
+    UBLOX_TEST_CHECK(eph.m_sqrtA == std::ldexp(static_cast<double>(set.m_sqrtA), -19));
+    UBLOX_TEST_CHECK(eph.m_fitInterval == 4.0);
+    UBLOX_TEST_CHECK(eph.m_cic == std::ldexp(55.0, -29));
+    UBLOX_TEST_CHECK(eph.m_omega0 == (std::ldexp(987654321.0, -31) * Pi));
+    UBLOX_TEST_CHECK(eph.m_cis == std::ldexp(-66.0, -29));
+    UBLOX_TEST_CHECK(eph.m_i0 == (std::ldexp(660000000.0, -31) * Pi));
+    UBLOX_TEST_CHECK(eph.m_crc == std::ldexp(7000.0, -5));
+    UBLOX_TEST_CHECK(eph.m_omega == (std::ldexp(static_cast<double>(set.m_omega), -31) * Pi));
+    UBLOX_TEST_CHECK(eph.m_omegaDot == (std::ldexp(-20000.0, -43) * Pi));
+    UBLOX_TEST_CHECK(eph.m_idot == (std::ldexp(-100.0, -43) * Pi));
+}
+
+void testDecode(bool transmitted)
+{
+    GpsLnavDecoder decoder;
+    decoder.setReferenceWeek(1995U);
+    DataSet set;
+    UBLOX_TEST_CHECK(feed(decoder, encode(subframe1(set, 57600U), transmitted)) == nullptr);
+    UBLOX_TEST_CHECK(feed(decoder, encode(subframe2(set, 57601U), transmitted)) == nullptr);
+    auto* eph = feed(decoder, encode(subframe3(set, 57602U), transmitted));
+    if (UBLOX_TEST_CHECK(eph != nullptr)) {
+        checkEphemeris(*eph, set);
+        UBLOX_TEST_CHECK(eph->m_ttr == (57600.0 * 6.0));
+        UBLOX_TEST_CHECK(decoder.ephemeris(Prn) == eph);
+    }
+    UBLOX_TEST_CHECK(decoder.stats().m_parityErrors == 0U);
+}
+
+void testRepeatedSubframesCached()
+{
+    GpsLnavDecoder decoder;
+    decoder.setReferenceWeek(1995U);
+    DataSet set;
+    for (auto id = 1U; id <= 3U; ++id) {
+        auto bits = (id == 1U) ? subframe1(set, 57600U) : (id == 2U) ? subframe2(set, 57600U) : subframe3(set, 57600U);
+        feed(decoder, encode(bits, true));
+    }
+    UBLOX_TEST_CHECK(decoder.stats().m_ephemerides == 1U);
+
+    // Same data retransmitted 30 seconds later, differs in HOW only
+    for (auto frame = 1U; frame <= 4U; ++frame) {
+        auto tow = 57600U + (frame * 5U);
+        UBLOX_TEST_CHECK(feed(decoder, encode(subframe1(set, tow), true)) == nullptr);
+        UBLOX_TEST_CHECK(feed(decoder, encode(subframe2(set, tow + 1U), true)) == nullptr);
+        UBLOX_TEST_CHECK(feed(decoder, encode(subframe3(set, tow + 2U), true)) == nullptr);
+    }
+
+    auto& stats = decoder.stats();
+    UBLOX_TEST_CHECK(stats.m_subframes == 15U);
+    UBLOX_TEST_CHECK(stats.m_cached == 12U);
+    UBLOX_TEST_CHECK(stats.m_duplicates == 0U);
+    UBLOX_TEST_CHECK(stats.m_ephemerides == 1U);
+
+    // New data set is decoded
+    DataSet newSet;
+    newSet.m_iodc = 0x12b;
+    newSet.m_toe = 360000U;
+    newSet.m_m0 = 1234567;
+    UBLOX_TEST_CHECK(feed(decoder, encode(subframe1(newSet, 57700U), true)) == nullptr);
+    UBLOX_TEST_CHECK(feed(decoder, encode(subframe2(newSet, 57701U), true)) == nullptr);
+    auto* eph = feed(decoder, encode(subframe3(newSet, 57702U), true));
+    if (UBLOX_TEST_CHECK(eph != nullptr)) {
+        checkEphemeris(*eph, newSet);
+    }
+}
+
+void testParityError()
+{
+    GpsLnavDecoder decoder;
+    decoder.setReferenceWeek(1995U);
+    DataSet set;
+    auto words = encode(subframe2(set, 57601U), true);
+    words[4] ^= (1U << 12);
+    UBLOX_TEST_CHECK(feed(decoder, words) == nullptr);
+    UBLOX_TEST_CHECK(decoder.stats().m_parityErrors == 1U);
+}
+
+void testInvertedHow()
+{
+    GpsLnavDecoder decoder;
+    decoder.setReferenceWeek(1995U);
+    DataSet set;
+    feed(decoder, encode(subframe1(set, 57600U), true));
+    feed(decoder, encode(subframe2(set, 57601U), true));
+    UBLOX_TEST_CHECK(feed(decoder, encode(subframe3(set, 57602U), true)) != nullptr);
+
+    // Subframe 4 with TLM having D30 = 1, the transmitted HOW is inverted
+    // and its raw subframe ID bits read as 3.
+    DataSet newSet;
+    newSet.m_iodc = 0x12b;
+    SubframeBits page(4U, 57603U);
+    page.set(216U, 8U, newSet.m_iodc & 0xff); // IODE position of subframe 3
+    for (unsigned tlmMsg = 0U; tlmMsg < 0x3fff; ++tlmMsg) {
+        page.set(8U, 14U, tlmMsg);
+        if ((parity(page.m_data[0], 0U, 0U) & 0x1) != 0U) {
+            break;
+        }
+    }
+
+    auto words = encode(page, true);
+    UBLOX_TEST_CHECK(((words[1] >> 8) & 0x7) == 3U);
+    UBLOX_TEST_CHECK(feed(decoder, words) == nullptr);
+    UBLOX_TEST_CHECK(decoder.stats().m_parityErrors == 0U);
+
+    // The page must not be taken as subframe 3 of the new data set
+    UBLOX_TEST_CHECK(feed(decoder, encode(subframe1(newSet, 57610U), true)) == nullptr);
+    UBLOX_TEST_CHECK(feed(decoder, encode(subframe2(newSet, 57611U), true)) == nullptr);
+    auto* eph = feed(decoder, encode(subframe3(newSet, 57612U), true));
+    if (UBLOX_TEST_CHECK(eph != nullptr)) {
+        checkEphemeris(*eph, newSet);
+    }
+}
+
+void testOtherSystemsIgnored()
+{
+    GpsLnavDecoder decoder;
+    DataSet set;
+    auto words = encode(subframe1(set, 57600U), false);
+    UBLOX_TEST_CHECK(decoder.handleWords(2U, 5U, &words[0], words.size()) == nullptr);
+    UBLOX_TEST_CHECK(decoder.handleWords(0U, 33U, &words[0], words.size()) == nullptr);
+    UBLOX_TEST_CHECK(decoder.handleWords(0U, 5U, &words[0], 8U) == nullptr);
+    UBLOX_TEST_CHECK(decoder.stats().m_subframes == 0U);
+}
+
+} // namespace
+
+int main()
+{
+    testDecode(false);
+    testDecode(true);
+    testRepeatedSubframesCached();
+    testParityError();
+    testInvertedHow();
+    testOtherSystemsIgnored();
+    return ublox::test::result();
+}
+
@@ -0,0 +1,224 @@
+//
+// Copyright 2018 (C). Alex Robenko. All rights reserved.
+//
+
+// This file is free software: you can redistribute it and/or modify
+// it under the terms of the GNU General Public License as published by
+// the Free Software Foundation, either version 3 of the License, or
+// (at your option) any later version.
+//
+// This program is distributed in the hope that it will be useful,
+// but WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+// GNU General Public License for more details.
+//
+// You should have received a copy of the GNU General Public License
+// along with this program.  If not, see <http://www.gnu.org/licenses/>.
+
+// Checks dump collection, blob serialisation and validation, and restore
+// of ublox::driver::MgaDbdStore.
+
+#include <cstdint>
+#include <cstddef>
+#include <chrono>
+#include <vector>
+
+#include "ublox/driver/MgaDbdStore.h"
+
+#include "TestCommon.h"
+
+namespace
+{
+
+using Store = ublox::driver::MgaDbdStore;
+using ublox::driver::MgaDbdDumpStatus;
+using Data = std::vector<std::uint8_t>;
+
+Data makeDbd(unsigned idx)
+{
+    Data payload(12U + idx, 0x5a);
+    payload[0] = static_cast<std::uint8_t>(idx);
+    return ublox::test::makeFrame(ublox::MsgId_MGA_DBD, payload);
+}
+
+std::uint32_t readLe32(const std::uint8_t* buf)
+{
+    return
+        static_cast<std::uint32_t>(buf[0]) |
+        (static_cast<std::uint32_t>(buf[1]) << 8) |
+        (static_cast<std::uint32_t>(buf[2]) << 16) |
+        (static_cast<std::uint32_t>(buf[3]) << 24);
+}
+
+void writeLe32(std::uint8_t* buf, std::uint32_t value)
+{
+    for (auto idx = 0U; idx < 4U; ++idx) {
+        buf[idx] = static_cast<std::uint8_t>(value >> (idx * 8U));
+    }
+}
+
+Data makeBlob(unsigned count, Data* frames = nullptr)
+{
+    Store store;
+    auto now = Store::Clock::now();
+    store.startDump(now);
+    for (auto idx = 0U; idx < count; ++idx) {
+        auto frame = makeDbd(idx);
+        UBLOX_TEST_CHECK(store.frameReceived(&frame[0], frame.size(), now));
+        if (frames != nullptr) {
+            frames->insert(frames->end(), frame.begin(), frame.end());
+        }
+    }
+    UBLOX_TEST_CHECK(store.dumpStatus(now + std::chrono::seconds(1)) != MgaDbdDumpStatus::InProgress);
+    return store.serialise();
+}
+
+void testDump()
+{
+    Store store;
+    store.setIdleTimeout(std::chrono::milliseconds(200));
+
+    auto start = Store::Clock::now();
+    auto at =
+        [start](unsigned ms)
+        {
+            return start + std::chrono::milliseconds(ms);
+        };
+
+    auto poll = store.startDump(at(0U));
+    Data expectedPoll = {0xb5, 0x62, 0x13, 0x80, 0x00, 0x00, 0x93, 0xcc};
+    UBLOX_TEST_CHECK(Data(poll.data(), poll.data() + poll.size()) == expectedPoll);
+
+    auto other = ublox::test::makeFrame(ublox::MsgId_NAV_PVT, Data(92U, 0U));
+    UBLOX_TEST_CHECK(!store.frameReceived(&other[0], other.size(), at(5U)));
+
+    for (auto idx = 0U; idx < 5U; ++idx) {
+        auto frame = makeDbd(idx);
+        UBLOX_TEST_CHECK(store.frameReceived(&frame[0], frame.size(), at(10U * (idx + 1U))));
+    }
+
+    // The dump ends only after the idle timeout since the last frame
+    UBLOX_TEST_CHECK(store.dumpStatus(at(249U)) == MgaDbdDumpStatus::InProgress);
+    UBLOX_TEST_CHECK(store.dumpStatus(at(250U)) == MgaDbdDumpStatus::Complete);
+    UBLOX_TEST_CHECK(store.dumpDuration() == std::chrono::milliseconds(50));
+    UBLOX_TEST_CHECK(store.frameCount() == 5U);
+
+    auto late = makeDbd(5U);
+    UBLOX_TEST_CHECK(!store.frameReceived(&late[0], late.size(), at(260U)));
+    UBLOX_TEST_CHECK(store.frameCount() == 5U);
+}
+
+void testEmptyDump()
+{
+    Store store;
+    store.setIdleTimeout(std::chrono::milliseconds(200));
+    auto start = Store::Clock::now();
+    store.startDump(start);
+    UBLOX_TEST_CHECK(store.dumpStatus(start + std::chrono::milliseconds(199)) == MgaDbdDumpStatus::InProgress);
+    UBLOX_TEST_CHECK(store.dumpStatus(start + std::chrono::milliseconds(200)) == MgaDbdDumpStatus::Empty);
+    UBLOX_TEST_CHECK(store.frameCount() == 0U);
+
+    auto blob = store.serialise();
+    UBLOX_TEST_CHECK(blob.size() == Store::HeaderLen);
+
+    Store restored;
+    UBLOX_TEST_CHECK(restored.load(&blob[0], blob.size()) == comms::ErrorStatus::Success);
+    UBLOX_TEST_CHECK(restored.startRestore(start) == 0U);
+}
+
+void testRoundTrip()
+{
+    Data frames;
+    auto blob = makeBlob(6U, &frames);
+    if (!UBLOX_TEST_CHECK(blob.size() == (Store::HeaderLen + frames.size()))) {
+        return;
+    }
+
+    UBLOX_TEST_CHECK(Data(&blob[0], &blob[4]) == Data({'U', 'D', 'B', 'D'}));
+    UBLOX_TEST_CHECK(blob[4] == Store::FormatVersion);
+    UBLOX_TEST_CHECK(readLe32(&blob[8]) == 6U);
+    UBLOX_TEST_CHECK(readLe32(&blob[12]) == frames.size());
+    UBLOX_TEST_CHECK(readLe32(&blob[16]) == ublox::driver::details::mgaDbdCrc32(&frames[0], frames.size()));
+    UBLOX_TEST_CHECK(Data(blob.begin() + Store::HeaderLen, blob.end()) == frames);
+
+    Store store;
+    UBLOX_TEST_CHECK(store.load(&blob[0], blob.size()) == comms::ErrorStatus::Success);
+    UBLOX_TEST_CHECK(store.frameCount() == 6U);
+    UBLOX_TEST_CHECK(store.serialise() == blob);
+
+    // Frames are streamed back as is
+    Data sent;
+    auto now = Store::Clock::now();
+    store.uploader().setAckMode(std::chrono::milliseconds(100));
+    UBLOX_TEST_CHECK(store.startRestore(now) == 6U);
+    UBLOX_TEST_CHECK(!store.restoreComplete());
+    for (auto attempt = 0U; (attempt < 10U) && (!store.restoreComplete()); ++attempt) {
+        std::vector<Data> batch;
+        store.processRestore(
+            now,
+            [&sent, &batch](const std::uint8_t* frame, std::size_t len)
+            {
+                sent.insert(sent.end(), frame, frame + len);
+                batch.emplace_back(frame, frame + len);
+            });
+
+        for (auto& frame : batch) {
+            UBLOX_TEST_CHECK(store.ackReceived(true, frame[3], readLe32(&frame[6])));
+        }
+        now += std::chrono::milliseconds(10);
+    }
+
+    UBLOX_TEST_CHECK(store.restoreComplete());
+    UBLOX_TEST_CHECK(sent == frames);
+}
+
+void testInvalidBlob()
+{
+    auto blob = makeBlob(3U);
+    Store store;
+
+    // Truncated header and frames data
+    UBLOX_TEST_CHECK(store.load(&blob[0], Store::HeaderLen - 1U) == comms::ErrorStatus::NotEnoughData);
+    UBLOX_TEST_CHECK(store.load(&blob[0], blob.size() - 1U) == comms::ErrorStatus::NotEnoughData);
+
+    auto badMagic = blob;
+    badMagic[3] = 'X';
+    UBLOX_TEST_CHECK(store.load(&badMagic[0], badMagic.size()) == comms::ErrorStatus::ProtocolError);
+
+    auto badVersion = blob;
+    badVersion[4] = Store::FormatVersion + 1U;
+    UBLOX_TEST_CHECK(store.load(&badVersion[0], badVersion.size()) == comms::ErrorStatus::ProtocolError);
+
+    // CRC mismatch
+    auto badCrc = blob;
+    badCrc[Store::HeaderLen + 8U] ^= 0x01;
+    UBLOX_TEST_CHECK(store.load(&badCrc[0], badCrc.size()) == comms::ErrorStatus::ProtocolError);
+
+    // Corrupted frame with valid CRC-32 of the data
+    auto badFrame = badCrc;
+    writeLe32(
+        &badFrame[16],
+        ublox::driver::details::mgaDbdCrc32(&badFrame[Store::HeaderLen], badFrame.size() - Store::HeaderLen));
+    UBLOX_TEST_CHECK(store.load(&badFrame[0], badFrame.size()) == comms::ErrorStatus::InvalidMsgData);
+
+    // Frames count mismatch
+    auto badCount = blob;
+    writeLe32(&badCount[8], 4U);
+    UBLOX_TEST_CHECK(store.load(&badCount[0], badCount.size()) == comms::ErrorStatus::InvalidMsgData);
+
+    UBLOX_TEST_CHECK(store.frameCount() == 0U);
+    UBLOX_TEST_CHECK(store.load(&blob[0], blob.size()) == comms::ErrorStatus::Success);
+    UBLOX_TEST_CHECK(store.frameCount() == 3U);
+}
+
+} // namespace
+
+int main()
+{
+    testDump();
+    testEmptyDump();
+    testRoundTrip();
+    testInvalidBlob();
+    return ublox::test::result();
+}
+
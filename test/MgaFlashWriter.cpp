@@ -0,0 +1,136 @@
+//
+// Copyright 2018 (C). Alex Robenko. All rights reserved.
+//
+
+// This file is free software: you can redistribute it and/or modify
+// it under the terms of the GNU General Public License as published by
+// the Free Software Foundation, either version 3 of the License, or
+// (at your option) any later version.
+//
+// This program is distributed in the hope that it will be useful,
+// but WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+// GNU General Public License for more details.
+//
+// You should have received a copy of the GNU General Public License
+// along with this program.  If not, see <http://www.gnu.org/licenses/>.
+
+// Checks chunking, acknowledgement window and retransmission limit of
+// ublox::driver::MgaFlashWriter.
+
+#include <cstdint>
+#include <cstddef>
+#include <chrono>
+#include <vector>
+
+#include "ublox/driver/MgaFlashWriter.h"
+
+#include "TestCommon.h"
+
+namespace
+{
+
+using Writer = ublox::driver::MgaFlashWriter;
+using ublox::driver::MgaFlashState;
+
+struct Recorder
+{
+    void operator()(const std::uint8_t* frame, std::size_t len)
+    {
+        UBLOX_TEST_CHECK(8U < len);
+        UBLOX_TEST_CHECK((frame[0] == 0xb5) && (frame[1] == 0x62));
+        UBLOX_TEST_CHECK((frame[2] == 0x13) && (frame[3] == 0x21));
+        if (frame[6] == 0x02) {
+            ++m_stops;
+            return;
+        }
+
+        m_sequences.push_back(static_cast<unsigned>(frame[8]) | (static_cast<unsigned>(frame[9]) << 8));
+    }
+
+    std::vector<unsigned> m_sequences;
+    unsigned m_stops = 0U;
+};
+
+void testWindow()
+{
+    std::vector<std::uint8_t> data(Writer::MaxChunkSize * 5U + 10U, 0x5a);
+    Writer writer(2U);
+    UBLOX_TEST_CHECK(writer.setData(&data[0], data.size()));
+    UBLOX_TEST_CHECK(writer.chunks() == 6U);
+
+    Recorder recorder;
+    auto now = Writer::Clock::now();
+    UBLOX_TEST_CHECK(writer.process(now, recorder) == 2U);
+    UBLOX_TEST_CHECK(writer.process(now, recorder) == 0U);
+
+    // Acknowledgement of the chunk acknowledges the preceding ones as well
+    UBLOX_TEST_CHECK(writer.ackReceived(Writer::AckType_Ack, 1U, now));
+    UBLOX_TEST_CHECK(!writer.ackReceived(Writer::AckType_Ack, 1U, now));
+    UBLOX_TEST_CHECK(writer.process(now, recorder) == 2U);
+
+    // Retransmission starts from the requested chunk
+    UBLOX_TEST_CHECK(writer.ackReceived(Writer::AckType_NackRetransmit, 3U, now));
+    UBLOX_TEST_CHECK(writer.ackedChunks() == 3U);
+    UBLOX_TEST_CHECK(writer.process(now, recorder) == 2U);
+    for (std::uint16_t seq = 3U; seq < 6U; ++seq) {
+        UBLOX_TEST_CHECK(writer.ackReceived(Writer::AckType_Ack, seq, now));
+        writer.process(now, recorder);
+    }
+
+    UBLOX_TEST_CHECK(writer.state() == MgaFlashState::Done);
+    UBLOX_TEST_CHECK(recorder.m_stops == 1U);
+    UBLOX_TEST_CHECK(writer.stats().m_ackedBytes == data.size());
+    UBLOX_TEST_CHECK(writer.stats().m_retransmitCount == 1U);
+
+    std::vector<unsigned> expected = {0U, 1U, 2U, 3U, 3U, 4U, 5U};
+    UBLOX_TEST_CHECK(recorder.m_sequences == expected);
+}
+
+void testRetransmitLimitPerChunk()
+{
+    std::vector<std::uint8_t> data(Writer::MaxChunkSize * 4U, 0xa5);
+    Writer writer(1U);
+    writer.setTimeout(std::chrono::milliseconds(100));
+    writer.setMaxRetransmits(2U);
+    UBLOX_TEST_CHECK(writer.setData(&data[0], data.size()));
+
+    Recorder recorder;
+    auto now = Writer::Clock::now();
+
+    // Every chunk times out twice, total exceeds the limit, but
+    // per chunk one doesn't
+    for (std::uint16_t seq = 0U; seq < 4U; ++seq) {
+        for (auto attempt = 0U; attempt < 3U; ++attempt) {
+            UBLOX_TEST_CHECK(writer.process(now, recorder) == 1U);
+            now += std::chrono::milliseconds(150);
+        }
+
+        UBLOX_TEST_CHECK(writer.state() == MgaFlashState::Writing);
+        UBLOX_TEST_CHECK(writer.ackReceived(Writer::AckType_Ack, seq, now));
+    }
+
+    UBLOX_TEST_CHECK(writer.process(now, recorder) == 1U);
+    UBLOX_TEST_CHECK(writer.state() == MgaFlashState::Done);
+    UBLOX_TEST_CHECK(writer.stats().m_retransmitCount == 8U);
+
+    // Third retransmission of the same chunk fails the write
+    UBLOX_TEST_CHECK(writer.setData(&data[0], data.size()));
+    for (auto attempt = 0U; attempt < 3U; ++attempt) {
+        UBLOX_TEST_CHECK(writer.process(now, recorder) == 1U);
+        now += std::chrono::milliseconds(150);
+    }
+
+    UBLOX_TEST_CHECK(writer.process(now, recorder) == 0U);
+    UBLOX_TEST_CHECK(writer.state() == MgaFlashState::Failed);
+}
+
+} // namespace
+
+int main()
+{
+    testWindow();
+    testRetransmitLimitPerChunk();
+    return ublox::test::result();
+}
+
@@ -0,0 +1,168 @@
+//
+// Copyright 2018 (C). Alex Robenko. All rights reserved.
+//
+
+// This file is free software: you can redistribute it and/or modify
+// it under the terms of the GNU General Public License as published by
+// the Free Software Foundation, either version 3 of the License, or
+// (at your option) any later version.
+//
+// This program is distributed in the hope that it will be useful,
+// but WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+// GNU General Public License for more details.
+//
+// You should have received a copy of the GNU General Public License
+// along with this program.  If not, see <http://www.gnu.org/licenses/>.
+
+// Checks acknowledged and paced flow control of ublox::driver::MgaUploader.
+
+#include <cstdint>
+#include <cstddef>
+#include <chrono>
+#include <vector>
+
+#include "ublox/driver/MgaUploader.h"
+
+#include "TestCommon.h"
+
+namespace
+{
+
+using Uploader = ublox::driver::MgaUploader;
+
+// MGA-GPS-EPH like frames, first four payload bytes carry the index
+std::vector<std::uint8_t> makeBlob(unsigned count)
+{
+    std::vector<std::uint8_t> blob;
+    for (auto idx = 0U; idx < count; ++idx) {
+        auto frame =
+            ublox::test::makeFrame(
+                0x13, 0x00,
+                {0x01, 0x00, static_cast<std::uint8_t>(idx), 0x00, 0x11, 0x22, 0x33, 0x44});
+        blob.insert(blob.end(), frame.begin(), frame.end());
+
+        // Non MGA data between the frames is ignored
+        blob.push_back('$');
+    }
+    return blob;
+}
+
+std::uint32_t payloadStart(unsigned idx)
+{
+    return 0x01U | (static_cast<std::uint32_t>(idx) << 16);
+}
+
+struct Counter
+{
+    void operator()(const std::uint8_t* frame, std::size_t len)
+    {
+        UBLOX_TEST_CHECK(len == 16U);
+        UBLOX_TEST_CHECK(frame[2] == 0x13);
+        ++m_count;
+    }
+
+    std::size_t m_count = 0U;
+};
+
+void testAckMode()
+{
+    auto blob = makeBlob(6U);
+    Uploader uploader(2U);
+    uploader.setAckMode(std::chrono::milliseconds(100));
+    UBLOX_TEST_CHECK(uploader.setData(&blob[0], blob.size()) == 6U);
+
+    Counter counter;
+    auto now = Uploader::Clock::now();
+    UBLOX_TEST_CHECK(uploader.process(now, counter) == 2U);
+    UBLOX_TEST_CHECK(uploader.process(now, counter) == 0U);
+
+    // Acknowledgement out of order returns the credit
+    UBLOX_TEST_CHECK(uploader.ackReceived(true, 0x00, payloadStart(1U)));
+    UBLOX_TEST_CHECK(!uploader.ackReceived(true, 0x00, payloadStart(1U)));
+    UBLOX_TEST_CHECK(!uploader.ackReceived(true, 0x02, payloadStart(0U)));
+    UBLOX_TEST_CHECK(uploader.process(now, counter) == 1U);
+
+    // Timeout returns the credits as well
+    now += std::chrono::milliseconds(150);
+    UBLOX_TEST_CHECK(uploader.process(now, counter) == 2U);
+    UBLOX_TEST_CHECK(uploader.ackReceived(false, 0x00, payloadStart(3U)));
+    UBLOX_TEST_CHECK(uploader.ackReceived(true, 0x00, payloadStart(4U)));
+    UBLOX_TEST_CHECK(uploader.process(now, counter) == 1U);
+    UBLOX_TEST_CHECK(uploader.ackReceived(true, 0x00, payloadStart(5U)));
+
+    UBLOX_TEST_CHECK(uploader.done());
+    auto& stats = uploader.stats();
+    UBLOX_TEST_CHECK(stats.m_sentCount == 6U);
+    UBLOX_TEST_CHECK(stats.m_acceptedCount == 3U);
+    UBLOX_TEST_CHECK(stats.m_rejectedCount == 1U);
+    UBLOX_TEST_CHECK(stats.m_timedOutCount == 2U);
+    UBLOX_TEST_CHECK(stats.m_unexpectedAckCount == 2U);
+    UBLOX_TEST_CHECK(stats.m_skippedBytes == 6U);
+}
+
+void testPacedMode()
+{
+    auto blob = makeBlob(10U);
+    Uploader uploader;
+    uploader.setPacedMode(std::chrono::milliseconds(10));
+    UBLOX_TEST_CHECK(uploader.setData(&blob[0], blob.size()) == 10U);
+
+    Counter counter;
+    auto start = Uploader::Clock::now();
+    auto at =
+        [start](unsigned ms)
+        {
+            return start + std::chrono::milliseconds(ms);
+        };
+
+    UBLOX_TEST_CHECK(uploader.process(at(0U), counter) == 1U);
+    UBLOX_TEST_CHECK(uploader.process(at(9U), counter) == 0U);
+
+    // Slightly late call doesn't shift the grid
+    UBLOX_TEST_CHECK(uploader.process(at(15U), counter) == 1U);
+    UBLOX_TEST_CHECK(uploader.process(at(20U), counter) == 1U);
+
+    // Call more than one interval late sends single message and restarts the grid
+    UBLOX_TEST_CHECK(uploader.process(at(45U), counter) == 1U);
+    UBLOX_TEST_CHECK(uploader.process(at(50U), counter) == 0U);
+    UBLOX_TEST_CHECK(uploader.process(at(55U), counter) == 1U);
+
+    // Exactly one interval late catches up with the grid
+    UBLOX_TEST_CHECK(uploader.process(at(75U), counter) == 2U);
+
+    // Long stall doesn't cause a burst
+    UBLOX_TEST_CHECK(uploader.process(at(1000U), counter) == 1U);
+    UBLOX_TEST_CHECK(uploader.process(at(1009U), counter) == 0U);
+    UBLOX_TEST_CHECK(uploader.process(at(1010U), counter) == 1U);
+    UBLOX_TEST_CHECK(uploader.process(at(1020U), counter) == 1U);
+    UBLOX_TEST_CHECK(counter.m_count == 10U);
+    UBLOX_TEST_CHECK(uploader.done());
+}
+
+void testFalseSync()
+{
+    auto blob = makeBlob(1U);
+
+    // Sync characters in the garbage with length exceeding the blob
+    std::vector<std::uint8_t> garbage = {0xb5, 0x62, 0x13, 0x00, 0xff, 0x0f};
+    blob.insert(blob.end(), garbage.begin(), garbage.end());
+
+    auto tail = makeBlob(2U);
+    blob.insert(blob.end(), tail.begin(), tail.end());
+
+    Uploader uploader;
+    UBLOX_TEST_CHECK(uploader.setData(&blob[0], blob.size()) == 3U);
+    UBLOX_TEST_CHECK(uploader.stats().m_skippedBytes == (garbage.size() + 3U));
+}
+
+} // namespace
+
+int main()
+{
+    testAckMode();
+    testPacedMode();
+    testFalseSync();
+    return ublox::test::result();
+}
+
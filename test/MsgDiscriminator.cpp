@@ -0,0 +1,224 @@
+//
+// Copyright 2018 (C). Alex Robenko. All rights reserved.
+//
+
+// This file is free software: you can redistribute it and/or modify
+// it under the terms of the GNU General Public License as published by
+// the Free Software Foundation, either version 3 of the License, or
+// (at your option) any later version.
+//
+// This program is distributed in the hope that it will be useful,
+// but WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+// GNU General Public License for more details.
+//
+// You should have received a copy of the GNU General Public License
+// along with this program.  If not, see <http://www.gnu.org/licenses/>.
+
+// Checks selection of the message type by its ID and payload discriminator
+// (see ublox::MsgDiscriminator) in ublox::MsgFactoryTable and
+// ublox::TableStack. Every row of the table lists class / ID pair, the
+// payload, the expected number of candidate types, the expected read
+// status and the expected type of the created message. The IDs unknown
+// to the input messages bundle are covered as well.
+
+#include <cstdint>
+#include <cstddef>
+#include <vector>
+
+#include "ublox/ublox.h"
+#include "ublox/MsgFactoryTable.h"
+#include "ublox/TableStack.h"
+#include "ublox/InputMessages.h"
+
+#include "TestCommon.h"
+
+namespace
+{
+
+using InMessage =
+    ublox::MessageT<
+        comms::option::ReadIterator<const std::uint8_t*>,
+        comms::option::IdInfoInterface
+    >;
+
+using AllInputMessages = ublox::InputMessages<InMessage>;
+using Factory = ublox::MsgFactoryTable<InMessage, AllInputMessages>;
+using InProtStack = ublox::TableStack<InMessage, AllInputMessages>;
+using Payload = std::vector<std::uint8_t>;
+
+using TypeCheckFunc = bool (*)(const InMessage&);
+
+template <typename TMsg>
+bool isType(const InMessage& msg)
+{
+    return dynamic_cast<const TMsg*>(&msg) != nullptr;
+}
+
+Payload payload(std::size_t len, std::size_t pos = 0U, std::uint8_t value = 0U)
+{
+    Payload result(len, 0U);
+    if (pos < len) {
+        result[pos] = value;
+    }
+    return result;
+}
+
+template <typename TMsg>
+Payload payloadOf(std::size_t pos = 0U, std::uint8_t value = 0U)
+{
+    return payload(TMsg::doMinLength(), pos, value);
+}
+
+ublox::MsgId msgId(std::uint8_t cls, std::uint8_t id)
+{
+    return static_cast<ublox::MsgId>((static_cast<unsigned>(cls) << 8U) | id);
+}
+
+using namespace ublox::message;
+
+struct Case
+{
+    ublox::MsgId m_id;
+    Payload m_payload;
+    std::size_t m_count;
+    comms::ErrorStatus m_es;
+    TypeCheckFunc m_isExpected;
+};
+
+const comms::ErrorStatus Success = comms::ErrorStatus::Success;
+const comms::ErrorStatus InvalidMsgId = comms::ErrorStatus::InvalidMsgId;
+const comms::ErrorStatus InvalidMsgData = comms::ErrorStatus::InvalidMsgData;
+
+std::vector<Case> cases()
+{
+    using PrtUart = CfgPrtUart<InMessage>;
+    using PrtUsb = CfgPrtUsb<InMessage>;
+    using PrtSpi = CfgPrtSpi<InMessage>;
+    using PrtDdc = CfgPrtDdc<InMessage>;
+    using Aop = NavAopstatus<InMessage>;
+    using AopU8 = NavAopstatusU8<InMessage>;
+    using RlmShort = RxmRlmShort<InMessage>;
+    using RlmLong = RxmRlmLong<InMessage>;
+    using Msg = CfgMsg<InMessage>;
+    using MsgCurrent = CfgMsgCurrent<InMessage>;
+    using NmeaExt = CfgNmeaExt<InMessage>;
+    using Nmea = CfgNmea<InMessage>;
+    using SosRestored = UpdSosRestored<InMessage>;
+    using SosAck = UpdSosAck<InMessage>;
+    using Findtime = LogFindtime<InMessage>;
+    using Posllh = NavPosllh<InMessage>;
+
+    return std::vector<Case>{
+        // Single type with the ID
+        {ublox::MsgId_NAV_POSLLH, payloadOf<Posllh>(), 1U, Success, &isType<Posllh>},
+        {ublox::MsgId_NAV_POSLLH, payload(Posllh::doMinLength() - 1U), 1U, InvalidMsgData, nullptr},
+        {ublox::MsgId_NAV_POSLLH, payload(Posllh::doMinLength() + 1U), 1U, InvalidMsgData, nullptr},
+
+        // CFG-PRT, port ID in the first byte
+        {ublox::MsgId_CFG_PRT, payloadOf<PrtDdc>(0U, 0U), 4U, Success, &isType<PrtDdc>},
+        {ublox::MsgId_CFG_PRT, payloadOf<PrtUart>(0U, 1U), 4U, Success, &isType<PrtUart>},
+        {ublox::MsgId_CFG_PRT, payloadOf<PrtUart>(0U, 2U), 4U, Success, &isType<PrtUart>},
+        {ublox::MsgId_CFG_PRT, payloadOf<PrtUsb>(0U, 3U), 4U, Success, &isType<PrtUsb>},
+        {ublox::MsgId_CFG_PRT, payloadOf<PrtSpi>(0U, 4U), 4U, Success, &isType<PrtSpi>},
+        {ublox::MsgId_CFG_PRT, payloadOf<PrtSpi>(0U, 5U), 4U, InvalidMsgData, nullptr},
+        {ublox::MsgId_CFG_PRT, payload(PrtUart::doMinLength() - 1U, 0U, 1U), 4U, InvalidMsgData, nullptr},
+
+        // NAV-AOPSTATUS, payload length only
+        {ublox::MsgId_NAV_AOPSTATUS, payloadOf<Aop>(), 2U, Success, &isType<Aop>},
+        {ublox::MsgId_NAV_AOPSTATUS, payloadOf<AopU8>(), 2U, Success, &isType<AopU8>},
+
+        // RXM-RLM, type in the second byte
+        {ublox::MsgId_RXM_RLM, payloadOf<RlmShort>(1U, 1U), 2U, Success, &isType<RlmShort>},
+        {ublox::MsgId_RXM_RLM, payloadOf<RlmLong>(1U, 2U), 2U, Success, &isType<RlmLong>},
+        {ublox::MsgId_RXM_RLM, payloadOf<RlmShort>(1U, 2U), 2U, InvalidMsgData, nullptr},
+        {ublox::MsgId_RXM_RLM, payloadOf<RlmLong>(1U, 1U), 2U, InvalidMsgData, nullptr},
+
+        // CFG-MSG, payload length only
+        {ublox::MsgId_CFG_MSG, payloadOf<Msg>(), 2U, Success, &isType<Msg>},
+        {ublox::MsgId_CFG_MSG, payloadOf<MsgCurrent>(), 2U, Success, &isType<MsgCurrent>},
+
+        // CFG-NMEA, payload length only
+        {ublox::MsgId_CFG_NMEA, payloadOf<NmeaExt>(), 2U, Success, &isType<NmeaExt>},
+        {ublox::MsgId_CFG_NMEA, payloadOf<Nmea>(), 2U, Success, &isType<Nmea>},
+
+        // UPD-SOS, command in the first byte
+        {ublox::MsgId_UPD_SOS, payloadOf<SosRestored>(0U, 3U), 2U, Success, &isType<SosRestored>},
+        {ublox::MsgId_UPD_SOS, payloadOf<SosAck>(0U, 2U), 2U, Success, &isType<SosAck>},
+        {ublox::MsgId_UPD_SOS, payloadOf<SosAck>(0U, 0U), 2U, InvalidMsgData, nullptr},
+
+        // LOG-FINDTIME, type in the second byte, the command isn't an input message
+        {ublox::MsgId_LOG_FINDTIME, payloadOf<Findtime>(1U, 1U), 1U, Success, &isType<Findtime>},
+        {ublox::MsgId_LOG_FINDTIME, payloadOf<Findtime>(1U, 0U), 1U, InvalidMsgData, nullptr},
+
+        // Known IDs without input messages
+        {ublox::MsgId_CFG_RST, payload(4U), 0U, InvalidMsgId, nullptr},
+        {ublox::MsgId_CFG_CFG, payload(12U), 0U, InvalidMsgId, nullptr},
+
+        // Unknown IDs within known and unknown classes
+        {msgId(0x01, 0xfe), payload(4U), 0U, InvalidMsgId, nullptr},
+        {msgId(0x06, 0xff), payload(0U), 0U, InvalidMsgId, nullptr},
+        {msgId(0x7f, 0x01), payload(8U), 0U, InvalidMsgId, nullptr},
+        {msgId(0x00, 0x00), payload(0U), 0U, InvalidMsgId, nullptr},
+        {msgId(0xff, 0xff), payload(2U), 0U, InvalidMsgId, nullptr},
+    };
+}
+
+void testFactory(Factory& factory, const Case& testCase)
+{
+    UBLOX_TEST_CHECK(factory.msgCount(testCase.m_id) == testCase.m_count);
+
+    const std::uint8_t* payloadPtr = testCase.m_payload.empty() ? nullptr : &testCase.m_payload[0];
+    std::size_t matches = 0U;
+    for (auto idx = 0U; idx < testCase.m_count; ++idx) {
+        if (!factory.msgMatches(testCase.m_id, idx, payloadPtr, testCase.m_payload.size())) {
+            continue;
+        }
+
+        ++matches;
+        auto msg = factory.createMsg(testCase.m_id, idx);
+        if (UBLOX_TEST_CHECK(msg) &&
+            UBLOX_TEST_CHECK(testCase.m_isExpected != nullptr)) {
+            UBLOX_TEST_CHECK(testCase.m_isExpected(*msg));
+            UBLOX_TEST_CHECK(msg->getId() == testCase.m_id);
+        }
+    }
+
+    // The discriminators of the types sharing the same ID are exclusive
+    UBLOX_TEST_CHECK(matches == ((testCase.m_es == Success) ? 1U : 0U));
+    UBLOX_TEST_CHECK(!factory.msgMatches(testCase.m_id, static_cast<unsigned>(testCase.m_count), payloadPtr, testCase.m_payload.size()));
+    UBLOX_TEST_CHECK(!factory.createMsg(testCase.m_id, static_cast<unsigned>(testCase.m_count)));
+}
+
+void testStack(InProtStack& protStack, const Case& testCase)
+{
+    auto frame = ublox::test::makeFrame(testCase.m_id, testCase.m_payload);
+    InProtStack::MsgPtr msg;
+    const std::uint8_t* iter = &frame[0];
+    auto es = protStack.read(msg, iter, frame.size());
+    UBLOX_TEST_CHECK(es == testCase.m_es);
+    if (es != Success) {
+        UBLOX_TEST_CHECK(!msg);
+        return;
+    }
+
+    if (UBLOX_TEST_CHECK(msg)) {
+        UBLOX_TEST_CHECK(testCase.m_isExpected(*msg));
+        UBLOX_TEST_CHECK(msg->getId() == testCase.m_id);
+    }
+    UBLOX_TEST_CHECK(iter == (&frame[0] + frame.size()));
+}
+
+} // namespace
+
+int main()
+{
+    Factory factory;
+    InProtStack protStack;
+    for (auto& testCase : cases()) {
+        testFactory(factory, testCase);
+        testStack(protStack, testCase);
+    }
+    return ublox::test::result();
+}
+
@@ -0,0 +1,243 @@
+//
+// Copyright 2018 (C). Alex Robenko. All rights reserved.
+//
+
+// This file is free software: you can redistribute it and/or modify
+// it under the terms of the GNU General Public License as published by
+// the Free Software Foundation, either version 3 of the License, or
+// (at your option) any later version.
+//
+// This program is distributed in the hope that it will be useful,
+// but WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+// GNU General Public License for more details.
+//
+// You should have received a copy of the GNU General Public License
+// along with this program.  If not, see <http://www.gnu.org/licenses/>.
+
+// Checks the lazy views (ublox::view namespace) decode the same values
+// as the message classes: fixed offsets of NAV-PVT fields, presence of
+// its trailing optional group and the fields preceding the variable
+// part of RXM-RAWX.
+
+#include <cstdint>
+#include <cstddef>
+#include <vector>
+
+#include "ublox/Message.h"
+#include "ublox/message/NavPvt.h"
+#include "ublox/message/RxmRawx.h"
+#include "ublox/view/NavPvtView.h"
+#include "ublox/view/RxmRawxView.h"
+
+#include "TestCommon.h"
+
+namespace
+{
+
+using Data = std::vector<std::uint8_t>;
+
+using OutMessage =
+    ublox::MessageT<
+        comms::option::WriteIterator<std::uint8_t*>
+    >;
+
+using NavPvt = ublox::message::NavPvt<OutMessage>;
+using RxmRawx = ublox::message::RxmRawx<OutMessage>;
+using ublox::view::NavPvtView;
+using ublox::view::RxmRawxView;
+
+const std::size_t NavPvtLen = 92U;
+const std::size_t NavPvtShortLen = 84U;
+
+template <typename TMsg>
+Data writePayload(const TMsg& msg)
+{
+    Data payload(msg.doLength());
+    std::uint8_t* iter = &payload[0];
+    UBLOX_TEST_CHECK(msg.write(iter, payload.size()) == comms::ErrorStatus::Success);
+    return payload;
+}
+
+std::uint32_t readU4(const Data& payload, std::size_t offset)
+{
+    return
+        static_cast<std::uint32_t>(payload[offset]) |
+        (static_cast<std::uint32_t>(payload[offset + 1]) << 8) |
+        (static_cast<std::uint32_t>(payload[offset + 2]) << 16) |
+        (static_cast<std::uint32_t>(payload[offset + 3]) << 24);
+}
+
+NavPvt makeNavPvt(bool withHeadVeh)
+{
+    NavPvt msg;
+    msg.field_iTOW().value() = 0x01020304;
+    msg.field_year().value() = 2018;
+    msg.field_month().value() = 7;
+    msg.field_sec().value() = 59;
+    msg.field_nano().value() = -12345;
+    msg.field_numSV().value() = 11;
+    msg.field_lon().value() = 0x1a2b3c4d;
+    msg.field_lat().value() = -0x0a0b0c0d;
+    msg.field_hMSL().value() = 123456;
+    msg.field_gSpeed().value() = 789;
+    msg.field_pDOP().value() = 0x4321;
+    if (withHeadVeh) {
+        msg.field_headVeh().setExists();
+        msg.field_magDec().setExists();
+        msg.field_magAcc().setExists();
+        msg.field_headVeh().field().value() = 0x05060708;
+        msg.field_magDec().field().value() = -321;
+        msg.field_magAcc().field().value() = 456;
+    }
+    return msg;
+}
+
+void testNavPvtOffsets()
+{
+    auto msg = makeNavPvt(false);
+    auto payload = writePayload(msg);
+    UBLOX_TEST_CHECK(payload.size() == NavPvtShortLen);
+
+    // Offsets defined by the protocol specification
+    UBLOX_TEST_CHECK(readU4(payload, 0U) == 0x01020304U);
+    UBLOX_TEST_CHECK(readU4(payload, 24U) == 0x1a2b3c4dU);
+    UBLOX_TEST_CHECK(readU4(payload, 28U) == static_cast<std::uint32_t>(-0x0a0b0c0d));
+    UBLOX_TEST_CHECK(payload[23] == 11U);
+
+    NavPvtView view(&payload[0], payload.size());
+    NavPvtView::FieldType<NavPvtView::FieldIdx_iTOW> iTOW;
+    UBLOX_TEST_CHECK(view.field_iTOW(iTOW) == comms::ErrorStatus::Success);
+    UBLOX_TEST_CHECK(iTOW.value() == msg.field_iTOW().value());
+
+    NavPvtView::FieldType<NavPvtView::FieldIdx_year> year;
+    UBLOX_TEST_CHECK(view.field_year(year) == comms::ErrorStatus::Success);
+    UBLOX_TEST_CHECK(year.value() == 2018U);
+
+    NavPvtView::FieldType<NavPvtView::FieldIdx_sec> sec;
+    UBLOX_TEST_CHECK(view.field_sec(sec) == comms::ErrorStatus::Success);
+    UBLOX_TEST_CHECK(sec.value() == 59U);
+
+    NavPvtView::FieldType<NavPvtView::FieldIdx_nano> nano;
+    UBLOX_TEST_CHECK(view.field_nano(nano) == comms::ErrorStatus::Success);
+    UBLOX_TEST_CHECK(nano.value() == -12345);
+
+    NavPvtView::FieldType<NavPvtView::FieldIdx_numSV> numSV;
+    UBLOX_TEST_CHECK(view.field_numSV(numSV) == comms::ErrorStatus::Success);
+    UBLOX_TEST_CHECK(numSV.value() == 11U);
+
+    NavPvtView::FieldType<NavPvtView::FieldIdx_lon> lon;
+    UBLOX_TEST_CHECK(view.field_lon(lon) == comms::ErrorStatus::Success);
+    UBLOX_TEST_CHECK(lon.value() == msg.field_lon().value());
+
+    NavPvtView::FieldType<NavPvtView::FieldIdx_lat> lat;
+    UBLOX_TEST_CHECK(view.field_lat(lat) == comms::ErrorStatus::Success);
+    UBLOX_TEST_CHECK(lat.value() == msg.field_lat().value());
+
+    NavPvtView::FieldType<NavPvtView::FieldIdx_hMSL> hMSL;
+    UBLOX_TEST_CHECK(view.field_hMSL(hMSL) == comms::ErrorStatus::Success);
+    UBLOX_TEST_CHECK(hMSL.value() == 123456);
+
+    NavPvtView::FieldType<NavPvtView::FieldIdx_gSpeed> gSpeed;
+    UBLOX_TEST_CHECK(view.field_gSpeed(gSpeed) == comms::ErrorStatus::Success);
+    UBLOX_TEST_CHECK(gSpeed.value() == 789);
+
+    NavPvtView::FieldType<NavPvtView::FieldIdx_pDOP> pDOP;
+    UBLOX_TEST_CHECK(view.field_pDOP(pDOP) == comms::ErrorStatus::Success);
+    UBLOX_TEST_CHECK(pDOP.value() == 0x4321U);
+
+    // Payload too short to contain the field
+    NavPvtView shortView(&payload[0], 27U);
+    UBLOX_TEST_CHECK(shortView.field_lon(lon) == comms::ErrorStatus::Success);
+    UBLOX_TEST_CHECK(shortView.field_lat(lat) == comms::ErrorStatus::NotEnoughData);
+    UBLOX_TEST_CHECK(shortView.hasField<NavPvtView::FieldIdx_lon>());
+    UBLOX_TEST_CHECK(!shortView.hasField<NavPvtView::FieldIdx_lat>());
+
+    NavPvtView emptyView;
+    UBLOX_TEST_CHECK(emptyView.empty());
+    UBLOX_TEST_CHECK(emptyView.field_iTOW(iTOW) == comms::ErrorStatus::NotEnoughData);
+}
+
+void testNavPvtTrailingOptional()
+{
+    auto msg = makeNavPvt(true);
+    auto payload = writePayload(msg);
+    UBLOX_TEST_CHECK(payload.size() == NavPvtLen);
+    UBLOX_TEST_CHECK(readU4(payload, 84U) == 0x05060708U);
+
+    NavPvtView::FieldType<NavPvtView::FieldIdx_headVeh> headVeh;
+    NavPvtView::FieldType<NavPvtView::FieldIdx_magDec> magDec;
+    NavPvtView::FieldType<NavPvtView::FieldIdx_magAcc> magAcc;
+
+    // With the group
+    NavPvtView view(&payload[0], payload.size());
+    UBLOX_TEST_CHECK(view.field_headVeh(headVeh) == comms::ErrorStatus::Success);
+    UBLOX_TEST_CHECK(headVeh.getMode() == comms::field::OptionalMode::Exists);
+    UBLOX_TEST_CHECK(headVeh.field().value() == 0x05060708);
+    UBLOX_TEST_CHECK(view.field_magDec(magDec) == comms::ErrorStatus::Success);
+    UBLOX_TEST_CHECK(magDec.getMode() == comms::field::OptionalMode::Exists);
+    UBLOX_TEST_CHECK(magDec.field().value() == -321);
+    UBLOX_TEST_CHECK(view.field_magAcc(magAcc) == comms::ErrorStatus::Success);
+    UBLOX_TEST_CHECK(magAcc.getMode() == comms::field::OptionalMode::Exists);
+    UBLOX_TEST_CHECK(magAcc.field().value() == 456U);
+
+    // Without the group, preceding fields are still accessible
+    NavPvtView shortView(&payload[0], NavPvtShortLen);
+    UBLOX_TEST_CHECK(shortView.field_headVeh(headVeh) == comms::ErrorStatus::Success);
+    UBLOX_TEST_CHECK(headVeh.getMode() == comms::field::OptionalMode::Missing);
+    UBLOX_TEST_CHECK(shortView.field_magAcc(magAcc) == comms::ErrorStatus::Success);
+    UBLOX_TEST_CHECK(magAcc.getMode() == comms::field::OptionalMode::Missing);
+
+    NavPvtView::FieldType<NavPvtView::FieldIdx_pDOP> pDOP;
+    UBLOX_TEST_CHECK(shortView.field_pDOP(pDOP) == comms::ErrorStatus::Success);
+    UBLOX_TEST_CHECK(pDOP.value() == 0x4321U);
+
+    // Partial group is reported as missing
+    NavPvtView partialView(&payload[0], NavPvtShortLen + 4U);
+    UBLOX_TEST_CHECK(partialView.field_headVeh(headVeh) == comms::ErrorStatus::Success);
+    UBLOX_TEST_CHECK(headVeh.getMode() == comms::field::OptionalMode::Missing);
+
+    // Fields preceding the group are missing as well
+    NavPvtView truncatedView(&payload[0], 40U);
+    UBLOX_TEST_CHECK(truncatedView.field_headVeh(headVeh) == comms::ErrorStatus::NotEnoughData);
+}
+
+void testRxmRawxHeader()
+{
+    RxmRawx msg;
+    msg.field_rcvTow().value() = 123456.5;
+    msg.field_week().value() = 2000;
+    msg.field_leapS().value() = 18;
+    msg.field_version().value() = 1;
+    msg.field_data().value().resize(2U);
+    msg.field_numMeas().value() = 2U;
+    auto payload = writePayload(msg);
+
+    RxmRawxView view(&payload[0], payload.size());
+    RxmRawxView::FieldType<RxmRawxView::FieldIdx_rcvTow> rcvTow;
+    UBLOX_TEST_CHECK(view.field_rcvTow(rcvTow) == comms::ErrorStatus::Success);
+    UBLOX_TEST_CHECK(rcvTow.value() == 123456.5);
+
+    RxmRawxView::FieldType<RxmRawxView::FieldIdx_week> week;
+    UBLOX_TEST_CHECK(view.field_week(week) == comms::ErrorStatus::Success);
+    UBLOX_TEST_CHECK(week.value() == 2000U);
+
+    RxmRawxView::FieldType<RxmRawxView::FieldIdx_numMeas> numMeas;
+    UBLOX_TEST_CHECK(view.field_numMeas(numMeas) == comms::ErrorStatus::Success);
+    UBLOX_TEST_CHECK(numMeas.value() == 2U);
+
+    RxmRawxView::FieldType<RxmRawxView::FieldIdx_version> version;
+    UBLOX_TEST_CHECK(view.field_version(version) == comms::ErrorStatus::Success);
+    UBLOX_TEST_CHECK(version.value() == 1U);
+}
+
+} // namespace
+
+int main()
+{
+    testNavPvtOffsets();
+    testNavPvtTrailingOptional();
+    testRxmRawxHeader();
+    return ublox::test::result();
+}
+
@@ -0,0 +1,139 @@
+//
+// Copyright 2018 (C). Alex Robenko. All rights reserved.
+//
+
+// This file is free software: you can redistribute it and/or modify
+// it under the terms of the GNU General Public License as published by
+// the Free Software Foundation, either version 3 of the License, or
+// (at your option) any later version.
+//
+// This program is distributed in the hope that it will be useful,
+// but WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+// GNU General Public License for more details.
+//
+// You should have received a copy of the GNU General Public License
+// along with this program.  If not, see <http://www.gnu.org/licenses/>.
+
+// Checks that the snapshots retrieved from ublox::util::NavSnapshotStore
+// by several reader threads are always consistent while the dispatching
+// thread keeps updating the store with NAV-PVT messages.
+
+#include <cstdint>
+#include <cstddef>
+#include <cmath>
+#include <atomic>
+#include <thread>
+#include <vector>
+
+#include "ublox/Message.h"
+#include "ublox/message/NavPvt.h"
+#include "ublox/util/NavSnapshot.h"
+
+#include "TestCommon.h"
+
+namespace
+{
+
+using InMessage =
+    ublox::MessageT<
+        comms::option::ReadIterator<const std::uint8_t*>
+    >;
+
+using NavPvt = ublox::message::NavPvt<InMessage>;
+using ublox::util::NavSnapshot;
+
+// Every reported value is derived from the same counter (time of week)
+void fillNavPvt(NavPvt& msg, std::uint32_t counter)
+{
+    msg.field_iTOW().value() = counter;
+    msg.field_lat().value() = static_cast<std::int32_t>(counter);
+    msg.field_lon().value() = -static_cast<std::int32_t>(counter);
+    msg.field_height().value() = static_cast<std::int32_t>(counter);
+    msg.field_hMSL().value() = static_cast<std::int32_t>(counter) * 2;
+    msg.field_numSV().value() = static_cast<std::uint8_t>(counter);
+    msg.field_flags().field_flagsLow().setBitValue_gnssFixOK((counter % 2U) == 0U);
+}
+
+bool isConsistent(const NavSnapshot& snapshot)
+{
+    auto counter = static_cast<double>(snapshot.m_iTOW);
+    bool positionValid = (snapshot.m_valid & NavSnapshot::ValidBit_position) != 0U;
+    return
+        (std::round(snapshot.m_lat * 1e7) == counter) &&
+        (std::round(snapshot.m_lon * 1e7) == -counter) &&
+        (std::round(snapshot.m_height * 1e3) == counter) &&
+        (std::round(snapshot.m_hMSL * 1e3) == (counter * 2)) &&
+        (snapshot.m_numSV == static_cast<std::uint8_t>(snapshot.m_iTOW)) &&
+        (positionValid == ((snapshot.m_iTOW % 2U) == 0U));
+}
+
+void testContention()
+{
+    static const std::uint32_t UpdatesCount = 100000U;
+    static const std::size_t ReadersCount = 3U;
+
+    ublox::util::NavSnapshotStore store;
+    NavPvt msg;
+    fillNavPvt(msg, 0U);
+    store.handle(msg);
+
+    std::atomic<bool> done(false);
+    std::atomic<std::size_t> inconsistent(0U);
+    std::atomic<std::size_t> backwards(0U);
+
+    std::vector<std::thread> readers;
+    for (std::size_t readerIdx = 0U; readerIdx < ReadersCount; ++readerIdx) {
+        readers.emplace_back(
+            [&]()
+            {
+                std::uint32_t lastITOW = 0U;
+                std::size_t lastVersion = 0U;
+                while (!done.load()) {
+                    auto version = store.version();
+                    auto snapshot = store.snapshot();
+                    if (!isConsistent(snapshot)) {
+                        ++inconsistent;
+                    }
+
+                    if ((snapshot.m_iTOW < lastITOW) || (version < lastVersion)) {
+                        ++backwards;
+                    }
+                    lastITOW = snapshot.m_iTOW;
+                    lastVersion = version;
+
+                    NavSnapshot tried;
+                    if (store.trySnapshot(tried) && (!isConsistent(tried))) {
+                        ++inconsistent;
+                    }
+                }
+            });
+    }
+
+    for (std::uint32_t counter = 1U; counter <= UpdatesCount; ++counter) {
+        fillNavPvt(msg, counter);
+        store.handle(msg);
+    }
+
+    done = true;
+    for (auto& reader : readers) {
+        reader.join();
+    }
+
+    UBLOX_TEST_CHECK(inconsistent.load() == 0U);
+    UBLOX_TEST_CHECK(backwards.load() == 0U);
+    UBLOX_TEST_CHECK(store.version() == (UpdatesCount + 1U));
+
+    auto last = store.snapshot();
+    UBLOX_TEST_CHECK(last.m_iTOW == UpdatesCount);
+    UBLOX_TEST_CHECK(isConsistent(last));
+}
+
+} // namespace
+
+int main()
+{
+    testContention();
+    return ublox::test::result();
+}
+
@@ -0,0 +1,196 @@
+//
+// Copyright 2018 (C). Alex Robenko. All rights reserved.
+//
+
+// This file is free software: you can redistribute it and/or modify
+// it under the terms of the GNU General Public License as published by
+// the Free Software Foundation, either version 3 of the License, or
+// (at your option) any later version.
+//
+// This program is distributed in the hope that it will be useful,
+// but WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+// GNU General Public License for more details.
+//
+// You should have received a copy of the GNU General Public License
+// along with this program.  If not, see <http://www.gnu.org/licenses/>.
+
+// Checks ublox::io::ParallelDecoder produces the same output regardless
+// of the number of chunks, using simple stand-in protocol stack.
+
+#include <algorithm>
+#include <cstdint>
+#include <cstddef>
+#include <memory>
+#include <vector>
+
+#include "ublox/io/ParallelDecoder.h"
+
+#include "TestCommon.h"
+
+namespace
+{
+
+using Data = std::vector<std::uint8_t>;
+using Seqs = std::vector<unsigned>;
+
+const std::size_t MaxPayloadLen = 256U;
+const unsigned EmbeddedSeq = 0x8000;
+
+struct TestMessage
+{
+    using ReadIterator = const std::uint8_t*;
+
+    unsigned m_seq = 0U;
+};
+
+// Reports sequence number stored in the first two payload bytes
+struct TestStack
+{
+    using MsgPtr = std::unique_ptr<TestMessage>;
+
+    comms::ErrorStatus read(MsgPtr& msg, TestMessage::ReadIterator& iter, std::size_t len)
+    {
+        if (len < 10U) {
+            return comms::ErrorStatus::ProtocolError;
+        }
+
+        msg.reset(new TestMessage);
+        msg->m_seq = static_cast<unsigned>(iter[6]) | (static_cast<unsigned>(iter[7]) << 8);
+        iter += len;
+        return comms::ErrorStatus::Success;
+    }
+};
+
+using Decoder = ublox::io::ParallelDecoder<TestStack, MaxPayloadLen>;
+
+Data makeFrame(unsigned seq, Data payload)
+{
+    payload[0] = static_cast<std::uint8_t>(seq);
+    payload[1] = static_cast<std::uint8_t>(seq >> 8);
+    return ublox::test::makeFrame(0x02, 0x15, payload);
+}
+
+void append(Data& data, const Data& frame)
+{
+    data.insert(data.end(), frame.begin(), frame.end());
+}
+
+struct Capture
+{
+    Data m_data;
+    Seqs m_seqs;
+    std::size_t m_bigFramePos = 0U;
+    std::size_t m_bigFrameLen = 0U;
+};
+
+// Frames of random length with occasional garbage in between. The frame
+// at BigFramePos carries two consecutive valid frames in its payload,
+// so the first chunk boundary is placed on the embedded frame
+Capture makeCapture()
+{
+    static const std::size_t BigFramePos = 200U;
+    static const std::size_t EmbeddedOffset = 100U;
+    ublox::test::Random random;
+    Capture capture;
+    auto& data = capture.m_data;
+    data.resize(BigFramePos, 0x00);
+
+    Data payload(200U, 0x55);
+    auto embedded1 = makeFrame(EmbeddedSeq, Data(4U, 0x00));
+    auto embedded2 = makeFrame(EmbeddedSeq + 1U, Data(6U, 0x00));
+    std::copy(embedded1.begin(), embedded1.end(), payload.begin() + EmbeddedOffset);
+    std::copy(embedded2.begin(), embedded2.end(), payload.begin() + EmbeddedOffset + embedded1.size());
+
+    unsigned seq = 0U;
+    auto bigFrame = makeFrame(seq, payload);
+    capture.m_bigFramePos = data.size();
+    capture.m_bigFrameLen = bigFrame.size();
+    append(data, bigFrame);
+    capture.m_seqs.push_back(seq);
+    ++seq;
+
+    while (data.size() < (32U * 1024U)) {
+        if ((random.next() % 4U) == 0U) {
+            auto garbage = random.next() % 8U;
+            for (auto idx = 0U; idx < garbage; ++idx) {
+                data.push_back(static_cast<std::uint8_t>(random.next()));
+            }
+
+            // False sync
+            data.push_back(0xb5);
+            data.push_back(0x62);
+        }
+
+        Data framePayload(2U + (random.next() % (MaxPayloadLen - 2U)));
+        for (auto& byte : framePayload) {
+            byte = static_cast<std::uint8_t>(random.next());
+        }
+
+        append(data, makeFrame(seq, framePayload));
+        capture.m_seqs.push_back(seq);
+        ++seq;
+    }
+    return capture;
+}
+
+Seqs decode(Decoder& decoder, const Data& data)
+{
+    return decoder.decode<unsigned>(
+        &data[0], data.size(),
+        [](TestMessage& msg, Seqs& out)
+        {
+            out.push_back(msg.m_seq);
+        });
+}
+
+void testEmbeddedFrameAtBoundary()
+{
+    auto capture = makeCapture();
+    auto& data = capture.m_data;
+
+    // Precondition: the boundary search lands inside the big frame
+    auto sync = Decoder::syncPoint(&data[0], data.size(), capture.m_bigFramePos + 1U);
+    UBLOX_TEST_CHECK(capture.m_bigFramePos < sync);
+    UBLOX_TEST_CHECK(sync < (capture.m_bigFramePos + capture.m_bigFrameLen));
+
+    Decoder single(1U);
+    auto expected = decode(single, data);
+    UBLOX_TEST_CHECK(expected == capture.m_seqs);
+    UBLOX_TEST_CHECK(single.stats().m_chunks == 1U);
+
+    for (std::size_t workers = 1U; workers <= 4U; ++workers) {
+        Decoder decoder(workers);
+        decoder.setChunkSize(1U); // Minimal: single maximal frame
+        auto result = decode(decoder, data);
+        UBLOX_TEST_CHECK(result == expected);
+        UBLOX_TEST_CHECK(1U < decoder.stats().m_chunks);
+        UBLOX_TEST_CHECK(decoder.stats().m_frames == single.stats().m_frames);
+        UBLOX_TEST_CHECK(decoder.stats().m_messages == single.stats().m_messages);
+        UBLOX_TEST_CHECK(decoder.stats().m_errors == single.stats().m_errors);
+        UBLOX_TEST_CHECK(decoder.stats().m_discarded == single.stats().m_discarded);
+    }
+}
+
+// Chunk sizes not aligned with the frames, every boundary is crossed
+// by some frame at the nominal position
+void testChunkSizes()
+{
+    auto capture = makeCapture();
+    auto& data = capture.m_data;
+    for (std::size_t chunkSize = 300U; chunkSize < 2000U; chunkSize += 97U) {
+        Decoder decoder(3U);
+        decoder.setChunkSize(chunkSize);
+        UBLOX_TEST_CHECK(decode(decoder, data) == capture.m_seqs);
+    }
+}
+
+} // namespace
+
+int main()
+{
+    testEmbeddedFrameAtBoundary();
+    testChunkSizes();
+    return ublox::test::result();
+}
+
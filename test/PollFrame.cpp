@@ -0,0 +1,89 @@
+//
+// Copyright 2018 (C). Alex Robenko. All rights reserved.
+//
+
+// This file is free software: you can redistribute it and/or modify
+// it under the terms of the GNU General Public License as published by
+// the Free Software Foundation, either version 3 of the License, or
+// (at your option) any later version.
+//
+// This program is distributed in the hope that it will be useful,
+// but WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+// GNU General Public License for more details.
+//
+// You should have received a copy of the GNU General Public License
+// along with this program.  If not, see <http://www.gnu.org/licenses/>.
+
+// Checks the precomputed frames of the poll messages (ublox::PollFrame)
+// and their lookup by the message ID using ublox::poll::frame().
+
+#include <cstdint>
+#include <cstddef>
+#include <vector>
+
+#include "ublox/PollFrame.h"
+
+#include "TestCommon.h"
+
+namespace
+{
+
+using Data = std::vector<std::uint8_t>;
+
+Data dataOf(const ublox::FrameSpan& span)
+{
+    return Data(span.data(), span.data() + span.size());
+}
+
+void testKnownFrames()
+{
+    static const Data NavPosllhPoll = {0xb5, 0x62, 0x01, 0x02, 0x00, 0x00, 0x03, 0x0a};
+    UBLOX_TEST_CHECK(dataOf(ublox::poll::NavPosllhPoll::span()) == NavPosllhPoll);
+    UBLOX_TEST_CHECK(dataOf(ublox::poll::frame(ublox::MsgId_NAV_POSLLH)) == NavPosllhPoll);
+
+    UBLOX_TEST_CHECK(
+        dataOf(ublox::poll::CfgMsgPoll<ublox::MsgId_NAV_PVT>::span()) ==
+        ublox::test::makeFrame(ublox::MsgId_CFG_MSG, Data{0x01, 0x07}));
+
+    UBLOX_TEST_CHECK(
+        dataOf(ublox::poll::CfgPrtPollPort<1>::span()) ==
+        ublox::test::makeFrame(ublox::MsgId_CFG_PRT, Data{0x01}));
+}
+
+void testLookup()
+{
+    std::size_t found = 0U;
+    for (auto idx = 0U; idx < ublox::details::KnownMsgIdsCount; ++idx) {
+        auto id = ublox::details::MsgIdTableData<>::KnownIds[idx];
+        auto span = ublox::poll::frame(id);
+        if (span.size() == 0U) {
+            UBLOX_TEST_CHECK(span.data() == nullptr);
+            continue;
+        }
+
+        ++found;
+        UBLOX_TEST_CHECK(dataOf(span) == ublox::test::makeFrame(id, Data()));
+    }
+
+    UBLOX_TEST_CHECK(found == 95U);
+    UBLOX_TEST_CHECK(ublox::poll::frame(ublox::MsgId_UPD_SOS).data() == &ublox::poll::UpdSosPoll::Data[0]);
+    UBLOX_TEST_CHECK(ublox::poll::frame(ublox::MsgId_AID_ALM).data() == &ublox::poll::AidAlmPoll::Data[0]);
+
+    // Known IDs without zero-length poll and unknown IDs
+    UBLOX_TEST_CHECK(ublox::poll::frame(ublox::MsgId_CFG_RST).size() == 0U);
+    UBLOX_TEST_CHECK(ublox::poll::frame(ublox::MsgId_ACK_ACK).size() == 0U);
+    UBLOX_TEST_CHECK(ublox::poll::frame(static_cast<ublox::MsgId>(0x0000)).size() == 0U);
+    UBLOX_TEST_CHECK(ublox::poll::frame(static_cast<ublox::MsgId>(0x01fe)).size() == 0U);
+    UBLOX_TEST_CHECK(ublox::poll::frame(static_cast<ublox::MsgId>(0xffff)).size() == 0U);
+}
+
+} // namespace
+
+int main()
+{
+    testKnownFrames();
+    testLookup();
+    return ublox::test::result();
+}
+
@@ -0,0 +1,327 @@
+//
+// Copyright 2018 (C). Alex Robenko. All rights reserved.
+//
+
+// This file is free software: you can redistribute it and/or modify
+// it under the terms of the GNU General Public License as published by
+// the Free Software Foundation, either version 3 of the License, or
+// (at your option) any later version.
+//
+// This program is distributed in the hope that it will be useful,
+// but WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+// GNU General Public License for more details.
+//
+// You should have received a copy of the GNU General Public License
+// along with this program.  If not, see <http://www.gnu.org/licenses/>.
+
+// Compares the output of ublox::rinex::ObsWriter and ublox::rinex::NavWriter
+// with the expected RINEX 3.03 lines.
+
+#include <cstdint>
+#include <cstddef>
+#include <cstring>
+#include <fstream>
+#include <iterator>
+#include <sstream>
+#include <string>
+#include <vector>
+
+#include <unistd.h>
+
+#include "ublox/rinex/ObsWriter.h"
+#include "ublox/rinex/NavWriter.h"
+
+#include "TestCommon.h"
+
+namespace
+{
+
+using Payload = std::vector<std::uint8_t>;
+
+struct Meas
+{
+    double m_prMes;
+    double m_cpMes;
+    float m_doMes;
+    std::uint8_t m_gnssId;
+    std::uint8_t m_svId;
+    std::uint8_t m_freqId;
+    std::uint16_t m_locktime;
+    std::uint8_t m_cno;
+    std::uint8_t m_trkStat;
+};
+
+void putLe(Payload& payload, std::size_t pos, std::uint64_t value, std::size_t len)
+{
+    for (std::size_t idx = 0U; idx < len; ++idx) {
+        payload[pos + idx] = static_cast<std::uint8_t>(value >> (idx * 8U));
+    }
+}
+
+template <typename T, typename TBits>
+void putFloat(Payload& payload, std::size_t pos, T value)
+{
+    TBits bits = 0U;
+    std::memcpy(&bits, &value, sizeof(bits));
+    putLe(payload, pos, bits, sizeof(bits));
+}
+
+Payload makeRawx(double rcvTow, std::uint16_t week, const std::vector<Meas>& meas)
+{
+    Payload payload(16U + (meas.size() * 32U), 0U);
+    putFloat<double, std::uint64_t>(payload, 0U, rcvTow);
+    putLe(payload, 8U, week, 2U);
+    payload[10] = 18U;
+    payload[11] = static_cast<std::uint8_t>(meas.size());
+    payload[12] = 0x1;
+    payload[13] = 0x1;
+    for (std::size_t idx = 0U; idx < meas.size(); ++idx) {
+        auto pos = 16U + (idx * 32U);
+        auto& m = meas[idx];
+        putFloat<double, std::uint64_t>(payload, pos, m.m_prMes);
+        putFloat<double, std::uint64_t>(payload, pos + 8U, m.m_cpMes);
+        putFloat<float, std::uint32_t>(payload, pos + 16U, m.m_doMes);
+        payload[pos + 20U] = m.m_gnssId;
+        payload[pos + 21U] = m.m_svId;
+        payload[pos + 23U] = m.m_freqId;
+        putLe(payload, pos + 24U, m.m_locktime, 2U);
+        payload[pos + 26U] = m.m_cno;
+        payload[pos + 30U] = m.m_trkStat;
+    }
+    return payload;
+}
+
+std::string filePath(const char* ext)
+{
+    return "ublox_test_rinex_" + std::to_string(::getpid()) + ext;
+}
+
+std::vector<std::string> readLines(const std::string& path)
+{
+    std::vector<std::string> lines;
+    std::ifstream stream(path);
+    std::string line;
+    while (std::getline(stream, line)) {
+        lines.push_back(line);
+    }
+    return lines;
+}
+
+std::vector<std::string> writeObs(const ublox::rinex::ObsHeaderInfo& info)
+{
+    // GPS G05, GLONASS R03 (k = -2), Galileo E11 (pseudorange only), BeiDou C14,
+    // second epoch adds GLONASS R09 (k = +4) and GPS G05 loses lock
+    auto epoch1 = makeRawx(
+        345600.0, 2000U,
+        {
+            {20000000.123, 105100000.456, -1234.567f, 0U, 5U, 0U, 1000U, 45U, 0x7},
+            {21000000.5, 112300000.25, 2500.125f, 6U, 3U, 5U, 2000U, 38U, 0x3},
+            {23000000.0, 0.0, 100.5f, 2U, 11U, 0U, 0U, 30U, 0x1},
+            {37000000.75, 192000000.5, -50.25f, 3U, 14U, 0U, 5000U, 41U, 0x7},
+        });
+
+    auto epoch2 = makeRawx(
+        345601.0, 2000U,
+        {
+            {19999800.5, 105098950.125, -1234.5f, 0U, 5U, 0U, 500U, 46U, 0x7},
+            {21000500.25, 112302500.0, 2500.0f, 6U, 3U, 5U, 3000U, 37U, 0x7},
+            {22000000.0, 118000000.0, -10.0f, 6U, 9U, 11U, 100U, 33U, 0x7},
+        });
+
+    auto path = filePath(".obs");
+    ublox::rinex::ObsWriter writer;
+    writer.setHeaderInfo(info);
+    if (!UBLOX_TEST_CHECK(writer.open(path.c_str()))) {
+        return std::vector<std::string>();
+    }
+
+    UBLOX_TEST_CHECK(writer.writePayload(&epoch1[0], epoch1.size()));
+    UBLOX_TEST_CHECK(writer.writePayload(&epoch2[0], epoch2.size()));
+    UBLOX_TEST_CHECK(writer.epochsCount() == 2U);
+    UBLOX_TEST_CHECK(writer.close());
+
+    auto lines = readLines(path);
+    ::unlink(path.c_str());
+    return lines;
+}
+
+std::vector<std::string> writeNav()
+{
+    ublox::rinex::GpsEphemeris eph;
+    eph.m_prn = 5U;
+    eph.m_week = 2000U;
+    eph.m_tocWeek = 2000U;
+    eph.m_iode = 45U;
+    eph.m_iodc = 301U;
+    eph.m_ura = 0U;
+    eph.m_health = 0U;
+    eph.m_codeL2 = 1U;
+    eph.m_flagL2P = 0U;
+    eph.m_ttr = 345588.0;
+    eph.m_toc = 352800.0;
+    eph.m_toe = 352800.0;
+    eph.m_af0 = -1.2345678901e-4;
+    eph.m_af1 = 1.1368683772e-12;
+    eph.m_af2 = 0.0;
+    eph.m_tgd = -1.0710209608e-8;
+    eph.m_crs = 12.5;
+    eph.m_deltaN = 4.5e-9;
+    eph.m_m0 = 1.25;
+    eph.m_cuc = 6.0e-7;
+    eph.m_e = 0.0125;
+    eph.m_cus = -3.0e-6;
+    eph.m_sqrtA = 5153.625;
+    eph.m_cic = 1.5e-7;
+    eph.m_omega0 = -2.5;
+    eph.m_cis = -7.5e-8;
+    eph.m_i0 = 0.96875;
+    eph.m_crc = 250.25;
+    eph.m_omega = 0.5;
+    eph.m_omegaDot = -8.0e-9;
+    eph.m_idot = 2.5e-10;
+    eph.m_fitInterval = 4.0;
+
+    auto path = filePath(".nav");
+    ublox::rinex::NavHeaderInfo info;
+    info.m_date = "20180510 120000 UTC";
+    ublox::rinex::NavWriter writer;
+    writer.setHeaderInfo(info);
+    if (!UBLOX_TEST_CHECK(writer.open(path.c_str()))) {
+        return std::vector<std::string>();
+    }
+
+    UBLOX_TEST_CHECK(writer.write(eph));
+    UBLOX_TEST_CHECK(writer.recordsCount() == 1U);
+    UBLOX_TEST_CHECK(writer.close());
+
+    auto lines = readLines(path);
+    ::unlink(path.c_str());
+    return lines;
+}
+
+void checkLines(const std::vector<std::string>& lines, const std::vector<std::string>& expected)
+{
+    UBLOX_TEST_CHECK(lines.size() == expected.size());
+    for (std::size_t idx = 0U; (idx < lines.size()) && (idx < expected.size()); ++idx) {
+        if (!UBLOX_TEST_CHECK(lines[idx] == expected[idx])) {
+            std::cerr << "  actual:   \"" << lines[idx] << "\"\n  expected: \"" << expected[idx] << "\"" << std::endl;
+        }
+    }
+}
+
+const std::vector<std::string> ObsHeaderStart = {
+    "     3.03           OBSERVATION DATA    M (MIXED)           RINEX VERSION / TYPE",
+    "ublox                                   20180510 120000 UTC PGM / RUN BY / DATE",
+    "UNKNOWN                                                     MARKER NAME",
+    "NON_GEODETIC                                                MARKER TYPE",
+    "                                                            OBSERVER / AGENCY",
+    "                    U-BLOX                                  REC # / TYPE / VERS",
+    "                                                            ANT # / TYPE",
+    "        0.0000        0.0000        0.0000                  APPROX POSITION XYZ",
+    "        0.0000        0.0000        0.0000                  ANTENNA: DELTA H/E/N",
+    "G    4 C1C L1C D1C S1C                                      SYS / # / OBS TYPES",
+    "R    4 C1C L1C D1C S1C                                      SYS / # / OBS TYPES",
+    "E    4 C1C L1C D1C S1C                                      SYS / # / OBS TYPES",
+    "C    4 C2I L2I D2I S2I                                      SYS / # / OBS TYPES",
+    "J    4 C1C L1C D1C S1C                                      SYS / # / OBS TYPES",
+    "S    4 C1C L1C D1C S1C                                      SYS / # / OBS TYPES",
+    "DBHZ                                                        SIGNAL STRENGTH UNIT",
+    "  2018     5    10     0     0    0.0000000     GPS         TIME OF FIRST OBS",
+};
+
+const std::vector<std::string> ObsHeaderEnd = {
+    " C1C    0.000 C1P    0.000 C2C    0.000 C2P    0.000        GLONASS COD/PHS/BIS",
+    "G L1C  0.00000                                              SYS / PHASE SHIFT",
+    "R L1C  0.00000                                              SYS / PHASE SHIFT",
+    "E L1C  0.00000                                              SYS / PHASE SHIFT",
+    "C L2I  0.00000                                              SYS / PHASE SHIFT",
+    "J L1C  0.00000                                              SYS / PHASE SHIFT",
+    "S L1C  0.00000                                              SYS / PHASE SHIFT",
+    "                                                            END OF HEADER",
+};
+
+const std::vector<std::string> ObsEpochs = {
+    "> 2018 05 10 00 00  0.0000000  0  4",
+    "G05  20000000.123 7 105100000.456 7     -1234.567          45.000",
+    "R03  21000000.500 6 112300000.25026      2500.125          38.000",
+    "E11  23000000.000 5                       100.500          30.000",
+    "C14  37000000.750 6 192000000.500 6       -50.250          41.000",
+    "> 2018 05 10 00 00  1.0000000  0  3",
+    "G05  19999800.500 7 105098950.12517     -1234.500          46.000",
+    "R03  21000500.250 6 112302500.000 6      2500.000          37.000",
+    "R09  22000000.000 5 118000000.000 5       -10.000          33.000",
+};
+
+std::vector<std::string> obsLines(const std::string& glonassSlots)
+{
+    auto lines = ObsHeaderStart;
+    lines.push_back(glonassSlots);
+    lines.insert(lines.end(), ObsHeaderEnd.begin(), ObsHeaderEnd.end());
+    lines.insert(lines.end(), ObsEpochs.begin(), ObsEpochs.end());
+    return lines;
+}
+
+void testObsGlonassSlotsFromFirstEpoch()
+{
+    ublox::rinex::ObsHeaderInfo info;
+    info.m_date = "20180510 120000 UTC";
+    checkLines(
+        writeObs(info),
+        obsLines("  1 R03 -2                                                  GLONASS SLOT / FRQ #"));
+}
+
+void testObsGlonassSlotsProvided()
+{
+    ublox::rinex::ObsHeaderInfo info;
+    info.m_date = "20180510 120000 UTC";
+    info.m_glonassSlots = {{3U, -2}, {9U, 4}, {24U, 2}, {40U, 1}};
+    checkLines(
+        writeObs(info),
+        obsLines("  3 R03 -2 R09  4 R24  2                                    GLONASS SLOT / FRQ #"));
+
+    for (unsigned slot = 1U; slot <= 10U; ++slot) {
+        ublox::rinex::GlonassSlot glonassSlot;
+        glonassSlot.m_slot = slot;
+        glonassSlot.m_frequency = static_cast<int>(slot) - 7;
+        info.m_glonassSlots.push_back(glonassSlot);
+    }
+
+    // Continuation line after 8 slots, the later duplicates take precedence
+    auto lines = writeObs(info);
+    auto pos = ObsHeaderStart.size();
+    if (UBLOX_TEST_CHECK(pos + 1U < lines.size())) {
+        UBLOX_TEST_CHECK(lines[pos] == " 11 R01 -6 R02 -5 R03 -4 R04 -3 R05 -2 R06 -1 R07  0 R08  1 GLONASS SLOT / FRQ #");
+        UBLOX_TEST_CHECK(lines[pos + 1U] == "    R09  2 R10  3 R24  2                                    GLONASS SLOT / FRQ #");
+    }
+}
+
+void testNav()
+{
+    checkLines(
+        writeNav(),
+        {
+            "     3.03           N: GNSS NAV DATA    G: GPS              RINEX VERSION / TYPE",
+            "ublox                                   20180510 120000 UTC PGM / RUN BY / DATE",
+            "                                                            END OF HEADER",
+            "G05 2018 05 10 02 00 00-1.234567890100E-04 1.136868377200E-12 0.000000000000E+00",
+            "     4.500000000000E+01 1.250000000000E+01 4.500000000000E-09 1.250000000000E+00",
+            "     6.000000000000E-07 1.250000000000E-02-3.000000000000E-06 5.153625000000E+03",
+            "     3.528000000000E+05 1.500000000000E-07-2.500000000000E+00-7.500000000000E-08",
+            "     9.687500000000E-01 2.502500000000E+02 5.000000000000E-01-8.000000000000E-09",
+            "     2.500000000000E-10 1.000000000000E+00 2.000000000000E+03 0.000000000000E+00",
+            "     2.400000000000E+00 0.000000000000E+00-1.071020960800E-08 3.010000000000E+02",
+            "     3.455880000000E+05 4.000000000000E+00",
+        });
+}
+
+} // namespace
+
+int main()
+{
+    testObsGlonassSlotsFromFirstEpoch();
+    testObsGlonassSlotsProvided();
+    testNav();
+    return ublox::test::result();
+}
+
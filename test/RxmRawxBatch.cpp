@@ -0,0 +1,313 @@
+//
+// Copyright 2018 (C). Alex Robenko. All rights reserved.
+//
+
+// This file is free software: you can redistribute it and/or modify
+// it under the terms of the GNU General Public License as published by
+// the Free Software Foundation, either version 3 of the License, or
+// (at your option) any later version.
+//
+// This program is distributed in the hope that it will be useful,
+// but WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+// GNU General Public License for more details.
+//
+// You should have received a copy of the GNU General Public License
+// along with this program.  If not, see <http://www.gnu.org/licenses/>.
+
+// Checks ublox::view::decodeRxmRawx() reports the values the measurement
+// blocks were built from and matches the scalar decoding for various
+// numbers of measurements (SIMD path processes 4 blocks at a time).
+
+#include <cstdint>
+#include <cstddef>
+#include <cstring>
+#include <vector>
+
+#include "ublox/view/RxmRawxBatch.h"
+
+#include "TestCommon.h"
+
+namespace
+{
+
+using Data = std::vector<std::uint8_t>;
+
+const std::size_t HeaderLen = 16U;
+const std::size_t BlockLen = 32U;
+const std::size_t MaxMeas = 255U;
+const std::size_t Guard = 4U;
+const std::uint8_t GuardByte = 0xa5;
+
+struct Measurement
+{
+    double m_prMes = 0.0;
+    double m_cpMes = 0.0;
+    float m_doMes = 0.0f;
+    std::uint8_t m_gnssId = 0U;
+    std::uint8_t m_svId = 0U;
+    std::uint8_t m_freqId = 0U;
+    std::uint16_t m_locktime = 0U;
+    std::uint8_t m_cno = 0U;
+    std::uint8_t m_prStdev = 0U;
+    std::uint8_t m_cpStdev = 0U;
+    std::uint8_t m_doStdev = 0U;
+    std::uint8_t m_trkStat = 0U;
+};
+
+// Column buffers with guard elements after the capacity
+struct Columns
+{
+    explicit Columns(std::size_t capacity)
+      : m_prMes(capacity + Guard),
+        m_cpMes(capacity + Guard),
+        m_doMes(capacity + Guard),
+        m_gnssId(capacity + Guard, GuardByte),
+        m_svId(capacity + Guard, GuardByte),
+        m_freqId(capacity + Guard, GuardByte),
+        m_locktime(capacity + Guard, 0xa5a5),
+        m_cno(capacity + Guard, GuardByte),
+        m_prStdev(capacity + Guard, GuardByte),
+        m_cpStdev(capacity + Guard, GuardByte),
+        m_doStdev(capacity + Guard, GuardByte),
+        m_trkStat(capacity + Guard, GuardByte)
+    {
+        m_columns.m_prMes = &m_prMes[0];
+        m_columns.m_cpMes = &m_cpMes[0];
+        m_columns.m_doMes = &m_doMes[0];
+        m_columns.m_gnssId = &m_gnssId[0];
+        m_columns.m_svId = &m_svId[0];
+        m_columns.m_freqId = &m_freqId[0];
+        m_columns.m_locktime = &m_locktime[0];
+        m_columns.m_cno = &m_cno[0];
+        m_columns.m_prStdev = &m_prStdev[0];
+        m_columns.m_cpStdev = &m_cpStdev[0];
+        m_columns.m_doStdev = &m_doStdev[0];
+        m_columns.m_trkStat = &m_trkStat[0];
+        m_columns.m_capacity = capacity;
+    }
+
+    bool guardsIntact(std::size_t count) const
+    {
+        for (auto idx = count; idx < m_gnssId.size(); ++idx) {
+            if ((m_prMes[idx] != 0.0) || (m_cpMes[idx] != 0.0) || (m_doMes[idx] != 0.0) ||
+                (m_gnssId[idx] != GuardByte) || (m_svId[idx] != GuardByte) ||
+                (m_freqId[idx] != GuardByte) || (m_locktime[idx] != 0xa5a5) ||
+                (m_cno[idx] != GuardByte) || (m_prStdev[idx] != GuardByte) ||
+                (m_cpStdev[idx] != GuardByte) || (m_doStdev[idx] != GuardByte) ||
+                (m_trkStat[idx] != GuardByte)) {
+                return false;
+            }
+        }
+        return true;
+    }
+
+    bool matches(std::size_t idx, const Measurement& meas) const
+    {
+        return
+            (std::memcmp(&m_prMes[idx], &meas.m_prMes, sizeof(double)) == 0) &&
+            (std::memcmp(&m_cpMes[idx], &meas.m_cpMes, sizeof(double)) == 0) &&
+            (m_doMes[idx] == static_cast<double>(meas.m_doMes)) &&
+            (m_gnssId[idx] == meas.m_gnssId) &&
+            (m_svId[idx] == meas.m_svId) &&
+            (m_freqId[idx] == meas.m_freqId) &&
+            (m_locktime[idx] == meas.m_locktime) &&
+            (m_cno[idx] == meas.m_cno) &&
+            (m_prStdev[idx] == meas.m_prStdev) &&
+            (m_cpStdev[idx] == meas.m_cpStdev) &&
+            (m_doStdev[idx] == meas.m_doStdev) &&
+            (m_trkStat[idx] == meas.m_trkStat);
+    }
+
+    bool operator==(const Columns& other) const
+    {
+        return
+            (std::memcmp(&m_prMes[0], &other.m_prMes[0], m_prMes.size() * sizeof(double)) == 0) &&
+            (std::memcmp(&m_cpMes[0], &other.m_cpMes[0], m_cpMes.size() * sizeof(double)) == 0) &&
+            (std::memcmp(&m_doMes[0], &other.m_doMes[0], m_doMes.size() * sizeof(double)) == 0) &&
+            (m_gnssId == other.m_gnssId) &&
+            (m_svId == other.m_svId) &&
+            (m_freqId == other.m_freqId) &&
+            (m_locktime == other.m_locktime) &&
+            (m_cno == other.m_cno) &&
+            (m_prStdev == other.m_prStdev) &&
+            (m_cpStdev == other.m_cpStdev) &&
+            (m_doStdev == other.m_doStdev) &&
+            (m_trkStat == other.m_trkStat);
+    }
+
+    std::vector<double> m_prMes;
+    std::vector<double> m_cpMes;
+    std::vector<double> m_doMes;
+    std::vector<std::uint8_t> m_gnssId;
+    std::vector<std::uint8_t> m_svId;
+    std::vector<std::uint8_t> m_freqId;
+    std::vector<std::uint16_t> m_locktime;
+    std::vector<std::uint8_t> m_cno;
+    std::vector<std::uint8_t> m_prStdev;
+    std::vector<std::uint8_t> m_cpStdev;
+    std::vector<std::uint8_t> m_doStdev;
+    std::vector<std::uint8_t> m_trkStat;
+    ublox::view::RxmRawxColumns m_columns;
+};
+
+void putBytes(Data& data, const void* value, std::size_t len)
+{
+    // Little endian host is assumed
+    auto* bytes = reinterpret_cast<const std::uint8_t*>(value);
+    data.insert(data.end(), bytes, bytes + len);
+}
+
+Measurement makeMeasurement(ublox::test::Random& random, std::size_t idx)
+{
+    Measurement meas;
+    meas.m_prMes = 2.0e7 + (static_cast<double>(random.next()) / 1024.0);
+    meas.m_cpMes = -static_cast<double>(random.next()) / 3.0;
+    meas.m_doMes = static_cast<float>(static_cast<std::int32_t>(random.next())) / 65536.0f;
+    meas.m_gnssId = static_cast<std::uint8_t>(random.next());
+    meas.m_svId = static_cast<std::uint8_t>(random.next());
+    meas.m_freqId = static_cast<std::uint8_t>(random.next());
+    meas.m_locktime = static_cast<std::uint16_t>(random.next());
+    meas.m_cno = static_cast<std::uint8_t>(random.next());
+    meas.m_prStdev = static_cast<std::uint8_t>(random.next());
+    meas.m_cpStdev = static_cast<std::uint8_t>(random.next());
+    meas.m_doStdev = static_cast<std::uint8_t>(random.next());
+    meas.m_trkStat = static_cast<std::uint8_t>(random.next());
+
+    // Values at the edges of the packing (signed saturation of locktime)
+    if ((idx % 5U) == 0U) {
+        meas.m_locktime = 0xffff;
+        meas.m_gnssId = 0xff;
+        meas.m_trkStat = 0x80;
+    }
+    else if ((idx % 5U) == 1U) {
+        meas.m_locktime = 0x8000;
+        meas.m_cno = 0U;
+    }
+    return meas;
+}
+
+// Payload preceded by one byte to make it unaligned
+Data makePayload(const std::vector<Measurement>& measurements)
+{
+    Data data(1U, 0x00);
+    double rcvTow = 345678.125;
+    putBytes(data, &rcvTow, sizeof(rcvTow));
+    data.push_back(0xd0); // week = 2000
+    data.push_back(0x07);
+    data.push_back(18U); // leapS
+    data.push_back(static_cast<std::uint8_t>(measurements.size()));
+    data.push_back(0x03); // recStat
+    data.push_back(0x01); // version
+    data.push_back(0x00);
+    data.push_back(0x00);
+
+    for (auto& meas : measurements) {
+        putBytes(data, &meas.m_prMes, sizeof(meas.m_prMes));
+        putBytes(data, &meas.m_cpMes, sizeof(meas.m_cpMes));
+        putBytes(data, &meas.m_doMes, sizeof(meas.m_doMes));
+        data.push_back(meas.m_gnssId);
+        data.push_back(meas.m_svId);
+        data.push_back(0x00); // reserved2
+        data.push_back(meas.m_freqId);
+        putBytes(data, &meas.m_locktime, sizeof(meas.m_locktime));
+        data.push_back(meas.m_cno);
+        data.push_back(meas.m_prStdev);
+        data.push_back(meas.m_cpStdev);
+        data.push_back(meas.m_doStdev);
+        data.push_back(meas.m_trkStat);
+        data.push_back(0x00); // reserved3
+    }
+    return data;
+}
+
+void testNumMeas(std::size_t numMeas)
+{
+    ublox::test::Random random(static_cast<std::uint32_t>(numMeas + 1U));
+    std::vector<Measurement> measurements;
+    for (std::size_t idx = 0U; idx < numMeas; ++idx) {
+        measurements.push_back(makeMeasurement(random, idx));
+    }
+
+    auto data = makePayload(measurements);
+    const std::uint8_t* payload = &data[1];
+    auto len = data.size() - 1U;
+    UBLOX_TEST_CHECK(len == (HeaderLen + (numMeas * BlockLen)));
+
+    Columns columns(MaxMeas);
+    ublox::view::RxmRawxEpoch epoch;
+    std::size_t count = MaxMeas + 1U;
+    auto es = ublox::view::decodeRxmRawx(payload, len, epoch, columns.m_columns, count);
+    UBLOX_TEST_CHECK(es == comms::ErrorStatus::Success);
+    UBLOX_TEST_CHECK(count == numMeas);
+    UBLOX_TEST_CHECK(epoch.m_rcvTow == 345678.125);
+    UBLOX_TEST_CHECK(epoch.m_week == 2000U);
+    UBLOX_TEST_CHECK(epoch.m_leapS == 18);
+    UBLOX_TEST_CHECK(epoch.m_numMeas == numMeas);
+    UBLOX_TEST_CHECK(epoch.m_recStat == 3U);
+    UBLOX_TEST_CHECK(epoch.m_version == 1U);
+
+    for (std::size_t idx = 0U; idx < numMeas; ++idx) {
+        if (!UBLOX_TEST_CHECK(columns.matches(idx, measurements[idx]))) {
+            std::cerr << "numMeas=" << numMeas << " idx=" << idx << std::endl;
+            break;
+        }
+    }
+    UBLOX_TEST_CHECK(columns.guardsIntact(numMeas));
+
+    // Output identical to the scalar only decoding
+    Columns scalar(MaxMeas);
+    ublox::view::details::rxmRawxDecodeBlocksScalar(payload + HeaderLen, 0U, numMeas, scalar.m_columns);
+    UBLOX_TEST_CHECK(columns == scalar);
+
+    // Capacity exactly matching the number of measurements
+    Columns exact(numMeas);
+    es = ublox::view::decodeRxmRawx(payload, len, epoch, exact.m_columns, count);
+    UBLOX_TEST_CHECK(es == comms::ErrorStatus::Success);
+    UBLOX_TEST_CHECK(exact.guardsIntact(numMeas));
+}
+
+void testErrors()
+{
+    ublox::test::Random random;
+    std::vector<Measurement> measurements;
+    for (std::size_t idx = 0U; idx < 5U; ++idx) {
+        measurements.push_back(makeMeasurement(random, idx));
+    }
+
+    auto data = makePayload(measurements);
+    const std::uint8_t* payload = &data[1];
+    auto len = data.size() - 1U;
+    ublox::view::RxmRawxEpoch epoch;
+    std::size_t count = 0U;
+
+    Columns columns(MaxMeas);
+    auto es = ublox::view::decodeRxmRawx(payload, HeaderLen - 1U, epoch, columns.m_columns, count);
+    UBLOX_TEST_CHECK(es == comms::ErrorStatus::NotEnoughData);
+
+    es = ublox::view::decodeRxmRawx(payload, len - 1U, epoch, columns.m_columns, count);
+    UBLOX_TEST_CHECK(es == comms::ErrorStatus::NotEnoughData);
+    UBLOX_TEST_CHECK(count == 0U);
+
+    Columns small(measurements.size() - 1U);
+    es = ublox::view::decodeRxmRawx(payload, len, epoch, small.m_columns, count);
+    UBLOX_TEST_CHECK(es == comms::ErrorStatus::BufferOverflow);
+    UBLOX_TEST_CHECK(small.guardsIntact(0U));
+}
+
+} // namespace
+
+int main()
+{
+    static const std::size_t NumMeasValues[] = {
+        0U, 1U, 2U, 3U, 4U, 5U, 6U, 7U, 8U, 9U, 15U, 16U, 17U, 32U, 63U, MaxMeas
+    };
+
+    for (auto numMeas : NumMeasValues) {
+        testNumMeas(numMeas);
+    }
+
+    testErrors();
+    return ublox::test::result();
+}
+
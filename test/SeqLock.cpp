@@ -0,0 +1,123 @@
+//
+// Copyright 2018 (C). Alex Robenko. All rights reserved.
+//
+
+// This file is free software: you can redistribute it and/or modify
+// it under the terms of the GNU General Public License as published by
+// the Free Software Foundation, either version 3 of the License, or
+// (at your option) any later version.
+//
+// This program is distributed in the hope that it will be useful,
+// but WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+// GNU General Public License for more details.
+//
+// You should have received a copy of the GNU General Public License
+// along with this program.  If not, see <http://www.gnu.org/licenses/>.
+
+// Checks that the readers of ublox::util::SeqLock never observe torn value
+// while the single writer keeps updating it.
+
+#include <cstdint>
+#include <cstddef>
+#include <array>
+#include <atomic>
+#include <thread>
+#include <vector>
+
+#include "ublox/util/SeqLock.h"
+
+#include "TestCommon.h"
+
+namespace
+{
+
+// Every word of the value is derived from the same counter, any mix of
+// two updates is detected
+struct Value
+{
+    std::uint64_t m_counter = 0U;
+    std::array<std::uint32_t, 61> m_words = {{0U}};
+    std::uint8_t m_tail = 0U;
+};
+
+Value makeValue(std::uint64_t counter)
+{
+    Value value;
+    value.m_counter = counter;
+    for (std::size_t idx = 0U; idx < value.m_words.size(); ++idx) {
+        value.m_words[idx] = static_cast<std::uint32_t>(counter * 31U + idx);
+    }
+    value.m_tail = static_cast<std::uint8_t>(counter);
+    return value;
+}
+
+bool isConsistent(const Value& value)
+{
+    auto expected = makeValue(value.m_counter);
+    return (value.m_words == expected.m_words) && (value.m_tail == expected.m_tail);
+}
+
+void testContention()
+{
+    static const std::uint64_t UpdatesCount = 200000U;
+    static const std::size_t ReadersCount = 3U;
+
+    ublox::util::SeqLock<Value> lock(makeValue(0U));
+    std::atomic<bool> done(false);
+    std::atomic<std::size_t> torn(0U);
+    std::atomic<std::size_t> backwards(0U);
+    std::atomic<std::size_t> reads(0U);
+
+    std::vector<std::thread> readers;
+    for (std::size_t readerIdx = 0U; readerIdx < ReadersCount; ++readerIdx) {
+        readers.emplace_back(
+            [&]()
+            {
+                std::uint64_t last = 0U;
+                std::size_t count = 0U;
+                while (!done.load()) {
+                    auto value = lock.read();
+                    if (!isConsistent(value)) {
+                        ++torn;
+                    }
+
+                    if (value.m_counter < last) {
+                        ++backwards;
+                    }
+                    last = value.m_counter;
+
+                    Value tried;
+                    if (lock.tryRead(tried) && (!isConsistent(tried))) {
+                        ++torn;
+                    }
+                    ++count;
+                }
+                reads += count;
+            });
+    }
+
+    for (std::uint64_t counter = 1U; counter <= UpdatesCount; ++counter) {
+        lock.write(makeValue(counter));
+    }
+
+    done = true;
+    for (auto& reader : readers) {
+        reader.join();
+    }
+
+    UBLOX_TEST_CHECK(torn.load() == 0U);
+    UBLOX_TEST_CHECK(backwards.load() == 0U);
+    UBLOX_TEST_CHECK(0U < reads.load());
+    UBLOX_TEST_CHECK(lock.version() == UpdatesCount);
+    UBLOX_TEST_CHECK(lock.read().m_counter == UpdatesCount);
+}
+
+} // namespace
+
+int main()
+{
+    testContention();
+    return ublox::test::result();
+}
+
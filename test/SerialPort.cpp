@@ -0,0 +1,189 @@
+//
+// Copyright 2018 (C). Alex Robenko. All rights reserved.
+//
+
+// This file is free software: you can redistribute it and/or modify
+// it under the terms of the GNU General Public License as published by
+// the Free Software Foundation, either version 3 of the License, or
+// (at your option) any later version.
+//
+// This program is distributed in the hope that it will be useful,
+// but WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+// GNU General Public License for more details.
+//
+// You should have received a copy of the GNU General Public License
+// along with this program.  If not, see <http://www.gnu.org/licenses/>.
+
+// End-to-end check of ublox::io::SerialPort and ublox::io::EpollReactor
+// using pseudo-terminals as stand-in devices.
+
+#include <cstdint>
+#include <cstddef>
+#include <cerrno>
+#include <vector>
+#include <algorithm>
+#include <thread>
+
+#include <fcntl.h>
+#include <unistd.h>
+
+#include "ublox/io/SerialPort.h"
+#include "ublox/io/EpollReactor.h"
+
+#include "TestCommon.h"
+#include "TestPty.h"
+
+namespace
+{
+
+using Data = std::vector<std::uint8_t>;
+
+using ublox::test::Pty;
+using ublox::test::writeAll;
+
+Data makeFrame(std::uint8_t id, std::size_t payloadLen, std::uint8_t seed)
+{
+    Data payload(payloadLen);
+    for (std::size_t idx = 0U; idx < payloadLen; ++idx) {
+        payload[idx] = static_cast<std::uint8_t>(seed + idx);
+    }
+    return ublox::test::makeFrame(0x01, id, payload);
+}
+
+void testReactorMultipleDevices()
+{
+    static const std::size_t DevCount = 3U;
+    Pty ptys[DevCount];
+    ublox::io::SerialPort ports[DevCount];
+    ublox::io::EpollReactor<> reactor;
+    if (!UBLOX_TEST_CHECK(reactor.isValid())) {
+        return;
+    }
+
+    for (std::size_t idx = 0U; idx < DevCount; ++idx) {
+        if (!UBLOX_TEST_CHECK(ptys[idx].isValid()) ||
+            !UBLOX_TEST_CHECK(ports[idx].open(ptys[idx].m_name, 115200U))) {
+            return;
+        }
+        UBLOX_TEST_CHECK(reactor.addDevice(ports[idx].fd()) == static_cast<int>(idx));
+    }
+
+    // Frames of every device written in small pieces with garbage in between
+    static const std::size_t FramesPerDev = 20U;
+    std::vector<Data> expected[DevCount];
+    for (std::size_t idx = 0U; idx < DevCount; ++idx) {
+        Data stream = {0x00, 0xb5, 0x13};
+        for (std::size_t frameIdx = 0U; frameIdx < FramesPerDev; ++frameIdx) {
+            auto frame = makeFrame(
+                static_cast<std::uint8_t>(idx),
+                (frameIdx * 37U) % 700U,
+                static_cast<std::uint8_t>(frameIdx));
+            expected[idx].push_back(frame);
+            stream.insert(stream.end(), frame.begin(), frame.end());
+            stream.push_back(0x55);
+        }
+
+        std::size_t pos = 0U;
+        while (pos < stream.size()) {
+            auto len = std::min<std::size_t>(stream.size() - pos, 97U);
+            UBLOX_TEST_CHECK(writeAll(ptys[idx].m_master, Data(&stream[pos], &stream[pos] + len)));
+            pos += len;
+        }
+    }
+
+    std::vector<Data> received[DevCount];
+    for (auto attempt = 0; attempt < 100; ++attempt) {
+        auto result =
+            reactor.poll(100,
+                [&received](std::size_t deviceIdx, const ublox::FrameSpan& frame)
+                {
+                    received[deviceIdx].emplace_back(frame.data(), frame.data() + frame.size());
+                });
+        UBLOX_TEST_CHECK(0 <= result);
+
+        bool done = true;
+        for (std::size_t idx = 0U; idx < DevCount; ++idx) {
+            done = done && (expected[idx].size() <= received[idx].size());
+        }
+
+        if (done) {
+            break;
+        }
+    }
+
+    for (std::size_t idx = 0U; idx < DevCount; ++idx) {
+        UBLOX_TEST_CHECK(received[idx] == expected[idx]);
+        UBLOX_TEST_CHECK(reactor.isDeviceActive(idx));
+    }
+
+    // Hang up removes the device
+    ptys[1].close();
+    for (auto attempt = 0; (attempt < 10) && reactor.isDeviceActive(1U); ++attempt) {
+        reactor.poll(100, [](std::size_t, const ublox::FrameSpan&) {});
+    }
+    UBLOX_TEST_CHECK(!reactor.isDeviceActive(1U));
+    UBLOX_TEST_CHECK(reactor.isDeviceActive(0U));
+}
+
+void testWriteLargeData()
+{
+    Pty pty;
+    ublox::io::SerialPort port;
+    if (!UBLOX_TEST_CHECK(pty.isValid()) ||
+        !UBLOX_TEST_CHECK(port.open(pty.m_name, 115200U))) {
+        return;
+    }
+
+    // Much more than fits into the output buffer of the terminal
+    Data data(1024U * 1024U);
+    ublox::test::Random random;
+    for (auto& byte : data) {
+        byte = static_cast<std::uint8_t>(random.next());
+    }
+
+    Data received;
+    std::thread reader(
+        [&pty, &received, &data]()
+        {
+            std::uint8_t buf[4096];
+            while (received.size() < data.size()) {
+                auto result = ::read(pty.m_master, buf, sizeof(buf));
+                if (result <= 0) {
+                    break;
+                }
+                received.insert(received.end(), buf, buf + result);
+            }
+        });
+
+    UBLOX_TEST_CHECK(port.write(&data[0], data.size(), 5000));
+    reader.join();
+    UBLOX_TEST_CHECK(received == data);
+}
+
+void testWriteTimeout()
+{
+    Pty pty;
+    ublox::io::SerialPort port;
+    if (!UBLOX_TEST_CHECK(pty.isValid()) ||
+        !UBLOX_TEST_CHECK(port.open(pty.m_name, 115200U))) {
+        return;
+    }
+
+    // Nobody reads the other side, the write must not block forever
+    Data data(1024U * 1024U, 0xaa);
+    errno = 0;
+    UBLOX_TEST_CHECK(!port.write(&data[0], data.size(), 50));
+    UBLOX_TEST_CHECK(errno == ETIMEDOUT);
+}
+
+} // namespace
+
+int main()
+{
+    testReactorMultipleDevices();
+    testWriteLargeData();
+    testWriteTimeout();
+    return ublox::test::result();
+}
+
@@ -0,0 +1,176 @@
+//
+// Copyright 2018 (C). Alex Robenko. All rights reserved.
+//
+
+// This file is free software: you can redistribute it and/or modify
+// it under the terms of the GNU General Public License as published by
+// the Free Software Foundation, either version 3 of the License, or
+// (at your option) any later version.
+//
+// This program is distributed in the hope that it will be useful,
+// but WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+// GNU General Public License for more details.
+//
+// You should have received a copy of the GNU General Public License
+// along with this program.  If not, see <http://www.gnu.org/licenses/>.
+
+// Checks ordering, overflow policies and element reset of
+// ublox::util::SpscQueue.
+
+#include <cstdint>
+#include <cstddef>
+#include <atomic>
+#include <memory>
+#include <thread>
+
+#include "ublox/util/FrameBuffer.h"
+#include "ublox/util/SpscQueue.h"
+
+#include "TestCommon.h"
+
+namespace
+{
+
+unsigned ElementClears = 0U;
+
+struct Element
+{
+    std::uint64_t m_value = 0U;
+
+    void clear()
+    {
+        m_value = 0U;
+        ++ElementClears;
+    }
+};
+
+void testOrdering()
+{
+    static const std::uint64_t ElementsCount = 500000U;
+    using Queue = ublox::util::SpscQueue<std::uint64_t, 64>;
+    std::unique_ptr<Queue> queue(new Queue(ublox::util::OverflowPolicy::Block));
+
+    std::atomic<std::size_t> outOfOrder(0U);
+    std::thread consumer(
+        [&]()
+        {
+            std::uint64_t expected = 0U;
+            while (expected < ElementsCount) {
+                std::uint64_t value = 0U;
+                if (!queue->pop(value)) {
+                    std::this_thread::yield();
+                    continue;
+                }
+
+                if (value != expected) {
+                    ++outOfOrder;
+                }
+                ++expected;
+            }
+        });
+
+    for (std::uint64_t value = 0U; value < ElementsCount; ++value) {
+        UBLOX_TEST_CHECK(queue->push(std::uint64_t(value)));
+    }
+
+    consumer.join();
+    UBLOX_TEST_CHECK(outOfOrder.load() == 0U);
+    UBLOX_TEST_CHECK(queue->empty());
+    UBLOX_TEST_CHECK(queue->pushedCount() == ElementsCount);
+    UBLOX_TEST_CHECK(queue->poppedCount() == ElementsCount);
+    UBLOX_TEST_CHECK(queue->droppedCount() == 0U);
+}
+
+void testDropNewest()
+{
+    ublox::util::SpscQueue<std::uint64_t, 4> queue(ublox::util::OverflowPolicy::DropNewest);
+    for (std::uint64_t value = 0U; value < 10U; ++value) {
+        queue.push(std::uint64_t(value));
+    }
+
+    UBLOX_TEST_CHECK(queue.size() == 4U);
+    UBLOX_TEST_CHECK(queue.droppedCount() == 6U);
+    for (std::uint64_t expected = 0U; expected < 4U; ++expected) {
+        std::uint64_t value = 0U;
+        UBLOX_TEST_CHECK(queue.pop(value));
+        UBLOX_TEST_CHECK(value == expected);
+    }
+
+    std::uint64_t value = 0U;
+    UBLOX_TEST_CHECK(!queue.pop(value));
+}
+
+void testDropOldest()
+{
+    ElementClears = 0U;
+    ublox::util::SpscQueue<Element, 4> queue(ublox::util::OverflowPolicy::DropOldest);
+    for (std::uint64_t value = 0U; value < 10U; ++value) {
+        Element elem;
+        elem.m_value = value;
+        UBLOX_TEST_CHECK(queue.push(std::move(elem)));
+    }
+
+    UBLOX_TEST_CHECK(queue.size() == 4U);
+    UBLOX_TEST_CHECK(queue.droppedCount() == 6U);
+
+    // Dropped elements are reset by clear() rather than reassignment
+    UBLOX_TEST_CHECK(ElementClears == 6U);
+
+    for (std::uint64_t expected = 6U; expected < 10U; ++expected) {
+        Element elem;
+        UBLOX_TEST_CHECK(queue.pop(elem));
+        UBLOX_TEST_CHECK(elem.m_value == expected);
+    }
+}
+
+void testFailedFill()
+{
+    using Buffer = ublox::util::FrameBuffer<8>;
+    ublox::util::SpscQueue<Buffer, 4> queue;
+
+    static const std::uint8_t Short[] = {0xb5, 0x62, 0x01, 0x02};
+    static const std::uint8_t Long[] = {0xb5, 0x62, 0x01, 0x02, 0x00, 0x00, 0x03, 0x0a, 0x00};
+
+    ublox::FrameSpan shortFrame;
+    shortFrame.m_data = &Short[0];
+    shortFrame.m_size = sizeof(Short);
+
+    ublox::FrameSpan longFrame;
+    longFrame.m_data = &Long[0];
+    longFrame.m_size = sizeof(Long);
+
+    auto pushFrame =
+        [&queue](const ublox::FrameSpan& frame) -> bool
+        {
+            return queue.pushWith(
+                [&frame](Buffer& elem) -> bool
+                {
+                    return elem.assign(frame);
+                });
+        };
+
+    UBLOX_TEST_CHECK(!pushFrame(longFrame));
+    UBLOX_TEST_CHECK(queue.empty());
+    UBLOX_TEST_CHECK(queue.pushedCount() == 0U);
+
+    UBLOX_TEST_CHECK(pushFrame(shortFrame));
+    UBLOX_TEST_CHECK(queue.size() == 1U);
+
+    Buffer buf;
+    UBLOX_TEST_CHECK(queue.pop(buf));
+    UBLOX_TEST_CHECK(buf.size() == sizeof(Short));
+    UBLOX_TEST_CHECK(buf.data()[3] == 0x02);
+}
+
+} // namespace
+
+int main()
+{
+    testOrdering();
+    testDropNewest();
+    testDropOldest();
+    testFailedFill();
+    return ublox::test::result();
+}
+
@@ -0,0 +1,195 @@
+//
+// Copyright 2018 (C). Alex Robenko. All rights reserved.
+//
+
+// This file is free software: you can redistribute it and/or modify
+// it under the terms of the GNU General Public License as published by
+// the Free Software Foundation, either version 3 of the License, or
+// (at your option) any later version.
+//
+// This program is distributed in the hope that it will be useful,
+// but WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+// GNU General Public License for more details.
+//
+// You should have received a copy of the GNU General Public License
+// along with this program.  If not, see <http://www.gnu.org/licenses/>.
+
+// Checks that reading the messages of ublox::StaticInputMessages bundle
+// using ublox::TableStack with ublox::MsgPool doesn't perform any
+// dynamic memory allocation. The global allocation functions are replaced
+// to count the allocations.
+
+#include <cstdint>
+#include <cstddef>
+#include <cstdlib>
+#include <new>
+#include <tuple>
+#include <vector>
+
+#include "ublox/ublox.h"
+#include "ublox/TableStack.h"
+#include "ublox/InputMessages.h"
+
+#include "TestCommon.h"
+
+namespace
+{
+
+std::size_t AllocCount = 0U;
+
+void* countedAlloc(std::size_t size)
+{
+    ++AllocCount;
+    auto* ptr = std::malloc((size == 0U) ? 1U : size);
+    if (ptr == nullptr) {
+        throw std::bad_alloc();
+    }
+    return ptr;
+}
+
+} // namespace
+
+void* operator new(std::size_t size)
+{
+    return countedAlloc(size);
+}
+
+void* operator new[](std::size_t size)
+{
+    return countedAlloc(size);
+}
+
+void operator delete(void* ptr) noexcept
+{
+    std::free(ptr);
+}
+
+void operator delete[](void* ptr) noexcept
+{
+    std::free(ptr);
+}
+
+#if defined(__cpp_sized_deallocation)
+void operator delete(void* ptr, std::size_t) noexcept
+{
+    std::free(ptr);
+}
+
+void operator delete[](void* ptr, std::size_t) noexcept
+{
+    std::free(ptr);
+}
+#endif
+
+namespace
+{
+
+using InMessage =
+    ublox::MessageT<
+        comms::option::ReadIterator<const std::uint8_t*>,
+        comms::option::IdInfoInterface
+    >;
+
+using AllInputMessages = ublox::StaticInputMessages<InMessage>;
+
+using InProtStack =
+    ublox::TableStack<
+        InMessage,
+        AllInputMessages,
+        ublox::option::StaticStorage::MaxPayloadLen,
+        ublox::MsgPool<InMessage, AllInputMessages>
+    >;
+
+static_assert(
+    ublox::TableStack<InMessage, AllInputMessages>::MaxPayloadLen == ublox::option::StaticStorage::MaxPayloadLen,
+    "The maximal payload length must be derived from the storage options");
+
+using StaticSubset =
+    std::tuple<
+        std::tuple_element<0, AllInputMessages>::type,
+        std::tuple_element<1, AllInputMessages>::type
+    >;
+
+static_assert(
+    ublox::MaxPayloadLenOf<InMessage, StaticSubset>::Value == ublox::option::StaticStorage::MaxPayloadLen,
+    "Any subset of the static bundle must be limited the same way");
+
+static_assert(
+    ublox::MaxPayloadLenOf<InMessage, ublox::InputMessages<InMessage> >::Value == ublox::option::DefaultOptions::MaxPayloadLen,
+    "The default bundle must not be limited");
+
+using Frame = std::vector<std::uint8_t>;
+
+std::vector<std::uint8_t> countedPayload(std::size_t headerLen, std::size_t countPos, std::size_t count, std::size_t blockLen)
+{
+    std::vector<std::uint8_t> payload(headerLen + (count * blockLen), 0U);
+    payload[countPos] = static_cast<std::uint8_t>(count);
+    return payload;
+}
+
+std::vector<std::uint8_t> monVerPayload()
+{
+    std::vector<std::uint8_t> payload(40U + (5U * 30U), 0U);
+    for (std::size_t idx = 0U; idx < payload.size(); ++idx) {
+        if ((idx % 30U) < 10U) {
+            payload[idx] = static_cast<std::uint8_t>('A' + (idx % 26U));
+        }
+    }
+    return payload;
+}
+
+std::vector<std::uint8_t> infPayload(std::size_t len)
+{
+    return std::vector<std::uint8_t>(len, static_cast<std::uint8_t>('x'));
+}
+
+} // namespace
+
+int main()
+{
+    struct Case
+    {
+        ublox::MsgId m_id;
+        Frame m_frame;
+    };
+
+    std::vector<Case> cases = {
+        {ublox::MsgId_NAV_PVT, ublox::test::makeFrame(ublox::MsgId_NAV_PVT, std::vector<std::uint8_t>(92U, 0U))},
+        {ublox::MsgId_NAV_SAT, ublox::test::makeFrame(ublox::MsgId_NAV_SAT, countedPayload(8U, 5U, 40U, 12U))},
+        {ublox::MsgId_RXM_RAWX, ublox::test::makeFrame(ublox::MsgId_RXM_RAWX, countedPayload(16U, 11U, 255U, 32U))},
+        {ublox::MsgId_RXM_SFRBX, ublox::test::makeFrame(ublox::MsgId_RXM_SFRBX, countedPayload(8U, 4U, 10U, 4U))},
+        {ublox::MsgId_MON_VER, ublox::test::makeFrame(ublox::MsgId_MON_VER, monVerPayload())},
+        {ublox::MsgId_INF_NOTICE, ublox::test::makeFrame(ublox::MsgId_INF_NOTICE, infPayload(ublox::option::StaticStorage::MaxPayloadLen))},
+    };
+
+    auto oversized = ublox::test::makeFrame(ublox::MsgId_INF_NOTICE, infPayload(ublox::option::StaticStorage::MaxPayloadLen + 1U));
+
+    static InProtStack protStack;
+    InProtStack::MsgPtr msg;
+
+    auto allocCountBefore = AllocCount;
+    for (auto round = 0U; round < 3U; ++round) {
+        for (auto& testCase : cases) {
+            const std::uint8_t* iter = &testCase.m_frame[0];
+            auto es = protStack.read(msg, iter, testCase.m_frame.size());
+            if (UBLOX_TEST_CHECK(es == comms::ErrorStatus::Success) &&
+                UBLOX_TEST_CHECK(msg)) {
+                UBLOX_TEST_CHECK(msg->getId() == testCase.m_id);
+                UBLOX_TEST_CHECK(iter == (&testCase.m_frame[0] + testCase.m_frame.size()));
+            }
+            msg.reset();
+        }
+
+        const std::uint8_t* iter = &oversized[0];
+        UBLOX_TEST_CHECK(protStack.read(msg, iter, oversized.size()) == comms::ErrorStatus::ProtocolError);
+        UBLOX_TEST_CHECK(!msg);
+    }
+
+    UBLOX_TEST_CHECK(AllocCount == allocCountBefore);
+    UBLOX_TEST_CHECK(protStack.allocStats().m_heapAllocCount == 0U);
+    UBLOX_TEST_CHECK(protStack.allocStats().m_allocCount == (3U * cases.size()));
+    UBLOX_TEST_CHECK(protStack.allocStats().m_inUse == 0U);
+    return ublox::test::result();
+}
+
@@ -0,0 +1,192 @@
+//
+// Copyright 2018 (C). Alex Robenko. All rights reserved.
+//
+
+// This file is free software: you can redistribute it and/or modify
+// it under the terms of the GNU General Public License as published by
+// the Free Software Foundation, either version 3 of the License, or
+// (at your option) any later version.
+//
+// This program is distributed in the hope that it will be useful,
+// but WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+// GNU General Public License for more details.
+//
+// You should have received a copy of the GNU General Public License
+// along with this program.  If not, see <http://www.gnu.org/licenses/>.
+
+// Checks ublox::StreamFramer reports every frame exactly once as
+// contiguous span regardless of how the input is split into reads,
+// including the frames wrapping around the end of the ring buffer.
+
+#include <algorithm>
+#include <cstdint>
+#include <cstddef>
+#include <cstring>
+#include <vector>
+
+#include "ublox/StreamFramer.h"
+
+#include "TestCommon.h"
+
+namespace
+{
+
+using Data = std::vector<std::uint8_t>;
+using Frames = std::vector<Data>;
+
+const std::size_t Capacity = 1024U;
+const std::size_t MaxPayloadLen = 256U;
+
+using Framer = ublox::StreamFramer<Capacity, MaxPayloadLen>;
+
+struct Stream
+{
+    Data m_data;
+    Frames m_frames;
+    std::size_t m_garbage = 0U;
+};
+
+// Frames of random length with garbage (including false sync with
+// too big length) in between, always ends with the frame
+Stream makeStream(std::size_t framesCount)
+{
+    ublox::test::Random random;
+    Stream stream;
+    for (std::size_t idx = 0U; idx < framesCount; ++idx) {
+        if ((random.next() % 3U) == 0U) {
+            static const std::uint8_t FalseSync[] = {0xb5, 0x62, 0x01, 0x07, 0xff, 0xff};
+            stream.m_data.insert(stream.m_data.end(), std::begin(FalseSync), std::end(FalseSync));
+            stream.m_garbage += sizeof(FalseSync);
+
+            auto garbage = random.next() % 16U;
+            for (auto count = 0U; count < garbage; ++count) {
+                stream.m_data.push_back(static_cast<std::uint8_t>(random.next() % 0xb5));
+            }
+            stream.m_garbage += garbage;
+        }
+
+        Data payload(random.next() % (MaxPayloadLen + 1U));
+        for (auto& byte : payload) {
+            byte = static_cast<std::uint8_t>(random.next());
+        }
+
+        auto frame = ublox::test::makeFrame(0x02, 0x15, payload);
+        stream.m_data.insert(stream.m_data.end(), frame.begin(), frame.end());
+        stream.m_frames.push_back(std::move(frame));
+    }
+    return stream;
+}
+
+// Returns number of frames wrapping around the end of the ring, the
+// buffer is rewound when emptied, so byte by byte reads never wrap
+std::size_t drain(Framer& framer, const std::uint8_t* ring, Frames& frames)
+{
+    std::size_t wrapped = 0U;
+    ublox::FrameSpan frame;
+    while (framer.nextFrame(frame)) {
+        frames.emplace_back(frame.data(), frame.data() + frame.size());
+        if ((ring + Capacity) < (frame.data() + frame.size())) {
+            ++wrapped;
+        }
+    }
+    return wrapped;
+}
+
+void testSplitReads()
+{
+    auto stream = makeStream(500U);
+    for (auto maxRead : {1U, 7U, 100U, 300U, 1000U}) {
+        ublox::test::Random random(maxRead);
+        Framer framer;
+        auto* ring = framer.writeBuf();
+        Frames frames;
+        std::size_t wrapped = 0U;
+        std::size_t pos = 0U;
+        while (pos < stream.m_data.size()) {
+            auto len = 1U + (random.next() % maxRead);
+            if ((stream.m_data.size() - pos) < len) {
+                len = stream.m_data.size() - pos;
+            }
+
+            auto pushed = framer.push(&stream.m_data[pos], len);
+            UBLOX_TEST_CHECK(0U < pushed);
+            pos += pushed;
+            wrapped += drain(framer, ring, frames);
+        }
+
+        UBLOX_TEST_CHECK(frames == stream.m_frames);
+        UBLOX_TEST_CHECK((maxRead == 1U) || (0U < wrapped));
+        UBLOX_TEST_CHECK(framer.size() == 0U);
+        UBLOX_TEST_CHECK(framer.discardedCount() == stream.m_garbage);
+    }
+}
+
+// Reads performed directly into the internal buffer
+void testWriteBuf()
+{
+    auto stream = makeStream(200U);
+    Framer framer;
+    auto* ring = framer.writeBuf();
+    Frames frames;
+    std::size_t wrapped = 0U;
+    std::size_t pos = 0U;
+    while (pos < stream.m_data.size()) {
+        auto len = std::min<std::size_t>(framer.writeBufSize(), 150U);
+        len = std::min(len, stream.m_data.size() - pos);
+        UBLOX_TEST_CHECK(0U < len);
+        std::memcpy(framer.writeBuf(), &stream.m_data[pos], len);
+        framer.commit(len);
+        pos += len;
+        wrapped += drain(framer, ring, frames);
+    }
+
+    UBLOX_TEST_CHECK(frames == stream.m_frames);
+    UBLOX_TEST_CHECK(0U < wrapped);
+}
+
+// Single frame split at every possible position
+void testFrameSplitAcrossReads()
+{
+    auto frame = ublox::test::makeFrame(0x01, 0x07, Data(92U, 0x5a));
+    for (std::size_t split = 1U; split < frame.size(); ++split) {
+        Framer framer;
+        ublox::FrameSpan span;
+        UBLOX_TEST_CHECK(framer.push(&frame[0], split) == split);
+        UBLOX_TEST_CHECK(!framer.nextFrame(span));
+        UBLOX_TEST_CHECK(framer.size() == split);
+
+        UBLOX_TEST_CHECK(framer.push(&frame[split], frame.size() - split) == (frame.size() - split));
+        UBLOX_TEST_CHECK(framer.nextFrame(span));
+        UBLOX_TEST_CHECK(span.size() == frame.size());
+        UBLOX_TEST_CHECK(std::memcmp(span.data(), &frame[0], frame.size()) == 0);
+        UBLOX_TEST_CHECK(!framer.nextFrame(span));
+        UBLOX_TEST_CHECK(framer.discardedCount() == 0U);
+    }
+}
+
+void testFull()
+{
+    Data data(Capacity + 10U, 0x00);
+    Framer framer;
+    UBLOX_TEST_CHECK(framer.push(&data[0], data.size()) == Capacity);
+    UBLOX_TEST_CHECK(framer.writeBufSize() == 0U);
+
+    // Garbage is dropped, the space is available again
+    ublox::FrameSpan span;
+    UBLOX_TEST_CHECK(!framer.nextFrame(span));
+    UBLOX_TEST_CHECK(framer.size() == 0U);
+    UBLOX_TEST_CHECK(framer.writeBufSize() == Capacity);
+}
+
+} // namespace
+
+int main()
+{
+    testSplitReads();
+    testWriteBuf();
+    testFrameSplitAcrossReads();
+    testFull();
+    return ublox::test::result();
+}
+
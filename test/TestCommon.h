@@ -0,0 +1,127 @@
+//
+// Copyright 2018 (C). Alex Robenko. All rights reserved.
+//
+
+// This file is free software: you can redistribute it and/or modify
+// it under the terms of the GNU General Public License as published by
+// the Free Software Foundation, either version 3 of the License, or
+// (at your option) any later version.
+//
+// This program is distributed in the hope that it will be useful,
+// but WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+// GNU General Public License for more details.
+//
+// You should have received a copy of the GNU General Public License
+// along with this program.  If not, see <http://www.gnu.org/licenses/>.
+
+/// @file
+/// @brief Common definitions of the unittests.
+
+#pragma once
+
+#include <cstdint>
+#include <cstddef>
+#include <iostream>
+#include <limits>
+#include <vector>
+
+#include "ublox/MsgId.h"
+#include "ublox/protocol/ChecksumCalc.h"
+
+namespace ublox
+{
+
+namespace test
+{
+
+inline std::size_t& failuresCount()
+{
+    static std::size_t Count = 0U;
+    return Count;
+}
+
+inline bool check(bool cond, const char* expr, const char* file, int line)
+{
+    if (!cond) {
+        std::cerr << file << ":" << line << ": check failed: " << expr << std::endl;
+        ++failuresCount();
+    }
+    return cond;
+}
+
+/// @brief Report the result of the test, to be returned from @b main().
+inline int result()
+{
+    if (failuresCount() != 0U) {
+        std::cerr << failuresCount() << " check(s) failed" << std::endl;
+        return 1;
+    }
+    return 0;
+}
+
+/// @brief Build complete UBX frame (sync, header, payload and checksum).
+inline std::vector<std::uint8_t> makeFrame(
+    std::uint8_t cls,
+    std::uint8_t id,
+    const std::vector<std::uint8_t>& payload)
+{
+    static const std::size_t ByteBits = std::numeric_limits<std::uint8_t>::digits;
+    std::vector<std::uint8_t> frame;
+    frame.reserve(payload.size() + 8U);
+    frame.push_back(0xb5);
+    frame.push_back(0x62);
+    frame.push_back(cls);
+    frame.push_back(id);
+    frame.push_back(static_cast<std::uint8_t>(payload.size()));
+    frame.push_back(static_cast<std::uint8_t>(payload.size() >> ByteBits));
+    frame.insert(frame.end(), payload.begin(), payload.end());
+
+    const std::uint8_t* iter = &frame[2];
+    auto checksum = ublox::protocol::ChecksumCalc()(iter, frame.size() - 2U);
+    frame.push_back(static_cast<std::uint8_t>(checksum));
+    frame.push_back(static_cast<std::uint8_t>(checksum >> ByteBits));
+    return frame;
+}
+
+/// @brief Build complete UBX frame of the message with provided ID.
+inline std::vector<std::uint8_t> makeFrame(
+    ublox::MsgId id,
+    const std::vector<std::uint8_t>& payload)
+{
+    auto idValue = static_cast<unsigned>(id);
+    return makeFrame(
+        static_cast<std::uint8_t>(idValue >> std::numeric_limits<std::uint8_t>::digits),
+        static_cast<std::uint8_t>(idValue),
+        payload);
+}
+
+/// @brief Simple deterministic pseudo-random generator (xorshift).
+class Random
+{
+public:
+    explicit Random(std::uint32_t seed = 0x12345678U)
+      : m_state(seed)
+    {
+    }
+
+    std::uint32_t next()
+    {
+        m_state ^= m_state << 13;
+        m_state ^= m_state >> 17;
+        m_state ^= m_state << 5;
+        return m_state;
+    }
+
+private:
+    std::uint32_t m_state = 0U;
+};
+
+} // namespace test
+
+}  // namespace ublox
+
+/// @brief Check the condition, report the failure and continue.
+#define UBLOX_TEST_CHECK(cond_) ublox::test::check(static_cast<bool>(cond_), #cond_, __FILE__, __LINE__)
+
+
@@ -0,0 +1,90 @@
+//
+// Copyright 2018 (C). Alex Robenko. All rights reserved.
+//
+
+// This file is free software: you can redistribute it and/or modify
+// it under the terms of the GNU General Public License as published by
+// the Free Software Foundation, either version 3 of the License, or
+// (at your option) any later version.
+//
+// This program is distributed in the hope that it will be useful,
+// but WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+// GNU General Public License for more details.
+//
+// You should have received a copy of the GNU General Public License
+// along with this program.  If not, see <http://www.gnu.org/licenses/>.
+
+/// @file
+/// @brief Pseudo-terminal helpers of the unittests, Linux only.
+
+#pragma once
+
+#include <cstdint>
+#include <cstddef>
+#include <vector>
+
+#include <pty.h>
+#include <unistd.h>
+
+namespace ublox
+{
+
+namespace test
+{
+
+/// @brief Pseudo-terminal used as stand-in device.
+struct Pty
+{
+    int m_master = -1;
+    int m_slave = -1;
+    char m_name[128] = {0};
+
+    Pty()
+    {
+        ::openpty(&m_master, &m_slave, m_name, nullptr, nullptr);
+    }
+
+    ~Pty()
+    {
+        close();
+    }
+
+    bool isValid() const
+    {
+        return (0 <= m_master) && (0 <= m_slave);
+    }
+
+    /// @brief Close both sides, the device opened by name sees hang up.
+    void close()
+    {
+        if (0 <= m_master) {
+            ::close(m_master);
+            m_master = -1;
+        }
+
+        if (0 <= m_slave) {
+            ::close(m_slave);
+            m_slave = -1;
+        }
+    }
+};
+
+/// @brief Write all the data to the blocking descriptor.
+inline bool writeAll(int fd, const std::vector<std::uint8_t>& data)
+{
+    std::size_t pos = 0U;
+    while (pos < data.size()) {
+        auto result = ::write(fd, &data[pos], data.size() - pos);
+        if (result < 0) {
+            return false;
+        }
+        pos += static_cast<std::size_t>(result);
+    }
+    return true;
+}
+
+} // namespace test
+
+}  // namespace ublox
+